@@ -265,7 +265,8 @@ class ThriftInfinityClient:
 
     @retry_wrapper
     def select(self, db_name: str, table_name: str, select_list, highlight_list, search_expr,
-               where_expr, group_by_list, having_expr, limit_expr, offset_expr, order_by_list, total_hits_count):
+               where_expr, group_by_list, having_expr, limit_expr, offset_expr, order_by_list, total_hits_count,
+               arrow_result=None):
         return self.client.Select(SelectRequest(session_id=self.session_id,
                                                 db_name=db_name,
                                                 table_name=table_name,
@@ -278,7 +279,8 @@ class ThriftInfinityClient:
                                                 limit_expr=limit_expr,
                                                 offset_expr=offset_expr,
                                                 order_by_list=order_by_list,
-                                                total_hits_count=total_hits_count
+                                                total_hits_count=total_hits_count,
+                                                arrow_result=arrow_result
                                                 ))
 
     @retry_wrapper
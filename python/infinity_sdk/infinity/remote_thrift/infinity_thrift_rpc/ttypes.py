@@ -6967,6 +6967,7 @@ class SelectRequest(object):
      - offset_expr
      - order_by_list
      - total_hits_count
+     - arrow_result
 
     """
     thrift_spec = None
@@ -6976,7 +6977,7 @@ class SelectRequest(object):
     ], highlight_list = [
     ], search_expr = None, where_expr = None, group_by_list = [
     ], having_expr = None, limit_expr = None, offset_expr = None, order_by_list = [
-    ], total_hits_count = None,):
+    ], total_hits_count = None, arrow_result = None,):
         self.session_id = session_id
         self.db_name = db_name
         self.table_name = table_name
@@ -7002,6 +7003,7 @@ class SelectRequest(object):
             ]
         self.order_by_list = order_by_list
         self.total_hits_count = total_hits_count
+        self.arrow_result = arrow_result
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -7106,6 +7108,11 @@ class SelectRequest(object):
                     self.total_hits_count = iprot.readBool()
                 else:
                     iprot.skip(ftype)
+            elif fid == 14:
+                if ftype == TType.BOOL:
+                    self.arrow_result = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -7181,6 +7188,10 @@ class SelectRequest(object):
             oprot.writeFieldBegin('total_hits_count', TType.BOOL, 13)
             oprot.writeBool(self.total_hits_count)
             oprot.writeFieldEnd()
+        if self.arrow_result is not None:
+            oprot.writeFieldBegin('arrow_result', TType.BOOL, 14)
+            oprot.writeBool(self.arrow_result)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -7207,6 +7218,7 @@ class SelectResponse(object):
      - column_defs
      - column_fields
      - extra_result
+     - arrow_ipc
 
     """
     thrift_spec = None
@@ -7214,7 +7226,7 @@ class SelectResponse(object):
 
     def __init__(self, error_code = None, error_msg = None, column_defs = [
     ], column_fields = [
-    ], extra_result = None,):
+    ], extra_result = None, arrow_ipc = None,):
         self.error_code = error_code
         self.error_msg = error_msg
         if column_defs is self.thrift_spec[3][4]:
@@ -7226,6 +7238,7 @@ class SelectResponse(object):
             ]
         self.column_fields = column_fields
         self.extra_result = extra_result
+        self.arrow_ipc = arrow_ipc
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -7273,6 +7286,11 @@ class SelectResponse(object):
                     self.extra_result = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.STRING:
+                    self.arrow_ipc = iprot.readBinary()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -7310,6 +7328,10 @@ class SelectResponse(object):
             oprot.writeFieldBegin('extra_result', TType.STRING, 5)
             oprot.writeString(self.extra_result.encode('utf-8') if sys.version_info[0] == 2 else self.extra_result)
             oprot.writeFieldEnd()
+        if self.arrow_ipc is not None:
+            oprot.writeFieldBegin('arrow_ipc', TType.STRING, 6)
+            oprot.writeBinary(self.arrow_ipc)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -9853,6 +9875,7 @@ SelectRequest.thrift_spec = (
     (12, TType.LIST, 'order_by_list', (TType.STRUCT, [OrderByExpr, None], False), [
     ], ),  # 12
     (13, TType.BOOL, 'total_hits_count', None, None, ),  # 13
+    (14, TType.BOOL, 'arrow_result', None, None, ),  # 14
 )
 all_structs.append(SelectResponse)
 SelectResponse.thrift_spec = (
@@ -9864,6 +9887,7 @@ SelectResponse.thrift_spec = (
     (4, TType.LIST, 'column_fields', (TType.STRUCT, [ColumnField, None], False), [
     ], ),  # 4
     (5, TType.STRING, 'extra_result', 'UTF8', None, ),  # 5
+    (6, TType.STRING, 'arrow_ipc', 'BINARY', None, ),  # 6
 )
 all_structs.append(DeleteRequest)
 DeleteRequest.thrift_spec = (
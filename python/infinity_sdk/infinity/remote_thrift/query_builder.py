@@ -570,8 +570,20 @@ class InfinityThriftQueryBuilder(ABC):
         return pl.from_pandas(dataframe), extra_result
 
     def to_arrow(self) -> (Table, {}):
-        dataframe, extra_result = self.to_df()
-        return pa.Table.from_pandas(dataframe), extra_result
+        query = Query(
+            columns=self._columns,
+            highlight=self._highlight,
+            search=self._search,
+            filter=self._filter,
+            groupby=self._groupby,
+            having=self._having,
+            limit=self._limit,
+            offset=self._offset,
+            sort=self._sort,
+            total_hits_count=self._total_hits_count,
+        )
+        self.reset()
+        return self._table._execute_arrow_query(query)
 
     def explain(self, explain_type=ExplainType.Physical) -> Any:
         query = ExplainQuery(
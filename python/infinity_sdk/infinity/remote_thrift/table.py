@@ -17,6 +17,8 @@ import functools
 import inspect
 from typing import Optional, Union, List, Any
 
+import pandas as pd
+import pyarrow as pa
 from sqlglot import condition
 
 import infinity.remote_thrift.infinity_thrift_rpc.ttypes as ttypes
@@ -24,7 +26,7 @@ from infinity.common import INSERT_DATA, VEC, InfinityException, SparseVector
 from infinity.errors import ErrorCode
 from infinity.index import IndexInfo
 from infinity.remote_thrift.query_builder import Query, InfinityThriftQueryBuilder, ExplainQuery
-from infinity.remote_thrift.types import build_result
+from infinity.remote_thrift.types import build_result, logic_type_to_dtype
 from infinity.remote_thrift.utils import (
     traverse_conditions,
     name_validity_check,
@@ -530,6 +532,39 @@ class RemoteTable():
         else:
             raise InfinityException(res.error_code, res.error_msg)
 
+    def _execute_arrow_query(self, query: Query) -> tuple[pa.Table, Any]:
+        res = self._conn.select(db_name=self._db_name,
+                                table_name=self._table_name,
+                                select_list=query.columns,
+                                highlight_list=query.highlight,
+                                search_expr=query.search,
+                                where_expr=query.filter,
+                                group_by_list=query.groupby,
+                                having_expr=query.having,
+                                limit_expr=query.limit,
+                                offset_expr=query.offset,
+                                order_by_list=query.sort,
+                                total_hits_count=query.total_hits_count,
+                                arrow_result=True)
+        if res.error_code != ErrorCode.OK:
+            raise InfinityException(res.error_code, res.error_msg)
+
+        if res.arrow_ipc is None:
+            # server replied with column fields, e.g. for column types arrow can't represent
+            data_dict, data_type_dict, extra_result = build_result(res)
+            df_dict = {}
+            for k, v in data_dict.items():
+                df_dict[k] = pd.Series(v, dtype=logic_type_to_dtype(data_type_dict[k]))
+            return pa.Table.from_pandas(pd.DataFrame(df_dict)), extra_result
+
+        extra_result = None
+        if res.extra_result:
+            try:
+                extra_result = json.loads(res.extra_result)
+            except json.JSONDecodeError:
+                pass
+        return pa.ipc.open_stream(res.arrow_ipc).read_all(), extra_result
+
     def _explain_query(self, query: ExplainQuery) -> Any:
         res = self._conn.explain(db_name=self._db_name,
                                  table_name=self._table_name,
@@ -732,6 +732,59 @@ class TestInfinity:
         res = db_obj.drop_table("test_fulltext_operator_option" + suffix, ConflictType.Error)
         assert res.error_code == ErrorCode.OK
 
+    @pytest.mark.parametrize("check_data", [{"file_name": "enwiki_embedding_99_commas.csv",
+                                             "data_dir": common_values.TEST_TMP_DIR}], indirect=True)
+    def test_fulltext_partitioned_search(self, check_data, suffix):
+        db_obj = self.infinity_obj.get_database("default_db")
+        db_obj.drop_table("test_fulltext_partitioned_search" + suffix, ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_fulltext_partitioned_search" + suffix,
+                                        {"doctitle": {"type": "varchar"},
+                                         "docdate": {"type": "varchar"},
+                                         "body": {"type": "varchar"},
+                                         "num": {"type": "int"},
+                                         "vec": {"type": "vector, 4, float"}})
+        table_obj.create_index("my_index",
+                               index.IndexInfo("body",
+                                               index.IndexType.FullText,
+                                               {"ANALYZER": "standard"}),
+                               ConflictType.Error)
+        if not check_data:
+            generate_commas_enwiki(
+                "enwiki_99.csv", "enwiki_embedding_99_commas.csv", 1)
+            copy_data("enwiki_embedding_99_commas.csv")
+        test_csv_dir = common_values.TEST_TMP_DIR + "enwiki_embedding_99_commas.csv"
+        # every import creates a new segment, so the search below can be split into several partitions
+        for i in range(4):
+            table_obj.import_data(test_csv_dir, import_options={"delimiter": ","})
+
+        for filter_expr in [None, "num!=98 AND num != 12"]:
+            single_options = {"operator": "or"}
+            partitioned_options = {"operator": "or", "partition_min_rows": "1"}
+            query_single = table_obj.output(["_row_id", "_score"])
+            query_partitioned = table_obj.output(["_row_id", "_score"])
+            if filter_expr is not None:
+                query_single = query_single.filter(filter_expr)
+                query_partitioned = query_partitioned.filter(filter_expr)
+            res_single, extra_result = query_single.match_text("body^5", "black OR white", 100,
+                                                               single_options).to_pl()
+            res_partitioned, extra_result = query_partitioned.match_text("body^5", "black OR white", 100,
+                                                                         partitioned_options).to_pl()
+            assert len(res_single) > 0
+            # ties may come back in a different order, compare by row id
+            res_single = res_single.sort(res_single.columns[0])
+            res_partitioned = res_partitioned.sort(res_partitioned.columns[0])
+            pl_assert_frame_equal(res_single, res_partitioned)
+
+        with pytest.raises(InfinityException) as e_info:
+            table_obj.output(["_row_id"]).match_text("body^5", "black", 10,
+                                                     {"partition_min_rows": "0"}).to_pl()
+        print(e_info.value.error_message)
+
+        res = table_obj.drop_index("my_index", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+        res = db_obj.drop_table("test_fulltext_partitioned_search" + suffix, ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
     @pytest.mark.parametrize("match_param_1", ["body^5"])
     @pytest.mark.parametrize("check_data", [{"file_name": "enwiki_embedding_99_commas.csv",
                                              "data_dir": common_values.TEST_TMP_DIR}], indirect=True)
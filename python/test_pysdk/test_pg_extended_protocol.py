@@ -0,0 +1,101 @@
+import pytest
+from common import common_values
+import infinity
+from infinity.errors import ErrorCode
+from infinity.common import ConflictType
+
+pq = pytest.importorskip("psycopg.pq")
+
+# libpq drives the extended query protocol: Parse, Bind, Describe, Execute and Sync
+PG_CONNINFO = b"host=127.0.0.1 port=5432 dbname=default_db user=infinity"
+INT4_OID = 23
+TEXT_OID = 25
+
+
+@pytest.mark.usefixtures("suffix")
+class TestPGExtendedProtocol:
+    @pytest.fixture(autouse=True)
+    def setup(self, suffix):
+        self.infinity_obj = infinity.connect(common_values.TEST_LOCAL_HOST)
+        self.table_name = "test_pg_extended_protocol" + suffix
+        db_obj = self.infinity_obj.get_database("default_db")
+        db_obj.drop_table(self.table_name, ConflictType.Ignore)
+        table_obj = db_obj.create_table(self.table_name, {"c1": {"type": "int"}, "c2": {"type": "varchar"}})
+        res = table_obj.insert([{"c1": 1, "c2": "a"}, {"c1": 2, "c2": "b"}, {"c1": 3, "c2": "c"}])
+        assert res.error_code == ErrorCode.OK
+        self.pgconn = pq.PGconn.connect(PG_CONNINFO)
+        assert self.pgconn.status == pq.ConnStatus.OK
+        yield
+        self.pgconn.finish()
+        res = db_obj.drop_table(self.table_name, ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+        self.infinity_obj.disconnect()
+
+    def test_prepare_describe_execute(self):
+        query = f"SELECT c1, c2 FROM {self.table_name} WHERE c1 > $1 AND c2 <> $2".encode()
+        res = self.pgconn.prepare(b"stmt", query, [INT4_OID, 0])
+        assert res.status == pq.ExecStatus.COMMAND_OK, res.error_message
+
+        res = self.pgconn.describe_prepared(b"stmt")
+        assert res.status == pq.ExecStatus.COMMAND_OK, res.error_message
+        assert res.nparams == 2
+        assert res.param_type(0) == INT4_OID
+        # open parameter types are announced as text
+        assert res.param_type(1) == TEXT_OID
+        assert res.nfields == 2
+        assert [res.fname(0), res.fname(1)] == [b"c1", b"c2"]
+        assert [res.ftype(0), res.ftype(1)] == [INT4_OID, TEXT_OID]
+
+        # the statement is parsed once and run with the parameters of every execution
+        res = self.pgconn.exec_prepared(b"stmt", [b"1", b"c"])
+        assert res.status == pq.ExecStatus.TUPLES_OK, res.error_message
+        assert [(res.get_value(i, 0), res.get_value(i, 1)) for i in range(res.ntuples)] == [(b"2", b"b")]
+
+        res = self.pgconn.exec_prepared(b"stmt", [b"0", b"x"])
+        assert res.status == pq.ExecStatus.TUPLES_OK, res.error_message
+        assert sorted(res.get_value(i, 0) for i in range(res.ntuples)) == [b"1", b"2", b"3"]
+
+        # binary int4 parameter
+        res = self.pgconn.exec_prepared(b"stmt", [(2).to_bytes(4, "big"), b"x"], param_formats=[1, 0])
+        assert res.status == pq.ExecStatus.TUPLES_OK, res.error_message
+        assert [res.get_value(i, 0) for i in range(res.ntuples)] == [b"3"]
+
+    def test_unnamed_statement(self):
+        query = f"SELECT c2 FROM {self.table_name} WHERE c1 = $1".encode()
+        res = self.pgconn.exec_params(query, [b"3"])
+        assert res.status == pq.ExecStatus.TUPLES_OK, res.error_message
+        assert res.ntuples == 1
+        assert res.get_value(0, 0) == b"c"
+
+    def test_error_recovery(self):
+        # every failed message is followed by Sync, the connection has to serve the next request
+        res = self.pgconn.prepare(b"bad", b"SELECT FROM WHERE $1")
+        assert res.status == pq.ExecStatus.FATAL_ERROR
+
+        res = self.pgconn.exec_prepared(b"missing", [])
+        assert res.status == pq.ExecStatus.FATAL_ERROR
+
+        query = f"SELECT c1 FROM {self.table_name} WHERE c1 = $1".encode()
+        res = self.pgconn.prepare(b"stmt", query, [INT4_OID])
+        assert res.status == pq.ExecStatus.COMMAND_OK, res.error_message
+        # wrong number of parameters
+        res = self.pgconn.exec_prepared(b"stmt", [b"1", b"2"])
+        assert res.status == pq.ExecStatus.FATAL_ERROR
+        # not an integer
+        res = self.pgconn.exec_prepared(b"stmt", [b"abc"])
+        assert res.status == pq.ExecStatus.FATAL_ERROR
+        # unknown column, fails on bind
+        res = self.pgconn.exec_params(f"SELECT c9 FROM {self.table_name} WHERE c1 = $1".encode(), [b"1"])
+        assert res.status == pq.ExecStatus.FATAL_ERROR
+
+        res = self.pgconn.exec_prepared(b"stmt", [b"1"])
+        assert res.status == pq.ExecStatus.TUPLES_OK, res.error_message
+        assert res.ntuples == 1
+        assert res.get_value(0, 0) == b"1"
+
+    def test_simple_query_rejects_placeholder(self):
+        res = self.pgconn.exec_(f"SELECT c1 FROM {self.table_name} WHERE c1 = ?".encode())
+        assert res.status == pq.ExecStatus.FATAL_ERROR
+        res = self.pgconn.exec_(f"SELECT c1 FROM {self.table_name} WHERE c1 = 1".encode())
+        assert res.status == pq.ExecStatus.TUPLES_OK, res.error_message
+        assert res.ntuples == 1
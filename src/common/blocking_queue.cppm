@@ -175,6 +175,20 @@ public:
         return true;
     }
 
+    bool TryDequeueBulkWait(Deque<T> &output_array, std::chrono::microseconds wait_time) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            bool ok = empty_cv_.wait_for(lock, wait_time, [this] { return !queue_.empty(); });
+            if (!ok) {
+                return false;
+            }
+            output_array.insert(output_array.end(), queue_.begin(), queue_.end());
+            queue_.clear();
+        }
+        full_cv_.notify_one();
+        return true;
+    }
+
     [[nodiscard]] SizeT Size() const {
         std::lock_guard<std::mutex> lock(queue_mutex_);
         return queue_.size();
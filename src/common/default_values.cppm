@@ -76,6 +76,8 @@ export {
     constexpr SizeT BG_GROUND_TASK_QUEUE_SIZE = 65536;
     constexpr SizeT EXECUTOR_TASK_QUEUE_SIZE = 1024;
     constexpr SizeT DEFAULT_BLOCKING_QUEUE_SIZE = 1024;
+    constexpr SizeT DEFAULT_WORKER_DEQUE_CAPACITY = 1024; // power of 2
+    constexpr SizeT MAX_WORKER_IDLE_WAIT_MS = 32;
 
     // transaction related constants
     constexpr u64 MAX_TXN_ID = std::numeric_limits<u64>::max();
@@ -114,11 +116,30 @@ export {
     constexpr SizeT DEFAULT_MEMINDEX_CAPACITY = 8 * DEFAULT_BLOCK_CAPACITY; // 8 * 8192 = 65536 rows
     constexpr SizeT MAX_MEMINDEX_CAPACITY = DEFAULT_SEGMENT_CAPACITY;       // 1 Segment
 
+    // sorted runs of ORDER BY kept in memory before spilling to the temp dir
+    constexpr SizeT DEFAULT_SORT_MEMORY_LIMIT = 256 * 1024l * 1024l; // 256MB
+    constexpr std::string_view DEFAULT_SORT_MEMORY_LIMIT_STR = "256MB";  // 256MB
+    // merged blocks of ORDER BY handed to the next operator per execution
+    constexpr SizeT SORT_MERGE_OUTPUT_BLOCK_COUNT = 4;
+
+    // input text of IMPORT parsed on worker threads and not yet written to segments
+    constexpr SizeT DEFAULT_IMPORT_MEMORY_BUDGET = 256 * 1024l * 1024l; // 256MB
+
     constexpr i64 MIN_WAL_FILE_SIZE_THRESHOLD = 1024;                                    // 1KB
     constexpr i64 DEFAULT_WAL_FILE_SIZE_THRESHOLD = 1 * 1024l * 1024l * 1024l;           // 1GB
     constexpr std::string_view DEFAULT_WAL_FILE_SIZE_THRESHOLD_STR = "1GB";              // 1GB
     constexpr i64 MAX_WAL_FILE_SIZE_THRESHOLD = 1024l * DEFAULT_WAL_FILE_SIZE_THRESHOLD; // 1TB
 
+    constexpr i64 MIN_WAL_GROUP_COMMIT_DELAY_US = 0; // 0 means no waiting for more transactions
+    constexpr i64 DEFAULT_WAL_GROUP_COMMIT_DELAY_US = 0;
+    constexpr i64 MAX_WAL_GROUP_COMMIT_DELAY_US = 1000 * 1000; // 1 second
+
+    constexpr i64 MIN_WAL_GROUP_COMMIT_MAX_BATCH = 1;
+    constexpr i64 DEFAULT_WAL_GROUP_COMMIT_MAX_BATCH = 1024;
+    constexpr i64 MAX_WAL_GROUP_COMMIT_MAX_BATCH = 64 * 1024;
+
+    constexpr SizeT WAL_PREALLOCATE_SIZE = 64 * 1024 * 1024; // 64MB
+
     constexpr i64 MIN_CHECKPOINT_INTERVAL_SEC = 0;                          // 0 means disable checkpoint
     constexpr i64 DEFAULT_CHECKPOINT_INTERVAL_SEC = 30;                     // 30 seconds
     constexpr std::string_view DEFAULT_CHECKPOINT_INTERVAL_SEC_STR = "30s"; // 30 seconds
@@ -164,6 +185,8 @@ export {
     constexpr SizeT DISKANN_MAX_GRAPH_DEGREE = 512;   // SSD index max degree
     constexpr SizeT DISKANN_SECTOR_LEN = 4096u;       // SSD index sector size
     constexpr SizeT DISKANN_MAX_N_SECTOR_READS = 128; // SSD index max sector reads
+    constexpr u32 DISKANN_NUM_SEARCH_SCRATCH = 4;     // concurrent searches of one index chunk
+    constexpr u32 DISKANN_BEAM_WIDTH = 4;             // default sector reads per search step
 
     // default hnsw parameter
     constexpr SizeT HNSW_M = 16;
@@ -179,6 +202,15 @@ export {
     constexpr SizeT DBT_COMPACTION_M = 4;
     constexpr SizeT DBT_COMPACTION_C = 4;
     constexpr SizeT DBT_COMPACTION_S = DEFAULT_BLOCK_CAPACITY;
+    // segments with this ratio of deleted rows are rewritten before the size tiers are merged
+    constexpr f64 DEFAULT_COMPACTION_DELETE_RATIO = 0.2;
+    // commits after the first delete of a segment at which its score is raised by half
+    constexpr TxnTimeStamp DEFAULT_COMPACTION_DELETE_AGE = 10000;
+    // bytes rewritten by compaction per periodic trigger
+    constexpr SizeT DEFAULT_COMPACTION_IO_BUDGET = 1024l * 1024l * 1024l; // 1GB
+
+    // rows a partition of a fulltext query searches at least, smaller tables are searched by one thread
+    constexpr SizeT DEFAULT_MATCH_PARTITION_MIN_ROW_COUNT = 1024 * 1024;
 
     // default query option parameter
     constexpr u32 DEFAULT_MATCH_TEXT_OPTION_TOP_N = 10;
@@ -187,6 +219,8 @@ export {
 
     constexpr SizeT DEFAULT_BUFFER_MANAGER_SIZE = 8 * 1024lu * 1024lu * 1024lu; // 8Gib
     constexpr SizeT DEFAULT_BUFFER_MANAGER_LRU_COUNT = 7;
+    constexpr SizeT DEFAULT_BUFFER_MANAGER_GHOST_COUNT = 1024; // per lru
+    constexpr SizeT DEFAULT_BUFFER_MANAGER_PREFETCH_THREAD_NUM = 4;
     constexpr std::string_view DEFAULT_BUFFER_MANAGER_SIZE_STR = "8GB"; // 8Gib
 
     constexpr SizeT DEFAULT_MEMINDEX_MEMORY_QUOTA = 4 * 1024lu * 1024lu * 1024lu; // 4GB
@@ -199,6 +233,9 @@ export {
 
     constexpr std::string_view DEFAULT_RESULT_CACHE = "off";
     constexpr SizeT DEFAULT_CACHE_RESULT_CAPACITY = 10000;
+    constexpr SizeT DEFAULT_CACHE_RESULT_MEMORY_LIMIT = 1024lu * 1024lu * 1024lu; // 1GB
+    constexpr SizeT CACHE_RESULT_MAX_SHARD_NUM = 16;
+    constexpr SizeT CACHE_RESULT_MIN_SHARD_CAPACITY = 64;
 
     constexpr std::string_view DEFAULT_SNAPSHOT_DIR = "/var/infinity/snapshot";
 
@@ -231,6 +268,7 @@ export {
     constexpr std::string_view TIME_ZONE_OPTION_NAME = "time_zone";
     constexpr std::string_view TIME_ZONE_BIAS_OPTION_NAME = "time_zone_bias";
     constexpr std::string_view CPU_LIMIT_OPTION_NAME = "cpu_limit";
+    constexpr std::string_view TASK_STEALING_OPTION_NAME = "task_stealing";
     constexpr std::string_view SERVER_ADDRESS_OPTION_NAME = "server_address";
     constexpr std::string_view PEER_SERVER_IP_OPTION_NAME = "peer_ip";
     constexpr std::string_view PEER_SERVER_PORT_OPTION_NAME = "peer_port";
@@ -280,6 +318,7 @@ export {
     constexpr std::string_view LRU_NUM_OPTION_NAME = "lru_num";
     constexpr std::string_view TEMP_DIR_OPTION_NAME = "temp_dir";
     constexpr std::string_view MEMINDEX_MEMORY_QUOTA_OPTION_NAME = "memindex_memory_quota";
+    constexpr std::string_view SORT_MEMORY_LIMIT_OPTION_NAME = "sort_memory_limit";
     constexpr std::string_view RESULT_CACHE_OPTION_NAME = "result_cache";
     constexpr std::string_view CACHE_RESULT_CAPACITY_OPTION_NAME = "cache_result_capacity";
     constexpr std::string_view DENSE_INDEX_BUILDING_WORKER_OPTION_NAME = "dense_index_building_worker";
@@ -292,6 +331,8 @@ export {
     constexpr std::string_view CHECKPOINT_INTERVAL_OPTION_NAME = "checkpoint_interval";
 
     constexpr std::string_view WAL_FLUSH_OPTION_NAME = "wal_flush";
+    constexpr std::string_view WAL_GROUP_COMMIT_DELAY_OPTION_NAME = "wal_group_commit_delay";
+    constexpr std::string_view WAL_GROUP_COMMIT_MAX_BATCH_OPTION_NAME = "wal_group_commit_max_batch";
     constexpr std::string_view RESOURCE_DIR_OPTION_NAME = "resource_dir";
 
     constexpr std::string_view RECORD_RUNNING_QUERY_OPTION_NAME = "record_running_query";
@@ -335,6 +376,11 @@ export {
 
     // IO related
     constexpr SizeT DEFAULT_READ_BUFFER_SIZE = 4096;
+    constexpr SizeT DEFAULT_ASYNC_IO_QUEUE_DEPTH = 64;
+    constexpr SizeT DEFAULT_ASYNC_IO_THREAD_NUM = 8;       // used when io_uring is unavailable
+    constexpr SizeT DEFAULT_ASYNC_IO_CHUNK_SIZE = 1024lu * 1024lu; // 1MB per request
+    constexpr SizeT DEFAULT_ASYNC_IO_COPY_BUFFER_SIZE = 16 * DEFAULT_ASYNC_IO_CHUNK_SIZE;
+    constexpr SizeT DEFAULT_DIRECT_IO_ALIGNMENT = 4096;
 }
 
 } // namespace infinity
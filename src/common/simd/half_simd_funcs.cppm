@@ -0,0 +1,274 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "simd_common_intrin_include.h"
+#include <bit>
+#include <cmath>
+
+export module half_simd_funcs;
+import stl;
+import simd_common_tools;
+
+// Distance kernels on float16 and bfloat16 vectors, passed as their raw u16 bits.
+// All kernels widen to f32 and accumulate in f32, half precision accumulation loses too much on long vectors.
+
+namespace infinity {
+
+export inline f32 F16ToF32(u16 h) {
+    u32 sign = static_cast<u32>(h & 0x8000) << 16;
+    u32 exp = (h >> 10) & 0x1F;
+    u32 mant = h & 0x3FF;
+    u32 bits;
+    if (exp == 0) {
+        if (mant == 0) {
+            bits = sign;
+        } else {
+            // subnormal, normalize the mantissa
+            exp = 127 - 15 + 1;
+            while ((mant & 0x400) == 0) {
+                mant <<= 1;
+                --exp;
+            }
+            bits = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+        }
+    } else if (exp == 0x1F) {
+        bits = sign | 0x7F800000 | (mant << 13);
+    } else {
+        bits = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+    }
+    return std::bit_cast<f32>(bits);
+}
+
+export inline f32 BF16ToF32(u16 h) { return std::bit_cast<f32>(static_cast<u32>(h) << 16); }
+
+template <f32 (*ToF32)(u16)>
+f32 HalfL2BF(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    f32 res = 0;
+    for (SizeT i = 0; i < dim; ++i) {
+        f32 diff = ToF32(pv1[i]) - ToF32(pv2[i]);
+        res += diff * diff;
+    }
+    return res;
+}
+
+template <f32 (*ToF32)(u16)>
+f32 HalfIPBF(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    f32 res = 0;
+    for (SizeT i = 0; i < dim; ++i) {
+        res += ToF32(pv1[i]) * ToF32(pv2[i]);
+    }
+    return res;
+}
+
+template <f32 (*ToF32)(u16)>
+f32 HalfCosBF(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    f32 dot_product = 0;
+    f32 norm1 = 0;
+    f32 norm2 = 0;
+    for (SizeT i = 0; i < dim; ++i) {
+        f32 v1 = ToF32(pv1[i]);
+        f32 v2 = ToF32(pv2[i]);
+        dot_product += v1 * v2;
+        norm1 += v1 * v1;
+        norm2 += v2 * v2;
+    }
+    return dot_product ? dot_product / std::sqrt(norm1 * norm2) : 0.0f;
+}
+
+export f32 F16L2BF(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfL2BF<F16ToF32>(pv1, pv2, dim); }
+export f32 F16IPBF(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfIPBF<F16ToF32>(pv1, pv2, dim); }
+export f32 F16CosBF(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfCosBF<F16ToF32>(pv1, pv2, dim); }
+export f32 BF16L2BF(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfL2BF<BF16ToF32>(pv1, pv2, dim); }
+export f32 BF16IPBF(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfIPBF<BF16ToF32>(pv1, pv2, dim); }
+export f32 BF16CosBF(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfCosBF<BF16ToF32>(pv1, pv2, dim); }
+
+#if defined(__AVX512F__)
+
+inline __m512 LoadF16AVX512(const u16 *p) { return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p))); }
+
+inline __m512 LoadBF16AVX512(const u16 *p) {
+    __m512i widen = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(widen, 16));
+}
+
+template <__m512 (*Load)(const u16 *), f32 (*ToF32)(u16)>
+f32 HalfL2AVX512(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    __m512 sum = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        __m512 diff = _mm512_sub_ps(Load(pv1 + i), Load(pv2 + i));
+        sum = _mm512_fmadd_ps(diff, diff, sum);
+    }
+    return _mm512_reduce_add_ps(sum) + HalfL2BF<ToF32>(pv1 + i, pv2 + i, dim - i);
+}
+
+template <__m512 (*Load)(const u16 *), f32 (*ToF32)(u16)>
+f32 HalfIPAVX512(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    __m512 sum = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        sum = _mm512_fmadd_ps(Load(pv1 + i), Load(pv2 + i), sum);
+    }
+    return _mm512_reduce_add_ps(sum) + HalfIPBF<ToF32>(pv1 + i, pv2 + i, dim - i);
+}
+
+template <__m512 (*Load)(const u16 *), f32 (*ToF32)(u16)>
+f32 HalfCosAVX512(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    __m512 mul = _mm512_setzero_ps();
+    __m512 norm_v1 = _mm512_setzero_ps();
+    __m512 norm_v2 = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 16 <= dim; i += 16) {
+        __m512 v1 = Load(pv1 + i);
+        __m512 v2 = Load(pv2 + i);
+        mul = _mm512_fmadd_ps(v1, v2, mul);
+        norm_v1 = _mm512_fmadd_ps(v1, v1, norm_v1);
+        norm_v2 = _mm512_fmadd_ps(v2, v2, norm_v2);
+    }
+    f32 dot_product = _mm512_reduce_add_ps(mul);
+    f32 norm1 = _mm512_reduce_add_ps(norm_v1);
+    f32 norm2 = _mm512_reduce_add_ps(norm_v2);
+    for (; i < dim; ++i) {
+        f32 v1 = ToF32(pv1[i]);
+        f32 v2 = ToF32(pv2[i]);
+        dot_product += v1 * v2;
+        norm1 += v1 * v1;
+        norm2 += v2 * v2;
+    }
+    return dot_product ? dot_product / std::sqrt(norm1 * norm2) : 0.0f;
+}
+
+export f32 F16L2AVX512(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfL2AVX512<LoadF16AVX512, F16ToF32>(pv1, pv2, dim); }
+export f32 F16IPAVX512(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfIPAVX512<LoadF16AVX512, F16ToF32>(pv1, pv2, dim); }
+export f32 F16CosAVX512(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfCosAVX512<LoadF16AVX512, F16ToF32>(pv1, pv2, dim); }
+export f32 BF16L2AVX512(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfL2AVX512<LoadBF16AVX512, BF16ToF32>(pv1, pv2, dim); }
+export f32 BF16IPAVX512(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfIPAVX512<LoadBF16AVX512, BF16ToF32>(pv1, pv2, dim); }
+export f32 BF16CosAVX512(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfCosAVX512<LoadBF16AVX512, BF16ToF32>(pv1, pv2, dim); }
+
+#endif
+
+#if defined(__AVX512BF16__)
+
+// vdpbf16ps multiplies bf16 pairs and accumulates in f32, 32 elements per instruction.
+inline __m512bh LoadBF16Pairs(const u16 *p) { return (__m512bh)_mm512_loadu_si512(p); }
+
+export f32 BF16IPAVX512BF16(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    __m512 sum = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 32 <= dim; i += 32) {
+        sum = _mm512_dpbf16_ps(sum, LoadBF16Pairs(pv1 + i), LoadBF16Pairs(pv2 + i));
+    }
+    return _mm512_reduce_add_ps(sum) + HalfIPBF<BF16ToF32>(pv1 + i, pv2 + i, dim - i);
+}
+
+export f32 BF16CosAVX512BF16(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    __m512 mul = _mm512_setzero_ps();
+    __m512 norm_v1 = _mm512_setzero_ps();
+    __m512 norm_v2 = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 32 <= dim; i += 32) {
+        __m512bh v1 = LoadBF16Pairs(pv1 + i);
+        __m512bh v2 = LoadBF16Pairs(pv2 + i);
+        mul = _mm512_dpbf16_ps(mul, v1, v2);
+        norm_v1 = _mm512_dpbf16_ps(norm_v1, v1, v1);
+        norm_v2 = _mm512_dpbf16_ps(norm_v2, v2, v2);
+    }
+    f32 dot_product = _mm512_reduce_add_ps(mul);
+    f32 norm1 = _mm512_reduce_add_ps(norm_v1);
+    f32 norm2 = _mm512_reduce_add_ps(norm_v2);
+    for (; i < dim; ++i) {
+        f32 v1 = BF16ToF32(pv1[i]);
+        f32 v2 = BF16ToF32(pv2[i]);
+        dot_product += v1 * v2;
+        norm1 += v1 * v1;
+        norm2 += v2 * v2;
+    }
+    return dot_product ? dot_product / std::sqrt(norm1 * norm2) : 0.0f;
+}
+
+#endif
+
+#if defined(__AVX2__)
+
+inline __m256 LoadBF16AVX2(const u16 *p) {
+    __m256i widen = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(widen, 16));
+}
+
+#if defined(__F16C__)
+inline __m256 LoadF16AVX2(const u16 *p) { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))); }
+#endif
+
+template <__m256 (*Load)(const u16 *), f32 (*ToF32)(u16)>
+f32 HalfL2AVX2(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    __m256 sum = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        __m256 diff = _mm256_sub_ps(Load(pv1 + i), Load(pv2 + i));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(diff, diff));
+    }
+    return hsum256_ps_avx(sum) + HalfL2BF<ToF32>(pv1 + i, pv2 + i, dim - i);
+}
+
+template <__m256 (*Load)(const u16 *), f32 (*ToF32)(u16)>
+f32 HalfIPAVX2(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    __m256 sum = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(Load(pv1 + i), Load(pv2 + i)));
+    }
+    return hsum256_ps_avx(sum) + HalfIPBF<ToF32>(pv1 + i, pv2 + i, dim - i);
+}
+
+template <__m256 (*Load)(const u16 *), f32 (*ToF32)(u16)>
+f32 HalfCosAVX2(const u16 *pv1, const u16 *pv2, SizeT dim) {
+    __m256 mul = _mm256_setzero_ps();
+    __m256 norm_v1 = _mm256_setzero_ps();
+    __m256 norm_v2 = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        __m256 v1 = Load(pv1 + i);
+        __m256 v2 = Load(pv2 + i);
+        mul = _mm256_add_ps(mul, _mm256_mul_ps(v1, v2));
+        norm_v1 = _mm256_add_ps(norm_v1, _mm256_mul_ps(v1, v1));
+        norm_v2 = _mm256_add_ps(norm_v2, _mm256_mul_ps(v2, v2));
+    }
+    f32 dot_product = hsum256_ps_avx(mul);
+    f32 norm1 = hsum256_ps_avx(norm_v1);
+    f32 norm2 = hsum256_ps_avx(norm_v2);
+    for (; i < dim; ++i) {
+        f32 v1 = ToF32(pv1[i]);
+        f32 v2 = ToF32(pv2[i]);
+        dot_product += v1 * v2;
+        norm1 += v1 * v1;
+        norm2 += v2 * v2;
+    }
+    return dot_product ? dot_product / std::sqrt(norm1 * norm2) : 0.0f;
+}
+
+#if defined(__F16C__)
+export f32 F16L2F16C(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfL2AVX2<LoadF16AVX2, F16ToF32>(pv1, pv2, dim); }
+export f32 F16IPF16C(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfIPAVX2<LoadF16AVX2, F16ToF32>(pv1, pv2, dim); }
+export f32 F16CosF16C(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfCosAVX2<LoadF16AVX2, F16ToF32>(pv1, pv2, dim); }
+#endif
+
+export f32 BF16L2AVX2(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfL2AVX2<LoadBF16AVX2, BF16ToF32>(pv1, pv2, dim); }
+export f32 BF16IPAVX2(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfIPAVX2<LoadBF16AVX2, BF16ToF32>(pv1, pv2, dim); }
+export f32 BF16CosAVX2(const u16 *pv1, const u16 *pv2, SizeT dim) { return HalfCosAVX2<LoadBF16AVX2, BF16ToF32>(pv1, pv2, dim); }
+
+#endif
+
+} // namespace infinity
@@ -191,4 +191,34 @@ export inline int popcount_sse2(const __m128i x) {
 }
 #endif // defined (__SSE2__)
 
+// Bit i is set when 0 < ts[i] <= check_ts, for 64 timestamps.
+// 0 wraps to the max value after the decrement, so a single unsigned compare checks both bounds.
+export inline u64 TimestampsNotAfter64(const u64 *ts, const u64 check_ts) {
+    u64 mask = 0;
+#if defined(__AVX512F__)
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i bound = _mm512_set1_epi64(check_ts);
+    for (u32 i = 0; i < 64; i += 8) {
+        const __m512i v = _mm512_sub_epi64(_mm512_loadu_si512(ts + i), one);
+        mask |= static_cast<u64>(_mm512_cmplt_epu64_mask(v, bound)) << i;
+    }
+#elif defined(__AVX2__)
+    // AVX2 only compares signed integers, flipping the sign bit maps the unsigned order onto it
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<i64>::min());
+    const __m256i bound = _mm256_xor_si256(_mm256_set1_epi64x(check_ts), sign);
+    for (u32 i = 0; i < 64; i += 4) {
+        __m256i v = _mm256_sub_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ts + i)), one);
+        v = _mm256_xor_si256(v, sign);
+        const __m256i lt = _mm256_cmpgt_epi64(bound, v);
+        mask |= static_cast<u64>(_mm256_movemask_pd(_mm256_castsi256_pd(lt))) << i;
+    }
+#else
+    for (u32 i = 0; i < 64; ++i) {
+        mask |= static_cast<u64>(ts[i] - 1 < check_ts) << i;
+    }
+#endif
+    return mask;
+}
+
 } // namespace infinity
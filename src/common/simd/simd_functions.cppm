@@ -57,6 +57,16 @@ export struct SIMD_FUNCTIONS {
     U8DistanceFuncType HNSW_U8IP_64_ptr_ = Get_HNSW_U8IP_64_ptr();
     U8CosDistanceFuncType HNSW_U8Cos_ptr_ = Get_HNSW_U8Cos_ptr();
 
+    // HNSW F16
+    HalfDistanceFuncType HNSW_F16L2_ptr_ = Get_HNSW_F16L2_ptr();
+    HalfDistanceFuncType HNSW_F16IP_ptr_ = Get_HNSW_F16IP_ptr();
+    HalfDistanceFuncType HNSW_F16Cos_ptr_ = Get_HNSW_F16Cos_ptr();
+
+    // HNSW BF16
+    HalfDistanceFuncType HNSW_BF16L2_ptr_ = Get_HNSW_BF16L2_ptr();
+    HalfDistanceFuncType HNSW_BF16IP_ptr_ = Get_HNSW_BF16IP_ptr();
+    HalfDistanceFuncType HNSW_BF16Cos_ptr_ = Get_HNSW_BF16Cos_ptr();
+
     // MaxSim IP
     MaxSimF32BitIPFuncType MaxSimF32BitIP_func_ptr_ = GetMaxSimF32BitIPFuncPtr();
     MaxSimI32BitIPFuncType MaxSimI32BitIP_func_ptr_ = GetMaxSimI32BitIPFuncPtr();
@@ -22,6 +22,7 @@ import maxsim_simd_funcs;
 import emvb_simd_funcs;
 import search_top_1_sgemm;
 import batch_bm25_simd_funcs;
+import half_simd_funcs;
 
 namespace infinity {
 
@@ -533,6 +534,100 @@ U8CosDistanceFuncType Get_HNSW_U8Cos_ptr() {
     return &U8CosBF;
 }
 
+HalfDistanceFuncType Get_HNSW_F16L2_ptr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F16L2AVX512;
+    }
+#endif
+#if defined(__AVX2__) && defined(__F16C__)
+    if (IsAVX2Supported() && IsF16CSupported()) {
+        return &F16L2F16C;
+    }
+#endif
+    return &F16L2BF;
+}
+
+HalfDistanceFuncType Get_HNSW_F16IP_ptr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F16IPAVX512;
+    }
+#endif
+#if defined(__AVX2__) && defined(__F16C__)
+    if (IsAVX2Supported() && IsF16CSupported()) {
+        return &F16IPF16C;
+    }
+#endif
+    return &F16IPBF;
+}
+
+HalfDistanceFuncType Get_HNSW_F16Cos_ptr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F16CosAVX512;
+    }
+#endif
+#if defined(__AVX2__) && defined(__F16C__)
+    if (IsAVX2Supported() && IsF16CSupported()) {
+        return &F16CosF16C;
+    }
+#endif
+    return &F16CosBF;
+}
+
+HalfDistanceFuncType Get_HNSW_BF16L2_ptr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &BF16L2AVX512;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &BF16L2AVX2;
+    }
+#endif
+    return &BF16L2BF;
+}
+
+HalfDistanceFuncType Get_HNSW_BF16IP_ptr() {
+#if defined(__AVX512BF16__)
+    if (IsAVX512BF16Supported()) {
+        return &BF16IPAVX512BF16;
+    }
+#endif
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &BF16IPAVX512;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &BF16IPAVX2;
+    }
+#endif
+    return &BF16IPBF;
+}
+
+HalfDistanceFuncType Get_HNSW_BF16Cos_ptr() {
+#if defined(__AVX512BF16__)
+    if (IsAVX512BF16Supported()) {
+        return &BF16CosAVX512BF16;
+    }
+#endif
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &BF16CosAVX512;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &BF16CosAVX2;
+    }
+#endif
+    return &BF16CosBF;
+}
+
 MaxSimF32BitIPFuncType GetMaxSimF32BitIPFuncPtr() {
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
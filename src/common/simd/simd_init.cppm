@@ -26,6 +26,7 @@ export using infinity::IsSSE2Supported;
 export using infinity::IsAVX2Supported;
 export using infinity::IsAVX512Supported;
 export using infinity::IsAVX512BWSupported;
+export using infinity::IsAVX512BF16Supported;
 
 export using F32DistanceFuncType = f32 (*)(const f32 *, const f32 *, SizeT);
 export using I8DistanceFuncType = i32 (*)(const i8 *, const i8 *, SizeT);
@@ -34,6 +35,8 @@ export using U8DistanceFuncType = i32 (*)(const u8 *, const u8 *, SizeT);
 // dimension in hamming distance is in bytes
 export using U8HammingDistanceFuncType = f32 (*)(const u8 *, const u8 *, SizeT);
 export using U8CosDistanceFuncType = f32 (*)(const u8 *, const u8 *, SizeT);
+// float16 and bfloat16 elements are passed as raw u16 bits
+export using HalfDistanceFuncType = f32 (*)(const u16 *, const u16 *, SizeT);
 export using MaxSimF32BitIPFuncType = f32 (*)(const f32 *, const u8 *, SizeT);
 export using MaxSimI32BitIPFuncType = i32 (*)(const i32 *, const u8 *, SizeT);
 export using MaxSimI64BitIPFuncType = i64 (*)(const i64 *, const u8 *, SizeT);
@@ -76,6 +79,14 @@ export U8DistanceFuncType Get_HNSW_U8IP_16_ptr();
 export U8DistanceFuncType Get_HNSW_U8IP_32_ptr();
 export U8DistanceFuncType Get_HNSW_U8IP_64_ptr();
 export U8CosDistanceFuncType Get_HNSW_U8Cos_ptr();
+// HNSW F16
+export HalfDistanceFuncType Get_HNSW_F16L2_ptr();
+export HalfDistanceFuncType Get_HNSW_F16IP_ptr();
+export HalfDistanceFuncType Get_HNSW_F16Cos_ptr();
+// HNSW BF16
+export HalfDistanceFuncType Get_HNSW_BF16L2_ptr();
+export HalfDistanceFuncType Get_HNSW_BF16IP_ptr();
+export HalfDistanceFuncType Get_HNSW_BF16Cos_ptr();
 // MaxSim IP
 export MaxSimF32BitIPFuncType GetMaxSimF32BitIPFuncPtr();
 export MaxSimI32BitIPFuncType GetMaxSimI32BitIPFuncPtr();
@@ -23,5 +23,6 @@ bool IsSSE2Supported();
 bool IsAVX2Supported();
 bool IsAVX512Supported();
 bool IsAVX512BWSupported();
+bool IsAVX512BF16Supported();
 
 } // namespace infinity
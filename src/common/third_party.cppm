@@ -179,6 +179,7 @@ export using ondemand::parser;
 export using ondemand::document;
 export using ondemand::object;
 export using ondemand::value;
+export using ondemand::array;
 }
 
 namespace magic_enum {
@@ -14,6 +14,8 @@
 
 module;
 
+#include <bit>
+
 import stl;
 
 export module smallfloat;
@@ -128,5 +130,52 @@ public:
         bits += (127 - 2) << 23;
         return IntBitsToFloat(bits);
     }
+
+    //
+    // Lossy encoding of non-negative integers (e.g. document lengths) into a single byte.
+    // Values below NUM_FREE_VALUES are exact, larger values keep their 4 most significant bits.
+    //
+
+    // Encode with 4 significant bits: the 3 low bits hold the mantissa, the high bits the shift.
+    static u32 LongToInt4(u64 i) {
+        const int num_bits = 64 - std::countl_zero(i);
+        if (num_bits < 4) {
+            return static_cast<u32>(i);
+        }
+        const int shift = num_bits - 4;
+        u32 encoded = static_cast<u32>(i >> shift) & 0x07; // the most significant bit is implicit
+        encoded |= (shift + 1) << 3;                        // +1 to distinguish from values below 8
+        return encoded;
+    }
+
+    static u64 Int4ToLong(u32 i) {
+        const u64 bits = i & 0x07;
+        const int shift = static_cast<int>(i >> 3) - 1;
+        return shift == -1 ? bits : (bits | 0x08) << shift;
+    }
+
+    static constexpr u32 MAX_INT4 = 231; // LongToInt4(i32 max)
+    static constexpr u32 NUM_FREE_VALUES = 255 - MAX_INT4;
+
+    // Values are rounded up to the nearest representable value, so that a decoded length never underestimates the
+    // original one. Values above the largest representable value are clamped.
+    static u8 IntToByte4(u32 i) {
+        if (i < NUM_FREE_VALUES) {
+            return static_cast<u8>(i);
+        }
+        i = std::min(i, static_cast<u32>(std::numeric_limits<i32>::max()));
+        u32 encoded = NUM_FREE_VALUES + LongToInt4(i - NUM_FREE_VALUES);
+        if (encoded < 255 && Byte4ToInt(static_cast<u8>(encoded)) < i) {
+            ++encoded;
+        }
+        return static_cast<u8>(encoded);
+    }
+
+    static u32 Byte4ToInt(u8 b) {
+        if (b < NUM_FREE_VALUES) {
+            return b;
+        }
+        return static_cast<u32>(NUM_FREE_VALUES + Int4ToLong(b - NUM_FREE_VALUES));
+    }
 };
 } // namespace infinity
@@ -14,6 +14,9 @@
 
 module;
 
+#include <cctype>
+#include <filesystem>
+#include <string>
 #include <thread>
 #ifdef __APPLE__
 #include <mach/mach_init.h>
@@ -97,4 +100,24 @@ bool ThreadUtil::pin(Thread &thread, const u16 cpu_id) {
 #endif
 }
 
+i64 ThreadUtil::NumaNode(const u16 cpu_id) {
+#if defined(__APPLE__)
+    return 0;
+#else
+    // Linux exposes the node of a cpu as a nodeN entry in the cpu directory.
+    std::error_code ec;
+    std::filesystem::directory_iterator iter("/sys/devices/system/cpu/cpu" + std::to_string(cpu_id), ec);
+    if (ec) {
+        return 0;
+    }
+    for (const auto &entry : iter) {
+        String name = entry.path().filename().string();
+        if (name.size() > 4 && name.compare(0, 4, "node") == 0 && std::isdigit(static_cast<unsigned char>(name[4]))) {
+            return std::stol(name.substr(4));
+        }
+    }
+    return 0;
+#endif
+}
+
 } // namespace infinity
@@ -11,6 +11,9 @@ namespace infinity {
 export class ThreadUtil {
 public:
     static bool pin(Thread &thread, const u16 cpu_id);
+
+    // NUMA node of the cpu, 0 if unknown.
+    static i64 NumaNode(const u16 cpu_id);
 };
 
 } // namespace infinity
\ No newline at end of file
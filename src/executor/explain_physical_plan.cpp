@@ -25,6 +25,7 @@ import physical_union_all;
 import physical_index_scan;
 import physical_dummy_scan;
 import physical_hash_join;
+import join_reference;
 import physical_sort_merge_join;
 import physical_index_join;
 import physical_top;
@@ -268,6 +269,7 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
             break;
         }
         case PhysicalOperatorType::kHash: {
+            Explain((PhysicalHash *)op, result, intent_size);
             break;
         }
         case PhysicalOperatorType::kMergeHash: {
@@ -1919,9 +1921,52 @@ void ExplainPhysicalPlan::Explain(const PhysicalDummyScan *, SharedPtr<Vector<Sh
     RecoverableError(status);
 }
 
-void ExplainPhysicalPlan::Explain(const PhysicalHashJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
-    Status status = Status::NotSupport("Not implemented");
-    RecoverableError(status);
+void ExplainPhysicalPlan::Explain(const PhysicalHashJoin *join_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    String join_header;
+    if (intent_size != 0) {
+        join_header = String(intent_size - 2, ' ') + "-> HASH JOIN ";
+    } else {
+        join_header = "HASH JOIN ";
+    }
+
+    join_header += "(" + std::to_string(join_node->node_id()) + ")";
+    result->emplace_back(MakeShared<String>(join_header));
+
+    // Join type
+    {
+        String join_type_str = String(intent_size, ' ') + " - type: " + JoinReference::ToString(join_node->join_type());
+        result->emplace_back(MakeShared<String>(join_type_str));
+    }
+
+    // Conditions
+    {
+        String condition_str = String(intent_size, ' ') + " - filters: [";
+
+        SizeT conditions_count = join_node->conditions().size();
+        if (conditions_count == 0) {
+            String error_message = "JOIN without any condition.";
+            UnrecoverableError(error_message);
+        }
+
+        for (SizeT idx = 0; idx < conditions_count - 1; ++idx) {
+            ExplainLogicalPlan::Explain(join_node->conditions()[idx].get(), condition_str);
+            condition_str += ", ";
+        }
+        ExplainLogicalPlan::Explain(join_node->conditions().back().get(), condition_str);
+        result->emplace_back(MakeShared<String>(condition_str));
+    }
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ') + " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = join_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx) + ", ";
+        }
+        output_columns_str += output_columns->back() + "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalSortMergeJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
@@ -2330,6 +2375,18 @@ void ExplainPhysicalPlan::Explain(const PhysicalHash *hash_node, SharedPtr<Vecto
     }
     explain_header_str += "(" + std::to_string(hash_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Build keys
+    SizeT key_count = hash_node->build_keys().size();
+    if (key_count > 0) {
+        String keys_str = String(intent_size, ' ') + " - keys: [";
+        for (SizeT idx = 0; idx < key_count - 1; ++idx) {
+            ExplainLogicalPlan::Explain(hash_node->build_keys()[idx].get(), keys_str);
+            keys_str += ", ";
+        }
+        ExplainLogicalPlan::Explain(hash_node->build_keys().back().get(), keys_str);
+        result->emplace_back(MakeShared<String>(keys_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalMergeHash *merge_hash_node,
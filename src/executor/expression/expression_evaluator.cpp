@@ -14,6 +14,8 @@
 
 module;
 
+#include <cstring>
+
 module expression_evaluator;
 
 import stl;
@@ -40,6 +42,9 @@ import logical_type;
 import internal_types;
 import roaring_bitmap;
 import block_index;
+import selection;
+import expression_selector;
+import defer_op;
 
 namespace infinity {
 
@@ -139,9 +144,206 @@ void ExpressionEvaluator::Execute(const SharedPtr<CastExpression> &expr,
     expr->func_.function(child_output, output_column_vector, child_output->Size(), cast_parameters);
 }
 
-void ExpressionEvaluator::Execute(const SharedPtr<CaseExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
-    String error_message = "Case execution";
-    UnrecoverableError(error_message);
+namespace {
+
+// Row idx of a CASE branch result goes to row rows[idx] of the CASE output
+template <SizeT WIDTH>
+void ScatterFixedWidth(const ColumnVector &source, ColumnVector &target, const Selection &rows) {
+    const char *src = source.data();
+    char *dst = target.data();
+    const SizeT count = rows.Size();
+    if (source.vector_type() == ColumnVectorType::kConstant) {
+        for (SizeT idx = 0; idx < count; ++idx) {
+            std::memcpy(dst + rows[idx] * WIDTH, src, WIDTH);
+        }
+        return;
+    }
+    for (SizeT idx = 0; idx < count; ++idx) {
+        std::memcpy(dst + rows[idx] * WIDTH, src + idx * WIDTH, WIDTH);
+    }
+}
+
+void ScatterFixedWidth(const ColumnVector &source, ColumnVector &target, const Selection &rows, SizeT width) {
+    const char *src = source.data();
+    char *dst = target.data();
+    const SizeT count = rows.Size();
+    const SizeT src_step = source.vector_type() == ColumnVectorType::kConstant ? 0 : width;
+    for (SizeT idx = 0; idx < count; ++idx) {
+        std::memcpy(dst + rows[idx] * width, src + idx * src_step, width);
+    }
+}
+
+void ScatterCaseBranch(const ColumnVector &source, ColumnVector &target, const Selection &rows) {
+    const SizeT count = rows.Size();
+    const bool constant_source = source.vector_type() == ColumnVectorType::kConstant;
+    switch (target.data_type()->type()) {
+        case LogicalType::kBoolean: {
+            for (SizeT idx = 0; idx < count; ++idx) {
+                target.buffer_->SetCompactBit(rows[idx], source.buffer_->GetCompactBit(constant_source ? 0 : idx));
+            }
+            break;
+        }
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kHugeInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kFloat16:
+        case LogicalType::kBFloat16:
+        case LogicalType::kDecimal:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kInterval:
+        case LogicalType::kPoint:
+        case LogicalType::kLine:
+        case LogicalType::kLineSeg:
+        case LogicalType::kBox:
+        case LogicalType::kCircle:
+        case LogicalType::kUuid:
+        case LogicalType::kRowID:
+        case LogicalType::kEmbedding: {
+            switch (const SizeT width = target.data_type()->Size(); width) {
+                case 1: {
+                    ScatterFixedWidth<1>(source, target, rows);
+                    break;
+                }
+                case 2: {
+                    ScatterFixedWidth<2>(source, target, rows);
+                    break;
+                }
+                case 4: {
+                    ScatterFixedWidth<4>(source, target, rows);
+                    break;
+                }
+                case 8: {
+                    ScatterFixedWidth<8>(source, target, rows);
+                    break;
+                }
+                case 16: {
+                    ScatterFixedWidth<16>(source, target, rows);
+                    break;
+                }
+                default: {
+                    ScatterFixedWidth(source, target, rows, width);
+                    break;
+                }
+            }
+            break;
+        }
+        default: {
+            // types keeping their payload in the vector heap
+            for (SizeT idx = 0; idx < count; ++idx) {
+                target.CopyRow(source, rows[idx], idx);
+            }
+            break;
+        }
+    }
+
+    if (!source.nulls_ptr_->IsAllTrue()) {
+        for (SizeT idx = 0; idx < count; ++idx) {
+            if (!source.nulls_ptr_->IsTrue(constant_source ? 0 : idx)) {
+                target.nulls_ptr_->SetFalse(rows[idx]);
+            }
+        }
+    }
+}
+
+// rows[select[idx]] for every selected row
+SharedPtr<Selection> GatherRows(const Selection &rows, const Selection &select) {
+    auto result = MakeShared<Selection>();
+    result->Initialize(select.Size());
+    for (SizeT idx = 0; idx < select.Size(); ++idx) {
+        result->Append(rows[select[idx]]);
+    }
+    return result;
+}
+
+} // namespace
+
+void ExpressionEvaluator::Execute(const SharedPtr<CaseExpression> &expr,
+                                  SharedPtr<ExpressionState> &state,
+                                  SharedPtr<ColumnVector> &output_column_vector) {
+    // A CASE over constants has one row and never needs to split its input.
+    const bool constant_output = output_column_vector->vector_type() == ColumnVectorType::kConstant;
+    if (!constant_output && input_data_block_ == nullptr) {
+        String error_message = "Input data block is NULL";
+        UnrecoverableError(error_message);
+    }
+    const SizeT row_count = constant_output ? 1 : input_data_block_->row_count();
+
+    if (output_column_vector->Size() > 0) {
+        // drop the heap data of the previous block
+        ColumnVectorType vector_type = output_column_vector->vector_type();
+        SizeT capacity = output_column_vector->capacity();
+        output_column_vector->Reset();
+        output_column_vector->Initialize(vector_type, capacity);
+        output_column_vector->nulls_ptr_->SetAllTrue();
+    }
+    output_column_vector->Finalize(row_count);
+
+    // The branches are evaluated on the rows they take only, the evaluator input is switched to those rows meanwhile.
+    const DataBlock *input_data_block = input_data_block_;
+    DeferFn restore_input([&] { input_data_block_ = input_data_block; });
+
+    Vector<SharedPtr<ExpressionState>> &children = state->Children();
+    auto take_rows = [&](const SharedPtr<BaseExpression> &branch_expr, SizeT child_idx, const DataBlock *branch_input, const Selection &rows) {
+        if (branch_expr->Type().type() == LogicalType::kNull) {
+            for (SizeT idx = 0; idx < rows.Size(); ++idx) {
+                output_column_vector->nulls_ptr_->SetFalse(rows[idx]);
+            }
+            return;
+        }
+        input_data_block_ = branch_input;
+        SharedPtr<ExpressionState> &branch_state = children[child_idx];
+        SharedPtr<ColumnVector> &branch_output = branch_state->OutputColumnVector();
+        Execute(branch_expr, branch_state, branch_output);
+        ScatterCaseBranch(*branch_output, *output_column_vector, rows);
+    };
+
+    // remaining_rows[idx] is the output row of row idx of current_block, no branch has taken these rows yet
+    SharedPtr<Selection> remaining_rows = MakeShared<Selection>();
+    remaining_rows->Initialize(row_count);
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        remaining_rows->Append(idx);
+    }
+    const DataBlock *current_block = input_data_block;
+    SharedPtr<DataBlock> remaining_block{};
+
+    ExpressionSelector selector;
+    Vector<CaseCheck> &case_checks = expr->CaseExpr();
+    for (SizeT check_idx = 0; check_idx < case_checks.size(); ++check_idx) {
+        const SizeT remaining_count = remaining_rows->Size();
+        if (remaining_count == 0) {
+            return;
+        }
+        SharedPtr<Selection> true_select{};
+        SharedPtr<Selection> false_select{};
+        selector.Select(case_checks[check_idx].when_expr_, children[2 * check_idx], current_block, remaining_count, true_select, false_select);
+
+        const SizeT true_count = true_select->Size();
+        if (true_count == remaining_count) {
+            take_rows(case_checks[check_idx].then_expr_, 2 * check_idx + 1, current_block, *remaining_rows);
+            return;
+        }
+        if (true_count > 0) {
+            auto then_block = MakeShared<DataBlock>();
+            then_block->Init(current_block, true_select);
+            take_rows(case_checks[check_idx].then_expr_, 2 * check_idx + 1, then_block.get(), *GatherRows(*remaining_rows, *true_select));
+
+            auto next_block = MakeShared<DataBlock>();
+            next_block->Init(current_block, false_select);
+            remaining_rows = GatherRows(*remaining_rows, *false_select);
+            remaining_block = std::move(next_block);
+            current_block = remaining_block.get();
+        }
+    }
+    if (remaining_rows->Size() > 0) {
+        take_rows(expr->ElseExpr(), children.size() - 1, current_block, *remaining_rows);
+    }
 }
 
 void ExpressionEvaluator::Execute(const SharedPtr<ColumnExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
@@ -199,6 +401,79 @@ void ExpressionEvaluator::Execute(const SharedPtr<ReferenceExpression> &expr,
     output_column_vector = input_data_block_->column_vectors[column_index];
 }
 
+namespace {
+
+template <typename T>
+bool MatchInFlat(const InExpression &expr, const ColumnVector &input, SizeT count, u8 *result) {
+    const auto *raw_set = expr.GetRawSet<InRawSet<T>>();
+    if (raw_set == nullptr) {
+        return false;
+    }
+    raw_set->Match(reinterpret_cast<const T *>(input.data()), count, result);
+    return true;
+}
+
+// Write the IN result of rows [0, count) of `input` into the compact bits `result`, false when there is no typed kernel.
+bool MatchIn(const InExpression &expr, const ColumnVector &input, SizeT count, u8 *result) {
+    switch (input.data_type()->type()) {
+        case LogicalType::kBoolean: {
+            const auto *raw_set = expr.GetRawSet<InRawSet<BooleanT>>();
+            if (raw_set == nullptr || input.vector_type() != ColumnVectorType::kCompactBit) {
+                return false;
+            }
+            const u8 true_mask = raw_set->Contains(true) ? 0xFF : 0;
+            const u8 false_mask = raw_set->Contains(false) ? 0xFF : 0;
+            const auto *bits = reinterpret_cast<const u8 *>(input.data());
+            for (SizeT byte_idx = 0; byte_idx * 8 < count; ++byte_idx) {
+                result[byte_idx] = (bits[byte_idx] & true_mask) | (~bits[byte_idx] & false_mask);
+            }
+            return true;
+        }
+        default: {
+            break;
+        }
+    }
+    if (input.vector_type() != ColumnVectorType::kFlat) {
+        return false;
+    }
+    switch (input.data_type()->type()) {
+        case LogicalType::kTinyInt: {
+            return MatchInFlat<TinyIntT>(expr, input, count, result);
+        }
+        case LogicalType::kSmallInt: {
+            return MatchInFlat<SmallIntT>(expr, input, count, result);
+        }
+        case LogicalType::kInteger: {
+            return MatchInFlat<IntegerT>(expr, input, count, result);
+        }
+        case LogicalType::kBigInt: {
+            return MatchInFlat<BigIntT>(expr, input, count, result);
+        }
+        case LogicalType::kFloat: {
+            return MatchInFlat<FloatT>(expr, input, count, result);
+        }
+        case LogicalType::kDouble: {
+            return MatchInFlat<DoubleT>(expr, input, count, result);
+        }
+        case LogicalType::kVarchar: {
+            const auto *string_set = expr.GetRawSet<InStringSet>();
+            if (string_set == nullptr) {
+                return false;
+            }
+            InMatchRows(count, result, [&](SizeT idx) {
+                Span<const char> varchar = input.GetVarchar(idx);
+                return string_set->Contains(std::string_view(varchar.data(), varchar.size()));
+            });
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
 void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &expr,
                                   SharedPtr<ExpressionState> &state,
                                   SharedPtr<ColumnVector> &output_column_vector) {
@@ -207,30 +482,35 @@ void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &expr,
     SharedPtr<ColumnVector> &left_state_output = left_state->OutputColumnVector();
     Execute(left_expression, left_state, left_state_output);
 
+    const SizeT row_count = input_data_block_->row_count();
     // in expression evaluates to a constant
     if (left_state->OutputColumnVector()->vector_type() == ColumnVectorType::kConstant) {
         bool in_result =
             (expr->in_type() == InType::kIn) ? expr->Exists(left_state_output->GetValue(0)) : !expr->Exists(left_state_output->GetValue(0));
-        for (SizeT idx = 0; idx < input_data_block_->row_count(); idx++) {
+        for (SizeT idx = 0; idx < row_count; idx++) {
             output_column_vector->buffer_->SetCompactBit(idx, in_result);
         }
-        output_column_vector->Finalize(input_data_block_->row_count());
+        output_column_vector->Finalize(row_count);
         return;
     }
-    if (expr->in_type() == InType::kIn) {
-        for (SizeT idx = 0; idx < input_data_block_->row_count(); idx++) {
-            output_column_vector->buffer_->SetCompactBit(idx, expr->Exists(left_state_output->GetValue(idx)));
-        }
-        output_column_vector->Finalize(input_data_block_->row_count());
+    if (expr->in_type() != InType::kIn && expr->in_type() != InType::kNotIn) {
         return;
     }
-    if (expr->in_type() == InType::kNotIn) {
-        for (SizeT idx = 0; idx < input_data_block_->row_count(); idx++) {
-            output_column_vector->buffer_->SetCompactBit(idx, !expr->Exists(left_state_output->GetValue(idx)));
+    const bool negate = expr->in_type() == InType::kNotIn;
+    auto *result = reinterpret_cast<u8 *>(output_column_vector->buffer_->GetDataMut());
+    if (MatchIn(*expr, *left_state_output, row_count, result)) {
+        if (negate) {
+            for (SizeT byte_idx = 0; byte_idx * 8 < row_count; ++byte_idx) {
+                result[byte_idx] = ~result[byte_idx];
+            }
         }
-        output_column_vector->Finalize(input_data_block_->row_count());
+        output_column_vector->Finalize(row_count);
         return;
     }
+    for (SizeT idx = 0; idx < row_count; idx++) {
+        output_column_vector->buffer_->SetCompactBit(idx, expr->Exists(left_state_output->GetValue(idx)) != negate);
+    }
+    output_column_vector->Finalize(row_count);
 }
 
 void ExpressionEvaluator::Execute(const SharedPtr<FilterFulltextExpression> &expr,
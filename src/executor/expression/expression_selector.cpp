@@ -14,6 +14,8 @@
 
 module;
 
+#include <bit>
+
 module expression_selector;
 
 import stl;
@@ -73,6 +75,56 @@ void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     Select(expr, state, count, output_true_select);
 }
 
+void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
+                                SharedPtr<ExpressionState> &state,
+                                const DataBlock *input_data_block,
+                                SizeT count,
+                                SharedPtr<Selection> &output_true_select,
+                                SharedPtr<Selection> &output_false_select) {
+    this->input_data_ = input_data_block;
+    output_true_select = MakeShared<Selection>();
+    output_true_select->Initialize(count);
+    output_false_select = MakeShared<Selection>();
+    output_false_select->Initialize(count);
+    if (count == 0) {
+        return;
+    }
+    if (expr->Type().type() != LogicalType::kBoolean) {
+        String error_message = "Attempting to select non-boolean expression";
+        UnrecoverableError(error_message);
+    }
+
+    SharedPtr<ColumnVector> bool_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
+    bool_column->Initialize(ColumnVectorType::kCompactBit);
+    ExpressionEvaluator expr_evaluator;
+    expr_evaluator.Init(input_data_);
+    expr_evaluator.Execute(expr, state, bool_column);
+
+    if (bool_column->Size() < count) {
+        // constant condition, its only row decides for all rows
+        SharedPtr<Selection> true_row = MakeShared<Selection>();
+        true_row->Initialize(1);
+        Select(bool_column, 1, true_row, true);
+        SharedPtr<Selection> &target = true_row->Size() == 1 ? output_true_select : output_false_select;
+        for (SizeT idx = 0; idx < count; ++idx) {
+            target->Append(idx);
+        }
+        return;
+    }
+
+    Select(bool_column, count, output_true_select, true);
+    // the false rows are the complement of the ascending true rows
+    const SizeT true_count = output_true_select->Size();
+    SizeT true_idx = 0;
+    for (SizeT idx = 0; idx < count; ++idx) {
+        if (true_idx < true_count && (*output_true_select)[true_idx] == idx) {
+            ++true_idx;
+        } else {
+            output_false_select->Append(idx);
+        }
+    }
+}
+
 void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
@@ -93,23 +145,31 @@ void ExpressionSelector::Select(const SharedPtr<ColumnVector> &bool_column, Size
     }
     const auto &boolean_buffer = *(bool_column->buffer_);
     const auto &null_mask = bool_column->nulls_ptr_;
-    if (nullable) {
-        null_mask->RoaringBitmapApplyFunc([&](const u32 idx) -> bool {
-            if (idx >= count) [[unlikely]] {
-                return false;
-            }
-            if (boolean_buffer.GetCompactBit(idx)) {
-                output_true_select->Append(idx);
-            }
-            return idx + 1 < count;
-        });
-    } else {
-        for (SizeT idx = 0; idx < count; ++idx) {
-            if (boolean_buffer.GetCompactBit(idx)) {
+    if (!nullable || null_mask->IsAllTrue()) {
+        // scan the compact bits a byte at a time, all false bytes are skipped
+        const auto *bits = reinterpret_cast<const u8 *>(boolean_buffer.GetData());
+        for (SizeT byte_idx = 0; byte_idx * 8 < count; ++byte_idx) {
+            u32 byte = bits[byte_idx];
+            while (byte != 0) {
+                SizeT idx = byte_idx * 8 + std::countr_zero(byte);
+                if (idx >= count) {
+                    break;
+                }
                 output_true_select->Append(idx);
+                byte &= byte - 1;
             }
         }
+        return;
     }
+    null_mask->RoaringBitmapApplyFunc([&](const u32 idx) -> bool {
+        if (idx >= count) [[unlikely]] {
+            return false;
+        }
+        if (boolean_buffer.GetCompactBit(idx)) {
+            output_true_select->Append(idx);
+        }
+        return idx + 1 < count;
+    });
 }
 
 } // namespace infinity
\ No newline at end of file
@@ -42,6 +42,14 @@ public:
 
     void Select(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SizeT count, SharedPtr<Selection> &output_true_select);
 
+    // Split the rows of the input block by a boolean expression, NULL counts as false
+    void Select(const SharedPtr<BaseExpression> &expr,
+                SharedPtr<ExpressionState> &state,
+                const DataBlock *input_data_block,
+                SizeT count,
+                SharedPtr<Selection> &output_true_select,
+                SharedPtr<Selection> &output_false_select);
+
     static void Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable);
 
 private:
@@ -98,20 +98,25 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<CaseExpr
 
     SharedPtr<ExpressionState> result = MakeShared<ExpressionState>();
 
-    Vector<CaseCheck> &case_checks = case_expr->CaseExpr();
-    for (auto &case_check : case_checks) {
-        result->AddChild(case_check.when_expr_);
-        result->AddChild(case_check.then_expr_);
-    }
-    result->AddChild(case_expr->ElseExpr());
-
     ColumnVectorType result_column_vector_type = ColumnVectorType::kConstant;
-    for (SizeT idx = 0; idx < result->Children().size(); ++idx) {
-        if (result->Children()[idx]->OutputColumnVector()->vector_type() != ColumnVectorType::kConstant) {
+    auto add_child = [&](const SharedPtr<BaseExpression> &child_expr) {
+        if (child_expr->Type().type() == LogicalType::kNull) {
+            // A NULL branch has no output column, the evaluator only sets the null bits of its rows.
+            result->children_.emplace_back(MakeShared<ExpressionState>());
+            return;
+        }
+        result->AddChild(child_expr);
+        if (auto &column_ptr = result->children_.back()->OutputColumnVector(); !column_ptr || column_ptr->vector_type() != ColumnVectorType::kConstant) {
             result_column_vector_type = ColumnVectorType::kFlat;
-            break;
         }
+    };
+
+    Vector<CaseCheck> &case_checks = case_expr->CaseExpr();
+    for (auto &case_check : case_checks) {
+        add_child(case_check.when_expr_);
+        add_child(case_check.then_expr_);
     }
+    add_child(case_expr->ElseExpr());
 
     result->column_vector_ = MakeShared<ColumnVector>(MakeShared<DataType>(case_expr->Type()));
     result->column_vector_->Initialize(result_column_vector_type, DEFAULT_VECTOR_SIZE);
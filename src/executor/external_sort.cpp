@@ -0,0 +1,665 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <limits>
+#include <type_traits>
+
+module external_sort;
+
+import stl;
+import column_vector;
+import data_block;
+import internal_types;
+import data_type;
+import logical_type;
+import select_statement;
+import local_file_handle;
+import virtual_store;
+import radix_sort;
+import loser_tree;
+import default_values;
+import status;
+import infinity_exception;
+import third_party;
+import logger;
+
+namespace infinity {
+
+namespace {
+
+inline SizeT RowIndex(const ColumnVector &column, SizeT row) { return column.vector_type() == ColumnVectorType::kConstant ? 0 : row; }
+
+template <typename U>
+inline void AppendBigEndian(Vector<char> &keys, U value) {
+    for (SizeT i = sizeof(U); i-- > 0;) {
+        keys.push_back(static_cast<char>(static_cast<u8>(value >> (i * 8))));
+    }
+}
+
+template <typename T>
+inline void AppendSigned(Vector<char> &keys, T value) {
+    using U = std::make_unsigned_t<T>;
+    AppendBigEndian<U>(keys, static_cast<U>(value) ^ (U(1) << (sizeof(U) * 8 - 1)));
+}
+
+template <typename T>
+inline T LoadValue(const ColumnVector &column, SizeT idx, SizeT offset = 0) {
+    T value{};
+    std::memcpy(&value, column.data() + idx * column.data_type_size_ + offset, sizeof(T));
+    return value;
+}
+
+inline void AppendVarchar(Vector<char> &keys, Span<const char> text) {
+    for (char c : text) {
+        keys.push_back(c);
+        if (c == 0) {
+            keys.push_back(static_cast<char>(0xFF));
+        }
+    }
+    keys.push_back(0);
+    keys.push_back(0);
+}
+
+inline int CompareKeys(const char *left, SizeT left_size, const char *right, SizeT right_size) {
+    int cmp = std::memcmp(left, right, std::min(left_size, right_size));
+    if (cmp != 0) {
+        return cmp;
+    }
+    return left_size < right_size ? -1 : (left_size > right_size ? 1 : 0);
+}
+
+inline u64 KeyPrefix(const char *key, SizeT key_size) {
+    u64 prefix = 0;
+    SizeT prefix_size = std::min<SizeT>(key_size, sizeof(u64));
+    for (SizeT i = 0; i < prefix_size; ++i) {
+        prefix |= u64(static_cast<u8>(key[i])) << (56 - i * 8);
+    }
+    return prefix;
+}
+
+struct SortEntry {
+    u64 prefix_{};
+    u32 key_offset_{};
+    u32 key_size_{};
+    u32 block_idx_{};
+    u32 row_idx_{};
+};
+
+struct SortEntryRadix {
+    u64 operator()(const SortEntry &entry) const { return entry.prefix_; }
+};
+
+struct SortEntryLess {
+    const char *keys_{};
+
+    bool operator()(const SortEntry &left, const SortEntry &right) const {
+        if (left.prefix_ != right.prefix_) {
+            return left.prefix_ < right.prefix_;
+        }
+        int cmp = CompareKeys(keys_ + left.key_offset_, left.key_size_, keys_ + right.key_offset_, right.key_size_);
+        if (cmp != 0) {
+            return cmp < 0;
+        }
+        // Keep the input order of equal rows.
+        return left.block_idx_ < right.block_idx_ || (left.block_idx_ == right.block_idx_ && left.row_idx_ < right.row_idx_);
+    }
+};
+
+struct SortMergeKey {
+    const char *data_{};
+    u32 size_{};
+};
+
+struct SortMergeKeyLess {
+    bool operator()(const SortMergeKey &left, const SortMergeKey &right) const {
+        return CompareKeys(left.data_, left.size_, right.data_, right.size_) < 0;
+    }
+};
+
+using SortMergeTree = LoserTree<SortMergeKey, SortMergeKeyLess>;
+
+void ReadExact(LocalFileHandle &file_handle, void *buffer, SizeT nbytes) {
+    auto [read_n, status] = file_handle.Read(buffer, nbytes);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    if (read_n != nbytes) {
+        String error_message = fmt::format("Sort spill file {} is truncated, expect {} bytes, read {}", file_handle.Path(), nbytes, read_n);
+        UnrecoverableError(error_message);
+    }
+}
+
+// Read the rows of one run in order, the pages of a spilled run are loaded one at a time.
+class SortRunReader {
+public:
+    explicit SortRunReader(SortRun &run) : run_(run) {
+        if (!run_.spill_path_.empty()) {
+            auto [file_handle, status] = VirtualStore::Open(run_.spill_path_, FileAccessMode::kRead);
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
+            file_handle_ = std::move(file_handle);
+        }
+        LoadPage();
+    }
+
+    [[nodiscard]] inline bool Valid() const { return page_.block_ != nullptr; }
+
+    [[nodiscard]] inline const DataBlock *block() const { return page_.block_.get(); }
+
+    [[nodiscard]] inline SizeT row() const { return row_; }
+
+    [[nodiscard]] inline bool LastRowOfPage() const { return row_ + 1 == page_.block_->row_count(); }
+
+    [[nodiscard]] inline SortMergeKey key() const {
+        u32 key_offset = page_.key_offsets_[row_];
+        return SortMergeKey{page_.keys_.data() + key_offset, page_.key_offsets_[row_ + 1] - key_offset};
+    }
+
+    // Move to the next row, return false when the run is exhausted.
+    bool Next() {
+        if (++row_ < page_.block_->row_count()) {
+            return true;
+        }
+        LoadPage();
+        return Valid();
+    }
+
+private:
+    void LoadPage() {
+        page_ = SortRunPage();
+        row_ = 0;
+        while (next_page_idx_ < run_.page_count_) {
+            SizeT page_idx = next_page_idx_++;
+            if (file_handle_.get() == nullptr) {
+                page_ = std::move(run_.pages_[page_idx]);
+            } else {
+                ReadPage();
+            }
+            if (page_.block_->row_count() > 0) {
+                return;
+            }
+        }
+        page_ = SortRunPage();
+    }
+
+    void ReadPage() {
+        u32 header[3];
+        ReadExact(*file_handle_, header, sizeof(header));
+        auto [row_count, key_bytes, block_bytes] = header;
+        page_.key_offsets_.resize(row_count + 1);
+        ReadExact(*file_handle_, page_.key_offsets_.data(), page_.key_offsets_.size() * sizeof(u32));
+        page_.keys_.resize(key_bytes);
+        ReadExact(*file_handle_, page_.keys_.data(), key_bytes);
+        Vector<char> block_buffer(block_bytes);
+        ReadExact(*file_handle_, block_buffer.data(), block_bytes);
+        const char *ptr = block_buffer.data();
+        SharedPtr<DataBlock> block = DataBlock::ReadAdv(ptr, block_bytes);
+        page_.block_ = DataBlock::MakeUniquePtr();
+        page_.block_->Init(block->column_vectors);
+        page_.block_->Finalize();
+    }
+
+private:
+    SortRun &run_;
+    UniquePtr<LocalFileHandle> file_handle_{};
+    SizeT next_page_idx_{};
+    SortRunPage page_{};
+    SizeT row_{};
+};
+
+// Copy rows to the output blocks, consecutive rows of the same input block are copied together. A block is handed to the output
+// vector once it is full, so the output of one merge can be taken out in several calls.
+class SortOutputWriter {
+public:
+    explicit SortOutputWriter(Vector<SharedPtr<DataType>> types) : types_(std::move(types)) {}
+
+    void Append(Vector<UniquePtr<DataBlock>> &output_blocks, const DataBlock *block, SizeT row) {
+        if (block == pending_block_ && row == pending_start_ + pending_count_ && pending_count_ < output_block_->available_capacity()) {
+            ++pending_count_;
+            return;
+        }
+        Flush();
+        if (output_block_.get() == nullptr || output_block_->available_capacity() == 0) {
+            NewOutputBlock(output_blocks);
+        }
+        pending_block_ = block;
+        pending_start_ = row;
+        pending_count_ = 1;
+    }
+
+    // Must be called before the pending input block is released.
+    void Flush() {
+        if (pending_count_ > 0) {
+            output_block_->AppendWith(pending_block_, pending_start_, pending_count_);
+        }
+        pending_block_ = nullptr;
+        pending_count_ = 0;
+    }
+
+    void Finish(Vector<UniquePtr<DataBlock>> &output_blocks) {
+        Flush();
+        if (output_block_.get() != nullptr) {
+            output_block_->Finalize();
+            output_blocks.push_back(std::move(output_block_));
+        }
+    }
+
+private:
+    void NewOutputBlock(Vector<UniquePtr<DataBlock>> &output_blocks) {
+        if (output_block_.get() != nullptr) {
+            output_block_->Finalize();
+            output_blocks.push_back(std::move(output_block_));
+        }
+        output_block_ = DataBlock::MakeUniquePtr();
+        output_block_->Init(types_);
+    }
+
+private:
+    Vector<SharedPtr<DataType>> types_{};
+    UniquePtr<DataBlock> output_block_{};
+
+    const DataBlock *pending_block_{};
+    SizeT pending_start_{};
+    SizeT pending_count_{};
+};
+
+Atomic<u64> sort_spill_file_id{0};
+
+} // namespace
+
+struct SortMergeState {
+    // Set when there is only one run in memory, its pages are already sorted.
+    bool single_run_{false};
+    SizeT next_page_idx_{};
+
+    Vector<UniquePtr<SortRunReader>> readers_{};
+    UniquePtr<SortMergeTree> loser_tree_{};
+    UniquePtr<SortOutputWriter> writer_{};
+};
+
+SortKeyEncoder::SortKeyEncoder(Vector<SharedPtr<DataType>> types, Vector<OrderType> order_types)
+    : types_(std::move(types)), order_types_(std::move(order_types)) {
+    if (types_.size() != order_types_.size()) {
+        String error_message = fmt::format("Sort key count mismatch: {} types, {} order types", types_.size(), order_types_.size());
+        UnrecoverableError(error_message);
+    }
+    for (const auto &data_type : types_) {
+        if (!SupportType(*data_type)) {
+            String error_message = fmt::format("Attempt to encode sort key of type: {}", data_type->ToString());
+            UnrecoverableError(error_message);
+        }
+    }
+}
+
+bool SortKeyEncoder::SupportType(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kVarchar:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kRowID: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void SortKeyEncoder::Encode(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<char> &keys, Vector<u32> &key_offsets) const {
+    SizeT column_count = types_.size();
+    if (columns.size() != column_count) {
+        String error_message = fmt::format("Expect {} sort key columns, but get {}", column_count, columns.size());
+        UnrecoverableError(error_message);
+    }
+    Vector<bool> all_valid(column_count);
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        all_valid[column_id] = columns[column_id]->nulls_ptr_->IsAllTrue();
+    }
+
+    for (SizeT row = 0; row < row_count; ++row) {
+        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+            const ColumnVector &column = *columns[column_id];
+            SizeT idx = RowIndex(column, row);
+            SizeT column_start = keys.size();
+            if (!all_valid[column_id] && !column.nulls_ptr_->IsTrue(idx)) {
+                keys.push_back(1);
+            } else {
+                keys.push_back(0);
+                switch (types_[column_id]->type()) {
+                    case LogicalType::kBoolean: {
+                        keys.push_back(column.buffer_->GetCompactBit(idx) ? 1 : 0);
+                        break;
+                    }
+                    case LogicalType::kTinyInt: {
+                        AppendSigned(keys, LoadValue<TinyIntT>(column, idx));
+                        break;
+                    }
+                    case LogicalType::kSmallInt: {
+                        AppendSigned(keys, LoadValue<SmallIntT>(column, idx));
+                        break;
+                    }
+                    case LogicalType::kInteger:
+                    case LogicalType::kDate:
+                    case LogicalType::kTime: {
+                        AppendSigned(keys, LoadValue<i32>(column, idx));
+                        break;
+                    }
+                    case LogicalType::kBigInt: {
+                        AppendSigned(keys, LoadValue<BigIntT>(column, idx));
+                        break;
+                    }
+                    case LogicalType::kDateTime:
+                    case LogicalType::kTimestamp: {
+                        // date then time
+                        AppendSigned(keys, LoadValue<i32>(column, idx, 0));
+                        AppendSigned(keys, LoadValue<i32>(column, idx, sizeof(i32)));
+                        break;
+                    }
+                    case LogicalType::kFloat: {
+                        FloatT value = LoadValue<FloatT>(column, idx);
+                        if (value == 0.0f) {
+                            value = 0.0f;
+                        }
+                        u32 bits{};
+                        std::memcpy(&bits, &value, sizeof(bits));
+                        bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+                        AppendBigEndian(keys, bits);
+                        break;
+                    }
+                    case LogicalType::kDouble: {
+                        DoubleT value = LoadValue<DoubleT>(column, idx);
+                        if (value == 0.0) {
+                            value = 0.0;
+                        }
+                        u64 bits{};
+                        std::memcpy(&bits, &value, sizeof(bits));
+                        bits = (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+                        AppendBigEndian(keys, bits);
+                        break;
+                    }
+                    case LogicalType::kVarchar: {
+                        AppendVarchar(keys, column.GetVarchar(idx));
+                        break;
+                    }
+                    case LogicalType::kRowID: {
+                        AppendBigEndian(keys, LoadValue<u64>(column, idx));
+                        break;
+                    }
+                    default: {
+                        String error_message = fmt::format("Attempt to encode sort key of type: {}", types_[column_id]->ToString());
+                        UnrecoverableError(error_message);
+                    }
+                }
+            }
+            if (order_types_[column_id] == OrderType::kDesc) {
+                for (SizeT pos = column_start; pos < keys.size(); ++pos) {
+                    keys[pos] = ~keys[pos];
+                }
+            }
+        }
+        key_offsets.push_back(keys.size());
+    }
+}
+
+SizeT SortRunPage::MemorySize() const { return block_->GetSizeInBytes() + keys_.size() + key_offsets_.size() * sizeof(u32); }
+
+ExternalSorter::ExternalSorter(Vector<SharedPtr<DataType>> key_types, Vector<OrderType> order_types, SizeT memory_limit, String spill_dir)
+    : encoder_(std::move(key_types), std::move(order_types)), memory_limit_(memory_limit), spill_dir_(std::move(spill_dir)) {}
+
+ExternalSorter::~ExternalSorter() {
+    // The readers hold the spill files open.
+    merge_state_.reset();
+    for (const auto &run : runs_) {
+        if (!run.spill_path_.empty()) {
+            VirtualStore::DeleteFile(run.spill_path_);
+        }
+    }
+}
+
+void ExternalSorter::AddRun(Vector<UniquePtr<DataBlock>> blocks, const Vector<Vector<SharedPtr<ColumnVector>>> &key_columns) {
+    if (merge_started_) {
+        String error_message = "Attempt to add a sort run after the merge started";
+        UnrecoverableError(error_message);
+    }
+    SizeT block_count = blocks.size();
+    if (key_columns.size() != block_count) {
+        String error_message = fmt::format("Expect sort keys of {} blocks, but get {}", block_count, key_columns.size());
+        UnrecoverableError(error_message);
+    }
+
+    // 1. Encode the keys of all rows.
+    Vector<char> keys;
+    Vector<u32> key_offsets{0};
+    Vector<SortEntry> entries;
+    for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
+        SizeT row_count = blocks[block_idx]->row_count();
+        SizeT first_key = key_offsets.size() - 1;
+        encoder_.Encode(key_columns[block_idx], row_count, keys, key_offsets);
+        for (SizeT row = 0; row < row_count; ++row) {
+            u32 key_offset = key_offsets[first_key + row];
+            u32 key_size = key_offsets[first_key + row + 1] - key_offset;
+            entries.push_back(SortEntry{KeyPrefix(keys.data() + key_offset, key_size), key_offset, key_size, u32(block_idx), u32(row)});
+        }
+    }
+    if (entries.empty()) {
+        return;
+    }
+
+    // 2. Radix sort on the first 8 bytes of the keys, the rest of the keys only break the ties.
+    ShiftBasedRadixSorter<SortEntry, SortEntryRadix, SortEntryLess, 56, true>::RadixSort(SortEntryRadix(),
+                                                                                         SortEntryLess{keys.data()},
+                                                                                         entries.data(),
+                                                                                         entries.size(),
+                                                                                         16);
+
+    // 3. Materialize the sorted rows, each page gets the keys of its rows in the sorted order.
+    SortRun run;
+    Vector<SharedPtr<DataType>> types = blocks[0]->types();
+    SizeT entry_count = entries.size();
+    for (SizeT page_start = 0; page_start < entry_count; page_start += DEFAULT_BLOCK_CAPACITY) {
+        SizeT page_end = std::min<SizeT>(page_start + DEFAULT_BLOCK_CAPACITY, entry_count);
+        SortRunPage &page = run.pages_.emplace_back();
+        page.block_ = DataBlock::MakeUniquePtr();
+        page.block_->Init(types);
+        page.key_offsets_.reserve(page_end - page_start + 1);
+        page.key_offsets_.push_back(0);
+        SizeT pos = page_start;
+        while (pos < page_end) {
+            const SortEntry &first = entries[pos];
+            SizeT count = 1;
+            while (pos + count < page_end && entries[pos + count].block_idx_ == first.block_idx_ &&
+                   entries[pos + count].row_idx_ == first.row_idx_ + count) {
+                ++count;
+            }
+            page.block_->AppendWith(blocks[first.block_idx_].get(), first.row_idx_, count);
+            for (SizeT i = pos; i < pos + count; ++i) {
+                page.keys_.insert(page.keys_.end(), keys.data() + entries[i].key_offset_, keys.data() + entries[i].key_offset_ + entries[i].key_size_);
+                page.key_offsets_.push_back(page.keys_.size());
+            }
+            pos += count;
+        }
+        page.block_->Finalize();
+        run.memory_size_ += page.MemorySize();
+    }
+    run.page_count_ = run.pages_.size();
+    blocks.clear();
+
+    memory_size_ += run.memory_size_;
+    runs_.push_back(std::move(run));
+
+    // 4. Spill the runs still in memory once the limit is exceeded.
+    if (memory_size_ > memory_limit_) {
+        for (auto &in_memory_run : runs_) {
+            if (in_memory_run.spill_path_.empty()) {
+                Spill(in_memory_run);
+            }
+        }
+    }
+}
+
+void ExternalSorter::Spill(SortRun &run) {
+    if (!VirtualStore::Exists(spill_dir_)) {
+        Status status = VirtualStore::MakeDirectory(spill_dir_);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+    }
+    String spill_path = fmt::format("{}/sort_{}.spill", spill_dir_, sort_spill_file_id.fetch_add(1));
+    auto [file_handle, status] = VirtualStore::Open(spill_path, FileAccessMode::kWrite);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    run.spill_path_ = spill_path;
+    for (const auto &page : run.pages_) {
+        WritePage(*file_handle, page);
+    }
+    LOG_TRACE(fmt::format("Spill sort run of {} pages, {} bytes to {}", run.page_count_, run.memory_size_, spill_path));
+
+    run.pages_.clear();
+    memory_size_ -= run.memory_size_;
+    run.memory_size_ = 0;
+    ++spilled_run_count_;
+}
+
+void ExternalSorter::WritePage(LocalFileHandle &file_handle, const SortRunPage &page) {
+    u32 row_count = page.block_->row_count();
+    u32 key_bytes = page.keys_.size();
+    u32 block_bytes = page.block_->GetSizeInBytes();
+    u32 header[3] = {row_count, key_bytes, block_bytes};
+
+    SizeT total_bytes = sizeof(header) + page.key_offsets_.size() * sizeof(u32) + key_bytes + block_bytes;
+    Vector<char> buffer(total_bytes);
+    char *ptr = buffer.data();
+    std::memcpy(ptr, header, sizeof(header));
+    ptr += sizeof(header);
+    std::memcpy(ptr, page.key_offsets_.data(), page.key_offsets_.size() * sizeof(u32));
+    ptr += page.key_offsets_.size() * sizeof(u32);
+    std::memcpy(ptr, page.keys_.data(), key_bytes);
+    ptr += key_bytes;
+    page.block_->WriteAdv(ptr);
+
+    Status status = file_handle.Append(buffer.data(), total_bytes);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+}
+
+void ExternalSorter::Merge(Vector<UniquePtr<DataBlock>> &output_blocks) {
+    MergeNext(output_blocks, std::numeric_limits<SizeT>::max());
+}
+
+bool ExternalSorter::MergeNext(Vector<UniquePtr<DataBlock>> &output_blocks, SizeT max_block_count) {
+    if (!merge_started_) {
+        StartMerge();
+    }
+    if (merge_state_.get() == nullptr) {
+        return true;
+    }
+    SizeT output_start = output_blocks.size();
+
+    if (merge_state_->single_run_) {
+        // Already sorted
+        auto &pages = runs_[0].pages_;
+        while (merge_state_->next_page_idx_ < pages.size() && output_blocks.size() - output_start < max_block_count) {
+            output_blocks.push_back(std::move(pages[merge_state_->next_page_idx_++].block_));
+        }
+        if (merge_state_->next_page_idx_ < pages.size()) {
+            return false;
+        }
+        FinishMerge();
+        return true;
+    }
+
+    auto &readers = merge_state_->readers_;
+    SortMergeTree &loser_tree = *merge_state_->loser_tree_;
+    SortOutputWriter &writer = *merge_state_->writer_;
+    while (loser_tree.TopSource() != SortMergeTree::invalid_) {
+        if (output_blocks.size() - output_start >= max_block_count) {
+            return false;
+        }
+        SortRunReader &reader = *readers[loser_tree.TopSource()];
+        writer.Append(output_blocks, reader.block(), reader.row());
+        if (reader.LastRowOfPage()) {
+            // The page will be released by the reader.
+            writer.Flush();
+        }
+        if (reader.Next()) {
+            SortMergeKey key = reader.key();
+            loser_tree.DeleteTopInsert(&key, false);
+        } else {
+            loser_tree.DeleteTopInsert(nullptr, true);
+        }
+    }
+    writer.Finish(output_blocks);
+    FinishMerge();
+    return true;
+}
+
+void ExternalSorter::StartMerge() {
+    merge_started_ = true;
+    SizeT run_count = runs_.size();
+    if (run_count == 0) {
+        return;
+    }
+    merge_state_ = MakeUnique<SortMergeState>();
+    if (run_count == 1 && runs_[0].spill_path_.empty()) {
+        merge_state_->single_run_ = true;
+        return;
+    }
+
+    auto &readers = merge_state_->readers_;
+    readers.reserve(run_count);
+    merge_state_->loser_tree_ = MakeUnique<SortMergeTree>(run_count);
+    SortMergeTree &loser_tree = *merge_state_->loser_tree_;
+    Vector<SharedPtr<DataType>> types;
+    for (SizeT run_idx = 0; run_idx < run_count; ++run_idx) {
+        auto &reader = readers.emplace_back(MakeUnique<SortRunReader>(runs_[run_idx]));
+        if (reader->Valid()) {
+            if (types.empty()) {
+                types = reader->block()->types();
+            }
+            SortMergeKey key = reader->key();
+            loser_tree.InsertStart(&key, static_cast<SortMergeTree::Source>(run_idx), false);
+        } else {
+            loser_tree.InsertStart(nullptr, static_cast<SortMergeTree::Source>(run_idx), true);
+        }
+    }
+    loser_tree.Init();
+    merge_state_->writer_ = MakeUnique<SortOutputWriter>(std::move(types));
+}
+
+void ExternalSorter::FinishMerge() {
+    merge_state_.reset();
+    for (const auto &run : runs_) {
+        if (!run.spill_path_.empty()) {
+            VirtualStore::DeleteFile(run.spill_path_);
+        }
+    }
+    runs_.clear();
+    memory_size_ = 0;
+}
+
+} // namespace infinity
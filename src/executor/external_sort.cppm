@@ -0,0 +1,112 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module external_sort;
+
+import stl;
+import column_vector;
+import data_block;
+import internal_types;
+import data_type;
+import select_statement;
+import local_file_handle;
+
+namespace infinity {
+
+// Encode the ORDER BY columns of a row into a byte string, so that comparing two rows is a memcmp of their keys.
+// Each column starts with a null flag byte (nulls sort last in ascending order), fixed width values are stored big endian with the
+// sign bit flipped, varchar escapes 0x00 as 0x00 0xFF and ends with 0x00 0x00. The bytes of a descending column are inverted.
+export class SortKeyEncoder {
+public:
+    SortKeyEncoder(Vector<SharedPtr<DataType>> types, Vector<OrderType> order_types);
+
+    static bool SupportType(const DataType &data_type);
+
+    // Append the keys of rows [0, row_count) to keys, and the end offset of each key to key_offsets.
+    void Encode(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<char> &keys, Vector<u32> &key_offsets) const;
+
+private:
+    Vector<SharedPtr<DataType>> types_{};
+    Vector<OrderType> order_types_{};
+};
+
+// A sorted run is a sequence of pages, each page holds one output block and the sort keys of its rows.
+struct SortRunPage {
+    UniquePtr<DataBlock> block_{};
+    Vector<char> keys_{};
+    // row_count + 1 offsets, key of row i is keys_[key_offsets_[i], key_offsets_[i + 1]).
+    Vector<u32> key_offsets_{};
+
+    SizeT MemorySize() const;
+};
+
+struct SortRun {
+    Vector<SortRunPage> pages_{};
+    // Not empty if the pages are spilled to this file.
+    String spill_path_{};
+    SizeT page_count_{};
+    SizeT memory_size_{};
+};
+
+// Readers of all runs and the loser tree over them, kept between the MergeNext calls.
+struct SortMergeState;
+
+// Sort the rows with normalized keys: each run is sorted by radix sort on the key prefix, runs are kept in memory until they exceed the
+// memory limit, then they are written to the temp directory. All runs are merged by a loser tree at the end, only the current page of
+// each spilled run is loaded while merging.
+export class ExternalSorter {
+public:
+    ExternalSorter(Vector<SharedPtr<DataType>> key_types, Vector<OrderType> order_types, SizeT memory_limit, String spill_dir);
+
+    ~ExternalSorter();
+
+    // Sort the rows of the blocks into a new run, key_columns[i] are the ORDER BY columns evaluated on blocks[i].
+    void AddRun(Vector<UniquePtr<DataBlock>> blocks, const Vector<Vector<SharedPtr<ColumnVector>>> &key_columns);
+
+    // Merge all runs into the output blocks.
+    void Merge(Vector<UniquePtr<DataBlock>> &output_blocks);
+
+    // Append at most max_block_count merged blocks to output_blocks, return true when all runs are merged.
+    // No run can be added once the merge started.
+    bool MergeNext(Vector<UniquePtr<DataBlock>> &output_blocks, SizeT max_block_count);
+
+    [[nodiscard]] inline SizeT RunCount() const { return runs_.size(); }
+
+    [[nodiscard]] inline SizeT SpilledRunCount() const { return spilled_run_count_; }
+
+private:
+    void Spill(SortRun &run);
+
+    static void WritePage(LocalFileHandle &file_handle, const SortRunPage &page);
+
+    void StartMerge();
+
+    void FinishMerge();
+
+private:
+    SortKeyEncoder encoder_;
+    SizeT memory_limit_{};
+    String spill_dir_{};
+
+    Vector<SortRun> runs_{};
+    SizeT memory_size_{};
+    SizeT spilled_run_count_{};
+
+    UniquePtr<SortMergeState> merge_state_{};
+    bool merge_started_{false};
+};
+
+} // namespace infinity
@@ -27,6 +27,7 @@ import physical_source;
 import physical_explain;
 import physical_knn_scan;
 import physical_fusion;
+import physical_hash_join;
 import status;
 import infinity_exception;
 
@@ -155,7 +156,6 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
         case PhysicalOperatorType::kFilter:
         case PhysicalOperatorType::kUnnest:
         case PhysicalOperatorType::kUnnestAggregate:
-        case PhysicalOperatorType::kHash:
         case PhysicalOperatorType::kLimit: {
             if (phys_op->left() == nullptr) {
                 String error_message = fmt::format("No input node of {}", phys_op->GetName());
@@ -166,6 +166,19 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             BuildFragments(phys_op->left(), current_fragment_ptr);
             break;
         }
+        case PhysicalOperatorType::kHash: {
+            if (phys_op->left() == nullptr) {
+                String error_message = fmt::format("No input node of {}", phys_op->GetName());
+                UnrecoverableError(error_message);
+            }
+            current_fragment_ptr->AddOperator(phys_op);
+            BuildFragments(phys_op->left(), current_fragment_ptr);
+            // Materialize the build side, its tasks only notify the join once the hash table is filled.
+            if (current_fragment_ptr->GetFragmentType() != FragmentType::kSerialMaterialize) {
+                current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+            }
+            break;
+        }
         case PhysicalOperatorType::kTop: {
             if (phys_op->left() == nullptr) {
                 String error_message = fmt::format("No input node of {}", phys_op->GetName());
@@ -251,11 +264,39 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             }
             return;
         }
+        case PhysicalOperatorType::kJoinHash: {
+            if (phys_op->left() == nullptr || phys_op->right() == nullptr) {
+                String error_message = fmt::format("No input node of {}", phys_op->GetName());
+                UnrecoverableError(error_message);
+            }
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            current_fragment_ptr->SetFragmentType(FragmentType::kSerialMaterialize);
+
+            // Probe side streams its blocks to the join.
+            auto probe_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+            probe_plan_fragment->SetSinkNode(query_context_ptr_,
+                                             SinkType::kLocalQueue,
+                                             phys_op->left()->GetOutputNames(),
+                                             phys_op->left()->GetOutputTypes());
+            BuildFragments(phys_op->left(), probe_plan_fragment.get());
+            current_fragment_ptr->AddChild(std::move(probe_plan_fragment));
+
+            // Build side fills the hash table in parallel and only notifies its completion.
+            auto build_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+            build_plan_fragment->SetSinkNode(query_context_ptr_,
+                                             SinkType::kLocalQueue,
+                                             phys_op->right()->GetOutputNames(),
+                                             phys_op->right()->GetOutputTypes());
+            BuildFragments(phys_op->right(), build_plan_fragment.get());
+            static_cast<PhysicalHashJoin *>(phys_op)->SetBuildFragmentID(build_plan_fragment->FragmentID());
+            current_fragment_ptr->AddChild(std::move(build_plan_fragment));
+            return;
+        }
         case PhysicalOperatorType::kUnionAll:
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
         case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
@@ -14,7 +14,8 @@
 
 module;
 
-#include <string>
+module hash_table;
+
 import stl;
 import logical_type;
 import column_vector;
@@ -22,20 +23,63 @@ import status;
 import infinity_exception;
 import third_party;
 import internal_types;
-
-module hash_table;
+import data_type;
 
 namespace infinity {
 
+namespace {
+
+constexpr SizeT kInitialSlotCount = 16;
+constexpr SizeT kHeapChunkSize = 64 * 1024;
+
+inline SizeT AlignUp8(SizeT size) { return (size + 7) & ~SizeT(7); }
+
+inline u64 MixHash(u64 h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+u64 HashBytes(const char *data, SizeT size, u64 h) {
+    SizeT pos = 0;
+    for (; pos + sizeof(u64) <= size; pos += sizeof(u64)) {
+        u64 word{};
+        std::memcpy(&word, data + pos, sizeof(u64));
+        h = MixHash(h ^ word) + 0x9e3779b97f4a7c15ULL;
+    }
+    u64 tail = size;
+    if (pos < size) {
+        std::memcpy(&tail, data + pos, size - pos);
+        tail ^= u64(size) << 56;
+    }
+    return MixHash(h ^ tail);
+}
+
+inline SizeT RowIndex(const ColumnVector &column, SizeT row) { return column.vector_type() == ColumnVectorType::kConstant ? 0 : row; }
+
+} // namespace
 
 void HashTableBase::Init(Vector<SharedPtr<DataType>> types) {
     types_ = std::move(types);
-    SizeT key_size = 0;
     SizeT type_count = types_.size();
+    fields_.clear();
+    fields_.resize(type_count);
+
+    // The null flags come first, then the fixed width values.
+    SizeT offset = type_count;
+    varchar_count_ = 0;
     for (SizeT idx = 0; idx < type_count; ++idx) {
         const DataType &data_type = *types_[idx];
+        GroupKeyField &field = fields_[idx];
+        field.type_ = data_type.type();
         switch (data_type.type()) {
-            case LogicalType::kBoolean:
+            case LogicalType::kBoolean: {
+                field.size_ = sizeof(BooleanT);
+                break;
+            }
             case LogicalType::kTinyInt:
             case LogicalType::kSmallInt:
             case LogicalType::kInteger:
@@ -46,97 +90,271 @@ void HashTableBase::Init(Vector<SharedPtr<DataType>> types) {
             case LogicalType::kTime:
             case LogicalType::kDateTime:
             case LogicalType::kTimestamp: {
-                SizeT type_size = data_type.Size();
-                key_size += type_size;
-                break; // All these type can be hashed.
+                field.size_ = data_type.Size();
+                break;
             }
             case LogicalType::kVarchar: {
-                key_size = 0;
-                break; // Varchar can be hashed.
+                field.size_ = sizeof(GroupVarcharSlot);
+                ++varchar_count_;
+                continue;
             }
             default: {
                 RecoverableError(Status::NotSupport(fmt::format("Attempt to construct hash key for type: {}", data_type.ToString())));
             }
         }
-        if (key_size == 0) {
-            break;
+        field.offset_ = offset;
+        offset += field.size_;
+    }
+
+    // Varchar slots are after the fixed part, which is padded to whole words.
+    fixed_size_ = AlignUp8(offset);
+    offset = fixed_size_;
+    for (auto &field : fields_) {
+        if (field.type_ == LogicalType::kVarchar) {
+            field.offset_ = offset;
+            offset += field.size_;
         }
     }
+    key_size_ = offset;
+}
 
-    if (key_size) {
-        // Key layout: col1\0col2\0col3\0.
-        key_size += type_count;
+u64 HashTableBase::HashKey(const char *key) const {
+    u64 h = HashBytes(key, fixed_size_, 0);
+    if (varchar_count_ == 0) {
+        return h;
     }
-    key_size_ = key_size;
+    for (SizeT slot_offset = fixed_size_; slot_offset < key_size_; slot_offset += sizeof(GroupVarcharSlot)) {
+        GroupVarcharSlot slot;
+        std::memcpy(&slot, key + slot_offset, sizeof(slot));
+        h = HashBytes(slot.data_, slot.length_, h);
+    }
+    return h;
 }
 
-void HashTableBase::GetHashKey(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_id, String &hash_key) const {
+bool HashTableBase::KeyEquals(const char *left, const char *right) const {
+    if (std::memcmp(left, right, fixed_size_) != 0) {
+        return false;
+    }
+    for (SizeT slot_offset = fixed_size_; slot_offset < key_size_; slot_offset += sizeof(GroupVarcharSlot)) {
+        GroupVarcharSlot left_slot, right_slot;
+        std::memcpy(&left_slot, left + slot_offset, sizeof(left_slot));
+        std::memcpy(&right_slot, right + slot_offset, sizeof(right_slot));
+        if (left_slot.length_ != right_slot.length_ || std::memcmp(left_slot.data_, right_slot.data_, left_slot.length_) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void HashTableBase::PackKeys(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count) {
     SizeT column_count = columns.size();
-    hash_key.clear();
-    bool has_null = false;
+    if (column_count != types_.size()) {
+        String error_message = fmt::format("Expect {} group by columns, but get {}", types_.size(), column_count);
+        UnrecoverableError(error_message);
+    }
+    key_buffer_.assign(row_count * key_size_, 0);
+    hash_buffer_.resize(row_count);
+
+    char *keys = key_buffer_.data();
     for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-        if (!columns[column_id]->nulls_ptr_->IsTrue(row_id)) {
-            hash_key += "\0\0";
-            has_null = true;
-            continue;
+        const ColumnVector &column = *columns[column_id];
+        const GroupKeyField &field = fields_[column_id];
+        bool all_valid = column.nulls_ptr_->IsAllTrue();
+        for (SizeT row = 0; row < row_count; ++row) {
+            SizeT idx = RowIndex(column, row);
+            char *key = keys + row * key_size_;
+            if (!all_valid && !column.nulls_ptr_->IsTrue(idx)) {
+                // The value bytes stay zero, so all nulls of the column fall into the same group.
+                key[column_id] = 1;
+                continue;
+            }
+            switch (field.type_) {
+                case LogicalType::kBoolean: {
+                    key[field.offset_] = column.buffer_->GetCompactBit(idx) ? 1 : 0;
+                    break;
+                }
+                case LogicalType::kFloat: {
+                    FloatT value = reinterpret_cast<const FloatT *>(column.data())[idx];
+                    if (value == 0.0f) {
+                        // -0.0 and 0.0 are the same group
+                        value = 0.0f;
+                    }
+                    std::memcpy(key + field.offset_, &value, sizeof(value));
+                    break;
+                }
+                case LogicalType::kDouble: {
+                    DoubleT value = reinterpret_cast<const DoubleT *>(column.data())[idx];
+                    if (value == 0.0) {
+                        value = 0.0;
+                    }
+                    std::memcpy(key + field.offset_, &value, sizeof(value));
+                    break;
+                }
+                case LogicalType::kVarchar: {
+                    Span<const char> text = column.GetVarchar(idx);
+                    GroupVarcharSlot slot{text.size(), text.data()};
+                    std::memcpy(key + field.offset_, &slot, sizeof(slot));
+                    break;
+                }
+                default: {
+                    std::memcpy(key + field.offset_, column.data() + idx * field.size_, field.size_);
+                    break;
+                }
+            }
         }
+    }
 
-        const DataType &data_type = *types_[column_id];
+    for (SizeT row = 0; row < row_count; ++row) {
+        hash_buffer_[row] = HashKey(keys + row * key_size_);
+    }
+}
 
-        if (data_type.type() == LogicalType::kVarchar) {
-            Span<const char> text = columns[column_id]->GetVarchar(row_id);
-            hash_key.append(text.begin(), text.end());
-        } else {
-            SizeT type_size = types_[column_id]->Size();
-            Span<const char> binary(reinterpret_cast<const char *>(columns[column_id]->data() + type_size * row_id), type_size);
-            hash_key.append(binary.begin(), binary.end());
+u32 HashTableBase::FindOrInsert(const char *key, u64 hash, bool &inserted) {
+    SizeT partition_idx = PartitionIndex(hash);
+    Vector<GroupHashSlot> &slots = partitions_[partition_idx];
+    SizeT &partition_group_count = partition_group_counts_[partition_idx];
+    if ((partition_group_count + 1) * 2 > slots.size()) {
+        // Keep the load factor under 1/2, so that the linear probing sequences stay short.
+        Grow(slots);
+    }
+
+    SizeT slot_mask = slots.size() - 1;
+    SizeT pos = hash & slot_mask;
+    while (true) {
+        GroupHashSlot &slot = slots[pos];
+        if (slot.group_id_ == 0) {
+            break;
+        }
+        if (slot.hash_ == hash && KeyEquals(GroupKey(slot.group_id_ - 1), key)) {
+            inserted = false;
+            return slot.group_id_ - 1;
         }
-        hash_key += '\0';
+        pos = (pos + 1) & slot_mask;
     }
-    if (!has_null && key_size_ && hash_key.size() != key_size_) {
-        UnrecoverableError(fmt::format("Hash key size mismatch: {} vs {}", hash_key.size(), key_size_));
+
+    u32 group_id = GroupCount();
+    group_keys_.insert(group_keys_.end(), key, key + key_size_);
+    group_hashes_.push_back(hash);
+    if (varchar_count_ > 0) {
+        // The input key points to the column data, keep a copy of the string in the table.
+        char *stored_key = group_keys_.data() + group_id * key_size_;
+        for (SizeT slot_offset = fixed_size_; slot_offset < key_size_; slot_offset += sizeof(GroupVarcharSlot)) {
+            GroupVarcharSlot varchar_slot;
+            std::memcpy(&varchar_slot, stored_key + slot_offset, sizeof(varchar_slot));
+            varchar_slot.data_ = CopyToHeap(varchar_slot.data_, varchar_slot.length_);
+            std::memcpy(stored_key + slot_offset, &varchar_slot, sizeof(varchar_slot));
+        }
     }
+    slots[pos] = GroupHashSlot{hash, group_id + 1};
+    ++partition_group_count;
+    inserted = true;
+    return group_id;
 }
 
-void HashTable::Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count) {
-    String hash_key;
-    if (key_size_) {
-        hash_key.reserve(key_size_);
-    }
-    for (SizeT row_id = 0; row_id < row_count; ++row_id) {
-        GetHashKey(columns, row_id, hash_key);
-        hash_table_[std::move(hash_key)][block_id].emplace_back(row_id);
+void HashTableBase::Grow(Vector<GroupHashSlot> &slots) {
+    SizeT slot_count = std::max(kInitialSlotCount, slots.size() * 2);
+    Vector<GroupHashSlot> new_slots(slot_count);
+    SizeT slot_mask = slot_count - 1;
+    for (const auto &slot : slots) {
+        if (slot.group_id_ == 0) {
+            continue;
+        }
+        // Rehash with the stored hash, the keys are never read again.
+        SizeT new_pos = slot.hash_ & slot_mask;
+        while (new_slots[new_pos].group_id_ != 0) {
+            new_pos = (new_pos + 1) & slot_mask;
+        }
+        new_slots[new_pos] = slot;
     }
+    slots = std::move(new_slots);
 }
 
-void MergeHashTable::Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count) {
-    String hash_key;
-    if (key_size_) {
-        hash_key.reserve(key_size_);
+const char *HashTableBase::CopyToHeap(const char *data, SizeT length) {
+    if (length == 0) {
+        return nullptr;
     }
-    for (SizeT row_id = 0; row_id < row_count; ++row_id) {
-        GetHashKey(columns, row_id, hash_key);
-        if (auto iter = hash_table_.find(hash_key); iter != hash_table_.end()) {
-            UnrecoverableError("Duplicate key in merge hash table");
+    if (heap_chunks_.empty() || heap_chunk_offset_ + length > heap_chunk_size_) {
+        heap_chunk_size_ = std::max(kHeapChunkSize, length);
+        heap_chunks_.emplace_back(MakeUnique<char[]>(heap_chunk_size_));
+        heap_chunk_offset_ = 0;
+    }
+    char *dst = heap_chunks_.back().get() + heap_chunk_offset_;
+    std::memcpy(dst, data, length);
+    heap_chunk_offset_ += length;
+    return dst;
+}
+
+void HashTableBase::AppendGroupKey(u32 group_id, const Vector<SharedPtr<ColumnVector>> &columns) const {
+    const char *key = GroupKey(group_id);
+    SizeT column_count = fields_.size();
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        ColumnVector &column = *columns[column_id];
+        const GroupKeyField &field = fields_[column_id];
+        if (field.type_ == LogicalType::kVarchar) {
+            GroupVarcharSlot slot;
+            std::memcpy(&slot, key + field.offset_, sizeof(slot));
+            column.AppendVarchar(Span<const char>(slot.data_, slot.length_));
         } else {
-            hash_table_.emplace_hint(iter, std::move(hash_key), Pair<SizeT, SizeT>(block_id, row_id));
+            // The value bytes of a null key are zero, so it is still a valid value to append.
+            column.AppendByPtr(reinterpret_cast<const_ptr_t>(key + field.offset_));
+        }
+        if (key[column_id]) {
+            column.nulls_ptr_->SetFalse(column.Size() - 1);
         }
     }
 }
 
-bool MergeHashTable::GetOrInsert(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_id, Pair<SizeT, SizeT> &block_row_id) {
-    String hash_key;
-    if (key_size_) {
-        hash_key.reserve(key_size_);
+Vector<u32> HashTableBase::GroupsByPartition() const {
+    SizeT group_count = GroupCount();
+    Array<SizeT, kPartitionCount + 1> partition_offsets{};
+    for (SizeT group_id = 0; group_id < group_count; ++group_id) {
+        ++partition_offsets[PartitionIndex(group_hashes_[group_id]) + 1];
     }
-    GetHashKey(columns, row_id, hash_key);
-    auto iter = hash_table_.find(hash_key);
-    if (iter == hash_table_.end()) {
-        hash_table_.emplace_hint(iter, std::move(hash_key), block_row_id);
-        return false;
+    for (SizeT partition_idx = 0; partition_idx < kPartitionCount; ++partition_idx) {
+        partition_offsets[partition_idx + 1] += partition_offsets[partition_idx];
     }
-    block_row_id = iter->second;
-    return true;
+    Vector<u32> group_ids(group_count);
+    for (SizeT group_id = 0; group_id < group_count; ++group_id) {
+        group_ids[partition_offsets[PartitionIndex(group_hashes_[group_id])]++] = group_id;
+    }
+    return group_ids;
+}
+
+void HashTableBase::PartitionKeys(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u8> &partitions) {
+    PackKeys(columns, row_count);
+    partitions.resize(row_count);
+    for (SizeT row = 0; row < row_count; ++row) {
+        partitions[row] = PartitionIndex(hash_buffer_[row]);
+    }
+}
+
+void HashTable::Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u32> &group_ids) {
+    PackKeys(columns, row_count);
+    group_ids.resize(row_count);
+    const char *keys = key_buffer_.data();
+    for (SizeT row = 0; row < row_count; ++row) {
+        bool inserted = false;
+        group_ids[row] = FindOrInsert(keys + row * key_size_, hash_buffer_[row], inserted);
+    }
+}
+
+void GroupStateArena::Init(const Vector<SizeT> &state_sizes) {
+    state_offsets_.clear();
+    SizeT offset = 0;
+    for (SizeT state_size : state_sizes) {
+        state_offsets_.push_back(offset);
+        offset += AlignUp8(state_size);
+    }
+    group_size_ = std::max<SizeT>(offset, sizeof(u64));
+    group_count_ = 0;
+    chunks_.clear();
+}
+
+void GroupStateArena::Resize(SizeT group_count) {
+    while (chunks_.size() * kChunkGroupCount < group_count) {
+        chunks_.emplace_back(MakeUnique<char[]>(kChunkGroupCount * group_size_));
+    }
+    group_count_ = group_count;
 }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
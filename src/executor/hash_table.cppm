@@ -20,40 +20,132 @@ import stl;
 import column_vector;
 import internal_types;
 import data_type;
+import logical_type;
 
 namespace infinity {
 
+struct GroupKeyField {
+    LogicalType type_{LogicalType::kInvalid};
+    // Offset of the value in the packed key, the null flag of the column is at the column index.
+    SizeT offset_{};
+    SizeT size_{};
+};
+
+struct GroupHashSlot {
+    u64 hash_{};
+    // 1-based group id, 0 means empty slot.
+    u32 group_id_{};
+};
+
+// Varchar slot of the packed key. Keys of input rows point to the column data, stored keys point to the string heap of the table.
+struct GroupVarcharSlot {
+    u64 length_{};
+    const char *data_{};
+};
+
+// Group-by keys are packed into fixed width rows: one null flag byte per key column, then the fixed width values, then one
+// GroupVarcharSlot per varchar column. The fixed part is compared and hashed as raw bytes, so the table never builds a String
+// per input row.
+// Groups are stored in insertion order and looked up through open addressing tables with the stored hash of each group. The high
+// bits of the hash select one of kPartitionCount partitions, each partition probes linearly over the low bits and grows on its own.
+// The partition index is also used to hand out the groups partition by partition when the result is produced.
 class HashTableBase {
 public:
+    static constexpr SizeT kPartitionBits = 4;
+    static constexpr SizeT kPartitionCount = 1ul << kPartitionBits;
+
     bool Initialized() const { return !types_.empty(); }
 
     void Init(Vector<SharedPtr<DataType>> types);
 
-    void GetHashKey(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_id, String &hash_key) const;
+    [[nodiscard]] inline SizeT GroupCount() const { return group_hashes_.size(); }
+
+    [[nodiscard]] inline u64 GroupHash(u32 group_id) const { return group_hashes_[group_id]; }
+
+    [[nodiscard]] inline const char *GroupKey(u32 group_id) const { return group_keys_.data() + group_id * key_size_; }
+
+    // Append the key of the group to the key columns, one column per group-by type.
+    void AppendGroupKey(u32 group_id, const Vector<SharedPtr<ColumnVector>> &columns) const;
+
+    // Group ids ordered by partition, groups of the same partition keep their insertion order.
+    Vector<u32> GroupsByPartition() const;
+
+    // Partition of each of the rows [0, row_count) of the key columns, without inserting any group.
+    void PartitionKeys(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u8> &partitions);
+
+    static inline SizeT PartitionIndex(u64 hash) { return hash >> (64 - kPartitionBits); }
+
+protected:
+    // Pack and hash the keys of rows [0, row_count) into key_buffer_ and hash_buffer_.
+    void PackKeys(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count);
+
+    // Find the group of the packed key, insert a new group if not found.
+    u32 FindOrInsert(const char *key, u64 hash, bool &inserted);
+
+private:
+    u64 HashKey(const char *key) const;
+
+    bool KeyEquals(const char *left, const char *right) const;
+
+    const char *CopyToHeap(const char *data, SizeT length);
+
+    static void Grow(Vector<GroupHashSlot> &slots);
 
 public:
     Vector<SharedPtr<DataType>> types_{};
     SizeT key_size_{};
+
+protected:
+    Vector<GroupKeyField> fields_{};
+    // Size of the prefix of the packed key which can be compared with memcmp.
+    SizeT fixed_size_{};
+    SizeT varchar_count_{};
+
+    Vector<char> key_buffer_{};
+    Vector<u64> hash_buffer_{};
+
+private:
+    Vector<char> group_keys_{};
+    Vector<u64> group_hashes_{};
+    Array<Vector<GroupHashSlot>, kPartitionCount> partitions_{};
+    Array<SizeT, kPartitionCount> partition_group_counts_{};
+
+    Vector<UniquePtr<char[]>> heap_chunks_{};
+    SizeT heap_chunk_offset_{};
+    SizeT heap_chunk_size_{};
 };
 
 export class HashTable : public HashTableBase {
 public:
-    void Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count);
-
-public:
-    // Key -> (block id -> row array)
-    HashMap<String, HashMap<SizeT, Vector<SizeT>>> hash_table_{};
+    // Map each row of the key columns to its group id. New keys create new groups, so group ids not less than the group count
+    // before the call are the groups inserted by this call.
+    void Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u32> &group_ids);
 };
 
-export class MergeHashTable : public HashTableBase {
+// Aggregate states of all groups. The states of one group are laid out together, and the memory is allocated in chunks so that the
+// address of a state never changes when more groups are added.
+export class GroupStateArena {
 public:
-    void Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count);
+    static constexpr SizeT kChunkGroupCount = 1024;
 
-    bool GetOrInsert(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_id, Pair<SizeT, SizeT> &block_row_id);
+    void Init(const Vector<SizeT> &state_sizes);
 
-public:
-    // Key -> (block id, row id)
-    HashMap<String, Pair<SizeT, SizeT>> hash_table_{};
+    [[nodiscard]] bool Initialized() const { return group_size_ != 0; }
+
+    // Allocate the states for groups [GroupCount(), group_count).
+    void Resize(SizeT group_count);
+
+    [[nodiscard]] inline SizeT GroupCount() const { return group_count_; }
+
+    [[nodiscard]] inline char *GetState(u32 group_id, SizeT state_idx) const {
+        return chunks_[group_id / kChunkGroupCount].get() + (group_id % kChunkGroupCount) * group_size_ + state_offsets_[state_idx];
+    }
+
+private:
+    Vector<SizeT> state_offsets_{};
+    SizeT group_size_{};
+    SizeT group_count_{};
+    Vector<UniquePtr<char[]>> chunks_{};
 };
 
 } // namespace infinity
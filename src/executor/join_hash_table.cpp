@@ -0,0 +1,244 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module join_hash_table;
+
+import stl;
+import logical_type;
+import column_vector;
+import data_block;
+import status;
+import infinity_exception;
+import third_party;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+namespace {
+
+inline u64 MixHash(u64 h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+inline SizeT RowIndex(const ColumnVector &column, SizeT row) { return column.vector_type() == ColumnVectorType::kConstant ? 0 : row; }
+
+u64 HashValue(const ColumnVector &column, SizeT row) {
+    const DataType &data_type = *column.data_type();
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            return column.buffer_->GetCompactBit(row) ? 1 : 0;
+        }
+        case LogicalType::kFloat: {
+            FloatT value = reinterpret_cast<const FloatT *>(column.data())[row];
+            if (value == 0.0f) {
+                // -0.0 and 0.0 are equal
+                value = 0.0f;
+            }
+            u32 bits{};
+            std::memcpy(&bits, &value, sizeof(value));
+            return bits;
+        }
+        case LogicalType::kDouble: {
+            DoubleT value = reinterpret_cast<const DoubleT *>(column.data())[row];
+            if (value == 0.0) {
+                value = 0.0;
+            }
+            u64 bits{};
+            std::memcpy(&bits, &value, sizeof(value));
+            return bits;
+        }
+        case LogicalType::kVarchar: {
+            Span<const char> value = column.GetVarchar(row);
+            return std::hash<std::string_view>{}(std::string_view(value.data(), value.size()));
+        }
+        default: {
+            SizeT type_size = data_type.Size();
+            u64 bits{};
+            std::memcpy(&bits, column.data() + row * type_size, type_size);
+            return bits;
+        }
+    }
+}
+
+bool ValueEquals(const ColumnVector &left, SizeT left_row, const ColumnVector &right, SizeT right_row) {
+    const DataType &data_type = *left.data_type();
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            return left.buffer_->GetCompactBit(left_row) == right.buffer_->GetCompactBit(right_row);
+        }
+        case LogicalType::kFloat: {
+            return reinterpret_cast<const FloatT *>(left.data())[left_row] == reinterpret_cast<const FloatT *>(right.data())[right_row];
+        }
+        case LogicalType::kDouble: {
+            return reinterpret_cast<const DoubleT *>(left.data())[left_row] == reinterpret_cast<const DoubleT *>(right.data())[right_row];
+        }
+        case LogicalType::kVarchar: {
+            Span<const char> left_value = left.GetVarchar(left_row);
+            Span<const char> right_value = right.GetVarchar(right_row);
+            return left_value.size() == right_value.size() && std::memcmp(left_value.data(), right_value.data(), left_value.size()) == 0;
+        }
+        default: {
+            SizeT type_size = data_type.Size();
+            return std::memcmp(left.data() + left_row * type_size, right.data() + right_row * type_size, type_size) == 0;
+        }
+    }
+}
+
+} // namespace
+
+JoinHashTable::JoinHashTable(Vector<SharedPtr<DataType>> key_types) : key_types_(std::move(key_types)) {
+    if (key_types_.empty()) {
+        String error_message = "Hash join requires at least one join key.";
+        UnrecoverableError(error_message);
+    }
+    for (const auto &key_type : key_types_) {
+        if (!SupportKeyType(*key_type)) {
+            RecoverableError(Status::NotSupport(fmt::format("Attempt to build hash join key for type: {}", key_type->ToString())));
+        }
+    }
+}
+
+bool JoinHashTable::SupportKeyType(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void JoinHashTable::HashKeys(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<u64> &hashes, Vector<bool> &valid) {
+    hashes.assign(row_count, 0);
+    valid.assign(row_count, true);
+    for (const auto &key_column : key_columns) {
+        const ColumnVector &column = *key_column;
+        bool all_valid = column.nulls_ptr_->IsAllTrue();
+        for (SizeT row = 0; row < row_count; ++row) {
+            SizeT idx = RowIndex(column, row);
+            if (!all_valid && !column.nulls_ptr_->IsTrue(idx)) {
+                valid[row] = false;
+                continue;
+            }
+            u64 h = hashes[row];
+            hashes[row] = MixHash(h ^ (HashValue(column, idx) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2)));
+        }
+    }
+}
+
+bool JoinHashTable::KeyEquals(const Vector<SharedPtr<ColumnVector>> &probe_keys,
+                              SizeT probe_row,
+                              const Vector<SharedPtr<ColumnVector>> &build_keys,
+                              SizeT build_row) {
+    SizeT key_count = probe_keys.size();
+    for (SizeT key_idx = 0; key_idx < key_count; ++key_idx) {
+        const ColumnVector &probe_key = *probe_keys[key_idx];
+        const ColumnVector &build_key = *build_keys[key_idx];
+        if (!ValueEquals(probe_key, RowIndex(probe_key, probe_row), build_key, RowIndex(build_key, build_row))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void JoinHashTable::Build(UniquePtr<DataBlock> build_block, UniquePtr<DataBlock> key_block) {
+    SizeT row_count = build_block->row_count();
+    if (row_count == 0) {
+        return;
+    }
+    if (key_block->column_count() != key_types_.size()) {
+        String error_message = fmt::format("Expect {} hash join keys, but get {}", key_types_.size(), key_block->column_count());
+        UnrecoverableError(error_message);
+    }
+
+    Vector<u64> hashes;
+    Vector<bool> valid;
+    HashKeys(key_block->column_vectors, row_count, hashes, valid);
+
+    u32 block_id{};
+    {
+        std::unique_lock lock(block_mutex_);
+        block_id = build_blocks_.size();
+        build_blocks_.emplace_back(std::move(build_block));
+        key_blocks_.emplace_back(std::move(key_block));
+    }
+
+    // Scatter the rows to partitions first, then each partition is locked only once for this block.
+    Array<Vector<JoinHashEntry>, kPartitionCount> partition_entries;
+    SizeT valid_count = 0;
+    for (SizeT row = 0; row < row_count; ++row) {
+        if (!valid[row]) {
+            continue;
+        }
+        partition_entries[PartitionIndex(hashes[row])].push_back(JoinHashEntry{hashes[row], JoinRowRef{block_id, static_cast<u32>(row)}, 0});
+        ++valid_count;
+    }
+    for (SizeT partition_idx = 0; partition_idx < kPartitionCount; ++partition_idx) {
+        if (partition_entries[partition_idx].empty()) {
+            continue;
+        }
+        JoinHashPartition &partition = partitions_[partition_idx];
+        std::unique_lock lock(partition.mutex_);
+        InsertEntries(partition, partition_entries[partition_idx]);
+    }
+    row_count_ += valid_count;
+}
+
+void JoinHashTable::InsertEntries(JoinHashPartition &partition, const Vector<JoinHashEntry> &entries) {
+    SizeT entry_count = partition.entries_.size() + entries.size();
+    if (entry_count > partition.buckets_.size()) {
+        // Keep the load factor under 1, rebuild all chains with the new bucket count.
+        SizeT bucket_count = std::max<SizeT>(partition.buckets_.size(), 64);
+        while (bucket_count < entry_count) {
+            bucket_count <<= 1;
+        }
+        partition.buckets_.assign(bucket_count, 0);
+        SizeT old_count = partition.entries_.size();
+        for (SizeT pos = 0; pos < old_count; ++pos) {
+            JoinHashEntry &entry = partition.entries_[pos];
+            u32 &head = partition.buckets_[entry.hash_ & (bucket_count - 1)];
+            entry.next_ = head;
+            head = pos + 1;
+        }
+    }
+    SizeT bucket_mask = partition.buckets_.size() - 1;
+    for (const auto &new_entry : entries) {
+        JoinHashEntry &entry = partition.entries_.emplace_back(new_entry);
+        u32 &head = partition.buckets_[entry.hash_ & bucket_mask];
+        entry.next_ = head;
+        head = partition.entries_.size();
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,113 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module join_hash_table;
+
+import stl;
+import column_vector;
+import data_block;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+export struct JoinRowRef {
+    u32 block_id_{};
+    u32 row_id_{};
+};
+
+struct JoinHashEntry {
+    u64 hash_{};
+    JoinRowRef row_{};
+    // 1-based index of the next entry in the same bucket, 0 terminates the chain.
+    u32 next_{};
+};
+
+struct JoinHashPartition {
+    std::mutex mutex_{};
+    Vector<JoinHashEntry> entries_{};
+    // 1-based head entry of each bucket, 0 means empty bucket.
+    Vector<u32> buckets_{};
+};
+
+// Hash table shared by the build tasks and the probe task of one hash join.
+// Rows are scattered to partitions by the high bits of the key hash, so that build tasks only contend on the partitions they
+// actually touch, and each partition is a chained table over the low bits. The probe only starts after all build tasks finished,
+// so lookups don't take any lock.
+export class JoinHashTable {
+public:
+    static constexpr SizeT kPartitionBits = 6;
+    static constexpr SizeT kPartitionCount = 1ul << kPartitionBits;
+
+    explicit JoinHashTable(Vector<SharedPtr<DataType>> key_types);
+
+    static bool SupportKeyType(const DataType &data_type);
+
+    // Compute the hash of each row of the key columns. Rows having a null key are invalid and never match any row.
+    static void HashKeys(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<u64> &hashes, Vector<bool> &valid);
+
+    // Thread safe, called by each build task with one input block and the join keys evaluated on it.
+    void Build(UniquePtr<DataBlock> build_block, UniquePtr<DataBlock> key_block);
+
+    // Call visitor(const JoinRowRef &) for every build row whose key equals the key at probe_row, stop when the visitor returns false.
+    template <typename Visitor>
+    void Probe(const Vector<SharedPtr<ColumnVector>> &probe_keys, SizeT probe_row, u64 hash, Visitor &&visitor) const {
+        const JoinHashPartition &partition = partitions_[PartitionIndex(hash)];
+        if (partition.buckets_.empty()) {
+            return;
+        }
+        u32 entry_pos = partition.buckets_[hash & (partition.buckets_.size() - 1)];
+        while (entry_pos != 0) {
+            const JoinHashEntry &entry = partition.entries_[entry_pos - 1];
+            if (entry.hash_ == hash && KeyEquals(probe_keys, probe_row, key_blocks_[entry.row_.block_id_]->column_vectors, entry.row_.row_id_)) {
+                if (!visitor(entry.row_)) {
+                    return;
+                }
+            }
+            entry_pos = entry.next_;
+        }
+    }
+
+    [[nodiscard]] inline const DataBlock *GetBuildBlock(SizeT block_id) const { return build_blocks_[block_id].get(); }
+
+    [[nodiscard]] inline SizeT BuildBlockCount() const { return build_blocks_.size(); }
+
+    [[nodiscard]] inline SizeT row_count() const { return row_count_.load(); }
+
+    [[nodiscard]] inline const Vector<SharedPtr<DataType>> &key_types() const { return key_types_; }
+
+private:
+    static inline SizeT PartitionIndex(u64 hash) { return hash >> (64 - kPartitionBits); }
+
+    static bool KeyEquals(const Vector<SharedPtr<ColumnVector>> &probe_keys,
+                          SizeT probe_row,
+                          const Vector<SharedPtr<ColumnVector>> &build_keys,
+                          SizeT build_row);
+
+    static void InsertEntries(JoinHashPartition &partition, const Vector<JoinHashEntry> &entries);
+
+private:
+    Vector<SharedPtr<DataType>> key_types_{};
+
+    std::mutex block_mutex_{};
+    Vector<UniquePtr<DataBlock>> build_blocks_{};
+    Vector<UniquePtr<DataBlock>> key_blocks_{};
+
+    Array<JoinHashPartition, kPartitionCount> partitions_{};
+    Atomic<SizeT> row_count_{0};
+};
+
+} // namespace infinity
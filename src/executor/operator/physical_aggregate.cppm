@@ -22,7 +22,6 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
-import data_table;
 import hash_table;
 import base_expression;
 import load_meta;
@@ -57,9 +56,11 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    void GroupByInputTable(const Vector<UniquePtr<DataBlock>> &input_blocks, Vector<UniquePtr<DataBlock>> &output_blocks, HashTable &hash_table);
+    // Merge the input rows into the groups of this task.
+    void GroupByAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks, AggregateOperatorState *aggregate_operator_state);
 
-    void GenerateGroupByResult(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &output_table, HashTable &hash_table);
+    // Produce one row per group, the groups are ordered by hash partition.
+    void GroupByAggregateFinalize(AggregateOperatorState *aggregate_operator_state);
 
     Vector<SharedPtr<BaseExpression>> groups_{};
     Vector<SharedPtr<BaseExpression>> aggregates_{};
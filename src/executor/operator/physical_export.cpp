@@ -476,10 +476,6 @@ new_label_return:
     return row_count;
 }
 
-SharedPtr<arrow::DataType> GetArrowType(const DataType &column_data_type);
-
-SharedPtr<arrow::Array> BuildArrowArray(const ColumnDef *column_def, const ColumnVector &column_vector, const Vector<u32> &block_rows_for_output);
-
 SizeT PhysicalExport::ExportToPARQUET(QueryContext *query_context, ExportOperatorState *export_op_state) {
     const Vector<SharedPtr<ColumnDef>> &column_defs = table_info_->column_defs_;
     Vector<ColumnID> select_columns;
@@ -105,4 +105,8 @@ private:
     SharedPtr<BlockIndex> block_index_{};
 };
 
+export SharedPtr<arrow::DataType> GetArrowType(const DataType &column_data_type);
+
+export SharedPtr<arrow::Array> BuildArrowArray(const ColumnDef *column_def, const ColumnVector &column_vector, const Vector<u32> &block_rows_for_output);
+
 } // namespace infinity
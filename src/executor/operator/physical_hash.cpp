@@ -14,15 +14,56 @@
 
 module;
 
+module physical_hash;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_hash;
+import data_block;
+import base_expression;
+import expression_state;
+import expression_evaluator;
+import join_hash_table;
+import data_type;
 
 namespace infinity {
 
 void PhysicalHash::Init(QueryContext* query_context) {}
 
-bool PhysicalHash::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalHash::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *prev_op_state = operator_state->prev_op_state_;
+    auto *hash_operator_state = static_cast<HashOperatorState *>(operator_state);
+
+    Vector<SharedPtr<DataType>> key_types;
+    key_types.reserve(build_keys_.size());
+    for (const auto &build_key : build_keys_) {
+        key_types.emplace_back(MakeShared<DataType>(build_key->Type()));
+    }
+
+    for (auto &input_data_block : prev_op_state->data_block_array_) {
+        if (input_data_block->row_count() == 0) {
+            continue;
+        }
+        UniquePtr<DataBlock> key_block = DataBlock::MakeUniquePtr();
+        key_block->Init(key_types);
+
+        ExpressionEvaluator evaluator;
+        evaluator.Init(input_data_block.get());
+        for (SizeT key_idx = 0; key_idx < build_keys_.size(); ++key_idx) {
+            SharedPtr<ExpressionState> key_state = ExpressionState::CreateState(build_keys_[key_idx]);
+            evaluator.Execute(build_keys_[key_idx], key_state, key_block->column_vectors[key_idx]);
+        }
+        key_block->Finalize();
+
+        hash_table_->Build(std::move(input_data_block), std::move(key_block));
+    }
+
+    // The hash table owns the input blocks now, nothing is sent to the join except the completion.
+    prev_op_state->data_block_array_.clear();
+    if (prev_op_state->Complete()) {
+        hash_operator_state->SetComplete();
+    }
+    return true;
+}
 
 } // namespace infinity
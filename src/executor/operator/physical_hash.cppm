@@ -22,6 +22,8 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
+import join_hash_table;
 import load_meta;
 import infinity_exception;
 import internal_types;
@@ -30,14 +32,16 @@ import logger;
 
 namespace infinity {
 
+// Build side of a hash join: every task inserts the blocks of its input into the shared join hash table.
 export class PhysicalHash final : public PhysicalOperator {
 public:
-    explicit PhysicalHash(SharedPtr<Vector<String>> output_names,
-                          SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                          u64 id,
+    explicit PhysicalHash(u64 id,
+                          UniquePtr<PhysicalOperator> left,
+                          Vector<SharedPtr<BaseExpression>> build_keys,
+                          SharedPtr<JoinHashTable> hash_table,
                           SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kHash, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kHash, std::move(left), nullptr, id, load_metas), build_keys_(std::move(build_keys)),
+          hash_table_(std::move(hash_table)) {}
 
     ~PhysicalHash() override = default;
 
@@ -45,13 +49,18 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    inline SharedPtr<Vector<String>> GetOutputNames() const final { return left_->GetOutputNames(); }
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return left_->GetOutputTypes(); }
+
+    inline const Vector<SharedPtr<BaseExpression>> &build_keys() const { return build_keys_; }
+
+    inline const SharedPtr<JoinHashTable> &hash_table() const { return hash_table_; }
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    // Join keys of the build side, column references are relative to the input of this operator.
+    Vector<SharedPtr<BaseExpression>> build_keys_{};
+    SharedPtr<JoinHashTable> hash_table_{};
 };
 
 } // namespace infinity
@@ -14,18 +14,202 @@
 
 module;
 
-#include <string>
+module physical_hash_join;
+
+import stl;
 import query_context;
 import operator_state;
-import stl;
-
-module physical_hash_join;
+import data_block;
+import column_vector;
+import base_expression;
+import expression_state;
+import expression_evaluator;
+import join_hash_table;
+import join_reference;
+import data_type;
+import logical_type;
+import infinity_exception;
+import third_party;
+import default_values;
 
 namespace infinity {
 
+namespace {
+
+void AppendRow(ColumnVector &target, const ColumnVector &source, SizeT source_row) {
+    if (source.vector_type() == ColumnVectorType::kConstant) {
+        source_row = 0;
+    }
+    SizeT target_row = target.Size();
+    target.AppendWith(source, source_row, 1);
+    if (!source.nulls_ptr_->IsAllTrue() && !source.nulls_ptr_->IsTrue(source_row)) {
+        target.nulls_ptr_->SetFalse(target_row);
+    }
+}
+
+void AppendNull(ColumnVector &target, const ColumnVector *placeholder) {
+    SizeT target_row = target.Size();
+    if (placeholder != nullptr) {
+        // Any row of the build side works as the placeholder of the null value.
+        target.AppendWith(*placeholder, 0, 1);
+    } else if (target.data_type()->type() == LogicalType::kVarchar) {
+        target.AppendVarchar({});
+    } else {
+        Vector<char> zero_value(target.data_type()->Size(), 0);
+        target.AppendByPtr(zero_value.data());
+    }
+    target.nulls_ptr_->SetFalse(target_row);
+}
+
+} // namespace
+
 void PhysicalHashJoin::Init(QueryContext* query_context) {}
 
-bool PhysicalHashJoin::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalHashJoin::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *hash_join_operator_state = static_cast<HashJoinOperatorState *>(operator_state);
+    if (!hash_join_operator_state->build_complete_) {
+        // Probe blocks are kept by the source state until all build tasks are done.
+        return false;
+    }
+
+    for (auto &probe_block : hash_join_operator_state->input_data_blocks_) {
+        ProbeBlock(probe_block.get(), hash_join_operator_state->data_block_array_);
+    }
+    hash_join_operator_state->input_data_blocks_.clear();
+
+    if (hash_join_operator_state->input_complete_) {
+        hash_join_operator_state->SetComplete();
+    }
+    return !hash_join_operator_state->data_block_array_.empty() || hash_join_operator_state->Complete();
+}
+
+void PhysicalHashJoin::ProbeBlock(const DataBlock *probe_block, Vector<UniquePtr<DataBlock>> &output_blocks) const {
+    SizeT row_count = probe_block->row_count();
+    if (row_count == 0) {
+        return;
+    }
+
+    DataBlock key_block;
+    Vector<SharedPtr<DataType>> key_types;
+    key_types.reserve(probe_keys_.size());
+    for (const auto &probe_key : probe_keys_) {
+        key_types.emplace_back(MakeShared<DataType>(probe_key->Type()));
+    }
+    key_block.Init(key_types);
+    ExpressionEvaluator evaluator;
+    evaluator.Init(probe_block);
+    for (SizeT key_idx = 0; key_idx < probe_keys_.size(); ++key_idx) {
+        SharedPtr<ExpressionState> key_state = ExpressionState::CreateState(probe_keys_[key_idx]);
+        evaluator.Execute(probe_keys_[key_idx], key_state, key_block.column_vectors[key_idx]);
+    }
+    key_block.Finalize();
+
+    Vector<u64> hashes;
+    Vector<bool> valid;
+    JoinHashTable::HashKeys(key_block.column_vectors, row_count, hashes, valid);
+
+    // Collect the matched (probe row, build row) pairs first, then gather the output columns by column.
+    Vector<u32> probe_rows;
+    Vector<JoinRowRef> build_rows;
+    Vector<bool> matched;
+    probe_rows.reserve(row_count);
+    build_rows.reserve(row_count);
+    matched.reserve(row_count);
+    for (SizeT row = 0; row < row_count; ++row) {
+        bool found = false;
+        if (valid[row]) {
+            hash_table_->Probe(key_block.column_vectors, row, hashes[row], [&](const JoinRowRef &build_row) {
+                found = true;
+                if (join_type_ == JoinType::kSemi) {
+                    return false;
+                }
+                probe_rows.push_back(row);
+                build_rows.push_back(build_row);
+                matched.push_back(true);
+                return true;
+            });
+        }
+        if (join_type_ == JoinType::kSemi) {
+            if (found) {
+                probe_rows.push_back(row);
+                build_rows.push_back(JoinRowRef{});
+                matched.push_back(true);
+            }
+        } else if (join_type_ == JoinType::kLeft && !found) {
+            probe_rows.push_back(row);
+            build_rows.push_back(JoinRowRef{});
+            matched.push_back(false);
+        }
+    }
+
+    GatherOutput(probe_block, probe_rows, build_rows, matched, output_blocks);
+}
+
+void PhysicalHashJoin::GatherOutput(const DataBlock *probe_block,
+                                    const Vector<u32> &probe_rows,
+                                    const Vector<JoinRowRef> &build_rows,
+                                    const Vector<bool> &matched,
+                                    Vector<UniquePtr<DataBlock>> &output_blocks) const {
+    SizeT output_count = probe_rows.size();
+    if (output_count == 0) {
+        return;
+    }
+
+    SharedPtr<Vector<SharedPtr<DataType>>> output_types = GetOutputTypes();
+    SizeT probe_column_count = left_->GetOutputTypes()->size();
+    SizeT build_column_count = output_types->size() - probe_column_count;
+
+    // Null placeholders of the left join when the build row is missing.
+    Vector<const ColumnVector *> placeholders(build_column_count, nullptr);
+    if (hash_table_->BuildBlockCount() > 0) {
+        const DataBlock *first_build_block = hash_table_->GetBuildBlock(0);
+        for (SizeT column_idx = 0; column_idx < build_column_count; ++column_idx) {
+            placeholders[column_idx] = first_build_block->column_vectors[column_idx].get();
+        }
+    }
+
+    for (SizeT offset = 0; offset < output_count; offset += DEFAULT_VECTOR_SIZE) {
+        SizeT end = std::min<SizeT>(offset + DEFAULT_VECTOR_SIZE, output_count);
+        UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+        output_block->Init(*output_types);
+
+        for (SizeT column_idx = 0; column_idx < probe_column_count; ++column_idx) {
+            ColumnVector &target = *output_block->column_vectors[column_idx];
+            const ColumnVector &source = *probe_block->column_vectors[column_idx];
+            SizeT idx = offset;
+            while (idx < end) {
+                // Rows of the probe block are mostly emitted in order, copy them by runs.
+                SizeT run_end = idx + 1;
+                while (run_end < end && probe_rows[run_end] == probe_rows[run_end - 1] + 1) {
+                    ++run_end;
+                }
+                if (source.nulls_ptr_->IsAllTrue() && source.vector_type() != ColumnVectorType::kConstant) {
+                    target.AppendWith(source, probe_rows[idx], run_end - idx);
+                } else {
+                    for (SizeT pos = idx; pos < run_end; ++pos) {
+                        AppendRow(target, source, probe_rows[pos]);
+                    }
+                }
+                idx = run_end;
+            }
+        }
+
+        for (SizeT column_idx = 0; column_idx < build_column_count; ++column_idx) {
+            ColumnVector &target = *output_block->column_vectors[probe_column_count + column_idx];
+            for (SizeT pos = offset; pos < end; ++pos) {
+                if (!matched[pos]) {
+                    AppendNull(target, placeholders[column_idx]);
+                    continue;
+                }
+                const DataBlock *build_block = hash_table_->GetBuildBlock(build_rows[pos].block_id_);
+                AppendRow(target, *build_block->column_vectors[column_idx], build_rows[pos].row_id_);
+            }
+        }
+
+        output_block->Finalize();
+        output_blocks.emplace_back(std::move(output_block));
+    }
+}
 
 SharedPtr<Vector<String>> PhysicalHashJoin::GetOutputNames() const {
     SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
@@ -37,6 +221,10 @@ SharedPtr<Vector<String>> PhysicalHashJoin::GetOutputNames() const {
         result->emplace_back(name_str);
     }
 
+    if (join_type_ == JoinType::kSemi) {
+        // Semi join only outputs the rows of the left side.
+        return result;
+    }
     for (auto &name_str : *right_output_names) {
         result->emplace_back(name_str);
     }
@@ -54,6 +242,9 @@ SharedPtr<Vector<SharedPtr<DataType>>> PhysicalHashJoin::GetOutputTypes() const
         result->emplace_back(left_type);
     }
 
+    if (join_type_ == JoinType::kSemi) {
+        return result;
+    }
     for (auto &right_type : *right_output_types) {
         result->emplace_back(right_type);
     }
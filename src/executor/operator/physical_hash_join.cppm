@@ -22,18 +22,32 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
+import join_hash_table;
+import data_block;
 import load_meta;
 import infinity_exception;
 import internal_types;
+import join_reference;
 import data_type;
 import logger;
 
 namespace infinity {
 
+// Equi-join probing the hash table filled by the PhysicalHash on its right side.
+// Inner, left outer and semi joins are supported, the left side is always the probe side.
 export class PhysicalHashJoin : public PhysicalOperator {
 public:
-    explicit PhysicalHashJoin(u64 id, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kJoinHash, nullptr, nullptr, id, load_metas) {}
+    explicit PhysicalHashJoin(u64 id,
+                              JoinType join_type,
+                              Vector<SharedPtr<BaseExpression>> conditions,
+                              Vector<SharedPtr<BaseExpression>> probe_keys,
+                              SharedPtr<JoinHashTable> hash_table,
+                              UniquePtr<PhysicalOperator> left,
+                              UniquePtr<PhysicalOperator> right,
+                              SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kJoinHash, std::move(left), std::move(right), id, load_metas), join_type_(join_type),
+          conditions_(std::move(conditions)), probe_keys_(std::move(probe_keys)), hash_table_(std::move(hash_table)) {}
 
     ~PhysicalHashJoin() override = default;
 
@@ -44,6 +58,33 @@ public:
     SharedPtr<Vector<String>> GetOutputNames() const final;
 
     SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
+
+    inline JoinType join_type() const { return join_type_; }
+
+    inline const Vector<SharedPtr<BaseExpression>> &conditions() const { return conditions_; }
+
+    inline const Vector<SharedPtr<BaseExpression>> &probe_keys() const { return probe_keys_; }
+
+    inline void SetBuildFragmentID(u64 fragment_id) { build_fragment_id_ = fragment_id; }
+
+    inline u64 build_fragment_id() const { return build_fragment_id_; }
+
+private:
+    void ProbeBlock(const DataBlock *probe_block, Vector<UniquePtr<DataBlock>> &output_blocks) const;
+
+    void GatherOutput(const DataBlock *probe_block,
+                      const Vector<u32> &probe_rows,
+                      const Vector<JoinRowRef> &build_rows,
+                      const Vector<bool> &matched,
+                      Vector<UniquePtr<DataBlock>> &output_blocks) const;
+
+private:
+    JoinType join_type_{JoinType::kInner};
+    Vector<SharedPtr<BaseExpression>> conditions_{};
+    // Join keys of the probe side, column references are relative to the output of the left child.
+    Vector<SharedPtr<BaseExpression>> probe_keys_{};
+    SharedPtr<JoinHashTable> hash_table_{};
+    u64 build_fragment_id_{};
 };
 
 } // namespace infinity
@@ -68,6 +68,8 @@ import infinity_context;
 import statement_common;
 import new_txn;
 import txn_state;
+import parallel_block_parser;
+import config;
 
 namespace infinity {
 
@@ -104,6 +106,14 @@ public:
         return std::move(data_blocks_);
     }
 
+    // Take the finalized blocks, the block being filled stays.
+    Vector<SharedPtr<DataBlock>> TakeFinalizedBlocks() {
+        SizeT finalized_count = data_blocks_.size() - (CheckInit() ? 1 : 0);
+        Vector<SharedPtr<DataBlock>> blocks(data_blocks_.begin(), data_blocks_.begin() + finalized_count);
+        data_blocks_.erase(data_blocks_.begin(), data_blocks_.begin() + finalized_count);
+        return blocks;
+    }
+
     bool CheckFull() const { return cur_row_count_ >= cur_block_->capacity(); }
 
     void AddRowCnt() {
@@ -150,6 +160,70 @@ public:
     SharedPtr<String> err_msg_;
 };
 
+// Import the blocks into the transaction one segment at a time, so that only the rows of the segment being filled are held by the
+// import. The blocks are released once they are persisted.
+class NewImportSink {
+public:
+    NewImportSink(NewTxn *new_txn, const String &db_name, const String &table_name)
+        : new_txn_(new_txn), db_name_(db_name), table_name_(table_name) {}
+
+    void Append(SharedPtr<DataBlock> block) {
+        blocks_.push_back(std::move(block));
+        if (blocks_.size() == DEFAULT_BLOCK_PER_SEGMENT) {
+            Flush();
+        }
+    }
+
+    void Append(Vector<SharedPtr<DataBlock>> &blocks) {
+        for (auto &block : blocks) {
+            Append(std::move(block));
+        }
+        blocks.clear();
+    }
+
+    void Finish() {
+        // an empty import still creates its segment
+        if (!blocks_.empty() || !imported_) {
+            Flush();
+        }
+    }
+
+    const Status &status() const { return status_; }
+
+private:
+    void Flush() {
+        if (!status_.ok()) {
+            blocks_.clear();
+            return;
+        }
+        status_ = new_txn_->Import(db_name_, table_name_, blocks_);
+        imported_ = true;
+        if (status_.ok()) {
+            for (auto &block : blocks_) {
+                block->UnInit();
+            }
+        }
+        blocks_.clear();
+    }
+
+    NewTxn *new_txn_{};
+    const String &db_name_;
+    const String &table_name_;
+    Vector<SharedPtr<DataBlock>> blocks_{};
+    bool imported_{false};
+    Status status_{};
+};
+
+namespace {
+
+SizeT ImportThreadCount() {
+    const SizeT hardware_threads = std::max(Thread::hardware_concurrency(), 1u);
+    const i64 cpu_limit = InfinityContext::instance().config()->CPULimit();
+    return cpu_limit > 0 ? std::min<SizeT>(cpu_limit, hardware_threads) : hardware_threads;
+}
+
+} // namespace
+
 void PhysicalImport::Init(QueryContext *query_context) {}
 
 /**
@@ -191,19 +265,23 @@ bool PhysicalImport::Execute(QueryContext *query_context, OperatorState *operato
 
     ImportOperatorState *import_op_state = static_cast<ImportOperatorState *>(operator_state);
 
+    NewTxn *new_txn = query_context->GetNewTxn();
+    new_txn->SetTxnType(TransactionType::kImport);
+    NewImportSink import_sink(new_txn, *table_info_->db_name_, *table_info_->table_name_);
+
     Vector<SharedPtr<DataBlock>> data_blocks;
 
     switch (file_type_) {
         case CopyFileType::kCSV: {
-            NewImportCSV(query_context, import_op_state, data_blocks);
+            NewImportCSV(query_context, import_op_state, import_sink);
             break;
         }
         case CopyFileType::kJSON: {
-            NewImportJSON(query_context, import_op_state, data_blocks);
+            NewImportJSON(query_context, import_op_state, import_sink);
             break;
         }
         case CopyFileType::kJSONL: {
-            NewImportJSONL(query_context, import_op_state, data_blocks);
+            NewImportJSONL(query_context, import_op_state, import_sink);
             break;
         }
         case CopyFileType::kFVECS: {
@@ -227,11 +305,10 @@ bool PhysicalImport::Execute(QueryContext *query_context, OperatorState *operato
         }
     }
 
-    NewTxn *new_txn = query_context->GetNewTxn();
-    new_txn->SetTxnType(TransactionType::kImport);
-    Status status = new_txn->Import(*table_info_->db_name_, *table_info_->table_name_, data_blocks);
-    if (!status.ok()) {
-        import_op_state->status_ = status;
+    import_sink.Append(data_blocks);
+    import_sink.Finish();
+    if (!import_sink.status().ok()) {
+        import_op_state->status_ = import_sink.status();
     }
 
     import_op_state->SetComplete();
@@ -464,7 +541,7 @@ void PhysicalImport::NewImportCSR(QueryContext *query_context, ImportOperatorSta
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
-void PhysicalImport::NewImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state, Vector<SharedPtr<DataBlock>> &data_blocks) {
+void PhysicalImport::NewImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state, NewImportSink &import_sink) {
     FILE *fp = fopen(file_path_.c_str(), "rb");
     if (!fp) {
         UnrecoverableError(strerror(errno));
@@ -492,11 +569,13 @@ void PhysicalImport::NewImportCSV(QueryContext *query_context, ImportOperatorSta
 
     ZsvStatus csv_parser_status;
     while ((csv_parser_status = parser_context->parser_.ParseMore()) == zsv_status_ok) {
-        ;
+        // quoted fields may span lines, so the file is parsed sequentially and the parsed blocks are imported as they fill
+        Vector<SharedPtr<DataBlock>> finalized_blocks = parser_context->TakeFinalizedBlocks();
+        import_sink.Append(finalized_blocks);
     }
     parser_context->parser_.Finish();
 
-    data_blocks = std::move(*parser_context).Finalize();
+    Vector<SharedPtr<DataBlock>> data_blocks = std::move(*parser_context).Finalize();
 
     if (csv_parser_status != zsv_status_no_more_input) {
         if (parser_context->err_msg_.get() != nullptr) {
@@ -506,41 +585,52 @@ void PhysicalImport::NewImportCSV(QueryContext *query_context, ImportOperatorSta
             UnrecoverableError(err_msg);
         }
     }
+    import_sink.Append(data_blocks);
 
     import_op_state->result_msg_ = MakeUnique<String>(fmt::format("IMPORT {} Rows", parser_context->row_count()));
 }
 
-void PhysicalImport::NewImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state, Vector<SharedPtr<DataBlock>> &data_blocks) {
+void PhysicalImport::NewImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state, NewImportSink &import_sink) {
     UniquePtr<StreamReader> stream_reader = VirtualStore::OpenStreamReader(file_path_);
 
-    auto import_ctx = MakeUnique<NewImportCtx>(table_info_->column_defs_);
+    ParallelBlockParser block_parser(ImportThreadCount(), DEFAULT_IMPORT_MEMORY_BUDGET, [this](const String &chunk, SizeT row_count) {
+        return ParseJSONChunk(chunk, row_count);
+    });
 
+    // one block of lines per chunk, so that every block but the last is full
+    Vector<SharedPtr<DataBlock>> ready_blocks;
+    String chunk;
+    SizeT chunk_row_count = 0;
+    SizeT row_count = 0;
     while (true) {
         String json_str;
         if (!stream_reader->ReadLine(json_str)) {
             break;
         }
-        nlohmann::json line_json = nlohmann::json::parse(json_str);
+        chunk.append(json_str);
+        chunk.push_back('\n');
+        ++chunk_row_count;
+        ++row_count;
 
-        if (!import_ctx->CheckInit()) {
-            import_ctx->Init();
-        }
-        JSONLRowHandler(line_json, import_ctx->GetColumnVectors());
-        import_ctx->AddRowCnt();
-
-        if (import_ctx->CheckFull()) {
-            import_ctx->FinalizeBlock();
+        if (chunk_row_count == DEFAULT_BLOCK_CAPACITY) {
+            block_parser.Submit(std::move(chunk), chunk_row_count, ready_blocks);
+            chunk = String();
+            chunk_row_count = 0;
+            import_sink.Append(ready_blocks);
         }
     }
+    if (chunk_row_count > 0) {
+        block_parser.Submit(std::move(chunk), chunk_row_count, ready_blocks);
+    }
+    block_parser.Finish(ready_blocks);
+    import_sink.Append(ready_blocks);
 
-    data_blocks = std::move(*import_ctx).Finalize();
-
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", import_ctx->row_count()));
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
-void PhysicalImport::NewImportJSON(QueryContext *query_context, ImportOperatorState *import_op_state, Vector<SharedPtr<DataBlock>> &data_blocks) {
-    nlohmann::json json_arr;
+void PhysicalImport::NewImportJSON(QueryContext *query_context, ImportOperatorState *import_op_state, NewImportSink &import_sink) {
+    UniquePtr<simdjson::padded_string> json_str;
     {
         auto [file_handle, status] = VirtualStore::Open(file_path_, FileAccessMode::kRead);
         if (!status.ok()) {
@@ -551,8 +641,8 @@ void PhysicalImport::NewImportJSON(QueryContext *query_context, ImportOperatorSt
         if (file_size == -1) {
             UnrecoverableError("Can't get file size");
         }
-        String json_str(file_size, 0);
-        auto [read_n, status_read] = file_handle->Read(json_str.data(), file_size);
+        json_str = MakeUnique<simdjson::padded_string>(file_size);
+        auto [read_n, status_read] = file_handle->Read(json_str->data(), file_size);
         if (!status_read.ok()) {
             UnrecoverableError(status_read.message());
         }
@@ -566,33 +656,79 @@ void PhysicalImport::NewImportJSON(QueryContext *query_context, ImportOperatorSt
             import_op_state->result_msg_ = std::move(result_msg);
             return;
         }
-
-        json_arr = nlohmann::json::parse(json_str);
     }
-    if (!json_arr.is_array()) {
+
+    // only the array is walked here, the entries are parsed into blocks by the workers
+    simdjson::parser parser;
+    simdjson::document doc = parser.iterate(*json_str);
+    simdjson::array json_arr;
+    if (doc.get_array().get(json_arr) != simdjson::SUCCESS) {
         auto result_msg = MakeUnique<String>(fmt::format("Invalid json format, IMPORT 0 rows"));
         import_op_state->result_msg_ = std::move(result_msg);
         return;
     }
 
-    auto import_ctx = MakeUnique<NewImportCtx>(table_info_->column_defs_);
-    for (const auto &json_entry : json_arr) {
-        if (!import_ctx->CheckInit()) {
-            import_ctx->Init();
+    ParallelBlockParser block_parser(ImportThreadCount(), DEFAULT_IMPORT_MEMORY_BUDGET, [this](const String &chunk, SizeT row_count) {
+        return ParseJSONChunk(chunk, row_count);
+    });
+
+    Vector<SharedPtr<DataBlock>> ready_blocks;
+    String chunk;
+    SizeT chunk_row_count = 0;
+    SizeT row_count = 0;
+    for (auto json_entry : json_arr) {
+        std::string_view entry_str;
+        if (json_entry.raw_json().get(entry_str) != simdjson::SUCCESS) {
+            RecoverableError(Status::ImportFileFormatError(fmt::format("Invalid json entry at row {}", row_count)));
         }
-        JSONLRowHandler(json_entry, import_ctx->GetColumnVectors());
-        import_ctx->AddRowCnt();
+        // an entry may span lines, it is written as one line of the chunk
+        for (char c : entry_str) {
+            chunk.push_back(c == '\n' ? ' ' : c);
+        }
+        chunk.push_back('\n');
+        ++chunk_row_count;
+        ++row_count;
 
-        if (import_ctx->CheckFull()) {
-            import_ctx->FinalizeBlock();
+        if (chunk_row_count == DEFAULT_BLOCK_CAPACITY) {
+            block_parser.Submit(std::move(chunk), chunk_row_count, ready_blocks);
+            chunk = String();
+            chunk_row_count = 0;
+            import_sink.Append(ready_blocks);
         }
     }
-    data_blocks = std::move(*import_ctx).Finalize();
+    if (chunk_row_count > 0) {
+        block_parser.Submit(std::move(chunk), chunk_row_count, ready_blocks);
+    }
+    block_parser.Finish(ready_blocks);
+    import_sink.Append(ready_blocks);
 
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", import_ctx->row_count()));
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
+SharedPtr<DataBlock> PhysicalImport::ParseJSONChunk(const String &chunk, SizeT row_count) const {
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.reserve(table_info_->column_defs_.size());
+    for (const auto &column_def : table_info_->column_defs_) {
+        column_types.push_back(column_def->type());
+    }
+    auto data_block = MakeShared<DataBlock>();
+    data_block->Init(column_types, DEFAULT_BLOCK_CAPACITY);
+
+    SizeT line_begin = 0;
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        SizeT line_end = chunk.find('\n', line_begin);
+        if (line_end == String::npos) {
+            line_end = chunk.size();
+        }
+        nlohmann::json line_json = nlohmann::json::parse(std::string_view(chunk).substr(line_begin, line_end - line_begin));
+        JSONLRowHandler(line_json, data_block->column_vectors);
+        line_begin = line_end + 1;
+    }
+    data_block->Finalize();
+    return data_block;
+}
+
 void PhysicalImport::NewCSVHeaderHandler(void *context_raw_ptr) {
     auto *parser_context = static_cast<NewZxvParserCtx *>(context_raw_ptr);
     ZsvParser &parser = parser_context->parser_;
@@ -869,7 +1005,7 @@ SharedPtr<ConstantExpr> BuildConstantSparseExprFromJson(const nlohmann::json &js
     }
 }
 
-void PhysicalImport::JSONLRowHandler(const nlohmann::json &line_json, Vector<SharedPtr<ColumnVector>> &column_vectors) {
+void PhysicalImport::JSONLRowHandler(const nlohmann::json &line_json, Vector<SharedPtr<ColumnVector>> &column_vectors) const {
     for (SizeT i = 0; auto &column_vector_ptr : column_vectors) {
         ColumnVector &column_vector = *column_vector_ptr;
         const ColumnDef *column_def = table_info_->GetColumnDefByIdx(i++);
@@ -38,6 +38,7 @@ import meta_info;
 namespace infinity {
 
 struct DataBlock;
+class NewImportSink;
 
 export class PhysicalImport : public PhysicalOperator {
 public:
@@ -72,11 +73,11 @@ public:
                            EmbeddingDataType embedding_data_type,
                            Vector<SharedPtr<DataBlock>> &data_blocks);
 
-    void NewImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state, Vector<SharedPtr<DataBlock>> &data_blocks);
+    void NewImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state, NewImportSink &import_sink);
 
-    void NewImportJSON(QueryContext *query_context, ImportOperatorState *import_op_state, Vector<SharedPtr<DataBlock>> &data_blocks);
+    void NewImportJSON(QueryContext *query_context, ImportOperatorState *import_op_state, NewImportSink &import_sink);
 
-    void NewImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state, Vector<SharedPtr<DataBlock>> &data_blocks);
+    void NewImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state, NewImportSink &import_sink);
 
     void NewImportPARQUET(QueryContext *query_context, ImportOperatorState *import_op_state, Vector<SharedPtr<DataBlock>> &data_blocks);
 
@@ -94,7 +95,10 @@ private:
 
     static void NewCSVRowHandler(void *);
 
-    void JSONLRowHandler(const nlohmann::json &line_json, Vector<SharedPtr<ColumnVector>> &column_vectors);
+    void JSONLRowHandler(const nlohmann::json &line_json, Vector<SharedPtr<ColumnVector>> &column_vectors) const;
+
+    // Parse row_count json lines into a block, called on the import worker threads.
+    SharedPtr<DataBlock> ParseJSONChunk(const String &chunk, SizeT row_count) const;
 
     void ParquetValueHandler(const SharedPtr<arrow::Array> &array, ColumnVector &column_vector, u64 value_idx);
 
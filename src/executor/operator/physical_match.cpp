@@ -68,6 +68,7 @@ import cached_match;
 import filter_iterator;
 import score_threshold_iterator;
 import new_txn;
+import infinity_context;
 
 namespace infinity {
 
@@ -160,12 +161,13 @@ u32 ExecuteFTSearch(DocIterator *iter, FullTextScoreResultHeap &result_heap) {
     return loop_cnt;
 }
 
-auto ExecuteFTSearch(const QueryIterators &query_iterators, const u32 topn) {
-    struct FTSearchResultType {
-        u32 result_count{};
-        UniquePtr<float[]> score_result{};
-        UniquePtr<RowID[]> row_id_result{};
-    };
+struct FTSearchResultType {
+    u32 result_count{};
+    UniquePtr<float[]> score_result{};
+    UniquePtr<RowID[]> row_id_result{};
+};
+
+FTSearchResultType ExecuteFTSearch(const QueryIterators &query_iterators, const u32 topn) {
     auto GetFTSearchResult = [topn](const UniquePtr<DocIterator> &iter) {
         FTSearchResultType result;
         result.score_result = MakeUniqueForOverwrite<float[]>(topn);
@@ -230,6 +232,112 @@ auto ExecuteFTSearch(const QueryIterators &query_iterators, const u32 topn) {
     return bmw_result;
 }
 
+// Search the docs in [begin, end) of the iterator. The threshold of the result heap is published to shared_threshold, and the
+// threshold published by the other partitions of the query is applied to the iterator: the n-th score of any partition is a lower
+// bound of the n-th score of the whole table.
+u32 ExecuteFTSearch(DocIterator *iter, FullTextScoreResultHeap &result_heap, const RowID begin, const RowID end, Atomic<float> &shared_threshold) {
+    u32 loop_cnt = 0;
+    // iter is nullptr if fulltext index is present but there's no data
+    if (!iter) {
+        LOG_DEBUG("iter is nullptr");
+        return loop_cnt;
+    }
+    float applied_threshold = 0.0f;
+    for (bool has_next = iter->Next(begin); has_next && iter->DocID() < end; has_next = iter->Next()) {
+        ++loop_cnt;
+        if (result_heap.AddResult(iter->Score(), iter->DocID())) {
+            const float threshold = result_heap.GetScoreThreshold();
+            float published = shared_threshold.load(std::memory_order_relaxed);
+            while (threshold > published && !shared_threshold.compare_exchange_weak(published, threshold, std::memory_order_relaxed)) {
+            }
+        }
+        if (const float threshold = shared_threshold.load(std::memory_order_relaxed); threshold > applied_threshold) {
+            applied_threshold = threshold;
+            iter->UpdateScoreThreshold(threshold);
+        }
+    }
+    return loop_cnt;
+}
+
+// Split the table into ranges of whole segments holding about the same rows. Empty if the table is too small to be worth splitting.
+Vector<Pair<RowID, RowID>> PartitionBySegment(const BlockIndex *block_index, const SizeT max_partition_count, const SizeT min_partition_row_count) {
+    SizeT total_row_cnt = 0;
+    for (const auto &[segment_id, _] : block_index->new_segment_block_index_) {
+        total_row_cnt += block_index->GetSegmentOffset(segment_id);
+    }
+    const SizeT partition_count =
+        std::min({max_partition_count, block_index->SegmentCount(), total_row_cnt / min_partition_row_count});
+    if (partition_count <= 1) {
+        return {};
+    }
+    const SizeT partition_row_cnt = (total_row_cnt + partition_count - 1) / partition_count;
+    Vector<Pair<RowID, RowID>> ranges;
+    RowID begin(0, 0);
+    SizeT row_cnt = 0;
+    for (const auto &[segment_id, _] : block_index->new_segment_block_index_) {
+        if (row_cnt >= partition_row_cnt) {
+            ranges.emplace_back(begin, RowID(segment_id, 0));
+            begin = RowID(segment_id, 0);
+            row_cnt = 0;
+        }
+        row_cnt += block_index->GetSegmentOffset(segment_id);
+    }
+    ranges.emplace_back(begin, INVALID_ROWID);
+    return ranges;
+}
+
+// Search the ranges concurrently, each with its own iterator tree, and merge their top n.
+FTSearchResultType ExecutePartitionedFTSearch(QueryBuilder &query_builder,
+                                              FullTextQueryContext &context,
+                                              const EarlyTermAlgo early_term_algo,
+                                              const float begin_threshold,
+                                              const float score_threshold,
+                                              const Vector<Pair<RowID, RowID>> &ranges,
+                                              const u32 topn) {
+    const SizeT partition_count = ranges.size();
+    Vector<UniquePtr<DocIterator>> iters;
+    iters.reserve(partition_count);
+    for (SizeT i = 0; i < partition_count; ++i) {
+        iters.push_back(std::move(CreateQueryIterators(query_builder, context, early_term_algo, begin_threshold, score_threshold).query_iter));
+    }
+
+    Vector<FTSearchResultType> partition_results(partition_count);
+    Atomic<float> shared_threshold{0.0f};
+    auto &thread_pool = InfinityContext::instance().GetFulltextSearchThreadPool();
+    Vector<std::future<void>> futs;
+    futs.reserve(partition_count);
+    for (SizeT i = 0; i < partition_count; ++i) {
+        futs.emplace_back(thread_pool.push([&, i](int) {
+            FTSearchResultType &result = partition_results[i];
+            result.score_result = MakeUniqueForOverwrite<float[]>(topn);
+            result.row_id_result = MakeUniqueForOverwrite<RowID[]>(topn);
+            FullTextScoreResultHeap result_heap(topn, result.score_result.get(), result.row_id_result.get());
+            ExecuteFTSearch(iters[i].get(), result_heap, ranges[i].first, ranges[i].second, shared_threshold);
+            result.result_count = result_heap.GetResultSize();
+        }));
+    }
+    // all partitions finish before an error is rethrown, they use the iterators and results here
+    for (auto &fut : futs) {
+        fut.wait();
+    }
+    for (auto &fut : futs) {
+        fut.get();
+    }
+
+    FTSearchResultType result;
+    result.score_result = MakeUniqueForOverwrite<float[]>(topn);
+    result.row_id_result = MakeUniqueForOverwrite<RowID[]>(topn);
+    FullTextScoreResultHeap result_heap(topn, result.score_result.get(), result.row_id_result.get());
+    for (const auto &partition_result : partition_results) {
+        for (u32 i = 0; i < partition_result.result_count; ++i) {
+            result_heap.AddResult(partition_result.score_result[i], partition_result.row_id_result[i]);
+        }
+    }
+    result_heap.Sort();
+    result.result_count = result_heap.GetResultSize();
+    return result;
+}
+
 bool PhysicalMatch::ExecuteInner(QueryContext *query_context, OperatorState *operator_state) {
     if (!common_query_filter_) {
         UnrecoverableError(fmt::format("{}: common_query_filter_ is nullptr", __func__));
@@ -251,13 +359,30 @@ bool PhysicalMatch::ExecuteInner(QueryContext *query_context, OperatorState *ope
                                                  top_n_,
                                                  match_expr_->index_names_);
     full_text_query_context.query_tree_ = MakeUnique<FilterQueryNode>(common_query_filter_.get(), std::move(query_tree_));
-    const auto query_iterators = CreateQueryIterators(query_builder, full_text_query_context, early_term_algo_, begin_threshold_, score_threshold_);
+    Vector<Pair<RowID, RowID>> partition_ranges;
+    if (early_term_algo_ != EarlyTermAlgo::kCompare) {
+        partition_ranges = PartitionBySegment(base_table_ref_->block_index_.get(),
+                                              InfinityContext::instance().GetFulltextSearchThreadPool().size(),
+                                              partition_min_row_count_);
+    }
+    QueryIterators query_iterators;
+    if (partition_ranges.empty()) {
+        query_iterators = CreateQueryIterators(query_builder, full_text_query_context, early_term_algo_, begin_threshold_, score_threshold_);
+    }
     const auto finish_query_builder_time = std::chrono::high_resolution_clock::now();
     LOG_DEBUG(fmt::format("PhysicalMatch Part 2: Build Query iterator time: {} ms",
                           static_cast<TimeDurationType>(finish_query_builder_time - finish_init_query_builder_time).count()));
 
-    // 3 full text search
-    const auto [result_count, score_result, row_id_result] = ExecuteFTSearch(query_iterators, top_n_);
+    // 3 full text search, the iterators of the partitions are built here
+    const auto [result_count, score_result, row_id_result] =
+        partition_ranges.empty() ? ExecuteFTSearch(query_iterators, top_n_)
+                                 : ExecutePartitionedFTSearch(query_builder,
+                                                              full_text_query_context,
+                                                              early_term_algo_,
+                                                              begin_threshold_,
+                                                              score_threshold_,
+                                                              partition_ranges,
+                                                              top_n_);
     auto finish_query_time = std::chrono::high_resolution_clock::now();
     LOG_DEBUG(fmt::format("PhysicalMatch Part 3: Full text search time: {} ms",
                           static_cast<TimeDurationType>(finish_query_time - finish_query_builder_time).count()));
@@ -337,6 +462,7 @@ PhysicalMatch::PhysicalMatch(const u64 id,
                              const f32 score_threshold,
                              const FulltextSimilarity ft_similarity,
                              const BM25Params &bm25_params,
+                             const SizeT partition_min_row_count,
                              const u64 match_table_index,
                              SharedPtr<Vector<LoadMeta>> load_metas,
                              const bool cache_result)
@@ -345,7 +471,7 @@ PhysicalMatch::PhysicalMatch(const u64 id,
       query_tree_(std::move(query_tree)), begin_threshold_(begin_threshold), early_term_algo_(early_term_algo), top_n_(top_n),
       common_query_filter_(common_query_filter), minimum_should_match_option_(std::move(minimum_should_match_option)),
       rank_features_option_(std::move(rank_features_option)), score_threshold_(score_threshold), ft_similarity_(ft_similarity),
-      bm25_params_(bm25_params) {}
+      bm25_params_(bm25_params), partition_min_row_count_(partition_min_row_count) {}
 
 PhysicalMatch::~PhysicalMatch() = default;
 
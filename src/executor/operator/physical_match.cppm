@@ -58,6 +58,7 @@ public:
                            f32 score_threshold,
                            FulltextSimilarity ft_similarity,
                            const BM25Params &bm25_params,
+                           SizeT partition_min_row_count,
                            u64 match_table_index,
                            SharedPtr<Vector<LoadMeta>> load_metas,
                            bool cache_result);
@@ -118,6 +119,8 @@ private:
     f32 score_threshold_{};
     FulltextSimilarity ft_similarity_{FulltextSimilarity::kBM25};
     BM25Params bm25_params_;
+    // a table is split into partitions searched concurrently when each holds at least this many rows
+    SizeT partition_min_row_count_{};
 
     bool ExecuteInner(QueryContext *query_context, OperatorState *operator_state);
 };
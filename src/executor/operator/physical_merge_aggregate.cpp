@@ -14,6 +14,7 @@
 
 module;
 
+#include <future>
 #include <string>
 #include <vector>
 
@@ -23,7 +24,6 @@ import third_party;
 import query_context;
 import operator_state;
 import logger;
-import value;
 import data_block;
 import logical_type;
 import physical_aggregate;
@@ -32,6 +32,9 @@ import infinity_exception;
 import hash_table;
 import column_def;
 import column_vector;
+import data_type;
+import default_values;
+import infinity_context;
 
 namespace infinity {
 
@@ -53,6 +56,9 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
     if (merge_aggregate_op_state->input_complete_) {
 
         LOG_TRACE("PhysicalMergeAggregate::Input is complete");
+        if (agg_op->groups_.size() != 0) {
+            MergeGroupPartitions(merge_aggregate_op_state);
+        }
         for (auto &output_block : merge_aggregate_op_state->data_block_array_) {
             output_block->Finalize();
         }
@@ -67,16 +73,14 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
 void PhysicalMergeAggregate::GroupByMergeAggregateExecute(MergeAggregateOperatorState *op_state) {
     auto *agg_op = static_cast<PhysicalAggregate *>(this->left());
     SizeT group_count = agg_op->groups_.size();
-    MergeHashTable &hash_table = op_state->hash_table_;
+    HashTable &hash_table = op_state->hash_table_;
 
     auto &input_block = op_state->input_data_block_;
     if (!hash_table.Initialized()) {
         Vector<SharedPtr<DataType>> groupby_types;
         groupby_types.reserve(group_count);
-        for (i64 idx = 0; auto &expr : agg_op->groups_) {
-            SharedPtr<ColumnDef> col_def = MakeShared<ColumnDef>(idx, MakeShared<DataType>(expr->Type()), expr->Name(), std::set<ConstraintType>());
+        for (auto &expr : agg_op->groups_) {
             groupby_types.emplace_back(MakeShared<DataType>(expr->Type()));
-            ++idx;
         }
 
         hash_table.Init(groupby_types);
@@ -86,28 +90,126 @@ void PhysicalMergeAggregate::GroupByMergeAggregateExecute(MergeAggregateOperator
         return;
     }
 
+    // Only partition the rows here, the merge itself runs once all partial results have arrived.
     Vector<SharedPtr<ColumnVector>> input_groupby_columns(input_block->column_vectors.begin(), input_block->column_vectors.begin() + group_count);
-    if (op_state->data_block_array_.empty()) {
-        hash_table.Append(input_groupby_columns, 0, input_block->row_count());
-        op_state->data_block_array_.emplace_back(std::move(input_block));
-        LOG_TRACE("Physical MergeAggregate execute first block");
+    Vector<u8> &partitions = op_state->partial_partitions_.emplace_back();
+    hash_table.PartitionKeys(input_groupby_columns, input_block->row_count(), partitions);
+    op_state->partial_blocks_.emplace_back(std::move(input_block));
+}
+
+void PhysicalMergeAggregate::MergeGroupPartitions(MergeAggregateOperatorState *op_state) {
+    const auto &partial_blocks = op_state->partial_blocks_;
+    const auto &partial_partitions = op_state->partial_partitions_;
+    if (partial_blocks.empty()) {
         return;
     }
+    const Vector<SharedPtr<DataType>> groupby_types = op_state->hash_table_.types_;
+    const Vector<SharedPtr<DataType>> types = partial_blocks[0]->types();
+
+    SizeT input_row_count = 0;
+    for (const auto &partial_block : partial_blocks) {
+        input_row_count += partial_block->row_count();
+    }
+    ThreadPool &thread_pool = InfinityContext::instance().GetAggregateMergeThreadPool();
+    SizeT range_count = std::min<SizeT>(thread_pool.size(), HashTableBase::kPartitionCount);
+    if (input_row_count <= DEFAULT_VECTOR_SIZE || range_count == 0) {
+        range_count = 1;
+    }
 
-    DataBlock *last_data_block = op_state->data_block_array_.back().get();
-    for (SizeT row_id = 0; row_id < input_block->row_count(); ++row_id) {
-        if (last_data_block->available_capacity() == 0) {
-            Vector<SharedPtr<DataType>> types = last_data_block->types();
-            op_state->data_block_array_.emplace_back(DataBlock::MakeUniquePtr());
-            last_data_block = op_state->data_block_array_.back().get();
-            last_data_block->Init(std::move(types), input_block->capacity());
+    Vector<Vector<UniquePtr<DataBlock>>> range_output_blocks(range_count);
+    auto merge_range = [&](SizeT range_idx) {
+        const SizeT partition_begin = HashTableBase::kPartitionCount * range_idx / range_count;
+        const SizeT partition_end = HashTableBase::kPartitionCount * (range_idx + 1) / range_count;
+        auto in_range = [&](u8 partition) { return partition >= partition_begin && partition < partition_end; };
+
+        HashTable hash_table;
+        hash_table.Init(groupby_types);
+        SizeT output_row_count = 0;
+        for (SizeT block_idx = 0; block_idx < partial_blocks.size(); ++block_idx) {
+            const DataBlock *partial_block = partial_blocks[block_idx].get();
+            const Vector<u8> &partitions = partial_partitions[block_idx];
+            SizeT row_count = partial_block->row_count();
+            const DataBlock *input_block = partial_block;
+            UniquePtr<DataBlock> range_block;
+            if (range_count > 1) {
+                // The aggregate tasks emit their groups ordered by partition, so the rows of a range come in a few runs.
+                range_block = DataBlock::MakeUniquePtr();
+                range_block->Init(types);
+                SizeT row = 0;
+                while (row < row_count) {
+                    if (!in_range(partitions[row])) {
+                        ++row;
+                        continue;
+                    }
+                    SizeT run_end = row + 1;
+                    while (run_end < row_count && in_range(partitions[run_end])) {
+                        ++run_end;
+                    }
+                    range_block->AppendWith(partial_block, row, run_end - row);
+                    row = run_end;
+                }
+                range_block->Finalize();
+                if (range_block->row_count() == 0) {
+                    continue;
+                }
+                input_block = range_block.get();
+            }
+            MergeGroups(input_block, hash_table, range_output_blocks[range_idx], output_row_count);
         }
-        Pair<SizeT, SizeT> block_row_id = {op_state->data_block_array_.size() - 1, last_data_block->row_count()};
-        bool found = hash_table.GetOrInsert(input_groupby_columns, row_id, block_row_id);
-        if (!found) {
-            last_data_block->AppendWith(input_block.get(), row_id, 1);
+    };
+
+    if (range_count == 1) {
+        merge_range(0);
+    } else {
+        Vector<std::future<void>> futs;
+        futs.reserve(range_count);
+        for (SizeT range_idx = 0; range_idx < range_count; ++range_idx) {
+            futs.emplace_back(thread_pool.push([&merge_range, range_idx](int) { merge_range(range_idx); }));
+        }
+        // wait for every range before get() may rethrow, the tasks reference this frame
+        for (auto &fut : futs) {
+            fut.wait();
+        }
+        for (auto &fut : futs) {
+            fut.get();
+        }
+    }
+
+    for (auto &output_blocks : range_output_blocks) {
+        for (auto &output_block : output_blocks) {
+            op_state->data_block_array_.emplace_back(std::move(output_block));
+        }
+    }
+    op_state->partial_blocks_.clear();
+    op_state->partial_partitions_.clear();
+}
+
+void PhysicalMergeAggregate::MergeGroups(const DataBlock *input_block,
+                                         HashTable &hash_table,
+                                         Vector<UniquePtr<DataBlock>> &output_blocks,
+                                         SizeT &output_row_count) {
+    auto *agg_op = static_cast<PhysicalAggregate *>(this->left());
+    SizeT group_count = agg_op->groups_.size();
+
+    // Each partial result block comes from one aggregate task, which has already merged the rows of its own input. The groups
+    // are kept in insertion order here, so the group id is also the position of the group in the output blocks.
+    Vector<SharedPtr<ColumnVector>> input_groupby_columns(input_block->column_vectors.begin(), input_block->column_vectors.begin() + group_count);
+    SizeT input_row_count = input_block->row_count();
+    Vector<u32> group_ids;
+    hash_table.Append(input_groupby_columns, input_row_count, group_ids);
+
+    for (SizeT row_id = 0; row_id < input_row_count; ++row_id) {
+        SizeT group_id = group_ids[row_id];
+        if (group_id == output_row_count) {
+            if (output_blocks.empty() || output_blocks.back()->available_capacity() == 0) {
+                output_blocks.emplace_back(DataBlock::MakeUniquePtr());
+                output_blocks.back()->Init(input_block->types());
+            }
+            output_blocks.back()->AppendWith(input_block, row_id, 1);
+            ++output_row_count;
             continue;
         }
+        Pair<SizeT, SizeT> block_row_id = {group_id / DEFAULT_VECTOR_SIZE, group_id % DEFAULT_VECTOR_SIZE};
         SizeT agg_count = agg_op->aggregates_.size();
         Pair<SizeT, SizeT> input_block_row_id = {0, row_id};
         for (SizeT col_idx = group_count; col_idx < group_count + agg_count; ++col_idx) {
@@ -120,27 +222,27 @@ void PhysicalMergeAggregate::GroupByMergeAggregateExecute(MergeAggregateOperator
             switch (func_return_type.type()) {
                 LOG_TRACE("Physical MergeAggregate execute remain block");
                 case LogicalType::kTinyInt: {
-                    HandleAggregateFunction<TinyIntT>(function_name, op_state, col_idx, input_block_row_id, block_row_id);
+                    HandleAggregateFunction<TinyIntT>(function_name, input_block, output_blocks, col_idx, input_block_row_id, block_row_id);
                     break;
                 }
                 case LogicalType::kSmallInt: {
-                    HandleAggregateFunction<SmallIntT>(function_name, op_state, col_idx, input_block_row_id, block_row_id);
+                    HandleAggregateFunction<SmallIntT>(function_name, input_block, output_blocks, col_idx, input_block_row_id, block_row_id);
                     break;
                 }
                 case LogicalType::kInteger: {
-                    HandleAggregateFunction<IntegerT>(function_name, op_state, col_idx, input_block_row_id, block_row_id);
+                    HandleAggregateFunction<IntegerT>(function_name, input_block, output_blocks, col_idx, input_block_row_id, block_row_id);
                     break;
                 }
                 case LogicalType::kBigInt: {
-                    HandleAggregateFunction<BigIntT>(function_name, op_state, col_idx, input_block_row_id, block_row_id);
+                    HandleAggregateFunction<BigIntT>(function_name, input_block, output_blocks, col_idx, input_block_row_id, block_row_id);
                     break;
                 }
                 case LogicalType::kFloat: {
-                    HandleAggregateFunction<FloatT>(function_name, op_state, col_idx, input_block_row_id, block_row_id);
+                    HandleAggregateFunction<FloatT>(function_name, input_block, output_blocks, col_idx, input_block_row_id, block_row_id);
                     break;
                 }
                 case LogicalType::kDouble: {
-                    HandleAggregateFunction<DoubleT>(function_name, op_state, col_idx, input_block_row_id, block_row_id);
+                    HandleAggregateFunction<DoubleT>(function_name, input_block, output_blocks, col_idx, input_block_row_id, block_row_id);
                     break;
                 }
                 default: {
@@ -169,27 +271,27 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
             switch (func_return_type.type()) {
                 LOG_TRACE("Physical MergeAggregate execute remain block");
                 case LogicalType::kTinyInt: {
-                    HandleAggregateFunction<TinyIntT>(function_name, op_state, col_idx);
+                    HandleAggregateFunction<TinyIntT>(function_name, op_state->input_data_block_.get(), op_state->data_block_array_, col_idx);
                     break;
                 }
                 case LogicalType::kSmallInt: {
-                    HandleAggregateFunction<SmallIntT>(function_name, op_state, col_idx);
+                    HandleAggregateFunction<SmallIntT>(function_name, op_state->input_data_block_.get(), op_state->data_block_array_, col_idx);
                     break;
                 }
                 case LogicalType::kInteger: {
-                    HandleAggregateFunction<IntegerT>(function_name, op_state, col_idx);
+                    HandleAggregateFunction<IntegerT>(function_name, op_state->input_data_block_.get(), op_state->data_block_array_, col_idx);
                     break;
                 }
                 case LogicalType::kBigInt: {
-                    HandleAggregateFunction<BigIntT>(function_name, op_state, col_idx);
+                    HandleAggregateFunction<BigIntT>(function_name, op_state->input_data_block_.get(), op_state->data_block_array_, col_idx);
                     break;
                 }
                 case LogicalType::kFloat: {
-                    HandleAggregateFunction<FloatT>(function_name, op_state, col_idx);
+                    HandleAggregateFunction<FloatT>(function_name, op_state->input_data_block_.get(), op_state->data_block_array_, col_idx);
                     break;
                 }
                 case LogicalType::kDouble: {
-                    HandleAggregateFunction<DoubleT>(function_name, op_state, col_idx);
+                    HandleAggregateFunction<DoubleT>(function_name, op_state->input_data_block_.get(), op_state->data_block_array_, col_idx);
                     break;
                 }
                 default: {
@@ -203,20 +305,21 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
 
 template <typename T>
 void PhysicalMergeAggregate::HandleAggregateFunction(const String &function_name,
-                                                     MergeAggregateOperatorState *op_state,
+                                                     const DataBlock *input_block,
+                                                     Vector<UniquePtr<DataBlock>> &output_blocks,
                                                      SizeT col_idx,
                                                      const Pair<SizeT, SizeT> &input_block_row_id,
                                                      const Pair<SizeT, SizeT> &output_block_row_id) {
     LOG_TRACE(function_name);
     if (function_name == "COUNT") {
         LOG_TRACE("COUNT");
-        HandleCount<T>(op_state, col_idx, input_block_row_id, output_block_row_id);
+        HandleCount<T>(input_block, output_blocks, col_idx, input_block_row_id, output_block_row_id);
     } else if (function_name == "MIN") {
-        HandleMin<T>(op_state, col_idx, input_block_row_id, output_block_row_id);
+        HandleMin<T>(input_block, output_blocks, col_idx, input_block_row_id, output_block_row_id);
     } else if (function_name == "MAX") {
-        HandleMax<T>(op_state, col_idx, input_block_row_id, output_block_row_id);
+        HandleMax<T>(input_block, output_blocks, col_idx, input_block_row_id, output_block_row_id);
     } else if (function_name == "SUM") {
-        HandleSum<T>(op_state, col_idx, input_block_row_id, output_block_row_id);
+        HandleSum<T>(input_block, output_blocks, col_idx, input_block_row_id, output_block_row_id);
     } else if (function_name == "COUNT_STAR") {
         // no action for "COUNT_STAR"
     } else {
@@ -226,70 +329,73 @@ void PhysicalMergeAggregate::HandleAggregateFunction(const String &function_name
 }
 
 template <typename T>
-void PhysicalMergeAggregate::HandleMin(MergeAggregateOperatorState *op_state,
+void PhysicalMergeAggregate::HandleMin(const DataBlock *input_block,
+                                       Vector<UniquePtr<DataBlock>> &output_blocks,
                                        SizeT col_idx,
                                        const Pair<SizeT, SizeT> &input_block_row_id,
                                        const Pair<SizeT, SizeT> &output_block_row_id) {
     MathOperation<T> minOperation = [](T a, T b) -> T { return (a < b) ? a : b; };
-    UpdateData<T>(op_state, minOperation, col_idx, input_block_row_id, output_block_row_id);
+    UpdateData<T>(input_block, output_blocks, minOperation, col_idx, input_block_row_id, output_block_row_id);
 }
 
 template <typename T>
-void PhysicalMergeAggregate::HandleMax(MergeAggregateOperatorState *op_state,
+void PhysicalMergeAggregate::HandleMax(const DataBlock *input_block,
+                                       Vector<UniquePtr<DataBlock>> &output_blocks,
                                        SizeT col_idx,
                                        const Pair<SizeT, SizeT> &input_block_row_id,
                                        const Pair<SizeT, SizeT> &output_block_row_id) {
     MathOperation<T> maxOperation = [](T a, T b) -> T { return (a > b) ? a : b; };
-    UpdateData<T>(op_state, maxOperation, col_idx, input_block_row_id, output_block_row_id);
+    UpdateData<T>(input_block, output_blocks, maxOperation, col_idx, input_block_row_id, output_block_row_id);
 }
 
 template <typename T>
-void PhysicalMergeAggregate::HandleCount(MergeAggregateOperatorState *op_state,
+void PhysicalMergeAggregate::HandleCount(const DataBlock *input_block,
+                                         Vector<UniquePtr<DataBlock>> &output_blocks,
                                          SizeT col_idx,
                                          const Pair<SizeT, SizeT> &input_block_row_id,
                                          const Pair<SizeT, SizeT> &output_block_row_id) {
     MathOperation<T> countOperation = [](T a, T b) -> T { return a + b; };
-    UpdateData<T>(op_state, countOperation, col_idx, input_block_row_id, output_block_row_id);
+    UpdateData<T>(input_block, output_blocks, countOperation, col_idx, input_block_row_id, output_block_row_id);
 }
 
 template <typename T>
-void PhysicalMergeAggregate::HandleSum(MergeAggregateOperatorState *op_state,
+void PhysicalMergeAggregate::HandleSum(const DataBlock *input_block,
+                                       Vector<UniquePtr<DataBlock>> &output_blocks,
                                        SizeT col_idx,
                                        const Pair<SizeT, SizeT> &input_block_row_id,
                                        const Pair<SizeT, SizeT> &output_block_row_id) {
     MathOperation<T> sumOperation = [](T a, T b) -> T { return a + b; };
-    UpdateData<T>(op_state, sumOperation, col_idx, input_block_row_id, output_block_row_id);
+    UpdateData<T>(input_block, output_blocks, sumOperation, col_idx, input_block_row_id, output_block_row_id);
 }
 
 template <typename T>
-T PhysicalMergeAggregate::GetInputData(MergeAggregateOperatorState *op_state, SizeT block_index, SizeT col_idx, SizeT row_idx) {
-    Value value = op_state->input_data_block_->GetValue(col_idx, row_idx);
-    return value.GetValue<T>();
+T PhysicalMergeAggregate::GetInputData(const DataBlock *input_block, SizeT col_idx, SizeT row_idx) {
+    return reinterpret_cast<const T *>(input_block->column_vectors[col_idx]->data())[row_idx];
 }
 
 template <typename T>
-T PhysicalMergeAggregate::GetOutputData(MergeAggregateOperatorState *op_state, SizeT block_index, SizeT col_idx, SizeT row_idx) {
-    Value value = op_state->data_block_array_[block_index]->GetValue(col_idx, row_idx);
-    return value.GetValue<T>();
+T PhysicalMergeAggregate::GetOutputData(const Vector<UniquePtr<DataBlock>> &output_blocks, SizeT block_index, SizeT col_idx, SizeT row_idx) {
+    return reinterpret_cast<const T *>(output_blocks[block_index]->column_vectors[col_idx]->data())[row_idx];
 }
 
 template <typename T>
-void PhysicalMergeAggregate::WriteValueAtPosition(MergeAggregateOperatorState *op_state, SizeT block_index, SizeT col_idx, SizeT row_idx, T value) {
-    op_state->data_block_array_[block_index]->SetValue(col_idx, row_idx, CreateValue(value));
+void PhysicalMergeAggregate::WriteValueAtPosition(Vector<UniquePtr<DataBlock>> &output_blocks, SizeT block_index, SizeT col_idx, SizeT row_idx, T value) {
+    reinterpret_cast<T *>(output_blocks[block_index]->column_vectors[col_idx]->data())[row_idx] = value;
 }
 
 template <typename T>
-void PhysicalMergeAggregate::UpdateData(MergeAggregateOperatorState *op_state,
+void PhysicalMergeAggregate::UpdateData(const DataBlock *input_block,
+                                        Vector<UniquePtr<DataBlock>> &output_blocks,
                                         MathOperation<T> operation,
                                         SizeT col_idx,
                                         const Pair<SizeT, SizeT> &input_block_row_id,
                                         const Pair<SizeT, SizeT> &output_block_row_id) {
     const auto &[input_block_id, input_row_id] = input_block_row_id;
     const auto &[output_block_id, output_row_id] = output_block_row_id;
-    T input = GetInputData<T>(op_state, input_block_id, col_idx, input_row_id);
-    T output = GetOutputData<T>(op_state, output_block_id, col_idx, output_row_id);
+    T input = GetInputData<T>(input_block, col_idx, input_row_id);
+    T output = GetOutputData<T>(output_blocks, output_block_id, col_idx, output_row_id);
     T new_value = operation(input, output);
-    WriteValueAtPosition<T>(op_state, output_block_id, col_idx, output_row_id, new_value);
+    WriteValueAtPosition<T>(output_blocks, output_block_id, col_idx, output_row_id, new_value);
 }
 
 } // namespace infinity
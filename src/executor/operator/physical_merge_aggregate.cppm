@@ -24,8 +24,8 @@ import physical_operator;
 import physical_operator_type;
 
 import infinity_exception;
-import value;
 import data_block;
+import hash_table;
 import stl;
 
 import internal_types;
@@ -56,10 +56,10 @@ public:
     inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
 
     template <typename T>
-    T GetInputData(MergeAggregateOperatorState *op_state, SizeT block_index, SizeT col_idx, SizeT row_idx);
+    T GetInputData(const DataBlock *input_block, SizeT col_idx, SizeT row_idx);
 
     template <typename T>
-    T GetOutputData(MergeAggregateOperatorState *op_state, SizeT block_index, SizeT col_idx, SizeT row_idx);
+    T GetOutputData(const Vector<UniquePtr<DataBlock>> &output_blocks, SizeT block_index, SizeT col_idx, SizeT row_idx);
 
     template <typename T>
     using MathOperation = std::function<T(T, T)>;
@@ -68,83 +68,59 @@ public:
 
     void GroupByMergeAggregateExecute(MergeAggregateOperatorState *merge_aggregate_op_state);
 
+    // Merge the buffered partial results, one task per range of hash table partitions. Groups of different partitions never
+    // meet, so each range is merged into its own hash table and output blocks.
+    void MergeGroupPartitions(MergeAggregateOperatorState *merge_aggregate_op_state);
+
+    void MergeGroups(const DataBlock *input_block, HashTable &hash_table, Vector<UniquePtr<DataBlock>> &output_blocks, SizeT &output_row_count);
+
     template <typename T>
-    void UpdateData(MergeAggregateOperatorState *op_state,
+    void UpdateData(const DataBlock *input_block,
+                    Vector<UniquePtr<DataBlock>> &output_blocks,
                     MathOperation<T> operation,
                     SizeT col_idx,
                     const Pair<SizeT, SizeT> &input_block_row_id,
                     const Pair<SizeT, SizeT> &output_block_row_id);
 
     template <typename T>
-    void WriteValueAtPosition(MergeAggregateOperatorState *op_state, SizeT block_index, SizeT col_idx, SizeT row_idx, T value);
+    void WriteValueAtPosition(Vector<UniquePtr<DataBlock>> &output_blocks, SizeT block_index, SizeT col_idx, SizeT row_idx, T value);
 
     template <typename T>
-    void HandleSum(MergeAggregateOperatorState *op_state,
+    void HandleSum(const DataBlock *input_block,
+                   Vector<UniquePtr<DataBlock>> &output_blocks,
                    SizeT col_idx,
                    const Pair<SizeT, SizeT> &input_block_row_id,
                    const Pair<SizeT, SizeT> &output_block_row_id);
 
     template <typename T>
-    void HandleCount(MergeAggregateOperatorState *op_state,
+    void HandleCount(const DataBlock *input_block,
+                     Vector<UniquePtr<DataBlock>> &output_blocks,
                      SizeT col_idx,
                      const Pair<SizeT, SizeT> &input_block_row_id,
                      const Pair<SizeT, SizeT> &output_block_row_id);
 
     template <typename T>
-    void HandleMin(MergeAggregateOperatorState *op_state,
+    void HandleMin(const DataBlock *input_block,
+                   Vector<UniquePtr<DataBlock>> &output_blocks,
                    SizeT col_idx,
                    const Pair<SizeT, SizeT> &input_block_row_id,
                    const Pair<SizeT, SizeT> &output_block_row_id);
 
     template <typename T>
-    void HandleMax(MergeAggregateOperatorState *op_state,
+    void HandleMax(const DataBlock *input_block,
+                   Vector<UniquePtr<DataBlock>> &output_blocks,
                    SizeT col_idx,
                    const Pair<SizeT, SizeT> &input_block_row_id,
                    const Pair<SizeT, SizeT> &output_block_row_id);
 
     template <typename T>
     void HandleAggregateFunction(const String &function_name,
-                                 MergeAggregateOperatorState *op_state,
+                                 const DataBlock *input_block,
+                                 Vector<UniquePtr<DataBlock>> &output_blocks,
                                  SizeT col_idx,
                                  const Pair<SizeT, SizeT> &input_block_row_id = {0, 0},
                                  const Pair<SizeT, SizeT> &output_block_row_id = {0, 0});
 
-    template <typename T>
-    Value CreateValue(T value) {
-        String error_message = "Unhandled type for makeValue";
-        UnrecoverableError(error_message);
-    }
-
-    template <>
-    Value CreateValue<IntegerT>(IntegerT value) {
-        return Value::MakeInt(value);
-    }
-
-    template <>
-    Value CreateValue<BigIntT>(BigIntT value) {
-        return Value::MakeBigInt(value);
-    }
-
-    template <>
-    Value CreateValue<DoubleT>(DoubleT value) {
-        return Value::MakeDouble(value);
-    }
-
-    template <>
-    Value CreateValue<FloatT>(FloatT value) {
-        return Value::MakeFloat(value);
-    }
-
-    template <>
-    Value CreateValue<TinyIntT>(TinyIntT value) {
-        return Value::MakeTinyInt(value);
-    }
-
-    template <>
-    Value CreateValue<SmallIntT>(SmallIntT value) {
-        return Value::MakeSmallInt(value);
-    }
-
 private:
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
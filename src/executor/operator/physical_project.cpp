@@ -29,6 +29,7 @@ import column_vector;
 import infinity_exception;
 import analyzer_pool;
 import value;
+import term_automaton;
 
 module physical_project;
 
@@ -112,6 +113,7 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
 
                     SharedPtr<HighlightInfo> highlight_info = it->second;
                     Vector<String> &query_terms = highlight_info->query_terms_;
+                    Vector<SharedPtr<TermAutomaton>> &query_term_automata = highlight_info->query_term_automata_;
                     String &analyzer_name = highlight_info->analyzer_;
                     if (analyzer_name.find("standard") != std::string::npos) {
                         auto [analyzer, status] = AnalyzerPool::instance().GetAnalyzer(analyzer_name);
@@ -122,7 +124,7 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
                         for (SizeT i = 0; i < num_rows; ++i) {
                             String raw_content = output_data_block->column_vectors[expr_idx]->GetValue(i).GetVarchar();
                             String output;
-                            Highlighter::instance().GetHighlightWithStemmer(query_terms, raw_content, output, analyzer.get());
+                            Highlighter::instance().GetHighlightWithStemmer(query_terms, query_term_automata, raw_content, output, analyzer.get());
                             highlight_column->AppendValue(Value::MakeVarchar(output));
                         }
                     } else {
@@ -63,6 +63,9 @@ import hnsw_alg;
 import ivf_index_data_in_mem;
 import ivf_index_data;
 import ivf_index_search;
+import index_diskann;
+import diskann_index_in_chunk;
+import diskann_index_in_mem;
 
 import new_txn;
 import table_index_meeta;
@@ -420,7 +423,8 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
                     continue;
                 }
                 // check index type
-                if (auto index_type = index_base->index_type_; index_type != IndexType::kIVF and index_type != IndexType::kHnsw) {
+                if (auto index_type = index_base->index_type_; index_type != IndexType::kIVF and index_type != IndexType::kHnsw and
+                                                          index_type != IndexType::kDiskAnn) {
                     LOG_TRACE(fmt::format("KnnScan: PlanWithIndex(): Skipping non-knn index."));
                     continue;
                 }
@@ -449,7 +453,8 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
                 RecoverableError(std::move(error_status));
             }
             // check index type
-            if (auto index_type = index_base->index_type_; index_type != IndexType::kIVF and index_type != IndexType::kHnsw) {
+            if (auto index_type = index_base->index_type_; index_type != IndexType::kIVF and index_type != IndexType::kHnsw and
+                                                          index_type != IndexType::kDiskAnn) {
                 Status error_status = Status::InvalidIndexType("invalid index");
                 RecoverableError(std::move(error_status));
             }
@@ -552,6 +557,9 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
         // TODO: now will try to finish all block scan job in the task
         do {
             BlockMeta *block_meta = knn_scan_shared_data->block_metas_->at(block_column_idx);
+            if (block_column_idx + 1 < brute_task_n) {
+                PrefetchBlockColumns(query_context, *knn_scan_shared_data->block_metas_->at(block_column_idx + 1), {knn_column_id});
+            }
             ColumnMeta column_meta(knn_column_id, *block_meta);
             BlockID block_id = block_meta->block_id();
             SegmentID segment_id = block_meta->segment_meta().segment_id();
@@ -661,7 +669,8 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                     break;
                 }
                 case IndexType::kHnsw: {
-                    if constexpr (!(IsAnyOf<ColumnDataType, u8, i8, f32> && std::is_same_v<ColumnDataType, QueryDataType>)) {
+                    if constexpr (!((IsAnyOf<ColumnDataType, u8, i8, f32> && std::is_same_v<ColumnDataType, QueryDataType>) ||
+                                    (IsAnyOf<ColumnDataType, Float16T, BFloat16T> && std::is_same_v<QueryDataType, f32>))) {
                         UnrecoverableError("Invalid data type");
                     } else {
 #ifdef INDEX_HANDLER
@@ -682,9 +691,23 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                             }
 
                             i64 result_n = -1;
+                            // float16 and bfloat16 indexes compare in the column element type
+                            UniquePtr<ColumnDataType[]> index_query_buffer;
+                            if constexpr (!std::is_same_v<ColumnDataType, QueryDataType>) {
+                                index_query_buffer = MakeUniqueForOverwrite<ColumnDataType[]>(embedding_dim);
+                            }
                             for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
                                 const auto *query = static_cast<const QueryDataType *>(knn_scan_shared_data->query_embedding_) +
                                                     query_idx * knn_scan_shared_data->dimension_;
+                                const ColumnDataType *index_query = nullptr;
+                                if constexpr (std::is_same_v<ColumnDataType, QueryDataType>) {
+                                    index_query = query;
+                                } else {
+                                    for (u32 i = 0; i < embedding_dim; ++i) {
+                                        index_query_buffer[i] = static_cast<ColumnDataType>(query[i]);
+                                    }
+                                    index_query = index_query_buffer.get();
+                                }
 
                                 SizeT result_n1 = 0;
                                 UniquePtr<DistanceDataType[]> d_ptr = nullptr;
@@ -695,14 +718,14 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                     if (with_lock) {
                                         std::tie(result_n1, d_ptr, l_ptr) =
                                             hnsw_handler->template SearchIndex<DistanceDataType, SegmentOffset, BitmaskFilter<SegmentOffset>, true>(
-                                                query,
+                                                index_query,
                                                 knn_scan_shared_data->topk_,
                                                 filter,
                                                 search_option);
                                     } else {
                                         std::tie(result_n1, d_ptr, l_ptr) =
                                             hnsw_handler->template SearchIndex<DistanceDataType, SegmentOffset, BitmaskFilter<SegmentOffset>, false>(
-                                                query,
+                                                index_query,
                                                 knn_scan_shared_data->topk_,
                                                 filter,
                                                 search_option);
@@ -710,7 +733,7 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                 } else {
                                     if (!with_lock) {
                                         std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_handler->template SearchIndex<DistanceDataType, SegmentOffset, false>(query,
+                                            hnsw_handler->template SearchIndex<DistanceDataType, SegmentOffset, false>(index_query,
                                                                                                                        knn_scan_shared_data->topk_,
                                                                                                                        search_option);
                                     } else {
@@ -718,7 +741,7 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                         AppendFilter filter(max_segment_offset);
                                         std::tie(result_n1, d_ptr, l_ptr) =
                                             hnsw_handler->template SearchIndex<DistanceDataType, SegmentOffset, AppendFilter, true>(
-                                                query,
+                                                index_query,
                                                 knn_scan_shared_data->topk_,
                                                 filter,
                                                 search_option);
@@ -729,13 +752,13 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                     BitmaskFilter<SegmentOffset> filter(bitmask);
                                     if (with_lock) {
                                         std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, true>(query,
+                                            hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, true>(index_query,
                                                                                                                knn_scan_shared_data->topk_,
                                                                                                                filter,
                                                                                                                search_option);
                                     } else {
                                         std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, false>(query,
+                                            hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, false>(index_query,
                                                                                                                 knn_scan_shared_data->topk_,
                                                                                                                 filter,
                                                                                                                 search_option);
@@ -744,11 +767,11 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                     SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
                                     if (!with_lock) {
                                         std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<false>(query, knn_scan_shared_data->topk_, search_option);
+                                            hnsw_index->template KnnSearch<false>(index_query, knn_scan_shared_data->topk_, search_option);
                                     } else {
                                         AppendFilter filter(max_segment_offset);
                                         std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<AppendFilter, true>(query,
+                                            hnsw_index->template KnnSearch<AppendFilter, true>(index_query,
                                                                                                knn_scan_shared_data->topk_,
                                                                                                filter,
                                                                                                search_option);
@@ -787,8 +810,20 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                             }
                                         }
                                         if constexpr (t == LogicalType::kEmbedding) {
-                                            const auto *data = reinterpret_cast<const ColumnDataType *>(column_vector.data());
-                                            data += block_offset * knn_scan_shared_data->dimension_;
+                                            const auto *column_data = reinterpret_cast<const ColumnDataType *>(column_vector.data());
+                                            column_data += block_offset * knn_scan_shared_data->dimension_;
+                                            const QueryDataType *data = nullptr;
+                                            if constexpr (std::is_same_v<ColumnDataType, QueryDataType>) {
+                                                data = column_data;
+                                            } else {
+                                                if (!buffer_ptr_for_cast) {
+                                                    buffer_ptr_for_cast = MakeUniqueForOverwrite<QueryDataType[]>(embedding_dim);
+                                                }
+                                                for (u32 i = 0; i < embedding_dim; ++i) {
+                                                    buffer_ptr_for_cast[i] = static_cast<QueryDataType>(column_data[i]);
+                                                }
+                                                data = buffer_ptr_for_cast.get();
+                                            }
                                             merge_heap->Search(query,
                                                                data,
                                                                knn_scan_shared_data->dimension_,
@@ -884,6 +919,73 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                     }
                     break;
                 }
+                case IndexType::kDiskAnn: {
+                    if constexpr (!(t == LogicalType::kEmbedding && std::is_same_v<ColumnDataType, f32> && std::is_same_v<QueryDataType, f32>)) {
+                        UnrecoverableError("Invalid data type");
+                    } else {
+                        const auto *index_diskann = static_cast<const IndexDiskAnn *>(index_base);
+                        if (auto metric = index_diskann->metric_type_;
+                            !(metric == MetricType::kMetricL2 && knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kL2) &&
+                            !(metric == MetricType::kMetricCosine && knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kCosine)) {
+                            RecoverableError(Status::NotSupport(fmt::format("DiskAnn index with metric {} can't serve knn distance {}",
+                                                                            MetricTypeToString(metric),
+                                                                            KnnExpression::KnnDistanceType2Str(knn_scan_shared_data->knn_distance_type_))));
+                        }
+                        u32 search_l = index_diskann->L_;
+                        u32 beam_width = DISKANN_BEAM_WIDTH;
+                        for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
+                            if (opt_param.param_name_ == "l") {
+                                search_l = std::stoul(opt_param.param_value_);
+                            } else if (opt_param.param_name_ == "beam_width") {
+                                beam_width = std::stoul(opt_param.param_value_);
+                            }
+                        }
+                        const SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
+                        auto satisfy_filter = [&](SegmentOffset segment_offset) {
+                            return use_bitmask ? bitmask.IsTrue(segment_offset) : segment_offset < max_segment_offset;
+                        };
+                        const u32 topk = knn_scan_shared_data->topk_;
+
+                        // the chunk buffers are loaded once for all queries
+                        auto [chunk_ids_ptr, mem_index] = get_chunks();
+                        Vector<BufferHandle> chunk_handles;
+                        for (ChunkID chunk_id : *chunk_ids_ptr) {
+                            ChunkIndexMeta chunk_index_meta(chunk_id, *segment_index_meta);
+                            BufferObj *index_buffer = nullptr;
+                            status = chunk_index_meta.GetIndexBuffer(index_buffer);
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            chunk_handles.push_back(index_buffer->Load());
+                        }
+                        SharedPtr<DiskAnnIndexInMem> memory_diskann_index = mem_index ? mem_index->GetDiskAnnIndex() : nullptr;
+
+                        auto d_ptr = MakeUniqueForOverwrite<DistanceDataType[]>(topk);
+                        auto l_ptr = MakeUniqueForOverwrite<SegmentOffset[]>(topk);
+                        auto row_ids = MakeUniqueForOverwrite<RowID[]>(topk);
+                        for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                            const auto *query = static_cast<const QueryDataType *>(knn_scan_shared_data->query_embedding_) +
+                                                query_idx * knn_scan_shared_data->dimension_;
+                            HeapResultHandler<C<DistanceDataType, SegmentOffset>> result_handler(1, topk, d_ptr.get(), l_ptr.get());
+                            result_handler.Begin();
+                            auto add_result = [&](f32 distance, SegmentOffset segment_offset) { result_handler.AddResult(0, distance, segment_offset); };
+                            for (const auto &chunk_handle : chunk_handles) {
+                                const auto *diskann_chunk = static_cast<const DiskAnnIndexInChunk *>(chunk_handle.GetData());
+                                diskann_chunk->Search(query, topk, search_l, beam_width, satisfy_filter, add_result);
+                            }
+                            if (memory_diskann_index) {
+                                memory_diskann_index->Search(query, satisfy_filter, add_result);
+                            }
+                            result_handler.EndWithoutSort();
+                            const SizeT result_n = result_handler.GetSize(0);
+                            for (SizeT i = 0; i < result_n; ++i) {
+                                row_ids[i] = RowID{segment_id, l_ptr[i]};
+                            }
+                            merge_heap->Search(query_idx, d_ptr.get(), row_ids.get(), result_n);
+                        }
+                    }
+                    break;
+                }
                 default: {
                     RecoverableError(Status::NotSupport("Not implemented index type"));
                 }
@@ -48,6 +48,11 @@ import result_cache_manager;
 import table_meeta;
 import segment_meta;
 import block_meta;
+import column_meta;
+import buffer_manager;
+import buffer_obj;
+import storage;
+import status;
 import new_txn;
 
 namespace infinity {
@@ -152,6 +157,28 @@ void PhysicalScanBase::SetOutput(const Vector<char *> &raw_result_dists_list,
     }
 }
 
+void PhysicalScanBase::PrefetchBlockColumns(QueryContext *query_context, BlockMeta &block_meta, const Vector<SizeT> &column_ids) {
+    Vector<BufferObj *> buffer_objs;
+    for (SizeT column_id : column_ids) {
+        if (column_id == COLUMN_IDENTIFIER_ROW_ID || column_id == COLUMN_IDENTIFIER_CREATE || column_id == COLUMN_IDENTIFIER_DELETE) {
+            continue;
+        }
+        ColumnMeta column_meta(column_id, block_meta);
+        BufferObj *column_buffer = nullptr;
+        BufferObj *outline_buffer = nullptr;
+        Status status = column_meta.GetColumnBuffer(column_buffer, outline_buffer);
+        if (!status.ok()) {
+            // the block is read by the query in any case, let it report the error
+            continue;
+        }
+        buffer_objs.push_back(column_buffer);
+        if (outline_buffer != nullptr) {
+            buffer_objs.push_back(outline_buffer);
+        }
+    }
+    query_context->storage()->buffer_manager()->Prefetch(buffer_objs);
+}
+
 void PhysicalScanBase::AddCache(QueryContext *query_context,
                                 ResultCacheManager *cache_mgr,
                                 const Vector<UniquePtr<DataBlock>> &output_data_blocks) const {
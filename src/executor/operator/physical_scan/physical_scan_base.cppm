@@ -32,6 +32,7 @@ namespace infinity {
 class ResultCacheManager;
 struct DataBlock;
 struct BlockIndex;
+class BlockMeta;
 
 export class PhysicalScanBase : public PhysicalOperator {
 public:
@@ -72,6 +73,9 @@ protected:
 
     void AddCache(QueryContext *query_context, ResultCacheManager *cache_mgr, const Vector<UniquePtr<DataBlock>> &output_data_blocks) const;
 
+    // Prefetch the buffers of the columns of a block that is read next, so that they are read while the current block is processed.
+    static void PrefetchBlockColumns(QueryContext *query_context, BlockMeta &block_meta, const Vector<SizeT> &column_ids);
+
 public:
     u64 table_index_ = 0;
     SharedPtr<BaseTableRef> base_table_ref_{};
@@ -163,6 +163,11 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
                                           block_ids_count));
                 }
             }
+
+            if (block_ids_idx + 1 < block_ids_count) {
+                const GlobalBlockID &next_block_id = block_ids->at(block_ids_idx + 1);
+                PrefetchBlockColumns(query_context, *block_index->GetBlockMeta(next_block_id.segment_id_, next_block_id.block_id_), column_ids);
+            }
         }
 
         Pair<BlockOffset, BlockOffset> visible_range;
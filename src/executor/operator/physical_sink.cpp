@@ -453,7 +453,8 @@ void PhysicalSink::FillSinkStateFromLastOperatorState(FragmentContext *fragment_
         return;
     }
 
-    if (!task_operator_state->Complete() && fragment_context->IsMaterialize()) {
+    // An operator with pending output sends its blocks before it completes, the receiver finishes on the last batch.
+    if (!task_operator_state->Complete() && !queue_sink_state->pending_output_ && fragment_context->IsMaterialize()) {
         LOG_TRACE("Task not completed");
         return;
     }
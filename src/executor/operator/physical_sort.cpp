@@ -37,6 +37,9 @@ import third_party;
 import status;
 import physical_top;
 import logger;
+import external_sort;
+import infinity_context;
+import config;
 
 namespace infinity {
 
@@ -161,11 +164,57 @@ void PhysicalSort::Init(QueryContext* query_context) {
         sort_functions.emplace_back(PhysicalTop::GenerateSortFunction(order_by_types_[i], expressions_[i]));
     }
     prefer_left_function_ = CompareTwoRowAndPreferLeft(std::move(sort_functions));
+
+    key_types_.clear();
+    normalized_key_sort_ = true;
+    for (const auto &expression : expressions_) {
+        key_types_.emplace_back(MakeShared<DataType>(expression->Type()));
+        if (!SortKeyEncoder::SupportType(*key_types_.back())) {
+            normalized_key_sort_ = false;
+        }
+    }
+}
+
+bool PhysicalSort::ExecuteNormalizedKey(OperatorState *operator_state) {
+    auto *prev_op_state = operator_state->prev_op_state_;
+    auto *sort_operator_state = static_cast<SortOperatorState *>(operator_state);
+    auto &external_sorter = sort_operator_state->external_sorter_;
+    if (external_sorter.get() == nullptr) {
+        Config *config = InfinityContext::instance().config();
+        String spill_dir = fmt::format("{}/sort", config->TempDir());
+        external_sorter = MakeUnique<ExternalSorter>(key_types_, order_by_types_, config->SortMemoryLimit(), std::move(spill_dir));
+    }
+
+    if (!sort_operator_state->pending_output_) {
+        auto &input_blocks = prev_op_state->data_block_array_;
+        if (!input_blocks.empty()) {
+            auto key_columns = PhysicalTop::GetEvalColumns(expressions_, sort_operator_state->expr_states_, input_blocks);
+            external_sorter->AddRun(std::move(input_blocks), key_columns);
+            input_blocks.clear();
+        }
+
+        if (!prev_op_state->Complete()) {
+            return false;
+        }
+    }
+
+    // Hand out a few merged blocks per execution, so only the current page of each run is kept in memory while merging.
+    if (!external_sorter->MergeNext(sort_operator_state->data_block_array_, SORT_MERGE_OUTPUT_BLOCK_COUNT)) {
+        sort_operator_state->pending_output_ = true;
+        return true;
+    }
+    sort_operator_state->pending_output_ = false;
+    external_sorter.reset();
+    sort_operator_state->SetComplete();
+    return true;
 }
 
 bool PhysicalSort::Execute(QueryContext *, OperatorState *operator_state) {
     auto *prev_op_state = operator_state->prev_op_state_;
     auto *sort_operator_state = static_cast<SortOperatorState *>(operator_state);
+    if (normalized_key_sort_) {
+        return ExecuteNormalizedKey(operator_state);
+    }
 
     // Generate block indexes
     Vector<BlockRawIndex> block_indexes;
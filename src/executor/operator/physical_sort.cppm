@@ -64,8 +64,13 @@ public:
     Vector<OrderType> order_by_types_{};
 
 private:
+    bool ExecuteNormalizedKey(OperatorState *operator_state);
+
     u64 input_table_index_{};
     CompareTwoRowAndPreferLeft prefer_left_function_; // compare function
+    // All sort keys can be normalized into byte strings, rows are sorted by ExternalSorter.
+    bool normalized_key_sort_{false};
+    Vector<SharedPtr<DataType>> key_types_{};
 };
 
 } // namespace infinity
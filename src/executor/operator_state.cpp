@@ -135,6 +135,19 @@ bool QueueSourceState::GetData() {
             fusion_op_state->input_complete_ = completed;
             break;
         }
+        case PhysicalOperatorType::kJoinHash: {
+            auto *hash_join_op_state = static_cast<HashJoinOperatorState *>(next_op_state);
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                // The build fragment only sends its completion, the blocks are kept in the hash table.
+                if (fragment_data->data_block_ && fragment_data->fragment_id_ != hash_join_op_state->build_fragment_id_) {
+                    hash_join_op_state->input_data_blocks_.push_back(std::move(fragment_data->data_block_));
+                }
+            }
+            hash_join_op_state->build_complete_ = !num_tasks_.contains(hash_join_op_state->build_fragment_id_);
+            hash_join_op_state->input_complete_ = completed;
+            break;
+        }
         case PhysicalOperatorType::kMergeLimit: {
             auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
             MergeLimitOperatorState *limit_op_state = (MergeLimitOperatorState *)next_op_state;
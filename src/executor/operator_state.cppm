@@ -34,6 +34,7 @@ import internal_types;
 import column_def;
 import data_type;
 import hash_table;
+import external_sort;
 
 namespace infinity {
 
@@ -60,6 +61,9 @@ export struct OperatorState {
     bool empty_source_{false};
 
     bool complete_{false};
+    // The input is consumed, but the operator emits its output over several executions. The task resumes from this
+    // operator without pulling the source again.
+    bool pending_output_{false};
 
     bool total_hits_count_flag_{};
     SizeT total_hits_count_{};
@@ -75,7 +79,10 @@ export struct AggregateOperatorState : public OperatorState {
         : OperatorState(PhysicalOperatorType::kAggregate), states_(std::move(states)) {}
 
     Vector<UniquePtr<char[]>> states_;
+
+    // Group by: keys and aggregate states of the groups seen by this task.
     HashTable hash_table_;
+    GroupStateArena group_states_;
 };
 
 // Merge Aggregate
@@ -85,7 +92,11 @@ export struct MergeAggregateOperatorState : public OperatorState {
     /// Since merge agg is the first op, no previous operator state. This ptr is to get input data.
     // Vector<UniquePtr<DataBlock>> input_data_blocks_{nullptr};
     UniquePtr<DataBlock> input_data_block_{nullptr};
-    MergeHashTable hash_table_;
+    // Only used to partition the rows of the partial results.
+    HashTable hash_table_;
+    // Partial results of the group by aggregate tasks and the partition of each of their rows, merged once the input is complete.
+    Vector<UniquePtr<DataBlock>> partial_blocks_{};
+    Vector<Vector<u8>> partial_partitions_{};
     bool input_complete_{false};
 };
 
@@ -189,6 +200,15 @@ export struct MergeHashOperatorState : public OperatorState {
 // Hash Join
 export struct HashJoinOperatorState : public OperatorState {
     inline explicit HashJoinOperatorState() : OperatorState(PhysicalOperatorType::kJoinHash) {}
+
+    // Hash join is the first op, fed by the probe fragment and the build fragment.
+    u64 build_fragment_id_{};
+    // All build tasks are done, the hash table can be probed.
+    bool build_complete_{false};
+    // Both the probe and the build fragments are drained.
+    bool input_complete_{false};
+    // Probe blocks waiting for the hash table to be completed.
+    Vector<UniquePtr<DataBlock>> input_data_blocks_{};
 };
 
 // Nested Loop
@@ -250,6 +270,7 @@ export struct SortOperatorState : public OperatorState {
     inline explicit SortOperatorState() : OperatorState(PhysicalOperatorType::kSort) {}
     Vector<SharedPtr<ExpressionState>> expr_states_; // expression states
     Vector<UniquePtr<DataBlock>> unmerge_sorted_blocks_{};
+    UniquePtr<ExternalSorter> external_sorter_{};
 };
 
 // Merge Sort
@@ -544,6 +565,8 @@ export struct SinkState {
     u64 fragment_id_{};
     u64 task_id_{};
     OperatorState *prev_op_state_{};
+    // An operator of the task has more output for the following executions.
+    bool pending_output_{false};
     SinkStateType state_type_{SinkStateType::kInvalid};
     //    UniquePtr<String> error_message_{};
     Status status_{};
@@ -0,0 +1,126 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module parallel_block_parser;
+
+import stl;
+import data_block;
+
+namespace infinity {
+
+ParallelBlockParser::ParallelBlockParser(SizeT thread_count, SizeT memory_budget, ParseFunc parse_func)
+    : memory_budget_(memory_budget), parse_func_(std::move(parse_func)) {
+    thread_count = std::max<SizeT>(thread_count, 1);
+    threads_.reserve(thread_count);
+    for (SizeT i = 0; i < thread_count; ++i) {
+        threads_.emplace_back([this] { Work(); });
+    }
+}
+
+ParallelBlockParser::~ParallelBlockParser() { Stop(); }
+
+void ParallelBlockParser::Submit(String chunk, SizeT row_count, Vector<SharedPtr<DataBlock>> &ready_blocks) {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        TakeReady(ready_blocks);
+        // one chunk is always accepted, even if it is larger than the budget
+        if (inflight_bytes_ == 0 || inflight_bytes_ + chunk.size() <= memory_budget_) {
+            break;
+        }
+        done_cv_.wait(lock, [&] { return error_ != nullptr || parsed_.contains(next_ready_seq_); });
+    }
+    inflight_bytes_ += chunk.size();
+    tasks_.push_back(ParseTask{next_seq_++, std::move(chunk), row_count});
+    task_cv_.notify_one();
+}
+
+void ParallelBlockParser::Finish(Vector<SharedPtr<DataBlock>> &ready_blocks) {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        TakeReady(ready_blocks);
+        if (next_ready_seq_ == next_seq_) {
+            break;
+        }
+        done_cv_.wait(lock, [&] { return error_ != nullptr || parsed_.contains(next_ready_seq_); });
+    }
+}
+
+void ParallelBlockParser::TakeReady(Vector<SharedPtr<DataBlock>> &ready_blocks) {
+    if (error_ != nullptr) {
+        std::exception_ptr error = error_;
+        stop_ = true;
+        task_cv_.notify_all();
+        std::rethrow_exception(error);
+    }
+    for (auto iter = parsed_.find(next_ready_seq_); iter != parsed_.end(); iter = parsed_.find(next_ready_seq_)) {
+        auto &[block, chunk_size] = iter->second;
+        ready_blocks.push_back(std::move(block));
+        inflight_bytes_ -= chunk_size;
+        parsed_.erase(iter);
+        ++next_ready_seq_;
+    }
+}
+
+void ParallelBlockParser::Work() {
+    while (true) {
+        ParseTask task;
+        {
+            std::unique_lock lock(mutex_);
+            task_cv_.wait(lock, [&] { return stop_ || !tasks_.empty(); });
+            if (stop_) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        SharedPtr<DataBlock> block;
+        std::exception_ptr error;
+        try {
+            block = parse_func_(task.chunk_, task.row_count_);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        const SizeT chunk_size = task.chunk_.size();
+        task.chunk_ = String();
+        {
+            std::unique_lock lock(mutex_);
+            if (error != nullptr) {
+                if (error_ == nullptr) {
+                    error_ = error;
+                }
+            } else {
+                parsed_.emplace(task.seq_, Pair<SharedPtr<DataBlock>, SizeT>(std::move(block), chunk_size));
+            }
+        }
+        done_cv_.notify_all();
+    }
+}
+
+void ParallelBlockParser::Stop() {
+    {
+        std::unique_lock lock(mutex_);
+        stop_ = true;
+    }
+    task_cv_.notify_all();
+    for (auto &thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    threads_.clear();
+}
+
+} // namespace infinity
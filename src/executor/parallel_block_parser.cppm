@@ -0,0 +1,76 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module parallel_block_parser;
+
+import stl;
+import data_block;
+
+namespace infinity {
+
+// Parse chunks of input text into data blocks on worker threads and return the blocks in the order the chunks were submitted.
+// The text of the submitted chunks that are not returned yet is bounded by the memory budget, Submit waits for the workers
+// when it is exceeded. An exception thrown by the parse function is rethrown in the submitting thread.
+export class ParallelBlockParser {
+public:
+    using ParseFunc = std::function<SharedPtr<DataBlock>(const String &chunk, SizeT row_count)>;
+
+    ParallelBlockParser(SizeT thread_count, SizeT memory_budget, ParseFunc parse_func);
+
+    ~ParallelBlockParser();
+
+    // Submit a chunk holding row_count rows, the blocks finished so far are appended to ready_blocks.
+    void Submit(String chunk, SizeT row_count, Vector<SharedPtr<DataBlock>> &ready_blocks);
+
+    // Wait for all submitted chunks and append their blocks to ready_blocks.
+    void Finish(Vector<SharedPtr<DataBlock>> &ready_blocks);
+
+    [[nodiscard]] inline SizeT thread_count() const { return threads_.size(); }
+
+private:
+    struct ParseTask {
+        SizeT seq_{};
+        String chunk_{};
+        SizeT row_count_{};
+    };
+
+    void Work();
+
+    // Caller holds mutex_.
+    void TakeReady(Vector<SharedPtr<DataBlock>> &ready_blocks);
+
+    void Stop();
+
+private:
+    const SizeT memory_budget_{};
+    const ParseFunc parse_func_;
+
+    std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable done_cv_;
+    Deque<ParseTask> tasks_{};
+    // parsed blocks with the size of their chunk, by submit sequence
+    Map<SizeT, Pair<SharedPtr<DataBlock>, SizeT>> parsed_{};
+    SizeT next_seq_{};
+    SizeT next_ready_seq_{};
+    SizeT inflight_bytes_{};
+    std::exception_ptr error_{};
+    bool stop_{false};
+
+    Vector<Thread> threads_{};
+};
+
+} // namespace infinity
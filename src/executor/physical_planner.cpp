@@ -132,6 +132,14 @@ import logical_check;
 
 import value;
 import value_expression;
+import base_expression;
+import expression_type;
+import function_expression;
+import cast_expression;
+import reference_expression;
+import join_reference;
+import join_hash_table;
+import data_type;
 import match_tensor_expression;
 import match_sparse_expression;
 import explain_physical_plan;
@@ -632,6 +640,109 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
     }
 }
 
+namespace {
+
+enum class JoinKeySide { kNone, kLeft, kRight, kBoth };
+
+// Which side of the join the column references of the expression come from.
+JoinKeySide GetJoinKeySide(const SharedPtr<BaseExpression> &expression, SizeT left_column_count) {
+    if (expression->type() == ExpressionType::kReference) {
+        auto *reference_expression = static_cast<ReferenceExpression *>(expression.get());
+        return reference_expression->column_index() < left_column_count ? JoinKeySide::kLeft : JoinKeySide::kRight;
+    }
+    JoinKeySide side = JoinKeySide::kNone;
+    for (const auto &argument : expression->arguments()) {
+        JoinKeySide argument_side = GetJoinKeySide(argument, left_column_count);
+        if (argument_side == JoinKeySide::kNone || argument_side == side) {
+            continue;
+        }
+        side = side == JoinKeySide::kNone ? argument_side : JoinKeySide::kBoth;
+    }
+    return side;
+}
+
+// Rebase the column references of a right side key onto the output of the right child. The key is rebuilt rather than
+// modified, its nodes are still shared with the join conditions. Returns nullptr for keys that can't be rebuilt.
+SharedPtr<BaseExpression> RebaseJoinKey(const SharedPtr<BaseExpression> &expression, SizeT left_column_count) {
+    switch (expression->type()) {
+        case ExpressionType::kReference: {
+            auto *reference_expression = static_cast<ReferenceExpression *>(expression.get());
+            return ReferenceExpression::Make(reference_expression->Type(),
+                                             reference_expression->table_name(),
+                                             reference_expression->column_name(),
+                                             reference_expression->alias_,
+                                             reference_expression->column_index() - left_column_count);
+        }
+        case ExpressionType::kValue: {
+            return expression;
+        }
+        case ExpressionType::kFunction: {
+            auto *function_expression = static_cast<FunctionExpression *>(expression.get());
+            Vector<SharedPtr<BaseExpression>> arguments;
+            arguments.reserve(function_expression->arguments().size());
+            for (const auto &argument : function_expression->arguments()) {
+                auto rebased_argument = RebaseJoinKey(argument, left_column_count);
+                if (rebased_argument.get() == nullptr) {
+                    return nullptr;
+                }
+                arguments.emplace_back(std::move(rebased_argument));
+            }
+            auto rebased_expression = MakeShared<FunctionExpression>(function_expression->func_, std::move(arguments));
+            rebased_expression->alias_ = function_expression->alias_;
+            return rebased_expression;
+        }
+        case ExpressionType::kCast: {
+            auto *cast_expression = static_cast<CastExpression *>(expression.get());
+            auto rebased_argument = RebaseJoinKey(cast_expression->arguments()[0], left_column_count);
+            if (rebased_argument.get() == nullptr) {
+                return nullptr;
+            }
+            auto rebased_expression = MakeShared<CastExpression>(cast_expression->func_, rebased_argument, cast_expression->Type());
+            rebased_expression->alias_ = cast_expression->alias_;
+            return rebased_expression;
+        }
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+// Split the join conditions into probe (left) and build (right) keys, fail if any condition isn't an equality between both sides.
+bool ExtractHashJoinKeys(const Vector<SharedPtr<BaseExpression>> &conditions,
+                         SizeT left_column_count,
+                         Vector<SharedPtr<BaseExpression>> &probe_keys,
+                         Vector<SharedPtr<BaseExpression>> &build_keys) {
+    if (conditions.empty()) {
+        return false;
+    }
+    for (const auto &condition : conditions) {
+        if (condition->type() != ExpressionType::kFunction) {
+            return false;
+        }
+        auto *function_expression = static_cast<FunctionExpression *>(condition.get());
+        if (function_expression->ScalarFunctionName() != "=" || function_expression->arguments().size() != 2) {
+            return false;
+        }
+        SharedPtr<BaseExpression> left_key = function_expression->arguments()[0];
+        SharedPtr<BaseExpression> right_key = function_expression->arguments()[1];
+        JoinKeySide left_side = GetJoinKeySide(left_key, left_column_count);
+        JoinKeySide right_side = GetJoinKeySide(right_key, left_column_count);
+        if (left_side == JoinKeySide::kRight && right_side == JoinKeySide::kLeft) {
+            std::swap(left_key, right_key);
+        } else if (left_side != JoinKeySide::kLeft || right_side != JoinKeySide::kRight) {
+            return false;
+        }
+        if (left_key->Type() != right_key->Type() || !JoinHashTable::SupportKeyType(left_key->Type())) {
+            return false;
+        }
+        probe_keys.emplace_back(std::move(left_key));
+        build_keys.emplace_back(std::move(right_key));
+    }
+    return true;
+}
+
+} // namespace
+
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNode> &logical_operator) const {
 
     auto left_node = logical_operator->left_node();
@@ -654,6 +765,37 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNo
     left_physical_operator = BuildPhysicalOperator(left_node);
     right_physical_operator = BuildPhysicalOperator(right_node);
 
+    JoinType join_type = logical_join->join_type_;
+    if (join_type == JoinType::kInner || join_type == JoinType::kLeft || join_type == JoinType::kSemi) {
+        SizeT left_column_count = left_node->GetColumnBindings().size();
+        Vector<SharedPtr<BaseExpression>> probe_keys;
+        Vector<SharedPtr<BaseExpression>> build_keys;
+        bool hash_join = ExtractHashJoinKeys(logical_join->conditions_, left_column_count, probe_keys, build_keys);
+        Vector<SharedPtr<DataType>> key_types;
+        key_types.reserve(build_keys.size());
+        for (SizeT i = 0; hash_join && i < build_keys.size(); ++i) {
+            key_types.emplace_back(MakeShared<DataType>(build_keys[i]->Type()));
+            build_keys[i] = RebaseJoinKey(build_keys[i], left_column_count);
+            hash_join = build_keys[i].get() != nullptr;
+        }
+        if (hash_join) {
+            auto hash_table = MakeShared<JoinHashTable>(std::move(key_types));
+            auto build_operator = MakeUnique<PhysicalHash>(query_context_ptr_->GetNextNodeID(),
+                                                           std::move(right_physical_operator),
+                                                           std::move(build_keys),
+                                                           hash_table,
+                                                           MakeShared<Vector<LoadMeta>>());
+            return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(),
+                                                join_type,
+                                                logical_join->conditions_,
+                                                std::move(probe_keys),
+                                                std::move(hash_table),
+                                                std::move(left_physical_operator),
+                                                std::move(build_operator),
+                                                logical_operator->load_metas());
+        }
+    }
+
     return MakeUnique<PhysicalNestedLoopJoin>(logical_operator->node_id(),
                                               logical_join->join_type_,
                                               logical_join->conditions_,
@@ -858,7 +1000,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildFilter(const SharedPtr<Logical
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIntersect(const SharedPtr<LogicalNode> &logical_operator) const {
-    return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(), logical_operator->load_metas());
+    return MakeUnique<PhysicalIntersect>(logical_operator->GetOutputNames(),
+                                         logical_operator->GetOutputTypes(),
+                                         logical_operator->node_id(),
+                                         logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildUnion(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -866,7 +1011,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildUnion(const SharedPtr<LogicalN
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExcept(const SharedPtr<LogicalNode> &logical_operator) const {
-    return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(), logical_operator->load_metas());
+    return MakeUnique<PhysicalExcept>(logical_operator->GetOutputNames(),
+                                      logical_operator->GetOutputTypes(),
+                                      logical_operator->node_id(),
+                                      logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildShow(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -953,6 +1101,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildMatch(const SharedPtr<LogicalN
                                      logical_match->score_threshold_,
                                      logical_match->ft_similarity_,
                                      logical_match->bm25_params_,
+                                     logical_match->partition_min_row_count_,
                                      logical_match->TableIndex(),
                                      logical_operator->load_metas(),
                                      true /*cache_result*/);
@@ -26,7 +26,7 @@ namespace infinity {
 AggregateExpression::AggregateExpression(AggregateFunction aggregate_function, Vector<SharedPtr<BaseExpression>> arguments)
     : BaseExpression(ExpressionType::kAggregate, std::move(arguments)), aggregate_function_(std::move(aggregate_function)) {}
 
-bool AggregateExpression::IsCountStar() const { return false; }
+bool AggregateExpression::IsCountStar() const { return count_star_; }
 
 String AggregateExpression::ToString() const {
     std::stringstream ss;
@@ -37,6 +37,9 @@ public:
 
 public:
     AggregateFunction aggregate_function_;
+
+    // Set by the binder for COUNT(*), whose argument is only a placeholder column.
+    bool count_star_{false};
 };
 
 } // namespace infinity
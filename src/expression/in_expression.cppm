@@ -23,6 +23,7 @@ import infinity_exception;
 import stl;
 import logical_type;
 import internal_types;
+import third_party;
 
 namespace infinity {
 
@@ -38,6 +39,98 @@ namespace infinity {
 // kDouble,
 // kVarchar,
 
+// Set the compact bit (lowest bit first) of each row in [0, count) from `pred(row)`, whole bytes are written.
+export template <typename Pred>
+void InMatchRows(SizeT count, u8 *result, Pred &&pred) {
+    for (SizeT byte_idx = 0; byte_idx * 8 < count; ++byte_idx) {
+        SizeT start = byte_idx * 8;
+        SizeT n = std::min<SizeT>(8, count - start);
+        u8 bits = 0;
+        for (SizeT i = 0; i < n; ++i) {
+            bits |= u8(pred(start + i)) << i;
+        }
+        result[byte_idx] = bits;
+    }
+}
+
+// The constants of an IN list as raw values, so that a column is matched without building a Value per row.
+export template <typename T>
+class InRawSet {
+public:
+    using ValueType = T;
+
+    void Insert(T value) {
+        value = Normalize(value);
+        if (set_.insert(value).second) {
+            values_.push_back(value);
+        }
+    }
+
+    bool Contains(T value) const {
+        value = Normalize(value);
+        if (values_.size() <= kLinearSearchLimit) {
+            return std::find(values_.begin(), values_.end(), value) != values_.end();
+        }
+        return set_.contains(value);
+    }
+
+    // Set the compact bit of each row in [0, count) whose value is in the set.
+    void Match(const T *data, SizeT count, u8 *result) const {
+        if (values_.size() > kLinearSearchLimit) {
+            InMatchRows(count, result, [&](SizeT i) { return set_.contains(Normalize(data[i])); });
+            return;
+        }
+        // a short list is compared against a batch of rows value by value, the inner loop is vectorized by the compiler
+        constexpr SizeT kBatchSize = 64;
+        u8 hits[kBatchSize];
+        for (SizeT start = 0; start < count; start += kBatchSize) {
+            SizeT n = std::min(kBatchSize, count - start);
+            const T *batch = data + start;
+            std::fill_n(hits, n, 0);
+            for (T value : values_) {
+                for (SizeT i = 0; i < n; ++i) {
+                    hits[i] |= batch[i] == value;
+                }
+            }
+            InMatchRows(n, result + start / 8, [&](SizeT i) { return hits[i] != 0; });
+        }
+    }
+
+private:
+    // -0.0 equals 0.0 but does not hash the same
+    static T Normalize(T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return value == 0 ? T(0) : value;
+        }
+        return value;
+    }
+
+    static constexpr SizeT kLinearSearchLimit = 16;
+
+    Vector<T> values_;
+    FlatHashSet<T> set_;
+};
+
+// Varchar constants of an IN list, looked up by the string view of a row.
+export class InStringSet {
+public:
+    void Insert(const String &value) { set_.insert(value); }
+
+    bool Contains(std::string_view value) const { return set_.contains(value); }
+
+private:
+    struct StringViewHash {
+        using is_transparent = void;
+        SizeT operator()(std::string_view value) const { return std::hash<std::string_view>{}(value); }
+    };
+    struct StringViewEqual {
+        using is_transparent = void;
+        bool operator()(std::string_view lhs, std::string_view rhs) const { return lhs == rhs; }
+    };
+
+    FlatHashSet<String, StringViewHash, StringViewEqual> set_;
+};
+
 class ValueSet {
 public:
     void TryPut(Value &&val) {
@@ -45,9 +138,24 @@ public:
             UnrecoverableError(std::format("Mismatched type in ValueSet : {}, {}", val.type().ToString(), data_type_.ToString()));
             return;
         }
+        std::visit(
+            [&](auto &raw_set) {
+                using RawSet = std::decay_t<decltype(raw_set)>;
+                if constexpr (std::is_same_v<RawSet, InStringSet>) {
+                    raw_set.Insert(val.GetVarchar());
+                } else if constexpr (!std::is_same_v<RawSet, std::monostate>) {
+                    raw_set.Insert(val.GetValue<typename RawSet::ValueType>());
+                }
+            },
+            raw_set_);
         set_.emplace(std::move(val));
     }
 
+    template <typename RawSet>
+    const RawSet *GetRawSet() const {
+        return std::get_if<RawSet>(&raw_set_);
+    }
+
     inline bool Exist(const Value &val) const { return set_.contains(val); }
     inline DataType Type() const { return data_type_; }
 
@@ -55,24 +163,32 @@ public:
     ValueSet(LogicalType logical_type) : data_type_(logical_type) {
         switch (logical_type) {
             case LogicalType::kBoolean:
+                raw_set_.emplace<InRawSet<BooleanT>>();
                 break;
             case LogicalType::kTinyInt:
+                raw_set_.emplace<InRawSet<TinyIntT>>();
                 break;
             case LogicalType::kSmallInt:
+                raw_set_.emplace<InRawSet<SmallIntT>>();
                 break;
             case LogicalType::kInteger:
+                raw_set_.emplace<InRawSet<IntegerT>>();
                 break;
             case LogicalType::kBigInt:
+                raw_set_.emplace<InRawSet<BigIntT>>();
                 break;
             case LogicalType::kHugeInt:
                 break;
             case LogicalType::kDecimal:
                 break;
             case LogicalType::kFloat:
+                raw_set_.emplace<InRawSet<FloatT>>();
                 break;
             case LogicalType::kDouble:
+                raw_set_.emplace<InRawSet<DoubleT>>();
                 break;
             case LogicalType::kVarchar:
+                raw_set_.emplace<InStringSet>();
                 break;
             default:
                 UnrecoverableError(std::format("Not supported type in ValueSet for InExpression: {}", LogicalType2Str(logical_type)));
@@ -118,6 +234,17 @@ private:
     };
     DataType data_type_;
     HashSet<Value, ValueHasher, ValueComparator> set_;
+    // HugeInt and Decimal have no raw set and are matched through set_ only
+    std::variant<std::monostate,
+                 InRawSet<BooleanT>,
+                 InRawSet<TinyIntT>,
+                 InRawSet<SmallIntT>,
+                 InRawSet<IntegerT>,
+                 InRawSet<BigIntT>,
+                 InRawSet<FloatT>,
+                 InRawSet<DoubleT>,
+                 InStringSet>
+        raw_set_;
 };
 
 export enum class InType {
@@ -146,6 +273,12 @@ public:
 
     inline DataType TypeOfArguments() const { return set_.Type(); }
 
+    // The raw set of the argument type, nullptr when the type has none.
+    template <typename RawSet>
+    inline const RawSet *GetRawSet() const {
+        return set_.GetRawSet<RawSet>();
+    }
+
     u64 Hash() const override;
 
     bool Eq(const BaseExpression &other) const override;
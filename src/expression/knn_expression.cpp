@@ -87,11 +87,24 @@ String KnnExpression::ToString() const {
 }
 
 u64 KnnExpression::Hash() const {
+    u64 h = HashIgnoreTopN();
+    h ^= std::hash<i32>()(topn_);
+    return h;
+}
+
+bool KnnExpression::Eq(const BaseExpression &other_base) const {
+    if (other_base.type() != ExpressionType::kKnn) {
+        return false;
+    }
+    const auto &other = static_cast<const KnnExpression &>(other_base);
+    return topn_ == other.topn_ && EqIgnoreTopN(other);
+}
+
+u64 KnnExpression::HashIgnoreTopN() const {
     u64 h = 0;
     h = std::hash<i64>()(dimension_);
     h ^= std::hash<EmbeddingDataType>()(embedding_data_type_);
     h ^= std::hash<KnnDistanceType>()(distance_type_);
-    h ^= std::hash<i32>()(topn_);
     h ^= std::hash<String>()(using_index_);
     if (optional_filter_) {
         h ^= optional_filter_->Hash();
@@ -99,14 +112,10 @@ u64 KnnExpression::Hash() const {
     return h;
 }
 
-bool KnnExpression::Eq(const BaseExpression &other_base) const {
-    if (other_base.type() != ExpressionType::kKnn) {
-        return false;
-    }
-    const auto &other = static_cast<const KnnExpression &>(other_base);
+bool KnnExpression::EqIgnoreTopN(const KnnExpression &other) const {
     bool eq = dimension_ == other.dimension_ && embedding_data_type_ == other.embedding_data_type_ && distance_type_ == other.distance_type_ &&
-              query_embedding_.Eq(other.query_embedding_, embedding_data_type_, dimension_) && topn_ == other.topn_ &&
-              opt_params_ == other.opt_params_ && using_index_ == other.using_index_ && ignore_index_ == other.ignore_index_;
+              query_embedding_.Eq(other.query_embedding_, embedding_data_type_, dimension_) && opt_params_ == other.opt_params_ &&
+              using_index_ == other.using_index_ && ignore_index_ == other.ignore_index_;
     if (!eq) {
         return false;
     }
@@ -64,6 +64,11 @@ public:
 
     bool Eq(const BaseExpression &other) const override;
 
+    // Hash and equality of the query without topn_.
+    u64 HashIgnoreTopN() const;
+
+    bool EqIgnoreTopN(const KnnExpression &other) const;
+
 public:
     const i64 dimension_{0};
     const EmbeddingDataType embedding_data_type_{EmbeddingDataType::kElemInvalid};
@@ -97,6 +97,20 @@ DataType MatchSparseExpression::Type() const {
 }
 
 u64 MatchSparseExpression::Hash() const {
+    u64 h = HashIgnoreTopN();
+    h ^= std::hash<SizeT>()(topn_);
+    return h;
+}
+
+bool MatchSparseExpression::Eq(const BaseExpression &other_base) const {
+    if (other_base.type() != ExpressionType::kMatchSparse) {
+        return false;
+    }
+    const auto &other = static_cast<const MatchSparseExpression &>(other_base);
+    return topn_ == other.topn_ && EqIgnoreTopN(other);
+}
+
+u64 MatchSparseExpression::HashIgnoreTopN() const {
     u64 h = 0;
     for (const auto &arg : arguments_) {
         h ^= arg->Hash();
@@ -105,7 +119,6 @@ u64 MatchSparseExpression::Hash() const {
     h ^= query_sparse_expr_->Hash();
     h ^= std::hash<SparseMetricType>()(metric_type_);
     h ^= std::hash<SizeT>()(query_n_);
-    h ^= std::hash<SizeT>()(topn_);
     h ^= std::hash<String>()(index_name_);
     if (optional_filter_) {
         h ^= optional_filter_->Hash();
@@ -113,11 +126,7 @@ u64 MatchSparseExpression::Hash() const {
     return h;
 }
 
-bool MatchSparseExpression::Eq(const BaseExpression &other_base) const {
-    if (other_base.type() != ExpressionType::kMatchSparse) {
-        return false;
-    }
-    const auto &other = static_cast<const MatchSparseExpression &>(other_base);
+bool MatchSparseExpression::EqIgnoreTopN(const MatchSparseExpression &other) const {
     if (arguments_.size() != other.arguments_.size()) {
         return false;
     }
@@ -127,7 +136,7 @@ bool MatchSparseExpression::Eq(const BaseExpression &other_base) const {
         }
     }
     bool eq = column_expr_->Eq(*other.column_expr_) && query_sparse_expr_->Eq(*other.query_sparse_expr_) && metric_type_ == other.metric_type_ &&
-              query_n_ == other.query_n_ && topn_ == other.topn_ && index_name_ == other.index_name_;
+              query_n_ == other.query_n_ && index_name_ == other.index_name_;
     if (!eq) {
         return false;
     }
@@ -50,6 +50,11 @@ public:
 
     bool Eq(const BaseExpression &other) const override;
 
+    // Hash and equality of the query without topn_.
+    u64 HashIgnoreTopN() const;
+
+    bool EqIgnoreTopN(const MatchSparseExpression &other) const;
+
 private:
     void MakeQuery(SharedPtr<BaseExpression> query_sparse_expr);
 
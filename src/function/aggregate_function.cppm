@@ -35,6 +35,8 @@ namespace infinity {
 using AggregateInitializeFuncType = std::function<void(ptr_t)>;
 using AggregateUpdateFuncType = std::function<void(ptr_t, const SharedPtr<ColumnVector> &)>;
 using AggregateFinalizeFuncType = std::function<ptr_t(ptr_t)>;
+// Update the state of each input row, states[i] is the state of the group which the i-th row belongs to.
+using AggregateScatterUpdateFuncType = std::function<void(const ptr_t *, SizeT, const SharedPtr<ColumnVector> &)>;
 
 class AggregateOperation {
 public:
@@ -98,6 +100,60 @@ public:
         }
     }
 
+    template <typename AggregateState, typename InputType>
+    static inline void StateScatterUpdate(const ptr_t *states, SizeT row_count, const SharedPtr<ColumnVector> &input_column_vector) {
+        switch (input_column_vector->vector_type()) {
+            case ColumnVectorType::kCompactBit: {
+                if constexpr (!std::is_same_v<InputType, BooleanT>) {
+                    String error_message = "kCompactBit column vector only support Boolean type";
+                    UnrecoverableError(error_message);
+                } else {
+                    BooleanT value;
+                    const VectorBuffer *buffer = input_column_vector->buffer_.get();
+                    for (SizeT idx = 0; idx < row_count; ++idx) {
+                        value = buffer->GetCompactBit(idx);
+                        ((AggregateState *)states[idx])->Update(&value, 0);
+                    }
+                }
+                break;
+            }
+            case ColumnVectorType::kFlat: {
+                auto *input_ptr = (InputType *)(input_column_vector->data());
+                for (SizeT idx = 0; idx < row_count; ++idx) {
+                    ((AggregateState *)states[idx])->Update(input_ptr, idx);
+                }
+                break;
+            }
+            case ColumnVectorType::kConstant: {
+                if (input_column_vector->data_type()->type() == LogicalType::kBoolean) {
+                    if constexpr (!std::is_same_v<InputType, BooleanT>) {
+                        String error_message = "types do not match";
+                        UnrecoverableError(error_message);
+                    } else {
+                        BooleanT value = input_column_vector->buffer_->GetCompactBit(0);
+                        for (SizeT idx = 0; idx < row_count; ++idx) {
+                            ((AggregateState *)states[idx])->Update(&value, 0);
+                        }
+                    }
+                    break;
+                }
+                auto *input_ptr = (InputType *)(input_column_vector->data());
+                for (SizeT idx = 0; idx < row_count; ++idx) {
+                    ((AggregateState *)states[idx])->Update(input_ptr, 0);
+                }
+                break;
+            }
+            case ColumnVectorType::kHeterogeneous: {
+                String error_message = "Not implement: Heterogeneous type";
+                UnrecoverableError(error_message);
+            }
+            default: {
+                String error_message = "Not implement: Other type";
+                UnrecoverableError(error_message);
+            }
+        }
+    }
+
     template <typename AggregateState, typename ResultType>
     static inline ptr_t StateFinalize(const ptr_t state) {
         // Loop execute state update according to the input column vector
@@ -114,10 +170,11 @@ public:
                                SizeT state_size,
                                AggregateInitializeFuncType init_func,
                                AggregateUpdateFuncType update_func,
-                               AggregateFinalizeFuncType finalize_func)
+                               AggregateFinalizeFuncType finalize_func,
+                               AggregateScatterUpdateFuncType scatter_update_func)
         : Function(std::move(name), FunctionType::kAggregate), init_func_(std::move(init_func)), update_func_(std::move(update_func)),
-          finalize_func_(std::move(finalize_func)), argument_type_(std::move(argument_type)), return_type_(std::move(return_type)),
-          state_size_(state_size) {}
+          finalize_func_(std::move(finalize_func)), scatter_update_func_(std::move(scatter_update_func)), argument_type_(std::move(argument_type)),
+          return_type_(std::move(return_type)), state_size_(state_size) {}
 
     void CastArgumentTypes(BaseExpression &input_argument);
 
@@ -133,6 +190,7 @@ public:
     AggregateInitializeFuncType init_func_;
     AggregateUpdateFuncType update_func_;
     AggregateFinalizeFuncType finalize_func_;
+    AggregateScatterUpdateFuncType scatter_update_func_;
 
     DataType argument_type_;
     DataType return_type_;
@@ -148,7 +206,8 @@ inline AggregateFunction UnaryAggregate(const String &name, const DataType &inpu
                              AggregateState::Size(input_type),
                              AggregateOperation::StateInitialize<AggregateState>,
                              AggregateOperation::StateUpdate<AggregateState, InputType>,
-                             AggregateOperation::StateFinalize<AggregateState, ResultType>);
+                             AggregateOperation::StateFinalize<AggregateState, ResultType>,
+                             AggregateOperation::StateScatterUpdate<AggregateState, InputType>);
 }
 
 } // namespace infinity
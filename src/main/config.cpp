@@ -189,6 +189,15 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // Task stealing
+        String task_stealing = "off";
+        UniquePtr<StringOption> task_stealing_option = MakeUnique<StringOption>(TASK_STEALING_OPTION_NAME, task_stealing);
+        status = global_options_.AddOption(std::move(task_stealing_option));
+        if (!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Record running query
         bool record_running_query = false;
         record_running_query_ = record_running_query;
@@ -505,6 +514,16 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // Sort memory limit
+        i64 sort_memory_limit = DEFAULT_SORT_MEMORY_LIMIT;
+        UniquePtr<IntegerOption> sort_memory_limit_option =
+            MakeUnique<IntegerOption>(SORT_MEMORY_LIMIT_OPTION_NAME, sort_memory_limit, std::numeric_limits<i64>::max(), 0);
+        status = global_options_.AddOption(std::move(sort_memory_limit_option));
+        if (!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Dense index building worker
         i64 dense_index_building_worker = Thread::hardware_concurrency() / 2;
         if (dense_index_building_worker < 2) {
@@ -629,6 +648,28 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // WAL group commit delay
+        i64 wal_group_commit_delay = DEFAULT_WAL_GROUP_COMMIT_DELAY_US;
+        UniquePtr<IntegerOption> wal_group_commit_delay_option = MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_DELAY_OPTION_NAME,
+                                                                                           wal_group_commit_delay,
+                                                                                           MAX_WAL_GROUP_COMMIT_DELAY_US,
+                                                                                           MIN_WAL_GROUP_COMMIT_DELAY_US);
+        status = global_options_.AddOption(std::move(wal_group_commit_delay_option));
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+
+        // WAL group commit max batch
+        i64 wal_group_commit_max_batch = DEFAULT_WAL_GROUP_COMMIT_MAX_BATCH;
+        UniquePtr<IntegerOption> wal_group_commit_max_batch_option = MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_MAX_BATCH_OPTION_NAME,
+                                                                                               wal_group_commit_max_batch,
+                                                                                               MAX_WAL_GROUP_COMMIT_MAX_BATCH,
+                                                                                               MIN_WAL_GROUP_COMMIT_MAX_BATCH);
+        status = global_options_.AddOption(std::move(wal_group_commit_max_batch_option));
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+
         // Resource Dir
         String resource_dir = "/var/infinity/resource";
         if (default_config != nullptr) {
@@ -785,6 +826,26 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kTaskStealing: {
+                            String task_stealing = "off";
+                            if (elem.second.is_string()) {
+                                task_stealing = elem.second.value_or(task_stealing);
+                            } else {
+                                return Status::InvalidConfig("'task_stealing' field isn't string.");
+                            }
+
+                            ToLower(task_stealing);
+                            if (task_stealing == "off" or task_stealing == "on" or task_stealing == "numa") {
+                                UniquePtr<StringOption> task_stealing_option = MakeUnique<StringOption>(TASK_STEALING_OPTION_NAME, task_stealing);
+                                Status status = global_options_.AddOption(std::move(task_stealing_option));
+                                if (!status.ok()) {
+                                    UnrecoverableError(status.message());
+                                }
+                            } else {
+                                return Status::InvalidConfig(fmt::format("Invalid task stealing mode: {}", task_stealing));
+                            }
+                            break;
+                        }
                         case GlobalOptionIndex::kRecordRunningQuery: {
                             bool record_running_query = false;
                             if (elem.second.is_boolean()) {
@@ -848,6 +909,16 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                     }
                 }
 
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kTaskStealing) == nullptr) {
+                    // Task stealing
+                    String task_stealing = "off";
+                    UniquePtr<StringOption> task_stealing_option = MakeUnique<StringOption>(TASK_STEALING_OPTION_NAME, task_stealing);
+                    Status status = global_options_.AddOption(std::move(task_stealing_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
                 if (global_options_.GetOptionByIndex(GlobalOptionIndex::kRecordRunningQuery) == nullptr) {
                     // Record running query
                     bool record_running_query = false;
@@ -2176,6 +2247,22 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             global_options_.AddOption(std::move(mem_index_memory_quota_option));
                             break;
                         }
+                        case GlobalOptionIndex::kSortMemoryLimit: {
+                            i64 sort_memory_limit = DEFAULT_SORT_MEMORY_LIMIT;
+                            if (elem.second.is_string()) {
+                                String sort_memory_limit_str = elem.second.value_or(DEFAULT_SORT_MEMORY_LIMIT_STR.data());
+                                auto res = ParseByteSize(sort_memory_limit_str, sort_memory_limit);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'sort_memory_limit' field isn't string.");
+                            }
+                            UniquePtr<IntegerOption> sort_memory_limit_option =
+                                MakeUnique<IntegerOption>(SORT_MEMORY_LIMIT_OPTION_NAME, sort_memory_limit, std::numeric_limits<i64>::max(), 0);
+                            global_options_.AddOption(std::move(sort_memory_limit_option));
+                            break;
+                        }
                         case GlobalOptionIndex::kResultCache: {
                             String result_cache_str(DEFAULT_RESULT_CACHE);
                             if (elem.second.is_string()) {
@@ -2244,6 +2331,16 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                         UnrecoverableError(status.message());
                     }
                 }
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kSortMemoryLimit) == nullptr) {
+                    // Sort Memory Limit
+                    i64 sort_memory_limit = DEFAULT_SORT_MEMORY_LIMIT;
+                    UniquePtr<IntegerOption> sort_memory_limit_option =
+                        MakeUnique<IntegerOption>(SORT_MEMORY_LIMIT_OPTION_NAME, sort_memory_limit, std::numeric_limits<i64>::max(), 0);
+                    Status status = global_options_.AddOption(std::move(sort_memory_limit_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
                 if (global_options_.GetOptionByIndex(GlobalOptionIndex::kResultCache) == nullptr) {
                     // Result Cache Mode
                     String result_cache_str(DEFAULT_RESULT_CACHE);
@@ -2364,9 +2461,9 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                                 if (IsEqual(flush_option_str, "flush_at_once")) {
                                     flush_option_type = FlushOptionType::kFlushAtOnce;
                                 } else if (IsEqual(flush_option_str, "only_write")) {
-                                    flush_option_type = FlushOptionType::kFlushAtOnce;
+                                    flush_option_type = FlushOptionType::kOnlyWrite;
                                 } else if (IsEqual(flush_option_str, "flush_per_second")) {
-                                    flush_option_type = FlushOptionType::kFlushAtOnce;
+                                    flush_option_type = FlushOptionType::kFlushPerSecond;
                                 } else {
                                     return Status::InvalidConfig(fmt::format("Unsupported flush option: {}", flush_option_str));
                                 }
@@ -2381,6 +2478,51 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kWALGroupCommitDelay: {
+                            // WAL group commit delay in microseconds
+                            i64 wal_group_commit_delay = DEFAULT_WAL_GROUP_COMMIT_DELAY_US;
+                            if (elem.second.is_integer()) {
+                                wal_group_commit_delay = elem.second.value_or(wal_group_commit_delay);
+                            } else {
+                                return Status::InvalidConfig("'wal_group_commit_delay' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> wal_group_commit_delay_option = MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_DELAY_OPTION_NAME,
+                                                                                                               wal_group_commit_delay,
+                                                                                                               MAX_WAL_GROUP_COMMIT_DELAY_US,
+                                                                                                               MIN_WAL_GROUP_COMMIT_DELAY_US);
+                            if (!wal_group_commit_delay_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid WAL group commit delay: {}", wal_group_commit_delay));
+                            }
+                            Status status = global_options_.AddOption(std::move(wal_group_commit_delay_option));
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kWALGroupCommitMaxBatch: {
+                            // WAL group commit max batch
+                            i64 wal_group_commit_max_batch = DEFAULT_WAL_GROUP_COMMIT_MAX_BATCH;
+                            if (elem.second.is_integer()) {
+                                wal_group_commit_max_batch = elem.second.value_or(wal_group_commit_max_batch);
+                            } else {
+                                return Status::InvalidConfig("'wal_group_commit_max_batch' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> wal_group_commit_max_batch_option =
+                                MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_MAX_BATCH_OPTION_NAME,
+                                                          wal_group_commit_max_batch,
+                                                          MAX_WAL_GROUP_COMMIT_MAX_BATCH,
+                                                          MIN_WAL_GROUP_COMMIT_MAX_BATCH);
+                            if (!wal_group_commit_max_batch_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid WAL group commit max batch: {}", wal_group_commit_max_batch));
+                            }
+                            Status status = global_options_.AddOption(std::move(wal_group_commit_max_batch_option));
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'wal' field", var_name));
                         }
@@ -2432,6 +2574,32 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                         UnrecoverableError(status.message());
                     }
                 }
+
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kWALGroupCommitDelay) == nullptr) {
+                    // WAL group commit delay
+                    i64 wal_group_commit_delay = DEFAULT_WAL_GROUP_COMMIT_DELAY_US;
+                    UniquePtr<IntegerOption> wal_group_commit_delay_option = MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_DELAY_OPTION_NAME,
+                                                                                                       wal_group_commit_delay,
+                                                                                                       MAX_WAL_GROUP_COMMIT_DELAY_US,
+                                                                                                       MIN_WAL_GROUP_COMMIT_DELAY_US);
+                    Status status = global_options_.AddOption(std::move(wal_group_commit_delay_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kWALGroupCommitMaxBatch) == nullptr) {
+                    // WAL group commit max batch
+                    i64 wal_group_commit_max_batch = DEFAULT_WAL_GROUP_COMMIT_MAX_BATCH;
+                    UniquePtr<IntegerOption> wal_group_commit_max_batch_option = MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_MAX_BATCH_OPTION_NAME,
+                                                                                                           wal_group_commit_max_batch,
+                                                                                                           MAX_WAL_GROUP_COMMIT_MAX_BATCH,
+                                                                                                           MIN_WAL_GROUP_COMMIT_MAX_BATCH);
+                    Status status = global_options_.AddOption(std::move(wal_group_commit_max_batch_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
             } else {
                 return Status::InvalidConfig("No 'wal' section in configure file.");
             }
@@ -2519,6 +2687,11 @@ i64 Config::CPULimit() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kWorkerCPULimit);
 }
 
+String Config::TaskStealing() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetStringValue(GlobalOptionIndex::kTaskStealing);
+}
+
 void Config::SetRecordRunningQuery(bool flag) {
     std::lock_guard<std::mutex> guard(mutex_);
     BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kRecordRunningQuery);
@@ -2829,6 +3002,11 @@ i64 Config::MemIndexMemoryQuota() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kMemIndexMemoryQuota);
 }
 
+i64 Config::SortMemoryLimit() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kSortMemoryLimit);
+}
+
 String Config::ResultCache() {
     std::lock_guard<std::mutex> guard(mutex_);
     return global_options_.GetStringValue(GlobalOptionIndex::kResultCache);
@@ -2889,6 +3067,16 @@ FlushOptionType Config::FlushMethodAtCommit() {
     return flush_option->value_;
 }
 
+i64 Config::WALGroupCommitDelay() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kWALGroupCommitDelay);
+}
+
+i64 Config::WALGroupCommitMaxBatch() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kWALGroupCommitMaxBatch);
+}
+
 // Resource
 String Config::ResourcePath() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -2939,6 +3127,7 @@ void Config::PrintAll() {
     fmt::print(" - version: {}\n", Version());
     fmt::print(" - timezone: {}{}\n", TimeZone(), TimeZoneBias());
     fmt::print(" - cpu_limit: {}\n", CPULimit());
+    fmt::print(" - task_stealing: {}\n", TaskStealing());
     fmt::print(" - server mode: {}\n", ServerMode());
 
     //    // Profiler
@@ -2998,12 +3187,15 @@ void Config::PrintAll() {
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(BufferManagerSize()));
     fmt::print(" - temp_dir: {}\n", TempDir());
     fmt::print(" - memindex_memory_quota: {}\n", Utility::FormatByteSize(MemIndexMemoryQuota()));
+    fmt::print(" - sort_memory_limit: {}\n", Utility::FormatByteSize(SortMemoryLimit()));
 
     // WAL
     fmt::print(" - wal_dir: {}\n", WALDir());
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(WALCompactThreshold()));
     fmt::print(" - checkpoint_interval: {}\n", Utility::FormatTimeInfo(CheckpointInterval()));
     fmt::print(" - flush_method_at_commit: {}\n", FlushOptionTypeToString(FlushMethodAtCommit()));
+    fmt::print(" - wal_group_commit_delay: {}\n", WALGroupCommitDelay());
+    fmt::print(" - wal_group_commit_max_batch: {}\n", WALGroupCommitMaxBatch());
 
     // Resource dir
     fmt::print(" - resource_dir: {}\n", ResourcePath());
@@ -61,6 +61,8 @@ public:
 
     void SetCPULimit(i64 new_cpu_limit);
     i64 CPULimit();
+    // off, on, or numa: steal only from the workers on the same NUMA node
+    String TaskStealing();
     inline bool RecordRunningQuery() { return record_running_query_; }
     void SetRecordRunningQuery(bool flag);
 
@@ -133,6 +135,8 @@ public:
     String TempDir();
 
     i64 MemIndexMemoryQuota();
+    // Bytes of sorted runs an ORDER BY keeps in memory before spilling to the temp dir
+    i64 SortMemoryLimit();
 
     String ResultCache();
     i64 CacheResultNum();
@@ -152,6 +156,9 @@ public:
     i64 DeltaCheckpointThreshold();
 
     FlushOptionType FlushMethodAtCommit();
+    // Microseconds to wait for more transactions before syncing a batch
+    i64 WALGroupCommitDelay();
+    i64 WALGroupCommitMaxBatch();
 
     // Resource
     String ResourcePath();
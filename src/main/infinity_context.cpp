@@ -511,6 +511,8 @@ void InfinityContext::SetIndexThreadPool() {
     inverting_thread_pool_.resize(config_->FulltextIndexBuildingWorker());
     commiting_thread_pool_.resize(config_->FulltextIndexBuildingWorker());
     hnsw_build_thread_pool_.resize(config_->DenseIndexBuildingWorker());
+    fulltext_search_thread_pool_.resize(config_->CPULimit());
+    aggregate_merge_thread_pool_.resize(config_->CPULimit());
 }
 
 void InfinityContext::RestoreIndexThreadPoolToDefault() {
@@ -518,6 +520,8 @@ void InfinityContext::RestoreIndexThreadPoolToDefault() {
     inverting_thread_pool_.resize(config_->FulltextIndexBuildingWorker());
     commiting_thread_pool_.resize(config_->FulltextIndexBuildingWorker());
     hnsw_build_thread_pool_.resize(config_->DenseIndexBuildingWorker());
+    fulltext_search_thread_pool_.resize(config_->CPULimit());
+    aggregate_merge_thread_pool_.resize(config_->CPULimit());
 }
 
 void InfinityContext::AddThriftServerFn(std::function<void()> start_func, std::function<void()> stop_func) {
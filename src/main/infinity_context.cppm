@@ -51,6 +51,8 @@ public:
     [[nodiscard]] inline ThreadPool &GetFulltextInvertingThreadPool() { return inverting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetFulltextCommitingThreadPool() { return commiting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetHnswBuildThreadPool() { return hnsw_build_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetFulltextSearchThreadPool() { return fulltext_search_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetAggregateMergeThreadPool() { return aggregate_merge_thread_pool_; }
 
     NodeRole GetServerRole() const;
 
@@ -98,6 +100,12 @@ private:
     // For hnsw index
     ThreadPool hnsw_build_thread_pool_{2};
 
+    // For the partitions of one fulltext query, they must not wait on the fragment workers running the query
+    ThreadPool fulltext_search_thread_pool_{2};
+
+    // For the partition ranges of one merge aggregate, same reason as above
+    ThreadPool aggregate_merge_thread_pool_{2};
+
     std::function<void()> start_servers_func_{};
     std::function<void()> stop_servers_func_{};
     atomic_bool start_server_{false};
@@ -33,6 +33,7 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(TIME_ZONE_OPTION_NAME)] = GlobalOptionIndex::kTimeZone;
     name2index_[String(TIME_ZONE_BIAS_OPTION_NAME)] = GlobalOptionIndex::kTimeZoneBias;
     name2index_[String(CPU_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kWorkerCPULimit;
+    name2index_[String(TASK_STEALING_OPTION_NAME)] = GlobalOptionIndex::kTaskStealing;
     name2index_[String(SERVER_ADDRESS_OPTION_NAME)] = GlobalOptionIndex::kServerAddress;
     name2index_[String(PEER_SERVER_IP_OPTION_NAME)] = GlobalOptionIndex::kPeerServerIP;
     name2index_[String(PEER_SERVER_PORT_OPTION_NAME)] = GlobalOptionIndex::kPeerServerPort;
@@ -79,6 +80,7 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(LRU_NUM_OPTION_NAME)] = GlobalOptionIndex::kLRUNum;
     name2index_[String(TEMP_DIR_OPTION_NAME)] = GlobalOptionIndex::kTempDir;
     name2index_[String(MEMINDEX_MEMORY_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kMemIndexMemoryQuota;
+    name2index_[String(SORT_MEMORY_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kSortMemoryLimit;
 
     name2index_[String(DENSE_INDEX_BUILDING_WORKER_OPTION_NAME)] = GlobalOptionIndex::kDenseIndexBuildingWorker;
     name2index_[String(SPARSE_INDEX_BUILDING_WORKER_OPTION_NAME)] = GlobalOptionIndex::kSparseIndexBuildingWorker;
@@ -93,6 +95,8 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(CHECKPOINT_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kCheckpointInterval;
 
     name2index_[String(WAL_FLUSH_OPTION_NAME)] = GlobalOptionIndex::kFlushMethodAtCommit;
+    name2index_[String(WAL_GROUP_COMMIT_DELAY_OPTION_NAME)] = GlobalOptionIndex::kWALGroupCommitDelay;
+    name2index_[String(WAL_GROUP_COMMIT_MAX_BATCH_OPTION_NAME)] = GlobalOptionIndex::kWALGroupCommitMaxBatch;
     name2index_[String(RESOURCE_DIR_OPTION_NAME)] = GlobalOptionIndex::kResourcePath;
     name2index_[String(SNAPSHOT_DIR_OPTION_NAME)] = GlobalOptionIndex::kSnapshotDir;
 
@@ -173,7 +173,11 @@ export enum class GlobalOptionIndex : i8 {
     kSnapshotDir = 54,
     kCatalogDir = 55,
     kReplayWal = 56,
-    kInvalid = 57,
+    kTaskStealing = 57,
+    kWALGroupCommitDelay = 58,
+    kWALGroupCommitMaxBatch = 59,
+    kSortMemoryLimit = 60,
+    kInvalid = 61,
 };
 
 export struct GlobalOptions {
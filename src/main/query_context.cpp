@@ -58,6 +58,9 @@ import persistence_manager;
 import global_resource_usage;
 import infinity_context;
 import txn_state;
+import data_table;
+import column_def;
+import data_type;
 
 import new_txn;
 import new_txn_manager;
@@ -338,6 +341,54 @@ QueryResult QueryContext::QueryStatementInternal(const BaseStatement *base_state
     return query_result;
 }
 
+QueryResult QueryContext::DescribeStatement(const BaseStatement *base_statement) {
+    QueryResult query_result;
+    if (!InfinityContext::instance().InfinityContextStarted()) {
+        query_result.result_table_ = nullptr;
+        query_result.status_ = Status::InfinityIsStarting();
+        return query_result;
+    }
+
+    try {
+        this->BeginTxn(base_statement);
+
+        SharedPtr<BindContext> bind_context;
+        Status status = logical_planner_->Build(base_statement, bind_context);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        const SharedPtr<LogicalNode> logical_plan = logical_planner_->LogicalPlans().back();
+        SharedPtr<Vector<String>> output_names = logical_plan->GetOutputNames();
+        SharedPtr<Vector<SharedPtr<DataType>>> output_types = logical_plan->GetOutputTypes();
+
+        Vector<SharedPtr<ColumnDef>> column_defs;
+        SizeT column_count = output_names->size();
+        column_defs.reserve(column_count);
+        for (SizeT col_idx = 0; col_idx < column_count; ++col_idx) {
+            column_defs.emplace_back(
+                MakeShared<ColumnDef>(col_idx, output_types->at(col_idx), output_names->at(col_idx), std::set<ConstraintType>()));
+        }
+        query_result.result_table_ = DataTable::MakeResultTable(column_defs);
+        query_result.root_operator_type_ = logical_plan->operator_type();
+
+        this->CommitTxn();
+    } catch (RecoverableException &e) {
+        NewTxn *new_txn = this->GetNewTxn();
+        if (new_txn != nullptr) {
+            TxnState txn_state = new_txn->GetTxnState();
+            if (txn_state == TxnState::kRollbacking or txn_state == TxnState::kStarted) {
+                this->RollbackTxn();
+            }
+        }
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(e.ErrorCode(), e.what());
+    } catch (ParserException &e) {
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(ErrorCode::kParserError, e.what());
+    }
+    return query_result;
+}
+
 void QueryContext::CreateQueryProfiler() {
     bool query_profiler_flag = false;
     NewCatalog *catalog = InfinityContext::instance().storage()->new_catalog();
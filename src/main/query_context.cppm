@@ -73,6 +73,9 @@ public:
 
     QueryResult QueryStatementInternal(const BaseStatement *statement);
 
+    // Binds and plans a select without executing it, the result table only holds the output columns.
+    QueryResult DescribeStatement(const BaseStatement *statement);
+
     bool ExecuteBGStatement(BaseStatement *statement, BGQueryState &state);
 
     bool JoinBGStatement(BGQueryState &state, TxnTimeStamp &commit_ts, bool rollback = false);
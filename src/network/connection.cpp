@@ -40,6 +40,10 @@ import embedding_info;
 import sparse_info;
 import data_type;
 import global_resource_usage;
+import status;
+import sql_parser;
+import base_statement;
+import pg_prepared_statement;
 
 namespace infinity {
 
@@ -120,19 +124,38 @@ void Connection::HandleRequest() {
 
     switch (cmd_type) {
         case PGMessageType::kBindCommand: {
-            LOG_TRACE("BindCommand");
+            const PGBindMessage bind_message = pg_handler_->read_bind_body();
+            if (!skip_until_sync_) {
+                HandleBind(bind_message);
+            }
             break;
         }
         case PGMessageType::kDescribeCommand: {
-            LOG_TRACE("DescribeCommand");
+            const PGTargetMessage describe_message = pg_handler_->read_target_body();
+            if (!skip_until_sync_) {
+                HandleDescribe(describe_message, query_context_ptr.get());
+            }
             break;
         }
         case PGMessageType::kExecuteCommand: {
-            LOG_TRACE("ExecuteCommand");
+            const PGExecuteMessage execute_message = pg_handler_->read_execute_body();
+            if (!skip_until_sync_) {
+                HandleExecute(execute_message, query_context_ptr.get());
+            }
             break;
         }
         case PGMessageType::kParseCommand: {
-            LOG_TRACE("ParseCommand");
+            const PGParseMessage parse_message = pg_handler_->read_parse_body();
+            if (!skip_until_sync_) {
+                HandleParse(parse_message);
+            }
+            break;
+        }
+        case PGMessageType::kCloseCommand: {
+            const PGTargetMessage close_message = pg_handler_->read_target_body();
+            if (!skip_until_sync_) {
+                HandleClose(close_message);
+            }
             break;
         }
         case PGMessageType::kSimpleQueryCommand: {
@@ -140,7 +163,14 @@ void Connection::HandleRequest() {
             break;
         }
         case PGMessageType::kSyncCommand: {
-            LOG_TRACE("SyncCommand");
+            pg_handler_->skip_command_body();
+            skip_until_sync_ = false;
+            pg_handler_->send_ready_for_query();
+            break;
+        }
+        case PGMessageType::kFlushCommand: {
+            pg_handler_->skip_command_body();
+            pg_handler_->flush();
             break;
         }
         case PGMessageType::kTerminateCommand: {
@@ -175,7 +205,148 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     pg_handler_->send_ready_for_query();
 }
 
-void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
+void Connection::HandleParse(const PGParseMessage &parse_message) {
+    LOG_TRACE(fmt::format("Parse: {}", parse_message.query_));
+    if (parser_ == nullptr) {
+        parser_ = MakeUnique<SQLParser>();
+    }
+    auto prepared_statement = MakeShared<PGPreparedStatement>(parse_message.query_, parse_message.parameter_types_);
+    Status status = prepared_statement->Parse(parser_.get());
+    if (!status.ok()) {
+        HandleExtendedQueryError(status.message());
+        return;
+    }
+    prepared_statements_[parse_message.statement_name_] = std::move(prepared_statement);
+    pg_handler_->SendStatusMessage(PGMessageType::kParseComplete);
+}
+
+void Connection::HandleBind(const PGBindMessage &bind_message) {
+    auto iter = prepared_statements_.find(bind_message.statement_name_);
+    if (iter == prepared_statements_.end()) {
+        HandleExtendedQueryError(fmt::format("Prepared statement \"{}\" doesn't exist", bind_message.statement_name_));
+        return;
+    }
+    PGPortal portal;
+    portal.statement_ = iter->second;
+    Status status = portal.statement_->BindParameters(bind_message, portal.parameters_);
+    if (!status.ok()) {
+        HandleExtendedQueryError(status.message());
+        return;
+    }
+    portals_[bind_message.portal_name_] = std::move(portal);
+    pg_handler_->SendStatusMessage(PGMessageType::kBindComplete);
+}
+
+void Connection::HandleDescribe(const PGTargetMessage &describe_message, QueryContext *query_context) {
+    if (describe_message.target_type_ == 'S') {
+        auto iter = prepared_statements_.find(describe_message.name_);
+        if (iter == prepared_statements_.end()) {
+            HandleExtendedQueryError(fmt::format("Prepared statement \"{}\" doesn't exist", describe_message.name_));
+            return;
+        }
+        PGPreparedStatement *prepared_statement = iter->second.get();
+        // Open parameter types are announced as text, that is what the client should send then.
+        Vector<u32> parameter_types = prepared_statement->parameter_types();
+        for (u32 &object_id : parameter_types) {
+            if (object_id == 0) {
+                object_id = 25;
+            }
+        }
+        pg_handler_->SendParameterDescription(parameter_types);
+
+        // The output columns are only known after binding. Selects are bound and planned with NULL parameters,
+        // show and explain don't read table data and are run to get them.
+        switch (prepared_statement->statement()->Type()) {
+            case StatementType::kSelect: {
+                prepared_statement->ApplyParameters(Vector<PGBoundParameter>(parameter_types.size()));
+                QueryResult result = query_context->DescribeStatement(prepared_statement->statement());
+                if (result.result_table_.get() != nullptr && SendTableDescription(result.result_table_)) {
+                    return;
+                }
+                break;
+            }
+            case StatementType::kShow:
+            case StatementType::kExplain: {
+                PGPortal portal;
+                portal.statement_ = iter->second;
+                portal.parameters_.resize(parameter_types.size());
+                QueryResult &result = RunPortal(portal, query_context);
+                if (result.result_table_.get() != nullptr && SendTableDescription(result.result_table_)) {
+                    return;
+                }
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+        pg_handler_->SendStatusMessage(PGMessageType::kNoData);
+        return;
+    }
+
+    auto iter = portals_.find(describe_message.name_);
+    if (iter == portals_.end()) {
+        HandleExtendedQueryError(fmt::format("Portal \"{}\" doesn't exist", describe_message.name_));
+        return;
+    }
+    QueryResult &result = RunPortal(iter->second, query_context);
+    if (result.result_table_.get() == nullptr) {
+        String error_message = result.status_.message();
+        iter->second.result_.reset();
+        HandleExtendedQueryError(error_message);
+        return;
+    }
+    if (!SendTableDescription(result.result_table_)) {
+        pg_handler_->SendStatusMessage(PGMessageType::kNoData);
+    }
+}
+
+void Connection::HandleExecute(const PGExecuteMessage &execute_message, QueryContext *query_context) {
+    auto iter = portals_.find(execute_message.portal_name_);
+    if (iter == portals_.end()) {
+        HandleExtendedQueryError(fmt::format("Portal \"{}\" doesn't exist", execute_message.portal_name_));
+        return;
+    }
+    // Row limit isn't supported, the whole result is sent at once.
+    QueryResult &result = RunPortal(iter->second, query_context);
+    if (result.result_table_.get() == nullptr) {
+        String error_message = result.status_.message();
+        iter->second.result_.reset();
+        HandleExtendedQueryError(error_message);
+        return;
+    }
+    SendQueryResponse(result);
+    iter->second.result_.reset();
+}
+
+void Connection::HandleClose(const PGTargetMessage &close_message) {
+    if (close_message.target_type_ == 'S') {
+        prepared_statements_.erase(close_message.name_);
+    } else {
+        portals_.erase(close_message.name_);
+    }
+    pg_handler_->SendStatusMessage(PGMessageType::kCloseComplete);
+}
+
+QueryResult &Connection::RunPortal(PGPortal &portal, QueryContext *query_context) {
+    if (!portal.result_.has_value()) {
+        // Skips lexing and parsing, the statement is bound and optimized against the snapshot of this execution.
+        portal.statement_->ApplyParameters(portal.parameters_);
+        query_context->CreateQueryProfiler();
+        portal.result_ = query_context->QueryStatement(portal.statement_->statement());
+    }
+    return portal.result_.value();
+}
+
+void Connection::HandleExtendedQueryError(const String &error_message) {
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = error_message;
+    LOG_ERROR(error_message);
+    pg_handler_->send_error_response(error_message_map);
+    skip_until_sync_ = true;
+}
+
+bool Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
     u32 column_name_length_sum = 0;
     SizeT column_count = result_table->ColumnCount();
     for (SizeT idx = 0; idx < column_count; ++idx) {
@@ -184,7 +355,7 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
     // No output columns, no need to send table description, just return.
     if (column_name_length_sum == 0)
-        return;
+        return false;
 
     pg_handler_->SendDescriptionHeader(column_name_length_sum, column_count);
 
@@ -385,6 +556,7 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
         pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width);
     }
+    return true;
 }
 
 void Connection::SendQueryResponse(const QueryResult &query_result) {
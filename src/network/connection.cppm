@@ -23,6 +23,8 @@ import pg_protocol_handler;
 import query_context;
 import data_table;
 import query_result;
+import sql_parser;
+import pg_prepared_statement;
 
 namespace infinity {
 
@@ -52,7 +54,24 @@ private:
 
     void HandlerSimpleQuery(QueryContext *query_context);
 
-    void SendTableDescription(const SharedPtr<DataTable> &result_table);
+    // Extended query protocol
+    void HandleParse(const PGParseMessage &parse_message);
+
+    void HandleBind(const PGBindMessage &bind_message);
+
+    void HandleDescribe(const PGTargetMessage &describe_message, QueryContext *query_context);
+
+    void HandleExecute(const PGExecuteMessage &execute_message, QueryContext *query_context);
+
+    void HandleClose(const PGTargetMessage &close_message);
+
+    QueryResult &RunPortal(PGPortal &portal, QueryContext *query_context);
+
+    // Reports the error and discards the following extended query messages until Sync.
+    void HandleExtendedQueryError(const String &error_message);
+
+    // Returns false when the result has no columns to describe.
+    bool SendTableDescription(const SharedPtr<DataTable> &result_table);
 
     void SendQueryResponse(const QueryResult &query_result);
 
@@ -66,6 +85,12 @@ private:
     bool terminate_connection_ = false;
 
     SharedPtr<RemoteSession> session_{};
+
+    // Prepared statements and portals of this session, the unnamed ones are stored under "".
+    UniquePtr<SQLParser> parser_{};
+    HashMap<String, SharedPtr<PGPreparedStatement>> prepared_statements_{};
+    HashMap<String, PGPortal> portals_{};
+    bool skip_until_sync_{false};
 };
 
 } // namespace infinity
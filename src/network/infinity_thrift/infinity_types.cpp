@@ -13001,7 +13001,8 @@ SelectRequest::SelectRequest() noexcept
    : session_id(0),
      db_name(),
      table_name(),
-     total_hits_count(0) {
+     total_hits_count(0),
+     arrow_result(0) {
 
 
 
@@ -13068,6 +13069,11 @@ void SelectRequest::__set_total_hits_count(const bool val) {
   this->total_hits_count = val;
 __isset.total_hits_count = true;
 }
+
+void SelectRequest::__set_arrow_result(const bool val) {
+  this->arrow_result = val;
+__isset.arrow_result = true;
+}
 std::ostream& operator<<(std::ostream& out, const SelectRequest& obj)
 {
   obj.printTo(out);
@@ -13248,6 +13254,14 @@ uint32_t SelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 14:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->arrow_result);
+          this->__isset.arrow_result = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -13358,6 +13372,11 @@ uint32_t SelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
     xfer += oprot->writeBool(this->total_hits_count);
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.arrow_result) {
+    xfer += oprot->writeFieldBegin("arrow_result", ::apache::thrift::protocol::T_BOOL, 14);
+    xfer += oprot->writeBool(this->arrow_result);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -13378,6 +13397,7 @@ void swap(SelectRequest &a, SelectRequest &b) {
   swap(a.offset_expr, b.offset_expr);
   swap(a.order_by_list, b.order_by_list);
   swap(a.total_hits_count, b.total_hits_count);
+  swap(a.arrow_result, b.arrow_result);
   swap(a.__isset, b.__isset);
 }
 
@@ -13427,6 +13447,10 @@ bool SelectRequest::operator==(const SelectRequest & rhs) const
     return false;
   else if (__isset.total_hits_count && !(total_hits_count == rhs.total_hits_count))
     return false;
+  if (__isset.arrow_result != rhs.__isset.arrow_result)
+    return false;
+  else if (__isset.arrow_result && !(arrow_result == rhs.arrow_result))
+    return false;
   return true;
 }
 
@@ -13444,6 +13468,7 @@ SelectRequest::SelectRequest(const SelectRequest& other482) {
   offset_expr = other482.offset_expr;
   order_by_list = other482.order_by_list;
   total_hits_count = other482.total_hits_count;
+  arrow_result = other482.arrow_result;
   __isset = other482.__isset;
 }
 SelectRequest& SelectRequest::operator=(const SelectRequest& other483) {
@@ -13460,6 +13485,7 @@ SelectRequest& SelectRequest::operator=(const SelectRequest& other483) {
   offset_expr = other483.offset_expr;
   order_by_list = other483.order_by_list;
   total_hits_count = other483.total_hits_count;
+  arrow_result = other483.arrow_result;
   __isset = other483.__isset;
   return *this;
 }
@@ -13479,6 +13505,7 @@ void SelectRequest::printTo(std::ostream& out) const {
   out << ", " << "offset_expr="; (__isset.offset_expr ? (out << to_string(offset_expr)) : (out << "<null>"));
   out << ", " << "order_by_list="; (__isset.order_by_list ? (out << to_string(order_by_list)) : (out << "<null>"));
   out << ", " << "total_hits_count="; (__isset.total_hits_count ? (out << to_string(total_hits_count)) : (out << "<null>"));
+  out << ", " << "arrow_result="; (__isset.arrow_result ? (out << to_string(arrow_result)) : (out << "<null>"));
   out << ")";
 }
 
@@ -13489,7 +13516,8 @@ SelectResponse::~SelectResponse() noexcept {
 SelectResponse::SelectResponse() noexcept
    : error_code(0),
      error_msg(),
-     extra_result() {
+     extra_result(),
+     arrow_ipc() {
 
 
 }
@@ -13513,6 +13541,11 @@ void SelectResponse::__set_column_fields(const std::vector<ColumnField> & val) {
 void SelectResponse::__set_extra_result(const std::string& val) {
   this->extra_result = val;
 }
+
+void SelectResponse::__set_arrow_ipc(const std::string& val) {
+  this->arrow_ipc = val;
+__isset.arrow_ipc = true;
+}
 std::ostream& operator<<(std::ostream& out, const SelectResponse& obj)
 {
   obj.printTo(out);
@@ -13605,6 +13638,14 @@ uint32_t SelectResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->arrow_ipc);
+          this->__isset.arrow_ipc = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -13658,6 +13699,11 @@ uint32_t SelectResponse::write(::apache::thrift::protocol::TProtocol* oprot) con
   xfer += oprot->writeString(this->extra_result);
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.arrow_ipc) {
+    xfer += oprot->writeFieldBegin("arrow_ipc", ::apache::thrift::protocol::T_STRING, 6);
+    xfer += oprot->writeBinary(this->arrow_ipc);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -13670,6 +13716,7 @@ void swap(SelectResponse &a, SelectResponse &b) {
   swap(a.column_defs, b.column_defs);
   swap(a.column_fields, b.column_fields);
   swap(a.extra_result, b.extra_result);
+  swap(a.arrow_ipc, b.arrow_ipc);
   swap(a.__isset, b.__isset);
 }
 
@@ -13685,6 +13732,10 @@ bool SelectResponse::operator==(const SelectResponse & rhs) const
     return false;
   if (!(extra_result == rhs.extra_result))
     return false;
+  if (__isset.arrow_ipc != rhs.__isset.arrow_ipc)
+    return false;
+  else if (__isset.arrow_ipc && !(arrow_ipc == rhs.arrow_ipc))
+    return false;
   return true;
 }
 
@@ -13694,6 +13745,7 @@ SelectResponse::SelectResponse(const SelectResponse& other496) {
   column_defs = other496.column_defs;
   column_fields = other496.column_fields;
   extra_result = other496.extra_result;
+  arrow_ipc = other496.arrow_ipc;
   __isset = other496.__isset;
 }
 SelectResponse& SelectResponse::operator=(const SelectResponse& other497) {
@@ -13702,6 +13754,7 @@ SelectResponse& SelectResponse::operator=(const SelectResponse& other497) {
   column_defs = other497.column_defs;
   column_fields = other497.column_fields;
   extra_result = other497.extra_result;
+  arrow_ipc = other497.arrow_ipc;
   __isset = other497.__isset;
   return *this;
 }
@@ -13713,6 +13766,7 @@ void SelectResponse::printTo(std::ostream& out) const {
   out << ", " << "column_defs=" << to_string(column_defs);
   out << ", " << "column_fields=" << to_string(column_fields);
   out << ", " << "extra_result=" << to_string(extra_result);
+  out << ", " << "arrow_ipc="; (__isset.arrow_ipc ? (out << to_string(arrow_ipc)) : (out << "<null>"));
   out << ")";
 }
 
@@ -3580,7 +3580,7 @@ void swap(ExplainResponse &a, ExplainResponse &b);
 std::ostream& operator<<(std::ostream& out, const ExplainResponse& obj);
 
 typedef struct _SelectRequest__isset {
-  _SelectRequest__isset() : session_id(false), db_name(false), table_name(false), select_list(true), highlight_list(true), search_expr(false), where_expr(false), group_by_list(true), having_expr(false), limit_expr(false), offset_expr(false), order_by_list(true), total_hits_count(false) {}
+  _SelectRequest__isset() : session_id(false), db_name(false), table_name(false), select_list(true), highlight_list(true), search_expr(false), where_expr(false), group_by_list(true), having_expr(false), limit_expr(false), offset_expr(false), order_by_list(true), total_hits_count(false), arrow_result(false) {}
   bool session_id :1;
   bool db_name :1;
   bool table_name :1;
@@ -3594,6 +3594,7 @@ typedef struct _SelectRequest__isset {
   bool offset_expr :1;
   bool order_by_list :1;
   bool total_hits_count :1;
+  bool arrow_result :1;
 } _SelectRequest__isset;
 
 class SelectRequest : public virtual ::apache::thrift::TBase {
@@ -3617,6 +3618,7 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
   ParsedExpr offset_expr;
   std::vector<OrderByExpr>  order_by_list;
   bool total_hits_count;
+  bool arrow_result;
 
   _SelectRequest__isset __isset;
 
@@ -3646,6 +3648,8 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
 
   void __set_total_hits_count(const bool val);
 
+  void __set_arrow_result(const bool val);
+
   bool operator == (const SelectRequest & rhs) const;
   bool operator != (const SelectRequest &rhs) const {
     return !(*this == rhs);
@@ -3664,12 +3668,13 @@ void swap(SelectRequest &a, SelectRequest &b);
 std::ostream& operator<<(std::ostream& out, const SelectRequest& obj);
 
 typedef struct _SelectResponse__isset {
-  _SelectResponse__isset() : error_code(false), error_msg(false), column_defs(true), column_fields(true), extra_result(false) {}
+  _SelectResponse__isset() : error_code(false), error_msg(false), column_defs(true), column_fields(true), extra_result(false), arrow_ipc(false) {}
   bool error_code :1;
   bool error_msg :1;
   bool column_defs :1;
   bool column_fields :1;
   bool extra_result :1;
+  bool arrow_ipc :1;
 } _SelectResponse__isset;
 
 class SelectResponse : public virtual ::apache::thrift::TBase {
@@ -3685,6 +3690,7 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
   std::vector<ColumnDef>  column_defs;
   std::vector<ColumnField>  column_fields;
   std::string extra_result;
+  std::string arrow_ipc;
 
   _SelectResponse__isset __isset;
 
@@ -3698,6 +3704,8 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
 
   void __set_extra_result(const std::string& val);
 
+  void __set_arrow_ipc(const std::string& val);
+
   bool operator == (const SelectResponse & rhs) const;
   bool operator != (const SelectResponse &rhs) const {
     return !(*this == rhs);
@@ -64,6 +64,7 @@ import defer_op;
 
 import column_vector;
 import query_result;
+import arrow_ipc_writer;
 
 namespace infinity {
 
@@ -733,9 +734,13 @@ void InfinityThriftService::Select(infinity_thrift_rpc::SelectResponse &response
     // auto start4 = std::chrono::steady_clock::now();
 
     if (result.IsOk()) {
-        auto &columns = response.column_fields;
-        columns.resize(result.result_table_->ColumnCount());
-        ProcessDataBlocks(result, response, columns);
+        if (request.__isset.arrow_result && request.arrow_result) {
+            ProcessArrowDataBlocks(result, response);
+        } else {
+            auto &columns = response.column_fields;
+            columns.resize(result.result_table_->ColumnCount());
+            ProcessDataBlocks(result, response, columns);
+        }
     } else {
         ProcessQueryResult(response, result);
     }
@@ -2880,13 +2885,42 @@ void InfinityThriftService::ProcessDataBlocks(const QueryResult &result,
         }
     }
 
+    HandleTotalHitsCount(result, response);
+
+    const SizeT column_count = result.result_table_->ColumnCount();
+    if (column_count != columns.size()) {
+        ProcessStatus(response, Status::ColumnCountMismatch(fmt::format("expect: {}, actual: {}", column_count, columns.size())));
+        return;
+    }
+    HandleColumnDef(response, column_count, result.result_table_->definition_ptr_);
+}
+
+void InfinityThriftService::ProcessArrowDataBlocks(const QueryResult &result, infinity_thrift_rpc::SelectResponse &response) {
+    Status status = ArrowIPCWriter::Serialize(*result.result_table_, response.arrow_ipc);
+    if (status.code() == ErrorCode::kNotSupported) {
+        // columns without an arrow counterpart are sent as column fields
+        response.arrow_ipc.clear();
+        auto &columns = response.column_fields;
+        columns.resize(result.result_table_->ColumnCount());
+        ProcessDataBlocks(result, response, columns);
+        return;
+    }
+    if (!status.ok()) {
+        ProcessStatus(response, status);
+        return;
+    }
+    response.__isset.arrow_ipc = true;
+
+    HandleTotalHitsCount(result, response);
+    HandleColumnDef(response, result.result_table_->ColumnCount(), result.result_table_->definition_ptr_);
+}
+
+void InfinityThriftService::HandleTotalHitsCount(const QueryResult &result, infinity_thrift_rpc::SelectResponse &response) {
     if (result.result_table_->total_hits_count_flag_) {
         nlohmann::json json_response;
         json_response["total_hits_count"] = result.result_table_->total_hits_count_;
         response.extra_result = json_response.dump();
     }
-
-    HandleColumnDef(response, result.result_table_->ColumnCount(), result.result_table_->definition_ptr_, columns);
 }
 
 Status
@@ -2904,14 +2938,7 @@ InfinityThriftService::ProcessColumns(const SharedPtr<DataBlock> &data_block, Si
     return Status::OK();
 }
 
-void InfinityThriftService::HandleColumnDef(infinity_thrift_rpc::SelectResponse &response,
-                                            SizeT column_count,
-                                            SharedPtr<TableDef> table_def,
-                                            Vector<infinity_thrift_rpc::ColumnField> &all_column_vectors) {
-    if (column_count != all_column_vectors.size()) {
-        ProcessStatus(response, Status::ColumnCountMismatch(fmt::format("expect: {}, actual: {}", column_count, all_column_vectors.size())));
-        return;
-    }
+void InfinityThriftService::HandleColumnDef(infinity_thrift_rpc::SelectResponse &response, SizeT column_count, SharedPtr<TableDef> table_def) {
     for (SizeT col_index = 0; col_index < column_count; ++col_index) {
         auto column_def = table_def->columns()[col_index];
         infinity_thrift_rpc::ColumnDef proto_column_def;
@@ -224,12 +224,13 @@ private:
     void
     ProcessDataBlocks(const QueryResult &result, infinity_thrift_rpc::SelectResponse &response, Vector<infinity_thrift_rpc::ColumnField> &columns);
 
+    void ProcessArrowDataBlocks(const QueryResult &result, infinity_thrift_rpc::SelectResponse &response);
+
     Status ProcessColumns(const SharedPtr<DataBlock> &data_block, SizeT column_count, Vector<infinity_thrift_rpc::ColumnField> &columns);
 
-    void HandleColumnDef(infinity_thrift_rpc::SelectResponse &response,
-                         SizeT column_count,
-                         SharedPtr<TableDef> table_def,
-                         Vector<infinity_thrift_rpc::ColumnField> &all_column_vectors);
+    void HandleTotalHitsCount(const QueryResult &result, infinity_thrift_rpc::SelectResponse &response);
+
+    void HandleColumnDef(infinity_thrift_rpc::SelectResponse &response, SizeT column_count, SharedPtr<TableDef> table_def);
 
     Status
     ProcessColumnFieldType(infinity_thrift_rpc::ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector);
@@ -40,6 +40,11 @@ enum class PGMessageType : unsigned char {
     kRowDescription = 'T',
     kData = 'D',
     kComplete = 'C',
+    kParseComplete = '1',
+    kBindComplete = '2',
+    kCloseComplete = '3',
+    kNoData = 'n',
+    kParameterDescription = 't',
 
     // Errors
     kHumanReadableError = 'M',
@@ -0,0 +1,351 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstdlib>
+#include <cctype>
+#include <cstring>
+
+module pg_prepared_statement;
+
+import stl;
+import status;
+import third_party;
+import sql_parser;
+import parser_result;
+import base_statement;
+import constant_expr;
+import pg_protocol_handler;
+
+namespace infinity {
+
+namespace {
+
+// https://www.postgresql.org/docs/14/datatype-oid.html
+constexpr u32 kBoolOID = 16;
+constexpr u32 kInt8OID = 20;
+constexpr u32 kInt2OID = 21;
+constexpr u32 kInt4OID = 23;
+constexpr u32 kFloat4OID = 700;
+constexpr u32 kFloat8OID = 701;
+constexpr u32 kNumericOID = 1700;
+constexpr u32 kDateOID = 1082;
+constexpr u32 kTimeOID = 1083;
+constexpr u32 kTimestampOID = 1114;
+constexpr u32 kTimestampTzOID = 1184;
+
+constexpr i16 kTextFormat = 0;
+
+bool ParseInteger(const String &text, i64 &value) {
+    auto res = std::from_chars(text.data(), text.data() + text.size(), value);
+    return res.ec == std::errc() && res.ptr == text.data() + text.size();
+}
+
+bool ParseDouble(const String &text, f64 &value) {
+    if (text.empty()) {
+        return false;
+    }
+    char *end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    return end == text.c_str() + text.size();
+}
+
+bool ParseBool(const String &text, bool &value) {
+    String lower = text;
+    ToLower(lower);
+    if (lower == "t" || lower == "true" || lower == "1" || lower == "on" || lower == "yes") {
+        value = true;
+        return true;
+    }
+    if (lower == "f" || lower == "false" || lower == "0" || lower == "off" || lower == "no") {
+        value = false;
+        return true;
+    }
+    return false;
+}
+
+u64 ReadNetworkInteger(const String &bytes) {
+    u64 value = 0;
+    for (char byte : bytes) {
+        value = (value << 8) | static_cast<u8>(byte);
+    }
+    return value;
+}
+
+Status DecodeText(u32 type_oid, const String &text, PGBoundParameter &parameter) {
+    switch (type_oid) {
+        case kBoolOID: {
+            parameter.literal_type_ = LiteralType::kBoolean;
+            if (!ParseBool(text, parameter.bool_value_)) {
+                return Status::InvalidParameterValue("boolean", text, "true or false");
+            }
+            break;
+        }
+        case kInt2OID:
+        case kInt4OID:
+        case kInt8OID: {
+            parameter.literal_type_ = LiteralType::kInteger;
+            if (!ParseInteger(text, parameter.integer_value_)) {
+                return Status::InvalidParameterValue("integer", text, "an integer");
+            }
+            break;
+        }
+        case kFloat4OID:
+        case kFloat8OID:
+        case kNumericOID: {
+            parameter.literal_type_ = LiteralType::kDouble;
+            if (!ParseDouble(text, parameter.double_value_)) {
+                return Status::InvalidParameterValue("float", text, "a number");
+            }
+            break;
+        }
+        case kDateOID: {
+            parameter.literal_type_ = LiteralType::kDate;
+            parameter.str_value_ = text;
+            break;
+        }
+        case kTimeOID: {
+            parameter.literal_type_ = LiteralType::kTime;
+            parameter.str_value_ = text;
+            break;
+        }
+        case kTimestampOID: {
+            parameter.literal_type_ = LiteralType::kDateTime;
+            parameter.str_value_ = text;
+            break;
+        }
+        case kTimestampTzOID: {
+            parameter.literal_type_ = LiteralType::kTimestamp;
+            parameter.str_value_ = text;
+            break;
+        }
+        case 0: {
+            // Type left open by the client: take the narrowest literal the text parses as.
+            if (ParseInteger(text, parameter.integer_value_)) {
+                parameter.literal_type_ = LiteralType::kInteger;
+            } else if (ParseDouble(text, parameter.double_value_)) {
+                parameter.literal_type_ = LiteralType::kDouble;
+            } else {
+                parameter.literal_type_ = LiteralType::kString;
+                parameter.str_value_ = text;
+            }
+            break;
+        }
+        default: {
+            parameter.literal_type_ = LiteralType::kString;
+            parameter.str_value_ = text;
+        }
+    }
+    return Status::OK();
+}
+
+Status DecodeBinary(u32 type_oid, const String &bytes, PGBoundParameter &parameter) {
+    auto check_size = [&](SizeT size) { return bytes.size() == size; };
+    switch (type_oid) {
+        case kBoolOID: {
+            if (!check_size(1)) {
+                break;
+            }
+            parameter.literal_type_ = LiteralType::kBoolean;
+            parameter.bool_value_ = bytes[0] != 0;
+            return Status::OK();
+        }
+        case kInt2OID: {
+            if (!check_size(sizeof(i16))) {
+                break;
+            }
+            parameter.literal_type_ = LiteralType::kInteger;
+            parameter.integer_value_ = static_cast<i16>(ReadNetworkInteger(bytes));
+            return Status::OK();
+        }
+        case kInt4OID: {
+            if (!check_size(sizeof(i32))) {
+                break;
+            }
+            parameter.literal_type_ = LiteralType::kInteger;
+            parameter.integer_value_ = static_cast<i32>(ReadNetworkInteger(bytes));
+            return Status::OK();
+        }
+        case kInt8OID: {
+            if (!check_size(sizeof(i64))) {
+                break;
+            }
+            parameter.literal_type_ = LiteralType::kInteger;
+            parameter.integer_value_ = static_cast<i64>(ReadNetworkInteger(bytes));
+            return Status::OK();
+        }
+        case kFloat4OID: {
+            if (!check_size(sizeof(f32))) {
+                break;
+            }
+            parameter.literal_type_ = LiteralType::kDouble;
+            parameter.double_value_ = std::bit_cast<f32>(static_cast<u32>(ReadNetworkInteger(bytes)));
+            return Status::OK();
+        }
+        case kFloat8OID: {
+            if (!check_size(sizeof(f64))) {
+                break;
+            }
+            parameter.literal_type_ = LiteralType::kDouble;
+            parameter.double_value_ = std::bit_cast<f64>(ReadNetworkInteger(bytes));
+            return Status::OK();
+        }
+        default: {
+            return Status::NotSupport(fmt::format("Binary format of parameter type {}", type_oid));
+        }
+    }
+    return Status::InvalidParameterValue("binary parameter", fmt::format("{} bytes", bytes.size()), fmt::format("the size of type {}", type_oid));
+}
+
+} // namespace
+
+PGPreparedStatement::PGPreparedStatement(String query, Vector<u32> parameter_types)
+    : query_(std::move(query)), parameter_types_(std::move(parameter_types)) {}
+
+String PGPreparedStatement::RewritePlaceholders() {
+    String rewritten;
+    rewritten.reserve(query_.size());
+    char quote = 0;
+    SizeT parameter_count = parameter_types_.size();
+    for (SizeT pos = 0; pos < query_.size(); ++pos) {
+        const char c = query_[pos];
+        if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+            rewritten.push_back(c);
+            continue;
+        }
+        if (c == '\'' || c == '"') {
+            quote = c;
+            rewritten.push_back(c);
+            continue;
+        }
+        if (c == '$' && pos + 1 < query_.size() && std::isdigit(static_cast<unsigned char>(query_[pos + 1]))) {
+            SizeT parameter_no = 0;
+            while (pos + 1 < query_.size() && std::isdigit(static_cast<unsigned char>(query_[pos + 1]))) {
+                parameter_no = parameter_no * 10 + (query_[++pos] - '0');
+            }
+            if (parameter_no == 0) {
+                // Not a valid parameter, let the parser report it.
+                rewritten.push_back('$');
+                continue;
+            }
+            placeholder_params_.emplace_back(parameter_no - 1);
+            parameter_count = std::max(parameter_count, parameter_no);
+            rewritten.push_back('?');
+            continue;
+        }
+        if (c == '?') {
+            placeholder_params_.emplace_back(placeholder_params_.size());
+            parameter_count = std::max(parameter_count, placeholder_params_.size());
+        }
+        rewritten.push_back(c);
+    }
+    parameter_types_.resize(parameter_count, 0);
+    return rewritten;
+}
+
+Status PGPreparedStatement::Parse(SQLParser *parser) {
+    const String rewritten = RewritePlaceholders();
+    parsed_result_ = MakeUnique<ParserResult>();
+    parsed_result_->allow_parameters_ = true;
+    parser->Parse(rewritten, parsed_result_.get());
+    if (parsed_result_->IsError()) {
+        return Status::InvalidCommand(parsed_result_->error_message_);
+    }
+    if (parsed_result_->statements_ptr_->size() != 1) {
+        return Status::InvalidCommand("Only support single statement.");
+    }
+    if (parsed_result_->parameters_.size() != placeholder_params_.size()) {
+        return Status::SyntaxError(fmt::format("Parameter placeholder isn't allowed here: {}", query_));
+    }
+    return Status::OK();
+}
+
+Status PGPreparedStatement::BindParameters(const PGBindMessage &bind_message, Vector<PGBoundParameter> &parameters) const {
+    const SizeT parameter_count = parameter_types_.size();
+    if (bind_message.parameter_values_.size() != parameter_count) {
+        return Status::SyntaxError(fmt::format("Bind message supplies {} parameters, but prepared statement requires {}",
+                                               bind_message.parameter_values_.size(),
+                                               parameter_count));
+    }
+    const SizeT format_count = bind_message.parameter_formats_.size();
+    if (format_count > 1 && format_count != parameter_count) {
+        return Status::SyntaxError(fmt::format("Bind message has {} parameter formats but {} parameters", format_count, parameter_count));
+    }
+
+    parameters.clear();
+    parameters.resize(parameter_count);
+    for (SizeT idx = 0; idx < parameter_count; ++idx) {
+        const Optional<String> &value = bind_message.parameter_values_[idx];
+        if (!value.has_value()) {
+            continue;
+        }
+        const i16 format = format_count == 0 ? kTextFormat : bind_message.parameter_formats_[format_count == 1 ? 0 : idx];
+        Status status = format == kTextFormat ? DecodeText(parameter_types_[idx], value.value(), parameters[idx])
+                                              : DecodeBinary(parameter_types_[idx], value.value(), parameters[idx]);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
+void PGPreparedStatement::ApplyParameters(const Vector<PGBoundParameter> &parameters) {
+    const auto &placeholders = parsed_result_->parameters_;
+    for (SizeT idx = 0; idx < placeholders.size(); ++idx) {
+        ConstantExpr *const_expr = placeholders[idx];
+        const PGBoundParameter &parameter = parameters[placeholder_params_[idx]];
+
+        // release the value of the previous execution
+        free(const_expr->str_value_);
+        const_expr->str_value_ = nullptr;
+        free(const_expr->date_value_);
+        const_expr->date_value_ = nullptr;
+
+        const_expr->literal_type_ = parameter.literal_type_;
+        switch (parameter.literal_type_) {
+            case LiteralType::kBoolean: {
+                const_expr->bool_value_ = parameter.bool_value_;
+                break;
+            }
+            case LiteralType::kInteger: {
+                const_expr->integer_value_ = parameter.integer_value_;
+                break;
+            }
+            case LiteralType::kDouble: {
+                const_expr->double_value_ = parameter.double_value_;
+                break;
+            }
+            case LiteralType::kString: {
+                const_expr->str_value_ = strdup(parameter.str_value_.c_str());
+                break;
+            }
+            case LiteralType::kDate:
+            case LiteralType::kTime:
+            case LiteralType::kDateTime:
+            case LiteralType::kTimestamp: {
+                const_expr->date_value_ = strdup(parameter.str_value_.c_str());
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+}
+
+} // namespace infinity
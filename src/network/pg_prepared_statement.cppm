@@ -0,0 +1,75 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module pg_prepared_statement;
+
+import stl;
+import status;
+import sql_parser;
+import parser_result;
+import base_statement;
+import constant_expr;
+import query_result;
+import pg_protocol_handler;
+
+namespace infinity {
+
+// A parameter value decoded from a Bind message, copied into the placeholders right before execution.
+export struct PGBoundParameter {
+    LiteralType literal_type_{LiteralType::kNull};
+    bool bool_value_{false};
+    i64 integer_value_{0};
+    f64 double_value_{0};
+    // string, date and time literals
+    String str_value_{};
+};
+
+// Statement created by a Parse message. The SQL is parsed once; '$n' placeholders are parsed as
+// constant expressions which are overwritten by the parameter values of each execution.
+export class PGPreparedStatement {
+public:
+    PGPreparedStatement(String query, Vector<u32> parameter_types);
+
+    Status Parse(SQLParser *parser);
+
+    Status BindParameters(const PGBindMessage &bind_message, Vector<PGBoundParameter> &parameters) const;
+
+    void ApplyParameters(const Vector<PGBoundParameter> &parameters);
+
+    [[nodiscard]] const BaseStatement *statement() const { return parsed_result_->statements_ptr_->at(0); }
+
+    // Type OIDs as specified by the client, 0 if it left the type open
+    [[nodiscard]] const Vector<u32> &parameter_types() const { return parameter_types_; }
+
+private:
+    // Replaces '$n' outside of quotes by '?', which is what the lexer accepts as a placeholder.
+    String RewritePlaceholders();
+
+    String query_{};
+    Vector<u32> parameter_types_{};
+    // Parameter index of each '?' in the rewritten query, in order of appearance
+    Vector<SizeT> placeholder_params_{};
+    UniquePtr<ParserResult> parsed_result_{};
+};
+
+export struct PGPortal {
+    SharedPtr<PGPreparedStatement> statement_{};
+    Vector<PGBoundParameter> parameters_{};
+    // Set when Describe already ran the portal, Execute sends it then
+    Optional<QueryResult> result_{};
+};
+
+} // namespace infinity
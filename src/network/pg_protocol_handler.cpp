@@ -19,9 +19,71 @@ import stl;
 import pg_message;
 module pg_protocol_handler;
 import global_resource_usage;
+import infinity_exception;
+import status;
 
 namespace infinity {
 
+namespace {
+
+// Walks a message body which was read in one piece, integers are in network byte order.
+class PGBodyReader {
+public:
+    explicit PGBodyReader(const String &body) : body_(body) {}
+
+    String ReadString() {
+        SizeT end_pos = body_.find(NULL_END, pos_);
+        if (end_pos == String::npos) {
+            RecoverableError(Status::InvalidCommand("Unterminated string in PG message"));
+        }
+        String result = body_.substr(pos_, end_pos - pos_);
+        pos_ = end_pos + 1;
+        return result;
+    }
+
+    String ReadBytes(SizeT length) {
+        CheckRemaining(length);
+        String result = body_.substr(pos_, length);
+        pos_ += length;
+        return result;
+    }
+
+    u32 ReadU32() {
+        CheckRemaining(sizeof(u32));
+        u32 value = 0;
+        for (SizeT i = 0; i < sizeof(u32); ++i) {
+            value = (value << 8) | static_cast<u8>(body_[pos_++]);
+        }
+        return value;
+    }
+
+    i32 ReadI32() { return static_cast<i32>(ReadU32()); }
+
+    i16 ReadI16() {
+        CheckRemaining(sizeof(u16));
+        u16 value = (static_cast<u8>(body_[pos_]) << 8) | static_cast<u8>(body_[pos_ + 1]);
+        pos_ += sizeof(u16);
+        return static_cast<i16>(value);
+    }
+
+    char ReadChar() {
+        CheckRemaining(1);
+        return body_[pos_++];
+    }
+
+private:
+    void CheckRemaining(SizeT length) const {
+        if (pos_ + length > body_.size()) {
+            RecoverableError(Status::InvalidCommand("Truncated PG message"));
+        }
+    }
+
+    const String &body_;
+    SizeT pos_{0};
+};
+
+} // namespace
+
 PGProtocolHandler::PGProtocolHandler(const SharedPtr<boost::asio::ip::tcp::socket> &socket) : buffer_reader_(socket), buffer_writer_(socket) {}
 
 PGProtocolHandler::~PGProtocolHandler() = default;
@@ -80,6 +142,92 @@ String PGProtocolHandler::read_command_body() {
     return buffer_reader_.read_string(command_length);
 }
 
+PGParseMessage PGProtocolHandler::read_parse_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    const String body = buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    PGBodyReader reader(body);
+
+    PGParseMessage message;
+    message.statement_name_ = reader.ReadString();
+    message.query_ = reader.ReadString();
+    const i16 parameter_count = reader.ReadI16();
+    message.parameter_types_.reserve(parameter_count);
+    for (i16 idx = 0; idx < parameter_count; ++idx) {
+        message.parameter_types_.emplace_back(reader.ReadU32());
+    }
+    return message;
+}
+
+PGBindMessage PGProtocolHandler::read_bind_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    const String body = buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    PGBodyReader reader(body);
+
+    PGBindMessage message;
+    message.portal_name_ = reader.ReadString();
+    message.statement_name_ = reader.ReadString();
+    const i16 format_count = reader.ReadI16();
+    message.parameter_formats_.reserve(format_count);
+    for (i16 idx = 0; idx < format_count; ++idx) {
+        message.parameter_formats_.emplace_back(reader.ReadI16());
+    }
+    const i16 parameter_count = reader.ReadI16();
+    message.parameter_values_.reserve(parameter_count);
+    for (i16 idx = 0; idx < parameter_count; ++idx) {
+        const i32 value_length = reader.ReadI32();
+        if (value_length < 0) {
+            message.parameter_values_.emplace_back(None);
+        } else {
+            message.parameter_values_.emplace_back(reader.ReadBytes(value_length));
+        }
+    }
+    // Result column formats are ignored, rows are always sent as text.
+    return message;
+}
+
+PGTargetMessage PGProtocolHandler::read_target_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    const String body = buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    PGBodyReader reader(body);
+
+    PGTargetMessage message;
+    message.target_type_ = reader.ReadChar();
+    message.name_ = reader.ReadString();
+    return message;
+}
+
+PGExecuteMessage PGProtocolHandler::read_execute_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    const String body = buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    PGBodyReader reader(body);
+
+    PGExecuteMessage message;
+    message.portal_name_ = reader.ReadString();
+    message.max_rows_ = reader.ReadU32();
+    return message;
+}
+
+void PGProtocolHandler::skip_command_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    if (body_length > 0) {
+        buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    }
+}
+
+void PGProtocolHandler::SendStatusMessage(PGMessageType message_type) {
+    buffer_writer_.send_value_u8(static_cast<u8>(message_type));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendParameterDescription(const Vector<u32> &parameter_types) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParameterDescription));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(u16) + parameter_types.size() * sizeof(u32));
+    buffer_writer_.send_value_u16(parameter_types.size());
+    for (u32 object_id : parameter_types) {
+        buffer_writer_.send_value_u32(object_id);
+    }
+}
+
 void PGProtocolHandler::send_error_response(const HashMap<PGMessageType, String> &error_response_map) {
     // message header
     buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kError));
@@ -23,6 +23,33 @@ export module pg_protocol_handler;
 
 namespace infinity {
 
+// Bodies of the extended query protocol messages
+export struct PGParseMessage {
+    String statement_name_{};
+    String query_{};
+    Vector<u32> parameter_types_{};
+};
+
+export struct PGBindMessage {
+    String portal_name_{};
+    String statement_name_{};
+    // Either empty (all text), a single code applying to all parameters, or one code per parameter
+    Vector<i16> parameter_formats_{};
+    // nullopt stands for a NULL parameter
+    Vector<Optional<String>> parameter_values_{};
+};
+
+// Describe and Close: 'S' for a prepared statement, 'P' for a portal
+export struct PGTargetMessage {
+    char target_type_{};
+    String name_{};
+};
+
+export struct PGExecuteMessage {
+    String portal_name_{};
+    u32 max_rows_{};
+};
+
 export class PGProtocolHandler {
 public:
     explicit PGProtocolHandler(const SharedPtr<boost::asio::ip::tcp::socket> &socket);
@@ -53,13 +80,24 @@ public:
     void SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum);
 
     void SendComplete(const String &complete_message);
-    //
-    //    pair<String, String> read_parse_packet();
-    //    void read_sync_packet();
-    //
-    //    void send_status_message(const PGMessageType message_type);
 
-    //    void force_flush() { buffer_writer_.flush(); }
+    PGParseMessage read_parse_body();
+
+    PGBindMessage read_bind_body();
+
+    PGTargetMessage read_target_body();
+
+    PGExecuteMessage read_execute_body();
+
+    // Sync and Flush carry no body
+    void skip_command_body();
+
+    // ParseComplete, BindComplete, CloseComplete and NoData
+    void SendStatusMessage(PGMessageType message_type);
+
+    void SendParameterDescription(const Vector<u32> &parameter_types);
+
+    void flush() { buffer_writer_.flush(); }
 
 private:
     BufferReader buffer_reader_;
@@ -334,129 +334,130 @@ enum yysymbol_kind_t
   YYSYMBOL_220_ = 220,                     /* '.'  */
   YYSYMBOL_221_ = 221,                     /* ';'  */
   YYSYMBOL_222_ = 222,                     /* ','  */
-  YYSYMBOL_223_ = 223,                     /* '}'  */
-  YYSYMBOL_224_ = 224,                     /* '{'  */
-  YYSYMBOL_225_ = 225,                     /* ':'  */
-  YYSYMBOL_YYACCEPT = 226,                 /* $accept  */
-  YYSYMBOL_input_pattern = 227,            /* input_pattern  */
-  YYSYMBOL_statement_list = 228,           /* statement_list  */
-  YYSYMBOL_statement = 229,                /* statement  */
-  YYSYMBOL_explainable_statement = 230,    /* explainable_statement  */
-  YYSYMBOL_create_statement = 231,         /* create_statement  */
-  YYSYMBOL_table_element_array = 232,      /* table_element_array  */
-  YYSYMBOL_column_def_array = 233,         /* column_def_array  */
-  YYSYMBOL_table_element = 234,            /* table_element  */
-  YYSYMBOL_table_column = 235,             /* table_column  */
-  YYSYMBOL_column_type_array = 236,        /* column_type_array  */
-  YYSYMBOL_column_type = 237,              /* column_type  */
-  YYSYMBOL_column_constraints = 238,       /* column_constraints  */
-  YYSYMBOL_column_constraint = 239,        /* column_constraint  */
-  YYSYMBOL_default_expr = 240,             /* default_expr  */
-  YYSYMBOL_table_constraint = 241,         /* table_constraint  */
-  YYSYMBOL_identifier_array = 242,         /* identifier_array  */
-  YYSYMBOL_delete_statement = 243,         /* delete_statement  */
-  YYSYMBOL_insert_statement = 244,         /* insert_statement  */
-  YYSYMBOL_optional_identifier_array = 245, /* optional_identifier_array  */
-  YYSYMBOL_explain_statement = 246,        /* explain_statement  */
-  YYSYMBOL_update_statement = 247,         /* update_statement  */
-  YYSYMBOL_update_expr_array = 248,        /* update_expr_array  */
-  YYSYMBOL_update_expr = 249,              /* update_expr  */
-  YYSYMBOL_drop_statement = 250,           /* drop_statement  */
-  YYSYMBOL_copy_statement = 251,           /* copy_statement  */
-  YYSYMBOL_select_statement = 252,         /* select_statement  */
-  YYSYMBOL_select_with_paren = 253,        /* select_with_paren  */
-  YYSYMBOL_select_without_paren = 254,     /* select_without_paren  */
-  YYSYMBOL_select_clause_with_modifier = 255, /* select_clause_with_modifier  */
-  YYSYMBOL_select_clause_without_modifier_paren = 256, /* select_clause_without_modifier_paren  */
-  YYSYMBOL_select_clause_without_modifier = 257, /* select_clause_without_modifier  */
-  YYSYMBOL_order_by_clause = 258,          /* order_by_clause  */
-  YYSYMBOL_order_by_expr_list = 259,       /* order_by_expr_list  */
-  YYSYMBOL_order_by_expr = 260,            /* order_by_expr  */
-  YYSYMBOL_order_by_type = 261,            /* order_by_type  */
-  YYSYMBOL_limit_expr = 262,               /* limit_expr  */
-  YYSYMBOL_offset_expr = 263,              /* offset_expr  */
-  YYSYMBOL_distinct = 264,                 /* distinct  */
-  YYSYMBOL_highlight_clause = 265,         /* highlight_clause  */
-  YYSYMBOL_from_clause = 266,              /* from_clause  */
-  YYSYMBOL_search_clause = 267,            /* search_clause  */
-  YYSYMBOL_optional_search_filter_expr = 268, /* optional_search_filter_expr  */
-  YYSYMBOL_where_clause = 269,             /* where_clause  */
-  YYSYMBOL_having_clause = 270,            /* having_clause  */
-  YYSYMBOL_group_by_clause = 271,          /* group_by_clause  */
-  YYSYMBOL_set_operator = 272,             /* set_operator  */
-  YYSYMBOL_table_reference = 273,          /* table_reference  */
-  YYSYMBOL_table_reference_unit = 274,     /* table_reference_unit  */
-  YYSYMBOL_table_reference_name = 275,     /* table_reference_name  */
-  YYSYMBOL_table_name = 276,               /* table_name  */
-  YYSYMBOL_table_alias = 277,              /* table_alias  */
-  YYSYMBOL_with_clause = 278,              /* with_clause  */
-  YYSYMBOL_with_expr_list = 279,           /* with_expr_list  */
-  YYSYMBOL_with_expr = 280,                /* with_expr  */
-  YYSYMBOL_join_clause = 281,              /* join_clause  */
-  YYSYMBOL_join_type = 282,                /* join_type  */
-  YYSYMBOL_show_statement = 283,           /* show_statement  */
-  YYSYMBOL_flush_statement = 284,          /* flush_statement  */
-  YYSYMBOL_optimize_statement = 285,       /* optimize_statement  */
-  YYSYMBOL_command_statement = 286,        /* command_statement  */
-  YYSYMBOL_compact_statement = 287,        /* compact_statement  */
-  YYSYMBOL_admin_statement = 288,          /* admin_statement  */
-  YYSYMBOL_alter_statement = 289,          /* alter_statement  */
-  YYSYMBOL_check_statement = 290,          /* check_statement  */
-  YYSYMBOL_expr_array = 291,               /* expr_array  */
-  YYSYMBOL_insert_row_list = 292,          /* insert_row_list  */
-  YYSYMBOL_expr_alias = 293,               /* expr_alias  */
-  YYSYMBOL_expr = 294,                     /* expr  */
-  YYSYMBOL_operand = 295,                  /* operand  */
-  YYSYMBOL_match_tensor_expr = 296,        /* match_tensor_expr  */
-  YYSYMBOL_match_vector_expr = 297,        /* match_vector_expr  */
-  YYSYMBOL_match_sparse_expr = 298,        /* match_sparse_expr  */
-  YYSYMBOL_match_text_expr = 299,          /* match_text_expr  */
-  YYSYMBOL_query_expr = 300,               /* query_expr  */
-  YYSYMBOL_fusion_expr = 301,              /* fusion_expr  */
-  YYSYMBOL_sub_search = 302,               /* sub_search  */
-  YYSYMBOL_sub_search_array = 303,         /* sub_search_array  */
-  YYSYMBOL_function_expr = 304,            /* function_expr  */
-  YYSYMBOL_conjunction_expr = 305,         /* conjunction_expr  */
-  YYSYMBOL_between_expr = 306,             /* between_expr  */
-  YYSYMBOL_in_expr = 307,                  /* in_expr  */
-  YYSYMBOL_case_expr = 308,                /* case_expr  */
-  YYSYMBOL_case_check_array = 309,         /* case_check_array  */
-  YYSYMBOL_cast_expr = 310,                /* cast_expr  */
-  YYSYMBOL_subquery_expr = 311,            /* subquery_expr  */
-  YYSYMBOL_column_expr = 312,              /* column_expr  */
-  YYSYMBOL_constant_expr = 313,            /* constant_expr  */
-  YYSYMBOL_common_array_expr = 314,        /* common_array_expr  */
-  YYSYMBOL_common_sparse_array_expr = 315, /* common_sparse_array_expr  */
-  YYSYMBOL_subarray_array_expr = 316,      /* subarray_array_expr  */
-  YYSYMBOL_unclosed_subarray_array_expr = 317, /* unclosed_subarray_array_expr  */
-  YYSYMBOL_sparse_array_expr = 318,        /* sparse_array_expr  */
-  YYSYMBOL_long_sparse_array_expr = 319,   /* long_sparse_array_expr  */
-  YYSYMBOL_unclosed_long_sparse_array_expr = 320, /* unclosed_long_sparse_array_expr  */
-  YYSYMBOL_double_sparse_array_expr = 321, /* double_sparse_array_expr  */
-  YYSYMBOL_unclosed_double_sparse_array_expr = 322, /* unclosed_double_sparse_array_expr  */
-  YYSYMBOL_empty_array_expr = 323,         /* empty_array_expr  */
-  YYSYMBOL_curly_brackets_expr = 324,      /* curly_brackets_expr  */
-  YYSYMBOL_unclosed_curly_brackets_expr = 325, /* unclosed_curly_brackets_expr  */
-  YYSYMBOL_int_sparse_ele = 326,           /* int_sparse_ele  */
-  YYSYMBOL_float_sparse_ele = 327,         /* float_sparse_ele  */
-  YYSYMBOL_array_expr = 328,               /* array_expr  */
-  YYSYMBOL_long_array_expr = 329,          /* long_array_expr  */
-  YYSYMBOL_unclosed_long_array_expr = 330, /* unclosed_long_array_expr  */
-  YYSYMBOL_double_array_expr = 331,        /* double_array_expr  */
-  YYSYMBOL_unclosed_double_array_expr = 332, /* unclosed_double_array_expr  */
-  YYSYMBOL_interval_expr = 333,            /* interval_expr  */
-  YYSYMBOL_copy_option_list = 334,         /* copy_option_list  */
-  YYSYMBOL_copy_option = 335,              /* copy_option  */
-  YYSYMBOL_file_path = 336,                /* file_path  */
-  YYSYMBOL_if_exists = 337,                /* if_exists  */
-  YYSYMBOL_if_not_exists = 338,            /* if_not_exists  */
-  YYSYMBOL_semicolon = 339,                /* semicolon  */
-  YYSYMBOL_if_not_exists_info = 340,       /* if_not_exists_info  */
-  YYSYMBOL_with_index_param_list = 341,    /* with_index_param_list  */
-  YYSYMBOL_optional_table_properties_list = 342, /* optional_table_properties_list  */
-  YYSYMBOL_index_param_list = 343,         /* index_param_list  */
-  YYSYMBOL_index_param = 344,              /* index_param  */
-  YYSYMBOL_index_info = 345                /* index_info  */
+  YYSYMBOL_223_ = 223,                     /* '?'  */
+  YYSYMBOL_224_ = 224,                     /* '}'  */
+  YYSYMBOL_225_ = 225,                     /* '{'  */
+  YYSYMBOL_226_ = 226,                     /* ':'  */
+  YYSYMBOL_YYACCEPT = 227,                 /* $accept  */
+  YYSYMBOL_input_pattern = 228,            /* input_pattern  */
+  YYSYMBOL_statement_list = 229,           /* statement_list  */
+  YYSYMBOL_statement = 230,                /* statement  */
+  YYSYMBOL_explainable_statement = 231,    /* explainable_statement  */
+  YYSYMBOL_create_statement = 232,         /* create_statement  */
+  YYSYMBOL_table_element_array = 233,      /* table_element_array  */
+  YYSYMBOL_column_def_array = 234,         /* column_def_array  */
+  YYSYMBOL_table_element = 235,            /* table_element  */
+  YYSYMBOL_table_column = 236,             /* table_column  */
+  YYSYMBOL_column_type_array = 237,        /* column_type_array  */
+  YYSYMBOL_column_type = 238,              /* column_type  */
+  YYSYMBOL_column_constraints = 239,       /* column_constraints  */
+  YYSYMBOL_column_constraint = 240,        /* column_constraint  */
+  YYSYMBOL_default_expr = 241,             /* default_expr  */
+  YYSYMBOL_table_constraint = 242,         /* table_constraint  */
+  YYSYMBOL_identifier_array = 243,         /* identifier_array  */
+  YYSYMBOL_delete_statement = 244,         /* delete_statement  */
+  YYSYMBOL_insert_statement = 245,         /* insert_statement  */
+  YYSYMBOL_optional_identifier_array = 246, /* optional_identifier_array  */
+  YYSYMBOL_explain_statement = 247,        /* explain_statement  */
+  YYSYMBOL_update_statement = 248,         /* update_statement  */
+  YYSYMBOL_update_expr_array = 249,        /* update_expr_array  */
+  YYSYMBOL_update_expr = 250,              /* update_expr  */
+  YYSYMBOL_drop_statement = 251,           /* drop_statement  */
+  YYSYMBOL_copy_statement = 252,           /* copy_statement  */
+  YYSYMBOL_select_statement = 253,         /* select_statement  */
+  YYSYMBOL_select_with_paren = 254,        /* select_with_paren  */
+  YYSYMBOL_select_without_paren = 255,     /* select_without_paren  */
+  YYSYMBOL_select_clause_with_modifier = 256, /* select_clause_with_modifier  */
+  YYSYMBOL_select_clause_without_modifier_paren = 257, /* select_clause_without_modifier_paren  */
+  YYSYMBOL_select_clause_without_modifier = 258, /* select_clause_without_modifier  */
+  YYSYMBOL_order_by_clause = 259,          /* order_by_clause  */
+  YYSYMBOL_order_by_expr_list = 260,       /* order_by_expr_list  */
+  YYSYMBOL_order_by_expr = 261,            /* order_by_expr  */
+  YYSYMBOL_order_by_type = 262,            /* order_by_type  */
+  YYSYMBOL_limit_expr = 263,               /* limit_expr  */
+  YYSYMBOL_offset_expr = 264,              /* offset_expr  */
+  YYSYMBOL_distinct = 265,                 /* distinct  */
+  YYSYMBOL_highlight_clause = 266,         /* highlight_clause  */
+  YYSYMBOL_from_clause = 267,              /* from_clause  */
+  YYSYMBOL_search_clause = 268,            /* search_clause  */
+  YYSYMBOL_optional_search_filter_expr = 269, /* optional_search_filter_expr  */
+  YYSYMBOL_where_clause = 270,             /* where_clause  */
+  YYSYMBOL_having_clause = 271,            /* having_clause  */
+  YYSYMBOL_group_by_clause = 272,          /* group_by_clause  */
+  YYSYMBOL_set_operator = 273,             /* set_operator  */
+  YYSYMBOL_table_reference = 274,          /* table_reference  */
+  YYSYMBOL_table_reference_unit = 275,     /* table_reference_unit  */
+  YYSYMBOL_table_reference_name = 276,     /* table_reference_name  */
+  YYSYMBOL_table_name = 277,               /* table_name  */
+  YYSYMBOL_table_alias = 278,              /* table_alias  */
+  YYSYMBOL_with_clause = 279,              /* with_clause  */
+  YYSYMBOL_with_expr_list = 280,           /* with_expr_list  */
+  YYSYMBOL_with_expr = 281,                /* with_expr  */
+  YYSYMBOL_join_clause = 282,              /* join_clause  */
+  YYSYMBOL_join_type = 283,                /* join_type  */
+  YYSYMBOL_show_statement = 284,           /* show_statement  */
+  YYSYMBOL_flush_statement = 285,          /* flush_statement  */
+  YYSYMBOL_optimize_statement = 286,       /* optimize_statement  */
+  YYSYMBOL_command_statement = 287,        /* command_statement  */
+  YYSYMBOL_compact_statement = 288,        /* compact_statement  */
+  YYSYMBOL_admin_statement = 289,          /* admin_statement  */
+  YYSYMBOL_alter_statement = 290,          /* alter_statement  */
+  YYSYMBOL_check_statement = 291,          /* check_statement  */
+  YYSYMBOL_expr_array = 292,               /* expr_array  */
+  YYSYMBOL_insert_row_list = 293,          /* insert_row_list  */
+  YYSYMBOL_expr_alias = 294,               /* expr_alias  */
+  YYSYMBOL_expr = 295,                     /* expr  */
+  YYSYMBOL_operand = 296,                  /* operand  */
+  YYSYMBOL_match_tensor_expr = 297,        /* match_tensor_expr  */
+  YYSYMBOL_match_vector_expr = 298,        /* match_vector_expr  */
+  YYSYMBOL_match_sparse_expr = 299,        /* match_sparse_expr  */
+  YYSYMBOL_match_text_expr = 300,          /* match_text_expr  */
+  YYSYMBOL_query_expr = 301,               /* query_expr  */
+  YYSYMBOL_fusion_expr = 302,              /* fusion_expr  */
+  YYSYMBOL_sub_search = 303,               /* sub_search  */
+  YYSYMBOL_sub_search_array = 304,         /* sub_search_array  */
+  YYSYMBOL_function_expr = 305,            /* function_expr  */
+  YYSYMBOL_conjunction_expr = 306,         /* conjunction_expr  */
+  YYSYMBOL_between_expr = 307,             /* between_expr  */
+  YYSYMBOL_in_expr = 308,                  /* in_expr  */
+  YYSYMBOL_case_expr = 309,                /* case_expr  */
+  YYSYMBOL_case_check_array = 310,         /* case_check_array  */
+  YYSYMBOL_cast_expr = 311,                /* cast_expr  */
+  YYSYMBOL_subquery_expr = 312,            /* subquery_expr  */
+  YYSYMBOL_column_expr = 313,              /* column_expr  */
+  YYSYMBOL_constant_expr = 314,            /* constant_expr  */
+  YYSYMBOL_common_array_expr = 315,        /* common_array_expr  */
+  YYSYMBOL_common_sparse_array_expr = 316, /* common_sparse_array_expr  */
+  YYSYMBOL_subarray_array_expr = 317,      /* subarray_array_expr  */
+  YYSYMBOL_unclosed_subarray_array_expr = 318, /* unclosed_subarray_array_expr  */
+  YYSYMBOL_sparse_array_expr = 319,        /* sparse_array_expr  */
+  YYSYMBOL_long_sparse_array_expr = 320,   /* long_sparse_array_expr  */
+  YYSYMBOL_unclosed_long_sparse_array_expr = 321, /* unclosed_long_sparse_array_expr  */
+  YYSYMBOL_double_sparse_array_expr = 322, /* double_sparse_array_expr  */
+  YYSYMBOL_unclosed_double_sparse_array_expr = 323, /* unclosed_double_sparse_array_expr  */
+  YYSYMBOL_empty_array_expr = 324,         /* empty_array_expr  */
+  YYSYMBOL_curly_brackets_expr = 325,      /* curly_brackets_expr  */
+  YYSYMBOL_unclosed_curly_brackets_expr = 326, /* unclosed_curly_brackets_expr  */
+  YYSYMBOL_int_sparse_ele = 327,           /* int_sparse_ele  */
+  YYSYMBOL_float_sparse_ele = 328,         /* float_sparse_ele  */
+  YYSYMBOL_array_expr = 329,               /* array_expr  */
+  YYSYMBOL_long_array_expr = 330,          /* long_array_expr  */
+  YYSYMBOL_unclosed_long_array_expr = 331, /* unclosed_long_array_expr  */
+  YYSYMBOL_double_array_expr = 332,        /* double_array_expr  */
+  YYSYMBOL_unclosed_double_array_expr = 333, /* unclosed_double_array_expr  */
+  YYSYMBOL_interval_expr = 334,            /* interval_expr  */
+  YYSYMBOL_copy_option_list = 335,         /* copy_option_list  */
+  YYSYMBOL_copy_option = 336,              /* copy_option  */
+  YYSYMBOL_file_path = 337,                /* file_path  */
+  YYSYMBOL_if_exists = 338,                /* if_exists  */
+  YYSYMBOL_if_not_exists = 339,            /* if_not_exists  */
+  YYSYMBOL_semicolon = 340,                /* semicolon  */
+  YYSYMBOL_if_not_exists_info = 341,       /* if_not_exists_info  */
+  YYSYMBOL_with_index_param_list = 342,    /* with_index_param_list  */
+  YYSYMBOL_optional_table_properties_list = 343, /* optional_table_properties_list  */
+  YYSYMBOL_index_param_list = 344,         /* index_param_list  */
+  YYSYMBOL_index_param = 345,              /* index_param  */
+  YYSYMBOL_index_info = 346                /* index_info  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -470,7 +471,7 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
 #endif
 
-#line 474 "parser.cpp"
+#line 475 "parser.cpp"
 
 #ifdef short
 # undef short
@@ -796,16 +797,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  131
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1563
+#define YYLAST   1611
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  226
+#define YYNTOKENS  227
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  120
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  550
+#define YYNRULES  551
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1256
+#define YYNSTATES  1257
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   462
@@ -827,14 +828,14 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,   215,     2,     2,
      218,   219,   213,   211,   222,   212,   220,   214,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   225,   221,
-     209,   208,   210,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   226,   221,
+     209,   208,   210,   223,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,   216,     2,   217,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   224,     2,   223,     2,     2,     2,     2,
+       2,     2,     2,   225,     2,   224,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -912,25 +913,25 @@ static const yytype_int16 yyrline[] =
     2530,  2534,  2538,  2544,  2548,  2552,  2558,  2564,  2572,  2578,
     2582,  2588,  2592,  2598,  2603,  2608,  2615,  2624,  2634,  2643,
     2655,  2667,  2671,  2687,  2691,  2696,  2706,  2728,  2734,  2738,
-    2739,  2740,  2741,  2742,  2744,  2747,  2753,  2756,  2757,  2758,
-    2759,  2760,  2761,  2762,  2763,  2764,  2765,  2769,  2785,  2802,
-    2820,  2866,  2905,  2948,  2995,  3019,  3042,  3063,  3084,  3093,
-    3104,  3115,  3129,  3136,  3146,  3152,  3164,  3167,  3170,  3173,
-    3176,  3179,  3183,  3187,  3192,  3200,  3208,  3217,  3224,  3231,
-    3238,  3245,  3252,  3259,  3266,  3273,  3280,  3287,  3294,  3302,
-    3310,  3318,  3326,  3334,  3342,  3350,  3358,  3366,  3374,  3382,
-    3390,  3420,  3428,  3437,  3445,  3454,  3462,  3468,  3475,  3481,
-    3488,  3493,  3500,  3507,  3515,  3528,  3534,  3540,  3547,  3555,
-    3562,  3569,  3574,  3584,  3589,  3594,  3599,  3604,  3609,  3614,
-    3619,  3624,  3629,  3632,  3635,  3638,  3642,  3645,  3648,  3651,
-    3655,  3658,  3661,  3665,  3669,  3674,  3679,  3682,  3686,  3690,
-    3697,  3704,  3708,  3715,  3722,  3726,  3729,  3733,  3737,  3742,
-    3746,  3750,  3753,  3757,  3761,  3766,  3771,  3775,  3780,  3785,
-    3791,  3797,  3803,  3809,  3815,  3821,  3827,  3833,  3839,  3845,
-    3851,  3862,  3866,  3871,  3902,  3912,  3917,  3922,  3927,  3933,
-    3937,  3938,  3940,  3941,  3943,  3944,  3956,  3964,  3968,  3971,
-    3975,  3978,  3982,  3986,  3991,  3997,  4007,  4017,  4025,  4036,
-    4067
+    2739,  2740,  2741,  2742,  2744,  2747,  2753,  2756,  2766,  2767,
+    2768,  2769,  2770,  2771,  2772,  2773,  2774,  2775,  2779,  2795,
+    2812,  2830,  2876,  2915,  2958,  3005,  3029,  3052,  3073,  3094,
+    3103,  3114,  3125,  3139,  3146,  3156,  3162,  3174,  3177,  3180,
+    3183,  3186,  3189,  3193,  3197,  3202,  3210,  3218,  3227,  3234,
+    3241,  3248,  3255,  3262,  3269,  3276,  3283,  3290,  3297,  3304,
+    3312,  3320,  3328,  3336,  3344,  3352,  3360,  3368,  3376,  3384,
+    3392,  3400,  3430,  3438,  3447,  3455,  3464,  3472,  3478,  3485,
+    3491,  3498,  3503,  3510,  3517,  3525,  3538,  3544,  3550,  3557,
+    3565,  3572,  3579,  3584,  3594,  3599,  3604,  3609,  3614,  3619,
+    3624,  3629,  3634,  3639,  3642,  3645,  3648,  3652,  3655,  3658,
+    3661,  3665,  3668,  3671,  3675,  3679,  3684,  3689,  3692,  3696,
+    3700,  3707,  3714,  3718,  3725,  3732,  3736,  3739,  3743,  3747,
+    3752,  3756,  3760,  3763,  3767,  3771,  3776,  3781,  3785,  3790,
+    3795,  3801,  3807,  3813,  3819,  3825,  3831,  3837,  3843,  3849,
+    3855,  3861,  3872,  3876,  3881,  3912,  3922,  3927,  3932,  3937,
+    3943,  3947,  3948,  3950,  3951,  3953,  3954,  3966,  3974,  3978,
+    3981,  3985,  3988,  3992,  3996,  4001,  4007,  4017,  4027,  4035,
+    4046,  4077
 };
 #endif
 
@@ -977,7 +978,7 @@ static const char *const yytname[] =
   "RECOVER", "RESTORE", "PERSISTENCE", "OBJECT", "OBJECTS", "FILES",
   "MEMORY", "ALLOCATION", "HISTORY", "CHECK", "CLEAN", "NUMBER", "'='",
   "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'", "'['", "']'", "'('",
-  "')'", "'.'", "';'", "','", "'}'", "'{'", "':'", "$accept",
+  "')'", "'.'", "';'", "','", "'?'", "'}'", "'{'", "':'", "$accept",
   "input_pattern", "statement_list", "statement", "explainable_statement",
   "create_statement", "table_element_array", "column_def_array",
   "table_element", "table_column", "column_type_array", "column_type",
@@ -1030,7 +1031,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-538)
+#define YYTABLE_NINF (-539)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -1039,132 +1040,132 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     988,    15,    81,   164,    61,    18,    61,   151,   880,   912,
-     111,   205,   244,   288,   207,   284,   291,   147,    92,   476,
-      57,   166,   -38,   345,   110,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,  -758,   435,  -758,  -758,   341,  -758,  -758,  -758,
-    -758,  -758,  -758,  -758,  -758,   300,   300,   300,   300,   312,
-     381,    61,   334,   334,   334,   334,   334,   430,   204,   401,
-      61,    -5,   456,   482,   500,   365,  -758,  -758,  -758,  -758,
-    -758,  -758,  -758,   435,  -758,  -758,  -758,  -758,  -758,   226,
-     516,    61,  -758,  -758,  -758,  -758,  -758,     8,  -758,   322,
-     382,  -758,   520,  -758,  -758,   394,   540,  -758,   525,  -758,
-     252,   276,    61,    61,   565,  -758,  -758,  -758,  -758,  -758,
-     -43,  -758,   518,   352,  -758,   564,   398,   414,   298,   676,
-     442,   572,   396,   527,   447,   484,    61,  -758,  -758,   387,
-     406,  -758,    66,  -758,   608,  -758,  -758,    22,   594,  -758,
-     616,   612,   686,    61,    61,    61,   691,   635,   637,   498,
-     627,   699,    61,    61,    61,   716,  -758,   728,   732,   672,
-     749,   749,   648,   109,   127,   131,  -758,   542,  -758,   478,
-    -758,  -758,  -758,   759,  -758,   760,  -758,   749,  -758,  -758,
-     761,  -758,  -758,  -758,  -758,   397,  -758,   703,    61,   551,
-     291,   749,  -758,   766,  -758,   607,  -758,   768,  -758,  -758,
-     772,  -758,   770,  -758,   774,   777,  -758,   778,   727,   783,
-     595,   788,   790,  -758,  -758,  -758,  -758,  -758,    22,  -758,
-    -758,  -758,   648,   743,   730,   725,   666,   -34,  -758,   498,
-    -758,    61,   279,   798,    64,  -758,  -758,  -758,  -758,  -758,
-     741,  -758,   596,   -32,  -758,   648,  -758,  -758,   726,   729,
-     589,  -758,  -758,   885,   738,   590,   591,   463,   808,   809,
-     810,   811,  -758,  -758,   812,   598,   599,   601,   603,   605,
-     606,   610,   467,   619,   623,   829,   829,  -758,    17,   555,
-      23,   215,  -758,   -37,   908,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,   622,  -758,
-    -758,  -758,   -91,  -758,  -758,    84,  -758,   255,  -758,  -758,
-     344,  -758,  -758,   272,  -758,   285,  -758,  -758,  -758,  -758,
+     967,    45,    40,    80,   157,    96,   157,   308,   735,   896,
+     152,   160,   174,   251,   270,   273,   307,   151,    92,   401,
+     214,   172,   -27,   339,   185,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,   436,  -758,  -758,   354,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,   302,   302,   302,   302,    20,
+     419,   157,   374,   374,   374,   374,   374,   451,   250,   448,
+     157,   -30,   481,   496,   502,   993,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,   436,  -758,  -758,  -758,  -758,  -758,   323,
+     527,   157,  -758,  -758,  -758,  -758,  -758,     8,  -758,   318,
+     432,  -758,   546,  -758,  -758,   476,   572,  -758,   581,  -758,
+     313,   -93,   157,   157,   583,  -758,  -758,  -758,  -758,  -758,
+     -28,  -758,   534,   368,  -758,   604,   406,   424,   291,   953,
+     429,   625,   458,   556,   452,   466,   157,  -758,  -758,   443,
+     465,  -758,   935,  -758,   634,  -758,  -758,    22,   600,  -758,
+     601,   626,   714,   157,   157,   157,   722,   671,   673,   518,
+     687,   766,   157,   157,   157,   768,  -758,   772,   774,   718,
+     783,   783,   593,    48,    87,   121,  -758,   570,  -758,   447,
+    -758,  -758,  -758,   799,  -758,   800,  -758,   783,  -758,  -758,
+     804,  -758,  -758,  -758,  -758,   428,  -758,   752,   157,   597,
+     307,   783,  -758,   819,  -758,   660,  -758,   821,  -758,  -758,
+     826,  -758,   825,  -758,   829,   831,  -758,   832,   781,   833,
+     644,   836,   837,  -758,  -758,  -758,  -758,  -758,    22,  -758,
+    -758,  -758,   593,   790,   777,   770,   712,   -10,  -758,   518,
+    -758,   157,   375,   843,    74,  -758,  -758,  -758,  -758,  -758,
+     786,  -758,   641,   -13,  -758,   593,  -758,  -758,   784,   785,
+     646,  -758,  -758,   421,   684,   648,   650,   396,   865,   866,
+     867,   868,  -758,  -758,   869,   655,   656,   661,   662,   663,
+     665,   667,   320,   668,   669,   776,   776,  -758,    21,   445,
+    -758,    43,   105,  -758,     9,   205,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,   664,
+    -758,  -758,  -758,  -117,  -758,  -758,   148,  -758,   187,  -758,
+    -758,    62,  -758,  -758,   284,  -758,   293,  -758,  -758,  -758,
     -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,  -758,   822,   820,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,   784,   797,   769,    61,   771,   341,  -758,  -758,
-    -758,   843,   146,  -758,   846,  -758,  -758,   779,   425,  -758,
-     850,  -758,  -758,   638,   643,   -21,   648,   648,   795,  -758,
-     852,   -38,    37,   815,   647,   874,   876,  -758,  -758,   319,
-     663,  -758,    61,   648,   732,  -758,   493,   667,   670,   262,
+    -758,  -758,  -758,  -758,   885,   883,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,   844,   845,   816,   157,   817,   354,  -758,
+    -758,  -758,   889,   350,  -758,   892,  -758,  -758,   827,   384,
+    -758,   901,  -758,  -758,   682,   689,   -26,   593,   593,   838,
+    -758,   906,   -27,    54,   861,   699,   916,   918,  -758,  -758,
+     222,   705,  -758,   157,   593,   774,  -758,   439,   707,   708,
+     248,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,   776,   709,   966,   853,   593,   593,     0,
+     215,  -758,  -758,  -758,  -758,   421,  -758,   593,   593,   593,
+     593,   593,   593,   930,   720,   721,   725,   736,   936,   952,
+     306,   306,  -758,   734,  -758,  -758,  -758,  -758,   743,   -85,
+    -758,  -758,   890,   593,   964,   593,   593,   -16,   750,   178,
+     776,   776,   776,   776,   776,   776,   776,   776,   776,   776,
+     776,   776,   776,   776,    28,  -758,   754,  -758,   965,  -758,
+     969,    97,  -758,  -758,   979,  -758,   968,   944,   594,   773,
+     780,  1005,  -758,   792,  -758,   753,  -758,  1007,  -758,   391,
+    1010,   846,   850,  -758,  -758,  -758,   593,   942,   796,  -758,
+     135,   439,   593,  -758,  -758,    53,  1124,   898,   802,   382,
+    -758,  -758,  -758,   -27,  1021,   894,  -758,  -758,  -758,  1022,
+     593,   807,  -758,   439,  -758,   237,   237,   593,  -758,   394,
+     853,   872,   812,    34,   -25,   441,  -758,   593,   593,   -58,
+     107,   110,   114,   116,   127,   957,   593,    29,   593,  1029,
+     813,   398,   666,  -758,  -758,   783,  -758,  -758,  -758,   879,
+     818,   776,   445,   907,  -758,   642,   642,   166,   166,   897,
+     642,   642,   166,   166,   306,   306,  -758,  -758,  -758,  -758,
+    -758,  -758,   814,  -758,   815,  -758,  -758,  -758,  -758,  1033,
+    1036,  -758,   843,  1040,  -758,  1042,  -758,  -758,  1045,  -758,
+    -758,  1049,  1050,   824,    13,   878,   593,  -758,  -758,  -758,
+     439,  1057,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,   847,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,   851,   854,   856,   857,
+     858,   862,   863,   864,   358,   877,   843,  1048,    54,   436,
+     884,  1060,  -758,   403,   904,  1077,  1078,  1092,  1099,  -758,
+    1108,   408,  -758,   454,   485,  -758,   910,  -758,  1124,   593,
+    -758,   593,   -23,   -20,  -758,  -758,  -758,  -758,  -758,  -758,
+     776,   -70,  -758,    36,   -35,   893,    63,   912,  -758,  1121,
+    -758,  -758,  1056,   445,   642,   915,   486,  -758,   776,  1129,
+    1132,  1089,  1093,   499,   500,  -758,   934,   504,  -758,  1137,
+    -758,  -758,   -27,   924,   623,  -758,    61,  -758,   356,   718,
+    -758,  -758,  1143,  1124,  1124,   544,   996,  1104,  1160,  1177,
+    1200,  1020,  1023,  -758,  -758,   242,  -758,  1024,   843,   505,
+     937,  1025,  -758,   989,  -758,  -758,   593,  -758,  -758,  -758,
+    -758,  -758,  -758,   237,  -758,  -758,  -758,   938,   439,    55,
+    -758,   593,   501,   943,   754,   945,  1156,   941,   593,  -758,
+     946,   948,   949,   521,  -758,  -758,   966,  1161,  1163,  -758,
+    -758,  1040,   551,  -758,  1042,   312,    -5,    13,  1114,  -758,
+    -758,  -758,  -758,  -758,  -758,  1115,  -758,  1179,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,   961,  1133,   533,   970,
+     540,  -758,   976,   980,   981,   982,   983,   984,   988,  1014,
+    1015,  1095,  1017,  1018,  1032,  1037,  1038,  1039,  1053,  1054,
+    1055,  1061,  1096,  1062,  1064,  1065,  1066,  1072,  1073,  1076,
+    1079,  1084,  1085,  1097,  1086,  1087,  1088,  1090,  1091,  1094,
+    1098,  1100,  1101,  1102,  1164,  1105,  1106,  1107,  1109,  1110,
+    1111,  1112,  1113,  1116,  1117,  1167,  1118,  1119,  1120,  1122,
+    1123,  1125,  1126,  1127,  1128,  1130,  1171,  1131,  -758,  -758,
+      97,  -758,  1058,  1059,   548,  -758,  1042,  1267,  1269,   569,
+    -758,  -758,  -758,   439,  -758,   686,  1134,  1135,    18,  1136,
+    -758,  -758,  -758,  1138,  1213,  1080,   439,  -758,   237,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  1273,
+    -758,    61,   623,    13,    13,  1082,   356,  1259,  1261,  -758,
+    1309,  -758,  -758,  1124,  1311,  1312,  1313,  1315,  1320,  1324,
+    1330,  1331,  1337,  1139,  1340,  1345,  1348,  1349,  1353,  1356,
+    1357,  1358,  1359,  1360,  1145,  1362,  1363,  1364,  1365,  1366,
+    1367,  1368,  1369,  1370,  1371,  1157,  1372,  1374,  1375,  1376,
+    1377,  1378,  1379,  1380,  1381,  1382,  1168,  1383,  1385,  1386,
+    1387,  1388,  1389,  1390,  1391,  1392,  1393,  1178,  1395,  1396,
+    1397,  1398,  1399,  1400,  1401,  1402,  1403,  1404,  1189,  1406,
+    -758,  1409,  1410,  -758,   577,  -758,   817,  -758,  -758,  1411,
+    1412,  1413,    85,  1199,  -758,   588,  1414,  -758,  -758,  1361,
+     843,  -758,   593,   593,  -758,  1202,  -758,  1204,  1205,  1206,
+    1207,  1208,  1209,  1210,  1211,  1212,  1426,  1214,  1215,  1216,
+    1217,  1218,  1219,  1220,  1221,  1222,  1223,  1437,  1225,  1226,
+    1227,  1228,  1229,  1230,  1231,  1232,  1233,  1234,  1448,  1236,
+    1237,  1238,  1239,  1240,  1241,  1242,  1243,  1244,  1245,  1459,
+    1247,  1248,  1249,  1250,  1251,  1252,  1253,  1254,  1255,  1256,
+    1470,  1258,  1260,  1262,  1263,  1264,  1265,  1266,  1268,  1270,
+    1271,  1472,  1272,  -758,  -758,  -758,  -758,  1197,  1274,  1275,
+     941,  1321,  -758,   461,   593,   595,   824,   439,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  1276,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  1279,
     -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,   829,   679,  1016,   821,   648,   648,   182,   104,
-    -758,  -758,  -758,  -758,   885,  -758,   648,   648,   648,   648,
-     648,   648,   895,   682,   684,   687,   689,   900,   910,   532,
-     532,  -758,   693,  -758,  -758,  -758,  -758,   697,   -70,  -758,
-    -758,   836,   648,   917,   648,   648,   -55,   704,    25,   829,
-     829,   829,   829,   829,   829,   829,   829,   829,   829,   829,
-     829,   829,   829,    28,  -758,   707,  -758,   918,  -758,   919,
-      46,  -758,  -758,   920,  -758,   922,   886,   625,   714,   718,
-     930,  -758,   719,  -758,   720,  -758,   928,  -758,   173,   934,
-     775,   776,  -758,  -758,  -758,   648,   867,   721,  -758,   234,
-     493,   648,  -758,  -758,    78,  1153,   818,   737,   400,  -758,
-    -758,  -758,   -38,   945,   825,  -758,  -758,  -758,   956,   648,
-     739,  -758,   493,  -758,   229,   229,   648,  -758,   402,   821,
-     802,   744,   124,    -2,   431,  -758,   648,   648,   -68,   168,
-     177,   195,   198,   201,   893,   648,    29,   648,   966,   750,
-     404,   734,  -758,  -758,   749,  -758,  -758,  -758,   819,   758,
-     829,   555,   848,  -758,  1025,  1025,   217,   217,   950,  1025,
-    1025,   217,   217,   532,   532,  -758,  -758,  -758,  -758,  -758,
-    -758,   754,  -758,   756,  -758,  -758,  -758,  -758,   977,   978,
-    -758,   798,   982,  -758,   984,  -758,  -758,   983,  -758,  -758,
-     986,   987,   785,    12,   814,   648,  -758,  -758,  -758,   493,
-     989,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,   791,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,  -758,  -758,  -758,   801,   803,   817,   826,   828,
-     830,   832,   833,   363,   834,   798,   957,    37,   435,   787,
-     990,  -758,   411,   837,  1007,  1009,   992,  1017,  -758,  1030,
-     412,  -758,   416,   421,  -758,   824,  -758,  1153,   648,  -758,
-     648,   -28,   120,  -758,  -758,  -758,  -758,  -758,  -758,   829,
-     158,  -758,   189,   160,   816,    70,   835,  -758,  1033,  -758,
-    -758,   979,   555,  1025,   838,   428,  -758,   829,  1057,  1059,
-    1018,  1022,   440,   441,  -758,   861,   449,  -758,  1064,  -758,
-    -758,   -38,   849,   522,  -758,    59,  -758,   348,   672,  -758,
-    -758,  1066,  1153,  1153,   408,  1045,  1107,  1189,  1206,  1229,
-     955,   952,  -758,  -758,   331,  -758,   958,   798,   458,   873,
-     959,  -758,   931,  -758,  -758,   648,  -758,  -758,  -758,  -758,
-    -758,  -758,   229,  -758,  -758,  -758,   878,   493,   -16,  -758,
-     648,   514,   879,   707,   883,  1100,   887,   648,  -758,   892,
-     894,   896,   464,  -758,  -758,  1016,  1118,  1119,  -758,  -758,
-     982,   548,  -758,   984,   497,    36,    12,  1070,  -758,  -758,
-    -758,  -758,  -758,  -758,  1071,  -758,  1110,  -758,  -758,  -758,
-    -758,  -758,  -758,  -758,  -758,   906,  1078,   466,   911,   485,
-    -758,   909,   921,   923,   924,   929,   932,   933,   949,   960,
-    1041,   962,   964,   965,   967,   968,   969,   970,   973,   980,
-     985,  1042,   991,   993,   994,   995,   996,   997,   998,   999,
-    1000,  1001,  1048,  1036,  1043,  1044,  1046,  1047,  1061,  1062,
-    1065,  1067,  1068,  1049,  1069,  1079,  1082,  1083,  1084,  1085,
-    1086,  1090,  1091,  1093,  1053,  1094,  1095,  1101,  1102,  1105,
-    1106,  1108,  1113,  1114,  1115,  1081,  1116,  -758,  -758,    46,
-    -758,  1019,  1020,   487,  -758,   984,  1175,  1177,   489,  -758,
-    -758,  -758,   493,  -758,   746,  1117,  1120,    20,  1121,  -758,
-    -758,  -758,  1122,  1123,  1126,   493,  -758,   229,  -758,  -758,
-    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  1195,  -758,
-      59,   522,    12,    12,   963,   348,  1156,  1152,  -758,  1203,
-    -758,  -758,  1153,  1208,  1282,  1294,  1323,  1334,  1335,  1340,
-    1341,  1342,  1127,  1344,  1345,  1346,  1347,  1349,  1350,  1351,
-    1352,  1353,  1354,  1139,  1356,  1357,  1358,  1359,  1360,  1361,
-    1362,  1363,  1364,  1365,  1150,  1367,  1368,  1369,  1370,  1371,
-    1372,  1373,  1374,  1375,  1376,  1161,  1378,  1379,  1380,  1381,
-    1382,  1383,  1384,  1385,  1386,  1387,  1172,  1389,  1390,  1391,
-    1392,  1393,  1394,  1395,  1396,  1397,  1398,  1183,  1400,  -758,
-    1403,  1404,  -758,   491,  -758,   771,  -758,  -758,  1405,  1406,
-    1407,    98,  1193,  -758,   495,  1408,  -758,  -758,  1355,   798,
-    -758,   648,   648,  -758,  1194,  -758,  1196,  1198,  1199,  1200,
-    1201,  1202,  1204,  1205,  1207,  1416,  1209,  1210,  1211,  1212,
-    1213,  1214,  1215,  1216,  1217,  1218,  1419,  1219,  1220,  1221,
-    1222,  1223,  1224,  1225,  1226,  1227,  1228,  1421,  1230,  1231,
-    1232,  1233,  1234,  1235,  1236,  1237,  1238,  1239,  1442,  1240,
-    1241,  1242,  1243,  1244,  1245,  1246,  1247,  1248,  1249,  1463,
-    1251,  1252,  1253,  1254,  1255,  1256,  1257,  1258,  1259,  1260,
-    1474,  1262,  -758,  -758,  -758,  -758,  1261,  1263,  1264,   887,
-    1317,  -758,   501,   648,   496,   785,   493,  -758,  -758,  -758,
-    -758,  -758,  -758,  -758,  -758,  -758,  -758,  1265,  -758,  -758,
-    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  1268,  -758,
-    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  1269,
-    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
-    1270,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
-    -758,  1271,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,  1272,  -758,  1488,  1489,    51,  1275,  1276,  1448,
-    1491,  1492,  -758,  -758,  -758,   493,  -758,  -758,  -758,  -758,
-    -758,  -758,  -758,  1277,  1278,   887,   771,  1336,  1284,  1497,
-     711,    85,  1285,  1501,  1287,  -758,  1459,  1504,   715,  1503,
-    -758,   887,   771,   887,   155,  1292,  1293,  1505,  -758,  1466,
-    1295,  -758,  1296,  1477,  1478,  -758,  1514,  -758,  -758,  -758,
-     187,   -93,  -758,  1301,  1302,  1481,  1483,  -758,  1484,  1485,
-    1522,  -758,  -758,  1308,  -758,  1309,  1310,  1525,  1527,   771,
-    1312,  1313,  -758,   771,  -758,  -758
+    1280,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  1281,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  1282,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  1283,  -758,  1476,  1484,    76,  1284,  1285,
+    1444,  1487,  1488,  -758,  -758,  -758,   439,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  1286,  1287,   941,   817,  1341,  1289,
+    1499,   652,   141,  1291,  1507,  1293,  -758,  1465,  1510,   711,
+    1509,  -758,   941,   817,   941,   -40,  1298,  1299,  1511,  -758,
+    1473,  1300,  -758,  1302,  1483,  1485,  -758,  1519,  -758,  -758,
+    -758,    19,   175,  -758,  1307,  1308,  1489,  1490,  -758,  1491,
+    1492,  1523,  -758,  -758,  1314,  -758,  1316,  1317,  1530,  1532,
+     817,  1318,  1319,  -758,   817,  -758,  -758
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1174,10 +1175,10 @@ static const yytype_int16 yydefact[] =
 {
      236,     0,     0,     0,     0,     0,     0,     0,   236,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   236,     0,   535,     3,     5,    10,    12,    13,
+       0,     0,   236,     0,   536,     3,     5,    10,    12,    13,
       11,     6,     7,     9,   181,   180,     0,     8,    14,    15,
-      16,    17,    18,    19,    20,   533,   533,   533,   533,   533,
-       0,     0,   531,   531,   531,   531,   531,     0,   229,     0,
+      16,    17,    18,    19,    20,   534,   534,   534,   534,   534,
+       0,     0,   532,   532,   532,   532,   532,     0,   229,     0,
        0,     0,     0,     0,     0,   236,   167,    21,    26,    28,
       27,    22,    23,    25,    24,    29,    30,    31,    32,     0,
        0,     0,   250,   251,   249,   255,   259,     0,   256,     0,
@@ -1195,143 +1196,143 @@ static const yytype_int16 yydefact[] =
        0,   336,     0,   349,   351,     0,   344,     0,     0,     0,
        0,     0,     0,   362,   185,   184,     4,   220,     0,   182,
      183,   203,     0,     0,   200,     0,    34,     0,    35,   165,
-     536,     0,     0,     0,   236,   530,   172,   174,   173,   175,
-       0,   230,     0,   214,   169,     0,   161,   529,     0,     0,
-     459,   463,   466,   467,     0,     0,     0,     0,     0,     0,
-       0,     0,   464,   465,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   461,     0,   236,
-       0,     0,   363,   368,   369,   383,   381,   384,   382,   385,
-     386,   378,   373,   372,   371,   379,   380,   370,   377,   376,
-     474,   477,     0,   478,   486,     0,   487,     0,   479,   475,
-       0,   476,   501,     0,   502,     0,   473,   300,   302,   301,
-     298,   299,   305,   307,   306,   303,   304,   310,   312,   311,
-     308,   309,   287,     0,     0,   269,   268,   274,   264,   265,
-     280,   283,     0,     0,     0,     0,   539,     0,   238,   297,
-     346,     0,   337,   342,     0,   350,   345,     0,     0,   352,
-       0,   317,   318,     0,     0,   206,     0,     0,   202,   532,
-       0,   236,     0,     0,     0,     0,     0,   315,   159,     0,
-       0,   163,     0,     0,     0,   168,   213,     0,     0,     0,
-     510,   509,   512,   511,   514,   513,   516,   515,   518,   517,
-     520,   519,     0,     0,   425,   236,     0,     0,     0,     0,
-     468,   469,   470,   471,     0,   472,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   427,
-     426,   507,   504,   494,   484,   489,   492,     0,     0,   496,
-     497,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     537,     0,     0,     0,   236,   531,   172,   174,   173,   175,
+       0,   230,     0,   214,   169,     0,   161,   530,     0,     0,
+     460,   464,   467,   468,     0,     0,     0,     0,     0,     0,
+       0,     0,   465,   466,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   462,     0,   236,
+     377,     0,     0,   363,   368,   369,   384,   382,   385,   383,
+     386,   387,   379,   373,   372,   371,   380,   381,   370,   378,
+     376,   475,   478,     0,   479,   487,     0,   488,     0,   480,
+     476,     0,   477,   502,     0,   503,     0,   474,   300,   302,
+     301,   298,   299,   305,   307,   306,   303,   304,   310,   312,
+     311,   308,   309,   287,     0,     0,   269,   268,   274,   264,
+     265,   280,   283,     0,     0,     0,     0,   540,     0,   238,
+     297,   346,     0,   337,   342,     0,   350,   345,     0,     0,
+     352,     0,   317,   318,     0,     0,   206,     0,     0,   202,
+     533,     0,   236,     0,     0,     0,     0,     0,   315,   159,
+       0,     0,   163,     0,     0,     0,   168,   213,     0,     0,
+       0,   511,   510,   513,   512,   515,   514,   517,   516,   519,
+     518,   521,   520,     0,     0,   426,   236,     0,     0,     0,
+       0,   469,   470,   471,   472,     0,   473,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     428,   427,   508,   505,   495,   485,   490,   493,     0,     0,
+     497,   498,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   484,     0,   489,     0,   492,
+       0,     0,   496,   504,     0,   507,     0,   275,   270,     0,
+       0,     0,   320,     0,   295,     0,   355,     0,   338,     0,
+       0,     0,     0,   348,   189,   188,     0,   208,   191,   193,
+     198,   199,     0,   187,    33,    37,     0,     0,     0,     0,
+      43,    47,    48,   236,     0,    41,   314,   313,   164,     0,
+       0,   162,   176,   171,   170,     0,     0,     0,   415,     0,
+     236,     0,     0,     0,     0,     0,   451,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     212,     0,     0,   375,   374,     0,   364,   367,   444,   445,
+       0,     0,   236,     0,   425,   435,   436,   439,   440,     0,
+     442,   434,   437,   438,   430,   429,   431,   432,   433,   461,
+     463,   486,     0,   491,     0,   494,   499,   506,   509,     0,
+       0,   271,     0,     0,   358,     0,   239,   339,     0,   322,
+     347,     0,     0,   205,     0,   210,     0,   196,   197,   195,
+     201,     0,    55,    58,    59,    56,    57,    60,    61,    77,
+      62,    64,    63,    80,    67,    68,    69,    65,    66,    70,
+      71,    72,    73,    74,    75,    76,     0,     0,     0,     0,
+       0,     0,     0,     0,   540,     0,     0,   542,     0,    40,
+       0,     0,   160,     0,     0,     0,     0,     0,     0,   526,
+       0,     0,   522,     0,     0,   416,     0,   456,     0,     0,
+     449,     0,     0,     0,   423,   422,   421,   420,   419,   418,
+       0,     0,   460,     0,     0,     0,     0,     0,   405,     0,
+     501,   500,     0,   236,   443,     0,     0,   424,     0,     0,
+       0,   276,   272,     0,     0,    45,   545,     0,   543,   323,
+     356,   357,   236,   207,   223,   225,   234,   226,     0,   214,
+     194,    39,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   152,   153,   156,   149,   156,     0,     0,
+       0,    36,    44,   551,    42,   365,     0,   528,   527,   525,
+     524,   529,   179,     0,   177,   417,   457,     0,   453,     0,
+     452,     0,     0,     0,     0,     0,     0,   212,     0,   403,
+       0,     0,     0,     0,   458,   447,   446,     0,     0,   360,
+     359,     0,     0,   539,     0,     0,     0,     0,     0,   243,
+     244,   245,   246,   242,   247,     0,   232,     0,   227,   409,
+     407,   410,   408,   411,   412,   413,   209,   218,     0,     0,
+       0,    53,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   483,     0,   488,     0,   491,     0,
-       0,   495,   503,     0,   506,     0,   275,   270,     0,     0,
-       0,   320,     0,   295,     0,   355,     0,   338,     0,     0,
-       0,     0,   348,   189,   188,     0,   208,   191,   193,   198,
-     199,     0,   187,    33,    37,     0,     0,     0,     0,    43,
-      47,    48,   236,     0,    41,   314,   313,   164,     0,     0,
-     162,   176,   171,   170,     0,     0,     0,   414,     0,   236,
-       0,     0,     0,     0,     0,   450,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   212,
-       0,     0,   375,   374,     0,   364,   367,   443,   444,     0,
-       0,   236,     0,   424,   434,   435,   438,   439,     0,   441,
-     433,   436,   437,   429,   428,   430,   431,   432,   460,   462,
-     485,     0,   490,     0,   493,   498,   505,   508,     0,     0,
-     271,     0,     0,   358,     0,   239,   339,     0,   322,   347,
-       0,     0,   205,     0,   210,     0,   196,   197,   195,   201,
-       0,    55,    58,    59,    56,    57,    60,    61,    77,    62,
-      64,    63,    80,    67,    68,    69,    65,    66,    70,    71,
-      72,    73,    74,    75,    76,     0,     0,     0,     0,     0,
-       0,     0,     0,   539,     0,     0,   541,     0,    40,     0,
-       0,   160,     0,     0,     0,     0,     0,     0,   525,     0,
-       0,   521,     0,     0,   415,     0,   455,     0,     0,   448,
-       0,     0,     0,   422,   421,   420,   419,   418,   417,     0,
-       0,   459,     0,     0,     0,     0,     0,   404,     0,   500,
-     499,     0,   236,   442,     0,     0,   423,     0,     0,     0,
-     276,   272,     0,     0,    45,   544,     0,   542,   323,   356,
-     357,   236,   207,   223,   225,   234,   226,     0,   214,   194,
-      39,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   152,   153,   156,   149,   156,     0,     0,     0,
-      36,    44,   550,    42,   365,     0,   527,   526,   524,   523,
-     528,   179,     0,   177,   416,   456,     0,   452,     0,   451,
-       0,     0,     0,     0,     0,     0,   212,     0,   402,     0,
-       0,     0,     0,   457,   446,   445,     0,     0,   360,   359,
-       0,     0,   538,     0,     0,     0,     0,     0,   243,   244,
-     245,   246,   242,   247,     0,   232,     0,   227,   408,   406,
-     409,   407,   410,   411,   412,   209,   218,     0,     0,     0,
-      53,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   154,   151,
+       0,   150,    50,    49,     0,   158,     0,     0,     0,     0,
+     523,   455,   450,   454,   441,     0,     0,     0,     0,     0,
+     481,   483,   482,   212,     0,     0,   211,   406,     0,   459,
+     448,   277,   273,    46,   546,   547,   549,   548,   544,     0,
+     324,   234,   224,     0,     0,   231,     0,     0,   216,    79,
+       0,   147,   148,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   154,   151,     0,
-     150,    50,    49,     0,   158,     0,     0,     0,     0,   522,
-     454,   449,   453,   440,     0,     0,     0,     0,     0,   480,
-     482,   481,   212,     0,     0,   211,   405,     0,   458,   447,
-     277,   273,    46,   545,   546,   548,   547,   543,     0,   324,
-     234,   224,     0,     0,   231,     0,     0,   216,    79,     0,
-     147,   148,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   155,
-       0,     0,   157,     0,    38,   539,   366,   504,     0,     0,
-       0,     0,     0,   403,     0,   325,   228,   240,     0,     0,
-     413,     0,     0,   190,     0,    54,     0,     0,     0,     0,
+     155,     0,     0,   157,     0,    38,   540,   366,   505,     0,
+       0,     0,     0,     0,   404,     0,   325,   228,   240,     0,
+       0,   414,     0,     0,   190,     0,    54,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    52,    51,   540,   549,     0,     0,   212,   212,
-     398,   178,     0,     0,     0,   217,   215,    78,    84,    85,
-      82,    83,    86,    87,    88,    89,    90,     0,    81,   128,
-     129,   126,   127,   130,   131,   132,   133,   134,     0,   125,
-      95,    96,    93,    94,    97,    98,    99,   100,   101,     0,
-      92,   106,   107,   104,   105,   108,   109,   110,   111,   112,
-       0,   103,   139,   140,   137,   138,   141,   142,   143,   144,
-     145,     0,   136,   117,   118,   115,   116,   119,   120,   121,
-     122,   123,     0,   114,     0,     0,     0,     0,     0,     0,
-       0,     0,   327,   326,   332,   241,   233,    91,   135,   102,
-     113,   146,   124,   212,     0,   212,   539,   399,     0,   333,
-     328,     0,     0,     0,     0,   397,     0,     0,     0,     0,
-     329,   212,   539,   212,   539,     0,     0,     0,   334,   330,
-       0,   393,     0,     0,     0,   396,     0,   400,   335,   331,
-     539,   387,   395,     0,     0,     0,     0,   392,     0,     0,
-       0,   401,   391,     0,   389,     0,     0,     0,     0,   539,
-       0,     0,   394,   539,   388,   390
+       0,     0,     0,    52,    51,   541,   550,     0,     0,   212,
+     212,   399,   178,     0,     0,     0,   217,   215,    78,    84,
+      85,    82,    83,    86,    87,    88,    89,    90,     0,    81,
+     128,   129,   126,   127,   130,   131,   132,   133,   134,     0,
+     125,    95,    96,    93,    94,    97,    98,    99,   100,   101,
+       0,    92,   106,   107,   104,   105,   108,   109,   110,   111,
+     112,     0,   103,   139,   140,   137,   138,   141,   142,   143,
+     144,   145,     0,   136,   117,   118,   115,   116,   119,   120,
+     121,   122,   123,     0,   114,     0,     0,     0,     0,     0,
+       0,     0,     0,   327,   326,   332,   241,   233,    91,   135,
+     102,   113,   146,   124,   212,     0,   212,   540,   400,     0,
+     333,   328,     0,     0,     0,     0,   398,     0,     0,     0,
+       0,   329,   212,   540,   212,   540,     0,     0,     0,   334,
+     330,     0,   394,     0,     0,     0,   397,     0,   401,   335,
+     331,   540,   388,   396,     0,     0,     0,     0,   393,     0,
+       0,     0,   402,   392,     0,   390,     0,     0,     0,     0,
+     540,     0,     0,   395,   540,   389,   391
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -758,  -758,  -758,  1401,  1469,   102,  -758,  -758,   888,  -576,
-    -758,  -654,  -758,   804,   800,  -758,  -580,   171,   265,  1311,
-    -758,   274,  -758,  1155,   278,   282,    -6,  1515,   -19,  1197,
-    1324,   -76,  -758,  -758,   936,  -758,  -758,  -758,  -758,  -758,
-    -758,  -758,  -757,  -236,  -758,  -758,  -758,  -758,   757,  -163,
-     105,   626,  -758,  -758,  1366,  -758,  -758,   302,   320,   347,
-     351,   353,  -758,  -758,  -758,  -221,  -758,  1103,  -245,  -233,
-    -682,  -681,  -680,  -673,  -672,  -671,   624,  -758,  -758,  -758,
-    -758,  -758,  -758,  1140,  -758,  -758,  1004,  -275,  -272,  -758,
-    -758,  -758,   789,  -758,  -758,  -758,  -758,   793,  -758,  -758,
-    1080,  1089,  -225,  -758,  -758,  -758,  -758,  1288,  -515,   799,
-    -153,   541,   569,  -758,  -758,  -639,  -758,   669,   780,  -758
+    -758,  -758,  -758,  1407,  1475,    64,  -758,  -758,   895,  -574,
+    -758,  -655,  -758,   806,   805,  -758,  -584,   272,   279,  1322,
+    -758,   286,  -758,  1159,   287,   288,    -6,  1524,   -19,  1201,
+    1327,   -81,  -758,  -758,   947,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -757,  -237,  -758,  -758,  -758,  -758,   760,  -126,
+      14,   627,  -758,  -758,  1373,  -758,  -758,   299,   303,   317,
+     326,   330,  -758,  -758,  -758,  -221,  -758,  1140,  -245,  -233,
+    -690,  -683,  -682,  -680,  -678,  -677,   624,  -758,  -758,  -758,
+    -758,  -758,  -758,  1146,  -758,  -758,  1009,  -277,  -271,  -758,
+    -758,  -758,   787,  -758,  -758,  -758,  -758,   789,  -758,  -758,
+    1103,  1141,  -215,  -758,  -758,  -758,  -758,  1294,  -515,   808,
+    -152,   589,   654,  -758,  -758,  -639,  -758,   674,   775,  -758
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    23,    24,    25,    66,    26,   508,   703,   509,   510,
-     809,   643,   734,   735,   881,   511,   379,    27,    28,   234,
+       0,    23,    24,    25,    66,    26,   509,   704,   510,   511,
+     810,   644,   735,   736,   882,   512,   380,    27,    28,   234,
       29,    30,   243,   244,    31,    32,    33,    34,    35,   139,
-     219,   140,   224,   497,   498,   608,   368,   502,   222,   496,
-     604,   718,   686,   246,  1023,   927,   137,   712,   713,   714,
-     715,   797,    36,   113,   114,   716,   794,    37,    38,    39,
-      40,    41,    42,    43,    44,   281,   520,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   804,   805,   291,   292,
-     293,   294,   295,   409,   296,   297,   298,   299,   300,   898,
-     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
-     435,   436,   311,   312,   313,   314,   315,   316,   660,   661,
-     248,   151,   142,   133,   147,   483,   740,   706,   707,   514
+     219,   140,   224,   498,   499,   609,   369,   503,   222,   497,
+     605,   719,   687,   246,  1024,   928,   137,   713,   714,   715,
+     716,   798,    36,   113,   114,   717,   795,    37,    38,    39,
+      40,    41,    42,    43,    44,   282,   521,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   805,   806,   292,   293,
+     294,   295,   296,   410,   297,   298,   299,   300,   301,   899,
+     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
+     436,   437,   312,   313,   314,   315,   316,   317,   661,   662,
+     248,   151,   142,   133,   147,   484,   741,   707,   708,   515
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1339,324 +1340,334 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     386,   365,    73,   130,   736,   440,   434,   385,   249,   904,
-     662,   702,   408,   756,   170,    58,   704,   443,   188,   559,
-     371,   404,   431,   432,   340,   431,   432,   251,   252,   253,
-     138,   578,   681,   245,   438,   798,   799,   800,   349,    16,
-     505,  1238,   429,   430,   801,   802,   803,    45,    46,    47,
-     251,   252,   253,    48,    49,   759,   134,  1195,   135,    73,
-     495,   220,   795,   136,    58,   738,  -534,   891,   808,   810,
-     160,   161,  1239,     1,   766,     2,     3,     4,     5,     6,
-       7,     8,     9,    10,   668,   444,   445,   444,   445,    11,
-     126,  1211,    12,    60,    13,    14,    15,   562,   134,   116,
-     135,   380,  1099,   560,   117,   136,   118,   127,   119,    59,
-      67,    61,   317,   796,   318,   319,   767,    51,   444,   445,
-     111,   499,   500,   258,   259,   260,   464,   444,   445,   261,
-     322,   465,   323,   324,   327,   767,   328,   329,   522,   444,
-     445,    16,   364,    16,   102,  1012,   258,   259,   260,   553,
-     767,   673,   261,   444,   445,   563,   149,   883,   262,   263,
-     264,   532,   533,   767,   506,   159,   507,    67,   528,   404,
-     320,   538,   539,   540,   541,   542,   543,   157,   667,    68,
-      22,   262,   263,   264,   372,   486,   169,   535,   325,   536,
-     384,   537,   330,   580,   487,   585,    52,    53,    54,   557,
-     558,   442,    55,    56,   912,   597,   760,   185,   186,    50,
-     109,   610,   171,   162,   598,   381,   564,   565,   566,   567,
+     387,   366,    73,   130,   441,   737,   386,   435,   703,   249,
+     905,   663,   409,   757,   170,   134,    58,   135,    59,   705,
+      61,   405,   136,   432,   433,   341,   432,   433,   799,   111,
+     138,   579,   682,   188,   439,   800,   801,   483,   802,   350,
+     803,   804,   430,   431,   372,   160,   161,   251,   252,   253,
+      16,   318,   245,   319,   320,   496,   220,   506,   560,    73,
+     760,   669,   739,   444,   796,   149,   761,   767,   809,   811,
+     445,   446,    67,   134,   159,   135,    51,    45,    46,    47,
+     136,  -538,  1196,    48,    49,   445,   446,   408,   668,  1100,
+     323,   141,   324,   325,  1224,   169,   483,   445,   446,   116,
+     465,   251,   252,   253,   117,   466,   118,   183,   119,   321,
+     184,   381,    52,    53,    54,   797,   185,   186,    55,    56,
+     445,   446,   500,   501,   328,  1225,   329,   330,   768,    67,
+     445,   446,   445,   446,   554,   445,   446,   365,   892,   523,
+     213,   768,   561,   258,   259,   260,  1013,  1212,   326,   261,
+     768,    16,   763,  1236,   884,   445,   446,   227,   228,   229,
+      58,   674,   533,   534,   445,   446,   237,   238,   239,   529,
+     405,    60,   539,   540,   541,   542,   543,   544,   262,   263,
+     264,   507,   331,   508,  1237,   102,   611,   765,   162,   445,
+     446,    22,   157,   103,   586,   581,   443,   258,   259,   260,
+     558,   559,   347,   261,   607,   608,   768,   913,   373,   385,
+     445,   446,   171,   104,   921,   382,   322,   565,   566,   567,
      568,   569,   570,   571,   572,   573,   574,   575,   576,   577,
-     711,   213,   482,   278,   433,    17,    68,   433,   103,   278,
-     218,   579,   277,   798,   799,   800,   439,   280,   227,   228,
-     229,    18,   801,   802,   803,   920,   609,   237,   238,   239,
-     437,   120,   278,    19,   482,   250,   251,   252,   253,   407,
-     280,    20,    21,    69,   602,   444,   445,   321,  1025,   444,
-     445,   121,    70,   104,    22,   122,    71,   110,   123,  1223,
-      72,   671,   672,   346,   112,   326,   654,   655,   652,   331,
-     680,   466,   683,   606,   607,   663,   467,   656,   657,   658,
-      74,   375,   376,   444,   445,   444,   445,    62,    63,   115,
-    1224,  1235,    64,   444,   445,   128,   526,   693,    75,   377,
-      69,   132,   444,   445,   254,   255,   374,   444,   445,    70,
-     695,  1177,  1178,    71,   256,   131,   257,    72,   448,   138,
-     444,   445,  1236,   444,   445,    76,   444,   445,    57,    77,
-     499,    78,   258,   259,   260,   504,  1095,    74,   261,  -538,
-    -538,   141,     1,  -537,     2,     3,     4,     5,     6,     7,
-     762,     9,   764,   141,   148,    75,   531,   674,    11,   444,
-     445,    12,  1014,    13,    14,    15,   675,   262,   263,   264,
-     265,   691,   266,   730,   267,   150,   268,   342,   269,   463,
-     270,   763,    76,   659,   676,   158,    77,   677,    78,   271,
-     678,   343,   344,   757,   157,   758,  -538,  -538,   458,   459,
-     460,   461,   462,   156,   441,   730,  1202,   442,  1204,  1104,
-     482,   272,    16,   273,   167,   274,   761,   105,   106,   107,
-     481,   180,   181,   182,  1220,   134,  1222,   135,   731,   163,
-     732,   733,   136,   879,   775,   108,   250,   251,   252,   253,
-     177,   772,   468,   275,   276,   277,   183,   469,   278,   184,
-     279,   527,   806,   194,   195,   164,   280,   521,   196,   472,
-     731,   896,   732,   733,   473,   172,   173,   811,   812,   813,
-     814,   815,   474,   165,   816,   817,   648,   475,   124,   125,
-     665,   818,   819,   820,   669,   892,   670,   333,   537,   168,
-     334,   335,   905,   176,   888,   336,   337,   272,   179,   273,
-     918,   274,   919,   821,    17,   254,   255,   895,   517,   901,
-    1180,   518,   694,  1181,  1182,   256,   178,   257,  1183,  1184,
-     407,   913,   914,   915,   916,   174,   175,  1205,   250,   251,
-     252,   253,    19,   258,   259,   260,   470,   471,   187,   261,
-     191,    21,   189,  1221,   190,  1225,   208,   787,  -248,   788,
-     789,   790,   791,    22,   792,   793,   530,   423,   209,   424,
-     425,  1237,   192,   426,   152,   153,   154,   155,   262,   263,
-     264,   265,   210,   266,   999,   267,   214,   268,   193,   269,
-    1252,   270,   490,   491,  1255,   143,   144,   145,   146,   646,
-     271,   664,   647,   687,   442,   215,   688,   254,   255,   217,
-     744,   751,    16,   442,   752,   753,   207,   256,   752,   257,
-     754,   211,   272,   442,   273,   448,   274,   774,   444,   445,
-     442,   250,   251,   252,   253,   258,   259,   260,   221,   778,
-     779,   261,   518,   780,   449,   450,   451,   452,   782,   589,
-     590,   783,   454,   771,   275,   276,   277,   884,   212,   278,
-     518,   279,   223,   909,   225,   928,   442,   280,   929,   226,
-     262,   263,   264,   265,   230,   266,   231,   267,   232,   268,
-     235,   269,   236,   270,   931,   785,  1002,   932,  1006,   518,
-    1094,   442,   271,   783,  1101,  1186,   233,   752,   518,   240,
-     254,   255,   455,   456,   457,   458,   459,   460,   461,   462,
-     256,   241,   257,   893,   272,   242,   273,   245,   274,   689,
-     690,   250,   251,   252,   253,   460,   461,   462,   258,   259,
-     260,   431,  1007,   247,   261,  1209,  1210,  1217,  1218,  1017,
-    1018,   332,   338,   339,   345,   341,   275,   276,   277,   347,
-     350,   278,   351,   279,   352,   353,   354,  1106,   355,   280,
-     356,   358,   357,   262,   263,   264,   265,   359,   266,   360,
-     267,   361,   268,   362,   269,   366,   270,   367,   369,   370,
-    1105,   378,   382,   387,   383,   271,   388,   389,   405,   406,
-     402,   403,   410,   411,   412,   413,   416,   417,   414,   418,
-     256,   419,   257,   420,   421,   476,   477,   272,   422,   273,
-     478,   274,   250,   251,   252,   253,   197,   427,   258,   259,
-     260,   428,   463,   479,   261,   480,   198,   485,   482,   199,
-     200,   201,   488,   202,   492,   489,   503,   493,  1185,   275,
-     276,   277,   494,   501,   278,   513,   279,   203,   204,   512,
-     205,   206,   280,   262,   263,   264,   265,   515,   266,   516,
-     267,   519,   268,    65,   269,   524,   270,     1,   525,     2,
-       3,     4,     5,     6,     7,   271,     9,   529,    16,   544,
-     545,   402,   546,    11,   549,   547,    12,   548,    13,    14,
-      15,   256,   554,   257,   550,    79,   552,   272,   551,   273,
-     556,   274,   561,   278,   581,   583,   586,   587,   588,   258,
-     259,   260,   591,   593,   596,   261,   592,   594,   599,   595,
-     600,   601,   603,   605,    80,    81,   644,    82,   649,   275,
-     276,   277,    83,    84,   278,   645,   279,    16,   650,   651,
-     560,   653,   280,   666,   262,   263,   264,   265,   679,   266,
-     684,   267,   685,   268,   444,   269,   692,   270,   696,   698,
-     446,   699,   447,   700,   701,   505,   271,   705,   739,   708,
-     709,   710,   717,   720,   743,     1,   748,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,   742,   442,   272,   721,
-     273,    11,   274,   746,    12,   747,    13,    14,    15,   722,
-     749,   723,   530,   390,   391,   392,   393,   394,   395,   396,
-     397,   398,   399,   400,   401,   724,   750,   769,   765,   448,
-     275,   276,   277,   755,   725,   278,   726,   279,   727,    17,
-     728,   729,   737,   280,   768,   745,   770,   773,   449,   450,
-     451,   452,   453,   690,   689,    16,   454,   776,   777,   781,
-     784,   786,   807,    85,    86,    87,    88,    19,    89,    90,
-     878,   448,    91,    92,    93,   877,    21,    94,   530,    95,
-     879,   885,   886,    96,    97,   894,   887,   890,    22,   897,
-     449,   450,   451,   452,   902,   697,    98,    99,   454,   903,
-     100,   906,   907,   924,   101,   908,   455,   456,   457,   458,
-     459,   460,   461,   462,   910,   911,   922,   923,   925,   926,
-     930,   933,   942,   953,   822,   823,   824,   825,   826,   964,
-     975,   827,   828,   934,   986,   935,   936,   448,   829,   830,
-     831,   937,  1000,  1001,   938,   939,   448,    17,   455,   456,
-     457,   458,   459,   460,   461,   462,   449,   450,   451,   452,
-     832,   940,   997,    18,   454,  -538,  -538,   451,   452,  1004,
-    1005,  1019,   941,  -538,   943,    19,   944,   945,   767,   946,
-     947,   948,   949,    20,    21,   950,   833,   834,   835,   836,
-     837,  1015,   951,   838,   839,  1022,    22,   952,  1021,  1024,
-     840,   841,   842,   954,  1026,   955,   956,   957,   958,   959,
-     960,   961,   962,   963,   455,   456,   457,   458,   459,   460,
-     461,   462,   843,  -538,   456,   457,   458,   459,   460,   461,
-     462,   611,   612,   613,   614,   615,   616,   617,   618,   619,
-     620,   621,   622,   623,   624,   625,   626,   627,   965,   628,
-     629,   630,   631,   632,   633,   966,   967,   634,   968,   969,
-     635,   636,   637,   638,   639,   640,   641,   642,   844,   845,
-     846,   847,   848,   970,   971,   849,   850,   972,  1027,   973,
-     974,   976,   851,   852,   853,   855,   856,   857,   858,   859,
-    1028,   977,   860,   861,   978,   979,   980,   981,   982,   862,
-     863,   864,   983,   984,   854,   985,   987,   988,   866,   867,
-     868,   869,   870,   989,   990,   871,   872,   991,   992,  1029,
-     993,   865,   873,   874,   875,   994,   995,   996,   998,  1008,
-    1030,  1031,  1009,  1010,  1011,  1013,  1032,  1033,  1034,  1035,
-    1036,  1037,  1038,  1039,   876,  1040,  1041,  1042,  1043,  1044,
-    1045,  1046,  1047,  1048,  1049,  1050,  1051,  1052,  1053,  1054,
-    1055,  1056,  1057,  1058,  1059,  1060,  1061,  1062,  1063,  1064,
-    1065,  1066,  1067,  1068,  1069,  1070,  1071,  1072,  1073,  1074,
-    1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,
-    1085,  1086,  1087,  1088,  1089,  1090,  1091,  1092,  1093,  1096,
-    1097,  1098,  1100,  1107,  1102,  1108,  1103,  1109,  1110,  1111,
-    1112,  1113,  1117,  1114,  1115,  1128,  1116,  1139,  1118,  1119,
-    1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,  1129,  1130,
-    1131,  1132,  1133,  1134,  1135,  1136,  1137,  1138,  1150,  1140,
-    1141,  1142,  1143,  1144,  1145,  1146,  1147,  1148,  1149,  1151,
-    1152,  1153,  1154,  1155,  1156,  1157,  1158,  1159,  1160,  1161,
-    1162,  1163,  1164,  1165,  1166,  1167,  1168,  1169,  1170,  1171,
-    1172,  1173,  1179,  1174,  1187,  1175,  1176,  1188,  1189,  1190,
-    1191,  1192,  1193,  1194,  1196,  1197,  1198,  1199,  1200,  1201,
-    1203,  1206,  1207,  1208,  1212,  1213,  1214,  1215,  1216,  1219,
-    1226,  1228,  1227,  1229,  1230,  1231,  1232,  1233,  1234,  1240,
-    1242,  1241,  1243,  1244,  1245,  1246,  1247,  1248,  1250,  1249,
-    1251,  1253,  1254,   216,   166,   741,   882,   129,   880,   523,
-     373,   719,   363,   921,   484,   555,  1016,   582,   534,  1020,
-     682,   889,   415,   899,  1003,     0,   348,   900,   584,     0,
-       0,     0,     0,   917
+     578,   712,   262,   263,   264,   434,   799,   278,   434,    50,
+     218,   580,   277,   800,   801,   375,   802,   126,   803,   804,
+     563,   250,   251,   252,   253,   327,   464,   610,   764,   278,
+     438,   120,   445,   446,   127,   445,   446,   440,   281,   445,
+     446,   445,   446,   109,    57,   603,   110,   447,  1026,   448,
+      68,   121,   445,   446,   471,   122,   472,    69,   123,   332,
+     445,   446,   672,   673,    70,    71,    72,   449,   536,   653,
+     537,   681,   538,   684,   655,   656,   664,    74,   564,  1239,
+     112,    75,   527,   278,   731,   657,   658,   659,  -539,  -539,
+     254,   255,   281,   115,   442,    76,   675,   443,   694,   676,
+     256,   128,   257,   677,    77,   678,   449,    68,    78,   131,
+    1240,   696,  1178,  1179,    69,   919,   679,   920,   258,   259,
+     260,    70,    71,    72,   261,   450,   451,   452,   453,   454,
+     482,   500,   138,   455,    74,   467,   505,  1096,    75,   732,
+     468,   733,   734,   141,   880,  -539,  -539,   459,   460,   461,
+     462,   463,    76,   262,   263,   264,   265,   532,   266,   487,
+     267,    77,   268,  1015,   269,    78,   270,   522,   488,   250,
+     251,   252,   253,   692,   469,   271,   132,   376,   377,   470,
+     105,   106,   107,   456,   457,   458,   459,   460,   461,   462,
+     463,   660,   148,   598,   758,   378,   759,   272,   108,   273,
+     731,   274,   599,   124,   125,   483,  1105,  1203,   343,  1205,
+     424,   518,   425,   426,   519,   150,   427,   762,   250,   251,
+     252,   253,   344,   345,   156,  1221,   134,  1223,   135,   275,
+     276,   277,   158,   136,   278,   776,   279,   528,   254,   255,
+     157,   280,   773,   281,    62,    63,   194,   195,   256,    64,
+     257,   196,   807,   408,   163,   732,   334,   733,   734,   335,
+     336,   172,   173,   897,   337,   338,   258,   259,   260,   164,
+    1181,   473,   261,  1182,  1183,   165,   474,   649,  1184,  1185,
+     475,   666,   180,   181,   182,   476,   893,   254,   255,   461,
+     462,   463,    16,   906,   670,   889,   671,   256,   538,   257,
+     168,   262,   263,   264,   265,   272,   266,   273,   267,   274,
+     268,   167,   269,   695,   270,   258,   259,   260,   896,   176,
+     902,   261,   177,   271,   914,   915,   916,   917,  1206,   391,
+     392,   393,   394,   395,   396,   397,   398,   399,   400,   401,
+     402,   491,   492,   531,  1222,   272,  1226,   273,   178,   274,
+     262,   263,   264,   265,   179,   266,   187,   267,   189,   268,
+     190,   269,  1238,   270,   445,   446,   250,   251,   252,   253,
+     192,   647,   271,  1000,   648,   174,   175,   275,   276,   277,
+     191,  1253,   278,   665,   279,  1256,   443,   688,   193,   280,
+     689,   281,   745,   207,   272,   443,   273,   752,   274,   208,
+     753,   210,   449,   812,   813,   814,   815,   816,   590,   591,
+     817,   818,   152,   153,   154,   155,   211,   819,   820,   821,
+     209,   450,   451,   452,   453,   217,   275,   276,   277,   455,
+     212,   278,   214,   279,   221,   254,   255,   223,   280,   822,
+     281,   690,   691,   754,   772,   256,   753,   257,   788,  -248,
+     789,   790,   791,   792,   215,   793,   794,   250,   251,   252,
+     253,   432,  1008,   258,   259,   260,  1210,  1211,   225,   261,
+     143,   144,   145,   146,   755,   775,   786,   443,   443,   456,
+     457,   458,   459,   460,   461,   462,   463,   226,   779,   780,
+     894,   519,   781,   783,   885,   230,   784,   519,   262,   263,
+     264,   265,   231,   266,   232,   267,   233,   268,    65,   269,
+     910,   270,     1,   443,     2,     3,     4,     5,     6,     7,
+     271,     9,   929,  1218,  1219,   930,   403,   404,    11,   932,
+     235,    12,   933,    13,    14,    15,   256,  1003,   257,   236,
+     519,   240,   272,   449,   273,   241,   274,   242,  1107,   250,
+     251,   252,   253,   245,   258,   259,   260,   247,  1007,   333,
+     261,   443,  -539,  -539,   452,   453,  1095,  1018,  1019,   784,
+    -539,  1106,   339,   340,   275,   276,   277,  1102,   342,   278,
+     753,   279,    16,   346,  1187,   348,   280,   519,   281,   262,
+     263,   264,   265,   351,   266,   352,   267,   353,   268,   354,
+     269,   355,   270,   356,   357,   359,   358,   360,   361,   362,
+     363,   271,   367,   370,   368,   371,   379,   383,   403,   384,
+    -539,   457,   458,   459,   460,   461,   462,   463,   256,  1186,
+     257,   388,   389,   272,   390,   273,   406,   274,   407,   411,
+     412,   413,   414,   417,   418,   415,   258,   259,   260,   419,
+     420,   421,   261,   422,   464,   423,   428,   429,   477,   478,
+     479,   480,   481,   486,   483,   275,   276,   277,   489,    79,
+     278,   494,   279,   490,    17,   493,   502,   280,   495,   281,
+     504,   262,   263,   264,   265,   513,   266,   514,   267,   516,
+     268,   517,   269,   520,   270,   525,   526,   530,    80,    81,
+      16,    82,    19,   271,   545,  -535,    83,    84,   546,   547,
+     550,    21,     1,   548,     2,     3,     4,     5,     6,     7,
+       8,     9,    10,    22,   549,   272,   551,   273,    11,   274,
+     552,    12,   553,    13,    14,    15,   555,   557,   562,   531,
+     278,   582,   596,   588,     1,   584,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,   587,   589,   275,   276,   277,
+      11,   592,   278,    12,   279,    13,    14,    15,   593,   280,
+       1,   281,     2,     3,     4,     5,     6,     7,   594,     9,
+     595,   601,    16,   597,   600,   602,    11,   604,   606,    12,
+     646,    13,    14,    15,   650,   652,   645,   651,   449,   654,
+     561,   667,   680,   685,   445,   686,   693,   697,   531,   701,
+     699,   700,   702,   506,    16,   706,   443,   450,   451,   452,
+     453,   709,   698,   710,   711,   455,   718,    85,    86,    87,
+      88,   721,    89,    90,   744,   722,    91,    92,    93,   723,
+      16,    94,   724,    95,   725,   726,   727,    96,    97,   740,
+     728,   729,   730,   747,   748,   823,   824,   825,   826,   827,
+      98,    99,   828,   829,   100,   738,   749,   449,   101,   830,
+     831,   832,   750,   743,    17,   456,   457,   458,   459,   460,
+     461,   462,   463,   197,   751,   766,   450,   451,   452,   453,
+      18,   833,   746,   198,   455,   770,   199,   200,   201,   756,
+     202,   769,    19,   771,   774,   691,    17,   690,   777,   778,
+      20,    21,   782,   785,   203,   204,   787,   205,   206,   808,
+     878,   879,    18,    22,   888,   886,   880,   891,   887,   895,
+     903,   898,    17,   904,    19,   907,   908,   911,   909,   912,
+     923,   924,    20,    21,   456,   457,   458,   459,   460,   461,
+     462,   463,   925,   926,   927,    22,   943,   954,   965,   931,
+      19,  1001,  1002,   834,   835,   836,   837,   838,   934,    21,
+     839,   840,   935,   936,   937,   938,   939,   841,   842,   843,
+     940,    22,   612,   613,   614,   615,   616,   617,   618,   619,
+     620,   621,   622,   623,   624,   625,   626,   627,   628,   844,
+     629,   630,   631,   632,   633,   634,   941,   942,   635,   944,
+     945,   636,   637,   638,   639,   640,   641,   642,   643,   845,
+     846,   847,   848,   849,   946,   976,   850,   851,   987,   947,
+     948,   949,   998,   852,   853,   854,   856,   857,   858,   859,
+     860,  1005,  1006,   861,   862,   950,   951,   952,   768,  1016,
+     863,   864,   865,   953,   955,   855,   956,   957,   958,   867,
+     868,   869,   870,   871,   959,   960,   872,   873,   961,  1014,
+    1020,   962,   866,   874,   875,   876,   963,   964,   966,   967,
+     968,  1022,   969,   970,  1023,  1025,   971,  1027,  1028,  1029,
+     972,  1030,   973,   974,   975,   877,  1031,   977,   978,   979,
+    1032,   980,   981,   982,   983,   984,  1033,  1034,   985,   986,
+     988,   989,   990,  1035,   991,   992,  1037,   993,   994,   995,
+     996,  1038,   997,   999,  1039,  1040,  1009,  1010,  1011,  1041,
+    1012,  1036,  1042,  1043,  1044,  1045,  1046,  1047,  1048,  1049,
+    1050,  1051,  1052,  1053,  1054,  1055,  1056,  1057,  1059,  1058,
+    1060,  1061,  1062,  1063,  1064,  1065,  1066,  1067,  1068,  1070,
+    1069,  1071,  1072,  1073,  1074,  1075,  1076,  1077,  1078,  1079,
+    1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,
+    1090,  1091,  1092,  1093,  1094,  1097,  1098,  1099,  1101,  1175,
+    1103,  1108,  1104,  1109,  1110,  1111,  1112,  1113,  1114,  1115,
+    1116,  1117,  1118,  1119,  1120,  1121,  1122,  1123,  1124,  1125,
+    1126,  1127,  1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,
+    1136,  1137,  1138,  1139,  1140,  1141,  1142,  1143,  1144,  1145,
+    1146,  1147,  1148,  1149,  1150,  1151,  1152,  1153,  1154,  1155,
+    1156,  1157,  1158,  1159,  1160,  1161,  1162,  1163,  1173,  1164,
+    1194,  1165,  1166,  1167,  1168,  1169,  1180,  1170,  1195,  1171,
+    1172,  1174,  1199,  1200,  1201,  1188,  1176,  1177,  1189,  1190,
+    1191,  1192,  1193,  1197,  1198,  1209,  1207,  1208,  1202,  1204,
+    1213,  1214,  1215,  1216,  1217,  1220,  1227,  1229,  1228,  1231,
+    1230,  1232,  1233,  1235,  1234,  1241,  1247,  1242,  1243,  1244,
+    1245,  1246,  1248,  1251,  1249,  1252,  1250,  1254,  1255,   216,
+     166,   881,   883,   742,   524,   364,   129,   922,  1017,   485,
+    1021,   374,   900,   720,   901,   535,   683,     0,   416,   918,
+    1004,   890,     0,   349,     0,     0,     0,     0,     0,     0,
+       0,   583,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   556,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   585
 };
 
 static const yytype_int16 yycheck[] =
 {
-     245,   222,     8,    22,   643,   280,   278,   243,   161,   766,
-     525,   591,   257,   667,     6,     3,   592,    54,    61,    74,
-      54,   254,     5,     6,   177,     5,     6,     4,     5,     6,
-       8,     3,     3,    65,   279,   717,   717,   717,   191,    77,
-       3,   134,   275,   276,   717,   717,   717,    32,    33,    34,
-       4,     5,     6,    38,    39,    83,    20,     6,    22,    65,
-      81,   137,     3,    27,     3,   645,     0,    83,   722,   723,
-      75,    76,   165,     7,     4,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    86,   155,   156,   155,   156,    23,
-      33,     6,    26,    75,    28,    29,    30,    72,    20,     7,
-      22,    37,     4,   158,    12,    27,    14,    50,    16,     4,
-       8,     6,     3,    54,     5,     6,    65,    36,   155,   156,
-      15,   366,   367,   100,   101,   102,   217,   155,   156,   106,
-       3,   222,     5,     6,     3,    65,     5,     6,   383,   155,
-     156,    77,   218,    77,    33,   902,   100,   101,   102,   219,
-      65,   219,   106,   155,   156,   130,    51,   737,   135,   136,
-     137,   406,   407,    65,   127,    60,   129,    65,   389,   402,
-      61,   416,   417,   418,   419,   420,   421,   220,    54,     8,
-     218,   135,   136,   137,   218,    39,    81,    83,    61,    85,
-     222,    87,    61,   465,    48,   470,    32,    33,    34,   444,
-     445,   222,    38,    39,   780,    32,    86,   102,   103,   194,
-       3,   133,   204,   218,    41,   234,   449,   450,   451,   452,
+     245,   222,     8,    22,   281,   644,   243,   278,   592,   161,
+     767,   526,   257,   668,     6,    20,     3,    22,     4,   593,
+       6,   254,    27,     5,     6,   177,     5,     6,   718,    15,
+       8,     3,     3,    61,   279,   718,   718,    77,   718,   191,
+     718,   718,   275,   276,    54,    75,    76,     4,     5,     6,
+      77,     3,    65,     5,     6,    81,   137,     3,    74,    65,
+      83,    86,   646,    54,     3,    51,    86,     4,   723,   724,
+     155,   156,     8,    20,    60,    22,    36,    32,    33,    34,
+      27,    61,     6,    38,    39,   155,   156,    87,    54,     4,
+       3,    71,     5,     6,   134,    81,    77,   155,   156,     7,
+     217,     4,     5,     6,    12,   222,    14,   200,    16,    61,
+     203,    37,    32,    33,    34,    54,   102,   103,    38,    39,
+     155,   156,   367,   368,     3,   165,     5,     6,    65,    65,
+     155,   156,   155,   156,   219,   155,   156,   218,    83,   384,
+     126,    65,   158,   100,   101,   102,   903,     6,    61,   106,
+      65,    77,   222,   134,   738,   155,   156,   143,   144,   145,
+       3,   219,   407,   408,   155,   156,   152,   153,   154,   390,
+     403,    75,   417,   418,   419,   420,   421,   422,   135,   136,
+     137,   127,    61,   129,   165,    33,   133,   222,   218,   155,
+     156,   218,   220,    33,   471,   466,   222,   100,   101,   102,
+     445,   446,   188,   106,    69,    70,    65,   781,   218,   222,
+     155,   156,   204,    39,   219,   234,   168,   450,   451,   452,
      453,   454,   455,   456,   457,   458,   459,   460,   461,   462,
-     218,   126,    77,   216,   217,   169,    65,   217,    33,   216,
-     218,   213,   213,   925,   925,   925,   223,   224,   143,   144,
-     145,   185,   925,   925,   925,   219,   501,   152,   153,   154,
-     279,   169,   216,   197,    77,     3,     4,     5,     6,    87,
-     224,   205,   206,     8,   495,   155,   156,   168,   932,   155,
-     156,   189,     8,    39,   218,   193,     8,     3,   196,   134,
-       8,   536,   537,   188,     3,   168,    67,    68,   519,   168,
-     545,   217,   547,    69,    70,   526,   222,    78,    79,    80,
-       8,    32,    33,   155,   156,   155,   156,   166,   167,   172,
-     165,   134,   171,   155,   156,   159,    64,   560,     8,    50,
-      65,   221,   155,   156,    72,    73,   231,   155,   156,    65,
-     561,  1098,  1099,    65,    82,     0,    84,    65,   131,     8,
-     155,   156,   165,   155,   156,     8,   155,   156,   194,     8,
-     605,     8,   100,   101,   102,   371,  1005,    65,   106,   152,
-     153,    71,     7,    61,     9,    10,    11,    12,    13,    14,
-     222,    16,   222,    71,     3,    65,   405,   219,    23,   155,
-     156,    26,   907,    28,    29,    30,   219,   135,   136,   137,
-     138,   554,   140,    72,   142,    71,   144,    10,   146,   220,
-     148,   222,    65,   184,   219,    14,    65,   219,    65,   157,
-     219,    24,    25,   668,   220,   670,   209,   210,   211,   212,
-     213,   214,   215,     3,   219,    72,  1193,   222,  1195,  1019,
-      77,   179,    77,   181,   218,   183,   679,   159,   160,   161,
-     345,   199,   200,   201,  1211,    20,  1213,    22,   127,     3,
-     129,   130,    27,   132,   697,   177,     3,     4,     5,     6,
-      76,   692,   217,   211,   212,   213,   200,   222,   216,   203,
-     218,   219,   718,   185,   186,     3,   224,   382,   190,   217,
-     127,   763,   129,   130,   222,   173,   174,    89,    90,    91,
-      92,    93,   217,     3,    96,    97,   512,   222,    32,    33,
-     529,   103,   104,   105,    83,   760,    85,    39,    87,     3,
-      42,    43,   767,     3,   745,    47,    48,   179,     3,   181,
-      33,   183,    35,   125,   169,    72,    73,   762,   219,   764,
-      39,   222,   561,    42,    43,    82,     6,    84,    47,    48,
-      87,     3,     4,     5,     6,   173,   174,  1196,     3,     4,
-       5,     6,   197,   100,   101,   102,   222,   223,     3,   106,
-       6,   206,    54,  1212,   222,  1214,     4,    55,    56,    57,
-      58,    59,    60,   218,    62,    63,    72,   120,   192,   122,
-     123,  1230,   194,   126,    53,    54,    55,    56,   135,   136,
-     137,   138,    75,   140,   879,   142,   219,   144,   194,   146,
-    1249,   148,   187,   188,  1253,    46,    47,    48,    49,   219,
-     157,   219,   222,   219,   222,   219,   222,    72,    73,    21,
-     219,   219,    77,   222,   222,   219,   194,    82,   222,    84,
-     219,   194,   179,   222,   181,   131,   183,   219,   155,   156,
-     222,     3,     4,     5,     6,   100,   101,   102,    64,   219,
-     219,   106,   222,   222,   150,   151,   152,   153,   219,    44,
-      45,   222,   158,   692,   211,   212,   213,   219,   194,   216,
-     222,   218,    66,   219,    72,   219,   222,   224,   222,     3,
-     135,   136,   137,   138,     3,   140,    61,   142,    61,   144,
-      73,   146,     3,   148,   219,   711,   219,   222,   219,   222,
-     219,   222,   157,   222,   219,   219,   218,   222,   222,     3,
-      72,    73,   208,   209,   210,   211,   212,   213,   214,   215,
-      82,     3,    84,   219,   179,     3,   181,    65,   183,     5,
-       6,     3,     4,     5,     6,   213,   214,   215,   100,   101,
-     102,     5,     6,     4,   106,    44,    45,    42,    43,   922,
-     923,   219,     3,     3,    61,     4,   211,   212,   213,   218,
-       4,   216,   165,   218,     6,     3,     6,  1022,     4,   224,
-       3,    54,     4,   135,   136,   137,   138,     4,   140,   194,
-     142,     3,   144,     3,   146,    52,   148,    67,    73,   133,
-    1021,     3,    61,    77,   208,   157,    77,   218,   218,   218,
-      72,    73,     4,     4,     4,     4,   218,   218,     6,   218,
-      82,   218,    84,   218,   218,     3,     6,   179,   218,   181,
-      46,   183,     3,     4,     5,     6,   160,   218,   100,   101,
-     102,   218,   220,    46,   106,    76,   170,     4,    77,   173,
-     174,   175,     6,   177,     4,    76,     4,   219,  1103,   211,
-     212,   213,   219,    68,   216,   218,   218,   191,   192,    54,
-     194,   195,   224,   135,   136,   137,   138,     3,   140,     3,
-     142,   218,   144,     3,   146,   218,   148,     7,   218,     9,
-      10,    11,    12,    13,    14,   157,    16,   218,    77,     4,
-     218,    72,   218,    23,     4,   218,    26,   218,    28,    29,
-      30,    82,    76,    84,     4,     3,   219,   179,   225,   181,
-       3,   183,   218,   216,     6,     6,     6,     5,    42,   100,
-     101,   102,   218,     3,     6,   106,   218,   218,     4,   219,
-     165,   165,    75,   222,    32,    33,   128,    35,     3,   211,
-     212,   213,    40,    41,   216,   218,   218,    77,   133,     3,
-     158,   222,   224,   219,   135,   136,   137,   138,    75,   140,
-       4,   142,   222,   144,   155,   146,   218,   148,   130,   225,
-      72,   225,    74,     6,     6,     3,   157,     3,    31,     6,
-       4,     4,   178,     4,     4,     7,     4,     9,    10,    11,
-      12,    13,    14,    15,    16,    17,   219,   222,   179,   218,
-     181,    23,   183,     6,    26,     6,    28,    29,    30,   218,
-       3,   218,    72,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   218,     6,     4,   222,   131,
-     211,   212,   213,   219,   218,   216,   218,   218,   218,   169,
-     218,   218,   218,   224,   219,   218,    77,   219,   150,   151,
-     152,   153,   154,     6,     5,    77,   158,    49,    46,   208,
-       6,   222,     6,   161,   162,   163,   164,   197,   166,   167,
-     128,   131,   170,   171,   172,   130,   206,   175,    72,   177,
-     132,   218,   133,   181,   182,   216,   165,   219,   218,   216,
-     150,   151,   152,   153,     4,   155,   194,   195,   158,   222,
-     198,   219,   218,     3,   202,   219,   208,   209,   210,   211,
-     212,   213,   214,   215,     6,     6,    56,    56,   222,    51,
-     219,   222,    91,    91,    89,    90,    91,    92,    93,    91,
-      91,    96,    97,   222,    91,   222,   222,   131,   103,   104,
-     105,   222,   133,   133,   222,   222,   131,   169,   208,   209,
-     210,   211,   212,   213,   214,   215,   150,   151,   152,   153,
-     125,   222,    91,   185,   158,   150,   151,   152,   153,     4,
-       3,   218,   222,   158,   222,   197,   222,   222,    65,   222,
-     222,   222,   222,   205,   206,   222,    89,    90,    91,    92,
-      93,     6,   222,    96,    97,    53,   218,   222,    52,     6,
-     103,   104,   105,   222,     6,   222,   222,   222,   222,   222,
-     222,   222,   222,   222,   208,   209,   210,   211,   212,   213,
-     214,   215,   125,   208,   209,   210,   211,   212,   213,   214,
-     215,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,   104,   222,   106,
-     107,   108,   109,   110,   111,   222,   222,   114,   222,   222,
-     117,   118,   119,   120,   121,   122,   123,   124,    89,    90,
-      91,    92,    93,   222,   222,    96,    97,   222,     6,   222,
-     222,   222,   103,   104,   105,    89,    90,    91,    92,    93,
-       6,   222,    96,    97,   222,   222,   222,   222,   222,   103,
-     104,   105,   222,   222,   125,   222,   222,   222,    89,    90,
-      91,    92,    93,   222,   222,    96,    97,   222,   222,     6,
-     222,   125,   103,   104,   105,   222,   222,   222,   222,   222,
-       6,     6,   222,   222,   222,   219,     6,     6,     6,   222,
-       6,     6,     6,     6,   125,     6,     6,     6,     6,     6,
-       6,   222,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,   222,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,   222,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,   222,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,   222,     6,     4,     4,     4,
-       4,     4,   219,   219,     6,   219,    61,   219,   219,   219,
-     219,   219,     6,   219,   219,     6,   219,     6,   219,   219,
-     219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
-     219,   219,   219,   219,   219,   219,   219,   219,     6,   219,
-     219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
-     219,   219,   219,   219,   219,   219,   219,   219,   219,     6,
-     219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
-       6,   219,   165,   222,   219,   222,   222,   219,   219,   219,
-     219,   219,     4,     4,   219,   219,    48,     6,     6,   222,
-     222,   165,   218,     6,   219,     4,   219,    48,     4,     6,
-     218,     6,   219,    47,   219,   219,    39,    39,     4,   218,
-      39,   219,    39,    39,    39,     3,   218,   218,     3,   219,
-       3,   219,   219,   132,    65,   647,   736,    22,   734,   384,
-     229,   605,   218,   786,   347,   442,   920,   467,   408,   925,
-     546,   752,   264,   764,   885,    -1,   190,   764,   469,    -1,
-      -1,    -1,    -1,   783
+     463,   218,   135,   136,   137,   217,   926,   216,   217,   194,
+     218,   213,   213,   926,   926,   231,   926,    33,   926,   926,
+      72,     3,     4,     5,     6,   168,   220,   502,   222,   216,
+     279,   169,   155,   156,    50,   155,   156,   224,   225,   155,
+     156,   155,   156,     3,   194,   496,     3,    72,   933,    74,
+       8,   189,   155,   156,   222,   193,   224,     8,   196,   168,
+     155,   156,   537,   538,     8,     8,     8,   131,    83,   520,
+      85,   546,    87,   548,    67,    68,   527,     8,   130,   134,
+       3,     8,    64,   216,    72,    78,    79,    80,   152,   153,
+      72,    73,   225,   172,   219,     8,   219,   222,   561,   219,
+      82,   159,    84,   219,     8,   219,   131,    65,     8,     0,
+     165,   562,  1099,  1100,    65,    33,   219,    35,   100,   101,
+     102,    65,    65,    65,   106,   150,   151,   152,   153,   154,
+     346,   606,     8,   158,    65,   217,   372,  1006,    65,   127,
+     222,   129,   130,    71,   132,   209,   210,   211,   212,   213,
+     214,   215,    65,   135,   136,   137,   138,   406,   140,    39,
+     142,    65,   144,   908,   146,    65,   148,   383,    48,     3,
+       4,     5,     6,   555,   217,   157,   221,    32,    33,   222,
+     159,   160,   161,   208,   209,   210,   211,   212,   213,   214,
+     215,   184,     3,    32,   669,    50,   671,   179,   177,   181,
+      72,   183,    41,    32,    33,    77,  1020,  1194,    10,  1196,
+     120,   219,   122,   123,   222,    71,   126,   680,     3,     4,
+       5,     6,    24,    25,     3,  1212,    20,  1214,    22,   211,
+     212,   213,    14,    27,   216,   698,   218,   219,    72,    73,
+     220,   223,   693,   225,   166,   167,   185,   186,    82,   171,
+      84,   190,   719,    87,     3,   127,    39,   129,   130,    42,
+      43,   173,   174,   764,    47,    48,   100,   101,   102,     3,
+      39,   217,   106,    42,    43,     3,   222,   513,    47,    48,
+     217,   530,   199,   200,   201,   222,   761,    72,    73,   213,
+     214,   215,    77,   768,    83,   746,    85,    82,    87,    84,
+       3,   135,   136,   137,   138,   179,   140,   181,   142,   183,
+     144,   218,   146,   562,   148,   100,   101,   102,   763,     3,
+     765,   106,    76,   157,     3,     4,     5,     6,  1197,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   187,   188,    72,  1213,   179,  1215,   181,     6,   183,
+     135,   136,   137,   138,     3,   140,     3,   142,    54,   144,
+     222,   146,  1231,   148,   155,   156,     3,     4,     5,     6,
+     194,   219,   157,   880,   222,   173,   174,   211,   212,   213,
+       6,  1250,   216,   219,   218,  1254,   222,   219,   194,   223,
+     222,   225,   219,   194,   179,   222,   181,   219,   183,     4,
+     222,    75,   131,    89,    90,    91,    92,    93,    44,    45,
+      96,    97,    53,    54,    55,    56,   194,   103,   104,   105,
+     192,   150,   151,   152,   153,    21,   211,   212,   213,   158,
+     194,   216,   219,   218,    64,    72,    73,    66,   223,   125,
+     225,     5,     6,   219,   693,    82,   222,    84,    55,    56,
+      57,    58,    59,    60,   219,    62,    63,     3,     4,     5,
+       6,     5,     6,   100,   101,   102,    44,    45,    72,   106,
+      46,    47,    48,    49,   219,   219,   712,   222,   222,   208,
+     209,   210,   211,   212,   213,   214,   215,     3,   219,   219,
+     219,   222,   222,   219,   219,     3,   222,   222,   135,   136,
+     137,   138,    61,   140,    61,   142,   218,   144,     3,   146,
+     219,   148,     7,   222,     9,    10,    11,    12,    13,    14,
+     157,    16,   219,    42,    43,   222,    72,    73,    23,   219,
+      73,    26,   222,    28,    29,    30,    82,   219,    84,     3,
+     222,     3,   179,   131,   181,     3,   183,     3,  1023,     3,
+       4,     5,     6,    65,   100,   101,   102,     4,   219,   219,
+     106,   222,   150,   151,   152,   153,   219,   923,   924,   222,
+     158,  1022,     3,     3,   211,   212,   213,   219,     4,   216,
+     222,   218,    77,    61,   219,   218,   223,   222,   225,   135,
+     136,   137,   138,     4,   140,   165,   142,     6,   144,     3,
+     146,     6,   148,     4,     3,    54,     4,     4,   194,     3,
+       3,   157,    52,    73,    67,   133,     3,    61,    72,   208,
+     208,   209,   210,   211,   212,   213,   214,   215,    82,  1104,
+      84,    77,    77,   179,   218,   181,   218,   183,   218,     4,
+       4,     4,     4,   218,   218,     6,   100,   101,   102,   218,
+     218,   218,   106,   218,   220,   218,   218,   218,     3,     6,
+      46,    46,    76,     4,    77,   211,   212,   213,     6,     3,
+     216,   219,   218,    76,   169,     4,    68,   223,   219,   225,
+       4,   135,   136,   137,   138,    54,   140,   218,   142,     3,
+     144,     3,   146,   218,   148,   218,   218,   218,    32,    33,
+      77,    35,   197,   157,     4,     0,    40,    41,   218,   218,
+       4,   206,     7,   218,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,   218,   218,   179,     4,   181,    23,   183,
+     226,    26,   219,    28,    29,    30,    76,     3,   218,    72,
+     216,     6,   219,     5,     7,     6,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,     6,    42,   211,   212,   213,
+      23,   218,   216,    26,   218,    28,    29,    30,   218,   223,
+       7,   225,     9,    10,    11,    12,    13,    14,     3,    16,
+     218,   165,    77,     6,     4,   165,    23,    75,   222,    26,
+     218,    28,    29,    30,     3,     3,   128,   133,   131,   222,
+     158,   219,    75,     4,   155,   222,   218,   130,    72,     6,
+     226,   226,     6,     3,    77,     3,   222,   150,   151,   152,
+     153,     6,   155,     4,     4,   158,   178,   161,   162,   163,
+     164,     4,   166,   167,     4,   218,   170,   171,   172,   218,
+      77,   175,   218,   177,   218,   218,   218,   181,   182,    31,
+     218,   218,   218,     6,     6,    89,    90,    91,    92,    93,
+     194,   195,    96,    97,   198,   218,     4,   131,   202,   103,
+     104,   105,     3,   219,   169,   208,   209,   210,   211,   212,
+     213,   214,   215,   160,     6,   222,   150,   151,   152,   153,
+     185,   125,   218,   170,   158,     4,   173,   174,   175,   219,
+     177,   219,   197,    77,   219,     6,   169,     5,    49,    46,
+     205,   206,   208,     6,   191,   192,   222,   194,   195,     6,
+     130,   128,   185,   218,   165,   218,   132,   219,   133,   216,
+       4,   216,   169,   222,   197,   219,   218,     6,   219,     6,
+      56,    56,   205,   206,   208,   209,   210,   211,   212,   213,
+     214,   215,     3,   222,    51,   218,    91,    91,    91,   219,
+     197,   133,   133,    89,    90,    91,    92,    93,   222,   206,
+      96,    97,   222,   222,   222,   222,   222,   103,   104,   105,
+     222,   218,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   125,
+     106,   107,   108,   109,   110,   111,   222,   222,   114,   222,
+     222,   117,   118,   119,   120,   121,   122,   123,   124,    89,
+      90,    91,    92,    93,   222,    91,    96,    97,    91,   222,
+     222,   222,    91,   103,   104,   105,    89,    90,    91,    92,
+      93,     4,     3,    96,    97,   222,   222,   222,    65,     6,
+     103,   104,   105,   222,   222,   125,   222,   222,   222,    89,
+      90,    91,    92,    93,   222,   222,    96,    97,   222,   219,
+     218,   222,   125,   103,   104,   105,   222,   222,   222,   222,
+     222,    52,   222,   222,    53,     6,   222,     6,     6,     6,
+     222,     6,   222,   222,   222,   125,     6,   222,   222,   222,
+       6,   222,   222,   222,   222,   222,     6,     6,   222,   222,
+     222,   222,   222,     6,   222,   222,     6,   222,   222,   222,
+     222,     6,   222,   222,     6,     6,   222,   222,   222,     6,
+     222,   222,     6,     6,     6,     6,     6,   222,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,   222,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+     222,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+     222,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+       6,   222,     6,     4,     4,     4,     4,     4,   219,   222,
+       6,   219,    61,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,     6,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,   219,     6,   219,   219,   219,   219,   219,   219,
+     219,   219,   219,   219,     6,   219,   219,   219,   219,   219,
+     219,   219,   219,   219,   219,     6,   219,   219,   219,   219,
+     219,   219,   219,   219,   219,   219,     6,   219,     6,   219,
+       4,   219,   219,   219,   219,   219,   165,   219,     4,   219,
+     219,   219,    48,     6,     6,   219,   222,   222,   219,   219,
+     219,   219,   219,   219,   219,     6,   165,   218,   222,   222,
+     219,     4,   219,    48,     4,     6,   218,     6,   219,   219,
+      47,   219,    39,     4,    39,   218,     3,   219,    39,    39,
+      39,    39,   218,     3,   218,     3,   219,   219,   219,   132,
+      65,   735,   737,   648,   385,   218,    22,   787,   921,   348,
+     926,   229,   765,   606,   765,   409,   547,    -1,   264,   784,
+     886,   753,    -1,   190,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   468,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   443,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   470
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1665,191 +1676,191 @@ static const yytype_int16 yystos[] =
 {
        0,     7,     9,    10,    11,    12,    13,    14,    15,    16,
       17,    23,    26,    28,    29,    30,    77,   169,   185,   197,
-     205,   206,   218,   227,   228,   229,   231,   243,   244,   246,
-     247,   250,   251,   252,   253,   254,   278,   283,   284,   285,
-     286,   287,   288,   289,   290,    32,    33,    34,    38,    39,
-     194,    36,    32,    33,    34,    38,    39,   194,     3,   276,
-      75,   276,   166,   167,   171,     3,   230,   231,   243,   244,
-     247,   250,   251,   252,   283,   284,   285,   286,   287,     3,
+     205,   206,   218,   228,   229,   230,   232,   244,   245,   247,
+     248,   251,   252,   253,   254,   255,   279,   284,   285,   286,
+     287,   288,   289,   290,   291,    32,    33,    34,    38,    39,
+     194,    36,    32,    33,    34,    38,    39,   194,     3,   277,
+      75,   277,   166,   167,   171,     3,   231,   232,   244,   245,
+     248,   251,   252,   253,   284,   285,   286,   287,   288,     3,
       32,    33,    35,    40,    41,   161,   162,   163,   164,   166,
      167,   170,   171,   172,   175,   177,   181,   182,   194,   195,
      198,   202,    33,    33,    39,   159,   160,   161,   177,     3,
-       3,   276,     3,   279,   280,   172,     7,    12,    14,    16,
-     169,   189,   193,   196,    32,    33,    33,    50,   159,   253,
-     254,     0,   221,   339,    20,    22,    27,   272,     8,   255,
-     257,    71,   338,   338,   338,   338,   338,   340,     3,   276,
-      71,   337,   337,   337,   337,   337,     3,   220,    14,   276,
-      75,    76,   218,     3,     3,     3,   230,   218,     3,   276,
+       3,   277,     3,   280,   281,   172,     7,    12,    14,    16,
+     169,   189,   193,   196,    32,    33,    33,    50,   159,   254,
+     255,     0,   221,   340,    20,    22,    27,   273,     8,   256,
+     258,    71,   339,   339,   339,   339,   339,   341,     3,   277,
+      71,   338,   338,   338,   338,   338,     3,   220,    14,   277,
+      75,    76,   218,     3,     3,     3,   231,   218,     3,   277,
        6,   204,   173,   174,   173,   174,     3,    76,     6,     3,
-     199,   200,   201,   200,   203,   276,   276,     3,    61,    54,
+     199,   200,   201,   200,   203,   277,   277,     3,    61,    54,
      222,     6,   194,   194,   185,   186,   190,   160,   170,   173,
      174,   175,   177,   191,   192,   194,   195,   194,     4,   192,
-      75,   194,   194,   276,   219,   219,   229,    21,   218,   256,
-     257,    64,   264,    66,   258,    72,     3,   276,   276,   276,
-       3,    61,    61,   218,   245,    73,     3,   276,   276,   276,
-       3,     3,     3,   248,   249,    65,   269,     4,   336,   336,
+      75,   194,   194,   277,   219,   219,   230,    21,   218,   257,
+     258,    64,   265,    66,   259,    72,     3,   277,   277,   277,
+       3,    61,    61,   218,   246,    73,     3,   277,   277,   277,
+       3,     3,     3,   249,   250,    65,   270,     4,   337,   337,
        3,     4,     5,     6,    72,    73,    82,    84,   100,   101,
      102,   106,   135,   136,   137,   138,   140,   142,   144,   146,
      148,   157,   179,   181,   183,   211,   212,   213,   216,   218,
-     224,   291,   293,   294,   295,   296,   297,   298,   299,   300,
-     301,   304,   305,   306,   307,   308,   310,   311,   312,   313,
-     314,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   328,   329,   330,   331,   332,   333,     3,     5,     6,
-      61,   168,     3,     5,     6,    61,   168,     3,     5,     6,
-      61,   168,   219,    39,    42,    43,    47,    48,     3,     3,
-     336,     4,    10,    24,    25,    61,   276,   218,   280,   336,
-       4,   165,     6,     3,     6,     4,     3,     4,    54,     4,
-     194,     3,     3,   256,   257,   291,    52,    67,   262,    73,
-     133,    54,   218,   245,   276,    32,    33,    50,     3,   242,
-      37,   254,    61,   208,   222,   269,   294,    77,    77,   218,
-     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
-     148,   149,    72,    73,   295,   218,   218,    87,   294,   309,
-       4,     4,     4,     4,     6,   333,   218,   218,   218,   218,
-     218,   218,   218,   120,   122,   123,   126,   218,   218,   295,
-     295,     5,     6,   217,   314,   326,   327,   254,   294,   223,
-     313,   219,   222,    54,   155,   156,    72,    74,   131,   150,
-     151,   152,   153,   154,   158,   208,   209,   210,   211,   212,
-     213,   214,   215,   220,   217,   222,   217,   222,   217,   222,
-     222,   223,   217,   222,   217,   222,     3,     6,    46,    46,
-      76,   276,    77,   341,   255,     4,    39,    48,     6,    76,
-     187,   188,     4,   219,   219,    81,   265,   259,   260,   294,
-     294,    68,   263,     4,   252,     3,   127,   129,   232,   234,
-     235,   241,    54,   218,   345,     3,     3,   219,   222,   218,
-     292,   276,   294,   249,   218,   218,    64,   219,   291,   218,
-      72,   254,   294,   294,   309,    83,    85,    87,   294,   294,
-     294,   294,   294,   294,     4,   218,   218,   218,   218,     4,
-       4,   225,   219,   219,    76,   293,     3,   294,   294,    74,
-     158,   218,    72,   130,   295,   295,   295,   295,   295,   295,
-     295,   295,   295,   295,   295,   295,   295,   295,     3,   213,
-     314,     6,   326,     6,   327,   313,     6,     5,    42,    44,
-      45,   218,   218,     3,   218,   219,     6,    32,    41,     4,
-     165,   165,   291,    75,   266,   222,    69,    70,   261,   294,
-     133,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,   104,   106,   107,
-     108,   109,   110,   111,   114,   117,   118,   119,   120,   121,
-     122,   123,   124,   237,   128,   218,   219,   222,   252,     3,
-     133,     3,   291,   222,    67,    68,    78,    79,    80,   184,
-     334,   335,   334,   291,   219,   254,   219,    54,    86,    83,
-      85,   294,   294,   219,   219,   219,   219,   219,   219,    75,
-     294,     3,   312,   294,     4,   222,   268,   219,   222,     5,
-       6,   336,   218,   295,   254,   291,   130,   155,   225,   225,
-       6,     6,   242,   233,   235,     3,   343,   344,     6,     4,
-       4,   218,   273,   274,   275,   276,   281,   178,   267,   260,
-       4,   218,   218,   218,   218,   218,   218,   218,   218,   218,
-      72,   127,   129,   130,   238,   239,   341,   218,   242,    31,
-     342,   234,   219,     4,   219,   218,     6,     6,     4,     3,
-       6,   219,   222,   219,   219,   219,   237,   294,   294,    83,
-      86,   295,   222,   222,   222,   222,     4,    65,   219,     4,
-      77,   254,   291,   219,   219,   295,    49,    46,   219,   219,
-     222,   208,   219,   222,     6,   252,   222,    55,    57,    58,
-      59,    60,    62,    63,   282,     3,    54,   277,   296,   297,
-     298,   299,   300,   301,   302,   303,   269,     6,   237,   236,
-     237,    89,    90,    91,    92,    93,    96,    97,   103,   104,
-     105,   125,    89,    90,    91,    92,    93,    96,    97,   103,
+     223,   225,   292,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   305,   306,   307,   308,   309,   311,   312,   313,
+     314,   315,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   329,   330,   331,   332,   333,   334,     3,     5,
+       6,    61,   168,     3,     5,     6,    61,   168,     3,     5,
+       6,    61,   168,   219,    39,    42,    43,    47,    48,     3,
+       3,   337,     4,    10,    24,    25,    61,   277,   218,   281,
+     337,     4,   165,     6,     3,     6,     4,     3,     4,    54,
+       4,   194,     3,     3,   257,   258,   292,    52,    67,   263,
+      73,   133,    54,   218,   246,   277,    32,    33,    50,     3,
+     243,    37,   255,    61,   208,   222,   270,   295,    77,    77,
+     218,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,    72,    73,   296,   218,   218,    87,   295,
+     310,     4,     4,     4,     4,     6,   334,   218,   218,   218,
+     218,   218,   218,   218,   120,   122,   123,   126,   218,   218,
+     296,   296,     5,     6,   217,   315,   327,   328,   255,   295,
+     224,   314,   219,   222,    54,   155,   156,    72,    74,   131,
+     150,   151,   152,   153,   154,   158,   208,   209,   210,   211,
+     212,   213,   214,   215,   220,   217,   222,   217,   222,   217,
+     222,   222,   224,   217,   222,   217,   222,     3,     6,    46,
+      46,    76,   277,    77,   342,   256,     4,    39,    48,     6,
+      76,   187,   188,     4,   219,   219,    81,   266,   260,   261,
+     295,   295,    68,   264,     4,   253,     3,   127,   129,   233,
+     235,   236,   242,    54,   218,   346,     3,     3,   219,   222,
+     218,   293,   277,   295,   250,   218,   218,    64,   219,   292,
+     218,    72,   255,   295,   295,   310,    83,    85,    87,   295,
+     295,   295,   295,   295,   295,     4,   218,   218,   218,   218,
+       4,     4,   226,   219,   219,    76,   294,     3,   295,   295,
+      74,   158,   218,    72,   130,   296,   296,   296,   296,   296,
+     296,   296,   296,   296,   296,   296,   296,   296,   296,     3,
+     213,   315,     6,   327,     6,   328,   314,     6,     5,    42,
+      44,    45,   218,   218,     3,   218,   219,     6,    32,    41,
+       4,   165,   165,   292,    75,   267,   222,    69,    70,   262,
+     295,   133,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   106,
+     107,   108,   109,   110,   111,   114,   117,   118,   119,   120,
+     121,   122,   123,   124,   238,   128,   218,   219,   222,   253,
+       3,   133,     3,   292,   222,    67,    68,    78,    79,    80,
+     184,   335,   336,   335,   292,   219,   255,   219,    54,    86,
+      83,    85,   295,   295,   219,   219,   219,   219,   219,   219,
+      75,   295,     3,   313,   295,     4,   222,   269,   219,   222,
+       5,     6,   337,   218,   296,   255,   292,   130,   155,   226,
+     226,     6,     6,   243,   234,   236,     3,   344,   345,     6,
+       4,     4,   218,   274,   275,   276,   277,   282,   178,   268,
+     261,     4,   218,   218,   218,   218,   218,   218,   218,   218,
+     218,    72,   127,   129,   130,   239,   240,   342,   218,   243,
+      31,   343,   235,   219,     4,   219,   218,     6,     6,     4,
+       3,     6,   219,   222,   219,   219,   219,   238,   295,   295,
+      83,    86,   296,   222,   222,   222,   222,     4,    65,   219,
+       4,    77,   255,   292,   219,   219,   296,    49,    46,   219,
+     219,   222,   208,   219,   222,     6,   253,   222,    55,    57,
+      58,    59,    60,    62,    63,   283,     3,    54,   278,   297,
+     298,   299,   300,   301,   302,   303,   304,   270,     6,   238,
+     237,   238,    89,    90,    91,    92,    93,    96,    97,   103,
      104,   105,   125,    89,    90,    91,    92,    93,    96,    97,
      103,   104,   105,   125,    89,    90,    91,    92,    93,    96,
       97,   103,   104,   105,   125,    89,    90,    91,    92,    93,
       96,    97,   103,   104,   105,   125,    89,    90,    91,    92,
-      93,    96,    97,   103,   104,   105,   125,   130,   128,   132,
-     239,   240,   240,   242,   219,   218,   133,   165,   291,   335,
-     219,    83,   294,   219,   216,   328,   314,   216,   315,   318,
-     323,   328,     4,   222,   268,   294,   219,   218,   219,   219,
-       6,     6,   235,     3,     4,     5,     6,   344,    33,    35,
-     219,   274,    56,    56,     3,   222,    51,   271,   219,   222,
-     219,   219,   222,   222,   222,   222,   222,   222,   222,   222,
-     222,   222,    91,   222,   222,   222,   222,   222,   222,   222,
+      93,    96,    97,   103,   104,   105,   125,    89,    90,    91,
+      92,    93,    96,    97,   103,   104,   105,   125,   130,   128,
+     132,   240,   241,   241,   243,   219,   218,   133,   165,   292,
+     336,   219,    83,   295,   219,   216,   329,   315,   216,   316,
+     319,   324,   329,     4,   222,   269,   295,   219,   218,   219,
+     219,     6,     6,   236,     3,     4,     5,     6,   345,    33,
+      35,   219,   275,    56,    56,     3,   222,    51,   272,   219,
+     222,   219,   219,   222,   222,   222,   222,   222,   222,   222,
      222,   222,   222,    91,   222,   222,   222,   222,   222,   222,
      222,   222,   222,   222,    91,   222,   222,   222,   222,   222,
      222,   222,   222,   222,   222,    91,   222,   222,   222,   222,
      222,   222,   222,   222,   222,   222,    91,   222,   222,   222,
-     222,   222,   222,   222,   222,   222,   222,    91,   222,   313,
-     133,   133,   219,   343,     4,     3,   219,     6,   222,   222,
-     222,   222,   268,   219,   334,     6,   277,   275,   275,   218,
-     302,    52,    53,   270,     6,   237,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,   222,     6,     6,     6,     6,
+     222,   222,   222,   222,   222,   222,   222,    91,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,    91,   222,
+     314,   133,   133,   219,   344,     4,     3,   219,     6,   222,
+     222,   222,   222,   269,   219,   335,     6,   278,   276,   276,
+     218,   303,    52,    53,   271,     6,   238,     6,     6,     6,
        6,     6,     6,     6,     6,     6,   222,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,   222,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,   222,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,   222,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-     222,     6,     4,     4,   219,   341,     4,     4,     4,     4,
-     219,   219,     6,    61,   242,   291,   294,   219,   219,   219,
-     219,   219,   219,   219,   219,   219,   219,     6,   219,   219,
+     222,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+       6,   222,     6,     4,     4,   219,   342,     4,     4,     4,
+       4,   219,   219,     6,    61,   243,   292,   295,   219,   219,
      219,   219,   219,   219,   219,   219,   219,   219,     6,   219,
      219,   219,   219,   219,   219,   219,   219,   219,   219,     6,
      219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
        6,   219,   219,   219,   219,   219,   219,   219,   219,   219,
      219,     6,   219,   219,   219,   219,   219,   219,   219,   219,
-     219,   219,     6,   219,   222,   222,   222,   268,   268,   165,
-      39,    42,    43,    47,    48,   294,   219,   219,   219,   219,
-     219,   219,   219,     4,     4,     6,   219,   219,    48,     6,
-       6,   222,   268,   222,   268,   341,   165,   218,     6,    44,
-      45,     6,   219,     4,   219,    48,     4,    42,    43,     6,
-     268,   341,   268,   134,   165,   341,   218,   219,     6,    47,
-     219,   219,    39,    39,     4,   134,   165,   341,   134,   165,
-     218,   219,    39,    39,    39,    39,     3,   218,   218,   219,
-       3,     3,   341,   219,   219,   341
+     219,   219,     6,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,   219,     6,   219,   222,   222,   222,   269,   269,
+     165,    39,    42,    43,    47,    48,   295,   219,   219,   219,
+     219,   219,   219,   219,     4,     4,     6,   219,   219,    48,
+       6,     6,   222,   269,   222,   269,   342,   165,   218,     6,
+      44,    45,     6,   219,     4,   219,    48,     4,    42,    43,
+       6,   269,   342,   269,   134,   165,   342,   218,   219,     6,
+      47,   219,   219,    39,    39,     4,   134,   165,   342,   134,
+     165,   218,   219,    39,    39,    39,    39,     3,   218,   218,
+     219,     3,     3,   342,   219,   219,   342
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   226,   227,   228,   228,   229,   229,   229,   229,   229,
-     229,   229,   229,   229,   229,   229,   229,   229,   229,   229,
-     229,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   231,   231,   231,   231,   231,   231,   231,
-     231,   231,   231,   232,   232,   233,   233,   234,   234,   235,
-     235,   235,   235,   236,   236,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   238,
-     238,   239,   239,   239,   239,   240,   240,   241,   241,   242,
-     242,   243,   244,   244,   245,   245,   246,   246,   247,   248,
-     248,   249,   250,   250,   250,   250,   250,   251,   251,   251,
-     252,   252,   252,   252,   253,   253,   254,   255,   256,   256,
-     257,   258,   258,   259,   259,   260,   261,   261,   261,   262,
-     262,   263,   263,   264,   264,   265,   265,   266,   266,   267,
-     267,   268,   268,   269,   269,   270,   270,   271,   271,   272,
-     272,   272,   272,   273,   273,   274,   274,   275,   275,   276,
-     276,   277,   277,   277,   277,   278,   278,   279,   279,   280,
-     281,   281,   282,   282,   282,   282,   282,   282,   282,   283,
-     283,   283,   283,   283,   283,   283,   283,   283,   283,   283,
-     283,   283,   283,   283,   283,   283,   283,   283,   283,   283,
-     283,   283,   283,   283,   283,   283,   283,   283,   283,   283,
-     283,   283,   283,   283,   283,   283,   283,   283,   283,   283,
-     284,   284,   284,   284,   285,   285,   286,   286,   286,   286,
-     286,   286,   286,   286,   286,   286,   286,   286,   286,   286,
-     286,   286,   286,   286,   286,   286,   286,   286,   286,   286,
-     286,   287,   288,   288,   288,   288,   288,   288,   288,   288,
-     288,   288,   288,   288,   288,   288,   288,   288,   288,   288,
-     288,   288,   288,   288,   288,   288,   288,   288,   288,   288,
-     288,   288,   288,   288,   288,   288,   288,   288,   289,   289,
-     289,   290,   290,   291,   291,   292,   292,   293,   293,   294,
-     294,   294,   294,   294,   295,   295,   295,   295,   295,   295,
-     295,   295,   295,   295,   295,   295,   295,   296,   296,   296,
-     297,   297,   297,   297,   298,   298,   298,   298,   299,   299,
-     299,   299,   300,   300,   301,   301,   302,   302,   302,   302,
-     302,   302,   303,   303,   304,   304,   304,   304,   304,   304,
-     304,   304,   304,   304,   304,   304,   304,   304,   304,   304,
-     304,   304,   304,   304,   304,   304,   304,   304,   304,   304,
-     304,   304,   304,   305,   305,   306,   307,   307,   308,   308,
-     308,   308,   309,   309,   310,   311,   311,   311,   311,   312,
-     312,   312,   312,   313,   313,   313,   313,   313,   313,   313,
-     313,   313,   313,   313,   313,   313,   314,   314,   314,   314,
-     315,   315,   315,   316,   317,   317,   318,   318,   319,   320,
-     320,   321,   322,   322,   323,   324,   324,   325,   325,   326,
-     327,   328,   328,   329,   330,   330,   331,   332,   332,   333,
-     333,   333,   333,   333,   333,   333,   333,   333,   333,   333,
-     333,   334,   334,   335,   335,   335,   335,   335,   335,   336,
-     337,   337,   338,   338,   339,   339,   340,   340,   341,   341,
-     342,   342,   343,   343,   344,   344,   344,   344,   344,   345,
-     345
+       0,   227,   228,   229,   229,   230,   230,   230,   230,   230,
+     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
+     230,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   233,   233,   234,   234,   235,   235,   236,
+     236,   236,   236,   237,   237,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   239,
+     239,   240,   240,   240,   240,   241,   241,   242,   242,   243,
+     243,   244,   245,   245,   246,   246,   247,   247,   248,   249,
+     249,   250,   251,   251,   251,   251,   251,   252,   252,   252,
+     253,   253,   253,   253,   254,   254,   255,   256,   257,   257,
+     258,   259,   259,   260,   260,   261,   262,   262,   262,   263,
+     263,   264,   264,   265,   265,   266,   266,   267,   267,   268,
+     268,   269,   269,   270,   270,   271,   271,   272,   272,   273,
+     273,   273,   273,   274,   274,   275,   275,   276,   276,   277,
+     277,   278,   278,   278,   278,   279,   279,   280,   280,   281,
+     282,   282,   283,   283,   283,   283,   283,   283,   283,   284,
+     284,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     284,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     284,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     284,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     285,   285,   285,   285,   286,   286,   287,   287,   287,   287,
+     287,   287,   287,   287,   287,   287,   287,   287,   287,   287,
+     287,   287,   287,   287,   287,   287,   287,   287,   287,   287,
+     287,   288,   289,   289,   289,   289,   289,   289,   289,   289,
+     289,   289,   289,   289,   289,   289,   289,   289,   289,   289,
+     289,   289,   289,   289,   289,   289,   289,   289,   289,   289,
+     289,   289,   289,   289,   289,   289,   289,   289,   290,   290,
+     290,   291,   291,   292,   292,   293,   293,   294,   294,   295,
+     295,   295,   295,   295,   296,   296,   296,   296,   296,   296,
+     296,   296,   296,   296,   296,   296,   296,   296,   297,   297,
+     297,   298,   298,   298,   298,   299,   299,   299,   299,   300,
+     300,   300,   300,   301,   301,   302,   302,   303,   303,   303,
+     303,   303,   303,   304,   304,   305,   305,   305,   305,   305,
+     305,   305,   305,   305,   305,   305,   305,   305,   305,   305,
+     305,   305,   305,   305,   305,   305,   305,   305,   305,   305,
+     305,   305,   305,   305,   306,   306,   307,   308,   308,   309,
+     309,   309,   309,   310,   310,   311,   312,   312,   312,   312,
+     313,   313,   313,   313,   314,   314,   314,   314,   314,   314,
+     314,   314,   314,   314,   314,   314,   314,   315,   315,   315,
+     315,   316,   316,   316,   317,   318,   318,   319,   319,   320,
+     321,   321,   322,   323,   323,   324,   325,   325,   326,   326,
+     327,   328,   329,   329,   330,   331,   331,   332,   333,   333,
+     334,   334,   334,   334,   334,   334,   334,   334,   334,   334,
+     334,   334,   335,   335,   336,   336,   336,   336,   336,   336,
+     337,   338,   338,   339,   339,   340,   340,   341,   341,   342,
+     342,   343,   343,   344,   344,   345,   345,   345,   345,   345,
+     346,   346
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1893,24 +1904,24 @@ static const yytype_int8 yyr2[] =
        4,     3,     4,     3,     3,     5,     7,     7,     6,     8,
        8,     2,     3,     1,     3,     3,     5,     3,     1,     1,
        1,     1,     1,     1,     3,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,    14,    19,    16,
-      20,    16,    15,    13,    18,    14,    13,    11,     8,    10,
-      13,    15,     5,     7,     4,     6,     1,     1,     1,     1,
-       1,     1,     1,     3,     3,     4,     5,     4,     4,     4,
-       4,     4,     4,     4,     3,     2,     2,     2,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,    14,    19,
+      16,    20,    16,    15,    13,    18,    14,    13,    11,     8,
+      10,    13,    15,     5,     7,     4,     6,     1,     1,     1,
+       1,     1,     1,     1,     3,     3,     4,     5,     4,     4,
+       4,     4,     4,     4,     4,     3,     2,     2,     2,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       6,     3,     4,     3,     3,     5,     5,     6,     4,     6,
-       3,     5,     4,     5,     6,     4,     5,     5,     6,     1,
-       3,     1,     3,     1,     1,     1,     1,     1,     2,     2,
-       2,     2,     2,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     2,     2,     3,     1,     1,     2,     2,
-       3,     2,     2,     3,     2,     2,     2,     2,     3,     3,
-       3,     1,     1,     2,     2,     3,     2,     2,     3,     2,
+       3,     6,     3,     4,     3,     3,     5,     5,     6,     4,
+       6,     3,     5,     4,     5,     6,     4,     5,     5,     6,
+       1,     3,     1,     3,     1,     1,     1,     1,     1,     2,
+       2,     2,     2,     2,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     2,     3,     1,     1,     2,
+       2,     3,     2,     2,     3,     2,     2,     2,     2,     3,
+       3,     3,     1,     1,     2,     2,     3,     2,     2,     3,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     1,     3,     2,     2,     1,     2,     2,     2,     1,
-       2,     0,     3,     0,     1,     0,     2,     0,     4,     0,
-       4,     0,     1,     3,     1,     3,     3,     3,     3,     6,
-       3
+       2,     2,     1,     3,     2,     2,     1,     2,     2,     2,
+       1,     2,     0,     3,     0,     1,     0,     2,     0,     4,
+       0,     4,     0,     1,     3,     1,     3,     3,     3,     3,
+       6,     3
 };
 
 
@@ -2478,7 +2489,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2482 "parser.cpp"
+#line 2493 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2486,7 +2497,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2490 "parser.cpp"
+#line 2501 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2500,7 +2511,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2504 "parser.cpp"
+#line 2515 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2514,7 +2525,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2518 "parser.cpp"
+#line 2529 "parser.cpp"
         break;
 
     case YYSYMBOL_column_def_array: /* column_def_array  */
@@ -2528,7 +2539,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_def_array_t));
     }
 }
-#line 2532 "parser.cpp"
+#line 2543 "parser.cpp"
         break;
 
     case YYSYMBOL_column_type_array: /* column_type_array  */
@@ -2537,7 +2548,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy column_type_array\n");
     delete (((*yyvaluep).column_type_array_t));
 }
-#line 2541 "parser.cpp"
+#line 2552 "parser.cpp"
         break;
 
     case YYSYMBOL_column_type: /* column_type  */
@@ -2546,7 +2557,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy column_type\n");
     delete (((*yyvaluep).column_type_t));
 }
-#line 2550 "parser.cpp"
+#line 2561 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2557,7 +2568,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2561 "parser.cpp"
+#line 2572 "parser.cpp"
         break;
 
     case YYSYMBOL_default_expr: /* default_expr  */
@@ -2565,7 +2576,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2569 "parser.cpp"
+#line 2580 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2574,7 +2585,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2578 "parser.cpp"
+#line 2589 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2583,7 +2594,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2587 "parser.cpp"
+#line 2598 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2597,7 +2608,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2601 "parser.cpp"
+#line 2612 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2608,7 +2619,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2612 "parser.cpp"
+#line 2623 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2618,7 +2629,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2622 "parser.cpp"
+#line 2633 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2628,7 +2639,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2632 "parser.cpp"
+#line 2643 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2638,7 +2649,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2642 "parser.cpp"
+#line 2653 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2648,7 +2659,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2652 "parser.cpp"
+#line 2663 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2658,7 +2669,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2662 "parser.cpp"
+#line 2673 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2668,7 +2679,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2672 "parser.cpp"
+#line 2683 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2682,7 +2693,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2686 "parser.cpp"
+#line 2697 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2696,7 +2707,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2700 "parser.cpp"
+#line 2711 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2706,7 +2717,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2710 "parser.cpp"
+#line 2721 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2714,7 +2725,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2718 "parser.cpp"
+#line 2729 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2722,7 +2733,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2726 "parser.cpp"
+#line 2737 "parser.cpp"
         break;
 
     case YYSYMBOL_highlight_clause: /* highlight_clause  */
@@ -2736,7 +2747,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2740 "parser.cpp"
+#line 2751 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2745,7 +2756,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2749 "parser.cpp"
+#line 2760 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2753,7 +2764,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2757 "parser.cpp"
+#line 2768 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_search_filter_expr: /* optional_search_filter_expr  */
@@ -2761,7 +2772,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2765 "parser.cpp"
+#line 2776 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2769,7 +2780,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2773 "parser.cpp"
+#line 2784 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2777,7 +2788,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2781 "parser.cpp"
+#line 2792 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2791,7 +2802,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2795 "parser.cpp"
+#line 2806 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2800,7 +2811,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2804 "parser.cpp"
+#line 2815 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2809,7 +2820,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2813 "parser.cpp"
+#line 2824 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2818,7 +2829,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2822 "parser.cpp"
+#line 2833 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2831,7 +2842,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2835 "parser.cpp"
+#line 2846 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2840,7 +2851,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2844 "parser.cpp"
+#line 2855 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2854,7 +2865,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2858 "parser.cpp"
+#line 2869 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2868,7 +2879,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2872 "parser.cpp"
+#line 2883 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2878,7 +2889,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2882 "parser.cpp"
+#line 2893 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2887,7 +2898,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2891 "parser.cpp"
+#line 2902 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2901,7 +2912,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2905 "parser.cpp"
+#line 2916 "parser.cpp"
         break;
 
     case YYSYMBOL_insert_row_list: /* insert_row_list  */
@@ -2915,7 +2926,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).insert_row_list_t));
     }
 }
-#line 2919 "parser.cpp"
+#line 2930 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2923,7 +2934,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2927 "parser.cpp"
+#line 2938 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2931,7 +2942,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2935 "parser.cpp"
+#line 2946 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2939,7 +2950,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2943 "parser.cpp"
+#line 2954 "parser.cpp"
         break;
 
     case YYSYMBOL_match_tensor_expr: /* match_tensor_expr  */
@@ -2947,7 +2958,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2951 "parser.cpp"
+#line 2962 "parser.cpp"
         break;
 
     case YYSYMBOL_match_vector_expr: /* match_vector_expr  */
@@ -2955,7 +2966,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2959 "parser.cpp"
+#line 2970 "parser.cpp"
         break;
 
     case YYSYMBOL_match_sparse_expr: /* match_sparse_expr  */
@@ -2963,7 +2974,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2967 "parser.cpp"
+#line 2978 "parser.cpp"
         break;
 
     case YYSYMBOL_match_text_expr: /* match_text_expr  */
@@ -2971,7 +2982,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2975 "parser.cpp"
+#line 2986 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2979,7 +2990,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2983 "parser.cpp"
+#line 2994 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2987,7 +2998,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2991 "parser.cpp"
+#line 3002 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search: /* sub_search  */
@@ -2995,7 +3006,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2999 "parser.cpp"
+#line 3010 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -3009,7 +3020,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 3013 "parser.cpp"
+#line 3024 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -3017,7 +3028,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 3021 "parser.cpp"
+#line 3032 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -3025,7 +3036,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 3029 "parser.cpp"
+#line 3040 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -3033,7 +3044,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 3037 "parser.cpp"
+#line 3048 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -3041,7 +3052,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 3045 "parser.cpp"
+#line 3056 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -3049,7 +3060,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 3053 "parser.cpp"
+#line 3064 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -3062,7 +3073,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 3066 "parser.cpp"
+#line 3077 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -3070,7 +3081,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 3074 "parser.cpp"
+#line 3085 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -3078,7 +3089,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 3082 "parser.cpp"
+#line 3093 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -3086,7 +3097,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 3090 "parser.cpp"
+#line 3101 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -3094,7 +3105,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3098 "parser.cpp"
+#line 3109 "parser.cpp"
         break;
 
     case YYSYMBOL_common_array_expr: /* common_array_expr  */
@@ -3102,7 +3113,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3106 "parser.cpp"
+#line 3117 "parser.cpp"
         break;
 
     case YYSYMBOL_common_sparse_array_expr: /* common_sparse_array_expr  */
@@ -3110,7 +3121,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3114 "parser.cpp"
+#line 3125 "parser.cpp"
         break;
 
     case YYSYMBOL_subarray_array_expr: /* subarray_array_expr  */
@@ -3118,7 +3129,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3122 "parser.cpp"
+#line 3133 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_subarray_array_expr: /* unclosed_subarray_array_expr  */
@@ -3126,7 +3137,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3130 "parser.cpp"
+#line 3141 "parser.cpp"
         break;
 
     case YYSYMBOL_sparse_array_expr: /* sparse_array_expr  */
@@ -3134,7 +3145,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3138 "parser.cpp"
+#line 3149 "parser.cpp"
         break;
 
     case YYSYMBOL_long_sparse_array_expr: /* long_sparse_array_expr  */
@@ -3142,7 +3153,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3146 "parser.cpp"
+#line 3157 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_sparse_array_expr: /* unclosed_long_sparse_array_expr  */
@@ -3150,7 +3161,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3154 "parser.cpp"
+#line 3165 "parser.cpp"
         break;
 
     case YYSYMBOL_double_sparse_array_expr: /* double_sparse_array_expr  */
@@ -3158,7 +3169,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3162 "parser.cpp"
+#line 3173 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_sparse_array_expr: /* unclosed_double_sparse_array_expr  */
@@ -3166,7 +3177,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3170 "parser.cpp"
+#line 3181 "parser.cpp"
         break;
 
     case YYSYMBOL_empty_array_expr: /* empty_array_expr  */
@@ -3174,7 +3185,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3178 "parser.cpp"
+#line 3189 "parser.cpp"
         break;
 
     case YYSYMBOL_curly_brackets_expr: /* curly_brackets_expr  */
@@ -3182,7 +3193,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3186 "parser.cpp"
+#line 3197 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_curly_brackets_expr: /* unclosed_curly_brackets_expr  */
@@ -3190,7 +3201,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3194 "parser.cpp"
+#line 3205 "parser.cpp"
         break;
 
     case YYSYMBOL_int_sparse_ele: /* int_sparse_ele  */
@@ -3198,7 +3209,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).int_sparse_ele_t));
 }
-#line 3202 "parser.cpp"
+#line 3213 "parser.cpp"
         break;
 
     case YYSYMBOL_float_sparse_ele: /* float_sparse_ele  */
@@ -3206,7 +3217,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).float_sparse_ele_t));
 }
-#line 3210 "parser.cpp"
+#line 3221 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -3214,7 +3225,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3218 "parser.cpp"
+#line 3229 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -3222,7 +3233,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3226 "parser.cpp"
+#line 3237 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -3230,7 +3241,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3234 "parser.cpp"
+#line 3245 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -3238,7 +3249,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3242 "parser.cpp"
+#line 3253 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -3246,7 +3257,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3250 "parser.cpp"
+#line 3261 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -3254,7 +3265,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3258 "parser.cpp"
+#line 3269 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -3262,7 +3273,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 3266 "parser.cpp"
+#line 3277 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -3273,7 +3284,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 3277 "parser.cpp"
+#line 3288 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -3287,7 +3298,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 3291 "parser.cpp"
+#line 3302 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_table_properties_list: /* optional_table_properties_list  */
@@ -3301,7 +3312,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 3305 "parser.cpp"
+#line 3316 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info: /* index_info  */
@@ -3312,7 +3323,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_t));
     }
 }
-#line 3316 "parser.cpp"
+#line 3327 "parser.cpp"
         break;
 
       default:
@@ -3420,7 +3431,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 3424 "parser.cpp"
+#line 3435 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -3635,7 +3646,7 @@ yyreduce:
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 3639 "parser.cpp"
+#line 3650 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
@@ -3646,7 +3657,7 @@ yyreduce:
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 3650 "parser.cpp"
+#line 3661 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
@@ -3657,175 +3668,175 @@ yyreduce:
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 3661 "parser.cpp"
+#line 3672 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
 #line 536 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3667 "parser.cpp"
+#line 3678 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
 #line 537 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3673 "parser.cpp"
+#line 3684 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
 #line 538 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3679 "parser.cpp"
+#line 3690 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
 #line 539 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3685 "parser.cpp"
+#line 3696 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
 #line 540 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3691 "parser.cpp"
+#line 3702 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
 #line 541 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3697 "parser.cpp"
+#line 3708 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
 #line 542 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3703 "parser.cpp"
+#line 3714 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
 #line 543 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3709 "parser.cpp"
+#line 3720 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
 #line 544 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3715 "parser.cpp"
+#line 3726 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
 #line 545 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3721 "parser.cpp"
+#line 3732 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
 #line 546 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3727 "parser.cpp"
+#line 3738 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
 #line 547 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3733 "parser.cpp"
+#line 3744 "parser.cpp"
     break;
 
   case 17: /* statement: compact_statement  */
 #line 548 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3739 "parser.cpp"
+#line 3750 "parser.cpp"
     break;
 
   case 18: /* statement: admin_statement  */
 #line 549 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].admin_stmt); }
-#line 3745 "parser.cpp"
+#line 3756 "parser.cpp"
     break;
 
   case 19: /* statement: alter_statement  */
 #line 550 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].alter_stmt); }
-#line 3751 "parser.cpp"
+#line 3762 "parser.cpp"
     break;
 
   case 20: /* statement: check_statement  */
 #line 551 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].check_stmt); }
-#line 3757 "parser.cpp"
+#line 3768 "parser.cpp"
     break;
 
   case 21: /* explainable_statement: create_statement  */
 #line 553 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3763 "parser.cpp"
+#line 3774 "parser.cpp"
     break;
 
   case 22: /* explainable_statement: drop_statement  */
 #line 554 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3769 "parser.cpp"
+#line 3780 "parser.cpp"
     break;
 
   case 23: /* explainable_statement: copy_statement  */
 #line 555 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3775 "parser.cpp"
+#line 3786 "parser.cpp"
     break;
 
   case 24: /* explainable_statement: show_statement  */
 #line 556 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3781 "parser.cpp"
+#line 3792 "parser.cpp"
     break;
 
   case 25: /* explainable_statement: select_statement  */
 #line 557 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3787 "parser.cpp"
+#line 3798 "parser.cpp"
     break;
 
   case 26: /* explainable_statement: delete_statement  */
 #line 558 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3793 "parser.cpp"
+#line 3804 "parser.cpp"
     break;
 
   case 27: /* explainable_statement: update_statement  */
 #line 559 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3799 "parser.cpp"
+#line 3810 "parser.cpp"
     break;
 
   case 28: /* explainable_statement: insert_statement  */
 #line 560 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3805 "parser.cpp"
+#line 3816 "parser.cpp"
     break;
 
   case 29: /* explainable_statement: flush_statement  */
 #line 561 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3811 "parser.cpp"
+#line 3822 "parser.cpp"
     break;
 
   case 30: /* explainable_statement: optimize_statement  */
 #line 562 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3817 "parser.cpp"
+#line 3828 "parser.cpp"
     break;
 
   case 31: /* explainable_statement: command_statement  */
 #line 563 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3823 "parser.cpp"
+#line 3834 "parser.cpp"
     break;
 
   case 32: /* explainable_statement: compact_statement  */
 #line 564 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3829 "parser.cpp"
+#line 3840 "parser.cpp"
     break;
 
   case 33: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER COMMENT STRING  */
@@ -3847,7 +3858,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->comment_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 3851 "parser.cpp"
+#line 3862 "parser.cpp"
     break;
 
   case 34: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
@@ -3867,7 +3878,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3871 "parser.cpp"
+#line 3882 "parser.cpp"
     break;
 
   case 35: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
@@ -3885,7 +3896,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3889 "parser.cpp"
+#line 3900 "parser.cpp"
     break;
 
   case 36: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
@@ -3918,7 +3929,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-5].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3922 "parser.cpp"
+#line 3933 "parser.cpp"
     break;
 
   case 37: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
@@ -3938,7 +3949,7 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3942 "parser.cpp"
+#line 3953 "parser.cpp"
     break;
 
   case 38: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list COMMENT STRING  */
@@ -3974,7 +3985,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-7].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3978 "parser.cpp"
+#line 3989 "parser.cpp"
     break;
 
   case 39: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement COMMENT STRING  */
@@ -3996,7 +4007,7 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 4000 "parser.cpp"
+#line 4011 "parser.cpp"
     break;
 
   case 40: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
@@ -4017,7 +4028,7 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 4021 "parser.cpp"
+#line 4032 "parser.cpp"
     break;
 
   case 41: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info  */
@@ -4050,7 +4061,7 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 4054 "parser.cpp"
+#line 4065 "parser.cpp"
     break;
 
   case 42: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info COMMENT STRING  */
@@ -4085,7 +4096,7 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 4089 "parser.cpp"
+#line 4100 "parser.cpp"
     break;
 
   case 43: /* table_element_array: table_element  */
@@ -4094,7 +4105,7 @@ yyreduce:
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 4098 "parser.cpp"
+#line 4109 "parser.cpp"
     break;
 
   case 44: /* table_element_array: table_element_array ',' table_element  */
@@ -4103,7 +4114,7 @@ yyreduce:
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 4107 "parser.cpp"
+#line 4118 "parser.cpp"
     break;
 
   case 45: /* column_def_array: table_column  */
@@ -4112,7 +4123,7 @@ yyreduce:
     (yyval.column_def_array_t) = new std::vector<infinity::ColumnDef*>();
     (yyval.column_def_array_t)->push_back((yyvsp[0].table_column_t));
 }
-#line 4116 "parser.cpp"
+#line 4127 "parser.cpp"
     break;
 
   case 46: /* column_def_array: column_def_array ',' table_column  */
@@ -4121,7 +4132,7 @@ yyreduce:
     (yyvsp[-2].column_def_array_t)->push_back((yyvsp[0].table_column_t));
     (yyval.column_def_array_t) = (yyvsp[-2].column_def_array_t);
 }
-#line 4125 "parser.cpp"
+#line 4136 "parser.cpp"
     break;
 
   case 47: /* table_element: table_column  */
@@ -4129,7 +4140,7 @@ yyreduce:
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 4133 "parser.cpp"
+#line 4144 "parser.cpp"
     break;
 
   case 48: /* table_element: table_constraint  */
@@ -4137,7 +4148,7 @@ yyreduce:
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 4141 "parser.cpp"
+#line 4152 "parser.cpp"
     break;
 
   case 49: /* table_column: IDENTIFIER column_type with_index_param_list default_expr  */
@@ -4162,7 +4173,7 @@ yyreduce:
     }
     */
 }
-#line 4166 "parser.cpp"
+#line 4177 "parser.cpp"
     break;
 
   case 50: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
@@ -4189,7 +4200,7 @@ yyreduce:
     }
     */
 }
-#line 4193 "parser.cpp"
+#line 4204 "parser.cpp"
     break;
 
   case 51: /* table_column: IDENTIFIER column_type with_index_param_list default_expr COMMENT STRING  */
@@ -4218,7 +4229,7 @@ yyreduce:
     }
     */
 }
-#line 4222 "parser.cpp"
+#line 4233 "parser.cpp"
     break;
 
   case 52: /* table_column: IDENTIFIER column_type column_constraints default_expr COMMENT STRING  */
@@ -4248,7 +4259,7 @@ yyreduce:
     }
     */
 }
-#line 4252 "parser.cpp"
+#line 4263 "parser.cpp"
     break;
 
   case 53: /* column_type_array: column_type  */
@@ -4257,7 +4268,7 @@ yyreduce:
     (yyval.column_type_array_t) = new std::vector<std::unique_ptr<infinity::ColumnType>>();
     (yyval.column_type_array_t)->emplace_back((yyvsp[0].column_type_t));
 }
-#line 4261 "parser.cpp"
+#line 4272 "parser.cpp"
     break;
 
   case 54: /* column_type_array: column_type_array ',' column_type  */
@@ -4266,559 +4277,559 @@ yyreduce:
     (yyval.column_type_array_t) = (yyvsp[-2].column_type_array_t);
     (yyval.column_type_array_t)->emplace_back((yyvsp[0].column_type_t));
 }
-#line 4270 "parser.cpp"
+#line 4281 "parser.cpp"
     break;
 
   case 55: /* column_type: BOOLEAN  */
 #line 923 "parser.y"
         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4276 "parser.cpp"
+#line 4287 "parser.cpp"
     break;
 
   case 56: /* column_type: TINYINT  */
 #line 924 "parser.y"
           { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4282 "parser.cpp"
+#line 4293 "parser.cpp"
     break;
 
   case 57: /* column_type: SMALLINT  */
 #line 925 "parser.y"
            { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4288 "parser.cpp"
+#line 4299 "parser.cpp"
     break;
 
   case 58: /* column_type: INTEGER  */
 #line 926 "parser.y"
           { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4294 "parser.cpp"
+#line 4305 "parser.cpp"
     break;
 
   case 59: /* column_type: INT  */
 #line 927 "parser.y"
       { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4300 "parser.cpp"
+#line 4311 "parser.cpp"
     break;
 
   case 60: /* column_type: BIGINT  */
 #line 928 "parser.y"
          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4306 "parser.cpp"
+#line 4317 "parser.cpp"
     break;
 
   case 61: /* column_type: HUGEINT  */
 #line 929 "parser.y"
           { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4312 "parser.cpp"
+#line 4323 "parser.cpp"
     break;
 
   case 62: /* column_type: FLOAT  */
 #line 930 "parser.y"
         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4318 "parser.cpp"
+#line 4329 "parser.cpp"
     break;
 
   case 63: /* column_type: REAL  */
 #line 931 "parser.y"
         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4324 "parser.cpp"
+#line 4335 "parser.cpp"
     break;
 
   case 64: /* column_type: DOUBLE  */
 #line 932 "parser.y"
          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4330 "parser.cpp"
+#line 4341 "parser.cpp"
     break;
 
   case 65: /* column_type: FLOAT16  */
 #line 933 "parser.y"
           { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kFloat16, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4336 "parser.cpp"
+#line 4347 "parser.cpp"
     break;
 
   case 66: /* column_type: BFLOAT16  */
 #line 934 "parser.y"
            { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kBFloat16, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4342 "parser.cpp"
+#line 4353 "parser.cpp"
     break;
 
   case 67: /* column_type: DATE  */
 #line 935 "parser.y"
        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4348 "parser.cpp"
+#line 4359 "parser.cpp"
     break;
 
   case 68: /* column_type: TIME  */
 #line 936 "parser.y"
        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4354 "parser.cpp"
+#line 4365 "parser.cpp"
     break;
 
   case 69: /* column_type: DATETIME  */
 #line 937 "parser.y"
            { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4360 "parser.cpp"
+#line 4371 "parser.cpp"
     break;
 
   case 70: /* column_type: TIMESTAMP  */
 #line 938 "parser.y"
             { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4366 "parser.cpp"
+#line 4377 "parser.cpp"
     break;
 
   case 71: /* column_type: UUID  */
 #line 939 "parser.y"
        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4372 "parser.cpp"
+#line 4383 "parser.cpp"
     break;
 
   case 72: /* column_type: POINT  */
 #line 940 "parser.y"
         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4378 "parser.cpp"
+#line 4389 "parser.cpp"
     break;
 
   case 73: /* column_type: LINE  */
 #line 941 "parser.y"
        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4384 "parser.cpp"
+#line 4395 "parser.cpp"
     break;
 
   case 74: /* column_type: LSEG  */
 #line 942 "parser.y"
        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4390 "parser.cpp"
+#line 4401 "parser.cpp"
     break;
 
   case 75: /* column_type: BOX  */
 #line 943 "parser.y"
       { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4396 "parser.cpp"
+#line 4407 "parser.cpp"
     break;
 
   case 76: /* column_type: CIRCLE  */
 #line 946 "parser.y"
          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4402 "parser.cpp"
+#line 4413 "parser.cpp"
     break;
 
   case 77: /* column_type: VARCHAR  */
 #line 948 "parser.y"
           { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4408 "parser.cpp"
+#line 4419 "parser.cpp"
     break;
 
   case 78: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
 #line 949 "parser.y"
                                             { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4414 "parser.cpp"
+#line 4425 "parser.cpp"
     break;
 
   case 79: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
 #line 950 "parser.y"
                              { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4420 "parser.cpp"
+#line 4431 "parser.cpp"
     break;
 
   case 80: /* column_type: DECIMAL  */
 #line 951 "parser.y"
           { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4426 "parser.cpp"
+#line 4437 "parser.cpp"
     break;
 
   case 81: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
 #line 954 "parser.y"
                                        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4432 "parser.cpp"
+#line 4443 "parser.cpp"
     break;
 
   case 82: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
 #line 955 "parser.y"
                                            { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4438 "parser.cpp"
+#line 4449 "parser.cpp"
     break;
 
   case 83: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 956 "parser.y"
                                             { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4444 "parser.cpp"
+#line 4455 "parser.cpp"
     break;
 
   case 84: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
 #line 957 "parser.y"
                                            { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4450 "parser.cpp"
+#line 4461 "parser.cpp"
     break;
 
   case 85: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
 #line 958 "parser.y"
                                        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4456 "parser.cpp"
+#line 4467 "parser.cpp"
     break;
 
   case 86: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
 #line 959 "parser.y"
                                           { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4462 "parser.cpp"
+#line 4473 "parser.cpp"
     break;
 
   case 87: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
 #line 960 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4468 "parser.cpp"
+#line 4479 "parser.cpp"
     break;
 
   case 88: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 961 "parser.y"
                                           { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4474 "parser.cpp"
+#line 4485 "parser.cpp"
     break;
 
   case 89: /* column_type: EMBEDDING '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 962 "parser.y"
                                            { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4480 "parser.cpp"
+#line 4491 "parser.cpp"
     break;
 
   case 90: /* column_type: EMBEDDING '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 963 "parser.y"
                                             { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4486 "parser.cpp"
+#line 4497 "parser.cpp"
     break;
 
   case 91: /* column_type: EMBEDDING '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 964 "parser.y"
                                                     { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4492 "parser.cpp"
+#line 4503 "parser.cpp"
     break;
 
   case 92: /* column_type: MULTIVECTOR '(' BIT ',' LONG_VALUE ')'  */
 #line 965 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4498 "parser.cpp"
+#line 4509 "parser.cpp"
     break;
 
   case 93: /* column_type: MULTIVECTOR '(' TINYINT ',' LONG_VALUE ')'  */
 #line 966 "parser.y"
                                              { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4504 "parser.cpp"
+#line 4515 "parser.cpp"
     break;
 
   case 94: /* column_type: MULTIVECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 967 "parser.y"
                                               { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4510 "parser.cpp"
+#line 4521 "parser.cpp"
     break;
 
   case 95: /* column_type: MULTIVECTOR '(' INTEGER ',' LONG_VALUE ')'  */
 #line 968 "parser.y"
                                              { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4516 "parser.cpp"
+#line 4527 "parser.cpp"
     break;
 
   case 96: /* column_type: MULTIVECTOR '(' INT ',' LONG_VALUE ')'  */
 #line 969 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4522 "parser.cpp"
+#line 4533 "parser.cpp"
     break;
 
   case 97: /* column_type: MULTIVECTOR '(' BIGINT ',' LONG_VALUE ')'  */
 #line 970 "parser.y"
                                             { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4528 "parser.cpp"
+#line 4539 "parser.cpp"
     break;
 
   case 98: /* column_type: MULTIVECTOR '(' FLOAT ',' LONG_VALUE ')'  */
 #line 971 "parser.y"
                                            { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4534 "parser.cpp"
+#line 4545 "parser.cpp"
     break;
 
   case 99: /* column_type: MULTIVECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 972 "parser.y"
                                             { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4540 "parser.cpp"
+#line 4551 "parser.cpp"
     break;
 
   case 100: /* column_type: MULTIVECTOR '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 973 "parser.y"
                                              { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4546 "parser.cpp"
+#line 4557 "parser.cpp"
     break;
 
   case 101: /* column_type: MULTIVECTOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 974 "parser.y"
                                               { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4552 "parser.cpp"
+#line 4563 "parser.cpp"
     break;
 
   case 102: /* column_type: MULTIVECTOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 975 "parser.y"
                                                       { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4558 "parser.cpp"
+#line 4569 "parser.cpp"
     break;
 
   case 103: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
 #line 976 "parser.y"
                                     { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4564 "parser.cpp"
+#line 4575 "parser.cpp"
     break;
 
   case 104: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
 #line 977 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4570 "parser.cpp"
+#line 4581 "parser.cpp"
     break;
 
   case 105: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 978 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4576 "parser.cpp"
+#line 4587 "parser.cpp"
     break;
 
   case 106: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
 #line 979 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4582 "parser.cpp"
+#line 4593 "parser.cpp"
     break;
 
   case 107: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
 #line 980 "parser.y"
                                     { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4588 "parser.cpp"
+#line 4599 "parser.cpp"
     break;
 
   case 108: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
 #line 981 "parser.y"
                                        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4594 "parser.cpp"
+#line 4605 "parser.cpp"
     break;
 
   case 109: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
 #line 982 "parser.y"
                                       { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4600 "parser.cpp"
+#line 4611 "parser.cpp"
     break;
 
   case 110: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 983 "parser.y"
                                        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4606 "parser.cpp"
+#line 4617 "parser.cpp"
     break;
 
   case 111: /* column_type: TENSOR '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 984 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4612 "parser.cpp"
+#line 4623 "parser.cpp"
     break;
 
   case 112: /* column_type: TENSOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 985 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4618 "parser.cpp"
+#line 4629 "parser.cpp"
     break;
 
   case 113: /* column_type: TENSOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 986 "parser.y"
                                                  { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4624 "parser.cpp"
+#line 4635 "parser.cpp"
     break;
 
   case 114: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
 #line 987 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4630 "parser.cpp"
+#line 4641 "parser.cpp"
     break;
 
   case 115: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
 #line 988 "parser.y"
                                              { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4636 "parser.cpp"
+#line 4647 "parser.cpp"
     break;
 
   case 116: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 989 "parser.y"
                                               { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4642 "parser.cpp"
+#line 4653 "parser.cpp"
     break;
 
   case 117: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
 #line 990 "parser.y"
                                              { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4648 "parser.cpp"
+#line 4659 "parser.cpp"
     break;
 
   case 118: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
 #line 991 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4654 "parser.cpp"
+#line 4665 "parser.cpp"
     break;
 
   case 119: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
 #line 992 "parser.y"
                                             { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4660 "parser.cpp"
+#line 4671 "parser.cpp"
     break;
 
   case 120: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
 #line 993 "parser.y"
                                            { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4666 "parser.cpp"
+#line 4677 "parser.cpp"
     break;
 
   case 121: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 994 "parser.y"
                                             { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4672 "parser.cpp"
+#line 4683 "parser.cpp"
     break;
 
   case 122: /* column_type: TENSORARRAY '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 995 "parser.y"
                                              { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4678 "parser.cpp"
+#line 4689 "parser.cpp"
     break;
 
   case 123: /* column_type: TENSORARRAY '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 996 "parser.y"
                                               { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4684 "parser.cpp"
+#line 4695 "parser.cpp"
     break;
 
   case 124: /* column_type: TENSORARRAY '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 997 "parser.y"
                                                       { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4690 "parser.cpp"
+#line 4701 "parser.cpp"
     break;
 
   case 125: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
 #line 998 "parser.y"
                                     { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4696 "parser.cpp"
+#line 4707 "parser.cpp"
     break;
 
   case 126: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
 #line 999 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4702 "parser.cpp"
+#line 4713 "parser.cpp"
     break;
 
   case 127: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 1000 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4708 "parser.cpp"
+#line 4719 "parser.cpp"
     break;
 
   case 128: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
 #line 1001 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4714 "parser.cpp"
+#line 4725 "parser.cpp"
     break;
 
   case 129: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
 #line 1002 "parser.y"
                                     { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4720 "parser.cpp"
+#line 4731 "parser.cpp"
     break;
 
   case 130: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
 #line 1003 "parser.y"
                                        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4726 "parser.cpp"
+#line 4737 "parser.cpp"
     break;
 
   case 131: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
 #line 1004 "parser.y"
                                       { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4732 "parser.cpp"
+#line 4743 "parser.cpp"
     break;
 
   case 132: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 1005 "parser.y"
                                        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4738 "parser.cpp"
+#line 4749 "parser.cpp"
     break;
 
   case 133: /* column_type: VECTOR '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 1006 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4744 "parser.cpp"
+#line 4755 "parser.cpp"
     break;
 
   case 134: /* column_type: VECTOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 1007 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4750 "parser.cpp"
+#line 4761 "parser.cpp"
     break;
 
   case 135: /* column_type: VECTOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 1008 "parser.y"
                                                  { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4756 "parser.cpp"
+#line 4767 "parser.cpp"
     break;
 
   case 136: /* column_type: SPARSE '(' BIT ',' LONG_VALUE ')'  */
 #line 1009 "parser.y"
                                     { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4762 "parser.cpp"
+#line 4773 "parser.cpp"
     break;
 
   case 137: /* column_type: SPARSE '(' TINYINT ',' LONG_VALUE ')'  */
 #line 1010 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4768 "parser.cpp"
+#line 4779 "parser.cpp"
     break;
 
   case 138: /* column_type: SPARSE '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 1011 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4774 "parser.cpp"
+#line 4785 "parser.cpp"
     break;
 
   case 139: /* column_type: SPARSE '(' INTEGER ',' LONG_VALUE ')'  */
 #line 1012 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4780 "parser.cpp"
+#line 4791 "parser.cpp"
     break;
 
   case 140: /* column_type: SPARSE '(' INT ',' LONG_VALUE ')'  */
 #line 1013 "parser.y"
                                     { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4786 "parser.cpp"
+#line 4797 "parser.cpp"
     break;
 
   case 141: /* column_type: SPARSE '(' BIGINT ',' LONG_VALUE ')'  */
 #line 1014 "parser.y"
                                        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4792 "parser.cpp"
+#line 4803 "parser.cpp"
     break;
 
   case 142: /* column_type: SPARSE '(' FLOAT ',' LONG_VALUE ')'  */
 #line 1015 "parser.y"
                                       { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4798 "parser.cpp"
+#line 4809 "parser.cpp"
     break;
 
   case 143: /* column_type: SPARSE '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 1016 "parser.y"
                                        { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4804 "parser.cpp"
+#line 4815 "parser.cpp"
     break;
 
   case 144: /* column_type: SPARSE '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 1017 "parser.y"
                                         { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4810 "parser.cpp"
+#line 4821 "parser.cpp"
     break;
 
   case 145: /* column_type: SPARSE '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 1018 "parser.y"
                                          { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4816 "parser.cpp"
+#line 4827 "parser.cpp"
     break;
 
   case 146: /* column_type: SPARSE '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 1019 "parser.y"
                                                  { (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4822 "parser.cpp"
+#line 4833 "parser.cpp"
     break;
 
   case 147: /* column_type: ARRAY '(' column_type ')'  */
@@ -4827,7 +4838,7 @@ yyreduce:
   (yyval.column_type_t) = new infinity::ColumnType{infinity::LogicalType::kArray, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid};
   (yyval.column_type_t)->element_types_.emplace_back((yyvsp[-1].column_type_t));
 }
-#line 4831 "parser.cpp"
+#line 4842 "parser.cpp"
     break;
 
   case 148: /* column_type: TUPLE '(' column_type_array ')'  */
@@ -4837,7 +4848,7 @@ yyreduce:
   (yyval.column_type_t)->element_types_ = std::move(*((yyvsp[-1].column_type_array_t)));
   delete (yyvsp[-1].column_type_array_t);
 }
-#line 4841 "parser.cpp"
+#line 4852 "parser.cpp"
     break;
 
   case 149: /* column_constraints: column_constraint  */
@@ -4846,7 +4857,7 @@ yyreduce:
     (yyval.column_constraints_t) = new std::set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 4850 "parser.cpp"
+#line 4861 "parser.cpp"
     break;
 
   case 150: /* column_constraints: column_constraints column_constraint  */
@@ -4860,7 +4871,7 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 4864 "parser.cpp"
+#line 4875 "parser.cpp"
     break;
 
   case 151: /* column_constraint: PRIMARY KEY  */
@@ -4868,7 +4879,7 @@ yyreduce:
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4872 "parser.cpp"
+#line 4883 "parser.cpp"
     break;
 
   case 152: /* column_constraint: UNIQUE  */
@@ -4876,7 +4887,7 @@ yyreduce:
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 4880 "parser.cpp"
+#line 4891 "parser.cpp"
     break;
 
   case 153: /* column_constraint: NULLABLE  */
@@ -4884,7 +4895,7 @@ yyreduce:
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 4888 "parser.cpp"
+#line 4899 "parser.cpp"
     break;
 
   case 154: /* column_constraint: NOT NULLABLE  */
@@ -4892,7 +4903,7 @@ yyreduce:
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 4896 "parser.cpp"
+#line 4907 "parser.cpp"
     break;
 
   case 155: /* default_expr: DEFAULT constant_expr  */
@@ -4900,7 +4911,7 @@ yyreduce:
                                      {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 4904 "parser.cpp"
+#line 4915 "parser.cpp"
     break;
 
   case 156: /* default_expr: %empty  */
@@ -4908,7 +4919,7 @@ yyreduce:
                             {
     (yyval.const_expr_t) = nullptr;
 }
-#line 4912 "parser.cpp"
+#line 4923 "parser.cpp"
     break;
 
   case 157: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
@@ -4918,7 +4929,7 @@ yyreduce:
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4922 "parser.cpp"
+#line 4933 "parser.cpp"
     break;
 
   case 158: /* table_constraint: UNIQUE '(' identifier_array ')'  */
@@ -4928,7 +4939,7 @@ yyreduce:
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 4932 "parser.cpp"
+#line 4943 "parser.cpp"
     break;
 
   case 159: /* identifier_array: IDENTIFIER  */
@@ -4939,7 +4950,7 @@ yyreduce:
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4943 "parser.cpp"
+#line 4954 "parser.cpp"
     break;
 
   case 160: /* identifier_array: identifier_array ',' IDENTIFIER  */
@@ -4950,7 +4961,7 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 4954 "parser.cpp"
+#line 4965 "parser.cpp"
     break;
 
   case 161: /* delete_statement: DELETE FROM table_name where_clause  */
@@ -4967,7 +4978,7 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 4971 "parser.cpp"
+#line 4982 "parser.cpp"
     break;
 
   case 162: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES insert_row_list  */
@@ -5010,7 +5021,7 @@ yyreduce:
     delete (yyvsp[-2].identifier_array_t);
     delete (yyvsp[0].insert_row_list_t);
 }
-#line 5014 "parser.cpp"
+#line 5025 "parser.cpp"
     break;
 
   case 163: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
@@ -5030,7 +5041,7 @@ yyreduce:
     }
     (yyval.insert_stmt)->select_.reset((yyvsp[0].select_stmt));
 }
-#line 5034 "parser.cpp"
+#line 5045 "parser.cpp"
     break;
 
   case 164: /* optional_identifier_array: '(' identifier_array ')'  */
@@ -5038,7 +5049,7 @@ yyreduce:
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 5042 "parser.cpp"
+#line 5053 "parser.cpp"
     break;
 
   case 165: /* optional_identifier_array: %empty  */
@@ -5046,7 +5057,7 @@ yyreduce:
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 5050 "parser.cpp"
+#line 5061 "parser.cpp"
     break;
 
   case 166: /* explain_statement: EXPLAIN IDENTIFIER explainable_statement  */
@@ -5069,7 +5080,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 5073 "parser.cpp"
+#line 5084 "parser.cpp"
     break;
 
   case 167: /* explain_statement: EXPLAIN explainable_statement  */
@@ -5079,7 +5090,7 @@ yyreduce:
     (yyval.explain_stmt)->type_ =infinity::ExplainType::kPhysical;
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 5083 "parser.cpp"
+#line 5094 "parser.cpp"
     break;
 
   case 168: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
@@ -5096,7 +5107,7 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 5100 "parser.cpp"
+#line 5111 "parser.cpp"
     break;
 
   case 169: /* update_expr_array: update_expr  */
@@ -5105,7 +5116,7 @@ yyreduce:
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 5109 "parser.cpp"
+#line 5120 "parser.cpp"
     break;
 
   case 170: /* update_expr_array: update_expr_array ',' update_expr  */
@@ -5114,7 +5125,7 @@ yyreduce:
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 5118 "parser.cpp"
+#line 5129 "parser.cpp"
     break;
 
   case 171: /* update_expr: IDENTIFIER '=' expr  */
@@ -5126,7 +5137,7 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 5130 "parser.cpp"
+#line 5141 "parser.cpp"
     break;
 
   case 172: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
@@ -5142,7 +5153,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 5146 "parser.cpp"
+#line 5157 "parser.cpp"
     break;
 
   case 173: /* drop_statement: DROP COLLECTION if_exists table_name  */
@@ -5160,7 +5171,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 5164 "parser.cpp"
+#line 5175 "parser.cpp"
     break;
 
   case 174: /* drop_statement: DROP TABLE if_exists table_name  */
@@ -5178,7 +5189,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 5182 "parser.cpp"
+#line 5193 "parser.cpp"
     break;
 
   case 175: /* drop_statement: DROP VIEW if_exists table_name  */
@@ -5196,7 +5207,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 5200 "parser.cpp"
+#line 5211 "parser.cpp"
     break;
 
   case 176: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
@@ -5219,7 +5230,7 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5223 "parser.cpp"
+#line 5234 "parser.cpp"
     break;
 
   case 177: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
@@ -5277,7 +5288,7 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 5281 "parser.cpp"
+#line 5292 "parser.cpp"
     break;
 
   case 178: /* copy_statement: COPY table_name '(' expr_array ')' TO file_path WITH '(' copy_option_list ')'  */
@@ -5337,7 +5348,7 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 5341 "parser.cpp"
+#line 5352 "parser.cpp"
     break;
 
   case 179: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
@@ -5389,7 +5400,7 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 5393 "parser.cpp"
+#line 5404 "parser.cpp"
     break;
 
   case 180: /* select_statement: select_without_paren  */
@@ -5397,7 +5408,7 @@ yyreduce:
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 5401 "parser.cpp"
+#line 5412 "parser.cpp"
     break;
 
   case 181: /* select_statement: select_with_paren  */
@@ -5405,7 +5416,7 @@ yyreduce:
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 5409 "parser.cpp"
+#line 5420 "parser.cpp"
     break;
 
   case 182: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
@@ -5419,7 +5430,7 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 5423 "parser.cpp"
+#line 5434 "parser.cpp"
     break;
 
   case 183: /* select_statement: select_statement set_operator select_clause_without_modifier  */
@@ -5433,7 +5444,7 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 5437 "parser.cpp"
+#line 5448 "parser.cpp"
     break;
 
   case 184: /* select_with_paren: '(' select_without_paren ')'  */
@@ -5441,7 +5452,7 @@ yyreduce:
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5445 "parser.cpp"
+#line 5456 "parser.cpp"
     break;
 
   case 185: /* select_with_paren: '(' select_with_paren ')'  */
@@ -5449,7 +5460,7 @@ yyreduce:
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5453 "parser.cpp"
+#line 5464 "parser.cpp"
     break;
 
   case 186: /* select_without_paren: with_clause select_clause_with_modifier  */
@@ -5458,7 +5469,7 @@ yyreduce:
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 5462 "parser.cpp"
+#line 5473 "parser.cpp"
     break;
 
   case 187: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
@@ -5489,7 +5500,7 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 5493 "parser.cpp"
+#line 5504 "parser.cpp"
     break;
 
   case 188: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
@@ -5497,7 +5508,7 @@ yyreduce:
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5501 "parser.cpp"
+#line 5512 "parser.cpp"
     break;
 
   case 189: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
@@ -5505,7 +5516,7 @@ yyreduce:
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5509 "parser.cpp"
+#line 5520 "parser.cpp"
     break;
 
   case 190: /* select_clause_without_modifier: SELECT distinct expr_array highlight_clause from_clause search_clause where_clause group_by_clause having_clause  */
@@ -5526,7 +5537,7 @@ yyreduce:
         YYERROR;
     }
 }
-#line 5530 "parser.cpp"
+#line 5541 "parser.cpp"
     break;
 
   case 191: /* order_by_clause: ORDER BY order_by_expr_list  */
@@ -5534,7 +5545,7 @@ yyreduce:
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 5538 "parser.cpp"
+#line 5549 "parser.cpp"
     break;
 
   case 192: /* order_by_clause: %empty  */
@@ -5542,7 +5553,7 @@ yyreduce:
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 5546 "parser.cpp"
+#line 5557 "parser.cpp"
     break;
 
   case 193: /* order_by_expr_list: order_by_expr  */
@@ -5551,7 +5562,7 @@ yyreduce:
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 5555 "parser.cpp"
+#line 5566 "parser.cpp"
     break;
 
   case 194: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
@@ -5560,7 +5571,7 @@ yyreduce:
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 5564 "parser.cpp"
+#line 5575 "parser.cpp"
     break;
 
   case 195: /* order_by_expr: expr order_by_type  */
@@ -5570,7 +5581,7 @@ yyreduce:
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 5574 "parser.cpp"
+#line 5585 "parser.cpp"
     break;
 
   case 196: /* order_by_type: ASC  */
@@ -5578,7 +5589,7 @@ yyreduce:
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 5582 "parser.cpp"
+#line 5593 "parser.cpp"
     break;
 
   case 197: /* order_by_type: DESC  */
@@ -5586,7 +5597,7 @@ yyreduce:
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 5590 "parser.cpp"
+#line 5601 "parser.cpp"
     break;
 
   case 198: /* order_by_type: %empty  */
@@ -5594,7 +5605,7 @@ yyreduce:
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 5598 "parser.cpp"
+#line 5609 "parser.cpp"
     break;
 
   case 199: /* limit_expr: LIMIT expr  */
@@ -5602,13 +5613,13 @@ yyreduce:
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5606 "parser.cpp"
+#line 5617 "parser.cpp"
     break;
 
   case 200: /* limit_expr: %empty  */
 #line 1616 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 5612 "parser.cpp"
+#line 5623 "parser.cpp"
     break;
 
   case 201: /* offset_expr: OFFSET expr  */
@@ -5616,13 +5627,13 @@ yyreduce:
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5620 "parser.cpp"
+#line 5631 "parser.cpp"
     break;
 
   case 202: /* offset_expr: %empty  */
 #line 1622 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 5626 "parser.cpp"
+#line 5637 "parser.cpp"
     break;
 
   case 203: /* distinct: DISTINCT  */
@@ -5630,7 +5641,7 @@ yyreduce:
                     {
     (yyval.bool_value) = true;
 }
-#line 5634 "parser.cpp"
+#line 5645 "parser.cpp"
     break;
 
   case 204: /* distinct: %empty  */
@@ -5638,7 +5649,7 @@ yyreduce:
   {
     (yyval.bool_value) = false;
 }
-#line 5642 "parser.cpp"
+#line 5653 "parser.cpp"
     break;
 
   case 205: /* highlight_clause: HIGHLIGHT expr_array  */
@@ -5646,7 +5657,7 @@ yyreduce:
                                        {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 5650 "parser.cpp"
+#line 5661 "parser.cpp"
     break;
 
   case 206: /* highlight_clause: %empty  */
@@ -5654,7 +5665,7 @@ yyreduce:
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 5658 "parser.cpp"
+#line 5669 "parser.cpp"
     break;
 
   case 207: /* from_clause: FROM table_reference  */
@@ -5662,7 +5673,7 @@ yyreduce:
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 5666 "parser.cpp"
+#line 5677 "parser.cpp"
     break;
 
   case 208: /* from_clause: %empty  */
@@ -5670,7 +5681,7 @@ yyreduce:
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 5674 "parser.cpp"
+#line 5685 "parser.cpp"
     break;
 
   case 209: /* search_clause: SEARCH sub_search_array  */
@@ -5680,7 +5691,7 @@ yyreduce:
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 5684 "parser.cpp"
+#line 5695 "parser.cpp"
     break;
 
   case 210: /* search_clause: %empty  */
@@ -5688,7 +5699,7 @@ yyreduce:
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 5692 "parser.cpp"
+#line 5703 "parser.cpp"
     break;
 
   case 211: /* optional_search_filter_expr: ',' WHERE expr  */
@@ -5696,7 +5707,7 @@ yyreduce:
                                             {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5700 "parser.cpp"
+#line 5711 "parser.cpp"
     break;
 
   case 212: /* optional_search_filter_expr: %empty  */
@@ -5704,7 +5715,7 @@ yyreduce:
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 5708 "parser.cpp"
+#line 5719 "parser.cpp"
     break;
 
   case 213: /* where_clause: WHERE expr  */
@@ -5712,7 +5723,7 @@ yyreduce:
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5716 "parser.cpp"
+#line 5727 "parser.cpp"
     break;
 
   case 214: /* where_clause: %empty  */
@@ -5720,7 +5731,7 @@ yyreduce:
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 5724 "parser.cpp"
+#line 5735 "parser.cpp"
     break;
 
   case 215: /* having_clause: HAVING expr  */
@@ -5728,7 +5739,7 @@ yyreduce:
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5732 "parser.cpp"
+#line 5743 "parser.cpp"
     break;
 
   case 216: /* having_clause: %empty  */
@@ -5736,7 +5747,7 @@ yyreduce:
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 5740 "parser.cpp"
+#line 5751 "parser.cpp"
     break;
 
   case 217: /* group_by_clause: GROUP BY expr_array  */
@@ -5744,7 +5755,7 @@ yyreduce:
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 5748 "parser.cpp"
+#line 5759 "parser.cpp"
     break;
 
   case 218: /* group_by_clause: %empty  */
@@ -5752,7 +5763,7 @@ yyreduce:
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 5756 "parser.cpp"
+#line 5767 "parser.cpp"
     break;
 
   case 219: /* set_operator: UNION  */
@@ -5760,7 +5771,7 @@ yyreduce:
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 5764 "parser.cpp"
+#line 5775 "parser.cpp"
     break;
 
   case 220: /* set_operator: UNION ALL  */
@@ -5768,7 +5779,7 @@ yyreduce:
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 5772 "parser.cpp"
+#line 5783 "parser.cpp"
     break;
 
   case 221: /* set_operator: INTERSECT  */
@@ -5776,7 +5787,7 @@ yyreduce:
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 5780 "parser.cpp"
+#line 5791 "parser.cpp"
     break;
 
   case 222: /* set_operator: EXCEPT  */
@@ -5784,7 +5795,7 @@ yyreduce:
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 5788 "parser.cpp"
+#line 5799 "parser.cpp"
     break;
 
   case 223: /* table_reference: table_reference_unit  */
@@ -5792,7 +5803,7 @@ yyreduce:
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 5796 "parser.cpp"
+#line 5807 "parser.cpp"
     break;
 
   case 224: /* table_reference: table_reference ',' table_reference_unit  */
@@ -5810,7 +5821,7 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 5814 "parser.cpp"
+#line 5825 "parser.cpp"
     break;
 
   case 227: /* table_reference_name: table_name table_alias  */
@@ -5828,7 +5839,7 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 5832 "parser.cpp"
+#line 5843 "parser.cpp"
     break;
 
   case 228: /* table_reference_name: '(' select_statement ')' table_alias  */
@@ -5839,7 +5850,7 @@ yyreduce:
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 5843 "parser.cpp"
+#line 5854 "parser.cpp"
     break;
 
   case 229: /* table_name: IDENTIFIER  */
@@ -5849,7 +5860,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5853 "parser.cpp"
+#line 5864 "parser.cpp"
     break;
 
   case 230: /* table_name: IDENTIFIER '.' IDENTIFIER  */
@@ -5861,7 +5872,7 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5865 "parser.cpp"
+#line 5876 "parser.cpp"
     break;
 
   case 231: /* table_alias: AS IDENTIFIER  */
@@ -5871,7 +5882,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5875 "parser.cpp"
+#line 5886 "parser.cpp"
     break;
 
   case 232: /* table_alias: IDENTIFIER  */
@@ -5881,7 +5892,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5885 "parser.cpp"
+#line 5896 "parser.cpp"
     break;
 
   case 233: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
@@ -5892,7 +5903,7 @@ yyreduce:
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 5896 "parser.cpp"
+#line 5907 "parser.cpp"
     break;
 
   case 234: /* table_alias: %empty  */
@@ -5900,7 +5911,7 @@ yyreduce:
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 5904 "parser.cpp"
+#line 5915 "parser.cpp"
     break;
 
   case 235: /* with_clause: WITH with_expr_list  */
@@ -5908,7 +5919,7 @@ yyreduce:
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 5912 "parser.cpp"
+#line 5923 "parser.cpp"
     break;
 
   case 236: /* with_clause: %empty  */
@@ -5916,7 +5927,7 @@ yyreduce:
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 5920 "parser.cpp"
+#line 5931 "parser.cpp"
     break;
 
   case 237: /* with_expr_list: with_expr  */
@@ -5925,7 +5936,7 @@ yyreduce:
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 5929 "parser.cpp"
+#line 5940 "parser.cpp"
     break;
 
   case 238: /* with_expr_list: with_expr_list ',' with_expr  */
@@ -5934,7 +5945,7 @@ yyreduce:
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 5938 "parser.cpp"
+#line 5949 "parser.cpp"
     break;
 
   case 239: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
@@ -5946,7 +5957,7 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 5950 "parser.cpp"
+#line 5961 "parser.cpp"
     break;
 
   case 240: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
@@ -5958,7 +5969,7 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 5962 "parser.cpp"
+#line 5973 "parser.cpp"
     break;
 
   case 241: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
@@ -5971,7 +5982,7 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 5975 "parser.cpp"
+#line 5986 "parser.cpp"
     break;
 
   case 242: /* join_type: INNER  */
@@ -5979,7 +5990,7 @@ yyreduce:
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 5983 "parser.cpp"
+#line 5994 "parser.cpp"
     break;
 
   case 243: /* join_type: LEFT  */
@@ -5987,7 +5998,7 @@ yyreduce:
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 5991 "parser.cpp"
+#line 6002 "parser.cpp"
     break;
 
   case 244: /* join_type: RIGHT  */
@@ -5995,7 +6006,7 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 5999 "parser.cpp"
+#line 6010 "parser.cpp"
     break;
 
   case 245: /* join_type: OUTER  */
@@ -6003,7 +6014,7 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 6007 "parser.cpp"
+#line 6018 "parser.cpp"
     break;
 
   case 246: /* join_type: FULL  */
@@ -6011,7 +6022,7 @@ yyreduce:
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 6015 "parser.cpp"
+#line 6026 "parser.cpp"
     break;
 
   case 247: /* join_type: CROSS  */
@@ -6019,14 +6030,14 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 6023 "parser.cpp"
+#line 6034 "parser.cpp"
     break;
 
   case 248: /* join_type: %empty  */
 #line 1845 "parser.y"
                 {
 }
-#line 6030 "parser.cpp"
+#line 6041 "parser.cpp"
     break;
 
   case 249: /* show_statement: SHOW DATABASES  */
@@ -6035,7 +6046,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 6039 "parser.cpp"
+#line 6050 "parser.cpp"
     break;
 
   case 250: /* show_statement: SHOW TABLES  */
@@ -6044,7 +6055,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 6048 "parser.cpp"
+#line 6059 "parser.cpp"
     break;
 
   case 251: /* show_statement: SHOW TASKS  */
@@ -6053,7 +6064,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTasks;
 }
-#line 6057 "parser.cpp"
+#line 6068 "parser.cpp"
     break;
 
   case 252: /* show_statement: SHOW CONFIGS  */
@@ -6062,7 +6073,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 6066 "parser.cpp"
+#line 6077 "parser.cpp"
     break;
 
   case 253: /* show_statement: SHOW CONFIG IDENTIFIER  */
@@ -6074,7 +6085,7 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6078 "parser.cpp"
+#line 6089 "parser.cpp"
     break;
 
   case 254: /* show_statement: SHOW PROFILES  */
@@ -6083,7 +6094,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 6087 "parser.cpp"
+#line 6098 "parser.cpp"
     break;
 
   case 255: /* show_statement: SHOW BUFFER  */
@@ -6092,7 +6103,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBuffer;
 }
-#line 6096 "parser.cpp"
+#line 6107 "parser.cpp"
     break;
 
   case 256: /* show_statement: SHOW MEMINDEX  */
@@ -6101,7 +6112,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemIndex;
 }
-#line 6105 "parser.cpp"
+#line 6116 "parser.cpp"
     break;
 
   case 257: /* show_statement: SHOW QUERIES  */
@@ -6110,7 +6121,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQueries;
 }
-#line 6114 "parser.cpp"
+#line 6125 "parser.cpp"
     break;
 
   case 258: /* show_statement: SHOW QUERY LONG_VALUE  */
@@ -6120,7 +6131,7 @@ yyreduce:
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQuery;
     (yyval.show_stmt)->session_id_ = (yyvsp[0].long_value);
 }
-#line 6124 "parser.cpp"
+#line 6135 "parser.cpp"
     break;
 
   case 259: /* show_statement: SHOW TRANSACTIONS  */
@@ -6129,7 +6140,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransactions;
 }
-#line 6133 "parser.cpp"
+#line 6144 "parser.cpp"
     break;
 
   case 260: /* show_statement: SHOW TRANSACTION LONG_VALUE  */
@@ -6139,7 +6150,7 @@ yyreduce:
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransaction;
     (yyval.show_stmt)->txn_id_ = (yyvsp[0].long_value);
 }
-#line 6143 "parser.cpp"
+#line 6154 "parser.cpp"
     break;
 
   case 261: /* show_statement: SHOW TRANSACTION HISTORY  */
@@ -6148,7 +6159,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransactionHistory;
 }
-#line 6152 "parser.cpp"
+#line 6163 "parser.cpp"
     break;
 
   case 262: /* show_statement: SHOW SESSION VARIABLES  */
@@ -6157,7 +6168,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariables;
 }
-#line 6161 "parser.cpp"
+#line 6172 "parser.cpp"
     break;
 
   case 263: /* show_statement: SHOW GLOBAL VARIABLES  */
@@ -6166,7 +6177,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariables;
 }
-#line 6170 "parser.cpp"
+#line 6181 "parser.cpp"
     break;
 
   case 264: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
@@ -6177,7 +6188,7 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6181 "parser.cpp"
+#line 6192 "parser.cpp"
     break;
 
   case 265: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
@@ -6188,7 +6199,7 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6192 "parser.cpp"
+#line 6203 "parser.cpp"
     break;
 
   case 266: /* show_statement: SHOW DATABASE IDENTIFIER  */
@@ -6199,7 +6210,7 @@ yyreduce:
     (yyval.show_stmt)->schema_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6203 "parser.cpp"
+#line 6214 "parser.cpp"
     break;
 
   case 267: /* show_statement: SHOW TABLE table_name  */
@@ -6215,7 +6226,7 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 6219 "parser.cpp"
+#line 6230 "parser.cpp"
     break;
 
   case 268: /* show_statement: SHOW TABLE table_name COLUMNS  */
@@ -6231,7 +6242,7 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 6235 "parser.cpp"
+#line 6246 "parser.cpp"
     break;
 
   case 269: /* show_statement: SHOW TABLE table_name SEGMENTS  */
@@ -6247,7 +6258,7 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 6251 "parser.cpp"
+#line 6262 "parser.cpp"
     break;
 
   case 270: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
@@ -6264,7 +6275,7 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 6268 "parser.cpp"
+#line 6279 "parser.cpp"
     break;
 
   case 271: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
@@ -6281,7 +6292,7 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[-1].long_value);
     delete (yyvsp[-3].table_name_t);
 }
-#line 6285 "parser.cpp"
+#line 6296 "parser.cpp"
     break;
 
   case 272: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
@@ -6299,7 +6310,7 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 6303 "parser.cpp"
+#line 6314 "parser.cpp"
     break;
 
   case 273: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
@@ -6318,7 +6329,7 @@ yyreduce:
     (yyval.show_stmt)->column_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-6].table_name_t);
 }
-#line 6322 "parser.cpp"
+#line 6333 "parser.cpp"
     break;
 
   case 274: /* show_statement: SHOW TABLE table_name INDEXES  */
@@ -6334,7 +6345,7 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 6338 "parser.cpp"
+#line 6349 "parser.cpp"
     break;
 
   case 275: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
@@ -6353,7 +6364,7 @@ yyreduce:
     (yyval.show_stmt)->index_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6357 "parser.cpp"
+#line 6368 "parser.cpp"
     break;
 
   case 276: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE  */
@@ -6374,7 +6385,7 @@ yyreduce:
 
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
 }
-#line 6378 "parser.cpp"
+#line 6389 "parser.cpp"
     break;
 
   case 277: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE CHUNK LONG_VALUE  */
@@ -6396,7 +6407,7 @@ yyreduce:
       (yyval.show_stmt)->segment_id_ = (yyvsp[-2].long_value);
       (yyval.show_stmt)->chunk_id_ = (yyvsp[0].long_value);
 }
-#line 6400 "parser.cpp"
+#line 6411 "parser.cpp"
     break;
 
   case 278: /* show_statement: SHOW LOGS  */
@@ -6405,7 +6416,7 @@ yyreduce:
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kLogs;
 }
-#line 6409 "parser.cpp"
+#line 6420 "parser.cpp"
     break;
 
   case 279: /* show_statement: SHOW CATALOG  */
@@ -6414,7 +6425,7 @@ yyreduce:
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kCatalog;
 }
-#line 6418 "parser.cpp"
+#line 6429 "parser.cpp"
     break;
 
   case 280: /* show_statement: SHOW CATALOG TO file_path  */
@@ -6425,7 +6436,7 @@ yyreduce:
       (yyval.show_stmt)->file_path_ = (yyvsp[0].str_value);
       free((yyvsp[0].str_value));
 }
-#line 6429 "parser.cpp"
+#line 6440 "parser.cpp"
     break;
 
   case 281: /* show_statement: SHOW PERSISTENCE FILES  */
@@ -6434,7 +6445,7 @@ yyreduce:
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kPersistenceFiles;
 }
-#line 6438 "parser.cpp"
+#line 6449 "parser.cpp"
     break;
 
   case 282: /* show_statement: SHOW PERSISTENCE OBJECTS  */
@@ -6443,7 +6454,7 @@ yyreduce:
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kPersistenceObjects;
 }
-#line 6447 "parser.cpp"
+#line 6458 "parser.cpp"
     break;
 
   case 283: /* show_statement: SHOW PERSISTENCE OBJECT STRING  */
@@ -6454,7 +6465,7 @@ yyreduce:
       (yyval.show_stmt)->file_name_ = (yyvsp[0].str_value);
       free((yyvsp[0].str_value));
 }
-#line 6458 "parser.cpp"
+#line 6469 "parser.cpp"
     break;
 
   case 284: /* show_statement: SHOW MEMORY  */
@@ -6463,7 +6474,7 @@ yyreduce:
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemory;
 }
-#line 6467 "parser.cpp"
+#line 6478 "parser.cpp"
     break;
 
   case 285: /* show_statement: SHOW MEMORY OBJECTS  */
@@ -6472,7 +6483,7 @@ yyreduce:
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemoryObjects;
 }
-#line 6476 "parser.cpp"
+#line 6487 "parser.cpp"
     break;
 
   case 286: /* show_statement: SHOW MEMORY ALLOCATION  */
@@ -6481,7 +6492,7 @@ yyreduce:
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemoryAllocation;
 }
-#line 6485 "parser.cpp"
+#line 6496 "parser.cpp"
     break;
 
   case 287: /* show_statement: SHOW IDENTIFIER '(' ')'  */
@@ -6492,7 +6503,7 @@ yyreduce:
       (yyval.show_stmt)->function_name_ = (yyvsp[-2].str_value);
       free((yyvsp[-2].str_value));
 }
-#line 6496 "parser.cpp"
+#line 6507 "parser.cpp"
     break;
 
   case 288: /* show_statement: SHOW SNAPSHOTS  */
@@ -6501,7 +6512,7 @@ yyreduce:
      (yyval.show_stmt) = new infinity::ShowStatement();
      (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kListSnapshots;
 }
-#line 6505 "parser.cpp"
+#line 6516 "parser.cpp"
     break;
 
   case 289: /* show_statement: SHOW SNAPSHOT IDENTIFIER  */
@@ -6512,7 +6523,7 @@ yyreduce:
      (yyval.show_stmt)->snapshot_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 6516 "parser.cpp"
+#line 6527 "parser.cpp"
     break;
 
   case 290: /* flush_statement: FLUSH DATA  */
@@ -6521,7 +6532,7 @@ yyreduce:
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 6525 "parser.cpp"
+#line 6536 "parser.cpp"
     break;
 
   case 291: /* flush_statement: FLUSH LOG  */
@@ -6530,7 +6541,7 @@ yyreduce:
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 6534 "parser.cpp"
+#line 6545 "parser.cpp"
     break;
 
   case 292: /* flush_statement: FLUSH BUFFER  */
@@ -6539,7 +6550,7 @@ yyreduce:
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 6543 "parser.cpp"
+#line 6554 "parser.cpp"
     break;
 
   case 293: /* flush_statement: FLUSH CATALOG  */
@@ -6548,7 +6559,7 @@ yyreduce:
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kCatalog;
 }
-#line 6552 "parser.cpp"
+#line 6563 "parser.cpp"
     break;
 
   case 294: /* optimize_statement: OPTIMIZE table_name  */
@@ -6563,7 +6574,7 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 6567 "parser.cpp"
+#line 6578 "parser.cpp"
     break;
 
   case 295: /* optimize_statement: OPTIMIZE IDENTIFIER ON table_name with_index_param_list  */
@@ -6587,7 +6598,7 @@ yyreduce:
     }
     delete (yyvsp[0].with_index_param_list_t);
 }
-#line 6591 "parser.cpp"
+#line 6602 "parser.cpp"
     break;
 
   case 296: /* command_statement: USE IDENTIFIER  */
@@ -6598,7 +6609,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6602 "parser.cpp"
+#line 6613 "parser.cpp"
     break;
 
   case 297: /* command_statement: EXPORT PROFILES LONG_VALUE file_path  */
@@ -6608,7 +6619,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 6612 "parser.cpp"
+#line 6623 "parser.cpp"
     break;
 
   case 298: /* command_statement: SET SESSION IDENTIFIER ON  */
@@ -6619,7 +6630,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6623 "parser.cpp"
+#line 6634 "parser.cpp"
     break;
 
   case 299: /* command_statement: SET SESSION IDENTIFIER OFF  */
@@ -6630,7 +6641,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6634 "parser.cpp"
+#line 6645 "parser.cpp"
     break;
 
   case 300: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
@@ -6643,7 +6654,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6647 "parser.cpp"
+#line 6658 "parser.cpp"
     break;
 
   case 301: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
@@ -6654,7 +6665,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6658 "parser.cpp"
+#line 6669 "parser.cpp"
     break;
 
   case 302: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
@@ -6665,7 +6676,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6669 "parser.cpp"
+#line 6680 "parser.cpp"
     break;
 
   case 303: /* command_statement: SET GLOBAL IDENTIFIER ON  */
@@ -6676,7 +6687,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6680 "parser.cpp"
+#line 6691 "parser.cpp"
     break;
 
   case 304: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
@@ -6687,7 +6698,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6691 "parser.cpp"
+#line 6702 "parser.cpp"
     break;
 
   case 305: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
@@ -6700,7 +6711,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6704 "parser.cpp"
+#line 6715 "parser.cpp"
     break;
 
   case 306: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
@@ -6711,7 +6722,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6715 "parser.cpp"
+#line 6726 "parser.cpp"
     break;
 
   case 307: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
@@ -6722,7 +6733,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6726 "parser.cpp"
+#line 6737 "parser.cpp"
     break;
 
   case 308: /* command_statement: SET CONFIG IDENTIFIER ON  */
@@ -6733,7 +6744,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6737 "parser.cpp"
+#line 6748 "parser.cpp"
     break;
 
   case 309: /* command_statement: SET CONFIG IDENTIFIER OFF  */
@@ -6744,7 +6755,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6748 "parser.cpp"
+#line 6759 "parser.cpp"
     break;
 
   case 310: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
@@ -6757,7 +6768,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6761 "parser.cpp"
+#line 6772 "parser.cpp"
     break;
 
   case 311: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
@@ -6768,7 +6779,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6772 "parser.cpp"
+#line 6783 "parser.cpp"
     break;
 
   case 312: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
@@ -6779,7 +6790,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6783 "parser.cpp"
+#line 6794 "parser.cpp"
     break;
 
   case 313: /* command_statement: CREATE SNAPSHOT IDENTIFIER ON TABLE IDENTIFIER  */
@@ -6792,7 +6803,7 @@ yyreduce:
     free((yyvsp[-3].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6796 "parser.cpp"
+#line 6807 "parser.cpp"
     break;
 
   case 314: /* command_statement: CREATE SNAPSHOT IDENTIFIER ON DATABASE IDENTIFIER  */
@@ -6805,7 +6816,7 @@ yyreduce:
     free((yyvsp[-3].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6809 "parser.cpp"
+#line 6820 "parser.cpp"
     break;
 
   case 315: /* command_statement: CREATE SNAPSHOT IDENTIFIER ON SYSTEM  */
@@ -6816,7 +6827,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SnapshotCmd>((yyvsp[-2].str_value), infinity::SnapshotOp::kCreate, infinity::SnapshotScope::kSystem);
     free((yyvsp[-2].str_value));
 }
-#line 6820 "parser.cpp"
+#line 6831 "parser.cpp"
     break;
 
   case 316: /* command_statement: DROP SNAPSHOT IDENTIFIER  */
@@ -6827,7 +6838,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SnapshotCmd>((yyvsp[0].str_value), infinity::SnapshotOp::kDrop, infinity::SnapshotScope::kIgnore);
     free((yyvsp[0].str_value));
 }
-#line 6831 "parser.cpp"
+#line 6842 "parser.cpp"
     break;
 
   case 317: /* command_statement: RESTORE DATABASE SNAPSHOT IDENTIFIER  */
@@ -6838,7 +6849,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SnapshotCmd>((yyvsp[0].str_value), infinity::SnapshotOp::kRestore, infinity::SnapshotScope::kDatabase);
     free((yyvsp[0].str_value));
 }
-#line 6842 "parser.cpp"
+#line 6853 "parser.cpp"
     break;
 
   case 318: /* command_statement: RESTORE TABLE SNAPSHOT IDENTIFIER  */
@@ -6849,7 +6860,7 @@ yyreduce:
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SnapshotCmd>((yyvsp[0].str_value), infinity::SnapshotOp::kRestore, infinity::SnapshotScope::kTable);
     free((yyvsp[0].str_value));
 }
-#line 6853 "parser.cpp"
+#line 6864 "parser.cpp"
     break;
 
   case 319: /* command_statement: CLEAN DATA  */
@@ -6858,7 +6869,7 @@ yyreduce:
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::CleanupCmd>();
 }
-#line 6862 "parser.cpp"
+#line 6873 "parser.cpp"
     break;
 
   case 320: /* command_statement: DUMP INDEX IDENTIFIER ON table_name  */
@@ -6876,7 +6887,7 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 6880 "parser.cpp"
+#line 6891 "parser.cpp"
     break;
 
   case 321: /* compact_statement: COMPACT TABLE table_name  */
@@ -6893,7 +6904,7 @@ yyreduce:
     (yyval.compact_stmt) = new infinity::ManualCompactStatement(std::move(schema_name), std::move(table_name));
     delete (yyvsp[0].table_name_t);
 }
-#line 6897 "parser.cpp"
+#line 6908 "parser.cpp"
     break;
 
   case 322: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASES  */
@@ -6904,7 +6915,7 @@ yyreduce:
      (yyval.admin_stmt)->catalog_file_start_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->catalog_file_end_index_ = (yyvsp[-1].long_value);
 }
-#line 6908 "parser.cpp"
+#line 6919 "parser.cpp"
     break;
 
   case 323: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE  */
@@ -6916,7 +6927,7 @@ yyreduce:
      (yyval.admin_stmt)->catalog_file_end_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->database_meta_index_ = (yyvsp[0].long_value);
 }
-#line 6920 "parser.cpp"
+#line 6931 "parser.cpp"
     break;
 
   case 324: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLES  */
@@ -6929,7 +6940,7 @@ yyreduce:
      (yyval.admin_stmt)->database_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->database_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6933 "parser.cpp"
+#line 6944 "parser.cpp"
     break;
 
   case 325: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE  */
@@ -6943,7 +6954,7 @@ yyreduce:
      (yyval.admin_stmt)->database_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[0].long_value);
 }
-#line 6947 "parser.cpp"
+#line 6958 "parser.cpp"
     break;
 
   case 326: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE COLUMNS  */
@@ -6958,7 +6969,7 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6962 "parser.cpp"
+#line 6973 "parser.cpp"
     break;
 
   case 327: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENTS  */
@@ -6973,7 +6984,7 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6977 "parser.cpp"
+#line 6988 "parser.cpp"
     break;
 
   case 328: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE  */
@@ -6989,7 +7000,7 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[0].long_value);
 }
-#line 6993 "parser.cpp"
+#line 7004 "parser.cpp"
     break;
 
   case 329: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCKS  */
@@ -7005,7 +7016,7 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-3].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-1].long_value);
 }
-#line 7009 "parser.cpp"
+#line 7020 "parser.cpp"
     break;
 
   case 330: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
@@ -7022,7 +7033,7 @@ yyreduce:
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->block_index_ = (yyvsp[0].long_value);
 }
-#line 7026 "parser.cpp"
+#line 7037 "parser.cpp"
     break;
 
   case 331: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMNS  */
@@ -7039,7 +7050,7 @@ yyreduce:
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-3].long_value);
      (yyval.admin_stmt)->block_index_ = (yyvsp[-1].long_value);
 }
-#line 7043 "parser.cpp"
+#line 7054 "parser.cpp"
     break;
 
   case 332: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEXES  */
@@ -7054,7 +7065,7 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 7058 "parser.cpp"
+#line 7069 "parser.cpp"
     break;
 
   case 333: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE  */
@@ -7070,7 +7081,7 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->index_meta_index_ = (yyvsp[0].long_value);
 }
-#line 7074 "parser.cpp"
+#line 7085 "parser.cpp"
     break;
 
   case 334: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE LONG_VALUE SEGMENTS  */
@@ -7087,7 +7098,7 @@ yyreduce:
      (yyval.admin_stmt)->index_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->index_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 7091 "parser.cpp"
+#line 7102 "parser.cpp"
     break;
 
   case 335: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE  */
@@ -7105,7 +7116,7 @@ yyreduce:
      (yyval.admin_stmt)->index_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[0].long_value);
 }
-#line 7109 "parser.cpp"
+#line 7120 "parser.cpp"
     break;
 
   case 336: /* admin_statement: ADMIN SHOW LOGS  */
@@ -7114,7 +7125,7 @@ yyreduce:
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListLogFiles;
 }
-#line 7118 "parser.cpp"
+#line 7129 "parser.cpp"
     break;
 
   case 337: /* admin_statement: ADMIN SHOW LOG LONG_VALUE  */
@@ -7124,7 +7135,7 @@ yyreduce:
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowLogFile;
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[0].long_value);
 }
-#line 7128 "parser.cpp"
+#line 7139 "parser.cpp"
     break;
 
   case 338: /* admin_statement: ADMIN SHOW LOG LONG_VALUE INDEXES  */
@@ -7134,7 +7145,7 @@ yyreduce:
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListLogIndexes;
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[-1].long_value);
 }
-#line 7138 "parser.cpp"
+#line 7149 "parser.cpp"
     break;
 
   case 339: /* admin_statement: ADMIN SHOW LOG LONG_VALUE INDEX LONG_VALUE  */
@@ -7145,7 +7156,7 @@ yyreduce:
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->log_index_in_file_ = (yyvsp[0].long_value);
 }
-#line 7149 "parser.cpp"
+#line 7160 "parser.cpp"
     break;
 
   case 340: /* admin_statement: ADMIN SHOW CONFIGS  */
@@ -7154,7 +7165,7 @@ yyreduce:
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListConfigs;
 }
-#line 7158 "parser.cpp"
+#line 7169 "parser.cpp"
     break;
 
   case 341: /* admin_statement: ADMIN SHOW VARIABLES  */
@@ -7163,7 +7174,7 @@ yyreduce:
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListVariables;
 }
-#line 7167 "parser.cpp"
+#line 7178 "parser.cpp"
     break;
 
   case 342: /* admin_statement: ADMIN SHOW VARIABLE IDENTIFIER  */
@@ -7174,7 +7185,7 @@ yyreduce:
      (yyval.admin_stmt)->variable_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 7178 "parser.cpp"
+#line 7189 "parser.cpp"
     break;
 
   case 343: /* admin_statement: ADMIN CREATE SNAPSHOT  */
@@ -7183,7 +7194,7 @@ yyreduce:
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kCreateSnapshot;
 }
-#line 7187 "parser.cpp"
+#line 7198 "parser.cpp"
     break;
 
   case 344: /* admin_statement: ADMIN SHOW SNAPSHOTS  */
@@ -7192,7 +7203,7 @@ yyreduce:
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListSnapshots;
 }
-#line 7196 "parser.cpp"
+#line 7207 "parser.cpp"
     break;
 
   case 345: /* admin_statement: ADMIN SHOW SNAPSHOT IDENTIFIER  */
@@ -7203,7 +7214,7 @@ yyreduce:
      (yyval.admin_stmt)->snapshot_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 7207 "parser.cpp"
+#line 7218 "parser.cpp"
     break;
 
   case 346: /* admin_statement: ADMIN DELETE SNAPSHOT STRING  */
@@ -7214,7 +7225,7 @@ yyreduce:
      (yyval.admin_stmt)->snapshot_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 7218 "parser.cpp"
+#line 7229 "parser.cpp"
     break;
 
   case 347: /* admin_statement: ADMIN EXPORT SNAPSHOT STRING TO STRING  */
@@ -7227,7 +7238,7 @@ yyreduce:
      free((yyvsp[-2].str_value));
      free((yyvsp[0].str_value));
 }
-#line 7231 "parser.cpp"
+#line 7242 "parser.cpp"
     break;
 
   case 348: /* admin_statement: ADMIN RECOVER FROM SNAPSHOT STRING  */
@@ -7238,7 +7249,7 @@ yyreduce:
      (yyval.admin_stmt)->snapshot_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 7242 "parser.cpp"
+#line 7253 "parser.cpp"
     break;
 
   case 349: /* admin_statement: ADMIN SHOW NODES  */
@@ -7247,7 +7258,7 @@ yyreduce:
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListNodes;
 }
-#line 7251 "parser.cpp"
+#line 7262 "parser.cpp"
     break;
 
   case 350: /* admin_statement: ADMIN SHOW NODE STRING  */
@@ -7258,7 +7269,7 @@ yyreduce:
      (yyval.admin_stmt)->node_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 7262 "parser.cpp"
+#line 7273 "parser.cpp"
     break;
 
   case 351: /* admin_statement: ADMIN SHOW NODE  */
@@ -7267,7 +7278,7 @@ yyreduce:
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowCurrentNode;
 }
-#line 7271 "parser.cpp"
+#line 7282 "parser.cpp"
     break;
 
   case 352: /* admin_statement: ADMIN REMOVE NODE STRING  */
@@ -7278,7 +7289,7 @@ yyreduce:
      (yyval.admin_stmt)->node_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 7282 "parser.cpp"
+#line 7293 "parser.cpp"
     break;
 
   case 353: /* admin_statement: ADMIN SET ADMIN  */
@@ -7288,7 +7299,7 @@ yyreduce:
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kSetRole;
      (yyval.admin_stmt)->node_role_ = infinity::NodeRole::kAdmin;
 }
-#line 7292 "parser.cpp"
+#line 7303 "parser.cpp"
     break;
 
   case 354: /* admin_statement: ADMIN SET STANDALONE  */
@@ -7298,7 +7309,7 @@ yyreduce:
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kSetRole;
      (yyval.admin_stmt)->node_role_ = infinity::NodeRole::kStandalone;
 }
-#line 7302 "parser.cpp"
+#line 7313 "parser.cpp"
     break;
 
   case 355: /* admin_statement: ADMIN SET LEADER USING STRING  */
@@ -7310,7 +7321,7 @@ yyreduce:
      (yyval.admin_stmt)->node_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 7314 "parser.cpp"
+#line 7325 "parser.cpp"
     break;
 
   case 356: /* admin_statement: ADMIN CONNECT STRING AS FOLLOWER USING STRING  */
@@ -7324,7 +7335,7 @@ yyreduce:
      free((yyvsp[-4].str_value));
      free((yyvsp[0].str_value));
 }
-#line 7328 "parser.cpp"
+#line 7339 "parser.cpp"
     break;
 
   case 357: /* admin_statement: ADMIN CONNECT STRING AS LEARNER USING STRING  */
@@ -7338,7 +7349,7 @@ yyreduce:
      free((yyvsp[-4].str_value));
      free((yyvsp[0].str_value));
 }
-#line 7342 "parser.cpp"
+#line 7353 "parser.cpp"
     break;
 
   case 358: /* alter_statement: ALTER TABLE table_name RENAME TO IDENTIFIER  */
@@ -7352,7 +7363,7 @@ yyreduce:
     free((yyvsp[-3].table_name_t)->table_name_ptr_);
     delete (yyvsp[-3].table_name_t);
 }
-#line 7356 "parser.cpp"
+#line 7367 "parser.cpp"
     break;
 
   case 359: /* alter_statement: ALTER TABLE table_name ADD COLUMN '(' column_def_array ')'  */
@@ -7369,7 +7380,7 @@ yyreduce:
     free((yyvsp[-5].table_name_t)->table_name_ptr_);
     delete (yyvsp[-5].table_name_t);
 }
-#line 7373 "parser.cpp"
+#line 7384 "parser.cpp"
     break;
 
   case 360: /* alter_statement: ALTER TABLE table_name DROP COLUMN '(' identifier_array ')'  */
@@ -7385,7 +7396,7 @@ yyreduce:
     free((yyvsp[-5].table_name_t)->table_name_ptr_);
     delete (yyvsp[-5].table_name_t);
 }
-#line 7389 "parser.cpp"
+#line 7400 "parser.cpp"
     break;
 
   case 361: /* check_statement: CHECK SYSTEM  */
@@ -7394,7 +7405,7 @@ yyreduce:
     (yyval.check_stmt) = new infinity::CheckStatement();
     (yyval.check_stmt)->check_type_ = infinity::CheckStmtType::kSystem;
 }
-#line 7398 "parser.cpp"
+#line 7409 "parser.cpp"
     break;
 
   case 362: /* check_statement: CHECK TABLE table_name  */
@@ -7410,7 +7421,7 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 7414 "parser.cpp"
+#line 7425 "parser.cpp"
     break;
 
   case 363: /* expr_array: expr_alias  */
@@ -7419,7 +7430,7 @@ yyreduce:
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 7423 "parser.cpp"
+#line 7434 "parser.cpp"
     break;
 
   case 364: /* expr_array: expr_array ',' expr_alias  */
@@ -7428,7 +7439,7 @@ yyreduce:
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 7432 "parser.cpp"
+#line 7443 "parser.cpp"
     break;
 
   case 365: /* insert_row_list: '(' expr_array ')'  */
@@ -7443,7 +7454,7 @@ yyreduce:
     (yyval.insert_row_list_t) = new std::vector<infinity::InsertRowExpr*>();
     (yyval.insert_row_list_t)->emplace_back(res.release());
 }
-#line 7447 "parser.cpp"
+#line 7458 "parser.cpp"
     break;
 
   case 366: /* insert_row_list: insert_row_list ',' '(' expr_array ')'  */
@@ -7458,7 +7469,7 @@ yyreduce:
     delete (yyvsp[-1].expr_array_t);
     (yyval.insert_row_list_t)->emplace_back(res.release());
 }
-#line 7462 "parser.cpp"
+#line 7473 "parser.cpp"
     break;
 
   case 367: /* expr_alias: expr AS IDENTIFIER  */
@@ -7469,7 +7480,7 @@ yyreduce:
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7473 "parser.cpp"
+#line 7484 "parser.cpp"
     break;
 
   case 368: /* expr_alias: expr  */
@@ -7477,7 +7488,7 @@ yyreduce:
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7481 "parser.cpp"
+#line 7492 "parser.cpp"
     break;
 
   case 374: /* operand: '(' expr ')'  */
@@ -7485,7 +7496,7 @@ yyreduce:
                       {
     (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 7489 "parser.cpp"
+#line 7500 "parser.cpp"
     break;
 
   case 375: /* operand: '(' select_without_paren ')'  */
@@ -7496,7 +7507,7 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7500 "parser.cpp"
+#line 7511 "parser.cpp"
     break;
 
   case 376: /* operand: constant_expr  */
@@ -7504,11 +7515,26 @@ yyreduce:
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7508 "parser.cpp"
+#line 7519 "parser.cpp"
     break;
 
-  case 387: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING ',' STRING optional_search_filter_expr ')'  */
-#line 2769 "parser.y"
+  case 377: /* operand: '?'  */
+#line 2756 "parser.y"
+      {
+    // Parameter placeholder of a prepared statement, the value is filled in on bind.
+    if(!result->allow_parameters_) {
+        yyerror(&yyloc, scanner, result, "Parameter placeholder is only allowed in prepared statements");
+        YYERROR;
+    }
+    infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kNull);
+    result->parameters_.emplace_back(const_expr);
+    (yyval.expr_t) = const_expr;
+}
+#line 7534 "parser.cpp"
+    break;
+
+  case 388: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING ',' STRING optional_search_filter_expr ')'  */
+#line 2779 "parser.y"
                                                                                                                                         {
     auto match_tensor_expr = std::make_unique<infinity::MatchTensorExpr>();
     // search column
@@ -7524,11 +7550,11 @@ yyreduce:
     match_tensor_expr->SetOptionalFilter((yyvsp[-1].expr_t));
     (yyval.expr_t) = match_tensor_expr.release();
 }
-#line 7528 "parser.cpp"
+#line 7554 "parser.cpp"
     break;
 
-  case 388: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING ',' STRING optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')'  */
-#line 2785 "parser.y"
+  case 389: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING ',' STRING optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')'  */
+#line 2795 "parser.y"
                                                                                                                                                    {
     auto match_tensor_expr = std::make_unique<infinity::MatchTensorExpr>();
     // search column
@@ -7545,11 +7571,11 @@ yyreduce:
     match_tensor_expr->index_name_ = (yyvsp[-1].str_value);
     (yyval.expr_t) = match_tensor_expr.release();
 }
-#line 7549 "parser.cpp"
+#line 7575 "parser.cpp"
     break;
 
-  case 389: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING ',' STRING optional_search_filter_expr ')' IGNORE INDEX  */
-#line 2802 "parser.y"
+  case 390: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING ',' STRING optional_search_filter_expr ')' IGNORE INDEX  */
+#line 2812 "parser.y"
                                                                                                                                  {
     auto match_tensor_expr = std::make_unique<infinity::MatchTensorExpr>();
     // search column
@@ -7566,11 +7592,11 @@ yyreduce:
     match_tensor_expr->SetOptionalFilter((yyvsp[-3].expr_t));
     (yyval.expr_t) = match_tensor_expr.release();
 }
-#line 7570 "parser.cpp"
+#line 7596 "parser.cpp"
     break;
 
-  case 390: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
-#line 2820 "parser.y"
+  case 391: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
+#line 2830 "parser.y"
                                                                                                                                                                                    {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -7616,11 +7642,11 @@ Error1:
 Return1:
     ;
 }
-#line 7620 "parser.cpp"
+#line 7646 "parser.cpp"
     break;
 
-  case 391: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' IGNORE INDEX  */
-#line 2866 "parser.y"
+  case 392: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' IGNORE INDEX  */
+#line 2876 "parser.y"
                                                                                                                        {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -7659,11 +7685,11 @@ Error2:
 Return2:
     ;
 }
-#line 7663 "parser.cpp"
+#line 7689 "parser.cpp"
     break;
 
-  case 392: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' with_index_param_list  */
-#line 2905 "parser.y"
+  case 393: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' with_index_param_list  */
+#line 2915 "parser.y"
                                                                                                                                 {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -7706,11 +7732,11 @@ Error3:
 Return3:
     ;
 }
-#line 7710 "parser.cpp"
+#line 7736 "parser.cpp"
     break;
 
-  case 393: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING optional_search_filter_expr ')' with_index_param_list  */
-#line 2948 "parser.y"
+  case 394: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING optional_search_filter_expr ')' with_index_param_list  */
+#line 2958 "parser.y"
                                                                                                                  {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -7754,11 +7780,11 @@ Error4:
 Return4:
     ;
 }
-#line 7758 "parser.cpp"
+#line 7784 "parser.cpp"
     break;
 
-  case 394: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
-#line 2995 "parser.y"
+  case 395: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
+#line 3005 "parser.y"
                                                                                                                                                                                      {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -7782,11 +7808,11 @@ Return4:
     match_sparse_expr->index_name_ = (yyvsp[-2].str_value);
     free((yyvsp[-2].str_value));
 }
-#line 7786 "parser.cpp"
+#line 7812 "parser.cpp"
     break;
 
-  case 395: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' IGNORE INDEX  */
-#line 3019 "parser.y"
+  case 396: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' IGNORE INDEX  */
+#line 3029 "parser.y"
                                                                                                                           {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -7809,11 +7835,11 @@ Return4:
 
     match_sparse_expr->ignore_index_ = true;
 }
-#line 7813 "parser.cpp"
+#line 7839 "parser.cpp"
     break;
 
-  case 396: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' with_index_param_list  */
-#line 3042 "parser.y"
+  case 397: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' with_index_param_list  */
+#line 3052 "parser.y"
                                                                                                                                    {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -7834,11 +7860,11 @@ Return4:
     // topn and options
     match_sparse_expr->SetOptParams((yyvsp[-3].long_value), (yyvsp[0].with_index_param_list_t));
 }
-#line 7838 "parser.cpp"
+#line 7864 "parser.cpp"
     break;
 
-  case 397: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING optional_search_filter_expr ')' with_index_param_list  */
-#line 3063 "parser.y"
+  case 398: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING optional_search_filter_expr ')' with_index_param_list  */
+#line 3073 "parser.y"
                                                                                                                     {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -7859,11 +7885,11 @@ Return4:
     // topn and options
     match_sparse_expr->SetOptParams(infinity::DEFAULT_MATCH_SPARSE_TOP_N, (yyvsp[0].with_index_param_list_t));
 }
-#line 7863 "parser.cpp"
+#line 7889 "parser.cpp"
     break;
 
-  case 398: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING optional_search_filter_expr ')'  */
-#line 3084 "parser.y"
+  case 399: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING optional_search_filter_expr ')'  */
+#line 3094 "parser.y"
                                                                                    {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-4].str_value));
@@ -7873,11 +7899,11 @@ Return4:
     free((yyvsp[-2].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7877 "parser.cpp"
+#line 7903 "parser.cpp"
     break;
 
-  case 399: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING optional_search_filter_expr ')'  */
-#line 3093 "parser.y"
+  case 400: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING optional_search_filter_expr ')'  */
+#line 3103 "parser.y"
                                                                               {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-6].str_value));
@@ -7889,11 +7915,11 @@ Return4:
     free((yyvsp[-2].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7893 "parser.cpp"
+#line 7919 "parser.cpp"
     break;
 
-  case 400: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING optional_search_filter_expr ')' USING INDEXES '(' STRING ')'  */
-#line 3104 "parser.y"
+  case 401: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING optional_search_filter_expr ')' USING INDEXES '(' STRING ')'  */
+#line 3114 "parser.y"
                                                                                                 {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-9].str_value));
@@ -7905,11 +7931,11 @@ Return4:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7909 "parser.cpp"
+#line 7935 "parser.cpp"
     break;
 
-  case 401: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING optional_search_filter_expr ')' USING INDEXES '(' STRING ')'  */
-#line 3115 "parser.y"
+  case 402: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING optional_search_filter_expr ')' USING INDEXES '(' STRING ')'  */
+#line 3125 "parser.y"
                                                                                                            {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-11].str_value));
@@ -7923,11 +7949,11 @@ Return4:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7927 "parser.cpp"
+#line 7953 "parser.cpp"
     break;
 
-  case 402: /* query_expr: QUERY '(' STRING optional_search_filter_expr ')'  */
-#line 3129 "parser.y"
+  case 403: /* query_expr: QUERY '(' STRING optional_search_filter_expr ')'  */
+#line 3139 "parser.y"
                                                               {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-2].str_value));
@@ -7935,11 +7961,11 @@ Return4:
     free((yyvsp[-2].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7939 "parser.cpp"
+#line 7965 "parser.cpp"
     break;
 
-  case 403: /* query_expr: QUERY '(' STRING ',' STRING optional_search_filter_expr ')'  */
-#line 3136 "parser.y"
+  case 404: /* query_expr: QUERY '(' STRING ',' STRING optional_search_filter_expr ')'  */
+#line 3146 "parser.y"
                                                               {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-4].str_value));
@@ -7949,22 +7975,22 @@ Return4:
     free((yyvsp[-2].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7953 "parser.cpp"
+#line 7979 "parser.cpp"
     break;
 
-  case 404: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 3146 "parser.y"
+  case 405: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 3156 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 7964 "parser.cpp"
+#line 7990 "parser.cpp"
     break;
 
-  case 405: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 3152 "parser.y"
+  case 406: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 3162 "parser.y"
                                    {
     auto fusion_expr = std::make_unique<infinity::FusionExpr>();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -7976,77 +8002,77 @@ Return4:
     fusion_expr->JobAfterParser();
     (yyval.expr_t) = fusion_expr.release();
 }
-#line 7980 "parser.cpp"
+#line 8006 "parser.cpp"
     break;
 
-  case 406: /* sub_search: match_vector_expr  */
-#line 3164 "parser.y"
+  case 407: /* sub_search: match_vector_expr  */
+#line 3174 "parser.y"
                                {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7988 "parser.cpp"
+#line 8014 "parser.cpp"
     break;
 
-  case 407: /* sub_search: match_text_expr  */
-#line 3167 "parser.y"
+  case 408: /* sub_search: match_text_expr  */
+#line 3177 "parser.y"
                   {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7996 "parser.cpp"
+#line 8022 "parser.cpp"
     break;
 
-  case 408: /* sub_search: match_tensor_expr  */
-#line 3170 "parser.y"
+  case 409: /* sub_search: match_tensor_expr  */
+#line 3180 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 8004 "parser.cpp"
+#line 8030 "parser.cpp"
     break;
 
-  case 409: /* sub_search: match_sparse_expr  */
-#line 3173 "parser.y"
+  case 410: /* sub_search: match_sparse_expr  */
+#line 3183 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 8012 "parser.cpp"
+#line 8038 "parser.cpp"
     break;
 
-  case 410: /* sub_search: query_expr  */
-#line 3176 "parser.y"
+  case 411: /* sub_search: query_expr  */
+#line 3186 "parser.y"
              {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 8020 "parser.cpp"
+#line 8046 "parser.cpp"
     break;
 
-  case 411: /* sub_search: fusion_expr  */
-#line 3179 "parser.y"
+  case 412: /* sub_search: fusion_expr  */
+#line 3189 "parser.y"
               {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 8028 "parser.cpp"
+#line 8054 "parser.cpp"
     break;
 
-  case 412: /* sub_search_array: sub_search  */
-#line 3183 "parser.y"
+  case 413: /* sub_search_array: sub_search  */
+#line 3193 "parser.y"
                               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 8037 "parser.cpp"
+#line 8063 "parser.cpp"
     break;
 
-  case 413: /* sub_search_array: sub_search_array ',' sub_search  */
-#line 3187 "parser.y"
+  case 414: /* sub_search_array: sub_search_array ',' sub_search  */
+#line 3197 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 8046 "parser.cpp"
+#line 8072 "parser.cpp"
     break;
 
-  case 414: /* function_expr: IDENTIFIER '(' ')'  */
-#line 3192 "parser.y"
+  case 415: /* function_expr: IDENTIFIER '(' ')'  */
+#line 3202 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -8055,11 +8081,11 @@ Return4:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 8059 "parser.cpp"
+#line 8085 "parser.cpp"
     break;
 
-  case 415: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 3200 "parser.y"
+  case 416: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 3210 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -8068,11 +8094,11 @@ Return4:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 8072 "parser.cpp"
+#line 8098 "parser.cpp"
     break;
 
-  case 416: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 3208 "parser.y"
+  case 417: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 3218 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -8082,11 +8108,11 @@ Return4:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 8086 "parser.cpp"
+#line 8112 "parser.cpp"
     break;
 
-  case 417: /* function_expr: YEAR '(' expr ')'  */
-#line 3217 "parser.y"
+  case 418: /* function_expr: YEAR '(' expr ')'  */
+#line 3227 "parser.y"
                     {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "year";
@@ -8094,11 +8120,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8098 "parser.cpp"
+#line 8124 "parser.cpp"
     break;
 
-  case 418: /* function_expr: MONTH '(' expr ')'  */
-#line 3224 "parser.y"
+  case 419: /* function_expr: MONTH '(' expr ')'  */
+#line 3234 "parser.y"
                      {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "month";
@@ -8106,11 +8132,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8110 "parser.cpp"
+#line 8136 "parser.cpp"
     break;
 
-  case 419: /* function_expr: DAY '(' expr ')'  */
-#line 3231 "parser.y"
+  case 420: /* function_expr: DAY '(' expr ')'  */
+#line 3241 "parser.y"
                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "day";
@@ -8118,11 +8144,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8122 "parser.cpp"
+#line 8148 "parser.cpp"
     break;
 
-  case 420: /* function_expr: HOUR '(' expr ')'  */
-#line 3238 "parser.y"
+  case 421: /* function_expr: HOUR '(' expr ')'  */
+#line 3248 "parser.y"
                     {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "hour";
@@ -8130,11 +8156,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8134 "parser.cpp"
+#line 8160 "parser.cpp"
     break;
 
-  case 421: /* function_expr: MINUTE '(' expr ')'  */
-#line 3245 "parser.y"
+  case 422: /* function_expr: MINUTE '(' expr ')'  */
+#line 3255 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "minute";
@@ -8142,11 +8168,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8146 "parser.cpp"
+#line 8172 "parser.cpp"
     break;
 
-  case 422: /* function_expr: SECOND '(' expr ')'  */
-#line 3252 "parser.y"
+  case 423: /* function_expr: SECOND '(' expr ')'  */
+#line 3262 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "second";
@@ -8154,11 +8180,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8158 "parser.cpp"
+#line 8184 "parser.cpp"
     break;
 
-  case 423: /* function_expr: operand IS NOT NULLABLE  */
-#line 3259 "parser.y"
+  case 424: /* function_expr: operand IS NOT NULLABLE  */
+#line 3269 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -8166,11 +8192,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8170 "parser.cpp"
+#line 8196 "parser.cpp"
     break;
 
-  case 424: /* function_expr: operand IS NULLABLE  */
-#line 3266 "parser.y"
+  case 425: /* function_expr: operand IS NULLABLE  */
+#line 3276 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -8178,11 +8204,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8182 "parser.cpp"
+#line 8208 "parser.cpp"
     break;
 
-  case 425: /* function_expr: NOT operand  */
-#line 3273 "parser.y"
+  case 426: /* function_expr: NOT operand  */
+#line 3283 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -8190,11 +8216,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8194 "parser.cpp"
+#line 8220 "parser.cpp"
     break;
 
-  case 426: /* function_expr: '-' operand  */
-#line 3280 "parser.y"
+  case 427: /* function_expr: '-' operand  */
+#line 3290 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -8202,11 +8228,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8206 "parser.cpp"
+#line 8232 "parser.cpp"
     break;
 
-  case 427: /* function_expr: '+' operand  */
-#line 3287 "parser.y"
+  case 428: /* function_expr: '+' operand  */
+#line 3297 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -8214,11 +8240,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8218 "parser.cpp"
+#line 8244 "parser.cpp"
     break;
 
-  case 428: /* function_expr: operand '-' operand  */
-#line 3294 "parser.y"
+  case 429: /* function_expr: operand '-' operand  */
+#line 3304 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -8227,11 +8253,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8231 "parser.cpp"
+#line 8257 "parser.cpp"
     break;
 
-  case 429: /* function_expr: operand '+' operand  */
-#line 3302 "parser.y"
+  case 430: /* function_expr: operand '+' operand  */
+#line 3312 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -8240,11 +8266,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8244 "parser.cpp"
+#line 8270 "parser.cpp"
     break;
 
-  case 430: /* function_expr: operand '*' operand  */
-#line 3310 "parser.y"
+  case 431: /* function_expr: operand '*' operand  */
+#line 3320 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -8253,11 +8279,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8257 "parser.cpp"
+#line 8283 "parser.cpp"
     break;
 
-  case 431: /* function_expr: operand '/' operand  */
-#line 3318 "parser.y"
+  case 432: /* function_expr: operand '/' operand  */
+#line 3328 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -8266,11 +8292,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8270 "parser.cpp"
+#line 8296 "parser.cpp"
     break;
 
-  case 432: /* function_expr: operand '%' operand  */
-#line 3326 "parser.y"
+  case 433: /* function_expr: operand '%' operand  */
+#line 3336 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -8279,11 +8305,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8283 "parser.cpp"
+#line 8309 "parser.cpp"
     break;
 
-  case 433: /* function_expr: operand '=' operand  */
-#line 3334 "parser.y"
+  case 434: /* function_expr: operand '=' operand  */
+#line 3344 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -8292,11 +8318,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8296 "parser.cpp"
+#line 8322 "parser.cpp"
     break;
 
-  case 434: /* function_expr: operand EQUAL operand  */
-#line 3342 "parser.y"
+  case 435: /* function_expr: operand EQUAL operand  */
+#line 3352 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -8305,11 +8331,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8309 "parser.cpp"
+#line 8335 "parser.cpp"
     break;
 
-  case 435: /* function_expr: operand NOT_EQ operand  */
-#line 3350 "parser.y"
+  case 436: /* function_expr: operand NOT_EQ operand  */
+#line 3360 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -8318,11 +8344,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8322 "parser.cpp"
+#line 8348 "parser.cpp"
     break;
 
-  case 436: /* function_expr: operand '<' operand  */
-#line 3358 "parser.y"
+  case 437: /* function_expr: operand '<' operand  */
+#line 3368 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -8331,11 +8357,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8335 "parser.cpp"
+#line 8361 "parser.cpp"
     break;
 
-  case 437: /* function_expr: operand '>' operand  */
-#line 3366 "parser.y"
+  case 438: /* function_expr: operand '>' operand  */
+#line 3376 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -8344,11 +8370,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8348 "parser.cpp"
+#line 8374 "parser.cpp"
     break;
 
-  case 438: /* function_expr: operand LESS_EQ operand  */
-#line 3374 "parser.y"
+  case 439: /* function_expr: operand LESS_EQ operand  */
+#line 3384 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -8357,11 +8383,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8361 "parser.cpp"
+#line 8387 "parser.cpp"
     break;
 
-  case 439: /* function_expr: operand GREATER_EQ operand  */
-#line 3382 "parser.y"
+  case 440: /* function_expr: operand GREATER_EQ operand  */
+#line 3392 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -8370,11 +8396,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8374 "parser.cpp"
+#line 8400 "parser.cpp"
     break;
 
-  case 440: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 3390 "parser.y"
+  case 441: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 3400 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -8405,11 +8431,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8409 "parser.cpp"
+#line 8435 "parser.cpp"
     break;
 
-  case 441: /* function_expr: operand LIKE operand  */
-#line 3420 "parser.y"
+  case 442: /* function_expr: operand LIKE operand  */
+#line 3430 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -8418,11 +8444,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8422 "parser.cpp"
+#line 8448 "parser.cpp"
     break;
 
-  case 442: /* function_expr: operand NOT LIKE operand  */
-#line 3428 "parser.y"
+  case 443: /* function_expr: operand NOT LIKE operand  */
+#line 3438 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -8431,11 +8457,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8435 "parser.cpp"
+#line 8461 "parser.cpp"
     break;
 
-  case 443: /* conjunction_expr: expr AND expr  */
-#line 3437 "parser.y"
+  case 444: /* conjunction_expr: expr AND expr  */
+#line 3447 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -8444,11 +8470,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8448 "parser.cpp"
+#line 8474 "parser.cpp"
     break;
 
-  case 444: /* conjunction_expr: expr OR expr  */
-#line 3445 "parser.y"
+  case 445: /* conjunction_expr: expr OR expr  */
+#line 3455 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -8457,11 +8483,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 8461 "parser.cpp"
+#line 8487 "parser.cpp"
     break;
 
-  case 445: /* between_expr: operand BETWEEN operand AND operand  */
-#line 3454 "parser.y"
+  case 446: /* between_expr: operand BETWEEN operand AND operand  */
+#line 3464 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -8469,44 +8495,44 @@ Return4:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 8473 "parser.cpp"
+#line 8499 "parser.cpp"
     break;
 
-  case 446: /* in_expr: operand IN '(' expr_array ')'  */
-#line 3462 "parser.y"
+  case 447: /* in_expr: operand IN '(' expr_array ')'  */
+#line 3472 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 8484 "parser.cpp"
+#line 8510 "parser.cpp"
     break;
 
-  case 447: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 3468 "parser.y"
+  case 448: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 3478 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 8495 "parser.cpp"
+#line 8521 "parser.cpp"
     break;
 
-  case 448: /* case_expr: CASE expr case_check_array END  */
-#line 3475 "parser.y"
+  case 449: /* case_expr: CASE expr case_check_array END  */
+#line 3485 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 8506 "parser.cpp"
+#line 8532 "parser.cpp"
     break;
 
-  case 449: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 3481 "parser.y"
+  case 450: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 3491 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -8514,32 +8540,32 @@ Return4:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 8518 "parser.cpp"
+#line 8544 "parser.cpp"
     break;
 
-  case 450: /* case_expr: CASE case_check_array END  */
-#line 3488 "parser.y"
+  case 451: /* case_expr: CASE case_check_array END  */
+#line 3498 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 8528 "parser.cpp"
+#line 8554 "parser.cpp"
     break;
 
-  case 451: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 3493 "parser.y"
+  case 452: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 3503 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 8539 "parser.cpp"
+#line 8565 "parser.cpp"
     break;
 
-  case 452: /* case_check_array: WHEN expr THEN expr  */
-#line 3500 "parser.y"
+  case 453: /* case_check_array: WHEN expr THEN expr  */
+#line 3510 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -8547,11 +8573,11 @@ Return4:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 8551 "parser.cpp"
+#line 8577 "parser.cpp"
     break;
 
-  case 453: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 3507 "parser.y"
+  case 454: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 3517 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -8559,11 +8585,11 @@ Return4:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 8563 "parser.cpp"
+#line 8589 "parser.cpp"
     break;
 
-  case 454: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 3515 "parser.y"
+  case 455: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 3525 "parser.y"
                                             {
     auto [data_type_result, fail_reason] = infinity::ColumnType::GetDataTypeFromColumnType(*((yyvsp[-1].column_type_t)), std::vector<std::unique_ptr<infinity::InitParameter>>{});
     delete (yyvsp[-1].column_type_t);
@@ -8576,33 +8602,33 @@ Return4:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 8580 "parser.cpp"
+#line 8606 "parser.cpp"
     break;
 
-  case 455: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 3528 "parser.y"
+  case 456: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 3538 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 8591 "parser.cpp"
+#line 8617 "parser.cpp"
     break;
 
-  case 456: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 3534 "parser.y"
+  case 457: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 3544 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 8602 "parser.cpp"
+#line 8628 "parser.cpp"
     break;
 
-  case 457: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 3540 "parser.y"
+  case 458: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 3550 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -8610,11 +8636,11 @@ Return4:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 8614 "parser.cpp"
+#line 8640 "parser.cpp"
     break;
 
-  case 458: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 3547 "parser.y"
+  case 459: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 3557 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -8622,11 +8648,11 @@ Return4:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 8626 "parser.cpp"
+#line 8652 "parser.cpp"
     break;
 
-  case 459: /* column_expr: IDENTIFIER  */
-#line 3555 "parser.y"
+  case 460: /* column_expr: IDENTIFIER  */
+#line 3565 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -8634,11 +8660,11 @@ Return4:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 8638 "parser.cpp"
+#line 8664 "parser.cpp"
     break;
 
-  case 460: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 3562 "parser.y"
+  case 461: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 3572 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -8646,21 +8672,21 @@ Return4:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 8650 "parser.cpp"
+#line 8676 "parser.cpp"
     break;
 
-  case 461: /* column_expr: '*'  */
-#line 3569 "parser.y"
+  case 462: /* column_expr: '*'  */
+#line 3579 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 8660 "parser.cpp"
+#line 8686 "parser.cpp"
     break;
 
-  case 462: /* column_expr: column_expr '.' '*'  */
-#line 3574 "parser.y"
+  case 463: /* column_expr: column_expr '.' '*'  */
+#line 3584 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -8670,240 +8696,240 @@ Return4:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 8674 "parser.cpp"
+#line 8700 "parser.cpp"
     break;
 
-  case 463: /* constant_expr: STRING  */
-#line 3584 "parser.y"
+  case 464: /* constant_expr: STRING  */
+#line 3594 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8684 "parser.cpp"
+#line 8710 "parser.cpp"
     break;
 
-  case 464: /* constant_expr: TRUE  */
-#line 3589 "parser.y"
+  case 465: /* constant_expr: TRUE  */
+#line 3599 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 8694 "parser.cpp"
+#line 8720 "parser.cpp"
     break;
 
-  case 465: /* constant_expr: FALSE  */
-#line 3594 "parser.y"
+  case 466: /* constant_expr: FALSE  */
+#line 3604 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 8704 "parser.cpp"
+#line 8730 "parser.cpp"
     break;
 
-  case 466: /* constant_expr: DOUBLE_VALUE  */
-#line 3599 "parser.y"
+  case 467: /* constant_expr: DOUBLE_VALUE  */
+#line 3609 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8714 "parser.cpp"
+#line 8740 "parser.cpp"
     break;
 
-  case 467: /* constant_expr: LONG_VALUE  */
-#line 3604 "parser.y"
+  case 468: /* constant_expr: LONG_VALUE  */
+#line 3614 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8724 "parser.cpp"
+#line 8750 "parser.cpp"
     break;
 
-  case 468: /* constant_expr: DATE STRING  */
-#line 3609 "parser.y"
+  case 469: /* constant_expr: DATE STRING  */
+#line 3619 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8734 "parser.cpp"
+#line 8760 "parser.cpp"
     break;
 
-  case 469: /* constant_expr: TIME STRING  */
-#line 3614 "parser.y"
+  case 470: /* constant_expr: TIME STRING  */
+#line 3624 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8744 "parser.cpp"
+#line 8770 "parser.cpp"
     break;
 
-  case 470: /* constant_expr: DATETIME STRING  */
-#line 3619 "parser.y"
+  case 471: /* constant_expr: DATETIME STRING  */
+#line 3629 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8754 "parser.cpp"
+#line 8780 "parser.cpp"
     break;
 
-  case 471: /* constant_expr: TIMESTAMP STRING  */
-#line 3624 "parser.y"
+  case 472: /* constant_expr: TIMESTAMP STRING  */
+#line 3634 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8764 "parser.cpp"
+#line 8790 "parser.cpp"
     break;
 
-  case 472: /* constant_expr: INTERVAL interval_expr  */
-#line 3629 "parser.y"
+  case 473: /* constant_expr: INTERVAL interval_expr  */
+#line 3639 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8772 "parser.cpp"
+#line 8798 "parser.cpp"
     break;
 
-  case 473: /* constant_expr: interval_expr  */
-#line 3632 "parser.y"
+  case 474: /* constant_expr: interval_expr  */
+#line 3642 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8780 "parser.cpp"
+#line 8806 "parser.cpp"
     break;
 
-  case 474: /* constant_expr: common_array_expr  */
-#line 3635 "parser.y"
+  case 475: /* constant_expr: common_array_expr  */
+#line 3645 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8788 "parser.cpp"
+#line 8814 "parser.cpp"
     break;
 
-  case 475: /* constant_expr: curly_brackets_expr  */
-#line 3638 "parser.y"
+  case 476: /* constant_expr: curly_brackets_expr  */
+#line 3648 "parser.y"
                       {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8796 "parser.cpp"
+#line 8822 "parser.cpp"
     break;
 
-  case 476: /* common_array_expr: array_expr  */
-#line 3642 "parser.y"
+  case 477: /* common_array_expr: array_expr  */
+#line 3652 "parser.y"
                               {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8804 "parser.cpp"
+#line 8830 "parser.cpp"
     break;
 
-  case 477: /* common_array_expr: subarray_array_expr  */
-#line 3645 "parser.y"
+  case 478: /* common_array_expr: subarray_array_expr  */
+#line 3655 "parser.y"
                       {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8812 "parser.cpp"
+#line 8838 "parser.cpp"
     break;
 
-  case 478: /* common_array_expr: sparse_array_expr  */
-#line 3648 "parser.y"
+  case 479: /* common_array_expr: sparse_array_expr  */
+#line 3658 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8820 "parser.cpp"
+#line 8846 "parser.cpp"
     break;
 
-  case 479: /* common_array_expr: empty_array_expr  */
-#line 3651 "parser.y"
+  case 480: /* common_array_expr: empty_array_expr  */
+#line 3661 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8828 "parser.cpp"
+#line 8854 "parser.cpp"
     break;
 
-  case 480: /* common_sparse_array_expr: sparse_array_expr  */
-#line 3655 "parser.y"
+  case 481: /* common_sparse_array_expr: sparse_array_expr  */
+#line 3665 "parser.y"
                                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8836 "parser.cpp"
+#line 8862 "parser.cpp"
     break;
 
-  case 481: /* common_sparse_array_expr: array_expr  */
-#line 3658 "parser.y"
+  case 482: /* common_sparse_array_expr: array_expr  */
+#line 3668 "parser.y"
              {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8844 "parser.cpp"
+#line 8870 "parser.cpp"
     break;
 
-  case 482: /* common_sparse_array_expr: empty_array_expr  */
-#line 3661 "parser.y"
+  case 483: /* common_sparse_array_expr: empty_array_expr  */
+#line 3671 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8852 "parser.cpp"
+#line 8878 "parser.cpp"
     break;
 
-  case 483: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
-#line 3665 "parser.y"
+  case 484: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
+#line 3675 "parser.y"
                                                       {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8860 "parser.cpp"
+#line 8886 "parser.cpp"
     break;
 
-  case 484: /* unclosed_subarray_array_expr: '[' common_array_expr  */
-#line 3669 "parser.y"
+  case 485: /* unclosed_subarray_array_expr: '[' common_array_expr  */
+#line 3679 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kSubArrayArray);
     const_expr->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = const_expr;
 }
-#line 8870 "parser.cpp"
+#line 8896 "parser.cpp"
     break;
 
-  case 485: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
-#line 3674 "parser.y"
+  case 486: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
+#line 3684 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8879 "parser.cpp"
+#line 8905 "parser.cpp"
     break;
 
-  case 486: /* sparse_array_expr: long_sparse_array_expr  */
-#line 3679 "parser.y"
+  case 487: /* sparse_array_expr: long_sparse_array_expr  */
+#line 3689 "parser.y"
                                           {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8887 "parser.cpp"
+#line 8913 "parser.cpp"
     break;
 
-  case 487: /* sparse_array_expr: double_sparse_array_expr  */
-#line 3682 "parser.y"
+  case 488: /* sparse_array_expr: double_sparse_array_expr  */
+#line 3692 "parser.y"
                            {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8895 "parser.cpp"
+#line 8921 "parser.cpp"
     break;
 
-  case 488: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
-#line 3686 "parser.y"
+  case 489: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
+#line 3696 "parser.y"
                                                             {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8903 "parser.cpp"
+#line 8929 "parser.cpp"
     break;
 
-  case 489: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
-#line 3690 "parser.y"
+  case 490: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
+#line 3700 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kLongSparseArray);
     const_expr->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
@@ -8911,30 +8937,30 @@ Return4:
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8915 "parser.cpp"
+#line 8941 "parser.cpp"
     break;
 
-  case 490: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
-#line 3697 "parser.y"
+  case 491: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
+#line 3707 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->long_sparse_array_.second.emplace_back((yyvsp[0].int_sparse_ele_t)->second);
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8926 "parser.cpp"
+#line 8952 "parser.cpp"
     break;
 
-  case 491: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
-#line 3704 "parser.y"
+  case 492: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
+#line 3714 "parser.y"
                                                                 {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8934 "parser.cpp"
+#line 8960 "parser.cpp"
     break;
 
-  case 492: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
-#line 3708 "parser.y"
+  case 493: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
+#line 3718 "parser.y"
                                                         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleSparseArray);
     const_expr->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
@@ -8942,300 +8968,300 @@ Return4:
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8946 "parser.cpp"
+#line 8972 "parser.cpp"
     break;
 
-  case 493: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
-#line 3715 "parser.y"
+  case 494: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
+#line 3725 "parser.y"
                                                          {
     (yyvsp[-2].const_expr_t)->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->double_sparse_array_.second.emplace_back((yyvsp[0].float_sparse_ele_t)->second);
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8957 "parser.cpp"
+#line 8983 "parser.cpp"
     break;
 
-  case 494: /* empty_array_expr: '[' ']'  */
-#line 3722 "parser.y"
+  case 495: /* empty_array_expr: '[' ']'  */
+#line 3732 "parser.y"
                           {
     (yyval.const_expr_t) = new infinity::ConstantExpr(infinity::LiteralType::kEmptyArray);
 }
-#line 8965 "parser.cpp"
+#line 8991 "parser.cpp"
     break;
 
-  case 495: /* curly_brackets_expr: unclosed_curly_brackets_expr '}'  */
-#line 3726 "parser.y"
+  case 496: /* curly_brackets_expr: unclosed_curly_brackets_expr '}'  */
+#line 3736 "parser.y"
                                                       {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8973 "parser.cpp"
+#line 8999 "parser.cpp"
     break;
 
-  case 496: /* curly_brackets_expr: '{' '}'  */
-#line 3729 "parser.y"
+  case 497: /* curly_brackets_expr: '{' '}'  */
+#line 3739 "parser.y"
           {
     (yyval.const_expr_t) = new infinity::ConstantExpr(infinity::LiteralType::kCurlyBracketsArray);
 }
-#line 8981 "parser.cpp"
+#line 9007 "parser.cpp"
     break;
 
-  case 497: /* unclosed_curly_brackets_expr: '{' constant_expr  */
-#line 3733 "parser.y"
+  case 498: /* unclosed_curly_brackets_expr: '{' constant_expr  */
+#line 3743 "parser.y"
                                                 {
     (yyval.const_expr_t) = new infinity::ConstantExpr(infinity::LiteralType::kCurlyBracketsArray);
     (yyval.const_expr_t)->curly_brackets_array_.emplace_back((yyvsp[0].const_expr_t));
 }
-#line 8990 "parser.cpp"
+#line 9016 "parser.cpp"
     break;
 
-  case 498: /* unclosed_curly_brackets_expr: unclosed_curly_brackets_expr ',' constant_expr  */
-#line 3737 "parser.y"
+  case 499: /* unclosed_curly_brackets_expr: unclosed_curly_brackets_expr ',' constant_expr  */
+#line 3747 "parser.y"
                                                  {
     (yyvsp[-2].const_expr_t)->curly_brackets_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8999 "parser.cpp"
+#line 9025 "parser.cpp"
     break;
 
-  case 499: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
-#line 3742 "parser.y"
+  case 500: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
+#line 3752 "parser.y"
                                           {
     (yyval.int_sparse_ele_t) = new std::pair<int64_t, int64_t>{(yyvsp[-2].long_value), (yyvsp[0].long_value)};
 }
-#line 9007 "parser.cpp"
+#line 9033 "parser.cpp"
     break;
 
-  case 500: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
-#line 3746 "parser.y"
+  case 501: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
+#line 3756 "parser.y"
                                               {
     (yyval.float_sparse_ele_t) = new std::pair<int64_t, double>{(yyvsp[-2].long_value), (yyvsp[0].double_value)};
 }
-#line 9015 "parser.cpp"
+#line 9041 "parser.cpp"
     break;
 
-  case 501: /* array_expr: long_array_expr  */
-#line 3750 "parser.y"
+  case 502: /* array_expr: long_array_expr  */
+#line 3760 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 9023 "parser.cpp"
+#line 9049 "parser.cpp"
     break;
 
-  case 502: /* array_expr: double_array_expr  */
-#line 3753 "parser.y"
+  case 503: /* array_expr: double_array_expr  */
+#line 3763 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 9031 "parser.cpp"
+#line 9057 "parser.cpp"
     break;
 
-  case 503: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 3757 "parser.y"
+  case 504: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 3767 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 9039 "parser.cpp"
+#line 9065 "parser.cpp"
     break;
 
-  case 504: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 3761 "parser.y"
+  case 505: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 3771 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 9049 "parser.cpp"
+#line 9075 "parser.cpp"
     break;
 
-  case 505: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 3766 "parser.y"
+  case 506: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 3776 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 9058 "parser.cpp"
+#line 9084 "parser.cpp"
     break;
 
-  case 506: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 3771 "parser.y"
+  case 507: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 3781 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 9066 "parser.cpp"
+#line 9092 "parser.cpp"
     break;
 
-  case 507: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 3775 "parser.y"
+  case 508: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 3785 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 9076 "parser.cpp"
+#line 9102 "parser.cpp"
     break;
 
-  case 508: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 3780 "parser.y"
+  case 509: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 3790 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 9085 "parser.cpp"
+#line 9111 "parser.cpp"
     break;
 
-  case 509: /* interval_expr: LONG_VALUE SECONDS  */
-#line 3785 "parser.y"
+  case 510: /* interval_expr: LONG_VALUE SECONDS  */
+#line 3795 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9096 "parser.cpp"
+#line 9122 "parser.cpp"
     break;
 
-  case 510: /* interval_expr: LONG_VALUE SECOND  */
-#line 3791 "parser.y"
+  case 511: /* interval_expr: LONG_VALUE SECOND  */
+#line 3801 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9107 "parser.cpp"
+#line 9133 "parser.cpp"
     break;
 
-  case 511: /* interval_expr: LONG_VALUE MINUTES  */
-#line 3797 "parser.y"
+  case 512: /* interval_expr: LONG_VALUE MINUTES  */
+#line 3807 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9118 "parser.cpp"
+#line 9144 "parser.cpp"
     break;
 
-  case 512: /* interval_expr: LONG_VALUE MINUTE  */
-#line 3803 "parser.y"
+  case 513: /* interval_expr: LONG_VALUE MINUTE  */
+#line 3813 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9129 "parser.cpp"
+#line 9155 "parser.cpp"
     break;
 
-  case 513: /* interval_expr: LONG_VALUE HOURS  */
-#line 3809 "parser.y"
+  case 514: /* interval_expr: LONG_VALUE HOURS  */
+#line 3819 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9140 "parser.cpp"
+#line 9166 "parser.cpp"
     break;
 
-  case 514: /* interval_expr: LONG_VALUE HOUR  */
-#line 3815 "parser.y"
+  case 515: /* interval_expr: LONG_VALUE HOUR  */
+#line 3825 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9151 "parser.cpp"
+#line 9177 "parser.cpp"
     break;
 
-  case 515: /* interval_expr: LONG_VALUE DAYS  */
-#line 3821 "parser.y"
+  case 516: /* interval_expr: LONG_VALUE DAYS  */
+#line 3831 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9162 "parser.cpp"
+#line 9188 "parser.cpp"
     break;
 
-  case 516: /* interval_expr: LONG_VALUE DAY  */
-#line 3827 "parser.y"
+  case 517: /* interval_expr: LONG_VALUE DAY  */
+#line 3837 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9173 "parser.cpp"
+#line 9199 "parser.cpp"
     break;
 
-  case 517: /* interval_expr: LONG_VALUE MONTHS  */
-#line 3833 "parser.y"
+  case 518: /* interval_expr: LONG_VALUE MONTHS  */
+#line 3843 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9184 "parser.cpp"
+#line 9210 "parser.cpp"
     break;
 
-  case 518: /* interval_expr: LONG_VALUE MONTH  */
-#line 3839 "parser.y"
+  case 519: /* interval_expr: LONG_VALUE MONTH  */
+#line 3849 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9195 "parser.cpp"
+#line 9221 "parser.cpp"
     break;
 
-  case 519: /* interval_expr: LONG_VALUE YEARS  */
-#line 3845 "parser.y"
+  case 520: /* interval_expr: LONG_VALUE YEARS  */
+#line 3855 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9206 "parser.cpp"
+#line 9232 "parser.cpp"
     break;
 
-  case 520: /* interval_expr: LONG_VALUE YEAR  */
-#line 3851 "parser.y"
+  case 521: /* interval_expr: LONG_VALUE YEAR  */
+#line 3861 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 9217 "parser.cpp"
+#line 9243 "parser.cpp"
     break;
 
-  case 521: /* copy_option_list: copy_option  */
-#line 3862 "parser.y"
+  case 522: /* copy_option_list: copy_option  */
+#line 3872 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 9226 "parser.cpp"
+#line 9252 "parser.cpp"
     break;
 
-  case 522: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 3866 "parser.y"
+  case 523: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 3876 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 9235 "parser.cpp"
+#line 9261 "parser.cpp"
     break;
 
-  case 523: /* copy_option: FORMAT IDENTIFIER  */
-#line 3871 "parser.y"
+  case 524: /* copy_option: FORMAT IDENTIFIER  */
+#line 3881 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -9267,11 +9293,11 @@ Return4:
         YYERROR;
     }
 }
-#line 9271 "parser.cpp"
+#line 9297 "parser.cpp"
     break;
 
-  case 524: /* copy_option: DELIMITER STRING  */
-#line 3902 "parser.y"
+  case 525: /* copy_option: DELIMITER STRING  */
+#line 3912 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -9282,83 +9308,83 @@ Return4:
     }
     free((yyvsp[0].str_value));
 }
-#line 9286 "parser.cpp"
+#line 9312 "parser.cpp"
     break;
 
-  case 525: /* copy_option: HEADER  */
-#line 3912 "parser.y"
+  case 526: /* copy_option: HEADER  */
+#line 3922 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 9296 "parser.cpp"
+#line 9322 "parser.cpp"
     break;
 
-  case 526: /* copy_option: OFFSET LONG_VALUE  */
-#line 3917 "parser.y"
+  case 527: /* copy_option: OFFSET LONG_VALUE  */
+#line 3927 "parser.y"
                     {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kOffset;
     (yyval.copy_option_t)->offset_ = (yyvsp[0].long_value);
 }
-#line 9306 "parser.cpp"
+#line 9332 "parser.cpp"
     break;
 
-  case 527: /* copy_option: LIMIT LONG_VALUE  */
-#line 3922 "parser.y"
+  case 528: /* copy_option: LIMIT LONG_VALUE  */
+#line 3932 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kLimit;
     (yyval.copy_option_t)->limit_ = (yyvsp[0].long_value);
 }
-#line 9316 "parser.cpp"
+#line 9342 "parser.cpp"
     break;
 
-  case 528: /* copy_option: ROWLIMIT LONG_VALUE  */
-#line 3927 "parser.y"
+  case 529: /* copy_option: ROWLIMIT LONG_VALUE  */
+#line 3937 "parser.y"
                       {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kRowLimit;
     (yyval.copy_option_t)->row_limit_ = (yyvsp[0].long_value);
 }
-#line 9326 "parser.cpp"
+#line 9352 "parser.cpp"
     break;
 
-  case 529: /* file_path: STRING  */
-#line 3933 "parser.y"
+  case 530: /* file_path: STRING  */
+#line 3943 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 9334 "parser.cpp"
+#line 9360 "parser.cpp"
     break;
 
-  case 530: /* if_exists: IF EXISTS  */
-#line 3937 "parser.y"
+  case 531: /* if_exists: IF EXISTS  */
+#line 3947 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 9340 "parser.cpp"
+#line 9366 "parser.cpp"
     break;
 
-  case 531: /* if_exists: %empty  */
-#line 3938 "parser.y"
+  case 532: /* if_exists: %empty  */
+#line 3948 "parser.y"
   { (yyval.bool_value) = false; }
-#line 9346 "parser.cpp"
+#line 9372 "parser.cpp"
     break;
 
-  case 532: /* if_not_exists: IF NOT EXISTS  */
-#line 3940 "parser.y"
+  case 533: /* if_not_exists: IF NOT EXISTS  */
+#line 3950 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 9352 "parser.cpp"
+#line 9378 "parser.cpp"
     break;
 
-  case 533: /* if_not_exists: %empty  */
-#line 3941 "parser.y"
+  case 534: /* if_not_exists: %empty  */
+#line 3951 "parser.y"
   { (yyval.bool_value) = false; }
-#line 9358 "parser.cpp"
+#line 9384 "parser.cpp"
     break;
 
-  case 536: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 3956 "parser.y"
+  case 537: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 3966 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -9367,80 +9393,80 @@ Return4:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 9371 "parser.cpp"
+#line 9397 "parser.cpp"
     break;
 
-  case 537: /* if_not_exists_info: %empty  */
-#line 3964 "parser.y"
+  case 538: /* if_not_exists_info: %empty  */
+#line 3974 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 9379 "parser.cpp"
+#line 9405 "parser.cpp"
     break;
 
-  case 538: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 3968 "parser.y"
+  case 539: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 3978 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 9387 "parser.cpp"
+#line 9413 "parser.cpp"
     break;
 
-  case 539: /* with_index_param_list: %empty  */
-#line 3971 "parser.y"
+  case 540: /* with_index_param_list: %empty  */
+#line 3981 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 9395 "parser.cpp"
+#line 9421 "parser.cpp"
     break;
 
-  case 540: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
-#line 3975 "parser.y"
+  case 541: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
+#line 3985 "parser.y"
                                                                      {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 9403 "parser.cpp"
+#line 9429 "parser.cpp"
     break;
 
-  case 541: /* optional_table_properties_list: %empty  */
-#line 3978 "parser.y"
+  case 542: /* optional_table_properties_list: %empty  */
+#line 3988 "parser.y"
   {
     (yyval.with_index_param_list_t) = nullptr;
 }
-#line 9411 "parser.cpp"
+#line 9437 "parser.cpp"
     break;
 
-  case 542: /* index_param_list: index_param  */
-#line 3982 "parser.y"
+  case 543: /* index_param_list: index_param  */
+#line 3992 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 9420 "parser.cpp"
+#line 9446 "parser.cpp"
     break;
 
-  case 543: /* index_param_list: index_param_list ',' index_param  */
-#line 3986 "parser.y"
+  case 544: /* index_param_list: index_param_list ',' index_param  */
+#line 3996 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 9429 "parser.cpp"
+#line 9455 "parser.cpp"
     break;
 
-  case 544: /* index_param: IDENTIFIER  */
-#line 3991 "parser.y"
+  case 545: /* index_param: IDENTIFIER  */
+#line 4001 "parser.y"
                          {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 9440 "parser.cpp"
+#line 9466 "parser.cpp"
     break;
 
-  case 545: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 3997 "parser.y"
+  case 546: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 4007 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -9451,11 +9477,11 @@ Return4:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 9455 "parser.cpp"
+#line 9481 "parser.cpp"
     break;
 
-  case 546: /* index_param: IDENTIFIER '=' STRING  */
-#line 4007 "parser.y"
+  case 547: /* index_param: IDENTIFIER '=' STRING  */
+#line 4017 "parser.y"
                         {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -9466,11 +9492,11 @@ Return4:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 9470 "parser.cpp"
+#line 9496 "parser.cpp"
     break;
 
-  case 547: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 4017 "parser.y"
+  case 548: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 4027 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
@@ -9479,11 +9505,11 @@ Return4:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 9483 "parser.cpp"
+#line 9509 "parser.cpp"
     break;
 
-  case 548: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 4025 "parser.y"
+  case 549: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 4035 "parser.y"
                               {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
@@ -9492,11 +9518,11 @@ Return4:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 9496 "parser.cpp"
+#line 9522 "parser.cpp"
     break;
 
-  case 549: /* index_info: '(' IDENTIFIER ')' USING IDENTIFIER with_index_param_list  */
-#line 4036 "parser.y"
+  case 550: /* index_info: '(' IDENTIFIER ')' USING IDENTIFIER with_index_param_list  */
+#line 4046 "parser.y"
                                                                        {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -9528,22 +9554,22 @@ Return4:
     (yyval.index_info_t)->index_param_list_ = (yyvsp[0].with_index_param_list_t);
     free((yyvsp[-4].str_value));
 }
-#line 9532 "parser.cpp"
+#line 9558 "parser.cpp"
     break;
 
-  case 550: /* index_info: '(' IDENTIFIER ')'  */
-#line 4067 "parser.y"
+  case 551: /* index_info: '(' IDENTIFIER ')'  */
+#line 4077 "parser.y"
                      {
     (yyval.index_info_t) = new infinity::IndexInfo();
     (yyval.index_info_t)->index_type_ = infinity::IndexType::kSecondary;
     (yyval.index_info_t)->column_name_ = (yyvsp[-1].str_value);
     free((yyvsp[-1].str_value));
 }
-#line 9543 "parser.cpp"
+#line 9569 "parser.cpp"
     break;
 
 
-#line 9547 "parser.cpp"
+#line 9573 "parser.cpp"
 
       default: break;
     }
@@ -9772,7 +9798,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 4074 "parser.y"
+#line 4084 "parser.y"
 
 
 void
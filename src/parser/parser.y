@@ -2753,6 +2753,16 @@ operand: '(' expr ')' {
 | constant_expr {
     $$ = $1;
 }
+| '?' {
+    // Parameter placeholder of a prepared statement, the value is filled in on bind.
+    if(!result->allow_parameters_) {
+        yyerror(&yyloc, scanner, result, "Parameter placeholder is only allowed in prepared statements");
+        YYERROR;
+    }
+    infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kNull);
+    result->parameters_.emplace_back(const_expr);
+    $$ = const_expr;
+}
 | column_expr
 | function_expr
 | case_expr
@@ -20,6 +20,8 @@
 
 namespace infinity {
 
+class ConstantExpr;
+
 class ParserResult {
 public:
     ~ParserResult();
@@ -38,12 +40,17 @@ public:
             delete statements_ptr_;
             statements_ptr_ = nullptr;
         }
+        parameters_.clear();
         error_message_.clear();
         error_line_ = 0;
         error_position_ = 0;
     }
 
     std::vector<BaseStatement *> *statements_ptr_;
+    // '?' placeholders in the order they appear in the query, owned by the statements
+    std::vector<ConstantExpr *> parameters_{};
+    // Set by the prepared statement path before parsing, otherwise '?' is a syntax error. Kept across Reset().
+    bool allow_parameters_{false};
     std::string error_message_;
     size_t error_line_;
     size_t error_position_;
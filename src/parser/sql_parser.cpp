@@ -38,6 +38,8 @@ void SQLParser::Parse(const std::string &sql_text, ParserResult *result) {
     result->Reset();
     if (sqlparse(scanner_, result)) {
         std::cerr << "Parse error: " << sql_text << std::endl;
+        // placeholders were released along with the partial statements
+        result->parameters_.clear();
     }
 
     sql_delete_buffer(state_, scanner_);
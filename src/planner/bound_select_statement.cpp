@@ -61,6 +61,7 @@ import logical_fusion;
 import logical_unnest;
 
 import subquery_unnest;
+import subquery_expr;
 
 import infinity_exception;
 import expression_transformer;
@@ -87,6 +88,7 @@ import status;
 import default_values;
 import parse_fulltext_options;
 import highlighter;
+import term_automaton;
 import data_type;
 import internal_types;
 import new_txn;
@@ -104,6 +106,10 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
             root = unnest;
         }
 
+        if (!where_conditions_.empty()) {
+            BuildSemiJoin(root, where_conditions_, query_context);
+        }
+
         if (!where_conditions_.empty()) {
             SharedPtr<LogicalNode> filter = BuildFilter(root, where_conditions_, query_context, bind_context);
             filter->set_left_node(root);
@@ -270,6 +276,19 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
                         match_node->top_n_ = DEFAULT_MATCH_TEXT_OPTION_TOP_N;
                     }
 
+                    // option: partition_min_rows
+                    iter = search_ops.options_.find("partition_min_rows");
+                    if (iter != search_ops.options_.end()) {
+                        i64 partition_min_rows_option = std::strtol(iter->second.c_str(), nullptr, 0);
+                        if (partition_min_rows_option <= 0) {
+                            Status status = Status::SyntaxError("partition_min_rows must be a positive integer");
+                            RecoverableError(status);
+                        }
+                        match_node->partition_min_row_count_ = partition_min_rows_option;
+                    } else {
+                        match_node->partition_min_row_count_ = DEFAULT_MATCH_PARTITION_MIN_ROW_COUNT;
+                    }
+
                     auto query_operator_option = FulltextQueryOperatorOption::kInfinitySyntax;
                     // option: operator
                     if (iter = search_ops.options_.find("operator"); iter != search_ops.options_.end()) {
@@ -360,6 +379,8 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
                     if (!highlight_columns_.empty()) {
                         Vector<String> columns, terms;
                         query_tree->GetQueryColumnsTerms(columns, terms);
+                        Vector<SharedPtr<TermAutomaton>> term_automata;
+                        query_tree->GetQueryTermAutomata(term_automata);
 
                         // Deduplicate columns
                         std::sort(columns.begin(), columns.end());
@@ -369,6 +390,9 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
                             for (auto &[highlight_column_id, highlight_info] : highlight_columns_) {
                                 if (column_name == projection_expressions_[highlight_column_id]->Name()) {
                                     highlight_info->query_terms_.insert(highlight_info->query_terms_.end(), terms.begin(), terms.end());
+                                    highlight_info->query_term_automata_.insert(highlight_info->query_term_automata_.end(),
+                                                                                term_automata.begin(),
+                                                                                term_automata.end());
                                     const auto &it = column2analyzer.find(column_name);
                                     if (it == column2analyzer.end()) {
                                         highlight_info->analyzer_ = "standard";
@@ -635,6 +659,31 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildFilter(SharedPtr<LogicalNode>
     return filter;
 }
 
+void BoundSelectStatement::BuildSemiJoin(SharedPtr<LogicalNode> &root,
+                                         Vector<SharedPtr<BaseExpression>> &conditions,
+                                         QueryContext *query_context) {
+    // A conjunct `expr IN (uncorrelated subquery)` only keeps the rows with a match: join it with a semi join instead of
+    // filtering on a mark column.
+    for (auto iter = conditions.begin(); iter != conditions.end();) {
+        const SharedPtr<BaseExpression> &condition = *iter;
+        if (condition->type() != ExpressionType::kSubQuery) {
+            ++iter;
+            continue;
+        }
+        auto *subquery_expr_ptr = static_cast<SubqueryExpression *>(condition.get());
+        const auto &subquery_bind_context = subquery_expr_ptr->bound_select_statement_ptr_->bind_context_;
+        if (subquery_expr_ptr->subquery_type_ != SubqueryType::kIn || subquery_bind_context->HasCorrelatedColumn()) {
+            ++iter;
+            continue;
+        }
+        building_subquery_ = true;
+        SharedPtr<LogicalNode> subquery_plan = subquery_expr_ptr->bound_select_statement_ptr_->BuildPlan(query_context);
+        SubqueryUnnest::UnnestUncorrelatedInAsSemiJoin(subquery_expr_ptr, root, subquery_plan, query_context, subquery_bind_context);
+        building_subquery_ = false;
+        iter = conditions.erase(iter);
+    }
+}
+
 SharedPtr<LogicalNode> BoundSelectStatement::BuildUnnest(SharedPtr<LogicalNode> &root,
                                                          Vector<SharedPtr<BaseExpression>> &expressions,
                                                          QueryContext *query_context,
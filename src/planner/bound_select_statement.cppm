@@ -67,6 +67,8 @@ public:
                                        QueryContext *query_context,
                                        const SharedPtr<BindContext> &bind_context);
 
+    void BuildSemiJoin(SharedPtr<LogicalNode> &root, Vector<SharedPtr<BaseExpression>> &conditions, QueryContext *query_context);
+
     SharedPtr<LogicalNode> BuildUnnest(SharedPtr<LogicalNode> &root,
                                        Vector<SharedPtr<BaseExpression>> &expressions,
                                        QueryContext *query_context,
@@ -22,16 +22,29 @@ import base_expression;
 import logical_node_type;
 import logical_match;
 import physical_match;
+import search_options;
 
 namespace infinity {
 
+namespace {
+
+String OptionsIgnoreTopN(const String &options_text) {
+    SearchOptions search_options(options_text);
+    search_options.options_.erase("topn");
+    return search_options.ToString();
+}
+
+} // namespace
+
 CachedMatch::CachedMatch(TxnTimeStamp query_ts, LogicalMatch *logical_match)
     : CachedScanBase(LogicalNodeType::kMatch, logical_match->base_table_ref_.get(), query_ts, logical_match->GetOutputNames()),
-      match_expr_(logical_match->match_expr_), filter_expression_(logical_match->filter_expression_), topn_(logical_match->top_n_) {}
+      match_expr_(logical_match->match_expr_), filter_expression_(logical_match->filter_expression_), topn_(logical_match->top_n_),
+      options_ignore_topn_(OptionsIgnoreTopN(match_expr_->options_text_)) {}
 
 CachedMatch::CachedMatch(TxnTimeStamp query_ts, PhysicalMatch *physical_match)
     : CachedScanBase(LogicalNodeType::kMatch, physical_match->base_table_ref().get(), query_ts, physical_match->GetOutputNames()),
-      match_expr_(physical_match->match_expr()), filter_expression_(physical_match->filter_expression()), topn_(physical_match->top_n()) {}
+      match_expr_(physical_match->match_expr()), filter_expression_(physical_match->filter_expression()), topn_(physical_match->top_n()),
+      options_ignore_topn_(OptionsIgnoreTopN(match_expr_->options_text_)) {}
 
 u64 CachedMatch::Hash() const {
     u64 h = CachedScanBase::Hash();
@@ -57,6 +70,36 @@ bool CachedMatch::Eq(const CachedNodeBase &other_base) const {
     if (topn_ != other.topn_) {
         return false;
     }
+    return EqFilter(other);
+}
+
+u64 CachedMatch::HashIgnoreTopN() const {
+    u64 h = CachedScanBase::Hash();
+    h ^= std::hash<String>()(match_expr_->fields_);
+    h ^= std::hash<String>()(match_expr_->matching_text_);
+    h ^= std::hash<String>()(options_ignore_topn_);
+    if (filter_expression_) {
+        h ^= filter_expression_->Hash();
+    }
+    return h;
+}
+
+bool CachedMatch::EqIgnoreTopN(const CachedNodeBase &other_base) const {
+    if (type() != other_base.type()) {
+        return false;
+    }
+    const auto &other = static_cast<const CachedMatch &>(other_base);
+    if (!CachedScanBase::Eq(other)) {
+        return false;
+    }
+    if (match_expr_->fields_ != other.match_expr_->fields_ || match_expr_->matching_text_ != other.match_expr_->matching_text_ ||
+        options_ignore_topn_ != other.options_ignore_topn_ || match_expr_->index_names_ != other.match_expr_->index_names_) {
+        return false;
+    }
+    return EqFilter(other);
+}
+
+bool CachedMatch::EqFilter(const CachedMatch &other) const {
     if (filter_expression_ && other.filter_expression_) {
         return filter_expression_->Eq(*other.filter_expression_);
     }
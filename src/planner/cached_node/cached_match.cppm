@@ -39,10 +39,21 @@ public:
 
     bool Eq(const CachedNodeBase &other) const override;
 
+    SizeT TopN() const override { return topn_; }
+
+    u64 HashIgnoreTopN() const override;
+
+    bool EqIgnoreTopN(const CachedNodeBase &other) const override;
+
+private:
+    bool EqFilter(const CachedMatch &other) const;
+
 private:
     SharedPtr<MatchExpression> match_expr_{};
     SharedPtr<BaseExpression> filter_expression_{};
     u32 topn_;
+    // search options of match_expr_ without the topn option
+    String options_ignore_topn_;
 };
 
 } // namespace infinity
@@ -26,6 +26,8 @@ import physical_match_tensor_scan;
 import physical_merge_knn;
 import physical_merge_match_sparse;
 import physical_merge_match_tensor;
+import knn_expression;
+import match_sparse_expression;
 
 namespace infinity {
 
@@ -61,15 +63,28 @@ CachedMatchScanBase::CachedMatchScanBase(TxnTimeStamp query_ts, const PhysicalMe
       query_expression_(physical_merge_match_tensor->match_tensor_expr()), filter_expression_(physical_merge_match_tensor->filter_expression()) {}
 
 u64 CachedMatchScanBase::Hash() const {
-    u64 h = CachedScanBase::Hash();
+    u64 h = HashIgnoreQuery();
     h ^= query_expression_->Hash();
+    return h;
+}
+
+bool CachedMatchScanBase::Eq(const CachedNodeBase &other_base) const {
+    if (!EqIgnoreQuery(other_base)) {
+        return false;
+    }
+    const auto &other = static_cast<const CachedMatchScanBase &>(other_base);
+    return query_expression_->Eq(*other.query_expression_);
+}
+
+u64 CachedMatchScanBase::HashIgnoreQuery() const {
+    u64 h = CachedScanBase::Hash();
     if (filter_expression_) {
         h ^= filter_expression_->Hash();
     }
     return h;
 }
 
-bool CachedMatchScanBase::Eq(const CachedNodeBase &other_base) const {
+bool CachedMatchScanBase::EqIgnoreQuery(const CachedNodeBase &other_base) const {
     if (type() != other_base.type()) {
         return false;
     }
@@ -77,9 +92,6 @@ bool CachedMatchScanBase::Eq(const CachedNodeBase &other_base) const {
     if (!CachedScanBase::Eq(other)) {
         return false;
     }
-    if (!query_expression_->Eq(*other.query_expression_)) {
-        return false;
-    }
     if (filter_expression_ && other.filter_expression_) {
         return filter_expression_->Eq(*other.filter_expression_);
     }
@@ -101,6 +113,23 @@ CachedKnnScan::CachedKnnScan(TxnTimeStamp query_ts, const PhysicalMergeKnn *phys
     expr->query_embedding_.Own(expr->embedding_data_type_, expr->dimension_);
 }
 
+SizeT CachedKnnScan::TopN() const { return static_cast<const KnnExpression *>(query_expression())->topn_; }
+
+u64 CachedKnnScan::HashIgnoreTopN() const {
+    u64 h = HashIgnoreQuery();
+    h ^= static_cast<const KnnExpression *>(query_expression())->HashIgnoreTopN();
+    return h;
+}
+
+bool CachedKnnScan::EqIgnoreTopN(const CachedNodeBase &other) const {
+    if (!EqIgnoreQuery(other)) {
+        return false;
+    }
+    const auto *knn_expr = static_cast<const KnnExpression *>(query_expression());
+    const auto *other_knn_expr = static_cast<const KnnExpression *>(static_cast<const CachedKnnScan &>(other).query_expression());
+    return knn_expr->EqIgnoreTopN(*other_knn_expr);
+}
+
 CachedMatchSparseScan::CachedMatchSparseScan(TxnTimeStamp query_ts, const LogicalMatchSparseScan *logical_sparse_scan)
     : CachedMatchScanBase(query_ts, logical_sparse_scan) {}
 
@@ -110,6 +139,23 @@ CachedMatchSparseScan::CachedMatchSparseScan(TxnTimeStamp query_ts, const Physic
 CachedMatchSparseScan::CachedMatchSparseScan(TxnTimeStamp query_ts, const PhysicalMergeMatchSparse *physical_merge_match_sparse)
     : CachedMatchScanBase(query_ts, physical_merge_match_sparse) {}
 
+SizeT CachedMatchSparseScan::TopN() const { return static_cast<const MatchSparseExpression *>(query_expression())->topn_; }
+
+u64 CachedMatchSparseScan::HashIgnoreTopN() const {
+    u64 h = HashIgnoreQuery();
+    h ^= static_cast<const MatchSparseExpression *>(query_expression())->HashIgnoreTopN();
+    return h;
+}
+
+bool CachedMatchSparseScan::EqIgnoreTopN(const CachedNodeBase &other) const {
+    if (!EqIgnoreQuery(other)) {
+        return false;
+    }
+    const auto *sparse_expr = static_cast<const MatchSparseExpression *>(query_expression());
+    const auto *other_sparse_expr = static_cast<const MatchSparseExpression *>(static_cast<const CachedMatchSparseScan &>(other).query_expression());
+    return sparse_expr->EqIgnoreTopN(*other_sparse_expr);
+}
+
 CachedMatchTensorScan::CachedMatchTensorScan(TxnTimeStamp query_ts, const LogicalMatchTensorScan *logical_tensor_scan)
     : CachedMatchScanBase(query_ts, logical_tensor_scan), topn_(logical_tensor_scan->topn_), index_options_(logical_tensor_scan->index_options_) {}
 
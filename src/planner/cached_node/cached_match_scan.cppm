@@ -56,6 +56,12 @@ public:
 
     const BaseExpression *query_expression() const { return query_expression_.get(); }
 
+protected:
+    // Hash and equality of everything but the query expression.
+    u64 HashIgnoreQuery() const;
+
+    bool EqIgnoreQuery(const CachedNodeBase &other) const;
+
 private:
     SharedPtr<BaseExpression> query_expression_{};
     SharedPtr<BaseExpression> filter_expression_{};
@@ -68,6 +74,12 @@ public:
     CachedKnnScan(TxnTimeStamp query_ts, const PhysicalKnnScan *physical_knn_scan);
 
     CachedKnnScan(TxnTimeStamp query_ts, const PhysicalMergeKnn *physical_merge_knn);
+
+    SizeT TopN() const override;
+
+    u64 HashIgnoreTopN() const override;
+
+    bool EqIgnoreTopN(const CachedNodeBase &other) const override;
 };
 
 export class CachedMatchSparseScan final : public CachedMatchScanBase {
@@ -77,6 +89,12 @@ public:
     CachedMatchSparseScan(TxnTimeStamp query_ts, const PhysicalMatchSparseScan *physical_sparse_scan);
 
     CachedMatchSparseScan(TxnTimeStamp query_ts, const PhysicalMergeMatchSparse *physical_merge_match_sparse);
+
+    SizeT TopN() const override;
+
+    u64 HashIgnoreTopN() const override;
+
+    bool EqIgnoreTopN(const CachedNodeBase &other) const override;
 };
 
 export class CachedMatchTensorScan final : public CachedMatchScanBase {
@@ -35,6 +35,15 @@ public:
 
     virtual bool Eq(const CachedNodeBase &other) const { return type_ == other.type_; }
 
+    // Row count limit of a top n query whose result is ordered best first, 0 if the result is not limited.
+    virtual SizeT TopN() const { return 0; }
+
+    // Hash and equality without the top n. A cached result whose top n is not less than the one of an equal query answers
+    // it with its first rows.
+    virtual u64 HashIgnoreTopN() const { return Hash(); }
+
+    virtual bool EqIgnoreTopN(const CachedNodeBase &other) const { return Eq(other); }
+
     LogicalNodeType type() const { return type_; }
 
     SharedPtr<Vector<String>> output_names() const { return output_names_; }
@@ -37,6 +37,7 @@ public:
 
     const String &schema_name() const { return *schema_name_; }
     const String &table_name() const { return *table_name_; }
+    TxnTimeStamp query_ts() const { return query_ts_; }
 
 protected:
     SharedPtr<String> schema_name_{};
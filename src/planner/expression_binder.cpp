@@ -452,6 +452,7 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildFuncExpr(const FunctionExpr &ex
     CheckFuncType(function_set_ptr->type_);
 
     // Check if it is count(*)
+    bool count_star = false;
     if (function_set_ptr->name() == "COUNT") {
         if (!expr.arguments_ || expr.arguments_->empty()) {
             RecoverableError(Status::SyntaxError("No arguments for COUNT function found."));
@@ -464,6 +465,7 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildFuncExpr(const FunctionExpr &ex
                     TableInfo *table_info = bind_context_ptr->binding_by_name_[table_name]->table_info_.get();
                     col_expr->names_.clear();
                     col_expr->names_.emplace_back(table_info->GetColumnDefByID(0)->name_);
+                    count_star = true;
                 }
             }
         }
@@ -509,6 +511,7 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildFuncExpr(const FunctionExpr &ex
             auto aggregate_function_set_ptr = static_pointer_cast<AggregateFunctionSet>(function_set_ptr);
             AggregateFunction aggregate_function = aggregate_function_set_ptr->GetMostMatchFunction(arguments[0]);
             auto aggregate_function_ptr = MakeShared<AggregateExpression>(aggregate_function, arguments);
+            aggregate_function_ptr->count_star_ = count_star;
             return aggregate_function_ptr;
         }
         case FunctionType::kTable: {
@@ -567,7 +570,9 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr,
             // SharedPtr<BaseExpression> then_expr
             SharedPtr<BaseExpression> then_expr_ptr = BuildExpression(*(when_then_expr->then_), bind_context_ptr, depth, false);
             case_expression_ptr->AddCaseCheck(when_expr_ptr, then_expr_ptr);
-            return_type.MaxDataType(then_expr_ptr->Type());
+            if (then_expr_ptr->Type().type() != LogicalType::kNull) {
+                return_type.MaxDataType(then_expr_ptr->Type());
+            }
         }
     } else {
         // Searched case
@@ -580,17 +585,32 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr,
             // SharedPtr<BaseExpression> then_expr
             SharedPtr<BaseExpression> then_expr_ptr = BuildExpression(*(when_then_expr->then_), bind_context_ptr, depth, false);
             case_expression_ptr->AddCaseCheck(when_expr_ptr, then_expr_ptr);
-            return_type.MaxDataType(then_expr_ptr->Type());
+            if (then_expr_ptr->Type().type() != LogicalType::kNull) {
+                return_type.MaxDataType(then_expr_ptr->Type());
+            }
         }
     }
     // Construct else expression
     SharedPtr<BaseExpression> else_expr_ptr;
     if (expr.else_expr_ != nullptr) {
         else_expr_ptr = BuildExpression(*expr.else_expr_, bind_context_ptr, depth, false);
-        return_type.MaxDataType(else_expr_ptr->Type());
+        if (else_expr_ptr->Type().type() != LogicalType::kNull) {
+            return_type.MaxDataType(else_expr_ptr->Type());
+        }
     } else {
         else_expr_ptr = MakeShared<ValueExpression>(Value::MakeNull());
     }
+
+    // Every branch yields the return type, so the evaluator scatters the branch results without casting.
+    // NULL branches stay as they are and only set the null bits of the rows they take.
+    for (CaseCheck &case_check : case_expression_ptr->CaseExpr()) {
+        if (case_check.then_expr_->Type().type() != LogicalType::kNull) {
+            case_check.then_expr_ = CastExpression::AddCastToType(case_check.then_expr_, return_type);
+        }
+    }
+    if (else_expr_ptr->Type().type() != LogicalType::kNull) {
+        else_expr_ptr = CastExpression::AddCastToType(else_expr_ptr, return_type);
+    }
     case_expression_ptr->AddElseExpr(else_expr_ptr);
 
     case_expression_ptr->SetReturnType(return_type);
@@ -47,6 +47,10 @@ Vector<ColumnBinding> LogicalJoin::GetColumnBindings() const {
     Vector<ColumnBinding> left_binding = this->left_node_->GetColumnBindings();
     Vector<ColumnBinding> right_binding = this->right_node_->GetColumnBindings();
     result_binding.insert(result_binding.end(), left_binding.begin(), left_binding.end());
+    if (join_type_ == JoinType::kSemi) {
+        // Semi join only outputs the left side.
+        return result_binding;
+    }
     result_binding.insert(result_binding.end(), right_binding.begin(), right_binding.end());
     return result_binding;
 }
@@ -60,6 +64,9 @@ SharedPtr<Vector<String>> LogicalJoin::GetOutputNames() const {
         result->emplace_back(name_str);
     }
 
+    if (join_type_ == JoinType::kSemi) {
+        return result;
+    }
     for (auto &name_str : *right_output_names) {
         result->emplace_back(name_str);
     }
@@ -76,6 +83,9 @@ SharedPtr<Vector<SharedPtr<DataType>>> LogicalJoin::GetOutputTypes() const {
         result->emplace_back(name_str);
     }
 
+    if (join_type_ == JoinType::kSemi) {
+        return result;
+    }
     for (auto &name_str : *right_output_names) {
         result->emplace_back(name_str);
     }
@@ -70,6 +70,8 @@ public:
     f32 score_threshold_{};
     FulltextSimilarity ft_similarity_{FulltextSimilarity::kBM25};
     BM25Params bm25_params_;
+    // a table is split into partitions searched concurrently when each holds at least this many rows
+    SizeT partition_min_row_count_{};
 };
 
 } // namespace infinity
@@ -243,7 +243,8 @@ inline void RewriteCompareT(Varchar &right_val, FilterCompareType &compare_type)
             break;
         }
         case FilterCompareType::kGreater: {
-            right_val += std::numeric_limits<char>::lowest();
+            // strings are ordered by unsigned bytes, appending '\0' gives the smallest string after right_val
+            right_val += '\0';
             compare_type = FilterCompareType::kGreaterEqual;
             break;
         }
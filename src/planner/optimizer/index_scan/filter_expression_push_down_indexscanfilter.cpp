@@ -63,6 +63,14 @@ import kv_store;
 
 namespace infinity {
 
+// LIKE patterns answered by the secondary index: a literal value, or a literal prefix followed by '%'
+bool ParseLikePrefix(const String &pattern, String &prefix, bool &is_prefix) {
+    const SizeT wildcard_pos = pattern.find_first_of("%_");
+    prefix = pattern.substr(0, wildcard_pos);
+    is_prefix = wildcard_pos != String::npos;
+    return !is_prefix || pattern.find_first_not_of('%', wildcard_pos) == String::npos;
+}
+
 struct ExpressionIndexScanInfo {
     enum class Enum {
         // mysterious expr
@@ -166,6 +174,7 @@ struct ExpressionIndexScanInfo {
                 // 1. all value
                 // 2. and, or
                 // 3. col_index, val, >, <, >=, <=, =
+                // 4. varchar col_index like prefix pattern
                 { // 1.
                     bool all_value = true;
                     for (const auto &child : tree.children) {
@@ -214,28 +223,35 @@ struct ExpressionIndexScanInfo {
                         if (tree.children.size() != 2) {
                             UnrecoverableError("Function argument num != 2");
                         }
-                        auto check_column_value = [](const Enum col, const Enum val, const bool is_equal_func) -> bool {
+                        auto check_column_value = [](const Enum col, const Enum val) -> bool {
                             if (val != Enum::kValueExpr) {
                                 return false;
                             }
                             switch (col) {
-                                case Enum::kSecondaryIndexColumnExprOrAfterCast: {
-                                    return true;
-                                }
+                                case Enum::kSecondaryIndexColumnExprOrAfterCast:
                                 case Enum::kVarcharSecondaryIndexColumnExprOrAfterCast: {
-                                    return is_equal_func;
+                                    return true;
                                 }
                                 default: {
                                     return false;
                                 }
                             }
                         };
-                        if (const bool is_equal_func = (f_name == "=");
-                            check_column_value(tree.children[0].info, tree.children[1].info, is_equal_func)) {
+                        if (check_column_value(tree.children[0].info, tree.children[1].info)) {
                             tree.info = Enum::kSecondaryIndexValueCompareExpr;
-                        } else if (check_column_value(tree.children[1].info, tree.children[0].info, is_equal_func)) {
+                        } else if (check_column_value(tree.children[1].info, tree.children[0].info)) {
                             tree.info = Enum::kValueSecondaryIndexCompareExpr;
                         }
+                    } else if (f_name == "like") {
+                        if (tree.children.size() == 2 && tree.children[0].info == Enum::kVarcharSecondaryIndexColumnExprOrAfterCast &&
+                            tree.children[1].info == Enum::kValueExpr) {
+                            const auto pattern = FilterExpressionPushDownHelper::CalcValueResult(expression->arguments()[1]);
+                            String prefix;
+                            bool is_prefix = false;
+                            if (pattern.type().type() == LogicalType::kVarchar && ParseLikePrefix(pattern.GetVarchar(), prefix, is_prefix)) {
+                                tree.info = Enum::kSecondaryIndexValueCompareExpr;
+                            }
+                        }
                     }
                 }
                 break;
@@ -425,6 +441,25 @@ private:
             case Enum::kSecondaryIndexValueCompareExpr: {
                 auto *function_expression = static_cast<FunctionExpression *>(index_filter_tree_node.src_ptr->get());
                 auto const &f_name = function_expression->ScalarFunctionName();
+                if (f_name == "like") {
+                    const auto pattern = FilterExpressionPushDownHelper::CalcValueResult(function_expression->arguments()[1]);
+                    String prefix;
+                    bool is_prefix = false;
+                    if (!ParseLikePrefix(pattern.GetVarchar(), prefix, is_prefix)) {
+                        UnrecoverableError("Unsupported like pattern");
+                    }
+                    const auto *column_expression = static_cast<const ColumnExpression *>(function_expression->arguments()[0].get());
+                    const ColumnID column_id = column_expression->binding().column_idx;
+                    SharedPtr<TableIndexMeeta> secondary_index = tree_info_.new_candidate_column_index_map_.at(column_id);
+                    if (is_prefix) {
+                        return IndexFilterEvaluatorSecondary::MakeVarcharPrefix(function_expression, column_id, secondary_index, prefix);
+                    }
+                    return IndexFilterEvaluatorSecondary::Make(function_expression,
+                                                               column_id,
+                                                               secondary_index,
+                                                               FilterCompareType::kEqual,
+                                                               Value::MakeVarchar(prefix));
+                }
                 constexpr std::array PossibleFunctionNames{"<", ">", "<=", ">=", "="};
                 constexpr std::array PossibleCompareTypes{FilterCompareType::kLess,
                                                           FilterCompareType::kGreater,
@@ -444,10 +479,22 @@ private:
                                           SharedPtr<BaseExpression> &val_expr,
                                           FilterCompareType initial_compare_type) -> UniquePtr<IndexFilterEvaluator> {
                     auto val_right = FilterExpressionPushDownHelper::CalcValueResult(val_expr);
+                    // "<" on varchar can not be rewritten into an exact "<=", the index takes it as it is
+                    const bool varchar_less = initial_compare_type == FilterCompareType::kLess && val_right.type().type() == LogicalType::kVarchar;
+                    if (varchar_less) {
+                        if (val_right.GetVarchar().empty()) {
+                            return MakeUnique<IndexFilterEvaluatorAllFalse>();
+                        }
+                        initial_compare_type = FilterCompareType::kLessEqual;
+                    }
                     auto [column_id, value, compare_type] =
                         FilterExpressionPushDownHelper::UnwindCast(col_expr, std::move(val_right), initial_compare_type);
+                    if (varchar_less && compare_type == FilterCompareType::kLessEqual) {
+                        compare_type = FilterCompareType::kLess;
+                    }
                     switch (compare_type) {
                         case FilterCompareType::kEqual:
+                        case FilterCompareType::kLess:
                         case FilterCompareType::kLessEqual:
                         case FilterCompareType::kGreaterEqual: {
                             SharedPtr<TableIndexMeeta> secondary_index = tree_info_.new_candidate_column_index_map_.at(column_id);
@@ -271,16 +271,26 @@ UniquePtr<IndexFilterEvaluator> IndexFilterEvaluatorBuildFromOr(Vector<UniquePtr
     return result;
 }
 
+// Bounds of the ranges searched in the secondary index of a column type
 template <typename ColumnValueT>
-ConvertToOrderedType<ColumnValueT> GetOrderedV(const Value &val) {
-    return ConvertToOrderedKeyValue(val.GetValue<ColumnValueT>());
-}
+struct SecondaryIndexRange {
+    using KeyType = ConvertToOrderedType<ColumnValueT>;
+    static KeyType Lowest() { return std::numeric_limits<KeyType>::lowest(); }
+    static KeyType Max() { return std::numeric_limits<KeyType>::max(); }
+    static KeyType At(const Value &val) { return ConvertToOrderedKeyValue(val.GetValue<ColumnValueT>()); }
+};
 
+// varchar keys are not exact, varchar ranges are bounded by the values themselves
 template <>
-ConvertToOrderedType<VarcharT> GetOrderedV<VarcharT>(const Value &val) {
-    const String &str = val.GetVarchar();
-    return ConvertToOrderedKeyValue(static_cast<std::string_view>(str));
-}
+struct SecondaryIndexRange<VarcharT> {
+    using KeyType = VarcharRangeBound;
+    static KeyType Lowest() { return VarcharRangeBound::Lowest(); }
+    static KeyType Max() { return VarcharRangeBound::Max(); }
+    static KeyType At(const Value &val) { return VarcharRangeBound::At(val.GetVarchar()); }
+};
+
+template <typename ColumnValueT>
+using SecondaryIndexRangeKeyType = typename SecondaryIndexRange<ColumnValueT>::KeyType;
 
 // 1. secondary index
 // 2. filter_fulltext
@@ -290,7 +300,7 @@ ConvertToOrderedType<VarcharT> GetOrderedV<VarcharT>(const Value &val) {
 // [start, end] pairs
 template <typename ColumnValueT>
 struct IndexFilterEvaluatorSecondaryT final : IndexFilterEvaluatorSecondary {
-    using SecondaryIndexOrderedT = ConvertToOrderedType<ColumnValueT>;
+    using SecondaryIndexOrderedT = SecondaryIndexRangeKeyType<ColumnValueT>;
 
     Vector<Pair<SecondaryIndexOrderedT, SecondaryIndexOrderedT>> secondary_index_start_end_pairs_;
 
@@ -338,8 +348,8 @@ struct IndexFilterEvaluatorSecondaryT final : IndexFilterEvaluatorSecondary {
                 }
             }
             // final element
-            const auto full_range_v = Pair<SecondaryIndexOrderedT, SecondaryIndexOrderedT>{std::numeric_limits<SecondaryIndexOrderedT>::lowest(),
-                                                                                           std::numeric_limits<SecondaryIndexOrderedT>::max()};
+            const auto full_range_v =
+                Pair<SecondaryIndexOrderedT, SecondaryIndexOrderedT>{SecondaryIndexRange<ColumnValueT>::Lowest(), SecondaryIndexRange<ColumnValueT>::Max()};
             if (back_v != full_range_v) {
                 new_start_end_pairs.push_back(back_v);
             }
@@ -382,18 +392,27 @@ struct IndexFilterEvaluatorSecondaryT final : IndexFilterEvaluatorSecondary {
                                                           const Value &val) {
         constexpr auto expect_logical_type = GetLogicalType<ColumnValueT>;
         auto result = MakeUnique<IndexFilterEvaluatorSecondaryT>(src_expr, column_id, expect_logical_type, new_secondary_index);
-        const SecondaryIndexOrderedT val_ordered = GetOrderedV<ColumnValueT>(val);
+        const SecondaryIndexOrderedT val_ordered = SecondaryIndexRange<ColumnValueT>::At(val);
         switch (compare_type) {
             case FilterCompareType::kEqual: {
                 result->secondary_index_start_end_pairs_.emplace_back(val_ordered, val_ordered);
                 break;
             }
             case FilterCompareType::kGreaterEqual: {
-                result->secondary_index_start_end_pairs_.emplace_back(val_ordered, std::numeric_limits<SecondaryIndexOrderedT>::max());
+                result->secondary_index_start_end_pairs_.emplace_back(val_ordered, SecondaryIndexRange<ColumnValueT>::Max());
                 break;
             }
             case FilterCompareType::kLessEqual: {
-                result->secondary_index_start_end_pairs_.emplace_back(std::numeric_limits<SecondaryIndexOrderedT>::lowest(), val_ordered);
+                result->secondary_index_start_end_pairs_.emplace_back(SecondaryIndexRange<ColumnValueT>::Lowest(), val_ordered);
+                break;
+            }
+            case FilterCompareType::kLess: {
+                // other types have "<" rewritten into "<=", varchar has no previous value
+                if constexpr (std::is_same_v<ColumnValueT, VarcharT>) {
+                    result->secondary_index_start_end_pairs_.emplace_back(VarcharRangeBound::Lowest(), VarcharRangeBound::Before(val.GetVarchar()));
+                } else {
+                    UnrecoverableError("Wrong comparison type");
+                }
                 break;
             }
             default: {
@@ -450,11 +469,7 @@ UniquePtr<IndexFilterEvaluatorSecondary> IndexFilterEvaluatorSecondary::Make(con
             return IndexFilterEvaluatorSecondaryT<TimestampT>::Make(src_expr, column_id, new_secondary_index, compare_type, val);
         }
         case LogicalType::kVarchar: {
-            if (compare_type == FilterCompareType::kEqual) {
-                return IndexFilterEvaluatorSecondaryT<VarcharT>::Make(src_expr, column_id, new_secondary_index, compare_type, val);
-            }
-            RecoverableError(Status::SyntaxError("VarcharT only support kEqual compare type in secondary index."));
-            return {};
+            return IndexFilterEvaluatorSecondaryT<VarcharT>::Make(src_expr, column_id, new_secondary_index, compare_type, val);
         }
         default: {
             UnrecoverableError(fmt::format("Unexpected type for secondary index: {}", column_def->type()->ToString()));
@@ -463,6 +478,22 @@ UniquePtr<IndexFilterEvaluatorSecondary> IndexFilterEvaluatorSecondary::Make(con
     }
 }
 
+UniquePtr<IndexFilterEvaluatorSecondary> IndexFilterEvaluatorSecondary::MakeVarcharPrefix(const BaseExpression *src_expr,
+                                                                                          ColumnID column_id,
+                                                                                          SharedPtr<TableIndexMeeta> new_secondary_index,
+                                                                                          const String &prefix) {
+    auto [column_def, status] = new_secondary_index->GetColumnDef();
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
+    }
+    if (column_def->id() != static_cast<i64>(column_id) || column_def->type()->type() != LogicalType::kVarchar) {
+        UnrecoverableError("Invalid column for varchar prefix");
+    }
+    auto result = MakeUnique<IndexFilterEvaluatorSecondaryT<VarcharT>>(src_expr, column_id, LogicalType::kVarchar, new_secondary_index);
+    result->secondary_index_start_end_pairs_.emplace_back(VarcharRangeBound::At(prefix), VarcharRangeBound::PrefixEnd(prefix));
+    return result;
+}
+
 void IndexFilterEvaluatorFulltext::OptimizeQueryTree() {
     if (after_optimize_.test(std::memory_order_acquire)) {
         UnrecoverableError(std::format("{}: Already optimized!", __func__));
@@ -603,7 +634,7 @@ Bitmask IndexFilterEvaluatorOR::Evaluate(const SegmentID segment_id, const Segme
 
 template <typename ColumnValueType>
 struct TrunkReader {
-    using SecondaryIndexOrderedT = ConvertToOrderedType<ColumnValueType>;
+    using SecondaryIndexOrderedT = SecondaryIndexRangeKeyType<ColumnValueType>;
     virtual ~TrunkReader() = default;
     virtual u32 GetResultCnt(Pair<SecondaryIndexOrderedT, SecondaryIndexOrderedT> interval_range) = 0;
     virtual void OutPut(Bitmask &selected_rows) = 0;
@@ -716,6 +747,72 @@ struct TrunkReaderT final : TrunkReader<ColumnValueType> {
     }
 };
 
+// Varchar keys only order the values by their leading bytes, values sharing a key are compared in full.
+struct TrunkReaderVarchar final : TrunkReader<VarcharT> {
+    using KeyType = ConvertToOrderedType<VarcharT>;
+    const u32 segment_row_count_;
+    BufferObj *index_buffer_ = nullptr;
+    u32 begin_pos_ = 0;
+    u32 end_pos_ = 0;
+    TrunkReaderVarchar(const u32 segment_row_count, BufferObj *index_buffer) : segment_row_count_(segment_row_count), index_buffer_(index_buffer) {}
+    u32 GetResultCnt(const Pair<VarcharRangeBound, VarcharRangeBound> interval_range) override {
+        const auto index_handle = index_buffer_->Load();
+        const auto index = static_cast<const SecondaryIndexData *>(index_handle.GetData());
+        const u32 index_data_num = index->GetChunkRowCount();
+        const auto &[begin_bound, end_bound] = interval_range;
+        const auto key_ptr = static_cast<const char *>(index->GetKeyOffsetPointer().first);
+        auto compare_with = [&](const VarcharRangeBound &bound) {
+            const KeyType bound_key = bound.past_all_ ? 0 : ConvertToOrderedKeyValue(std::string_view(bound.value_));
+            // sign of (value of the i-th key - bound)
+            return [&, bound_key](const u32 i) -> i32 {
+                if (bound.past_all_) {
+                    return -1;
+                }
+                KeyType key{};
+                std::memcpy(&key, key_ptr + i * sizeof(KeyType), sizeof(KeyType));
+                if (key != bound_key) {
+                    return key < bound_key ? -1 : 1;
+                }
+                return bound.CompareValue(index->GetVarcharValue(i));
+            };
+        };
+        auto begin_cmp = compare_with(begin_bound);
+        auto end_cmp = compare_with(end_bound);
+        // first position not below begin_bound, and first position above end_bound
+        u32 begin_pos = 0;
+        for (u32 count = index_data_num; count > 0;) {
+            const u32 half = count / 2;
+            if (begin_cmp(begin_pos + half) < 0) {
+                begin_pos += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        u32 end_pos = begin_pos;
+        for (u32 count = index_data_num - begin_pos; count > 0;) {
+            const u32 half = count / 2;
+            if (end_cmp(end_pos + half) <= 0) {
+                end_pos += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        begin_pos_ = begin_pos;
+        end_pos_ = end_pos;
+        return end_pos - begin_pos;
+    }
+    void OutPut(Bitmask &selected_rows) override {
+        const auto index_handle = index_buffer_->Load();
+        const auto index = static_cast<const SecondaryIndexData *>(index_handle.GetData());
+        const auto [key_ptr, offset_ptr] = index->GetKeyOffsetPointer();
+        for (u32 i = begin_pos_; i < end_pos_; ++i) {
+            selected_rows.SetTrue(offset_ptr[i]);
+        }
+    }
+};
+
 template <typename ColumnValueType>
 struct TrunkReaderM final : TrunkReader<ColumnValueType> {
     using KeyType = typename TrunkReader<ColumnValueType>::SecondaryIndexOrderedT;
@@ -734,7 +831,7 @@ struct TrunkReaderM final : TrunkReader<ColumnValueType> {
 };
 
 template <typename ColumnValueType>
-Bitmask ExecuteSingleRangeT(const Pair<ConvertToOrderedType<ColumnValueType>, ConvertToOrderedType<ColumnValueType>> interval_range,
+Bitmask ExecuteSingleRangeT(const Pair<SecondaryIndexRangeKeyType<ColumnValueType>, SecondaryIndexRangeKeyType<ColumnValueType>> &interval_range,
                             SegmentIndexMeta *index_meta,
                             const SegmentOffset segment_row_count) {
     Vector<UniquePtr<TrunkReader<ColumnValueType>>> trunk_readers;
@@ -749,7 +846,11 @@ Bitmask ExecuteSingleRangeT(const Pair<ConvertToOrderedType<ColumnValueType>, Co
         if (!status.ok()) {
             UnrecoverableError(status.message());
         }
-        trunk_readers.emplace_back(MakeUnique<TrunkReaderT<ColumnValueType>>(segment_row_count, index_buffer));
+        if constexpr (std::is_same_v<ColumnValueType, VarcharT>) {
+            trunk_readers.emplace_back(MakeUnique<TrunkReaderVarchar>(segment_row_count, index_buffer));
+        } else {
+            trunk_readers.emplace_back(MakeUnique<TrunkReaderT<ColumnValueType>>(segment_row_count, index_buffer));
+        }
     }
     SharedPtr<MemIndex> mem_index = index_meta->GetMemIndex();
     if (mem_index) {
@@ -778,7 +879,7 @@ Bitmask IndexFilterEvaluatorSecondaryT<ColumnValueT>::Evaluate(const SegmentID s
     index_meta.emplace(segment_id, *new_secondary_index_);
     Bitmask result(segment_row_count);
     result.SetAllFalse();
-    for (const auto rng : secondary_index_start_end_pairs_) {
+    for (const auto &rng : secondary_index_start_end_pairs_) {
         const auto part_result = ExecuteSingleRangeT<ColumnValueT>(rng, &*index_meta, segment_row_count);
         result.MergeOr(part_result);
     }
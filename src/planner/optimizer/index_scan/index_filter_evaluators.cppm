@@ -71,6 +71,11 @@ export struct IndexFilterEvaluatorSecondary : IndexFilterEvaluator {
                                                          SharedPtr<TableIndexMeeta> new_secondary_index,
                                                          FilterCompareType compare_type,
                                                          const Value &val);
+    // varchar values starting with prefix
+    static UniquePtr<IndexFilterEvaluatorSecondary> MakeVarcharPrefix(const BaseExpression *src_filter_secondary_index_expressions,
+                                                                      ColumnID column_id,
+                                                                      SharedPtr<TableIndexMeeta> new_secondary_index,
+                                                                      const String &prefix);
 
 protected:
     IndexFilterEvaluatorSecondary(const BaseExpression *src_expr,
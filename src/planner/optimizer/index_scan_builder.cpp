@@ -28,6 +28,7 @@ import logical_match;
 import logical_match_tensor_scan;
 import logical_match_scan_base;
 import logical_project;
+import logical_aggregate;
 import logical_fusion;
 import query_context;
 import logical_node_visitor;
@@ -37,6 +38,17 @@ import third_party;
 import filter_expression_push_down;
 import base_table_ref;
 import lazy_load;
+import base_expression;
+import aggregate_expression;
+import column_expression;
+import expression_type;
+import aggregate_function;
+import aggregate_function_set;
+import special_function;
+import new_catalog;
+import data_type;
+import logical_type;
+import default_values;
 
 namespace infinity {
 
@@ -125,9 +137,43 @@ public:
             const auto &proj = static_cast<LogicalProject &>(*op);
             FilterExpressionPushDown::BuildFilterFulltextExpression(query_context_, scan_table_ref_ptr_, proj.expressions_);
         }
+        if (op->operator_type() == LogicalNodeType::kAggregate) {
+            CountRowIDOverIndexScan(static_cast<LogicalAggregate &>(*op));
+        }
     }
 
 private:
+    // COUNT(*) is bound as COUNT(first column). When the whole filter is answered by the index scan, count the row ids it
+    // emits instead, so that no column data is loaded: the result only depends on index offsets and row visibility.
+    void CountRowIDOverIndexScan(LogicalAggregate &aggregate) const {
+        if (!aggregate.groups_.empty() || aggregate.left_node()->operator_type() != LogicalNodeType::kIndexScan) {
+            return;
+        }
+        for (const auto &expr : aggregate.aggregates_) {
+            if (expr->type() != ExpressionType::kAggregate || !static_cast<const AggregateExpression &>(*expr).IsCountStar()) {
+                return;
+            }
+        }
+        const auto &base_table_ref = static_cast<const LogicalIndexScan &>(*aggregate.left_node()).base_table_ref_;
+        auto function_set_ptr = NewCatalog::GetFunctionSetByName(query_context_->storage()->new_catalog(), "COUNT");
+        auto aggregate_function_set_ptr = static_pointer_cast<AggregateFunctionSet>(function_set_ptr);
+        for (auto &expr : aggregate.aggregates_) {
+            SharedPtr<BaseExpression> row_id_expr = ColumnExpression::Make(DataType(LogicalType::kRowID),
+                                                                           base_table_ref->alias_,
+                                                                           base_table_ref->table_index_,
+                                                                           String(COLUMN_NAME_ROW_ID),
+                                                                           COLUMN_IDENTIFIER_ROW_ID,
+                                                                           0,
+                                                                           SpecialType::kRowID);
+            AggregateFunction count_function = aggregate_function_set_ptr->GetMostMatchFunction(row_id_expr);
+            auto count_expr = MakeShared<AggregateExpression>(std::move(count_function), Vector<SharedPtr<BaseExpression>>{std::move(row_id_expr)});
+            count_expr->count_star_ = true;
+            count_expr->alias_ = expr->Name();
+            expr = std::move(count_expr);
+        }
+        LOG_TRACE("BuildSecondaryIndexScan: COUNT(*) over index scan is answered from row ids without loading columns.");
+    }
+
     QueryContext *query_context_ = nullptr;
     const BaseTableRef *scan_table_ref_ptr_ = nullptr;
 };
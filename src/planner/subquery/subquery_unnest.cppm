@@ -46,6 +46,13 @@ public:
                                                         QueryContext *query_context,
                                                         const SharedPtr<BindContext> &bind_context);
 
+    // Plan a WHERE conjunct `expr IN (uncorrelated subquery)` as a semi join of root and the subquery.
+    static void UnnestUncorrelatedInAsSemiJoin(SubqueryExpression *expr_ptr,
+                                               SharedPtr<LogicalNode> &root,
+                                               SharedPtr<LogicalNode> &subquery_plan,
+                                               QueryContext *query_context,
+                                               const SharedPtr<BindContext> &bind_context);
+
     static SharedPtr<BaseExpression> UnnestCorrelated(SubqueryExpression *expr_ptr,
                                                       SharedPtr<LogicalNode> &root,
                                                       SharedPtr<LogicalNode> &subquery_plan,
@@ -53,6 +60,8 @@ public:
                                                       const SharedPtr<BindContext> &bind_context);
 
 private:
+    static SharedPtr<BaseExpression> GenerateInCondition(SubqueryExpression *expr_ptr, SharedPtr<LogicalNode> &subquery_plan, QueryContext *query_context);
+
     static void GenerateJoinConditions(QueryContext *query_context,
                                        Vector<SharedPtr<BaseExpression>> &conditions,
                                        const Vector<SharedPtr<ColumnExpression>> &correlated_columns,
@@ -43,6 +43,7 @@ import physical_merge_top;
 import physical_match_tensor_scan;
 import physical_match_sparse_scan;
 import physical_compact;
+import physical_hash_join;
 
 import global_block_id;
 import knn_expression;
@@ -314,6 +315,12 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
         case PhysicalOperatorType::kMergeHash: {
             return MakeTaskStateTemplate<MergeHashOperatorState>(physical_ops[operator_id]);
         }
+        case PhysicalOperatorType::kJoinHash: {
+            auto *physical_hash_join = static_cast<PhysicalHashJoin *>(physical_ops[operator_id]);
+            auto operator_state = MakeUnique<HashJoinOperatorState>();
+            operator_state->build_fragment_id_ = physical_hash_join->build_fragment_id();
+            return operator_state;
+        }
         case PhysicalOperatorType::kLimit: {
             return MakeTaskStateTemplate<LimitOperatorState>(physical_ops[operator_id]);
         }
@@ -781,6 +788,7 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
         case PhysicalOperatorType::kMergeKnn:
         case PhysicalOperatorType::kMergeMatchTensor:
         case PhysicalOperatorType::kMergeMatchSparse:
+        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kFusion: {
             if (fragment_type_ != FragmentType::kSerialMaterialize) {
                 UnrecoverableError(
@@ -809,7 +817,6 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
         case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
@@ -965,8 +972,23 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kParallelAggregate:
         case PhysicalOperatorType::kHash: {
+            if (fragment_type_ == FragmentType::kParallelStream) {
+                String error_message = fmt::format("{} should in materialized fragment", PhysicalOperatorToString(last_operator->operator_type()));
+                UnrecoverableError(error_message);
+            }
+
+            if ((i64)tasks_.size() != parallel_count) {
+                String error_message = fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type()));
+                UnrecoverableError(error_message);
+            }
+
+            for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
+            }
+            break;
+        }
+        case PhysicalOperatorType::kParallelAggregate: {
             if (fragment_type_ != FragmentType::kParallelStream) {
                 String error_message = fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type()));
                 UnrecoverableError(error_message);
@@ -1088,6 +1110,11 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
 
             for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                if (GetSinkOperator()->sink_type() == SinkType::kLocalQueue) {
+                    // e.g. the probe side of a hash join
+                    tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
+                    continue;
+                }
                 tasks_[task_id]->sink_state_ = MakeUnique<MaterializeSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
                 MaterializeSinkState *sink_state_ptr = static_cast<MaterializeSinkState *>(tasks_[task_id]->sink_state_.get());
                 sink_state_ptr->column_types_ = last_operator->GetOutputTypes();
@@ -1095,6 +1122,27 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
+        case PhysicalOperatorType::kJoinHash: {
+            if (fragment_type_ != FragmentType::kSerialMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in serial materialized fragment", PhysicalOperatorToString(last_operator->operator_type())));
+            }
+
+            if (tasks_.size() != 1) {
+                String error_message = fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type()));
+                UnrecoverableError(error_message);
+            }
+
+            if (GetSinkOperator()->sink_type() == SinkType::kLocalQueue) {
+                tasks_[0]->sink_state_ = MakeUnique<QueueSinkState>(plan_fragment_ptr_->FragmentID(), 0);
+            } else {
+                tasks_[0]->sink_state_ = MakeUnique<MaterializeSinkState>(plan_fragment_ptr_->FragmentID(), 0);
+                MaterializeSinkState *sink_state_ptr = static_cast<MaterializeSinkState *>(tasks_[0]->sink_state_.get());
+                sink_state_ptr->column_types_ = last_operator->GetOutputTypes();
+                sink_state_ptr->column_names_ = last_operator->GetOutputNames();
+            }
+            break;
+        }
         case PhysicalOperatorType::kProjection: {
             if (fragment_type_ == FragmentType::kSerialMaterialize) {
                 if (tasks_.size() != 1) {
@@ -1113,6 +1161,10 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
                 }
 
                 for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                    if (GetSinkOperator()->sink_type() == SinkType::kLocalQueue) {
+                        tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
+                        continue;
+                    }
                     tasks_[task_id]->sink_state_ = MakeUnique<MaterializeSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
                     MaterializeSinkState *sink_state_ptr = static_cast<MaterializeSinkState *>(tasks_[task_id]->sink_state_.get());
                     sink_state_ptr->column_types_ = last_operator->GetOutputTypes();
@@ -1125,7 +1177,6 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
         case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
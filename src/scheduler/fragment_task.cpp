@@ -67,7 +67,11 @@ void FragmentTask::OnExecute() {
     }
 
     bool execute_success{false};
-    source_op->Execute(query_context, source_state_.get());
+    i64 start_op_idx = ResumeOperatorIndex();
+    if (start_op_idx < 0) {
+        source_op->Execute(query_context, source_state_.get());
+        start_op_idx = operator_count_ - 1;
+    }
     Status operator_status{};
     if (source_state_->status_.ok()) {
         // No source error
@@ -77,7 +81,7 @@ void FragmentTask::OnExecute() {
         HashMap<SizeT, SharedPtr<BaseTableRef>> table_refs;
         profiler.Begin();
         try {
-            for (i64 op_idx = operator_count_ - 1; op_idx >= 0; --op_idx) {
+            for (i64 op_idx = start_op_idx; op_idx >= 0; --op_idx) {
                 profiler.StartOperator(operator_refs[op_idx]);
                 DeferFn defer_fn([&]() { profiler.StopOperator(operator_states_[op_idx].get()); });
 
@@ -113,6 +117,7 @@ void FragmentTask::OnExecute() {
         status_ = FragmentTaskStatus::kError;
     } else if (execute_success) {
         PhysicalSink *sink_op = fragment_context->GetSinkOperator();
+        sink_state_->pending_output_ = ResumeOperatorIndex() >= 0;
         sink_op->Execute(query_context, fragment_context, sink_state_.get());
     }
 }
@@ -142,6 +147,10 @@ bool FragmentTask::QuitFromWorkerLoop() {
         // fragment's source is not from queue
         return false;
     }
+    if (ResumeOperatorIndex() >= 0) {
+        // an operator still has output, which doesn't need the source
+        return false;
+    }
     auto *queue_state = static_cast<QueueSourceState *>(source_state_.get());
 
     std::unique_lock lock(mutex_);
@@ -154,6 +163,17 @@ bool FragmentTask::QuitFromWorkerLoop() {
     return false;
 }
 
+i64 FragmentTask::ResumeOperatorIndex() const {
+    // Operators run from the last index to 0, resume from the earliest one with pending output.
+    for (i64 op_idx = operator_count_ - 1; op_idx >= 0; --op_idx) {
+        const OperatorState *operator_state = operator_states_[op_idx].get();
+        if (operator_state != nullptr && operator_state->pending_output_ && operator_state->Ok()) {
+            return op_idx;
+        }
+    }
+    return -1;
+}
+
 TaskBinding FragmentTask::TaskBinding() const {
     struct TaskBinding binding{};
 
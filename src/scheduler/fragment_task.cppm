@@ -94,6 +94,9 @@ public:
 
     String PhysOpsToString();
 
+    // Index of the first operator to execute when an operator still has pending output, -1 otherwise.
+    i64 ResumeOperatorIndex() const;
+
     // for test.
     [[nodiscard]] inline FragmentTaskStatus status() const { return status_; }
 
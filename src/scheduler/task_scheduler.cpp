@@ -42,8 +42,18 @@ import global_resource_usage;
 
 namespace infinity {
 
-Worker::Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread)
-    : cpu_id_(cpu_id), queue_(std::move(queue)), thread_(std::move(thread)) {}
+Worker::Worker(u64 cpu_id, i64 numa_node, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<FragmentTaskDeque> deque)
+    : cpu_id_(cpu_id), numa_node_(numa_node), queue_(std::move(queue)), deque_(std::move(deque)) {}
+
+TaskStealingMode TaskStealingModeFromString(const String &mode) {
+    if (mode == "on") {
+        return TaskStealingMode::kGlobal;
+    }
+    if (mode == "numa") {
+        return TaskStealingMode::kNumaLocal;
+    }
+    return TaskStealingMode::kOff;
+}
 
 // Non-static memory methods
 TaskScheduler::TaskScheduler(Config *config_ptr) {
@@ -63,8 +73,10 @@ void TaskScheduler::Init(Config *config_ptr) {
     const u64 cpu_count = Thread::hardware_concurrency();
     const u64 config_cpu_limit = config_ptr->CPULimit();
     worker_count_ = std::min(cpu_count, config_cpu_limit);
+    stealing_mode_ = TaskStealingModeFromString(config_ptr->TaskStealing());
     worker_array_.reserve(worker_count_);
     worker_workloads_.resize(worker_count_);
+    worker_counters_.resize(worker_count_);
 
     Vector<u64> cpu_id_vec;
     cpu_id_vec.reserve(cpu_count);
@@ -77,14 +89,15 @@ void TaskScheduler::Init(Config *config_ptr) {
         cpu_id_vec.push_back(cpu_id);
     }
 
+    // All workers are set up before any thread starts, since a thief reads the deques of the other workers.
     for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
         const u64 cpu_id = cpu_id_vec[worker_id];
         UniquePtr<FragmentTaskBlockQueue> worker_queue = MakeUnique<FragmentTaskBlockQueue>("TaskScheduler");
-        UniquePtr<Thread> worker_thread = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_queue.get(), worker_id);
-        // Pin the thread to specific cpu
-        ThreadUtil::pin(*worker_thread, cpu_id);
-
-        worker_array_.emplace_back(cpu_id, std::move(worker_queue), std::move(worker_thread));
+        UniquePtr<FragmentTaskDeque> worker_deque{};
+        if (stealing_mode_ != TaskStealingMode::kOff) {
+            worker_deque = MakeUnique<FragmentTaskDeque>(DEFAULT_WORKER_DEQUE_CAPACITY);
+        }
+        worker_array_.emplace_back(cpu_id, ThreadUtil::NumaNode(cpu_id), std::move(worker_queue), std::move(worker_deque));
         worker_workloads_[worker_id] = 0;
     }
 
@@ -93,6 +106,33 @@ void TaskScheduler::Init(Config *config_ptr) {
         UnrecoverableError(error_message);
     }
 
+    if (stealing_mode_ != TaskStealingMode::kOff) {
+        for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+            auto &worker = worker_array_[worker_id];
+            for (u64 victim_id = 0; victim_id < worker_count_; ++victim_id) {
+                if (victim_id == worker_id) {
+                    continue;
+                }
+                if (stealing_mode_ == TaskStealingMode::kNumaLocal && worker_array_[victim_id].numa_node_ != worker.numa_node_) {
+                    continue;
+                }
+                worker.victims_.push_back(victim_id);
+            }
+        }
+        stealing_running_ = true;
+    }
+
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        auto &worker = worker_array_[worker_id];
+        if (stealing_mode_ == TaskStealingMode::kOff) {
+            worker.thread_ = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker.queue_.get(), worker_id);
+        } else {
+            worker.thread_ = MakeUnique<Thread>(&TaskScheduler::WorkStealingLoop, this, worker_id);
+        }
+        // Pin the thread to specific cpu
+        ThreadUtil::pin(*worker.thread_, worker.cpu_id_);
+    }
+
     initialized_ = true;
 }
 
@@ -101,13 +141,44 @@ void TaskScheduler::UnInit() {
     UniquePtr<FragmentTask> terminate_task = MakeUnique<FragmentTask>(true);
 
     LOG_INFO("Shutting down TaskScheduler...");
+    if (stealing_mode_ != TaskStealingMode::kOff) {
+        // Idle workers wake up periodically, so no terminator is needed, and a terminator can't be stolen by mistake.
+        stealing_running_ = false;
+        for (const auto &statistics : GetWorkerStatistics()) {
+            LOG_INFO(fmt::format("Worker {} on cpu {}, numa node {}: steal {}, stolen {}, idle {}",
+                                 statistics.worker_id_,
+                                 statistics.cpu_id_,
+                                 statistics.numa_node_,
+                                 statistics.steal_count_,
+                                 statistics.stolen_count_,
+                                 statistics.idle_count_));
+        }
+    }
     for (const auto &worker : worker_array_) {
-        worker.queue_->Enqueue(terminate_task.get());
+        if (stealing_mode_ == TaskStealingMode::kOff) {
+            worker.queue_->Enqueue(terminate_task.get());
+        }
         worker.thread_->join();
     }
     LOG_INFO("TaskScheduler is shut down.");
 }
 
+Vector<WorkerStatistics> TaskScheduler::GetWorkerStatistics() const {
+    Vector<WorkerStatistics> statistics_array;
+    statistics_array.reserve(worker_count_);
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        const auto &worker = worker_array_[worker_id];
+        const auto &counters = worker_counters_[worker_id];
+        statistics_array.push_back(WorkerStatistics{worker_id,
+                                                    worker.cpu_id_,
+                                                    worker.numa_node_,
+                                                    counters.steal_count_.load(),
+                                                    counters.stolen_count_.load(),
+                                                    counters.idle_count_.load()});
+    }
+    return statistics_array;
+}
+
 u64 TaskScheduler::FindLeastWorkloadWorker() {
     u64 min_workload = worker_workloads_[0];
     u64 min_workload_worker_id = 0;
@@ -226,6 +297,42 @@ void TaskScheduler::ScheduleTask(FragmentTask *task, u64 worker_id) {
     worker_array_[worker_id].queue_->Enqueue(task);
 }
 
+bool TaskScheduler::ExecuteTask(FragmentTask *fragment_task, i64 worker_id) {
+    auto *fragment_ctx = fragment_task->fragment_context();
+
+    bool error = false;
+    bool finish = false;
+    bool stay = false;
+    if (!fragment_ctx->notifier()->StartTask()) {
+        error = true;
+    } else {
+        fragment_task->OnExecute();
+        fragment_task->SetLastWorkID(worker_id);
+        if (fragment_task->status() == FragmentTaskStatus::kError) {
+            error = true;
+        }
+    }
+    if (!error) {
+        if (fragment_task->IsComplete()) {
+            --worker_workloads_[worker_id];
+            fragment_task->CompleteTask();
+            finish = true;
+        } else if (fragment_task->QuitFromWorkerLoop()) {
+            --worker_workloads_[worker_id];
+        } else {
+            stay = true;
+        }
+    } else {
+        --worker_workloads_[worker_id];
+        fragment_ctx->notifier()->SetError(fragment_ctx);
+        fragment_task->CompleteTask();
+    }
+    if (finish || error) {
+        fragment_ctx->notifier()->FinishTask();
+    }
+    return stay;
+}
+
 void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id) {
     List<FragmentTask *> task_lists;
     auto iter = task_lists.end();
@@ -250,39 +357,96 @@ void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id
         if (fragment_task->IsTerminator()) {
             break;
         }
-        auto *fragment_ctx = fragment_task->fragment_context();
-
-        bool error = false;
-        bool finish = false;
-        if (!fragment_ctx->notifier()->StartTask()) {
-            error = true;
+        if (ExecuteTask(fragment_task, worker_id)) {
+            ++iter;
         } else {
-            fragment_task->OnExecute();
-            fragment_task->SetLastWorkID(worker_id);
-            if (fragment_task->status() == FragmentTaskStatus::kError) {
-                error = true;
-            }
+            iter = task_lists.erase(iter);
         }
-        if (!error) {
-            if (fragment_task->IsComplete()) {
-                --worker_workloads_[worker_id];
-                fragment_task->CompleteTask();
-                iter = task_lists.erase(iter);
-                finish = true;
-            } else if (fragment_task->QuitFromWorkerLoop()) {
-                --worker_workloads_[worker_id];
-                iter = task_lists.erase(iter);
+    }
+}
+
+bool TaskScheduler::FillDeque(Worker &worker, Vector<FragmentTask *> &tasks) {
+    auto &deque = *worker.deque_;
+    // Keep one slot for the task being executed, so it can always be pushed back.
+    while (deque.Size() + 1 < deque.Capacity()) {
+        FragmentTask *task = nullptr;
+        if (!tasks.empty()) {
+            task = tasks.back();
+            tasks.pop_back();
+        } else if (!worker.queue_->TryDequeue(task)) {
+            break;
+        }
+        if (task->IsTerminator()) {
+            return false;
+        }
+        deque.Push(task);
+    }
+    return true;
+}
+
+FragmentTask *TaskScheduler::StealTask(i64 worker_id, mt19937 &random_engine) {
+    const auto &victims = worker_array_[worker_id].victims_;
+    SizeT victim_count = victims.size();
+    if (victim_count == 0) {
+        return nullptr;
+    }
+    SizeT start = random_engine() % victim_count;
+    for (SizeT i = 0; i < victim_count; ++i) {
+        u64 victim_id = victims[(start + i) % victim_count];
+        auto &victim = worker_array_[victim_id];
+        FragmentTask *task = victim.deque_->Steal();
+        if (task == nullptr) {
+            // The victim may be busy with a long task and hasn't moved its new tasks into the deque.
+            victim.queue_->TryDequeue(task);
+        }
+        if (task != nullptr) {
+            --worker_workloads_[victim_id];
+            ++worker_workloads_[worker_id];
+            ++worker_counters_[victim_id].stolen_count_;
+            ++worker_counters_[worker_id].steal_count_;
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::WorkStealingLoop(i64 worker_id) {
+    auto &worker = worker_array_[worker_id];
+    auto &deque = *worker.deque_;
+    auto &counters = worker_counters_[worker_id];
+    mt19937 random_engine(worker_id);
+    SizeT idle_wait_ms = 1;
+    Vector<FragmentTask *> new_tasks;
+    while (stealing_running_) {
+        if (!FillDeque(worker, new_tasks)) {
+            break;
+        }
+        // The owner also takes the oldest task, so its tasks run round robin as in WorkerLoop.
+        FragmentTask *fragment_task = deque.Steal();
+        if (fragment_task == nullptr && deque.Size() == 0) {
+            fragment_task = StealTask(worker_id, random_engine);
+        }
+        if (fragment_task == nullptr) {
+            if (deque.Size() > 0) {
+                // Lost the race to a thief, retry.
+                continue;
+            }
+            ++counters.idle_count_;
+            // New tasks wake the worker up at once, the timeout only bounds how long the worker misses stealable tasks.
+            if (worker.queue_->TryDequeueBulkWait(new_tasks, idle_wait_ms)) {
+                std::reverse(new_tasks.begin(), new_tasks.end());
+                idle_wait_ms = 1;
             } else {
-                ++iter;
+                idle_wait_ms = std::min(idle_wait_ms * 2, MAX_WORKER_IDLE_WAIT_MS);
             }
-        } else {
-            --worker_workloads_[worker_id];
-            fragment_ctx->notifier()->SetError(fragment_ctx);
-            fragment_task->CompleteTask();
-            iter = task_lists.erase(iter);
+            continue;
+        }
+        idle_wait_ms = 1;
+        if (fragment_task->IsTerminator()) {
+            break;
         }
-        if (finish || error) {
-            fragment_ctx->notifier()->FinishTask();
+        if (ExecuteTask(fragment_task, worker_id)) {
+            deque.Push(fragment_task);
         }
     }
 }
@@ -21,6 +21,7 @@ import stl;
 import fragment_task;
 import blocking_queue;
 import base_statement;
+import work_stealing_deque;
 
 namespace infinity {
 
@@ -28,14 +29,48 @@ class QueryContext;
 class PlanFragment;
 
 using FragmentTaskBlockQueue = BlockingQueue<FragmentTask *>;
+using FragmentTaskDeque = WorkStealingDeque<FragmentTask *>;
+
+export enum class TaskStealingMode : i8 {
+    kOff,
+    // Idle workers steal from any worker
+    kGlobal,
+    // Idle workers steal only from the workers on the same NUMA node
+    kNumaLocal,
+};
+
+export TaskStealingMode TaskStealingModeFromString(const String &mode);
 
 struct Worker {
-    Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread);
+    Worker(u64 cpu_id, i64 numa_node, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<FragmentTaskDeque> deque);
     u64 cpu_id_{0};
+    i64 numa_node_{0};
+    // Newly scheduled tasks, the owner moves them into its deque in task stealing mode.
     UniquePtr<FragmentTaskBlockQueue> queue_{};
+    UniquePtr<FragmentTaskDeque> deque_{};
+    // Workers this worker may steal from
+    Vector<u64> victims_{};
     UniquePtr<Thread> thread_{};
 };
 
+struct WorkerCounters {
+    Atomic<u64> steal_count_{0};
+    Atomic<u64> stolen_count_{0};
+    Atomic<u64> idle_count_{0};
+};
+
+export struct WorkerStatistics {
+    u64 worker_id_{0};
+    u64 cpu_id_{0};
+    i64 numa_node_{0};
+    // Tasks taken from other workers
+    u64 steal_count_{0};
+    // Tasks taken by other workers
+    u64 stolen_count_{0};
+    // Times the worker found no task to run and went to sleep
+    u64 idle_count_{0};
+};
+
 export class TaskScheduler {
 public:
     explicit TaskScheduler(Config *config_ptr);
@@ -54,6 +89,10 @@ public:
 
     void DumpPlanFragment(PlanFragment *plan_fragment);
 
+    [[nodiscard]] inline TaskStealingMode stealing_mode() const { return stealing_mode_; }
+
+    Vector<WorkerStatistics> GetWorkerStatistics() const;
+
 private:
     u64 FindLeastWorkloadWorker();
 
@@ -61,13 +100,26 @@ private:
 
     void RunTask(FragmentTask *task);
 
+    // Run the task once, return true if the task stays in the worker loop.
+    bool ExecuteTask(FragmentTask *fragment_task, i64 worker_id);
+
     void WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id);
 
+    void WorkStealingLoop(i64 worker_id);
+
+    // Move tasks from the queue of the worker into its deque, return false if the terminator is received.
+    bool FillDeque(Worker &worker, Vector<FragmentTask *> &tasks);
+
+    FragmentTask *StealTask(i64 worker_id, mt19937 &random_engine);
+
 private:
     bool initialized_{false};
+    TaskStealingMode stealing_mode_{TaskStealingMode::kOff};
+    Atomic<bool> stealing_running_{false};
 
     Vector<Worker> worker_array_{};
     Deque<Atomic<u64>> worker_workloads_{};
+    Deque<WorkerCounters> worker_counters_{};
 
     u64 worker_count_{0};
 };
@@ -0,0 +1,107 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <atomic>
+#include <type_traits>
+
+export module work_stealing_deque;
+
+import stl;
+import infinity_exception;
+
+namespace infinity {
+
+// Bounded Chase-Lev deque of pointers. Only the owner thread may Push and Pop at the bottom, any thread may Steal from the top.
+// Capacity is fixed, so a slot is reused only after the element in it was taken and no thief can still read it.
+export template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_pointer_v<T>);
+
+public:
+    explicit WorkStealingDeque(SizeT capacity) : capacity_(capacity), mask_(capacity - 1), buffer_(MakeUnique<Atomic<T>[]>(capacity)) {
+        if (capacity == 0 || (capacity & mask_) != 0) {
+            String error_message = "Capacity of work stealing deque should be a power of 2";
+            UnrecoverableError(error_message);
+        }
+    }
+
+    // Owner only, return false if the deque is full.
+    bool Push(T item) {
+        i64 bottom = bottom_.load(std::memory_order_relaxed);
+        i64 top = top_.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<i64>(capacity_)) {
+            return false;
+        }
+        buffer_[bottom & mask_].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only, take the newest element, nullptr if empty.
+    T Pop() {
+        i64 bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        i64 top = top_.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T item = buffer_[bottom & mask_].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last element, race with the thieves.
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread, take the oldest element. Return nullptr if empty or another thread took it first.
+    T Steal() {
+        i64 top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        i64 bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        T item = buffer_[top & mask_].load(std::memory_order_relaxed);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    // Approximate when other threads are stealing.
+    [[nodiscard]] SizeT Size() const {
+        i64 bottom = bottom_.load(std::memory_order_relaxed);
+        i64 top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? bottom - top : 0;
+    }
+
+    [[nodiscard]] inline SizeT Capacity() const { return capacity_; }
+
+private:
+    alignas(64) Atomic<i64> top_{0};
+    alignas(64) Atomic<i64> bottom_{0};
+    const SizeT capacity_{};
+    const SizeT mask_{};
+    UniquePtr<Atomic<T>[]> buffer_{};
+};
+
+} // namespace infinity
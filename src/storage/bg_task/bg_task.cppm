@@ -21,6 +21,7 @@ import third_party;
 import global_resource_usage;
 import status;
 import bg_task_type;
+import default_values;
 
 namespace infinity {
 
@@ -109,11 +110,14 @@ private:
 
 export class NotifyCompactTask final : public BGTask {
 public:
-    NotifyCompactTask() : BGTask(BGTaskType::kNotifyCompact, true) {}
+    explicit NotifyCompactTask(SizeT io_budget = DEFAULT_COMPACTION_IO_BUDGET) : BGTask(BGTaskType::kNotifyCompact, true), io_budget_(io_budget) {}
 
     ~NotifyCompactTask() override = default;
 
     String ToString() const override { return "NotifyCompactTask"; }
+
+    // bytes all tables may rewrite in this round
+    SizeT io_budget_{};
 };
 
 export class NewCompactTask final : public BGTask {
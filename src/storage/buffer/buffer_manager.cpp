@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <vector>
 
 module buffer_manager;
@@ -31,14 +32,33 @@ import virtual_store;
 import global_resource_usage;
 import kv_store;
 import status;
+import default_values;
 
 namespace infinity {
 
+BufferPriority GetBufferPriority(FileWorkerType file_worker_type) {
+    switch (file_worker_type) {
+        case FileWorkerType::kIVFIndexFile:
+        case FileWorkerType::kHNSWIndexFile:
+        case FileWorkerType::kSecondaryIndexFile:
+        case FileWorkerType::kIndexFile:
+        case FileWorkerType::kEMVBIndexFile:
+        case FileWorkerType::kBMPIndexFile:
+        case FileWorkerType::kDiskAnnIndexFile: {
+            return BufferPriority::kHigh;
+        }
+        default: {
+            return BufferPriority::kLow;
+        }
+    }
+}
+
 void LRUCache::RemoveClean(const Vector<BufferObj *> &buffer_obj) {
     std::unique_lock lock(locker_);
     for (auto *buffer_obj : buffer_obj) {
         if (auto iter = gc_map_.find(buffer_obj); iter != gc_map_.end()) {
-            gc_list_.erase(iter->second);
+            auto [queue_idx, list_iter] = iter->second;
+            gc_lists_[queue_idx].erase(list_iter);
             gc_map_.erase(iter);
         }
     }
@@ -49,18 +69,22 @@ SizeT LRUCache::WaitingGCObjectCount() {
     return gc_map_.size();
 }
 
-SizeT LRUCache::RequestSpace(SizeT need_space) {
+SizeT LRUCache::RequestSpace(SizeT need_space, SizeT queue_idx) {
     SizeT free_space = 0;
     std::unique_lock lock(locker_);
-    auto iter = gc_list_.begin();
-    while (free_space < need_space && iter != gc_list_.end()) {
+    List<BufferObj *> &gc_list = gc_lists_[queue_idx];
+    auto iter = gc_list.begin();
+    while (free_space < need_space && iter != gc_list.end()) {
         auto *buffer_obj = *iter;
         // Free return false when the buffer is freed by cleanup
         // will not dead lock because caller is in kNew or kFree state, and `buffer_obj` is in kUnloaded or state
         if (buffer_obj->Free()) {
             free_space += buffer_obj->GetBufferSize();
-            iter = gc_list_.erase(iter);
+            iter = gc_list.erase(iter);
             gc_map_.erase(buffer_obj);
+            if (IsProbation(queue_idx)) {
+                AddGhost(buffer_obj->id());
+            }
         } else {
             ++iter;
         }
@@ -70,24 +94,61 @@ SizeT LRUCache::RequestSpace(SizeT need_space) {
 
 void LRUCache::PushGCQueue(BufferObj *buffer_obj) {
     std::unique_lock lock(locker_);
+    if (!buffer_obj->hot() && RemoveGhost(buffer_obj->id())) {
+        // loaded again soon after freed from the probation queue
+        buffer_obj->set_hot(true);
+    }
     auto iter = gc_map_.find(buffer_obj);
     if (iter != gc_map_.end()) {
-        gc_list_.erase(iter->second);
+        auto [queue_idx, list_iter] = iter->second;
+        gc_lists_[queue_idx].erase(list_iter);
     }
-    gc_list_.push_back(buffer_obj);
-    gc_map_[buffer_obj] = --gc_list_.end();
+    SizeT queue_idx = QueueIdx(buffer_obj);
+    gc_lists_[queue_idx].push_back(buffer_obj);
+    gc_map_[buffer_obj] = {queue_idx, std::prev(gc_lists_[queue_idx].end())};
 }
 
 bool LRUCache::RemoveFromGCQueue(BufferObj *buffer_obj) {
     std::unique_lock lock(locker_);
     if (auto iter = gc_map_.find(buffer_obj); iter != gc_map_.end()) {
-        gc_list_.erase(iter->second);
+        auto [queue_idx, list_iter] = iter->second;
+        gc_lists_[queue_idx].erase(list_iter);
         gc_map_.erase(iter);
         return true;
     }
     return false;
 }
 
+SizeT LRUCache::QueueIdx(const BufferObj *buffer_obj) {
+    SizeT queue_idx = buffer_obj->hot() ? kQueueCount / 2 : 0;
+    if (GetBufferPriority(buffer_obj->file_worker()->Type()) == BufferPriority::kHigh) {
+        ++queue_idx;
+    }
+    return queue_idx;
+}
+
+void LRUCache::AddGhost(u32 buffer_id) {
+    if (ghost_map_.contains(buffer_id)) {
+        return;
+    }
+    ghost_list_.push_back(buffer_id);
+    ghost_map_.emplace(buffer_id, std::prev(ghost_list_.end()));
+    if (ghost_list_.size() > DEFAULT_BUFFER_MANAGER_GHOST_COUNT) {
+        ghost_map_.erase(ghost_list_.front());
+        ghost_list_.pop_front();
+    }
+}
+
+bool LRUCache::RemoveGhost(u32 buffer_id) {
+    auto iter = ghost_map_.find(buffer_id);
+    if (iter == ghost_map_.end()) {
+        return false;
+    }
+    ghost_list_.erase(iter->second);
+    ghost_map_.erase(iter);
+    return true;
+}
+
 BufferManager::BufferManager(u64 memory_limit,
                              SharedPtr<String> data_dir,
                              SharedPtr<String> temp_dir,
@@ -115,6 +176,7 @@ void BufferManager::Start() {
 }
 
 void BufferManager::Stop() {
+    WaitPrefetch();
     RemoveClean(nullptr);
     LOG_INFO("Buffer manager is stopped.");
 }
@@ -204,6 +266,8 @@ Status BufferManager::RemoveClean(KVInstance *kv_instance) {
     for (auto &lru_cache : lru_caches_) {
         lru_cache.RemoveClean(clean_list);
     }
+    // a pending prefetch may still refer to the removed buffers
+    WaitPrefetch(clean_list);
     {
         std::unique_lock lock(w_locker_);
         for (auto *buffer_obj : clean_list) {
@@ -238,6 +302,41 @@ Vector<BufferObjectInfo> BufferManager::GetBufferObjectsInfo() {
     return result;
 }
 
+void BufferManager::Prefetch(const Vector<BufferObj *> &buffer_objs) {
+    for (auto *buffer_obj : buffer_objs) {
+        {
+            std::unique_lock lock(prefetch_locker_);
+            ++prefetch_task_count_;
+            ++prefetching_objs_[buffer_obj];
+        }
+        prefetch_thread_pool_.push([this, buffer_obj](int) {
+            try {
+                buffer_obj->Prefetch();
+            } catch (const std::exception &e) {
+                LOG_WARN(fmt::format("Prefetch {} failed: {}", buffer_obj->GetFilename(), e.what()));
+            }
+            std::unique_lock lock(prefetch_locker_);
+            --prefetch_task_count_;
+            if (auto iter = prefetching_objs_.find(buffer_obj); --iter->second == 0) {
+                prefetching_objs_.erase(iter);
+            }
+            prefetch_cv_.notify_all();
+        });
+    }
+}
+
+void BufferManager::WaitPrefetch() {
+    std::unique_lock lock(prefetch_locker_);
+    prefetch_cv_.wait(lock, [this] { return prefetch_task_count_ == 0; });
+}
+
+void BufferManager::WaitPrefetch(const Vector<BufferObj *> &buffer_objs) {
+    std::unique_lock lock(prefetch_locker_);
+    prefetch_cv_.wait(lock, [&] {
+        return std::none_of(buffer_objs.begin(), buffer_objs.end(), [this](BufferObj *buffer_obj) { return prefetching_objs_.contains(buffer_obj); });
+    });
+}
+
 bool BufferManager::RequestSpace(SizeT need_size) {
     std::unique_lock lock(gc_locker_);
     SizeT freed_space = 0;
@@ -246,16 +345,28 @@ bool BufferManager::RequestSpace(SizeT need_size) {
         [[maybe_unused]] auto cur_mem_size = current_memory_size_.fetch_add(need_size);
         return true;
     }
-    SizeT round_robin = round_robin_;
-    do {
-        freed_space += lru_caches_[round_robin_].RequestSpace(need_size);
-        round_robin_ = (round_robin_ + 1) % lru_caches_.size();
-    } while (freed_space + free_space < need_size && round_robin_ != round_robin);
+    // all probation buffers are freed before any protected one
+    for (SizeT queue_idx = 0; queue_idx < LRUCache::kQueueCount && freed_space + free_space < need_size; ++queue_idx) {
+        SizeT round_robin = round_robin_;
+        do {
+            freed_space += lru_caches_[round_robin_].RequestSpace(need_size - free_space - freed_space, queue_idx);
+            round_robin_ = (round_robin_ + 1) % lru_caches_.size();
+        } while (freed_space + free_space < need_size && round_robin_ != round_robin);
+    }
     bool free_success = freed_space + free_space >= need_size;
     [[maybe_unused]] auto cur_mem_size = current_memory_size_.fetch_add(need_size - freed_space); // It's ok to add minus value
     return free_success;
 }
 
+bool BufferManager::RequestFreeSpace(SizeT need_size) {
+    std::unique_lock lock(gc_locker_);
+    if (current_memory_size_ + need_size > memory_limit_) {
+        return false;
+    }
+    current_memory_size_ += need_size;
+    return true;
+}
+
 void BufferManager::PushGCQueue(BufferObj *buffer_obj) {
     SizeT idx = LRUIdx(buffer_obj);
     lru_caches_[idx].PushGCQueue(buffer_obj);
@@ -16,6 +16,7 @@ module;
 
 import stl;
 import file_worker;
+import file_worker_type;
 // import specific_concurrent_queue;
 import default_values;
 
@@ -30,23 +31,53 @@ class PersistenceManager;
 class ObjAddr;
 class Status;
 
+// Buffers of index files are kept in memory in favor of the buffers of data files.
+export enum class BufferPriority : u8 {
+    kLow,
+    kHigh,
+};
+
+export BufferPriority GetBufferPriority(FileWorkerType file_worker_type);
+
+// The unloaded buffers by the order they are freed in. As in 2Q, the buffers loaded once go to a probation queue, and the buffers
+// loaded again soon after they are freed from the probation queue go to a protected queue, so that a scan of many buffers only
+// frees the buffers of the probation queue. Each queue is split by the priority of the buffers.
 class LRUCache {
 public:
+    // probation low, probation high, protected low, protected high
+    static constexpr SizeT kQueueCount = 4;
+
     void RemoveClean(const Vector<BufferObj *> &buffer_obj);
 
     SizeT WaitingGCObjectCount();
 
-    SizeT RequestSpace(SizeT need_space);
+    // Free the buffers of the queue until need_space is freed.
+    SizeT RequestSpace(SizeT need_space, SizeT queue_idx);
 
+    // Caller holds the lock of buffer_obj.
     void PushGCQueue(BufferObj *buffer_obj);
 
     bool RemoveFromGCQueue(BufferObj *buffer_obj);
 
 private:
+    static SizeT QueueIdx(const BufferObj *buffer_obj);
+
+    static bool IsProbation(SizeT queue_idx) { return queue_idx < kQueueCount / 2; }
+
+    // Caller holds locker_.
+    void AddGhost(u32 buffer_id);
+
+    // Caller holds locker_.
+    bool RemoveGhost(u32 buffer_id);
+
     std::mutex locker_{};
     using GCListIter = List<BufferObj *>::iterator;
-    HashMap<BufferObj *, GCListIter> gc_map_{};
-    List<BufferObj *> gc_list_{};
+    HashMap<BufferObj *, Pair<SizeT, GCListIter>> gc_map_{};
+    Array<List<BufferObj *>, kQueueCount> gc_lists_{};
+
+    // ids of the buffers freed from the probation queues recently
+    List<u32> ghost_list_{};
+    HashMap<u32, List<u32>::iterator> ghost_map_{};
 };
 
 export class BufferManager {
@@ -92,6 +123,16 @@ public:
 
     Vector<BufferObjectInfo> GetBufferObjectsInfo();
 
+    // Load the persisted buffers that are not in memory on the prefetch threads, so that they are loaded when they are used.
+    // A buffer is skipped if it does not fit in the free memory, other buffers are never freed for it.
+    void Prefetch(const Vector<BufferObj *> &buffer_objs);
+
+    // Wait until the submitted prefetches are done.
+    void WaitPrefetch();
+
+    // Wait until the submitted prefetches of these buffers are done, prefetches of other buffers are not waited for.
+    void WaitPrefetch(const Vector<BufferObj *> &buffer_objs);
+
     inline PersistenceManager *persistence_manager() const { return persistence_manager_; }
 
     inline void AddRequestCount() { ++total_request_count_; }
@@ -106,6 +147,9 @@ private:
     // Return whether need_size is freed successfully.
     bool RequestSpace(SizeT need_size);
 
+    // Allocate need_size only if it is free without freeing any buffer.
+    bool RequestFreeSpace(SizeT need_size);
+
     // BufferHandle calls it, after unload.
     void PushGCQueue(BufferObj *buffer_obj);
 
@@ -149,6 +193,14 @@ private:
 
     Atomic<u64> total_request_count_{0};
     Atomic<u64> cache_miss_count_{0};
+
+    std::mutex prefetch_locker_{};
+    std::condition_variable prefetch_cv_{};
+    SizeT prefetch_task_count_{};
+    // submitted and not finished prefetch count of each buffer
+    HashMap<BufferObj *, SizeT> prefetching_objs_{};
+    // declared last to stop before the buffers are destroyed
+    ThreadPool prefetch_thread_pool_{DEFAULT_BUFFER_MANAGER_PREFETCH_THREAD_NUM};
 };
 
 } // namespace infinity
@@ -173,9 +173,28 @@ bool BufferObj::Free() {
     }
     file_worker_->FreeInMemory();
     status_ = BufferStatus::kFreed;
+    hot_ = false;
     return true;
 }
 
+void BufferObj::Prefetch() {
+    std::unique_lock<std::mutex> locker(w_locker_);
+    if (type_ != BufferType::kPersistent || status_ != BufferStatus::kFreed) {
+        return;
+    }
+    if (!buffer_mgr_->RequestFreeSpace(GetBufferSize())) {
+        return;
+    }
+    try {
+        file_worker_->ReadFromFile(false);
+    } catch (...) {
+        buffer_mgr_->FreeUnloadBuffer(this);
+        throw;
+    }
+    status_ = BufferStatus::kUnloaded;
+    buffer_mgr_->PushGCQueue(this);
+}
+
 bool BufferObj::Save(const FileWorkerSaveCtx &ctx) {
     bool write = false;
     std::unique_lock<std::mutex> locker(w_locker_);
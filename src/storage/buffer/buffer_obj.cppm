@@ -101,6 +101,9 @@ public:
     // called by BufferMgr in GC process.
     bool Free();
 
+    // called by BufferMgr on the prefetch threads, read the persisted buffer if it is freed and the memory is free.
+    void Prefetch();
+
     // called when checkpoint. or in "IMPORT" operator.
     bool Save(const FileWorkerSaveCtx &ctx = {});
 
@@ -146,6 +149,10 @@ public:
     u64 rc() const { return rc_; }
     u32 id() const { return id_; }
 
+    // whether the buffer was loaded again soon after it was freed, caller holds the lock of the buffer.
+    bool hot() const { return hot_; }
+    void set_hot(bool hot) { hot_ = hot; }
+
     void AddObjRc();
 
     void SubObjRc();
@@ -169,6 +176,8 @@ private:
     u32 id_;
 
     u32 obj_rc_ = 0;
+
+    bool hot_ = false;
 };
 
 } // namespace infinity
\ No newline at end of file
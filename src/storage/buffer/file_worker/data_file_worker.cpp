@@ -26,17 +26,41 @@ import logger;
 import persistence_manager;
 import serialize;
 import local_file_handle;
+import column_encoding;
+import crc;
+import virtual_store;
 
 namespace infinity {
 
+namespace {
+
+constexpr u64 DATA_FILE_MAGIC = 0x00dd3344;
+constexpr u64 ENCODED_DATA_FILE_MAGIC = 0x00dd3345;
+constexpr SizeT ENCODED_HEADER_SIZE = 5 * sizeof(u64);
+
+u64 EncodedChecksum(const char *encoded, SizeT encoded_size) {
+    return CRC32IEEE::makeCRC(reinterpret_cast<const unsigned char *>(encoded), encoded_size);
+}
+
+// The file is written in place and the encoded size changes between saves, cut off what a longer save left behind.
+void TruncateToWritten(LocalFileHandle *file_handle, SizeT written_size) {
+    Status status = VirtualStore::Truncate(file_handle->Path(), written_size);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+}
+
+} // namespace
+
 DataFileWorker::DataFileWorker(SharedPtr<String> data_dir,
                                SharedPtr<String> temp_dir,
                                SharedPtr<String> file_dir,
                                SharedPtr<String> file_name,
                                SizeT buffer_size,
-                               PersistenceManager *persistence_manager)
+                               PersistenceManager *persistence_manager,
+                               SizeT element_size)
     : FileWorker(std::move(data_dir), std::move(temp_dir), std::move(file_dir), std::move(file_name), persistence_manager),
-      buffer_size_(buffer_size) {}
+      buffer_size_(buffer_size), element_size_(ColumnEncoder::CanEncode(element_size) ? element_size : 0) {}
 
 DataFileWorker::~DataFileWorker() {
     if (data_ != nullptr) {
@@ -68,13 +92,44 @@ void DataFileWorker::FreeInMemory() {
 
 // FIXME: to_spill
 bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const FileWorkerSaveCtx &ctx) {
+    // A spilled buffer is read back soon, only the saved file is encoded.
+    if (!to_spill && element_size_ != 0) {
+        // File structure:
+        // - header: magic number
+        // - header: buffer size
+        // - header: encoding type, element size, encoded size
+        // - encoded data
+        // - footer: checksum of the encoded data
+        Vector<char> encoded;
+        ColumnEncodingType encoding_type = ColumnEncoder::Encode(static_cast<const char *>(data_), element_size_, buffer_size_ / element_size_, encoded);
+        if (encoding_type != ColumnEncodingType::kPlain) {
+            u64 header[5] = {ENCODED_DATA_FILE_MAGIC, buffer_size_, static_cast<u64>(encoding_type), element_size_, encoded.size()};
+            Status status = file_handle_->Append(header, sizeof(header));
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
+            status = file_handle_->Append(encoded.data(), encoded.size());
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
+            u64 checksum = EncodedChecksum(encoded.data(), encoded.size());
+            status = file_handle_->Append(&checksum, sizeof(checksum));
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
+            TruncateToWritten(file_handle_.get(), ENCODED_HEADER_SIZE + encoded.size() + sizeof(checksum));
+            prepare_success = true;
+            return true;
+        }
+    }
+
     // File structure:
     // - header: magic number
     // - header: buffer size
     // - data buffer
     // - footer: checksum
 
-    u64 magic_number = 0x00dd3344;
+    u64 magic_number = DATA_FILE_MAGIC;
     Status status = file_handle_->Append(&magic_number, sizeof(magic_number));
     if (!status.ok()) {
         RecoverableError(status);
@@ -95,6 +150,7 @@ bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const
     if (!status.ok()) {
         RecoverableError(status);
     }
+    TruncateToWritten(file_handle_.get(), buffer_size_ + 3 * sizeof(u64));
     prepare_success = true; // Not run defer_fn
     return true;
 }
@@ -116,7 +172,10 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size, bool from_spill) {
         Status status = Status::DataIOError(fmt::format("Read magic number which length isn't {}.", nbytes1));
         RecoverableError(status);
     }
-    if (magic_number != 0x00dd3344) {
+    if (magic_number == ENCODED_DATA_FILE_MAGIC) {
+        return ReadEncodedFromFile(file_size);
+    }
+    if (magic_number != DATA_FILE_MAGIC) {
         Status status = Status::DataIOError(fmt::format("Read magic error, {} != 0x00dd3344.", magic_number));
         RecoverableError(status);
     }
@@ -135,7 +194,7 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size, bool from_spill) {
 
     // file body
     data_ = static_cast<void *>(new char[buffer_size_]);
-    auto [nbytes3, status3] = file_handle_->Read(data_, buffer_size_);
+    auto [nbytes3, status3] = file_handle_->BatchRead(data_, buffer_size_);
     if (nbytes3 != buffer_size_) {
         Status status = Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes3));
         RecoverableError(status);
@@ -150,10 +209,70 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size, bool from_spill) {
     }
 }
 
+void DataFileWorker::ReadEncodedFromFile(SizeT file_size) {
+    // the magic number is read
+    u64 header[4]{};
+    auto [nbytes1, status1] = file_handle_->Read(header, sizeof(header));
+    if (!status1.ok()) {
+        RecoverableError(status1);
+    }
+    const auto [buffer_size, encoding_type, element_size, encoded_size] = header;
+    if (nbytes1 != sizeof(header) || buffer_size != buffer_size_ || element_size == 0 || file_size != ENCODED_HEADER_SIZE + encoded_size + sizeof(u64)) {
+        Status status = Status::DataIOError(fmt::format("Invalid encoded data file header, file size: {}, buffer size: {} / {}, encoded size: {}",
+                                                        file_size,
+                                                        buffer_size,
+                                                        buffer_size_,
+                                                        encoded_size));
+        RecoverableError(status);
+    }
+
+    auto encoded = MakeUnique<char[]>(encoded_size);
+    auto [nbytes2, status2] = file_handle_->BatchRead(encoded.get(), encoded_size);
+    if (nbytes2 != encoded_size) {
+        Status status = Status::DataIOError(fmt::format("Expect to read encoded buffer with size: {}, but {} bytes is read", encoded_size, nbytes2));
+        RecoverableError(status);
+    }
+    u64 checksum{0};
+    auto [nbytes3, status3] = file_handle_->Read(&checksum, sizeof(checksum));
+    if (nbytes3 != sizeof(checksum) || checksum != EncodedChecksum(encoded.get(), encoded_size)) {
+        Status status = Status::DataIOError(fmt::format("Checksum mismatch of encoded data file {}.", GetFilePath()));
+        RecoverableError(status);
+    }
+
+    auto *data = new char[buffer_size_];
+    data_ = static_cast<void *>(data);
+    ColumnEncoder::Decode(static_cast<ColumnEncodingType>(encoding_type), encoded.get(), encoded_size, element_size, buffer_size_ / element_size, data);
+}
+
 bool DataFileWorker::ReadFromMmapImpl(const void *p, SizeT file_size) {
     const char *ptr = static_cast<const char *>(p);
     u64 magic_number = ReadBufAdv<u64>(ptr);
-    if (magic_number != 0x00dd3344) {
+    if (magic_number == ENCODED_DATA_FILE_MAGIC) {
+        // encoded data can't be mapped, it is decoded into memory owned by the worker. This costs a decode and a heap buffer per
+        // load, readers expect plain values.
+        if (file_size < ENCODED_HEADER_SIZE + sizeof(u64)) {
+            Status status = Status::DataIOError(fmt::format("Incorrect encoded file length {}.", file_size));
+            RecoverableError(status);
+        }
+        const u64 buffer_size = ReadBufAdv<u64>(ptr);
+        const auto encoding_type = static_cast<ColumnEncodingType>(ReadBufAdv<u64>(ptr));
+        const u64 element_size = ReadBufAdv<u64>(ptr);
+        const u64 encoded_size = ReadBufAdv<u64>(ptr);
+        if (element_size == 0 || file_size != ENCODED_HEADER_SIZE + encoded_size + sizeof(u64)) {
+            Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, ENCODED_HEADER_SIZE + encoded_size + sizeof(u64)));
+            RecoverableError(status);
+        }
+        const u64 checksum = ReadBuf<u64>(ptr + encoded_size);
+        if (checksum != EncodedChecksum(ptr, encoded_size)) {
+            Status status = Status::DataIOError(fmt::format("Checksum mismatch of encoded data file {}.", GetFilePath()));
+            RecoverableError(status);
+        }
+        decoded_mmap_data_ = MakeUnique<char[]>(buffer_size);
+        ColumnEncoder::Decode(encoding_type, ptr, encoded_size, element_size, buffer_size / element_size, decoded_mmap_data_.get());
+        mmap_data_ = reinterpret_cast<u8 *>(decoded_mmap_data_.get());
+        return true;
+    }
+    if (magic_number != DATA_FILE_MAGIC) {
         Status status = Status::DataIOError(fmt::format("Read magic error: {} != 0x00dd3344.", magic_number));
         RecoverableError(status);
     }
@@ -168,6 +287,6 @@ bool DataFileWorker::ReadFromMmapImpl(const void *p, SizeT file_size) {
     return true;
 }
 
-void DataFileWorker::FreeFromMmapImpl() {}
+void DataFileWorker::FreeFromMmapImpl() { decoded_mmap_data_.reset(); }
 
 } // namespace infinity
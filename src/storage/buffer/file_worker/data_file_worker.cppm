@@ -30,7 +30,8 @@ public:
                             SharedPtr<String> file_dir,
                             SharedPtr<String> file_name,
                             SizeT buffer_size,
-                            PersistenceManager *persistence_manager);
+                            PersistenceManager *persistence_manager,
+                            SizeT element_size = 0);
 
     virtual ~DataFileWorker() override;
 
@@ -53,6 +54,10 @@ protected:
     void FreeFromMmapImpl() override;
 
 private:
+    void ReadEncodedFromFile(SizeT file_size);
+
     const SizeT buffer_size_;
+    const SizeT element_size_; // width of the fixed-width values in the buffer, 0 if they can't be encoded
+    UniquePtr<char[]> decoded_mmap_data_{};
 };
 } // namespace infinity
\ No newline at end of file
@@ -73,9 +73,10 @@ bool SecondaryIndexFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_succ
 
 void SecondaryIndexFileWorker::ReadFromFileImpl(SizeT file_size, bool from_spill) {
     if (!data_) [[likely]] {
-        auto index = GetSecondaryIndexData(column_def_->type(), row_count_, false);
+        // the chunk may be refused when it is saved in an older format
+        UniquePtr<SecondaryIndexData> index(GetSecondaryIndexData(column_def_->type(), row_count_, false));
         index->ReadIndexInner(*file_handle_);
-        data_ = static_cast<void *>(index);
+        data_ = static_cast<void *>(index.release());
         LOG_TRACE("Finished ReadFromFileImpl().");
     } else {
         UnrecoverableError("ReadFromFileImpl: data_ is not nullptr");
@@ -20,6 +20,7 @@ import stl;
 import base_memindex;
 import secondary_index_in_mem;
 import ivf_index_data_in_mem;
+import diskann_index_in_mem;
 import emvb_index_in_mem;
 import memory_indexer;
 #ifdef INDEX_HANDLER
@@ -43,6 +44,7 @@ void MemIndex::ClearMemIndex() {
     memory_secondary_index_.reset();
     memory_emvb_index_.reset();
     memory_bmp_index_.reset();
+    memory_diskann_index_.reset();
 }
 
 BaseMemIndex *MemIndex::GetBaseMemIndex(const MemIndexID &mem_index_id) {
@@ -57,6 +59,8 @@ BaseMemIndex *MemIndex::GetBaseMemIndex(const MemIndexID &mem_index_id) {
         res = static_cast<BaseMemIndex *>(memory_secondary_index_.get());
     } else if (memory_bmp_index_.get() != nullptr) {
         res = static_cast<BaseMemIndex *>(memory_bmp_index_.get());
+    } else if (memory_diskann_index_.get() != nullptr) {
+        res = static_cast<BaseMemIndex *>(memory_diskann_index_.get());
     } else {
         return nullptr;
     }
@@ -80,6 +84,8 @@ const BaseMemIndex *MemIndex::GetBaseMemIndex() const {
         res = static_cast<BaseMemIndex *>(memory_secondary_index_.get());
     } else if (memory_bmp_index_.get() != nullptr) {
         res = static_cast<BaseMemIndex *>(memory_bmp_index_.get());
+    } else if (memory_diskann_index_.get() != nullptr) {
+        res = static_cast<BaseMemIndex *>(memory_diskann_index_.get());
     } else {
         return nullptr;
     }
@@ -99,6 +105,8 @@ void MemIndex::SetBaseMemIndexInfo(const String &db_name, const String &table_na
         res = static_cast<BaseMemIndex *>(memory_secondary_index_.get());
     } else if (memory_bmp_index_.get() != nullptr) {
         res = static_cast<BaseMemIndex *>(memory_bmp_index_.get());
+    } else if (memory_diskann_index_.get() != nullptr) {
+        res = static_cast<BaseMemIndex *>(memory_diskann_index_.get());
     } else {
         return;
     }
@@ -27,6 +27,7 @@ class MemoryIndexer;
 class SecondaryIndexInMem;
 class EMVBIndexInMem;
 class BMPIndexInMem;
+class DiskAnnIndexInMem;
 
 export struct MemIndexID {
     String db_name_;
@@ -73,6 +74,11 @@ export struct MemIndex {
         return memory_bmp_index_;
     }
 
+    SharedPtr<DiskAnnIndexInMem> GetDiskAnnIndex() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        return memory_diskann_index_;
+    }
+
     mutable std::mutex mtx_; // Used by append / mem index dump / clear
 
     SharedPtr<HnswIndexInMem> memory_hnsw_index_{};
@@ -81,6 +87,7 @@ export struct MemIndex {
     SharedPtr<SecondaryIndexInMem> memory_secondary_index_{};
     SharedPtr<EMVBIndexInMem> memory_emvb_index_{};
     SharedPtr<BMPIndexInMem> memory_bmp_index_{};
+    SharedPtr<DiskAnnIndexInMem> memory_diskann_index_{};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -257,6 +257,29 @@ Tuple<SizeT, Status> BlockMeta::GetRowCnt1() {
 #endif
 }
 
+Tuple<SizeT, Status> BlockMeta::GetDeleteCnt() {
+    SharedPtr<BlockLock> block_lock;
+    Status status = this->GetBlockLock(block_lock);
+    if (!status.ok()) {
+        return {0, status};
+    }
+    BufferObj *version_buffer;
+    std::tie(version_buffer, status) = this->GetVersionBuffer();
+    if (!status.ok()) {
+        return {0, status};
+    }
+
+    BufferHandle buffer_handle = version_buffer->Load();
+    const auto *block_version = reinterpret_cast<const BlockVersion *>(buffer_handle.GetData());
+
+    SizeT delete_cnt = 0;
+    {
+        std::shared_lock lock(block_lock->mtx_);
+        delete_cnt = block_version->GetDeleteCount(begin_ts_);
+    }
+    return {delete_cnt, Status::OK()};
+}
+
 Tuple<SharedPtr<BlockInfo>, Status> BlockMeta::GetBlockInfo() {
     SharedPtr<BlockInfo> block_info = MakeShared<BlockInfo>();
     auto [row_count, status] = this->GetRowCnt1();
@@ -60,6 +60,9 @@ public:
 
     Tuple<SizeT, Status> GetRowCnt1();
 
+    // rows deleted before begin_ts
+    Tuple<SizeT, Status> GetDeleteCnt();
+
     Tuple<BufferObj *, Status> GetVersionBuffer();
 
     Vector<String> FilePaths();
@@ -14,6 +14,7 @@
 
 module;
 
+#include <bit>
 #include <fstream>
 
 module block_version;
@@ -27,6 +28,8 @@ import column_vector;
 import serialize;
 import local_file_handle;
 import status;
+import roaring_bitmap;
+import simd_common_tools;
 
 namespace infinity {
 
@@ -109,6 +112,16 @@ Tuple<i32, Status> BlockVersion::GetRowCountForUpdate(TxnTimeStamp begin_ts) con
     return {row_count, Status::OK()};
 }
 
+i32 BlockVersion::GetDeleteCount(TxnTimeStamp begin_ts) const {
+    i32 delete_count = 0;
+    for (TxnTimeStamp delete_ts : deleted_) {
+        if (delete_ts != 0 && delete_ts <= begin_ts) {
+            ++delete_count;
+        }
+    }
+    return delete_count;
+}
+
 void BlockVersion::SaveToFile(TxnTimeStamp checkpoint_ts, LocalFileHandle &file_handle) const {
     BlockOffset create_size = created_.size();
     while (create_size > 0 && created_[create_size - 1].create_ts_ > checkpoint_ts) {
@@ -172,6 +185,15 @@ UniquePtr<BlockVersion> BlockVersion::LoadFromFile(LocalFileHandle *file_handle)
     for (BlockOffset i = 0; i < capacity; i++) {
         file_handle->Read(&block_version->deleted_[i], sizeof(TxnTimeStamp));
     }
+
+    // the cached delete bitmap is keyed by the latest delete
+    TxnTimeStamp max_delete_ts = 0;
+    for (TxnTimeStamp delete_ts : block_version->deleted_) {
+        max_delete_ts = std::max(max_delete_ts, delete_ts);
+    }
+    TxnTimeStamp latest_change_ts = block_version->created_.empty() ? 0 : block_version->created_.back().create_ts_;
+    block_version->latest_change_ts_ = std::max(latest_change_ts, max_delete_ts);
+    block_version->max_delete_ts_ = max_delete_ts;
     return block_version;
 }
 
@@ -204,7 +226,7 @@ void BlockVersion::GetDeleteTS(SizeT offset, SizeT size, ColumnVector &res) cons
 
 void BlockVersion::Append(TxnTimeStamp commit_ts, i32 row_count) {
     created_.emplace_back(commit_ts, row_count);
-    latest_change_ts_ = commit_ts;
+    latest_change_ts_ = std::max(latest_change_ts_, commit_ts);
 }
 
 void BlockVersion::CommitAppend(TxnTimeStamp save_ts, TxnTimeStamp commit_ts) {
@@ -221,11 +243,19 @@ Status BlockVersion::Delete(i32 offset, TxnTimeStamp commit_ts) {
         return Status::TxnWWConflict(fmt::format("Delete twice at offset: {}, commit_ts: {}, old_ts: {}", offset, commit_ts, deleted_[offset]));
     }
     deleted_[offset] = commit_ts;
-    latest_change_ts_ = commit_ts;
+    latest_change_ts_ = std::max(latest_change_ts_, commit_ts);
+    // Deletes are applied out of commit order, one below max_delete_ts_ has to drop the cached bitmap as well.
+    std::unique_lock lock(delete_bitmap_mtx_);
+    max_delete_ts_ = std::max(max_delete_ts_, commit_ts);
+    delete_bitmap_.reset();
     return Status::OK();
 }
 
-void BlockVersion::RollbackDelete(i32 offset) { deleted_[offset] = 0; } // FIXME latest_change_ts_ ?
+void BlockVersion::RollbackDelete(i32 offset) {
+    deleted_[offset] = 0; // FIXME latest_change_ts_ ?
+    std::unique_lock lock(delete_bitmap_mtx_);
+    delete_bitmap_.reset();
+}
 
 bool BlockVersion::CheckDelete(i32 offset, TxnTimeStamp check_ts) const {
     if (SizeT(offset) >= deleted_.size()) {
@@ -234,6 +264,37 @@ bool BlockVersion::CheckDelete(i32 offset, TxnTimeStamp check_ts) const {
     return deleted_[offset] != 0 && deleted_[offset] <= check_ts;
 }
 
+SharedPtr<const Bitmap> BlockVersion::GetDeleteBitmap(TxnTimeStamp begin_ts) const {
+    std::unique_lock lock(delete_bitmap_mtx_);
+    if (begin_ts < max_delete_ts_) {
+        // an older snapshot, some deletes may not be visible to it
+        lock.unlock();
+        return BuildDeleteBitmap(begin_ts);
+    }
+    if (delete_bitmap_.get() == nullptr) {
+        delete_bitmap_ = BuildDeleteBitmap(max_delete_ts_);
+    }
+    return delete_bitmap_;
+}
+
+SharedPtr<Bitmap> BlockVersion::BuildDeleteBitmap(TxnTimeStamp check_ts) const {
+    const SizeT capacity = deleted_.size();
+    auto bitmap = Bitmap::MakeSharedAllFalse(capacity);
+    const TxnTimeStamp *delete_ts = deleted_.data();
+    SizeT row_idx = 0;
+    for (; row_idx + 64 <= capacity; row_idx += 64) {
+        for (u64 mask = TimestampsNotAfter64(delete_ts + row_idx, check_ts); mask != 0; mask &= mask - 1) {
+            bitmap->SetTrue(row_idx + std::countr_zero(mask));
+        }
+    }
+    for (; row_idx < capacity; ++row_idx) {
+        if (delete_ts[row_idx] != 0 && delete_ts[row_idx] <= check_ts) {
+            bitmap->SetTrue(row_idx);
+        }
+    }
+    return bitmap;
+}
+
 Status BlockVersion::Print(TxnTimeStamp begin_ts, i32 offset, bool ignore_invisible) {
     i32 row_count = 0;
     for (const auto &created_range : created_) {
@@ -19,6 +19,7 @@ export module block_version;
 import stl;
 import local_file_handle;
 import status;
+import roaring_bitmap;
 
 namespace infinity {
 
@@ -55,6 +56,8 @@ export struct BlockVersion {
 
     Tuple<i32, Status> GetRowCountForUpdate(TxnTimeStamp begin_ts) const;
 
+    i32 GetDeleteCount(TxnTimeStamp begin_ts) const;
+
     void SaveToFile(TxnTimeStamp checkpoint_ts, LocalFileHandle &file_handler) const;
 
     void SpillToFile(LocalFileHandle *file_handle) const;
@@ -74,6 +77,10 @@ export struct BlockVersion {
 
     bool CheckDelete(i32 offset, TxnTimeStamp check_ts) const;
 
+    // Rows deleted at or before begin_ts. The snapshots taken after the latest delete of the block share one immutable bitmap,
+    // which is rebuilt after every delete.
+    SharedPtr<const Bitmap> GetDeleteBitmap(TxnTimeStamp begin_ts) const;
+
     Status Print(TxnTimeStamp commit_ts, i32 offset, bool ignore_invisible);
 
     TxnTimeStamp latest_change_ts() const { return latest_change_ts_; }
@@ -84,6 +91,13 @@ private:
     Vector<TxnTimeStamp> deleted_{};
 
     TxnTimeStamp latest_change_ts_{}; // used by checkpoint to decide if the version file need to be flushed or not.
+
+    SharedPtr<Bitmap> BuildDeleteBitmap(TxnTimeStamp check_ts) const;
+
+    // Readers only hold the shared block lock, so the cached bitmap has a lock of its own
+    mutable std::mutex delete_bitmap_mtx_{};
+    mutable SharedPtr<const Bitmap> delete_bitmap_{};
+    TxnTimeStamp max_delete_ts_{}; // guarded by delete_bitmap_mtx_
 };
 
 } // namespace infinity
@@ -25,6 +25,7 @@ import table_index_meeta;
 import segment_index_meta;
 
 import index_base;
+import index_full_text;
 import column_def;
 import index_defines;
 import create_index_info;
@@ -36,6 +37,7 @@ import raw_file_worker;
 import hnsw_file_worker;
 import bmp_index_file_worker;
 import emvb_index_file_worker;
+import diskann_index_file_worker;
 import infinity_exception;
 
 import persistence_manager;
@@ -126,12 +128,13 @@ Status ChunkIndexMeta::InitSet(const ChunkIndexMetaInfo &chunk_info) {
                 break;
             }
             case IndexType::kFullText: {
+                const auto *index_fulltext = static_cast<const IndexFullText *>(index_base.get());
                 auto column_length_file_name = MakeShared<String>(chunk_info.base_name_ + LENGTH_SUFFIX);
                 auto index_file_worker = MakeUnique<RawFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
                                                                    MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                                    index_dir,
                                                                    std::move(column_length_file_name),
-                                                                   chunk_info.row_cnt_ * sizeof(u32),
+                                                                   chunk_info.row_cnt_ * ColumnLengthEntrySize(index_fulltext->flag_),
                                                                    buffer_mgr->persistence_manager());
                 index_buffer_ = buffer_mgr->GetBufferObject(std::move(index_file_worker));
                 break;
@@ -189,7 +192,15 @@ Status ChunkIndexMeta::InitSet(const ChunkIndexMetaInfo &chunk_info) {
                 break;
             }
             case IndexType::kDiskAnn: {
-                LOG_WARN("Not implemented");
+                auto diskann_index_file_name = MakeShared<String>(IndexFileName(chunk_id_));
+                auto index_file_worker = MakeUnique<DiskAnnIndexFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
+                                                                            MakeShared<String>(InfinityContext::instance().config()->TempDir()),
+                                                                            index_dir,
+                                                                            std::move(diskann_index_file_name),
+                                                                            index_base,
+                                                                            column_def,
+                                                                            buffer_mgr->persistence_manager());
+                index_buffer_ = buffer_mgr->AllocateBufferObject(std::move(index_file_worker));
                 break;
             }
             default: {
@@ -244,12 +255,13 @@ Status ChunkIndexMeta::LoadSet() {
             break;
         }
         case IndexType::kFullText: {
+            const auto *index_fulltext = static_cast<const IndexFullText *>(index_base.get());
             auto column_length_file_name = MakeShared<String>(base_name + LENGTH_SUFFIX);
             auto index_file_worker = MakeUnique<RawFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
                                                                MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                                index_dir,
                                                                std::move(column_length_file_name),
-                                                               row_count * sizeof(u32),
+                                                               row_count * ColumnLengthEntrySize(index_fulltext->flag_),
                                                                buffer_mgr->persistence_manager());
             index_buffer_ = buffer_mgr->GetBufferObject(std::move(index_file_worker));
             break;
@@ -292,6 +304,18 @@ Status ChunkIndexMeta::LoadSet() {
             index_buffer_ = buffer_mgr->GetBufferObject(std::move(file_worker));
             break;
         }
+        case IndexType::kDiskAnn: {
+            auto diskann_index_file_name = MakeShared<String>(IndexFileName(chunk_id_));
+            auto index_file_worker = MakeUnique<DiskAnnIndexFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
+                                                                        MakeShared<String>(InfinityContext::instance().config()->TempDir()),
+                                                                        index_dir,
+                                                                        std::move(diskann_index_file_name),
+                                                                        index_base,
+                                                                        column_def,
+                                                                        buffer_mgr->persistence_manager());
+            index_buffer_ = buffer_mgr->GetBufferObject(std::move(index_file_worker));
+            break;
+        }
         case IndexType::kEMVB: {
             auto emvb_index_file_name = MakeShared<String>(IndexFileName(chunk_id_));
             const auto segment_start_offset = base_row_id.segment_offset_;
@@ -355,12 +379,13 @@ Status ChunkIndexMeta::RestoreSet() {
             break;
         }
         case IndexType::kFullText: {
+            const auto *index_fulltext = static_cast<const IndexFullText *>(index_base.get());
             auto column_length_file_name = MakeShared<String>(base_name + LENGTH_SUFFIX);
             index_file_worker = MakeUnique<RawFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
                                                           MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                           index_dir,
                                                           std::move(column_length_file_name),
-                                                          row_count * sizeof(u32),
+                                                          row_count * ColumnLengthEntrySize(index_fulltext->flag_),
                                                           buffer_mgr->persistence_manager());
             break;
         }
@@ -399,6 +424,17 @@ Status ChunkIndexMeta::RestoreSet() {
                                                                index_size);
             break;
         }
+        case IndexType::kDiskAnn: {
+            auto diskann_index_file_name = MakeShared<String>(IndexFileName(chunk_id_));
+            index_file_worker = MakeUnique<DiskAnnIndexFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
+                                                                   MakeShared<String>(InfinityContext::instance().config()->TempDir()),
+                                                                   index_dir,
+                                                                   std::move(diskann_index_file_name),
+                                                                   index_base,
+                                                                   column_def,
+                                                                   buffer_mgr->persistence_manager());
+            break;
+        }
         case IndexType::kEMVB: {
             auto emvb_index_file_name = MakeShared<String>(IndexFileName(chunk_id_));
             const auto segment_start_offset = base_row_id.segment_offset_;
@@ -72,17 +72,20 @@ Status ColumnMeta::InitSet() {
     {
         auto filename = MakeShared<String>(fmt::format("{}.col", column_id));
         SizeT total_data_size = 0;
+        SizeT element_size = 0; // booleans are bit packed and not encoded
         if (col_def->type()->type() == LogicalType::kBoolean) {
             total_data_size = (block_meta_.block_capacity() + 7) / 8;
         } else {
-            total_data_size = block_meta_.block_capacity() * col_def->type()->Size();
+            element_size = col_def->type()->Size();
+            total_data_size = block_meta_.block_capacity() * element_size;
         }
         auto file_worker = MakeUnique<DataFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
                                                       MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                       block_dir_ptr,
                                                       filename,
                                                       total_data_size,
-                                                      buffer_mgr->persistence_manager());
+                                                      buffer_mgr->persistence_manager(),
+                                                      element_size);
         column_buffer_ = buffer_mgr->AllocateBufferObject(std::move(file_worker));
         if (!column_buffer_) {
             return Status::BufferManagerError(fmt::format("Get buffer object failed: {}", file_worker->GetFilePath()));
@@ -124,17 +127,20 @@ Status ColumnMeta::LoadSet() {
     {
         auto filename = MakeShared<String>(fmt::format("{}.col", col_def->id()));
         SizeT total_data_size = 0;
+        SizeT element_size = 0; // booleans are bit packed and not encoded
         if (col_def->type()->type() == LogicalType::kBoolean) {
             total_data_size = (block_meta_.block_capacity() + 7) / 8;
         } else {
-            total_data_size = block_meta_.block_capacity() * col_def->type()->Size();
+            element_size = col_def->type()->Size();
+            total_data_size = block_meta_.block_capacity() * element_size;
         }
         auto file_worker = MakeUnique<DataFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
                                                       MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                       block_dir_ptr,
                                                       filename,
                                                       total_data_size,
-                                                      buffer_mgr->persistence_manager());
+                                                      buffer_mgr->persistence_manager(),
+                                                      element_size);
         column_buffer_ = buffer_mgr->GetBufferObject(std::move(file_worker));
         if (!column_buffer_) {
             return Status::BufferManagerError(fmt::format("Get buffer object failed: {}", file_worker->GetFilePath()));
@@ -174,17 +180,20 @@ Status ColumnMeta::RestoreSet(const ColumnDef *column_def) {
     {
         auto filename = MakeShared<String>(fmt::format("{}.col", column_def->id()));
         SizeT total_data_size = 0;
+        SizeT element_size = 0; // booleans are bit packed and not encoded
         if (column_def->type()->type() == LogicalType::kBoolean) {
             total_data_size = (block_meta_.block_capacity() + 7) / 8;
         } else {
-            total_data_size = block_meta_.block_capacity() * column_def->type()->Size();
+            element_size = column_def->type()->Size();
+            total_data_size = block_meta_.block_capacity() * element_size;
         }
         auto file_worker = MakeUnique<DataFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
                                                       MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                       block_dir_ptr,
                                                       filename,
                                                       total_data_size,
-                                                      buffer_mgr->persistence_manager());
+                                                      buffer_mgr->persistence_manager(),
+                                                      element_size);
         auto *buffer_obj = buffer_mgr->GetBufferObject(file_worker->GetFilePath());
         if (buffer_obj == nullptr) {
             column_buffer_ = buffer_mgr->GetBufferObject(std::move(file_worker));
@@ -434,6 +434,25 @@ Tuple<SizeT, Status> SegmentMeta::GetRowCnt1() {
 #endif
 }
 
+Tuple<SizeT, Status> SegmentMeta::GetDeleteCnt() {
+    Vector<BlockID> *block_ids_ptr = nullptr;
+    Status status;
+    std::tie(block_ids_ptr, status) = GetBlockIDs1();
+    if (!status.ok()) {
+        return {0, status};
+    }
+    SizeT delete_cnt = 0;
+    for (BlockID block_id : *block_ids_ptr) {
+        BlockMeta block_meta(block_id, *this);
+        auto [block_delete_cnt, block_status] = block_meta.GetDeleteCnt();
+        if (!block_status.ok()) {
+            return {0, block_status};
+        }
+        delete_cnt += block_delete_cnt;
+    }
+    return {delete_cnt, Status::OK()};
+}
+
 Tuple<BlockID, Status> SegmentMeta::GetNextBlockID() {
     if (!next_block_id_) {
         Status status = LoadNextBlockID();
@@ -97,6 +97,9 @@ public:
 
     // Tuple<SizeT, Status> GetRowCnt();
     Tuple<SizeT, Status> GetRowCnt1();
+
+    // rows deleted before begin_ts, read from the version of every block
+    Tuple<SizeT, Status> GetDeleteCnt();
     Tuple<BlockID, Status> GetNextBlockID();
 
     Status GetFirstDeleteTS(TxnTimeStamp &first_delete_ts);
@@ -193,6 +193,10 @@ Vector<Pair<String, String>> NewCatalog::GetAllMemIndexInfo() {
                 result.push_back({mem_index_pair.first, "bmp"});
                 continue;
             }
+            if (mem_index_pair.second->memory_diskann_index_ != nullptr) {
+                result.push_back({mem_index_pair.first, "diskann"});
+                continue;
+            }
             result.push_back({mem_index_pair.first, "empty"});
         }
     }
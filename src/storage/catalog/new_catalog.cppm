@@ -66,6 +66,7 @@ enum class ColumnVectorTipe;
 template <bool init_all_true>
 struct RoaringBitmap;
 using Bitmask = RoaringBitmap<true>;
+using Bitmap = RoaringBitmap<false>;
 
 export struct TableLockForMemIndex {
     std::mutex mtx_;
@@ -119,6 +120,7 @@ private:
     BlockOffset block_offset_begin_ = 0;
     BlockOffset block_offset_end_ = 0;
     bool end_ = false;
+    SharedPtr<const Bitmap> delete_bitmap_; // rows deleted at begin_ts_
 };
 
 export class NewTxnBlockVisitor {
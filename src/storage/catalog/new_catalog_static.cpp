@@ -70,6 +70,7 @@ void NewTxnGetVisibleRangeState::Init(SharedPtr<BlockLock> block_lock,
         std::shared_lock<std::shared_mutex> lock(block_lock_->mtx_);
         const auto *block_version = reinterpret_cast<const BlockVersion *>(version_buffer_handle_.GetData());
         block_offset_end_ = block_version->GetRowCount(begin_ts_);
+        delete_bitmap_ = block_version->GetDeleteBitmap(begin_ts_);
     }
 }
 
@@ -87,15 +88,17 @@ bool NewTxnGetVisibleRangeState::Next(BlockOffset block_offset_begin, Pair<Block
         return commit_cnt;
     }
 
-    std::shared_lock<std::shared_mutex> lock(block_lock_->mtx_);
-    while (block_offset_begin < block_offset_end_ && block_version->CheckDelete(block_offset_begin, begin_ts_)) {
+    if (delete_bitmap_->CountTrue() == 0) {
+        // nothing deleted, all rows up to the end are visible
+        visible_range = {block_offset_begin, block_offset_end_};
+        return block_offset_begin < block_offset_end_;
+    }
+    while (block_offset_begin < block_offset_end_ && delete_bitmap_->IsTrue(block_offset_begin)) {
         ++block_offset_begin;
     }
-    BlockOffset row_idx;
-    for (row_idx = block_offset_begin; row_idx < block_offset_end_; ++row_idx) {
-        if (block_version->CheckDelete(row_idx, begin_ts_)) {
-            break;
-        }
+    BlockOffset row_idx = block_offset_end_;
+    if (block_offset_begin < block_offset_end_) {
+        row_idx = std::min(static_cast<BlockOffset>(delete_bitmap_->NextTrue(block_offset_begin)), block_offset_end_);
     }
     visible_range = {block_offset_begin, row_idx};
     return block_offset_begin < row_idx;
@@ -1480,29 +1483,32 @@ Status NewCatalog::CheckTableIfDelete(TableMeeta &table_meta, TxnTimeStamp begin
     return Status::OK();
 }
 
-Status NewCatalog::SetBlockDeleteBitmask(BlockMeta &block_meta, TxnTimeStamp begin_ts, TxnTimeStamp commit_ts, Bitmask &bitmask) {
-    NewTxnGetVisibleRangeState state;
-    Status status = GetBlockVisibleRange(block_meta, begin_ts, commit_ts, state);
+Status NewCatalog::SetBlockDeleteBitmask(BlockMeta &block_meta, TxnTimeStamp begin_ts, TxnTimeStamp, Bitmask &bitmask) {
+    auto [version_buffer, status] = block_meta.GetVersionBuffer();
     if (!status.ok()) {
         return status;
     }
-    Pair<BlockOffset, BlockOffset> range;
-    BlockOffset offset = 0;
-    while (true) {
-        bool has_next = state.Next(offset, range);
-        if (!has_next) {
-            break;
-        }
-        for (BlockOffset i = offset; i < range.first; ++i) {
-            SegmentOffset off = block_meta.block_capacity() * block_meta.block_id() + i;
-            bitmask.SetFalse(off);
-        }
-        offset = range.second;
-    }
-    for (BlockOffset i = offset; i < state.block_offset_end(); ++i) {
-        bitmask.SetFalse(i);
+    SharedPtr<BlockLock> block_lock;
+    status = block_meta.GetBlockLock(block_lock);
+    if (!status.ok()) {
+        return status;
     }
 
+    SharedPtr<const Bitmap> delete_bitmap;
+    {
+        BufferHandle buffer_handle = version_buffer->Load();
+        std::shared_lock<std::shared_mutex> lock(block_lock->mtx_);
+        const auto *block_version = reinterpret_cast<const BlockVersion *>(buffer_handle.GetData());
+        delete_bitmap = block_version->GetDeleteBitmap(begin_ts);
+    }
+    if (delete_bitmap->CountTrue() == 0) {
+        return Status::OK();
+    }
+    const SegmentOffset block_start = block_meta.block_capacity() * block_meta.block_id();
+    delete_bitmap->RoaringBitmapApplyFunc([&](u32 block_offset) {
+        bitmask.SetFalse(block_start + block_offset);
+        return true;
+    });
     return Status::OK();
 }
 
@@ -0,0 +1,470 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <cstring>
+
+module column_encoding;
+
+import stl;
+import status;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+String ToString(ColumnEncodingType encoding_type) {
+    switch (encoding_type) {
+        case ColumnEncodingType::kPlain:
+            return "Plain";
+        case ColumnEncodingType::kDictionary:
+            return "Dictionary";
+        case ColumnEncodingType::kRLE:
+            return "RLE";
+        case ColumnEncodingType::kFrameOfReference:
+            return "FrameOfReference";
+    }
+    return "Invalid";
+}
+
+namespace {
+
+SizeT PackedWordCount(SizeT count, u32 bit_width) { return (count * bit_width + 63) / 64; }
+
+template <typename T>
+void AppendRaw(Vector<char> &output, const T *values, SizeT count) {
+    const auto *bytes = reinterpret_cast<const char *>(values);
+    output.insert(output.end(), bytes, bytes + count * sizeof(T));
+}
+
+template <typename T>
+T LoadRaw(const char *ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+// Appends count values of bit_width bits each, value_of(idx) gives the idx-th one.
+template <typename ValueOf>
+void PackBits(SizeT count, u32 bit_width, ValueOf &&value_of, Vector<char> &output) {
+    Vector<u64> words(PackedWordCount(count, bit_width), 0);
+    if (bit_width > 0) {
+        for (SizeT idx = 0; idx < count; ++idx) {
+            const u64 value = value_of(idx);
+            const SizeT bit = idx * bit_width;
+            const SizeT word_idx = bit / 64;
+            const u32 shift = bit % 64;
+            words[word_idx] |= value << shift;
+            if (shift + bit_width > 64) {
+                words[word_idx + 1] |= value >> (64 - shift);
+            }
+        }
+    }
+    AppendRaw(output, words.data(), words.size());
+}
+
+template <typename Sink>
+void UnpackBits(const char *packed, SizeT count, u32 bit_width, Sink &&sink) {
+    if (bit_width == 0) {
+        for (SizeT idx = 0; idx < count; ++idx) {
+            sink(idx, 0);
+        }
+        return;
+    }
+    const u64 mask = bit_width == 64 ? ~u64(0) : (u64(1) << bit_width) - 1;
+    for (SizeT idx = 0; idx < count; ++idx) {
+        const SizeT bit = idx * bit_width;
+        const SizeT word_idx = bit / 64;
+        const u32 shift = bit % 64;
+        u64 value = LoadRaw<u64>(packed + word_idx * sizeof(u64)) >> shift;
+        if (shift + bit_width > 64) {
+            value |= LoadRaw<u64>(packed + (word_idx + 1) * sizeof(u64)) << (64 - shift);
+        }
+        sink(idx, value & mask);
+    }
+}
+
+void CheckEncodedSize(SizeT expected, SizeT encoded_size, ColumnEncodingType encoding_type) {
+    if (encoded_size < expected) {
+        Status status = Status::DataIOError(fmt::format("{} encoded column is truncated: {} < {} bytes", ToString(encoding_type), encoded_size, expected));
+        RecoverableError(status);
+    }
+}
+
+// The values are handled as unsigned integers of their width. Flipping the sign bit keeps the order of signed integers,
+// so frame of reference also packs small negative values tightly.
+template <typename U>
+class ColumnEncoderImpl {
+    static constexpr U SIGN_BIT = U(1) << (sizeof(U) * 8 - 1);
+
+    static U ToKey(U value) { return static_cast<U>(value ^ SIGN_BIT); }
+
+public:
+    static ColumnEncodingType Encode(const U *values, SizeT row_count, Vector<char> &output) {
+        const SizeT plain_size = row_count * sizeof(U);
+        if (row_count == 0) {
+            return ColumnEncodingType::kPlain;
+        }
+
+        SizeT run_count = 1;
+        U min_key = ToKey(values[0]);
+        U max_key = min_key;
+        for (SizeT idx = 1; idx < row_count; ++idx) {
+            run_count += values[idx] != values[idx - 1];
+            const U key = ToKey(values[idx]);
+            min_key = std::min(min_key, key);
+            max_key = std::max(max_key, key);
+        }
+        const SizeT rle_size = sizeof(u32) + run_count * (sizeof(U) + sizeof(u32));
+
+        const u32 offset_width = std::bit_width(static_cast<U>(max_key - min_key));
+        const SizeT for_size = sizeof(U) + sizeof(u8) + PackedWordCount(row_count, offset_width) * sizeof(u64);
+
+        // A dictionary only pays off below row_count / 2 distinct values, stop counting there.
+        Vector<U> dictionary;
+        SizeT dictionary_size = std::numeric_limits<SizeT>::max();
+        {
+            FlatHashSet<U> distinct;
+            for (SizeT idx = 0; idx < row_count && distinct.size() <= row_count / 2; ++idx) {
+                distinct.insert(values[idx]);
+            }
+            if (distinct.size() <= row_count / 2) {
+                dictionary.assign(distinct.begin(), distinct.end());
+                std::sort(dictionary.begin(), dictionary.end());
+                const u32 code_width = std::bit_width(dictionary.size() - 1);
+                dictionary_size = sizeof(u32) + sizeof(u8) + dictionary.size() * sizeof(U) + PackedWordCount(row_count, code_width) * sizeof(u64);
+            }
+        }
+
+        const SizeT best_size = std::min({rle_size, for_size, dictionary_size});
+        if (best_size >= plain_size) {
+            return ColumnEncodingType::kPlain;
+        }
+        output.clear();
+        output.reserve(best_size);
+        if (best_size == rle_size) {
+            EncodeRLE(values, row_count, run_count, output);
+            return ColumnEncodingType::kRLE;
+        }
+        if (best_size == dictionary_size) {
+            EncodeDictionary(values, row_count, dictionary, output);
+            return ColumnEncodingType::kDictionary;
+        }
+        EncodeFrameOfReference(values, row_count, min_key, offset_width, output);
+        return ColumnEncodingType::kFrameOfReference;
+    }
+
+    static void Decode(ColumnEncodingType encoding_type, const char *encoded, SizeT encoded_size, SizeT row_count, U *output) {
+        switch (encoding_type) {
+            case ColumnEncodingType::kRLE: {
+                CheckEncodedSize(sizeof(u32), encoded_size, encoding_type);
+                const u32 run_count = LoadRaw<u32>(encoded);
+                CheckEncodedSize(sizeof(u32) + run_count * (sizeof(U) + sizeof(u32)), encoded_size, encoding_type);
+                const char *run_values = encoded + sizeof(u32);
+                const char *run_ends = run_values + run_count * sizeof(U);
+                SizeT row_idx = 0;
+                for (u32 run_idx = 0; run_idx < run_count; ++run_idx) {
+                    const U value = LoadRaw<U>(run_values + run_idx * sizeof(U));
+                    const SizeT run_end = std::min<SizeT>(LoadRaw<u32>(run_ends + run_idx * sizeof(u32)), row_count);
+                    std::fill(output + row_idx, output + std::max(row_idx, run_end), value);
+                    row_idx = std::max(row_idx, run_end);
+                }
+                if (row_idx != row_count) {
+                    Status status = Status::DataIOError(fmt::format("RLE encoded column has {} rows, expect {}", row_idx, row_count));
+                    RecoverableError(status);
+                }
+                break;
+            }
+            case ColumnEncodingType::kDictionary: {
+                CheckEncodedSize(sizeof(u32) + sizeof(u8), encoded_size, encoding_type);
+                const u32 dictionary_size = LoadRaw<u32>(encoded);
+                const u32 code_width = LoadRaw<u8>(encoded + sizeof(u32));
+                const char *dictionary = encoded + sizeof(u32) + sizeof(u8);
+                const char *codes = dictionary + dictionary_size * sizeof(U);
+                CheckEncodedSize(sizeof(u32) + sizeof(u8) + dictionary_size * sizeof(U) + PackedWordCount(row_count, code_width) * sizeof(u64),
+                                 encoded_size,
+                                 encoding_type);
+                Vector<U> values(dictionary_size);
+                std::memcpy(values.data(), dictionary, dictionary_size * sizeof(U));
+                UnpackBits(codes, row_count, code_width, [&](SizeT idx, u64 code) {
+                    if (code >= dictionary_size) {
+                        Status status = Status::DataIOError(fmt::format("Dictionary code {} out of {} values", code, dictionary_size));
+                        RecoverableError(status);
+                    }
+                    output[idx] = values[code];
+                });
+                break;
+            }
+            case ColumnEncodingType::kFrameOfReference: {
+                CheckEncodedSize(sizeof(U) + sizeof(u8), encoded_size, encoding_type);
+                const U min_key = LoadRaw<U>(encoded);
+                const u32 offset_width = LoadRaw<u8>(encoded + sizeof(U));
+                CheckEncodedSize(sizeof(U) + sizeof(u8) + PackedWordCount(row_count, offset_width) * sizeof(u64), encoded_size, encoding_type);
+                UnpackBits(encoded + sizeof(U) + sizeof(u8), row_count, offset_width, [&](SizeT idx, u64 offset) {
+                    output[idx] = ToKey(static_cast<U>(min_key + offset));
+                });
+                break;
+            }
+            case ColumnEncodingType::kPlain: {
+                CheckEncodedSize(row_count * sizeof(U), encoded_size, encoding_type);
+                std::memcpy(output, encoded, row_count * sizeof(U));
+                break;
+            }
+            default: {
+                Status status = Status::DataIOError(fmt::format("Unknown column encoding: {}", static_cast<u8>(encoding_type)));
+                RecoverableError(status);
+            }
+        }
+    }
+
+private:
+    static void EncodeRLE(const U *values, SizeT row_count, SizeT run_count, Vector<char> &output) {
+        Vector<U> run_values;
+        Vector<u32> run_ends;
+        run_values.reserve(run_count);
+        run_ends.reserve(run_count);
+        for (SizeT idx = 0; idx < row_count; ++idx) {
+            if (idx == 0 || values[idx] != values[idx - 1]) {
+                if (idx > 0) {
+                    run_ends.push_back(idx);
+                }
+                run_values.push_back(values[idx]);
+            }
+        }
+        run_ends.push_back(row_count);
+
+        const u32 count = run_values.size();
+        AppendRaw(output, &count, 1);
+        AppendRaw(output, run_values.data(), run_values.size());
+        AppendRaw(output, run_ends.data(), run_ends.size());
+    }
+
+    static void EncodeDictionary(const U *values, SizeT row_count, const Vector<U> &dictionary, Vector<char> &output) {
+        const u32 count = dictionary.size();
+        const u8 code_width = std::bit_width(dictionary.size() - 1);
+        AppendRaw(output, &count, 1);
+        AppendRaw(output, &code_width, 1);
+        AppendRaw(output, dictionary.data(), dictionary.size());
+        PackBits(
+            row_count,
+            code_width,
+            [&](SizeT idx) -> u64 { return std::lower_bound(dictionary.begin(), dictionary.end(), values[idx]) - dictionary.begin(); },
+            output);
+    }
+
+    static void EncodeFrameOfReference(const U *values, SizeT row_count, U min_key, u32 offset_width, Vector<char> &output) {
+        const u8 width = offset_width;
+        AppendRaw(output, &min_key, 1);
+        AppendRaw(output, &width, 1);
+        PackBits(row_count, offset_width, [&](SizeT idx) -> u64 { return static_cast<U>(ToKey(values[idx]) - min_key); }, output);
+    }
+};
+
+// Values of any width, compared and hashed by their bytes. Same layouts as above, frame of reference isn't supported.
+class WideColumnEncoder {
+public:
+    explicit WideColumnEncoder(SizeT element_size) : element_size_(element_size) {}
+
+    ColumnEncodingType Encode(const char *values, SizeT row_count, Vector<char> &output) const {
+        const SizeT plain_size = row_count * element_size_;
+        if (row_count == 0) {
+            return ColumnEncodingType::kPlain;
+        }
+
+        SizeT run_count = 1;
+        for (SizeT idx = 1; idx < row_count; ++idx) {
+            run_count += Value(values, idx) != Value(values, idx - 1);
+        }
+        const SizeT rle_size = sizeof(u32) + run_count * (element_size_ + sizeof(u32));
+
+        Vector<std::string_view> dictionary;
+        SizeT dictionary_size = std::numeric_limits<SizeT>::max();
+        {
+            FlatHashSet<std::string_view> distinct;
+            for (SizeT idx = 0; idx < row_count && distinct.size() <= row_count / 2; ++idx) {
+                distinct.insert(Value(values, idx));
+            }
+            if (distinct.size() <= row_count / 2) {
+                dictionary.assign(distinct.begin(), distinct.end());
+                std::sort(dictionary.begin(), dictionary.end());
+                const u32 code_width = std::bit_width(dictionary.size() - 1);
+                dictionary_size =
+                    sizeof(u32) + sizeof(u8) + dictionary.size() * element_size_ + PackedWordCount(row_count, code_width) * sizeof(u64);
+            }
+        }
+
+        const SizeT best_size = std::min(rle_size, dictionary_size);
+        if (best_size >= plain_size) {
+            return ColumnEncodingType::kPlain;
+        }
+        output.clear();
+        output.reserve(best_size);
+        if (best_size == rle_size) {
+            EncodeRLE(values, row_count, run_count, output);
+            return ColumnEncodingType::kRLE;
+        }
+        EncodeDictionary(values, row_count, dictionary, output);
+        return ColumnEncodingType::kDictionary;
+    }
+
+    void Decode(ColumnEncodingType encoding_type, const char *encoded, SizeT encoded_size, SizeT row_count, char *output) const {
+        switch (encoding_type) {
+            case ColumnEncodingType::kRLE: {
+                CheckEncodedSize(sizeof(u32), encoded_size, encoding_type);
+                const u32 run_count = LoadRaw<u32>(encoded);
+                CheckEncodedSize(sizeof(u32) + run_count * (element_size_ + sizeof(u32)), encoded_size, encoding_type);
+                const char *run_values = encoded + sizeof(u32);
+                const char *run_ends = run_values + run_count * element_size_;
+                SizeT row_idx = 0;
+                for (u32 run_idx = 0; run_idx < run_count; ++run_idx) {
+                    const char *value = run_values + run_idx * element_size_;
+                    const SizeT run_end = std::min<SizeT>(LoadRaw<u32>(run_ends + run_idx * sizeof(u32)), row_count);
+                    for (; row_idx < run_end; ++row_idx) {
+                        std::memcpy(output + row_idx * element_size_, value, element_size_);
+                    }
+                }
+                if (row_idx != row_count) {
+                    Status status = Status::DataIOError(fmt::format("RLE encoded column has {} rows, expect {}", row_idx, row_count));
+                    RecoverableError(status);
+                }
+                break;
+            }
+            case ColumnEncodingType::kDictionary: {
+                CheckEncodedSize(sizeof(u32) + sizeof(u8), encoded_size, encoding_type);
+                const u32 dictionary_size = LoadRaw<u32>(encoded);
+                const u32 code_width = LoadRaw<u8>(encoded + sizeof(u32));
+                const char *dictionary = encoded + sizeof(u32) + sizeof(u8);
+                const char *codes = dictionary + dictionary_size * element_size_;
+                CheckEncodedSize(sizeof(u32) + sizeof(u8) + dictionary_size * element_size_ + PackedWordCount(row_count, code_width) * sizeof(u64),
+                                 encoded_size,
+                                 encoding_type);
+                UnpackBits(codes, row_count, code_width, [&](SizeT idx, u64 code) {
+                    if (code >= dictionary_size) {
+                        Status status = Status::DataIOError(fmt::format("Dictionary code {} out of {} values", code, dictionary_size));
+                        RecoverableError(status);
+                    }
+                    std::memcpy(output + idx * element_size_, dictionary + code * element_size_, element_size_);
+                });
+                break;
+            }
+            case ColumnEncodingType::kPlain: {
+                CheckEncodedSize(row_count * element_size_, encoded_size, encoding_type);
+                std::memcpy(output, encoded, row_count * element_size_);
+                break;
+            }
+            default: {
+                Status status = Status::DataIOError(fmt::format("Column encoding {} of {} bytes values isn't supported",
+                                                                ToString(encoding_type),
+                                                                element_size_));
+                RecoverableError(status);
+            }
+        }
+    }
+
+private:
+    std::string_view Value(const char *values, SizeT idx) const { return {values + idx * element_size_, element_size_}; }
+
+    void EncodeRLE(const char *values, SizeT row_count, SizeT run_count, Vector<char> &output) const {
+        Vector<u32> run_ends;
+        run_ends.reserve(run_count);
+        const u32 count = run_count;
+        AppendRaw(output, &count, 1);
+        for (SizeT idx = 0; idx < row_count; ++idx) {
+            if (idx == 0 || Value(values, idx) != Value(values, idx - 1)) {
+                if (idx > 0) {
+                    run_ends.push_back(idx);
+                }
+                AppendRaw(output, values + idx * element_size_, element_size_);
+            }
+        }
+        run_ends.push_back(row_count);
+        AppendRaw(output, run_ends.data(), run_ends.size());
+    }
+
+    void EncodeDictionary(const char *values, SizeT row_count, const Vector<std::string_view> &dictionary, Vector<char> &output) const {
+        const u32 count = dictionary.size();
+        const u8 code_width = std::bit_width(dictionary.size() - 1);
+        AppendRaw(output, &count, 1);
+        AppendRaw(output, &code_width, 1);
+        for (const auto &value : dictionary) {
+            AppendRaw(output, value.data(), value.size());
+        }
+        PackBits(
+            row_count,
+            code_width,
+            [&](SizeT idx) -> u64 { return std::lower_bound(dictionary.begin(), dictionary.end(), Value(values, idx)) - dictionary.begin(); },
+            output);
+    }
+
+    const SizeT element_size_;
+};
+
+} // namespace
+
+ColumnEncodingType ColumnEncoder::Encode(const char *data, SizeT element_size, SizeT row_count, Vector<char> &output) {
+    switch (element_size) {
+        case 1:
+            return ColumnEncoderImpl<u8>::Encode(reinterpret_cast<const u8 *>(data), row_count, output);
+        case 2:
+            return ColumnEncoderImpl<u16>::Encode(reinterpret_cast<const u16 *>(data), row_count, output);
+        case 4:
+            return ColumnEncoderImpl<u32>::Encode(reinterpret_cast<const u32 *>(data), row_count, output);
+        case 8:
+            return ColumnEncoderImpl<u64>::Encode(reinterpret_cast<const u64 *>(data), row_count, output);
+        default: {
+            if (!CanEncode(element_size)) {
+                return ColumnEncodingType::kPlain;
+            }
+            return WideColumnEncoder(element_size).Encode(data, row_count, output);
+        }
+    }
+}
+
+void ColumnEncoder::Decode(ColumnEncodingType encoding_type,
+                           const char *encoded,
+                           SizeT encoded_size,
+                           SizeT element_size,
+                           SizeT row_count,
+                           char *output) {
+    switch (element_size) {
+        case 1: {
+            ColumnEncoderImpl<u8>::Decode(encoding_type, encoded, encoded_size, row_count, reinterpret_cast<u8 *>(output));
+            break;
+        }
+        case 2: {
+            ColumnEncoderImpl<u16>::Decode(encoding_type, encoded, encoded_size, row_count, reinterpret_cast<u16 *>(output));
+            break;
+        }
+        case 4: {
+            ColumnEncoderImpl<u32>::Decode(encoding_type, encoded, encoded_size, row_count, reinterpret_cast<u32 *>(output));
+            break;
+        }
+        case 8: {
+            ColumnEncoderImpl<u64>::Decode(encoding_type, encoded, encoded_size, row_count, reinterpret_cast<u64 *>(output));
+            break;
+        }
+        default: {
+            if (!CanEncode(element_size)) {
+                String error_message = fmt::format("Can't decode column of {} bytes values", element_size);
+                UnrecoverableError(error_message);
+            }
+            WideColumnEncoder(element_size).Decode(encoding_type, encoded, encoded_size, row_count, output);
+            break;
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,51 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module column_encoding;
+
+import stl;
+
+namespace infinity {
+
+export enum class ColumnEncodingType : u8 {
+    kPlain,
+    kDictionary,       // sorted distinct values + bit packed codes
+    kRLE,              // (value, run end) pairs
+    kFrameOfReference, // minimum + bit packed offsets from it
+};
+
+export String ToString(ColumnEncodingType encoding_type);
+
+// Lossless encodings of a block column of fixed-width values of up to 16 bytes each.
+// The values are encoded by their bits, so any fixed-width type of these widths can be encoded. Values wider than 8 bytes,
+// e.g. VarcharT, only get dictionary and RLE encoding: short strings are inlined, so equal strings have equal bits.
+// This is on-disk compression only: DataFileWorker decodes a column when its buffer is loaded, because ColumnVector and
+// every operator read the block buffer as a plain array. Filters and aggregates don't run on the codes.
+export class ColumnEncoder {
+public:
+    // Wider values, e.g. embeddings, rarely repeat and aren't worth hashing on every save.
+    static constexpr SizeT MAX_ELEMENT_SIZE = 16;
+
+    static bool CanEncode(SizeT element_size) { return element_size > 0 && element_size <= MAX_ELEMENT_SIZE; }
+
+    // Picks the smallest encoding of the values. kPlain is returned and output is left empty when none is smaller than the raw data.
+    static ColumnEncodingType Encode(const char *data, SizeT element_size, SizeT row_count, Vector<char> &output);
+
+    // Decodes row_count values into output, which holds row_count * element_size bytes.
+    static void Decode(ColumnEncodingType encoding_type, const char *encoded, SizeT encoded_size, SizeT element_size, SizeT row_count, char *output);
+};
+
+} // namespace infinity
@@ -190,6 +190,15 @@ struct RoaringBitmap {
         return roaring_.cardinality();
     }
 
+    // The first true position not less than start, count_ if there is none
+    [[nodiscard]] u32 NextTrue(const u32 start) const
+        requires(!init_all_true)
+    {
+        RoaringForwardIterator iter = roaring_.begin();
+        iter.equalorlarger(start);
+        return iter.i.has_value ? *iter : count_;
+    }
+
     [[nodiscard]] inline u32 CountFalse() const {
         if constexpr (init_all_true) {
             if (all_true_flag_.value) {
@@ -360,6 +369,6 @@ private:
 };
 
 export using Bitmask = RoaringBitmap<true>;
-// export using Bitmap = RoaringBitmap<false>;
+export using Bitmap = RoaringBitmap<false>;
 
 } // namespace infinity
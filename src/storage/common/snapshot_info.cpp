@@ -37,6 +37,7 @@ import utility;
 import block_version;
 import data_type;
 import parsed_expr;
+import async_file_io;
 
 namespace infinity {
 
@@ -205,15 +206,6 @@ void TableSnapshotInfo::Serialize(const String &save_dir) {
                 UnrecoverableError(reader_open_status.message());
             }
 
-            auto seek_status = reader_handle->Seek(obj_addr.part_offset_);
-            if (!seek_status.ok()) {
-                UnrecoverableError(seek_status.message());
-            }
-
-            auto file_size = obj_addr.part_size_;
-            auto buffer = std::make_unique<char[]>(file_size);
-            auto [nread, read_status] = reader_handle->Read(buffer.get(), file_size);
-
             String dst_file_path = fmt::format("{}/{}/{}", save_dir, snapshot_name_, file);
             String dst_dir = VirtualStore::GetParentPath(dst_file_path);
             if (!VirtualStore::Exists(dst_dir)) {
@@ -225,7 +217,11 @@ void TableSnapshotInfo::Serialize(const String &save_dir) {
                 UnrecoverableError(writer_open_status.message());
             }
 
-            Status write_status = write_file_handle->Append(buffer.get(), file_size);
+            Status write_status = AsyncFileIO::CopyRange(reader_handle->FileDescriptor(),
+                                                         obj_addr.part_offset_,
+                                                         write_file_handle->FileDescriptor(),
+                                                         0,
+                                                         obj_addr.part_size_);
             if (!write_status.ok()) {
                 UnrecoverableError(write_status.message());
             }
@@ -242,7 +238,7 @@ void TableSnapshotInfo::Serialize(const String &save_dir) {
             String src_file_path = fmt::format("{}/{}", data_dir, file);
             String dst_file_path = fmt::format("{}/{}/{}", save_dir, snapshot_name_, file);
             //        LOG_INFO(fmt::format("Copy from: {} to {}", src_file_path, dst_file_path));
-            Status copy_status = VirtualStore::Copy(dst_file_path, src_file_path);
+            Status copy_status = VirtualStore::Copy(dst_file_path, src_file_path, true);
             if (!copy_status.ok()) {
                 RecoverableError(copy_status);
             }
@@ -19,8 +19,10 @@ module;
 
 module new_compaction_alg;
 
+import stl;
 import default_values;
 import infinity_exception;
+import third_party;
 
 namespace infinity {
 
@@ -89,8 +91,121 @@ private:
     std::vector<std::vector<std::pair<SegmentID, SizeT>>> segment_layers_;
 };
 
+class CostCompactionAlg : public NewCompactionAlg {
+public:
+    CostCompactionAlg(SizeT row_bytes, SizeT index_cnt, TxnTimeStamp current_ts, SizeT segment_capacity)
+        : row_bytes_(std::max<SizeT>(row_bytes, 1)), index_cnt_(index_cnt), current_ts_(current_ts), segment_capacity_(segment_capacity),
+          tier_alg_(DBT_COMPACTION_M, DBT_COMPACTION_C, DBT_COMPACTION_S, segment_capacity) {}
+
+    void AddSegment(SegmentID segment_id, SizeT segment_row_cnt) override {
+        CompactionSegmentStat segment_stat;
+        segment_stat.segment_id_ = segment_id;
+        segment_stat.row_cnt_ = segment_row_cnt;
+        AddSegment(segment_stat);
+    }
+
+    void AddSegment(const CompactionSegmentStat &segment_stat) override {
+        segment_stats_.push_back(segment_stat);
+        // the size tier of a segment is decided by the rows that survive a compaction
+        tier_alg_.AddSegment(segment_stat.segment_id_, LiveRowCnt(segment_stat));
+    }
+
+    Vector<SegmentID> GetCompactiableSegments() override { return GetCompactionPlan(std::numeric_limits<SizeT>::max()).segment_ids_; }
+
+    CompactionPlan GetCompactionPlan(SizeT io_budget) override {
+        CompactionPlan plan = PlanByDeleteRatio(io_budget);
+        if (!plan.segment_ids_.empty()) {
+            return plan;
+        }
+        return PlanByTier();
+    }
+
+private:
+    static SizeT LiveRowCnt(const CompactionSegmentStat &segment_stat) {
+        return segment_stat.row_cnt_ - std::min(segment_stat.deleted_row_cnt_, segment_stat.row_cnt_);
+    }
+
+    // the live rows are read and written once, and read again by every index rebuilt on the new segment
+    SizeT IOCost(SizeT live_row_cnt) const { return live_row_cnt * row_bytes_ * (1 + index_cnt_); }
+
+    // reclaimed bytes per byte of io, raised up to twice as the deletes get older
+    f64 Score(const CompactionSegmentStat &segment_stat) const {
+        SizeT live_row_cnt = LiveRowCnt(segment_stat);
+        f64 reclaimed_bytes = f64(segment_stat.row_cnt_ - live_row_cnt) * row_bytes_;
+        f64 age = segment_stat.first_delete_ts_ < current_ts_ ? f64(current_ts_ - segment_stat.first_delete_ts_) : 0;
+        f64 age_boost = 1 + age / (age + DEFAULT_COMPACTION_DELETE_AGE);
+        return reclaimed_bytes * age_boost / f64(IOCost(live_row_cnt) + row_bytes_);
+    }
+
+    void AddToPlan(const CompactionSegmentStat &segment_stat, CompactionPlan &plan) const {
+        SizeT live_row_cnt = LiveRowCnt(segment_stat);
+        plan.segment_ids_.push_back(segment_stat.segment_id_);
+        plan.io_cost_ += IOCost(live_row_cnt);
+        plan.reclaimed_bytes_ += (segment_stat.row_cnt_ - live_row_cnt) * row_bytes_;
+    }
+
+    CompactionPlan PlanByDeleteRatio(SizeT io_budget) const {
+        Vector<Pair<f64, const CompactionSegmentStat *>> candidates;
+        for (const auto &segment_stat : segment_stats_) {
+            if (segment_stat.row_cnt_ == 0 || segment_stat.deleted_row_cnt_ < segment_stat.row_cnt_ * DEFAULT_COMPACTION_DELETE_RATIO) {
+                continue;
+            }
+            candidates.emplace_back(Score(segment_stat), &segment_stat);
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const auto &lhs, const auto &rhs) { return lhs.first > rhs.first; });
+
+        CompactionPlan plan;
+        plan.by_delete_ratio_ = true;
+        SizeT live_row_cnt = 0;
+        for (const auto &[score, segment_stat] : candidates) {
+            SizeT segment_live_row_cnt = LiveRowCnt(*segment_stat);
+            // the segments are merged into one
+            if (live_row_cnt + segment_live_row_cnt > segment_capacity_) {
+                continue;
+            }
+            if (!plan.segment_ids_.empty() && plan.io_cost_ + IOCost(segment_live_row_cnt) > io_budget) {
+                continue;
+            }
+            AddToPlan(*segment_stat, plan);
+            live_row_cnt += segment_live_row_cnt;
+        }
+        return plan;
+    }
+
+    CompactionPlan PlanByTier() {
+        CompactionPlan plan;
+        for (SegmentID segment_id : tier_alg_.GetCompactiableSegments()) {
+            auto iter = std::find_if(segment_stats_.begin(), segment_stats_.end(), [&](const auto &segment_stat) {
+                return segment_stat.segment_id_ == segment_id;
+            });
+            AddToPlan(*iter, plan);
+        }
+        return plan;
+    }
+
+    const SizeT row_bytes_;
+    const SizeT index_cnt_;
+    const TxnTimeStamp current_ts_;
+    const SizeT segment_capacity_;
+
+    Vector<CompactionSegmentStat> segment_stats_;
+    DBTCompactionAlg tier_alg_;
+};
+
+String CompactionPlan::ToString() const {
+    return fmt::format("segments: {} by {}, io cost: {} bytes, reclaimed: {} bytes",
+                       fmt::join(segment_ids_, ","),
+                       by_delete_ratio_ ? "delete ratio" : "size tier",
+                       io_cost_,
+                       reclaimed_bytes_);
+}
+
 UniquePtr<NewCompactionAlg> NewCompactionAlg::GetInstance() {
     return MakeUnique<DBTCompactionAlg>(DBT_COMPACTION_M, DBT_COMPACTION_C, DBT_COMPACTION_S, DEFAULT_SEGMENT_CAPACITY);
 }
 
+UniquePtr<NewCompactionAlg> NewCompactionAlg::GetInstance(SizeT row_bytes, SizeT index_cnt, TxnTimeStamp current_ts) {
+    return MakeUnique<CostCompactionAlg>(row_bytes, index_cnt, current_ts, DEFAULT_SEGMENT_CAPACITY);
+}
+
 } // namespace infinity
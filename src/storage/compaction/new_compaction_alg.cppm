@@ -17,18 +17,48 @@ module;
 export module new_compaction_alg;
 
 import stl;
+import default_values;
 
 namespace infinity {
 
+export struct CompactionSegmentStat {
+    SegmentID segment_id_{};
+    SizeT row_cnt_{};         // appended rows, deleted ones included
+    SizeT deleted_row_cnt_{}; // rows deleted before the compaction txn began
+    TxnTimeStamp first_delete_ts_{UNCOMMIT_TS};
+};
+
+export struct CompactionPlan {
+    Vector<SegmentID> segment_ids_{};
+    SizeT io_cost_{};         // bytes of live rows rewritten, once for the data and once per index rebuilt
+    SizeT reclaimed_bytes_{}; // bytes of deleted rows dropped
+    bool by_delete_ratio_{false};
+
+    String ToString() const;
+};
+
 export class NewCompactionAlg {
 public:
     virtual ~NewCompactionAlg() = default;
 
     virtual void AddSegment(SegmentID segment_id, SizeT segment_row_cnt) = 0;
 
+    virtual void AddSegment(const CompactionSegmentStat &segment_stat) { AddSegment(segment_stat.segment_id_, segment_stat.row_cnt_); }
+
     virtual Vector<SegmentID> GetCompactiableSegments() = 0;
 
+    // The segments to compact whose io cost fits in io_budget, one plan may exceed the budget when it is alone.
+    virtual CompactionPlan GetCompactionPlan(SizeT io_budget) {
+        CompactionPlan plan;
+        plan.segment_ids_ = GetCompactiableSegments();
+        return plan;
+    }
+
     static UniquePtr<NewCompactionAlg> GetInstance();
+
+    // Score the segments by their deleted rows, their age since the first delete and the cost of rewriting them with their indexes.
+    // row_bytes is the estimated width of a row.
+    static UniquePtr<NewCompactionAlg> GetInstance(SizeT row_bytes, SizeT index_cnt, TxnTimeStamp current_ts);
 };
 
 } // namespace infinity
@@ -44,6 +44,8 @@ import db_meeta;
 import segment_meta;
 import bg_task;
 import base_txn_store;
+import column_def;
+import data_type;
 
 namespace infinity {
 
@@ -78,7 +80,7 @@ void CompactionProcessor::Submit(SharedPtr<BGTask> bg_task) {
     ++task_count_;
 }
 
-void CompactionProcessor::NewDoCompact() {
+void CompactionProcessor::NewDoCompact(SizeT io_budget) {
     LOG_TRACE("Background task triggered compaction");
     auto *new_txn_mgr = InfinityContext::instance().storage()->new_txn_manager();
     Vector<Pair<String, String>> db_table_names;
@@ -107,6 +109,7 @@ void CompactionProcessor::NewDoCompact() {
     }
 
     auto compact_table = [&](const String &db_name, const String &table_name, SharedPtr<BGTaskInfo> &bg_task_info) {
+        CompactionPlan plan;
         auto new_txn_shared =
             new_txn_mgr->BeginTxnShared(MakeUnique<String>(fmt::format("compact table {}.{}", db_name, table_name)), TransactionType::kNormal);
         LOG_INFO(fmt::format("Compact begin ts: {}", new_txn_shared->BeginTS()));
@@ -121,12 +124,12 @@ void CompactionProcessor::NewDoCompact() {
                 CompactTxnStore *compact_txn_store = static_cast<CompactTxnStore *>(new_txn_shared->GetTxnStore());
                 if (compact_txn_store != nullptr) {
                     // Record compact info
-                    String task_text = fmt::format("Txn: {}, commit: {}, compact table: {}.{} with segments: {} into {}",
+                    String task_text = fmt::format("Txn: {}, commit: {}, compact table: {}.{} with {} into {}",
                                                    new_txn_shared->TxnID(),
                                                    new_txn_shared->CommitTS(),
                                                    db_name,
                                                    table_name,
-                                                   fmt::join(compact_txn_store->deprecated_segment_ids_, ","),
+                                                   plan.ToString(),
                                                    compact_txn_store->new_segment_id_);
 
                     bg_task_info->task_info_list_.emplace_back(task_text);
@@ -184,21 +187,52 @@ void CompactionProcessor::NewDoCompact() {
             return;
         }
 
-        auto compaction_alg = NewCompactionAlg::GetInstance();
+        SizeT row_bytes = 0;
+        {
+            auto [column_defs, column_status] = table_meta->GetColumnDefs();
+            if (!column_status.ok()) {
+                UnrecoverableError(column_status.message());
+            }
+            for (const auto &column_def : *column_defs) {
+                row_bytes += column_def->type()->Size();
+            }
+        }
+        Vector<String> *index_id_strs_ptr = nullptr;
+        status = table_meta->GetIndexIDs(index_id_strs_ptr);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        auto compaction_alg = NewCompactionAlg::GetInstance(row_bytes, index_id_strs_ptr->size(), new_txn_shared->BeginTS());
 
         for (SegmentID segment_id : segment_ids) {
             SegmentMeta segment_meta(segment_id, *table_meta);
-            auto [segment_row_cnt, segment_status] = segment_meta.GetRowCnt1();
+            CompactionSegmentStat segment_stat;
+            segment_stat.segment_id_ = segment_id;
+            Status segment_status;
+            std::tie(segment_stat.row_cnt_, segment_status) = segment_meta.GetRowCnt1();
             if (!segment_status.ok()) {
                 UnrecoverableError(segment_status.message());
             }
+            segment_status = segment_meta.GetFirstDeleteTS(segment_stat.first_delete_ts_);
+            if (!segment_status.ok()) {
+                UnrecoverableError(segment_status.message());
+            }
+            // only the segments ever deleted from have their block versions read
+            if (segment_stat.first_delete_ts_ != UNCOMMIT_TS) {
+                std::tie(segment_stat.deleted_row_cnt_, segment_status) = segment_meta.GetDeleteCnt();
+                if (!segment_status.ok()) {
+                    UnrecoverableError(segment_status.message());
+                }
+            }
 
-            compaction_alg->AddSegment(segment_id, segment_row_cnt);
+            compaction_alg->AddSegment(segment_stat);
         }
-        Vector<SegmentID> compactible_segment_ids = compaction_alg->GetCompactiableSegments();
+        plan = compaction_alg->GetCompactionPlan(io_budget);
 
-        if (!compactible_segment_ids.empty()) {
-            status = new_txn_shared->Compact(db_name, table_name, compactible_segment_ids);
+        if (!plan.segment_ids_.empty()) {
+            LOG_INFO(fmt::format("Compact table {}.{} plan: {}", db_name, table_name, plan.ToString()));
+            io_budget -= std::min(io_budget, plan.io_cost_);
+            status = new_txn_shared->Compact(db_name, table_name, plan.segment_ids_);
         }
     };
 
@@ -207,6 +241,10 @@ void CompactionProcessor::NewDoCompact() {
     } else {
         SharedPtr<BGTaskInfo> bg_task_info = MakeShared<BGTaskInfo>(BGTaskType::kNotifyCompact);
         for (const auto &[db_name, table_name] : db_table_names) {
+            if (io_budget == 0) {
+                LOG_DEBUG("Compaction io budget is used up, the remaining tables wait for the next round.");
+                break;
+            }
             compact_table(db_name, table_name, bg_task_info);
         }
         if (!bg_task_info->task_info_list_.empty()) {
@@ -341,8 +379,8 @@ void CompactionProcessor::Process() {
                     if (storage_mode == StorageMode::kWritable) {
                         LOG_DEBUG("Periodic compact start.");
 
-                        //                        auto *compact_task = static_cast<NotifyCompactTask *>(bg_task.get());
-                        NewDoCompact();
+                        auto *compact_task = static_cast<NotifyCompactTask *>(bg_task.get());
+                        NewDoCompact(compact_task->io_budget_);
 
                         LOG_DEBUG("Periodic compact end.");
                     }
@@ -60,7 +60,7 @@ public:
 
     void Submit(SharedPtr<BGTask> bg_task);
 
-    void NewDoCompact();
+    void NewDoCompact(SizeT io_budget);
 
     Status NewManualCompact(const String &db_name, const String &table_name);
 
@@ -31,6 +31,9 @@ import index_base;
 import logical_type;
 import statement_common;
 import logger;
+import data_type;
+import embedding_info;
+import internal_types;
 
 namespace infinity {
 
@@ -87,6 +90,10 @@ SharedPtr<IndexBase> IndexDiskAnn::Make(SharedPtr<String> index_name,
         Status status = Status::InvalidIndexParam("Metric type");
         RecoverableError(status);
     }
+    if (metric_type != MetricType::kMetricL2 && metric_type != MetricType::kMetricCosine) {
+        Status status = Status::InvalidIndexParam(fmt::format("DiskAnn index only supports l2 and cosine metric, got: {}", MetricTypeToString(metric_type)));
+        RecoverableError(status);
+    }
 
     if (encode_type == DiskAnnEncodeType::kInvalid) {
         Status status = Status::InvalidIndexParam("Encode type");
@@ -164,6 +171,13 @@ void IndexDiskAnn::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_ta
         Status status = Status::InvalidIndexDefinition(
             fmt::format("Attempt to create DsikAnn index on column: {}, data type: {}.", column_name, data_type->ToString()));
         RecoverableError(status);
+    } else if (const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type->type_info().get());
+               embedding_info->Type() != EmbeddingDataType::kElemFloat) {
+        Status status = Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create DiskAnn index on column: {}, data type: {}, only float embedding is supported.",
+                        column_name,
+                        data_type->ToString()));
+        RecoverableError(status);
     }
 }
 
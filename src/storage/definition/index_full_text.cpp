@@ -62,6 +62,14 @@ SharedPtr<IndexBase> IndexFullText::Make(SharedPtr<String> index_name,
             } else if (realtime_str != "false") {
                 LOG_WARN(fmt::format("Unknown parameter value: {}, {}", para_name, parameter->param_value_));
             }
+        } else if (para_name == "quantized_norm") {
+            String quantized_norm_str = parameter->param_value_;
+            ToLowerString(quantized_norm_str);
+            if (quantized_norm_str == "true") {
+                FlagAddQuantizedNorm(flag);
+            } else if (quantized_norm_str != "false") {
+                LOG_WARN(fmt::format("Unknown parameter value: {}, {}", para_name, parameter->param_value_));
+            }
         } else {
             LOG_WARN(fmt::format("Unknown parameter: {}", para_name));
         }
@@ -321,10 +321,20 @@ void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table
                                 data_type_ptr->ToString())));
             }
         }
+        if (param->param_name_ == "build_type" && StringToHnswBuildType(param->param_value_) == HnswBuildType::kLSG) {
+            if (embedding_data_type == EmbeddingDataType::kElemFloat16 || embedding_data_type == EmbeddingDataType::kElemBFloat16) {
+                RecoverableError(Status::InvalidIndexDefinition(
+                    fmt::format("Attempt to create HNSW index with LSG build on column: {}, data type: {}. float16 and bfloat16 only support plain build.",
+                                column_name,
+                                data_type_ptr->ToString())));
+            }
+        }
     }
-    // TODO: now only support float, int8, uint8?
+    // TODO: now only support float, float16, bfloat16, int8, uint8?
     switch (embedding_data_type) {
         case EmbeddingDataType::kElemFloat:
+        case EmbeddingDataType::kElemFloat16:
+        case EmbeddingDataType::kElemBFloat16:
         case EmbeddingDataType::kElemInt8:
         case EmbeddingDataType::kElemUInt8: {
             // supported
@@ -332,7 +342,7 @@ void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table
         }
         default: {
             RecoverableError(Status::InvalidIndexDefinition(
-                fmt::format("Attempt to create HNSW index on column: {}, data type: {}. now only support float, int8, uint8 element type.",
+                fmt::format("Attempt to create HNSW index on column: {}, data type: {}. now only support float, float16, bfloat16, int8, uint8 element type.",
                             column_name,
                             data_type_ptr->ToString())));
         }
@@ -71,10 +71,16 @@ ColumnIndexIterator::~ColumnIndexIterator() {
     }
 }
 
+void ColumnIndexIterator::InitRange(const String &min, const String &max) { dict_reader_->InitRangeIterator(min, max); }
+
 bool ColumnIndexIterator::Next(String &key, PostingDecoder *&decoder) {
     bool ret = dict_reader_->Next(key, term_meta_);
     if (!ret)
         return false;
+    // postings are laid out in term order, only the first term of a range needs a seek
+    if (posting_file_->GetFilePointer() != term_meta_.doc_start_) {
+        posting_file_->Seek(term_meta_.doc_start_);
+    }
     u32 total_len = 0;
     DecodeDocList();
     DecodePosList();
@@ -84,6 +90,17 @@ bool ColumnIndexIterator::Next(String &key, PostingDecoder *&decoder) {
     return true;
 }
 
+Vector<String> ColumnIndexIterator::SampleTerms(SizeT step) {
+    Vector<String> sampled_terms;
+    String term;
+    for (SizeT i = 0; dict_reader_->Next(term, term_meta_); ++i) {
+        if (i % step == step - 1) {
+            sampled_terms.push_back(term);
+        }
+    }
+    return sampled_terms;
+}
+
 void ColumnIndexIterator::DecodeDocList() {
     u32 doc_skiplist_len = posting_file_->ReadVInt();
     u32 doc_list_len = posting_file_->ReadVInt();
@@ -20,8 +20,14 @@ public:
 
     ~ColumnIndexIterator();
 
+    // Restricts Next() to the terms in [min, max), an empty max means no upper bound.
+    void InitRange(const String &min, const String &max);
+
     bool Next(String &term, PostingDecoder *&decoder);
 
+    // Returns every step-th term without decoding postings, the iterator is exhausted afterwards.
+    Vector<String> SampleTerms(SizeT step);
+
 private:
     void DecodeDocList();
 
@@ -2,6 +2,7 @@ module;
 
 #include <cassert>
 #include <fstream>
+#include <future>
 #include <string>
 
 module column_index_merger;
@@ -25,6 +26,7 @@ import third_party;
 import virtual_store;
 import local_file_handle;
 import infinity_exception;
+import status;
 import vector_with_lock;
 import logger;
 import persistence_manager;
@@ -32,6 +34,7 @@ import infinity_context;
 import defer_op;
 import utility;
 import persist_result_handler;
+import smallfloat;
 
 namespace infinity {
 ColumnIndexMerger::ColumnIndexMerger(const String &index_dir, optionflag_t flag) : index_dir_(index_dir), flag_(flag) {}
@@ -70,14 +73,10 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
 
     SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(tmp_dict_file, 1024);
     TermMetaDumper term_meta_dumpler((PostingFormatOption(flag_)));
-    posting_file_writer_ = MakeShared<FileWriter>(tmp_posting_file, 1024);
     std::ofstream ofs(tmp_fst_file.c_str(), std::ios::binary | std::ios::trunc);
     OstreamWriter wtr(ofs);
     FstBuilder fst_builder(wtr);
 
-    SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_);
-    String term;
-    TermMeta term_meta;
     SizeT term_meta_offset = 0;
 
     auto merge_base_rowid = base_rowids[0];
@@ -109,13 +108,27 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
             }
 
             const u32 file_size = file_handle->FileSize();
-            u32 file_read_array_len = file_size / sizeof(u32);
+            u32 file_read_array_len = file_size / ColumnLengthEntrySize(flag_);
             if (unsafe_column_lengths.size() < id_offset + file_read_array_len) {
                 unsafe_column_lengths.resize(id_offset + file_read_array_len);
             }
-            auto [read_count, read_status] = file_handle->Read(unsafe_column_lengths.data() + id_offset, file_size);
-            if (!read_status.ok()) {
-                UnrecoverableError(read_status.message());
+            SizeT read_count = 0;
+            if (FlagIsQuantizedNorm(flag_)) {
+                Vector<u8> column_norms(file_read_array_len);
+                auto [norm_read_count, read_status] = file_handle->Read(column_norms.data(), file_size);
+                if (!read_status.ok()) {
+                    UnrecoverableError(read_status.message());
+                }
+                read_count = norm_read_count;
+                for (u32 j = 0; j < file_read_array_len; ++j) {
+                    unsafe_column_lengths[id_offset + j] = SmallFloat::Byte4ToInt(column_norms[j]);
+                }
+            } else {
+                auto [length_read_count, read_status] = file_handle->Read(unsafe_column_lengths.data() + id_offset, file_size);
+                if (!read_status.ok()) {
+                    UnrecoverableError(read_status.message());
+                }
+                read_count = length_read_count;
             }
             if (read_count != file_size) {
                 String error_message = "ColumnIndexMerger: when loading column length file, read_count != file_size";
@@ -133,26 +146,98 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
         if (!status.ok()) {
             UnrecoverableError(status.message());
         }
-        file_handle->Append(&unsafe_column_lengths[0], sizeof(unsafe_column_lengths[0]) * unsafe_column_lengths.size());
+        if (FlagIsQuantizedNorm(flag_)) {
+            // decoded lengths are exactly representable, so encoding them again is lossless
+            Vector<u8> column_norms(unsafe_column_lengths.size());
+            for (SizeT j = 0; j < unsafe_column_lengths.size(); ++j) {
+                column_norms[j] = SmallFloat::IntToByte4(unsafe_column_lengths[j]);
+            }
+            file_handle->Append(column_norms.data(), column_norms.size());
+        } else {
+            file_handle->Append(&unsafe_column_lengths[0], sizeof(unsafe_column_lengths[0]) * unsafe_column_lengths.size());
+        }
     }
 
-    while (!term_posting_queue.Empty()) {
-        const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
+    // Merge disjoint term ranges concurrently, each into its own posting file.
+    auto &thread_pool = InfinityContext::instance().GetFulltextInvertingThreadPool();
+    Vector<String> range_bounds = SplitTermRanges(base_names, term_range_count_ > 0 ? term_range_count_ : thread_pool.size());
+    const SizeT range_count = range_bounds.size() + 1;
+    Vector<String> range_posting_files(range_count);
+    Vector<SizeT> range_posting_sizes(range_count);
+    Vector<Deque<Pair<String, TermMeta>>> range_terms(range_count); // TermMeta copies drop the posting offsets, so never relocate them
+    for (SizeT i = 0; i < range_count; ++i) {
+        range_posting_files[i] = i == 0 ? tmp_posting_file : fmt::format("{}.{}", tmp_posting_file, i);
+    }
+    auto merge_range = [&](SizeT i) {
+        const String &min_term = i == 0 ? String() : range_bounds[i - 1];
+        const String &max_term = i + 1 == range_count ? String() : range_bounds[i];
+        SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_, min_term, max_term);
+        SharedPtr<FileWriter> posting_file_writer = MakeShared<FileWriter>(range_posting_files[i], 1024);
+        String term;
+        while (!term_posting_queue.Empty()) {
+            const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
 
-        MergeTerm(term, term_meta, merging_term_postings, merge_base_rowid);
+            TermMeta &term_meta = range_terms[i].emplace_back(term, TermMeta()).second;
+            MergeTerm(term_meta, merging_term_postings, merge_base_rowid, posting_file_writer);
+
+            term_posting_queue.MoveToNextTerm();
+        }
+        posting_file_writer->Sync();
+        range_posting_sizes[i] = posting_file_writer->TotalWrittenBytes();
+    };
+    if (range_count == 1) {
+        merge_range(0);
+    } else {
+        LOG_INFO(fmt::format("Merge {} chunks into {} in {} term ranges", base_names.size(), dst_base_name, range_count));
+        Vector<std::future<void>> futs;
+        futs.reserve(range_count);
+        for (SizeT i = 0; i < range_count; ++i) {
+            futs.emplace_back(thread_pool.push([&merge_range, i](int) { merge_range(i); }));
+        }
+        // wait for every range before get() may rethrow, the tasks reference this frame
+        for (auto &fut : futs) {
+            fut.wait();
+        }
+        for (auto &fut : futs) {
+            fut.get();
+        }
+    }
 
-        term_meta_dumpler.Dump(dict_file_writer, term_meta);
+    // Stitch the posting files in term order and rebase the term metas onto the stitched file.
+    const bool has_position_list = PostingFormatOption(flag_).HasPositionList();
+    u64 posting_offset = 0;
+    for (SizeT i = 0; i < range_count; ++i) {
+        if (i > 0) {
+            // the term metas of this range point past the end of the posting file unless all of it is appended
+            Status status = VirtualStore::Merge(tmp_posting_file, range_posting_files[i]);
+            if (!status.ok()) {
+                UnrecoverableError(
+                    fmt::format("Append posting file {} to {} failed: {}", range_posting_files[i], tmp_posting_file, status.message()));
+            }
+            VirtualStore::DeleteFile(range_posting_files[i]);
+        }
+        for (auto &[term, term_meta] : range_terms[i]) {
+            term_meta.doc_start_ += posting_offset;
+            if (has_position_list) {
+                term_meta.pos_start_ += posting_offset;
+                term_meta.pos_end_ += posting_offset;
+            }
+            term_meta_dumpler.Dump(dict_file_writer, term_meta);
 
-        fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
-        term_meta_offset = dict_file_writer->TotalWrittenBytes();
-        term_posting_queue.MoveToNextTerm();
+            fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
+            term_meta_offset = dict_file_writer->TotalWrittenBytes();
+        }
+        range_terms[i].clear();
+        posting_offset += range_posting_sizes[i];
     }
     dict_file_writer->Sync();
-    posting_file_writer_->Sync();
     fst_builder.Finish();
 
     LOG_INFO(fmt::format("Merge from FST file: {}, to DICT file: {}", tmp_fst_file, tmp_dict_file));
-    VirtualStore::Merge(tmp_dict_file, tmp_fst_file);
+    Status merge_status = VirtualStore::Merge(tmp_dict_file, tmp_fst_file);
+    if (!merge_status.ok()) {
+        UnrecoverableError(fmt::format("Append FST file {} to {} failed: {}", tmp_fst_file, tmp_dict_file, merge_status.message()));
+    }
 
     LOG_INFO(fmt::format("Delete FST file: {}", tmp_fst_file));
     VirtualStore::DeleteFile(tmp_fst_file);
@@ -167,14 +252,37 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     }
 }
 
-void ColumnIndexMerger::MergeTerm(const String &term,
-                                  TermMeta &term_meta,
+Vector<String> ColumnIndexMerger::SplitTermRanges(const Vector<String> &base_names, SizeT range_count) const {
+    if (range_count <= 1) {
+        return {};
+    }
+    // every source dictionary contributes samples in proportion to its term count
+    Vector<String> sampled_terms;
+    for (const auto &base_name : base_names) {
+        ColumnIndexIterator column_index_iterator(index_dir_, base_name, flag_);
+        Vector<String> terms = column_index_iterator.SampleTerms(term_range_sample_step_);
+        sampled_terms.insert(sampled_terms.end(), std::make_move_iterator(terms.begin()), std::make_move_iterator(terms.end()));
+    }
+    std::sort(sampled_terms.begin(), sampled_terms.end());
+    Vector<String> range_bounds;
+    for (SizeT i = 1; i < range_count; ++i) {
+        const SizeT idx = sampled_terms.size() * i / range_count;
+        // an empty bound would be taken as no upper bound
+        if (idx < sampled_terms.size() && !sampled_terms[idx].empty() && (range_bounds.empty() || range_bounds.back() < sampled_terms[idx])) {
+            range_bounds.push_back(sampled_terms[idx]);
+        }
+    }
+    return range_bounds;
+}
+
+void ColumnIndexMerger::MergeTerm(TermMeta &term_meta,
                                   const Vector<SegmentTermPosting *> &merging_term_postings,
-                                  const RowID &merge_base_rowid) {
+                                  const RowID &merge_base_rowid,
+                                  const SharedPtr<FileWriter> &posting_file_writer) {
     SharedPtr<PostingMerger> posting_merger = CreatePostingMerger();
     posting_merger->Merge(merging_term_postings, merge_base_rowid);
 
-    posting_merger->Dump(posting_file_writer_, term_meta);
+    posting_merger->Dump(posting_file_writer, term_meta);
 }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
@@ -24,14 +24,31 @@ public:
 
     void Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name);
 
+    // for test: sample a range bound every sample_step terms and split into at most range_count ranges, 0 keeps the pool size.
+    void SetTermRangeSplit(SizeT sample_step, SizeT range_count) {
+        term_range_sample_step_ = sample_step;
+        term_range_count_ = range_count;
+    }
+
 private:
     SharedPtr<PostingMerger> CreatePostingMerger();
 
-    void MergeTerm(const String &term, TermMeta &term_meta, const Vector<SegmentTermPosting *> &merging_term_postings, const RowID &merge_base_rowid);
+    // Returns the sorted lower bounds of the term ranges after the first one, at most range_count - 1 of them.
+    Vector<String> SplitTermRanges(const Vector<String> &base_names, SizeT range_count) const;
+
+    void MergeTerm(TermMeta &term_meta,
+                   const Vector<SegmentTermPosting *> &merging_term_postings,
+                   const RowID &merge_base_rowid,
+                   const SharedPtr<FileWriter> &posting_file_writer);
+
+    // a range bound candidate is sampled every TERM_RANGE_SAMPLE_STEP terms of each source dictionary
+    static constexpr SizeT TERM_RANGE_SAMPLE_STEP = 1024;
 
     String index_dir_;
     optionflag_t flag_;
-    SharedPtr<FileWriter> posting_file_writer_;
+
+    SizeT term_range_sample_step_{TERM_RANGE_SAMPLE_STEP};
+    SizeT term_range_count_{0};
 
     // for column length info
     VectorWithLock<u32> column_lengths_;
@@ -25,6 +25,7 @@ import segment_posting;
 import index_segment_reader;
 import posting_iterator;
 import index_defines;
+import term_automaton;
 import disk_index_segment_reader;
 import inmem_index_segment_reader;
 import memory_indexer;
@@ -50,6 +51,7 @@ import kv_store;
 
 import new_catalog;
 import buffer_handle;
+import smallfloat;
 
 namespace infinity {
 
@@ -117,9 +119,16 @@ Status ColumnIndexReader::Open(optionflag_t flag, TableIndexMeeta &table_index_m
                 // Refers to FullTextColumnLengthReader::SeekFile(RowID row_id)
                 u64 chunk_column_len_sum = 0;
                 BufferHandle chunk_buffer_handle = index_buffer->Load();
-                auto column_lengths = (const u32 *)chunk_buffer_handle.GetData();
-                for (SizeT i = 0; i < chunk_info_ptr->row_cnt_; i++) {
-                    chunk_column_len_sum += column_lengths[i];
+                if (FlagIsQuantizedNorm(flag)) {
+                    auto column_norms = (const u8 *)chunk_buffer_handle.GetData();
+                    for (SizeT i = 0; i < chunk_info_ptr->row_cnt_; i++) {
+                        chunk_column_len_sum += SmallFloat::Byte4ToInt(column_norms[i]);
+                    }
+                } else {
+                    auto column_lengths = (const u32 *)chunk_buffer_handle.GetData();
+                    for (SizeT i = 0; i < chunk_info_ptr->row_cnt_; i++) {
+                        chunk_column_len_sum += column_lengths[i];
+                    }
                 }
                 column_len_sum += chunk_column_len_sum;
                 column_len_cnt += chunk_info_ptr->row_cnt_;
@@ -172,6 +181,24 @@ UniquePtr<PostingIterator> ColumnIndexReader::Lookup(const String &term, bool fe
     return iter;
 }
 
+Vector<Pair<String, u64>> ColumnIndexReader::ExpandTerms(TermAutomaton &automaton, SizeT max_expansions) {
+    Map<String, u64> term_dfs;
+    for (u32 i = 0; i < segment_readers_.size(); ++i) {
+        segment_readers_[i]->CollectTerms(automaton, term_dfs);
+    }
+    Vector<Pair<String, u64>> terms(term_dfs.begin(), term_dfs.end());
+    auto more_frequent = [](const Pair<String, u64> &lhs, const Pair<String, u64> &rhs) {
+        return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first < rhs.first;
+    };
+    if (terms.size() > max_expansions) {
+        std::partial_sort(terms.begin(), terms.begin() + max_expansions, terms.end(), more_frequent);
+        terms.resize(max_expansions);
+    } else {
+        std::sort(terms.begin(), terms.end(), more_frequent);
+    }
+    return terms;
+}
+
 Pair<u64, float> ColumnIndexReader::GetTotalDfAndAvgColumnLength() {
     std::lock_guard lock(mutex_);
     if (total_df_ == 0) {
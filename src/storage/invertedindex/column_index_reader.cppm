@@ -22,6 +22,7 @@ import segment_posting;
 import index_segment_reader;
 import posting_iterator;
 import index_defines;
+import term_automaton;
 // import memory_indexer;
 import internal_types;
 import logger;
@@ -52,6 +53,10 @@ public:
 
     UniquePtr<PostingIterator> Lookup(const String &term, bool fetch_position = true);
 
+    // Terms accepted by the automaton in any segment with their document frequency, at most
+    // max_expansions of them, the most frequent first.
+    Vector<Pair<String, u64>> ExpandTerms(TermAutomaton &automaton, SizeT max_expansions);
+
     Pair<u64, float> GetTotalDfAndAvgColumnLength();
 
     optionflag_t GetOptionFlag() const { return flag_; }
@@ -73,6 +73,17 @@ public:
         }
     }
 
+    // Visits the items in key order starting from key_min, until the visitor returns false.
+    template <typename Visitor>
+    void RangeFrom(const KeyType &key_min, Visitor &&visitor) {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        for (auto it = map_.lower_bound(key_min); it != map_.end(); ++it) {
+            if (!visitor(it->first, it->second)) {
+                break;
+            }
+        }
+    }
+
     // WARN: Caller shall ensure there's no concurrent write access
     Map<KeyType, ValueType>::iterator UnsafeBegin() { return map_.begin(); }
 
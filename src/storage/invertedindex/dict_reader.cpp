@@ -22,6 +22,7 @@ import stl;
 import term_meta;
 import posting_list_format;
 import fst;
+import term_automaton;
 import mmap;
 import infinity_exception;
 
@@ -73,6 +74,12 @@ void DictionaryReader::InitIterator(const String &min, const String &max) {
 
 void DictionaryReader::InitIterator(const String &prefix) { s_->Reset((u8 *)prefix.c_str(), prefix.length()); }
 
+void DictionaryReader::InitRangeIterator(const String &min, const String &max) {
+    Bound min_bound(Bound::kIncluded, (u8 *)min.c_str(), min.length());
+    Bound max_bound = max.empty() ? Bound() : Bound(Bound::kExcluded, (u8 *)max.c_str(), max.length());
+    s_->Reset(min_bound, max_bound);
+}
+
 bool DictionaryReader::Next(String &term, TermMeta &term_meta) {
     Vector<u8> key;
     u64 val;
@@ -86,4 +93,20 @@ bool DictionaryReader::Next(String &term, TermMeta &term_meta) {
     return true;
 }
 
+void DictionaryReader::Search(TermAutomaton &automaton, const std::function<bool(const String &, const TermMeta &)> &visitor) {
+    FstAutomatonStream<TermAutomaton> s(*fst_, automaton);
+    Vector<u8> key;
+    u64 val;
+    while (s.Next(key, val)) {
+        String term((char *)key.data(), key.size());
+        TermMeta term_meta;
+        u8 *data_cursor = data_ptr_ + val;
+        SizeT left_size = data_len_ - val;
+        meta_loader_.Load(data_cursor, left_size, term_meta);
+        if (!visitor(term, term_meta)) {
+            break;
+        }
+    }
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -18,6 +18,7 @@ import stl;
 import term_meta;
 import posting_list_format;
 import fst;
+import term_automaton;
 export module dict_reader;
 
 namespace infinity {
@@ -42,6 +43,13 @@ public:
 
     void InitIterator(const String &prefix);
 
+    // Iterates the terms in [min, max), an empty max means no upper bound.
+    void InitRangeIterator(const String &min, const String &max);
+
     bool Next(String &term, TermMeta &term_meta);
+
+    // Visits the terms accepted by the automaton in lexicographical order, until the visitor returns false.
+    // Unlike InitIterator/Next it doesn't touch the shared stream, so concurrent searches are fine.
+    void Search(TermAutomaton &automaton, const std::function<bool(const String &, const TermMeta &)> &visitor);
 };
 } // namespace infinity
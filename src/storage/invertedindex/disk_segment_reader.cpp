@@ -23,6 +23,7 @@ import stl;
 import segment_posting;
 import index_defines;
 import index_segment_reader;
+import term_automaton;
 import file_reader;
 import dict_reader;
 import term_meta;
@@ -128,4 +129,14 @@ bool DiskIndexSegmentReader::GetSegmentPosting(const String &term, SegmentPostin
     return true;
 }
 
+void DiskIndexSegmentReader::CollectTerms(TermAutomaton &automaton, Map<String, u64> &term_dfs) const {
+    if (!dict_reader_.get()) {
+        return;
+    }
+    dict_reader_->Search(automaton, [&](const String &term, const TermMeta &term_meta) {
+        term_dfs[term] += term_meta.doc_freq_;
+        return true;
+    });
+}
+
 } // namespace infinity
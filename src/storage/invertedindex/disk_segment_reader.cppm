@@ -20,6 +20,7 @@ import stl;
 import segment_posting;
 import index_defines;
 import index_segment_reader;
+import term_automaton;
 import dict_reader;
 import file_reader;
 import posting_list_format;
@@ -40,6 +41,8 @@ public:
 
     bool GetSegmentPosting(const String &term, SegmentPosting &seg_posting, bool fetch_position = true) const override;
 
+    void CollectTerms(TermAutomaton &automaton, Map<String, u64> &term_dfs) const override;
+
 private:
     RowID base_row_id_{INVALID_ROWID};
     SharedPtr<DictionaryReader> dict_reader_;
@@ -48,6 +48,8 @@ private:
     SizeT data_len_;
 
     friend class FstStream;
+    template <typename Automaton>
+    friend class FstAutomatonStream;
 
 public:
     /// Creates a transducer from its representation as a raw byte sequence.
@@ -252,16 +254,16 @@ public:
 
     void Reset(u8 *prefix_ptr, SizeT prefix_len) {
         Bound min(Bound::kIncluded, prefix_ptr, prefix_len);
+        // The exclusive upper bound is the shortest key greater than every key with the prefix.
         Bound max(Bound::kExcluded, prefix_ptr, prefix_len);
-        int i;
-        for (i = prefix_len - 1; i >= 0; i--) {
-            prefix_ptr[i]++;
-            if (prefix_ptr[i] != 0x00) {
-                break;
-            }
+        Vector<u8> &upper = max.key_;
+        while (!upper.empty() && upper.back() == 0xFF) {
+            upper.pop_back();
         }
-        if (i < 0) {
+        if (upper.empty()) {
             max = Bound();
+        } else {
+            upper.back()++;
         }
         Reset(min, max);
     }
@@ -367,4 +369,72 @@ private:
     }
 };
 
-} // namespace infinity
\ No newline at end of file
+/// A lexicographically ordered stream of the keys of an fst accepted by an automaton.
+///
+/// The automaton is run along the transitions of the fst, a subtree is skipped as soon
+/// as the automaton can't match any key below it. `Automaton` has to provide the type `State`,
+/// `State Start()`, `State Accept(State, u8)`, `bool CanMatch(State)` and `bool IsMatch(State)`.
+export template <typename Automaton>
+class FstAutomatonStream {
+private:
+    using AutState = typename Automaton::State;
+
+    struct AutomatonStreamState {
+        Node node_;
+        SizeT trans_;
+        Output out_;
+        AutState aut_state_;
+        AutomatonStreamState(const Node &node, SizeT trans, Output out, AutState aut_state)
+            : node_(node), trans_(trans), out_(out), aut_state_(aut_state) {}
+    };
+
+    Fst &fst_;
+    Automaton &aut_;
+    Vector<u8> inp_;
+    Vector<AutomatonStreamState> stack_;
+
+public:
+    FstAutomatonStream(Fst &fst, Automaton &aut) : fst_(fst), aut_(aut) {
+        AutState start = aut_.Start();
+        if (aut_.CanMatch(start)) {
+            stack_.emplace_back(fst_.Root(), 0, Output(), start);
+        }
+    }
+
+    /// @brief Get next accepted key-value pair per lexicographical order
+    /// @param key Stores the key of the pair when found
+    /// @param val Stores the value of the pair when found
+    /// @return true if found next pair, false if not
+    bool Next(Vector<u8> &key, u64 &val) {
+        while (!stack_.empty()) {
+            AutomatonStreamState &state = stack_.back();
+            if (state.trans_ >= state.node_.Len()) {
+                if (state.node_.Addr() != fst_.RootAddr()) {
+                    inp_.pop_back();
+                }
+                stack_.pop_back();
+                continue;
+            }
+            Transition trans = state.node_.TransAt(state.trans_);
+            state.trans_++;
+            AutState next_aut_state = aut_.Accept(state.aut_state_, trans.inp_);
+            if (!aut_.CanMatch(next_aut_state)) {
+                continue;
+            }
+            Output out = state.out_.Cat(trans.out_);
+            Node next_node = fst_.NodeAt(trans.addr_);
+            inp_.push_back(trans.inp_);
+            bool is_match = next_node.IsFinal() && aut_.IsMatch(next_aut_state);
+            if (is_match) {
+                key = inp_;
+                val = out.Cat(next_node.FinalOutput()).Value();
+            }
+            stack_.emplace_back(next_node, 0, out, next_aut_state);
+            if (is_match)
+                return true;
+        }
+        return false;
+    }
+};
+
+} // namespace infinity
@@ -15,12 +15,13 @@ export {
 
     enum OptionFlag {
         of_none = 0,
-        of_term_payload = 1,   // 1 << 0
-        of_doc_payload = 2,    // 1 << 1
-        of_position_list = 4,  // 1 << 2
-        of_term_frequency = 8, // 1 << 3
-        of_block_max = 16,     // 1 << 4
-        of_realtime = 32,      // 1 << 5
+        of_term_payload = 1,    // 1 << 0
+        of_doc_payload = 2,     // 1 << 1
+        of_position_list = 4,   // 1 << 2
+        of_term_frequency = 8,  // 1 << 3
+        of_block_max = 16,      // 1 << 4
+        of_realtime = 32,       // 1 << 5
+        of_quantized_norm = 64, // 1 << 6, column lengths are stored as one byte each, see SmallFloat::IntToByte4
     };
 
     typedef u16 docpayload_t;
@@ -39,6 +40,10 @@ export {
 
     void FlagAddRealtime(optionflag_t &flag) { flag |= of_realtime; }
     bool FlagIsRealtime(const optionflag_t &flag) { return flag & of_realtime; }
+    void FlagAddQuantizedNorm(optionflag_t &flag) { flag |= of_quantized_norm; }
+    bool FlagIsQuantizedNorm(const optionflag_t &flag) { return flag & of_quantized_norm; }
+    // size of one entry of the column length (.len) file
+    SizeT ColumnLengthEntrySize(const optionflag_t &flag) { return FlagIsQuantizedNorm(flag) ? sizeof(u8) : sizeof(u32); }
 
     constexpr docid_t INVALID_DOCID = u32(-1);
     constexpr RowID INVALID_ROWID = u64(-1);
@@ -18,6 +18,7 @@ import stl;
 
 import segment_posting;
 import index_defines;
+import term_automaton;
 export module index_segment_reader;
 
 namespace infinity {
@@ -29,6 +30,9 @@ public:
     // fetch_position is only valid in DiskIndexSegmentReader
     virtual bool GetSegmentPosting(const String &term, SegmentPosting &seg_posting, bool fetch_position = true) const = 0;
 
+    // Adds the document frequency in this segment of each term accepted by the automaton
+    virtual void CollectTerms(TermAutomaton &automaton, Map<String, u64> &term_dfs) const = 0;
+
     SegmentID segment_id() const { return segment_id_; }
 
     ChunkID chunk_id() const { return chunk_id_; }
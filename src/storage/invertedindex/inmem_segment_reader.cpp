@@ -20,6 +20,7 @@ import stl;
 
 import segment_posting;
 import index_segment_reader;
+import term_automaton;
 import index_defines;
 import posting_writer;
 import memory_indexer;
@@ -40,4 +41,18 @@ bool InMemIndexSegmentReader::GetSegmentPosting(const String &term, SegmentPosti
     return false;
 }
 
+void InMemIndexSegmentReader::CollectTerms(TermAutomaton &automaton, Map<String, u64> &term_dfs) const {
+    // The memory index has no FST, only the terms sharing the literal prefix are run through the automaton.
+    const String prefix = automaton.LiteralPrefix();
+    posting_table_->store_.RangeFrom(prefix, [&](const String &term, const SharedPtr<PostingWriter> &writer) {
+        if (term.compare(0, prefix.size(), prefix) != 0) {
+            return false;
+        }
+        if (automaton.Matches(term)) {
+            term_dfs[term] += writer->GetDF();
+        }
+        return true;
+    });
+}
+
 } // namespace infinity
\ No newline at end of file
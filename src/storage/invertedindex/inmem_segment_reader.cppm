@@ -20,6 +20,7 @@ import stl;
 
 import segment_posting;
 import index_segment_reader;
+import term_automaton;
 import index_defines;
 import posting_writer;
 import memory_indexer;
@@ -33,6 +34,8 @@ public:
 
     bool GetSegmentPosting(const String &term, SegmentPosting &seg_posting, bool fetch_position = true) const override;
 
+    void CollectTerms(TermAutomaton &automaton, Map<String, u64> &term_dfs) const override;
+
 private:
     SharedPtr<MemoryIndexer::PostingTable> posting_table_;
     RowID base_row_id_{INVALID_ROWID};
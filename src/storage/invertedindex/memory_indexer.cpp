@@ -67,9 +67,24 @@ import virtual_store;
 import local_file_handle;
 import mem_usage_change;
 import bg_task;
+import smallfloat;
 
 namespace infinity {
 constexpr int MAX_TUPLE_LENGTH = 1024; // we assume that analyzed term, together with docid/offset info, will never exceed such length
+
+// Write the column length file of a dumped chunk, one byte per document if the index uses quantized norms.
+void WriteColumnLengthFile(LocalFileHandle &file_handle, const Vector<u32> &column_lengths, optionflag_t flag) {
+    if (FlagIsQuantizedNorm(flag)) {
+        Vector<u8> column_norms(column_lengths.size());
+        for (SizeT i = 0; i < column_lengths.size(); ++i) {
+            column_norms[i] = SmallFloat::IntToByte4(column_lengths[i]);
+        }
+        file_handle.Append(column_norms.data(), column_norms.size());
+        return;
+    }
+    file_handle.Append(column_lengths.data(), sizeof(u32) * column_lengths.size());
+}
+
 bool MemoryIndexer::KeyComp::operator()(const String &lhs, const String &rhs) const {
     int ret = strcmp(lhs.c_str(), rhs.c_str());
     return ret < 0;
@@ -452,7 +467,12 @@ void MemoryIndexer::Dump(bool offline, bool spill) {
     }
 
     Vector<u32> &column_length_array = column_lengths_.UnsafeVec();
-    file_handle->Append(&column_length_array[0], sizeof(column_length_array[0]) * column_length_array.size());
+    if (spill) {
+        // spilled lengths are loaded back by MemoryIndexer::Load() and must stay exact
+        file_handle->Append(&column_length_array[0], sizeof(column_length_array[0]) * column_length_array.size());
+    } else {
+        WriteColumnLengthFile(*file_handle, column_length_array, flag_);
+    }
     file_handle->Sync();
     if (use_object_cache) {
         PersistResultHandler handler(pm);
@@ -669,7 +689,7 @@ void MemoryIndexer::TupleListToIndexFile(UniquePtr<SortMergerTermTuple<TermTuple
     }
 
     Vector<u32> &unsafe_column_lengths = column_lengths_.UnsafeVec();
-    file_handle->Append(&unsafe_column_lengths[0], sizeof(unsafe_column_lengths[0]) * unsafe_column_lengths.size());
+    WriteColumnLengthFile(*file_handle, unsafe_column_lengths, flag_);
     if (use_object_cache) {
         PersistResultHandler handler(pm);
         PersistWriteResult result1 = pm->Persist(posting_file, tmp_posting_file, false);
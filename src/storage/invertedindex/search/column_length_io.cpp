@@ -24,11 +24,12 @@ import column_index_reader;
 import memory_indexer;
 import buffer_obj;
 import buffer_handle;
+import index_defines;
 
 namespace infinity {
 
 FullTextColumnLengthReader::FullTextColumnLengthReader(ColumnIndexReader *reader)
-    : index_dir_(reader->index_dir_), memory_indexer_(reader->memory_indexer_) {
+    : index_dir_(reader->index_dir_), memory_indexer_(reader->memory_indexer_), quantized_norm_(FlagIsQuantizedNorm(reader->GetOptionFlag())) {
     chunk_index_meta_infos_ = reader->chunk_index_meta_infos_;
 
     Pair<u64, float> df_and_avg_column_len = reader->GetTotalDfAndAvgColumnLength();
@@ -38,7 +39,7 @@ FullTextColumnLengthReader::FullTextColumnLengthReader(ColumnIndexReader *reader
 
 FullTextColumnLengthReader::~FullTextColumnLengthReader() = default;
 
-u32 FullTextColumnLengthReader::SeekFile(RowID row_id) {
+bool FullTextColumnLengthReader::SeekFile(RowID row_id) {
     // determine the chunk index which contains row_id
     current_chunk_buffer_handle_.~BufferHandle();
     SizeT left = 0;
@@ -56,14 +57,18 @@ u32 FullTextColumnLengthReader::SeekFile(RowID row_id) {
         }
     }
     if (current_chunk == std::numeric_limits<SizeT>::max()) {
-        return 0;
+        return false;
     }
 
     // Load the column-length file of the chunk index
     current_chunk_buffer_handle_ = chunk_index_meta_infos_[current_chunk].index_buffer_->Load();
-    column_lengths_ = (const u32 *)current_chunk_buffer_handle_.GetData();
+    if (quantized_norm_) {
+        column_norms_ = (const u8 *)current_chunk_buffer_handle_.GetData();
+    } else {
+        column_lengths_ = (const u32 *)current_chunk_buffer_handle_.GetData();
+    }
     current_chunk_base_rowid_ = chunk_index_meta_infos_[current_chunk].base_rowid_;
     current_chunk_row_count_ = chunk_index_meta_infos_[current_chunk].row_count_;
-    return column_lengths_[row_id - current_chunk_base_rowid_];
+    return true;
 }
 } // namespace infinity
\ No newline at end of file
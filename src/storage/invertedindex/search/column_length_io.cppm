@@ -25,6 +25,7 @@ import memory_indexer;
 import buffer_obj;
 import buffer_handle;
 import column_index_reader;
+import smallfloat;
 
 namespace infinity {
 class FileSystem;
@@ -37,6 +38,9 @@ public:
     ~FullTextColumnLengthReader();
 
     inline u32 GetColumnLength(RowID row_id) {
+        if (quantized_norm_) {
+            return SmallFloat::Byte4ToInt(GetColumnNorm(row_id));
+        }
         if (row_id >= current_chunk_base_rowid_ && row_id < current_chunk_base_rowid_ + current_chunk_row_count_) [[likely]] {
             assert(column_lengths_ != nullptr);
             return column_lengths_[row_id - current_chunk_base_rowid_];
@@ -48,21 +52,42 @@ public:
                 return memory_indexer_->GetColumnLength(row_id - base_rowid);
             }
         }
-        return SeekFile(row_id);
+        return SeekFile(row_id) ? column_lengths_[row_id - current_chunk_base_rowid_] : 0;
+    }
+
+    // One byte norm of the column length, only valid if HasQuantizedNorm().
+    // Documents still in the memory indexer are encoded on the fly, so they score the same before and after dump.
+    inline u8 GetColumnNorm(RowID row_id) {
+        if (row_id >= current_chunk_base_rowid_ && row_id < current_chunk_base_rowid_ + current_chunk_row_count_) [[likely]] {
+            assert(column_norms_ != nullptr);
+            return column_norms_[row_id - current_chunk_base_rowid_];
+        }
+        if (memory_indexer_.get() != nullptr) {
+            RowID base_rowid = memory_indexer_->GetBaseRowId();
+            u32 doc_count = memory_indexer_->GetDocCount();
+            if (row_id >= base_rowid && row_id < base_rowid + doc_count) {
+                return SmallFloat::IntToByte4(memory_indexer_->GetColumnLength(row_id - base_rowid));
+            }
+        }
+        return SeekFile(row_id) ? column_norms_[row_id - current_chunk_base_rowid_] : 0;
     }
 
+    inline bool HasQuantizedNorm() const { return quantized_norm_; }
     inline u64 GetTotalDF() const { return total_df_; }
     inline float GetAvgColumnLength() const { return avg_column_len_; }
 
 private:
-    u32 SeekFile(RowID row_id);
+    // load the chunk containing row_id, return false if no chunk contains it
+    bool SeekFile(RowID row_id);
     const String &index_dir_;
     Vector<ColumnReaderChunkInfo> chunk_index_meta_infos_{}; // must in ascending order
 
     SharedPtr<MemoryIndexer> memory_indexer_{};
     u64 total_df_{};
     float avg_column_len_{};
+    bool quantized_norm_{false};
     const u32 *column_lengths_{nullptr};
+    const u8 *column_norms_{nullptr};
     RowID current_chunk_base_rowid_{(u64)0};
     u32 current_chunk_row_count_{0};
     BufferHandle current_chunk_buffer_handle_{};
@@ -43,7 +43,7 @@ public:
             }
             doc_id = query_iterator_->DocID();
             // check filter
-            if (common_query_filter_ == nullptr || common_query_filter_->PassFilter(doc_id)) {
+            if (common_query_filter_ == nullptr || common_query_filter_->PassFilter(doc_id, current_segment_id_, doc_id_bitmask_)) {
                 doc_id_ = doc_id;
                 return true;
             }
@@ -63,6 +63,9 @@ public:
 private:
     CommonQueryFilter *common_query_filter_{};
     UniquePtr<DocIterator> query_iterator_{};
+    // cursor of the filter, owned by the iterator for the iterators of one query run concurrently
+    SegmentID current_segment_id_ = INVALID_SEGMENT_ID;
+    const Bitmask *doc_id_bitmask_ = nullptr;
 };
 
 // use QueryNodeType::FILTER
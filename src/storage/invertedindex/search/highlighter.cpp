@@ -26,6 +26,7 @@ import stl;
 import aho_corasick;
 import analyzer;
 import term;
+import term_automaton;
 
 namespace infinity {
 
@@ -98,25 +99,30 @@ void Highlighter::GetHighlightWithoutStemmer(const Vector<String> &query, const
     }
 }
 
-void Highlighter::GetHighlightWithStemmer(const Vector<String> &query, const String &raw_text, String &output, Analyzer *analyzer) {
+void Highlighter::GetHighlightWithStemmer(const Vector<String> &query,
+                                          const Vector<SharedPtr<TermAutomaton>> &query_automata,
+                                          const String &raw_text,
+                                          String &output,
+                                          Analyzer *analyzer) {
     analyzer->SetCharOffset(true);
     TermList term_list;
     analyzer->Analyze(raw_text, term_list);
 
-    std::sort(term_list.begin(), term_list.end(), [](const Term &lhs, const Term &rhs) noexcept { return lhs.text_ < rhs.text_; });
-
+    Set<String> query_set(query.begin(), query.end());
     TermList hit_list;
-    for (auto &query_term : query) {
-        auto lower = std::lower_bound(term_list.begin(), term_list.end(), query_term, [](auto element, auto query_term) {
-            return element.text_ < query_term;
-        });
-        for (auto iter = lower; iter != term_list.end(); ++iter) {
-            if (iter->text_ == query_term) {
-                hit_list.push_back(*iter);
-            }
+    for (auto &term : term_list) {
+        // The automata are shared by the projections of all the blocks, so they must not cache DFA states
+        if (query_set.contains(term.text_) ||
+            std::any_of(query_automata.begin(), query_automata.end(), [&](const auto &automaton) { return automaton->MatchesUncached(term.text_); })) {
+            hit_list.push_back(term);
         }
     }
     std::sort(hit_list.begin(), hit_list.end(), [](const Term &lhs, const Term &rhs) noexcept { return lhs.word_offset_ < rhs.word_offset_; });
+    // A word and its stem share the offset, mark it once
+    hit_list.erase(std::unique(hit_list.begin(),
+                               hit_list.end(),
+                               [](const Term &lhs, const Term &rhs) noexcept { return lhs.word_offset_ == rhs.word_offset_; }),
+                   hit_list.end());
 
     const u32 max_results = 1024;
     Vector<AhoCorasick::ResultType> matches(max_results + 1);
@@ -20,11 +20,14 @@ import stl;
 import singleton;
 import aho_corasick;
 import analyzer;
+import term_automaton;
 
 namespace infinity {
 
 export struct HighlightInfo {
     Vector<String> query_terms_;
+    // Prefix, wildcard and fuzzy terms, matched against the analyzed tokens
+    Vector<SharedPtr<TermAutomaton>> query_term_automata_;
     String analyzer_;
 };
 
@@ -34,7 +37,11 @@ public:
 
     void GetHighlightWithoutStemmer(const Vector<String> &query, const String &raw_text, String &output);
 
-    void GetHighlightWithStemmer(const Vector<String> &query, const String &raw_text, String &output, Analyzer *analyzer);
+    void GetHighlightWithStemmer(const Vector<String> &query,
+                                 const Vector<SharedPtr<TermAutomaton>> &query_automata,
+                                 const String &raw_text,
+                                 String &output,
+                                 Analyzer *analyzer);
 
 private:
     AhoCorasick sentence_delimiter_;
@@ -42,13 +42,27 @@ void QueryBuilder::Init(SharedPtr<IndexReader> index_reader) { index_reader_ = s
 QueryBuilder::~QueryBuilder() {}
 
 UniquePtr<DocIterator> QueryBuilder::CreateSearch(FullTextQueryContext &context) {
-    // Optimize the query tree.
+    // Optimize the query tree, once for all the iterators created from the context.
     if (!context.optimized_query_tree_) {
         context.optimized_query_tree_ = QueryNode::GetOptimizedQueryTree(std::move(context.query_tree_));
         if (!context.minimum_should_match_option_.empty()) {
             const auto leaf_count = context.optimized_query_tree_->LeafCount();
             context.minimum_should_match_ = GetMinimumShouldMatchParameter(context.minimum_should_match_option_, leaf_count);
         }
+        if (!context.rank_features_option_.empty()) {
+            auto rank_features_node = std::make_unique<RankFeaturesQueryNode>();
+            for (auto rank_feature : context.rank_features_option_) {
+                auto rank_feature_node = std::make_unique<RankFeatureQueryNode>();
+                rank_feature_node->term_ = rank_feature.feature_;
+                rank_feature_node->column_ = rank_feature.field_;
+                rank_feature_node->boost_ = rank_feature.boost_;
+                rank_features_node->Add(std::move(rank_feature_node));
+            }
+            auto query_tree = std::make_unique<OrQueryNode>();
+            query_tree->Add(std::move(context.optimized_query_tree_));
+            query_tree->Add(std::move(rank_features_node));
+            context.optimized_query_tree_ = std::move(query_tree);
+        }
     }
     // Create the iterator from the query tree.
     const CreateSearchParams params{table_info_.get(),
@@ -59,20 +73,6 @@ UniquePtr<DocIterator> QueryBuilder::CreateSearch(FullTextQueryContext &context)
                                     context.minimum_should_match_,
                                     context.topn_,
                                     context.index_names_};
-    if (!context.rank_features_option_.empty()) {
-        auto rank_features_node = std::make_unique<RankFeaturesQueryNode>();
-        for (auto rank_feature : context.rank_features_option_) {
-            auto rank_feature_node = std::make_unique<RankFeatureQueryNode>();
-            rank_feature_node->term_ = rank_feature.feature_;
-            rank_feature_node->column_ = rank_feature.field_;
-            rank_feature_node->boost_ = rank_feature.boost_;
-            rank_features_node->Add(std::move(rank_feature_node));
-        }
-        auto query_tree = std::make_unique<OrQueryNode>();
-        query_tree->Add(std::move(context.optimized_query_tree_));
-        query_tree->Add(std::move(rank_features_node));
-        context.optimized_query_tree_ = std::move(query_tree);
-    }
     auto result = context.optimized_query_tree_->CreateSearch(params);
 #ifdef INFINITY_DEBUG
     {
@@ -29,6 +29,7 @@ import batch_or_iterator;
 import blockmax_leaf_iterator;
 import rank_feature_doc_iterator;
 import rank_features_doc_iterator;
+import term_automaton;
 
 namespace infinity {
 
@@ -69,6 +70,9 @@ std::unique_ptr<QueryNode> QueryNode::GetOptimizedQueryTree(std::unique_ptr<Quer
     switch (root->GetType()) {
         case QueryNodeType::TERM:
         case QueryNodeType::PHRASE:
+        case QueryNodeType::PREFIX_TERM:
+        case QueryNodeType::WILDCARD_TERM:
+        case QueryNodeType::FUZZY_TERM:
         case QueryNodeType::KEYWORD: {
             // no need to optimize
             optimized_root = std::move(root);
@@ -116,6 +120,9 @@ std::unique_ptr<QueryNode> MultiQueryNode::GetNewOptimizedQueryTree() {
         switch (child->GetType()) {
             case QueryNodeType::TERM:
             case QueryNodeType::PHRASE:
+            case QueryNodeType::PREFIX_TERM:
+            case QueryNodeType::WILDCARD_TERM:
+            case QueryNodeType::FUZZY_TERM:
             case QueryNodeType::KEYWORD: {
                 // no need to optimize
                 break;
@@ -168,6 +175,9 @@ std::unique_ptr<QueryNode> NotQueryNode::InnerGetNewOptimizedQueryTree() {
             }
             case QueryNodeType::TERM:
             case QueryNodeType::PHRASE:
+            case QueryNodeType::PREFIX_TERM:
+            case QueryNodeType::WILDCARD_TERM:
+            case QueryNodeType::FUZZY_TERM:
             case QueryNodeType::KEYWORD:
             case QueryNodeType::AND:
             case QueryNodeType::AND_NOT: {
@@ -221,6 +231,9 @@ std::unique_ptr<QueryNode> AndQueryNode::InnerGetNewOptimizedQueryTree() {
             }
             case QueryNodeType::TERM:
             case QueryNodeType::PHRASE:
+            case QueryNodeType::PREFIX_TERM:
+            case QueryNodeType::WILDCARD_TERM:
+            case QueryNodeType::FUZZY_TERM:
             case QueryNodeType::KEYWORD:
             case QueryNodeType::OR: {
                 and_list.emplace_back(std::move(child));
@@ -311,6 +324,9 @@ std::unique_ptr<QueryNode> OrQueryNode::InnerGetNewOptimizedQueryTree() {
             }
             case QueryNodeType::TERM:
             case QueryNodeType::PHRASE:
+            case QueryNodeType::PREFIX_TERM:
+            case QueryNodeType::WILDCARD_TERM:
+            case QueryNodeType::FUZZY_TERM:
             case QueryNodeType::KEYWORD:
             case QueryNodeType::AND:
             case QueryNodeType::AND_NOT: {
@@ -440,6 +456,48 @@ std::unique_ptr<DocIterator> TermQueryNode::CreateSearch(const CreateSearchParam
     return search;
 }
 
+std::unique_ptr<DocIterator> MultiTermQueryNode::CreateSearch(const CreateSearchParams params, const bool is_top_level) const {
+    ColumnID column_id = params.table_info->GetColumnIdByName(column_);
+    ColumnIndexReader *column_index_reader = params.index_reader->GetColumnIndexReader(column_id, params.index_names_);
+    if (!column_index_reader) {
+        RecoverableError(Status::SyntaxError(fmt::format(R"(Invalid query statement: Column "{}" has no fulltext index)", column_)));
+        return nullptr;
+    }
+    std::call_once(expand_flag_, [&] {
+        auto automaton = BuildAutomaton();
+        auto terms = column_index_reader->ExpandTerms(*automaton, max_expansions_);
+        if (terms.empty()) {
+            return;
+        }
+        auto make_term_node = [&](const String &term) {
+            auto term_node = std::make_unique<TermQueryNode>();
+            term_node->term_ = term;
+            term_node->column_ = column_;
+            term_node->MultiplyWeight(GetWeight());
+            return term_node;
+        };
+        if (terms.size() == 1) {
+            expanded_ = make_term_node(terms[0].first);
+            return;
+        }
+        auto or_node = std::make_unique<OrQueryNode>();
+        for (const auto &[term, df] : terms) {
+            or_node->Add(make_term_node(term));
+        }
+        expanded_ = std::move(or_node);
+    });
+    if (!expanded_) {
+        return nullptr;
+    }
+    return expanded_->CreateSearch(params.RemoveMSM(), is_top_level);
+}
+
+std::unique_ptr<TermAutomaton> PrefixTermQueryNode::BuildAutomaton() const { return std::make_unique<PrefixAutomaton>(pattern_); }
+
+std::unique_ptr<TermAutomaton> WildcardTermQueryNode::BuildAutomaton() const { return std::make_unique<WildcardAutomaton>(pattern_); }
+
+std::unique_ptr<TermAutomaton> FuzzyTermQueryNode::BuildAutomaton() const { return std::make_unique<LevenshteinAutomaton>(pattern_, max_edits_); }
+
 std::unique_ptr<DocIterator> RankFeatureQueryNode::CreateSearch(const CreateSearchParams params, bool) const {
     ColumnID column_id = params.table_info->GetColumnIdByName(column_);
     ColumnIndexReader *column_index_reader = params.index_reader->GetColumnIndexReader(column_id, params.index_names_);
@@ -780,10 +838,10 @@ std::string QueryNodeTypeToString(const QueryNodeType type) {
             return "PHRASE";
         case QueryNodeType::PREFIX_TERM:
             return "PREFIX_TERM";
-        case QueryNodeType::SUFFIX_TERM:
-            return "SUFFIX_TERM";
-        case QueryNodeType::SUBSTRING_TERM:
-            return "SUBSTRING_TERM";
+        case QueryNodeType::WILDCARD_TERM:
+            return "WILDCARD_TERM";
+        case QueryNodeType::FUZZY_TERM:
+            return "FUZZY_TERM";
     }
 }
 
@@ -802,6 +860,40 @@ void TermQueryNode::GetQueryColumnsTerms(std::vector<std::string> &columns, std:
     terms.push_back(term_);
 }
 
+void MultiTermQueryNode::PrintTree(std::ostream &os, const std::string &prefix, const bool is_final) const {
+    os << prefix;
+    os << (is_final ? "└──" : "├──");
+    os << QueryNodeTypeToString(type_);
+    os << " (weight: " << weight_ << ")";
+    os << " (column: " << column_ << ")";
+    os << " (pattern: " << pattern_ << ")";
+    os << '\n';
+}
+
+// the expanded terms are unknown before searching, they are matched by GetQueryTermAutomata instead
+void MultiTermQueryNode::GetQueryColumnsTerms(std::vector<std::string> &columns, std::vector<std::string> &) const { columns.push_back(column_); }
+
+void MultiTermQueryNode::GetQueryTermAutomata(std::vector<std::shared_ptr<TermAutomaton>> &automata) const {
+    automata.push_back(BuildAutomaton());
+}
+
+// the literal prefix lets highlighters without an analyzer mark the start of the expanded terms
+void PrefixTermQueryNode::GetQueryColumnsTerms(std::vector<std::string> &columns, std::vector<std::string> &terms) const {
+    columns.push_back(column_);
+    terms.push_back(pattern_);
+}
+
+void FuzzyTermQueryNode::PrintTree(std::ostream &os, const std::string &prefix, const bool is_final) const {
+    os << prefix;
+    os << (is_final ? "└──" : "├──");
+    os << QueryNodeTypeToString(type_);
+    os << " (weight: " << weight_ << ")";
+    os << " (column: " << column_ << ")";
+    os << " (term: " << pattern_ << ")";
+    os << " (max_edits: " << max_edits_ << ")";
+    os << '\n';
+}
+
 void RankFeatureQueryNode::PrintTree(std::ostream &os, const std::string &prefix, const bool is_final) const {
     os << prefix;
     os << (is_final ? "└──" : "├──");
@@ -859,6 +951,12 @@ void MultiQueryNode::GetQueryColumnsTerms(std::vector<std::string> &columns, std
     }
 }
 
+void MultiQueryNode::GetQueryTermAutomata(std::vector<std::shared_ptr<TermAutomaton>> &automata) const {
+    for (u32 i = 0; i < children_.size(); ++i) {
+        children_[i]->GetQueryTermAutomata(automata);
+    }
+}
+
 uint32_t MultiQueryNode::LeafCount() const {
     switch (GetType()) {
         case QueryNodeType::OR:
@@ -16,6 +16,7 @@
 #define QUERY_NODE_H
 
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -38,15 +39,16 @@ enum class QueryNodeType : char {
     AND_NOT,
     OR,
     KEYWORD,
-    // unimplemented:
+    // expanded to terms on search:
     PREFIX_TERM,
-    SUFFIX_TERM,
-    SUBSTRING_TERM,
+    WILDCARD_TERM,
+    FUZZY_TERM,
 };
 
 std::string QueryNodeTypeToString(QueryNodeType type);
 
 struct IndexReader;
+class TermAutomaton;
 class Scorer;
 class DocIterator;
 class EarlyTerminateIterator;
@@ -109,6 +111,8 @@ struct QueryNode {
     virtual void PrintTree(std::ostream &os, const std::string &prefix = "", bool is_final = true) const = 0;
 
     virtual void GetQueryColumnsTerms(std::vector<std::string> &columns, std::vector<std::string> &terms) const = 0;
+    // automata of the terms which are only known after expansion, used for highlighting
+    virtual void GetQueryTermAutomata(std::vector<std::shared_ptr<TermAutomaton>> &) const {}
 };
 
 struct TermQueryNode : public QueryNode {
@@ -174,6 +178,7 @@ struct MultiQueryNode : public QueryNode {
     virtual std::unique_ptr<QueryNode> InnerGetNewOptimizedQueryTree() = 0;
     void PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const final;
     void GetQueryColumnsTerms(std::vector<std::string> &columns, std::vector<std::string> &terms) const final;
+    void GetQueryTermAutomata(std::vector<std::shared_ptr<TermAutomaton>> &automata) const final;
 };
 
 // "NotQueryNode" will be generated by parser
@@ -218,10 +223,62 @@ struct KeywordQueryNode final : public MultiQueryNode {
     std::unique_ptr<DocIterator> CreateSearch(CreateSearchParams params, bool is_top_level) const override;
 };
 
-// unimplemented
-struct PrefixTermQueryNode;
-struct SuffixTermQueryNode;
-struct SubstringTermQueryNode;
+// Base of the queries matching every indexed term accepted by an automaton.
+// On the first CreateSearch the automaton is intersected with the term dictionaries, and the
+// max_expansions_ terms with the highest document frequency form an "or" of term queries.
+struct MultiTermQueryNode : public QueryNode {
+    std::string column_;
+    std::string pattern_;
+    uint32_t max_expansions_ = 50;
+
+    explicit MultiTermQueryNode(QueryNodeType type) : QueryNode(type) {}
+
+    uint32_t LeafCount() const override { return 1; }
+    void PushDownWeight(float factor) override { MultiplyWeight(factor); }
+    std::unique_ptr<DocIterator> CreateSearch(CreateSearchParams params, bool is_top_level) const override;
+    void PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const override;
+    void GetQueryColumnsTerms(std::vector<std::string> &columns, std::vector<std::string> &terms) const override;
+    void GetQueryTermAutomata(std::vector<std::shared_ptr<TermAutomaton>> &automata) const override;
+
+protected:
+    virtual std::unique_ptr<TermAutomaton> BuildAutomaton() const = 0;
+
+private:
+    // CreateSearch runs once per segment, possibly concurrently, the expansion is shared.
+    // The expanded node outlives the iterators, which point to its terms.
+    mutable std::once_flag expand_flag_;
+    mutable std::unique_ptr<QueryNode> expanded_;
+};
+
+// "abc*"
+struct PrefixTermQueryNode final : public MultiTermQueryNode {
+    PrefixTermQueryNode() : MultiTermQueryNode(QueryNodeType::PREFIX_TERM) {}
+
+    void GetQueryColumnsTerms(std::vector<std::string> &columns, std::vector<std::string> &terms) const override;
+
+protected:
+    std::unique_ptr<TermAutomaton> BuildAutomaton() const override;
+};
+
+// "a?c*", pattern_ uses '\' to escape literal '*' and '?'
+struct WildcardTermQueryNode final : public MultiTermQueryNode {
+    WildcardTermQueryNode() : MultiTermQueryNode(QueryNodeType::WILDCARD_TERM) {}
+
+protected:
+    std::unique_ptr<TermAutomaton> BuildAutomaton() const override;
+};
+
+// "abc~2"
+struct FuzzyTermQueryNode final : public MultiTermQueryNode {
+    uint32_t max_edits_ = 2;
+
+    FuzzyTermQueryNode() : MultiTermQueryNode(QueryNodeType::FUZZY_TERM) {}
+
+    void PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const override;
+
+protected:
+    std::unique_ptr<TermAutomaton> BuildAutomaton() const override;
+};
 
 } // namespace infinity
 
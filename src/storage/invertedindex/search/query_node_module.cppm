@@ -31,11 +31,12 @@ export using infinity::AndNotQueryNode;
 export using infinity::OrQueryNode;
 export using infinity::NotQueryNode;
 export using infinity::PhraseQueryNode;
+export using infinity::MultiTermQueryNode;
+export using infinity::PrefixTermQueryNode;
+export using infinity::WildcardTermQueryNode;
+export using infinity::FuzzyTermQueryNode;
 
 // unimplemented
 // export using infinity::WandQueryNode;
-// export using infinity::PrefixTermQueryNode;
-// export using infinity::SuffixTermQueryNode;
-// export using infinity::SubstringTermQueryNode;
 
 } // namespace infinity
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cassert>
+#include <cctype>
 #include <iostream>
 #include <sstream>
 #include <utility>
@@ -109,6 +110,86 @@ std::unique_ptr<QueryNode> SearchDriver::ParseSingleWithFields(const std::string
     return parsed_query_tree;
 }
 
+// The search lexer has no tokens for wildcards and for a fuzzy term without edit distance.
+// Outside quotes, unescaped '*' and '?' are replaced by noncharacters the lexer takes as part of a term,
+// and a bare '~' after a term by "~2".
+constexpr std::string_view kAnyStringMarker = "\xef\xb7\x90"; // U+FDD0
+constexpr std::string_view kAnyCharMarker = "\xef\xb7\x91";   // U+FDD1
+constexpr unsigned long kMaxFuzzyEdits = 2;
+
+std::string MarkWildcards(const std::string &query) {
+    std::string result;
+    result.reserve(query.size());
+    char quote = 0;
+    for (size_t i = 0; i < query.size(); ++i) {
+        const char c = query[i];
+        if (c == '\\' && i + 1 < query.size()) {
+            result.push_back(c);
+            result.push_back(query[++i]);
+        } else if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+            result.push_back(c);
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+            result.push_back(c);
+        } else if (c == '*') {
+            result.append(kAnyStringMarker);
+        } else if (c == '?') {
+            result.append(kAnyCharMarker);
+        } else if (c == '~' && (i + 1 == query.size() || !std::isdigit(static_cast<unsigned char>(query[i + 1]))) && !result.empty() &&
+                   !std::isspace(static_cast<unsigned char>(result.back())) && std::string_view("\"')").find(result.back()) == std::string_view::npos) {
+            result.append("~").append(std::to_string(kMaxFuzzyEdits));
+        } else {
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+// Builds a prefix or wildcard query from unquoted text containing markers of MarkWildcards.
+// Like Lucene, the pattern isn't analyzed, it is only lowercased unless the field uses the keyword analyzer.
+std::unique_ptr<QueryNode> BuildWildcardQueryNode(const std::string &field, const std::string &text, const bool lowercase) {
+    std::string pattern;
+    std::string literal;
+    size_t wildcard_count = 0;
+    bool ends_with_any_string = false;
+    for (size_t i = 0; i < text.size(); ++i) {
+        ends_with_any_string = false;
+        if (text.compare(i, kAnyStringMarker.size(), kAnyStringMarker) == 0) {
+            pattern.push_back('*');
+            i += kAnyStringMarker.size() - 1;
+            ++wildcard_count;
+            ends_with_any_string = true;
+        } else if (text.compare(i, kAnyCharMarker.size(), kAnyCharMarker) == 0) {
+            pattern.push_back('?');
+            i += kAnyCharMarker.size() - 1;
+            ++wildcard_count;
+        } else {
+            char c = text[i];
+            if (lowercase && c >= 'A' && c <= 'Z') {
+                c = c - 'A' + 'a';
+            }
+            if (c == '*' || c == '?' || c == '\\') {
+                pattern.push_back('\\');
+            }
+            pattern.push_back(c);
+            literal.push_back(c);
+        }
+    }
+    if (wildcard_count == 1 && ends_with_any_string) {
+        auto result = std::make_unique<PrefixTermQueryNode>();
+        result->pattern_ = std::move(literal);
+        result->column_ = field;
+        return result;
+    }
+    auto result = std::make_unique<WildcardTermQueryNode>();
+    result->pattern_ = std::move(pattern);
+    result->column_ = field;
+    return result;
+}
+
 inline TermList GetTermListFromAnalyzer(const std::string &analyzer_name, Analyzer *analyzer, const std::string &query_str) {
     TermList result;
     Term input_term;
@@ -169,6 +250,7 @@ std::unique_ptr<QueryNode> SearchDriver::ParseSingle(const std::string &query, c
         default_analyzer_name_int != keyword_analyzer_name_int && operator_option_ == FulltextQueryOperatorOption::kInfinitySyntax) {
         // use parser
         std::unique_ptr<QueryNode> result;
+        iss.str(MarkWildcards(query));
         const auto scanner = std::make_unique<SearchScannerInfinitySyntax>(&iss);
         const auto parser = std::make_unique<SearchParser>(*scanner, *this, *default_field_ptr, result);
         if (constexpr int accept = 0; parser->parse() != accept) {
@@ -216,8 +298,12 @@ SearchDriver::AnalyzeAndBuildQueryNode(const std::string &field, const std::stri
         LOG_TRACE(std::format("{} : Empty query text: {}", __func__, text));
         return nullptr;
     }
-    // 1. analyze
     const auto analyzer_name = GetAnalyzerName(field, field2analyzer_);
+    const bool is_keyword_analyzer = AnalyzerPool::AnalyzerNameToInt(analyzer_name.c_str()) == keyword_analyzer_name_int;
+    if (!from_quoted && (text.find(kAnyStringMarker) != std::string::npos || text.find(kAnyCharMarker) != std::string::npos)) {
+        return BuildWildcardQueryNode(field, text, !is_keyword_analyzer);
+    }
+    // 1. analyze
     auto [analyzer, status] = AnalyzerPool::instance().GetAnalyzer(analyzer_name);
     if (!status.ok()) {
         RecoverableError(std::move(status));
@@ -226,7 +312,7 @@ SearchDriver::AnalyzeAndBuildQueryNode(const std::string &field, const std::stri
     if (terms.empty()) {
         return nullptr;
     }
-    if (AnalyzerPool::AnalyzerNameToInt(analyzer_name.c_str()) == keyword_analyzer_name_int) {
+    if (is_keyword_analyzer) {
         auto result = std::make_unique<KeywordQueryNode>();
         for (const auto &term : terms) {
             auto subquery = std::make_unique<TermQueryNode>();
@@ -243,6 +329,13 @@ SearchDriver::AnalyzeAndBuildQueryNode(const std::string &field, const std::stri
         result->term_ = text;
         result->column_ = field;
         return result;
+    } else if (terms.size() == 1 && !from_quoted && slop > 0) {
+        // "term~n": terms within n edits
+        auto result = std::make_unique<FuzzyTermQueryNode>();
+        result->pattern_ = terms.front().text_;
+        result->column_ = field;
+        result->max_edits_ = std::min(slop, kMaxFuzzyEdits);
+        return result;
     } else if (terms.size() == 1) {
         auto result = std::make_unique<TermQueryNode>();
         result->term_ = terms.front().text_;
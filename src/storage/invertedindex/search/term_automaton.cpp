@@ -0,0 +1,280 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module term_automaton;
+
+import stl;
+import status;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+// Bounds the memory of the lazily built DFA, each state takes 1KB of transitions.
+constexpr SizeT kMaxAutomatonStates = 1 << 16;
+
+// Number of continuation bytes following a UTF-8 lead byte, a stray continuation byte counts as a character.
+u32 ContinuationBytes(u8 byte) {
+    if (byte >= 0xF0) {
+        return 3;
+    }
+    if (byte >= 0xE0) {
+        return 2;
+    }
+    if (byte >= 0xC0) {
+        return 1;
+    }
+    return 0;
+}
+
+bool IsContinuationByte(u8 byte) { return (byte & 0xC0) == 0x80; }
+
+} // namespace
+
+TermAutomaton::State TermAutomaton::Start() {
+    if (start_state_ == kUnknownState) {
+        AddState({});
+        start_state_ = AddState(StartConfig());
+    }
+    return start_state_;
+}
+
+TermAutomaton::State TermAutomaton::Accept(State state, u8 byte) {
+    State next = transitions_[state][byte];
+    if (next == kUnknownState) {
+        next = AddState(Step(configs_[state], byte));
+        transitions_[state][byte] = next;
+    }
+    return next;
+}
+
+bool TermAutomaton::Matches(const String &term) {
+    State state = Start();
+    for (char c : term) {
+        state = Accept(state, static_cast<u8>(c));
+        if (!CanMatch(state)) {
+            return false;
+        }
+    }
+    return IsMatch(state);
+}
+
+bool TermAutomaton::MatchesUncached(const String &term) const {
+    Config config = StartConfig();
+    for (char c : term) {
+        if (config.empty()) {
+            return false;
+        }
+        config = Step(config, static_cast<u8>(c));
+    }
+    return !config.empty() && IsMatchConfig(config);
+}
+
+TermAutomaton::State TermAutomaton::AddState(Config config) {
+    if (auto iter = state_ids_.find(config); iter != state_ids_.end()) {
+        return iter->second;
+    }
+    if (configs_.size() >= kMaxAutomatonStates) {
+        RecoverableError(Status::SyntaxError("Term pattern is too complex"));
+    }
+    const State state = configs_.size();
+    const bool is_match = !config.empty() && IsMatchConfig(config);
+    state_ids_.emplace(config, state);
+    configs_.emplace_back(std::move(config));
+    matches_.push_back(is_match);
+    auto &transitions = transitions_.emplace_back();
+    if (state == kDeadState) {
+        transitions.fill(kDeadState);
+    } else {
+        transitions.fill(kUnknownState);
+    }
+    return state;
+}
+
+TermAutomaton::Config PrefixAutomaton::Step(const Config &config, u8 byte) const {
+    const u32 pos = config[0];
+    if (pos == prefix_.size()) {
+        return config;
+    }
+    if (static_cast<u8>(prefix_[pos]) == byte) {
+        return {pos + 1};
+    }
+    return {};
+}
+
+WildcardAutomaton::WildcardAutomaton(const String &pattern) {
+    for (SizeT i = 0; i < pattern.size(); ++i) {
+        const char c = pattern[i];
+        if (c == '\\' && i + 1 < pattern.size()) {
+            elements_.push_back({ElementType::kByte, static_cast<u8>(pattern[++i])});
+        } else if (c == '*') {
+            // consecutive '*' are the same as one
+            if (elements_.empty() || elements_.back().type_ != ElementType::kAnyString) {
+                elements_.push_back({ElementType::kAnyString, 0});
+            }
+        } else if (c == '?') {
+            elements_.push_back({ElementType::kAnyChar, 0});
+        } else {
+            elements_.push_back({ElementType::kByte, static_cast<u8>(c)});
+        }
+    }
+}
+
+String WildcardAutomaton::LiteralPrefix() const {
+    String prefix;
+    for (const auto &element : elements_) {
+        if (element.type_ != ElementType::kByte) {
+            break;
+        }
+        prefix.push_back(static_cast<char>(element.byte_));
+    }
+    return prefix;
+}
+
+void WildcardAutomaton::AddClosure(u32 element_idx, Config &config) const {
+    config.push_back(element_idx << 2);
+    // '*' may match the empty sequence
+    while (element_idx < elements_.size() && elements_[element_idx].type_ == ElementType::kAnyString) {
+        config.push_back((++element_idx) << 2);
+    }
+}
+
+TermAutomaton::Config WildcardAutomaton::StartConfig() const {
+    Config config;
+    AddClosure(0, config);
+    return config;
+}
+
+TermAutomaton::Config WildcardAutomaton::Step(const Config &config, u8 byte) const {
+    Config next;
+    for (u32 position : config) {
+        const u32 element_idx = position >> 2;
+        const u32 pending = position & 3;
+        if (pending > 0) {
+            if (!IsContinuationByte(byte)) {
+                continue;
+            }
+            if (pending == 1) {
+                AddClosure(element_idx + 1, next);
+            } else {
+                next.push_back((element_idx << 2) | (pending - 1));
+            }
+            continue;
+        }
+        if (element_idx == elements_.size()) {
+            continue;
+        }
+        const Element &element = elements_[element_idx];
+        switch (element.type_) {
+            case ElementType::kByte: {
+                if (element.byte_ == byte) {
+                    AddClosure(element_idx + 1, next);
+                }
+                break;
+            }
+            case ElementType::kAnyString: {
+                AddClosure(element_idx, next);
+                break;
+            }
+            case ElementType::kAnyChar: {
+                if (const u32 continuation = ContinuationBytes(byte); continuation == 0) {
+                    AddClosure(element_idx + 1, next);
+                } else {
+                    next.push_back((element_idx << 2) | continuation);
+                }
+                break;
+            }
+        }
+    }
+    std::sort(next.begin(), next.end());
+    next.erase(std::unique(next.begin(), next.end()), next.end());
+    return next;
+}
+
+bool WildcardAutomaton::IsMatchConfig(const Config &config) const {
+    return std::binary_search(config.begin(), config.end(), static_cast<u32>(elements_.size() << 2));
+}
+
+LevenshteinAutomaton::LevenshteinAutomaton(const String &term, u32 max_edits) : max_edits_(max_edits) {
+    for (SizeT i = 0; i < term.size();) {
+        const u8 lead = term[i];
+        const u32 continuation = ContinuationBytes(lead);
+        u32 code_point = continuation == 0 ? lead : (lead & (0x3F >> continuation));
+        SizeT j = i + 1;
+        for (; j < term.size() && j <= i + continuation && IsContinuationByte(term[j]); ++j) {
+            code_point = (code_point << 6) | (term[j] & 0x3F);
+        }
+        code_points_.push_back(code_point);
+        i = j;
+    }
+}
+
+TermAutomaton::Config LevenshteinAutomaton::StartConfig() const {
+    Config config(2 + code_points_.size() + 1);
+    for (u32 i = 0; i <= code_points_.size(); ++i) {
+        config[2 + i] = std::min(i, max_edits_ + 1);
+    }
+    return config;
+}
+
+TermAutomaton::Config LevenshteinAutomaton::Advance(const Config &config, u32 code_point) const {
+    const u32 limit = max_edits_ + 1;
+    Config next(config.size());
+    const u32 *row = config.data() + 2;
+    u32 *next_row = next.data() + 2;
+    next_row[0] = std::min(row[0] + 1, limit);
+    u32 min_distance = next_row[0];
+    for (SizeT i = 1; i <= code_points_.size(); ++i) {
+        const u32 substitution = row[i - 1] + (code_points_[i - 1] == code_point ? 0 : 1);
+        const u32 distance = std::min({substitution, row[i] + 1, next_row[i - 1] + 1, limit});
+        next_row[i] = distance;
+        min_distance = std::min(min_distance, distance);
+    }
+    if (min_distance > max_edits_) {
+        return {};
+    }
+    return next;
+}
+
+TermAutomaton::Config LevenshteinAutomaton::Step(const Config &config, u8 byte) const {
+    const u32 pending = config[0];
+    if (pending == 0) {
+        const u32 continuation = ContinuationBytes(byte);
+        if (continuation == 0) {
+            return Advance(config, byte);
+        }
+        Config next = config;
+        next[0] = continuation;
+        next[1] = byte & (0x3F >> continuation);
+        return next;
+    }
+    if (!IsContinuationByte(byte)) {
+        return {};
+    }
+    const u32 code_point = (config[1] << 6) | (byte & 0x3F);
+    if (pending > 1) {
+        Config next = config;
+        next[0] = pending - 1;
+        next[1] = code_point;
+        return next;
+    }
+    return Advance(config, code_point);
+}
+
+bool LevenshteinAutomaton::IsMatchConfig(const Config &config) const { return config[0] == 0 && config.back() <= max_edits_; }
+
+} // namespace infinity
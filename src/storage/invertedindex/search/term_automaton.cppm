@@ -0,0 +1,143 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module term_automaton;
+
+import stl;
+
+namespace infinity {
+
+// Automaton over the bytes of a term. It is intersected with the term dictionaries to expand
+// prefix, wildcard and fuzzy queries. The DFA is built lazily from the configurations of the
+// underlying NFA, so only the states reached by the dictionary are ever materialized.
+export class TermAutomaton {
+public:
+    using State = u32;
+    static constexpr State kDeadState = 0;
+
+    virtual ~TermAutomaton() = default;
+
+    State Start();
+
+    State Accept(State state, u8 byte);
+
+    [[nodiscard]] bool IsMatch(State state) const { return matches_[state]; }
+
+    [[nodiscard]] bool CanMatch(State state) const { return state != kDeadState; }
+
+    bool Matches(const String &term);
+
+    // Runs the NFA without materializing DFA states, so a shared automaton can be used from several threads.
+    [[nodiscard]] bool MatchesUncached(const String &term) const;
+
+    // Bytes every accepted term starts with
+    [[nodiscard]] virtual String LiteralPrefix() const = 0;
+
+protected:
+    // Sorted NFA positions, empty for the dead configuration
+    using Config = Vector<u32>;
+
+    [[nodiscard]] virtual Config StartConfig() const = 0;
+
+    [[nodiscard]] virtual Config Step(const Config &config, u8 byte) const = 0;
+
+    [[nodiscard]] virtual bool IsMatchConfig(const Config &config) const = 0;
+
+private:
+    State AddState(Config config);
+
+    static constexpr State kUnknownState = std::numeric_limits<State>::max();
+
+    State start_state_{kUnknownState};
+    Map<Config, State> state_ids_{};
+    Vector<Config> configs_{};
+    Vector<bool> matches_{};
+    Vector<Array<State, 256>> transitions_{};
+};
+
+// Terms starting with the prefix
+export class PrefixAutomaton final : public TermAutomaton {
+public:
+    explicit PrefixAutomaton(String prefix) : prefix_(std::move(prefix)) {}
+
+    [[nodiscard]] String LiteralPrefix() const override { return prefix_; }
+
+protected:
+    [[nodiscard]] Config StartConfig() const override { return {0}; }
+
+    [[nodiscard]] Config Step(const Config &config, u8 byte) const override;
+
+    [[nodiscard]] bool IsMatchConfig(const Config &config) const override { return config[0] == prefix_.size(); }
+
+private:
+    String prefix_;
+};
+
+// Lucene wildcard syntax: '*' matches any sequence, '?' a single UTF-8 character and '\' escapes.
+export class WildcardAutomaton final : public TermAutomaton {
+public:
+    explicit WildcardAutomaton(const String &pattern);
+
+    [[nodiscard]] String LiteralPrefix() const override;
+
+protected:
+    [[nodiscard]] Config StartConfig() const override;
+
+    [[nodiscard]] Config Step(const Config &config, u8 byte) const override;
+
+    [[nodiscard]] bool IsMatchConfig(const Config &config) const override;
+
+private:
+    enum class ElementType : u8 {
+        kByte,
+        kAnyChar,
+        kAnyString,
+    };
+
+    struct Element {
+        ElementType type_;
+        u8 byte_;
+    };
+
+    // A position is the element index shifted left by 2, plus the continuation bytes a '?' still has to consume.
+    void AddClosure(u32 element_idx, Config &config) const;
+
+    Vector<Element> elements_{};
+};
+
+// Terms within a Levenshtein distance of the query term, counted in UTF-8 characters.
+export class LevenshteinAutomaton final : public TermAutomaton {
+public:
+    LevenshteinAutomaton(const String &term, u32 max_edits);
+
+    [[nodiscard]] String LiteralPrefix() const override { return {}; }
+
+protected:
+    // Layout: continuation bytes pending, partial code point, then the edit distance row capped at max_edits + 1
+    [[nodiscard]] Config StartConfig() const override;
+
+    [[nodiscard]] Config Step(const Config &config, u8 byte) const override;
+
+    [[nodiscard]] bool IsMatchConfig(const Config &config) const override;
+
+private:
+    [[nodiscard]] Config Advance(const Config &config, u32 code_point) const;
+
+    Vector<u32> code_points_{};
+    u32 max_edits_{};
+};
+
+} // namespace infinity
@@ -22,6 +22,7 @@ import stl;
 import column_length_io;
 import logger;
 import infinity_exception;
+import smallfloat;
 
 namespace infinity {
 
@@ -60,6 +61,11 @@ void TermDocIterator::InitBM25Info(UniquePtr<FullTextColumnLengthReader> &&colum
     f2 = k1 * b / avg_column_len_;
     f3 = f2 * std::numeric_limits<u16>::max();
     f4 = delta / (k1 + 1.0F);
+    if (column_length_reader_->HasQuantizedNorm()) {
+        for (u32 norm = 0; norm < norm_table_.size(); ++norm) {
+            norm_table_[norm] = f1 + f2 * SmallFloat::Byte4ToInt(static_cast<u8>(norm));
+        }
+    }
     if (SHOULD_LOG_TRACE()) {
         OStringStream oss;
         oss << "TermDocIterator: ";
@@ -130,8 +136,13 @@ float TermDocIterator::BM25Score() {
     bm25_score_cache_docid_ = doc_id_;
     // bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len));
     const auto tf = iter_->GetCurrentTF();
-    const auto doc_len = column_length_reader_->GetColumnLength(doc_id_);
-    const float p = f1 + f2 * doc_len;
+    float p = 0.0f;
+    if (column_length_reader_->HasQuantizedNorm()) {
+        p = norm_table_[column_length_reader_->GetColumnNorm(doc_id_)];
+    } else {
+        const auto doc_len = column_length_reader_->GetColumnLength(doc_id_);
+        p = f1 + f2 * doc_len;
+    }
     bm25_score_cache_ = bm25_common_score_ * (tf / (tf + p) + f4);
     term_freq_ += tf;
     return bm25_score_cache_;
@@ -112,6 +112,8 @@ private:
     float f2 = 0.0f;
     float f3 = 0.0f;
     float f4 = 0.0f;
+    // f1 + f2 * column_len for every one byte norm, filled only if column lengths are quantized
+    Array<float, 256> norm_table_{};
     float avg_column_len_ = 0;
     UniquePtr<FullTextColumnLengthReader> column_length_reader_ = nullptr;
     float bm25_common_score_ = 0; // include: weight * smooth_idf * (k1 + 1.0F)
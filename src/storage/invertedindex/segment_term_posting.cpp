@@ -27,9 +27,18 @@ SegmentTermPostingQueue::SegmentTermPostingQueue(const String &index_dir,
                                                  const Vector<String> &base_names,
                                                  const Vector<RowID> &base_rowids,
                                                  optionflag_t flag)
+    : SegmentTermPostingQueue(index_dir, base_names, base_rowids, flag, String(), String()) {}
+
+SegmentTermPostingQueue::SegmentTermPostingQueue(const String &index_dir,
+                                                 const Vector<String> &base_names,
+                                                 const Vector<RowID> &base_rowids,
+                                                 optionflag_t flag,
+                                                 const String &min_term,
+                                                 const String &max_term)
     : index_dir_(index_dir), base_names_(base_names), base_rowids_(base_rowids) {
     for (u32 i = 0; i < base_names.size(); ++i) {
         SegmentTermPosting *segment_term_posting = new SegmentTermPosting(index_dir, base_names[i], base_rowids[i], flag);
+        segment_term_posting->column_index_iterator_->InitRange(min_term, max_term);
         if (segment_term_posting->HasNext()) {
             segment_term_postings_.push(segment_term_posting);
         } else
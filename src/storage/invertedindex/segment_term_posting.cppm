@@ -46,6 +46,14 @@ export class SegmentTermPostingQueue {
 public:
     SegmentTermPostingQueue(const String &index_dir, const Vector<String> &base_names, const Vector<RowID> &base_rowids, optionflag_t flag);
 
+    // Only merges the terms in [min_term, max_term), an empty max_term means no upper bound.
+    SegmentTermPostingQueue(const String &index_dir,
+                            const Vector<String> &base_names,
+                            const Vector<RowID> &base_rowids,
+                            optionflag_t flag,
+                            const String &min_term,
+                            const String &max_term);
+
     ~SegmentTermPostingQueue();
 
     bool Empty() const { return segment_term_postings_.empty(); }
@@ -0,0 +1,341 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <arrow/array/data.h>
+#include <arrow/array/util.h>
+#include <arrow/buffer.h>
+#include <arrow/io/interfaces.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <arrow/util/bit_util.h>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+module arrow_ipc_writer;
+
+import stl;
+import status;
+import third_party;
+import data_table;
+import data_block;
+import table_def;
+import column_def;
+import column_vector;
+import data_type;
+import logical_type;
+import embedding_info;
+import sparse_info;
+import array_info;
+import internal_types;
+import physical_export;
+
+namespace infinity {
+
+namespace {
+
+// The IPC writer appends straight to the response, which is the only copy of the column data.
+class StringOutputStream final : public arrow::io::OutputStream {
+public:
+    explicit StringOutputStream(String &output) : output_(output) {}
+
+    arrow::Status Close() override {
+        closed_ = true;
+        return arrow::Status::OK();
+    }
+
+    arrow::Result<int64_t> Tell() const override { return static_cast<int64_t>(output_.size()); }
+
+    bool closed() const override { return closed_; }
+
+    arrow::Status Write(const void *data, int64_t nbytes) override {
+        output_.append(static_cast<const char *>(data), nbytes);
+        return arrow::Status::OK();
+    }
+
+    using arrow::io::OutputStream::Write;
+
+private:
+    String &output_;
+    bool closed_{false};
+};
+
+bool ArrowSupported(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat16:
+        case LogicalType::kBFloat16:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kVarchar:
+        case LogicalType::kEmbedding:
+        case LogicalType::kMultiVector:
+        case LogicalType::kTensor:
+        case LogicalType::kTensorArray:
+        case LogicalType::kRowID: {
+            return true;
+        }
+        case LogicalType::kSparse: {
+            // the export builders need a value list, which bit sparse vectors don't have
+            const auto *sparse_info = static_cast<const SparseInfo *>(data_type.type_info().get());
+            return sparse_info->DataType() != EmbeddingDataType::kElemBit;
+        }
+        case LogicalType::kArray: {
+            const auto *array_info = static_cast<const ArrayInfo *>(data_type.type_info().get());
+            const DataType &elem_type = array_info->ElemType();
+            return elem_type.type() != LogicalType::kRowID && ArrowSupported(elem_type);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+SharedPtr<arrow::DataType> ResultArrowType(const DataType &data_type) {
+    if (data_type.type() == LogicalType::kRowID) {
+        return arrow::uint64();
+    }
+    return GetArrowType(data_type);
+}
+
+Status ArrowError(const arrow::Status &status) { return Status::IOError(fmt::format("Arrow IPC serialization: {}", status.ToString())); }
+
+// Non owning view of column memory, which outlives the serialization.
+SharedPtr<arrow::Buffer> WrapColumnData(const ColumnVector &column_vector, SizeT byte_size) {
+    return MakeShared<arrow::Buffer>(reinterpret_cast<const u8 *>(column_vector.data()), static_cast<int64_t>(byte_size));
+}
+
+Status BuildValidity(const ColumnVector &column_vector, SizeT row_count, SharedPtr<arrow::Buffer> &validity, i64 &null_count) {
+    validity = nullptr;
+    null_count = 0;
+    if (column_vector.nulls_ptr_->IsAllTrue()) {
+        return Status::OK();
+    }
+    auto bitmap_result = arrow::AllocateEmptyBitmap(row_count);
+    if (!bitmap_result.ok()) {
+        return ArrowError(bitmap_result.status());
+    }
+    validity = std::move(bitmap_result).ValueUnsafe();
+    u8 *bits = validity->mutable_data();
+    SizeT valid_count = 0;
+    column_vector.nulls_ptr_->RoaringBitmapApplyFunc([&](const u32 idx) -> bool {
+        if (idx >= row_count) {
+            return false;
+        }
+        arrow::bit_util::SetBit(bits, idx);
+        ++valid_count;
+        return true;
+    });
+    null_count = row_count - valid_count;
+    return Status::OK();
+}
+
+// Width of the embedding elements which have the same layout in arrow, 0 for the others.
+SizeT ZeroCopyEmbeddingElemSize(EmbeddingDataType elem_type) {
+    switch (elem_type) {
+        case EmbeddingDataType::kElemInt8:
+        case EmbeddingDataType::kElemUInt8:
+            return 1;
+        case EmbeddingDataType::kElemInt16:
+        case EmbeddingDataType::kElemFloat16:
+            return 2;
+        case EmbeddingDataType::kElemInt32:
+        case EmbeddingDataType::kElemFloat:
+            return 4;
+        case EmbeddingDataType::kElemInt64:
+        case EmbeddingDataType::kElemDouble:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+Status BuildVarcharArray(const ColumnVector &column_vector,
+                         SizeT row_count,
+                         const SharedPtr<arrow::DataType> &arrow_type,
+                         SharedPtr<arrow::Buffer> validity,
+                         i64 null_count,
+                         SharedPtr<arrow::Array> &array) {
+    const auto *varchar_ptr = reinterpret_cast<const VarcharT *>(column_vector.data());
+    Vector<Span<const char>> values;
+    values.reserve(row_count);
+    SizeT total_size = 0;
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        values.emplace_back(column_vector.GetVarcharInner(varchar_ptr[row_idx]));
+        total_size += values.back().size();
+    }
+    if (total_size > static_cast<SizeT>(std::numeric_limits<i32>::max())) {
+        return Status::NotSupport(fmt::format("Varchar column of {} bytes in one arrow record batch", total_size));
+    }
+
+    auto offsets_result = arrow::AllocateBuffer((row_count + 1) * sizeof(i32));
+    if (!offsets_result.ok()) {
+        return ArrowError(offsets_result.status());
+    }
+    auto data_result = arrow::AllocateBuffer(total_size);
+    if (!data_result.ok()) {
+        return ArrowError(data_result.status());
+    }
+    SharedPtr<arrow::Buffer> offsets_buffer = std::move(offsets_result).ValueUnsafe();
+    SharedPtr<arrow::Buffer> data_buffer = std::move(data_result).ValueUnsafe();
+    auto *offsets = reinterpret_cast<i32 *>(offsets_buffer->mutable_data());
+    u8 *data = data_buffer->mutable_data();
+    i32 offset = 0;
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        offsets[row_idx] = offset;
+        const Span<const char> &value = values[row_idx];
+        if (!value.empty()) {
+            std::memcpy(data + offset, value.data(), value.size());
+            offset += value.size();
+        }
+    }
+    offsets[row_count] = offset;
+    array = arrow::MakeArray(arrow::ArrayData::Make(arrow_type, row_count, {std::move(validity), offsets_buffer, data_buffer}, null_count));
+    return Status::OK();
+}
+
+// Builds the arrow array of one result column, wrapping the column memory when the layouts match.
+Status BuildColumnArray(const ColumnDef *column_def,
+                        const ColumnVector &column_vector,
+                        SizeT row_count,
+                        const SharedPtr<arrow::DataType> &arrow_type,
+                        Vector<u32> &all_rows,
+                        SharedPtr<arrow::Array> &array) {
+    const DataType &data_type = *column_vector.data_type();
+    if (column_vector.vector_type() != ColumnVectorType::kConstant || row_count <= 1) {
+        SharedPtr<arrow::Buffer> validity;
+        i64 null_count = 0;
+        switch (data_type.type()) {
+            case LogicalType::kBoolean:
+            case LogicalType::kTinyInt:
+            case LogicalType::kSmallInt:
+            case LogicalType::kInteger:
+            case LogicalType::kBigInt:
+            case LogicalType::kFloat16:
+            case LogicalType::kFloat:
+            case LogicalType::kDouble:
+            case LogicalType::kDate:
+            case LogicalType::kTime:
+            case LogicalType::kRowID: {
+                if (Status status = BuildValidity(column_vector, row_count, validity, null_count); !status.ok()) {
+                    return status;
+                }
+                // booleans are compact bits, least significant first as in arrow
+                SizeT byte_size = data_type.type() == LogicalType::kBoolean ? (row_count + 7) / 8 : row_count * data_type.Size();
+                array = arrow::MakeArray(
+                    arrow::ArrayData::Make(arrow_type, row_count, {std::move(validity), WrapColumnData(column_vector, byte_size)}, null_count));
+                return Status::OK();
+            }
+            case LogicalType::kVarchar: {
+                if (Status status = BuildValidity(column_vector, row_count, validity, null_count); !status.ok()) {
+                    return status;
+                }
+                return BuildVarcharArray(column_vector, row_count, arrow_type, std::move(validity), null_count, array);
+            }
+            case LogicalType::kEmbedding: {
+                const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type.type_info().get());
+                const SizeT elem_size = ZeroCopyEmbeddingElemSize(embedding_info->Type());
+                if (elem_size == 0) {
+                    break;
+                }
+                if (Status status = BuildValidity(column_vector, row_count, validity, null_count); !status.ok()) {
+                    return status;
+                }
+                const SizeT elem_count = row_count * embedding_info->Dimension();
+                const auto &elem_arrow_type = arrow_type->field(0)->type();
+                auto elem_data = arrow::ArrayData::Make(elem_arrow_type, elem_count, {nullptr, WrapColumnData(column_vector, elem_count * elem_size)}, 0);
+                array = arrow::MakeArray(arrow::ArrayData::Make(arrow_type, row_count, {std::move(validity)}, {std::move(elem_data)}, null_count));
+                return Status::OK();
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+    // variable length values, converting element types and constant vectors go through the export builders
+    if (all_rows.size() != row_count) {
+        all_rows.resize(row_count);
+        std::iota(all_rows.begin(), all_rows.end(), 0);
+    }
+    array = BuildArrowArray(column_def, column_vector, all_rows);
+    return Status::OK();
+}
+
+} // namespace
+
+Status ArrowIPCWriter::Serialize(DataTable &result_table, String &output) {
+    const SizeT column_count = result_table.ColumnCount();
+    const auto &column_defs = result_table.definition_ptr_->columns();
+
+    arrow::FieldVector fields;
+    fields.reserve(column_count);
+    for (SizeT col_idx = 0; col_idx < column_count; ++col_idx) {
+        const auto &column_def = column_defs[col_idx];
+        const DataType &data_type = *column_def->type();
+        if (!ArrowSupported(data_type)) {
+            return Status::NotSupport(fmt::format("Column {} of type {} has no arrow counterpart", column_def->name(), data_type.ToString()));
+        }
+        fields.emplace_back(arrow::field(column_def->name(), ResultArrowType(data_type)));
+    }
+    SharedPtr<arrow::Schema> schema = arrow::schema(std::move(fields));
+
+    output.clear();
+    StringOutputStream sink(output);
+    auto writer_result = arrow::ipc::MakeStreamWriter(&sink, schema);
+    if (!writer_result.ok()) {
+        return ArrowError(writer_result.status());
+    }
+    SharedPtr<arrow::ipc::RecordBatchWriter> writer = std::move(writer_result).ValueUnsafe();
+
+    Vector<u32> all_rows;
+    const SizeT block_count = result_table.DataBlockCount();
+    for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
+        const SharedPtr<DataBlock> &data_block = result_table.GetDataBlockById(block_idx);
+        const SizeT row_count = data_block->row_count();
+        Vector<SharedPtr<arrow::Array>> arrays(column_count);
+        for (SizeT col_idx = 0; col_idx < column_count; ++col_idx) {
+            Status status = BuildColumnArray(column_defs[col_idx].get(),
+                                             *data_block->column_vectors[col_idx],
+                                             row_count,
+                                             schema->field(col_idx)->type(),
+                                             all_rows,
+                                             arrays[col_idx]);
+            if (!status.ok()) {
+                return status;
+            }
+        }
+        SharedPtr<arrow::RecordBatch> batch = arrow::RecordBatch::Make(schema, row_count, std::move(arrays));
+        if (auto status = writer->WriteRecordBatch(*batch); !status.ok()) {
+            return ArrowError(status);
+        }
+    }
+    if (auto status = writer->Close(); !status.ok()) {
+        return ArrowError(status);
+    }
+    return Status::OK();
+}
+
+} // namespace infinity
@@ -0,0 +1,34 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module arrow_ipc_writer;
+
+import stl;
+import status;
+
+namespace infinity {
+
+class DataTable;
+
+// Serializes query results as an Arrow IPC stream: the schema, then one record batch per data block.
+// Fixed-width and embedding columns are handed to the IPC writer without an intermediate copy.
+export class ArrowIPCWriter {
+public:
+    // Returns NotSupport when a column type has no arrow counterpart, output is unspecified then.
+    static Status Serialize(DataTable &result_table, String &output);
+};
+
+} // namespace infinity
@@ -0,0 +1,402 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+module async_file_io;
+
+import stl;
+import status;
+import third_party;
+import logger;
+import default_values;
+import infinity_exception;
+
+namespace infinity {
+
+String ToString(AsyncIOBackend backend) {
+    switch (backend) {
+        case AsyncIOBackend::kIOUring: {
+            return "io_uring";
+        }
+        case AsyncIOBackend::kThreadPool: {
+            return "thread pool";
+        }
+    }
+    return "invalid";
+}
+
+namespace {
+
+// single transfer of a request, a large request is continued by the next transfer
+constexpr u64 kMaxTransferSize = 1lu << 30;
+
+// Apply the result of one transfer of `request`, returns whether the request needs another transfer.
+bool CompleteTransfer(FileIORequest &request, i64 res, Status &status) {
+    if (res < 0) {
+        if (res == -EINTR || res == -EAGAIN) {
+            return true;
+        }
+        if (res == -EINVAL && !request.write_ && request.done_ % DEFAULT_DIRECT_IO_ALIGNMENT != 0) {
+            // O_DIRECT does not continue at an unaligned end of file
+            return false;
+        }
+        if (status.ok()) {
+            status = Status::IOError(fmt::format("{} fd: {} at {} failed: {}", request.write_ ? "Write" : "Read", request.fd_, request.offset_, strerror(-res)));
+        }
+        return false;
+    }
+    if (res == 0) {
+        if (request.write_ && status.ok()) {
+            status = Status::IOError(fmt::format("Write fd: {} at {} wrote nothing", request.fd_, request.offset_ + request.done_));
+        }
+        // end of file
+        return false;
+    }
+    request.done_ += res;
+    return request.done_ < request.nbytes_;
+}
+
+i64 TransferSync(FileIORequest &request) {
+    u64 len = std::min(request.nbytes_ - request.done_, kMaxTransferSize);
+    i64 res = request.write_ ? pwrite(request.fd_, request.buffer_ + request.done_, len, request.offset_ + request.done_)
+                             : pread(request.fd_, request.buffer_ + request.done_, len, request.offset_ + request.done_);
+    return res < 0 ? -errno : res;
+}
+
+Status SubmitSync(FileIORequest &request) {
+    Status status;
+    while (CompleteTransfer(request, TransferSync(request), status)) {
+    }
+    return status;
+}
+
+class IOThreadPool {
+public:
+    static IOThreadPool &instance() {
+        static IOThreadPool pool;
+        return pool;
+    }
+
+    Status Submit(Vector<FileIORequest> &requests) {
+        std::mutex mutex;
+        std::condition_variable cv;
+        SizeT remaining = requests.size();
+        Status status;
+        for (auto &request : requests) {
+            thread_pool_.push([&](int) {
+                Status request_status = SubmitSync(request);
+                std::unique_lock lock(mutex);
+                if (!request_status.ok() && status.ok()) {
+                    status = std::move(request_status);
+                }
+                if (--remaining == 0) {
+                    cv.notify_one();
+                }
+            });
+        }
+        std::unique_lock lock(mutex);
+        cv.wait(lock, [&] { return remaining == 0; });
+        return status;
+    }
+
+private:
+    ThreadPool thread_pool_{DEFAULT_ASYNC_IO_THREAD_NUM};
+};
+
+#if defined(__linux__)
+
+// A minimal io_uring on the raw system calls, one per thread so that the rings are never shared.
+class IOUring {
+public:
+    ~IOUring() {
+        if (sqes_ != nullptr) {
+            munmap(sqes_, sqes_len_);
+        }
+        if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) {
+            munmap(cq_ptr_, cq_len_);
+        }
+        if (sq_ptr_ != nullptr) {
+            munmap(sq_ptr_, sq_len_);
+        }
+        if (ring_fd_ != -1) {
+            close(ring_fd_);
+        }
+    }
+
+    bool Init(u32 entries) {
+        io_uring_params params{};
+        ring_fd_ = syscall(__NR_io_uring_setup, entries, &params);
+        if (ring_fd_ < 0) {
+            ring_fd_ = -1;
+            return false;
+        }
+        sq_len_ = params.sq_off.array + params.sq_entries * sizeof(u32);
+        cq_len_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_len_ = cq_len_ = std::max(sq_len_, cq_len_);
+        }
+        sq_ptr_ = mmap(nullptr, sq_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ptr_ == MAP_FAILED) {
+            sq_ptr_ = nullptr;
+            return false;
+        }
+        if (single_mmap) {
+            cq_ptr_ = sq_ptr_;
+        } else {
+            cq_ptr_ = mmap(nullptr, cq_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+            if (cq_ptr_ == MAP_FAILED) {
+                cq_ptr_ = nullptr;
+                return false;
+            }
+        }
+        sqes_len_ = params.sq_entries * sizeof(io_uring_sqe);
+        void *sqes = mmap(nullptr, sqes_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return false;
+        }
+        sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+        char *sq = static_cast<char *>(sq_ptr_);
+        sq_head_ = reinterpret_cast<u32 *>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<u32 *>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<u32 *>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<u32 *>(sq + params.sq_off.array);
+        char *cq = static_cast<char *>(cq_ptr_);
+        cq_head_ = reinterpret_cast<u32 *>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<u32 *>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<u32 *>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+        entries_ = params.sq_entries;
+
+        if (!ProbeReadWrite()) {
+            // the ring is set up since Linux 5.1, but IORING_OP_READ/IORING_OP_WRITE are only there since 5.6
+            errno = EOPNOTSUPP;
+            return false;
+        }
+        return true;
+    }
+
+    Status Submit(Vector<FileIORequest> &requests) {
+        Status status;
+        Deque<SizeT> pending;
+        for (SizeT i = 0; i < requests.size(); ++i) {
+            pending.push_back(i);
+        }
+        // the completion queue is twice as large as the submission queue, at most entries_ in flight never overflows it
+        u32 in_flight = 0;
+        while (in_flight > 0 || (!pending.empty() && status.ok())) {
+            u32 sq_tail = *sq_tail_;
+            while (!pending.empty() && status.ok() && in_flight < entries_) {
+                FileIORequest &request = requests[pending.front()];
+                u32 idx = sq_tail & sq_mask_;
+                io_uring_sqe *sqe = &sqes_[idx];
+                std::memset(sqe, 0, sizeof(*sqe));
+                sqe->opcode = request.write_ ? IORING_OP_WRITE : IORING_OP_READ;
+                sqe->fd = request.fd_;
+                sqe->addr = reinterpret_cast<u64>(request.buffer_ + request.done_);
+                sqe->len = std::min(request.nbytes_ - request.done_, kMaxTransferSize);
+                sqe->off = request.offset_ + request.done_;
+                sqe->user_data = pending.front();
+                sq_array_[idx] = idx;
+                ++sq_tail;
+                ++in_flight;
+                pending.pop_front();
+            }
+            __atomic_store_n(sq_tail_, sq_tail, __ATOMIC_RELEASE);
+
+            u32 to_submit = sq_tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            i64 ret = syscall(__NR_io_uring_enter, ring_fd_, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                if (to_submit == 0) {
+                    // the submitted requests still refer to the caller's buffers, returning would let the kernel write to freed memory
+                    String error_message = fmt::format("io_uring_enter failed with {} requests in flight: {}", in_flight, strerror(errno));
+                    UnrecoverableError(error_message);
+                }
+                if (status.ok()) {
+                    status = Status::IOError(fmt::format("io_uring_enter failed: {}", strerror(errno)));
+                }
+                // Take back the entries the kernel did not consume, so that the next batch on this ring doesn't submit them.
+                // The requests submitted before are drained below.
+                u32 sq_head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+                in_flight -= sq_tail - sq_head;
+                __atomic_store_n(sq_tail_, sq_head, __ATOMIC_RELEASE);
+            }
+
+            u32 cq_head = *cq_head_;
+            u32 cq_tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+            for (; cq_head != cq_tail; ++cq_head) {
+                const io_uring_cqe &cqe = cqes_[cq_head & cq_mask_];
+                --in_flight;
+                if (CompleteTransfer(requests[cqe.user_data], cqe.res, status)) {
+                    pending.push_back(cqe.user_data);
+                }
+            }
+            __atomic_store_n(cq_head_, cq_head, __ATOMIC_RELEASE);
+        }
+        return status;
+    }
+
+private:
+    bool ProbeReadWrite() const {
+        constexpr u32 probe_op_count = 256;
+        Vector<u64> buffer((sizeof(io_uring_probe) + probe_op_count * sizeof(io_uring_probe_op) + sizeof(u64) - 1) / sizeof(u64), 0);
+        auto *probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+        // IORING_REGISTER_PROBE came together with the read and write opcodes, an older kernel rejects it
+        if (syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PROBE, probe, probe_op_count) < 0) {
+            return false;
+        }
+        auto supported = [probe](u8 op) { return op < probe->ops_len && (probe->ops[op].flags & IO_URING_OP_SUPPORTED); };
+        return supported(IORING_OP_READ) && supported(IORING_OP_WRITE);
+    }
+
+private:
+    i32 ring_fd_{-1};
+    void *sq_ptr_{};
+    void *cq_ptr_{};
+    SizeT sq_len_{};
+    SizeT cq_len_{};
+    io_uring_sqe *sqes_{};
+    SizeT sqes_len_{};
+    u32 *sq_head_{};
+    u32 *sq_tail_{};
+    u32 sq_mask_{};
+    u32 *sq_array_{};
+    u32 *cq_head_{};
+    u32 *cq_tail_{};
+    u32 cq_mask_{};
+    io_uring_cqe *cqes_{};
+    u32 entries_{};
+};
+
+// io_uring may be missing in the kernel or forbidden by seccomp in containers, then every ring setup fails the same way
+Atomic<bool> io_uring_disabled{false};
+
+IOUring *ThreadIOUring() {
+    static thread_local UniquePtr<IOUring> ring;
+    if (ring.get() == nullptr && !io_uring_disabled) {
+        auto new_ring = MakeUnique<IOUring>();
+        if (new_ring->Init(DEFAULT_ASYNC_IO_QUEUE_DEPTH)) {
+            ring = std::move(new_ring);
+        } else {
+            LOG_WARN(fmt::format("io_uring is unavailable: {}, use the thread pool for async file io", strerror(errno)));
+            io_uring_disabled = true;
+        }
+    }
+    return ring.get();
+}
+
+#endif
+
+} // namespace
+
+Status AsyncFileIO::Submit(Vector<FileIORequest> &requests) {
+    if (requests.empty()) {
+        return Status::OK();
+    }
+    if (requests.size() == 1) {
+        return SubmitSync(requests[0]);
+    }
+#if defined(__linux__)
+    if (IOUring *ring = ThreadIOUring(); ring != nullptr) {
+        return ring->Submit(requests);
+    }
+#endif
+    return IOThreadPool::instance().Submit(requests);
+}
+
+Tuple<SizeT, Status> AsyncFileIO::Read(i32 fd, char *buffer, u64 nbytes, u64 offset) {
+    Vector<FileIORequest> requests;
+    for (u64 pos = 0; pos < nbytes; pos += DEFAULT_ASYNC_IO_CHUNK_SIZE) {
+        requests.push_back({fd, buffer + pos, std::min(nbytes - pos, DEFAULT_ASYNC_IO_CHUNK_SIZE), offset + pos, false});
+    }
+    Status status = Submit(requests);
+    // the bytes up to the first short chunk
+    SizeT read_n = 0;
+    for (const auto &request : requests) {
+        read_n += request.done_;
+        if (request.done_ < request.nbytes_) {
+            break;
+        }
+    }
+    return {read_n, status};
+}
+
+Status AsyncFileIO::Write(i32 fd, const char *buffer, u64 nbytes, u64 offset) {
+    Vector<FileIORequest> requests;
+    for (u64 pos = 0; pos < nbytes; pos += DEFAULT_ASYNC_IO_CHUNK_SIZE) {
+        requests.push_back({fd, const_cast<char *>(buffer) + pos, std::min(nbytes - pos, DEFAULT_ASYNC_IO_CHUNK_SIZE), offset + pos, true});
+    }
+    return Submit(requests);
+}
+
+Status AsyncFileIO::CopyRange(i32 src_fd, u64 src_offset, i32 dst_fd, u64 dst_offset, u64 nbytes) {
+    // aligned so that the source may be opened with O_DIRECT
+    SizeT buffer_size = std::min(DEFAULT_ASYNC_IO_COPY_BUFFER_SIZE, (nbytes + DEFAULT_DIRECT_IO_ALIGNMENT - 1) & ~(DEFAULT_DIRECT_IO_ALIGNMENT - 1));
+    if (buffer_size == 0) {
+        return Status::OK();
+    }
+    UniquePtr<char, decltype(&std::free)> buffer(static_cast<char *>(std::aligned_alloc(DEFAULT_DIRECT_IO_ALIGNMENT, buffer_size)), &std::free);
+    Vector<FileIORequest> requests;
+    for (u64 pos = 0; pos < nbytes; pos += buffer_size) {
+        u64 window = std::min(nbytes - pos, buffer_size);
+        requests.clear();
+        for (u64 chunk_pos = 0; chunk_pos < window; chunk_pos += DEFAULT_ASYNC_IO_CHUNK_SIZE) {
+            u64 chunk_size = std::min(window - chunk_pos, DEFAULT_ASYNC_IO_CHUNK_SIZE);
+            // read whole aligned blocks, the tail past the range is not written
+            u64 aligned_size = std::min((chunk_size + DEFAULT_DIRECT_IO_ALIGNMENT - 1) & ~(DEFAULT_DIRECT_IO_ALIGNMENT - 1), buffer_size - chunk_pos);
+            requests.push_back({src_fd, buffer.get() + chunk_pos, aligned_size, src_offset + pos + chunk_pos, false});
+        }
+        Status status = Submit(requests);
+        if (!status.ok()) {
+            return status;
+        }
+        u64 chunk_pos = 0;
+        for (auto &request : requests) {
+            u64 chunk_size = std::min(window - chunk_pos, DEFAULT_ASYNC_IO_CHUNK_SIZE);
+            if (request.done_ < chunk_size) {
+                return Status::IOError(fmt::format("Copy fd: {} to fd: {}, unexpected end of file at {}", src_fd, dst_fd, request.offset_ + request.done_));
+            }
+            request = {dst_fd, request.buffer_, chunk_size, dst_offset + pos + chunk_pos, true};
+            chunk_pos += chunk_size;
+        }
+        status = Submit(requests);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
+AsyncIOBackend AsyncFileIO::Backend() {
+#if defined(__linux__)
+    if (ThreadIOUring() != nullptr) {
+        return AsyncIOBackend::kIOUring;
+    }
+#endif
+    return AsyncIOBackend::kThreadPool;
+}
+
+} // namespace infinity
@@ -0,0 +1,58 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module async_file_io;
+
+import stl;
+import status;
+
+namespace infinity {
+
+// A positional read or write of one file range.
+export struct FileIORequest {
+    i32 fd_{-1};
+    char *buffer_{};
+    u64 nbytes_{};
+    u64 offset_{};
+    bool write_{false};
+
+    // bytes transferred, less than nbytes_ only when a read reaches the end of file
+    u64 done_{};
+};
+
+export enum class AsyncIOBackend { kIOUring, kThreadPool };
+
+export String ToString(AsyncIOBackend backend);
+
+// Positional batched I/O. The requests of one batch are in flight together, through io_uring where the kernel allows it,
+// otherwise through a pread/pwrite thread pool. The calls block until the whole batch is done and are safe from any thread.
+// Files opened with O_DIRECT need buffers, offsets and sizes aligned to DEFAULT_DIRECT_IO_ALIGNMENT.
+export class AsyncFileIO {
+public:
+    static Status Submit(Vector<FileIORequest> &requests);
+
+    // Read nbytes at offset, split into chunks which are read concurrently. Returns the bytes read.
+    static Tuple<SizeT, Status> Read(i32 fd, char *buffer, u64 nbytes, u64 offset);
+
+    static Status Write(i32 fd, const char *buffer, u64 nbytes, u64 offset);
+
+    // Copy nbytes from src_fd at src_offset to dst_fd at dst_offset, a window of chunks in flight at a time.
+    static Status CopyRange(i32 src_fd, u64 src_offset, i32 dst_fd, u64 dst_offset, u64 nbytes);
+
+    static AsyncIOBackend Backend();
+};
+
+} // namespace infinity
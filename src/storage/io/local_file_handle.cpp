@@ -27,6 +27,7 @@ import status;
 import virtual_store;
 import infinity_exception;
 import logger;
+import async_file_io;
 
 namespace infinity {
 
@@ -115,6 +116,55 @@ Tuple<SizeT, Status> LocalFileHandle::Read(void *buffer, u64 nbytes) {
     return {read_n, Status::OK()};
 }
 
+Tuple<SizeT, Status> LocalFileHandle::PRead(void *buffer, u64 nbytes, u64 offset) {
+    i64 read_n = 0;
+    while (read_n < (i64)nbytes) {
+        SizeT a = nbytes - read_n;
+        i64 read_count = pread(fd_, (char *)buffer + read_n, a, offset + read_n);
+        if (read_count == 0) {
+            break;
+        }
+        if (read_count == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            String error_message = fmt::format("Can't read file: {}: {}", path_, strerror(errno));
+            UnrecoverableError(error_message);
+        }
+        read_n += read_count;
+    }
+    return {read_n, Status::OK()};
+}
+
+Status LocalFileHandle::PWrite(const void *buffer, u64 nbytes, u64 offset) {
+    if (access_mode_ != FileAccessMode::kWrite) {
+        String error_message = fmt::format("File: {} isn't open.", path_);
+        UnrecoverableError(error_message);
+    }
+    return AsyncFileIO::Write(fd_, static_cast<const char *>(buffer), nbytes, offset);
+}
+
+Tuple<SizeT, Status> LocalFileHandle::BatchRead(void *buffer, u64 nbytes) {
+    off_t offset = lseek(fd_, 0, SEEK_CUR);
+    if (offset == (off_t)-1) {
+        String error_message = fmt::format("Can't seek file: {}: {}", path_, strerror(errno));
+        UnrecoverableError(error_message);
+    }
+    auto [read_n, status] = AsyncFileIO::Read(fd_, static_cast<char *>(buffer), nbytes, offset);
+    if (!status.ok()) {
+        return {read_n, status};
+    }
+    Seek(offset + read_n);
+    return {read_n, Status::OK()};
+}
+
+Status LocalFileHandle::Submit(Vector<FileIORequest> &requests) {
+    for (auto &request : requests) {
+        request.fd_ = fd_;
+    }
+    return AsyncFileIO::Submit(requests);
+}
+
 Tuple<SizeT, Status> LocalFileHandle::Read(String &buffer, u64 nbytes) {
     i64 read_n = 0;
     while (read_n < (i64)nbytes) {
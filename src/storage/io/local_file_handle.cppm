@@ -19,6 +19,7 @@ export module local_file_handle;
 import stl;
 import status;
 import global_resource_usage;
+import async_file_io;
 
 namespace infinity {
 
@@ -37,6 +38,13 @@ public:
     Status Append(const String &buffer, u64 nbytes);
     Tuple<SizeT, Status> Read(void *buffer, u64 nbytes);
     Tuple<SizeT, Status> Read(String &buffer, u64 nbytes);
+    // Positional read, does not move the file offset and is safe to call from several threads.
+    Tuple<SizeT, Status> PRead(void *buffer, u64 nbytes, u64 offset);
+    Status PWrite(const void *buffer, u64 nbytes, u64 offset);
+    // Read like `Read`, with the chunks of a large range read concurrently.
+    Tuple<SizeT, Status> BatchRead(void *buffer, u64 nbytes);
+    // Positional requests on this file, all in flight together. The fd of the requests is set to this file.
+    Status Submit(Vector<FileIORequest> &requests);
     Status Seek(u64 nbytes);
     i64 FileSize();
     Tuple<char *, SizeT, Status> MmapRead(const String &name);
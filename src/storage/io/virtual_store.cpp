@@ -38,6 +38,8 @@ import infinity_context;
 import object_storage_task;
 import admin_statement;
 import utility;
+import async_file_io;
+import defer_op;
 
 namespace fs = std::filesystem;
 
@@ -124,15 +126,32 @@ String ToString(StorageType storage_type) {
     }
 }
 
-Tuple<UniquePtr<LocalFileHandle>, Status> VirtualStore::Open(const String &path, FileAccessMode access_mode) {
+namespace {
+
+i32 OpenFd(const String &path, i32 flags, bool direct_io) {
+#if defined(__linux__)
+    if (direct_io) {
+        i32 fd = open(path.c_str(), flags | O_DIRECT, 0666);
+        // tmpfs and some other file systems reject O_DIRECT
+        if (fd != -1 || errno != EINVAL) {
+            return fd;
+        }
+    }
+#endif
+    return open(path.c_str(), flags, 0666);
+}
+
+} // namespace
+
+Tuple<UniquePtr<LocalFileHandle>, Status> VirtualStore::Open(const String &path, FileAccessMode access_mode, bool direct_io) {
     i32 fd = -1;
     switch (access_mode) {
         case FileAccessMode::kRead: {
-            fd = open(path.c_str(), O_RDONLY, 0666);
+            fd = OpenFd(path, O_RDONLY, direct_io);
             break;
         }
         case FileAccessMode::kWrite: {
-            fd = open(path.c_str(), O_RDWR | O_CREAT, 0666);
+            fd = OpenFd(path, O_RDWR | O_CREAT, direct_io);
             break;
         }
         case FileAccessMode::kMmapRead: {
@@ -328,7 +347,7 @@ Status VirtualStore::Truncate(const String &file_name, SizeT new_length) {
     return Status::OK();
 }
 
-Status VirtualStore::Merge(const String &dst_path, const String &src_path) {
+Status VirtualStore::Merge(const String &dst_path, const String &src_path, bool direct_io) {
     if (!std::filesystem::path(dst_path).is_absolute()) {
         String error_message = fmt::format("{} isn't absolute path.", dst_path);
         UnrecoverableError(error_message);
@@ -337,31 +356,30 @@ Status VirtualStore::Merge(const String &dst_path, const String &src_path) {
         String error_message = fmt::format("{} isn't absolute path.", src_path);
         UnrecoverableError(error_message);
     }
-    Path dst{dst_path};
-    Path src{src_path};
-    std::ifstream srcFile(src, std::ios::binary);
-    if (!srcFile.is_open()) {
+    i32 src_fd = OpenFd(src_path, O_RDONLY, direct_io);
+    if (src_fd == -1) {
         String error_message = fmt::format("Failed to open source file {}", src_path);
         UnrecoverableError(error_message);
         return Status::OK();
     }
-    std::ofstream dstFile(dst, std::ios::binary | std::ios::app);
-    if (!dstFile.is_open()) {
+    DeferFn defer_src([&]() { close(src_fd); });
+    i32 dst_fd = open(dst_path.c_str(), O_WRONLY | O_CREAT, 0666);
+    if (dst_fd == -1) {
         String error_message = fmt::format("Failed to open destination file {}", dst_path);
         UnrecoverableError(error_message);
         return Status::OK();
     }
-    char buffer[DEFAULT_READ_BUFFER_SIZE];
-    while (srcFile.read(buffer, DEFAULT_READ_BUFFER_SIZE)) {
-        dstFile.write(buffer, srcFile.gcount());
+    DeferFn defer_dst([&]() { close(dst_fd); });
+
+    struct stat src_stat{};
+    struct stat dst_stat{};
+    if (fstat(src_fd, &src_stat) == -1 || fstat(dst_fd, &dst_stat) == -1) {
+        return Status::IOError(fmt::format("Failed to stat {} or {}: {}", src_path, dst_path, strerror(errno)));
     }
-    dstFile.write(buffer, srcFile.gcount());
-    srcFile.close();
-    dstFile.close();
-    return Status::OK();
+    return AsyncFileIO::CopyRange(src_fd, 0, dst_fd, dst_stat.st_size, src_stat.st_size);
 }
 
-Status VirtualStore::Copy(const String &dst_path, const String &src_path) {
+Status VirtualStore::Copy(const String &dst_path, const String &src_path, bool direct_io) {
     if (!std::filesystem::path(dst_path).is_absolute()) {
         String error_message = fmt::format("{} isn't absolute path.", dst_path);
         UnrecoverableError(error_message);
@@ -376,10 +394,30 @@ Status VirtualStore::Copy(const String &dst_path, const String &src_path) {
         VirtualStore::MakeDirectory(dst_dir);
     }
 
-    try {
-        std::filesystem::copy(src_path, dst_path, fs::copy_options::update_existing);
-    } catch (const std::filesystem::filesystem_error &e) {
-        return Status::IOError(fmt::format("Failed to copy file: {}", e.what()));
+    std::error_code error_code;
+    // same as copy_options::update_existing, an up to date destination is kept
+    if (std::filesystem::exists(dst_path, error_code) &&
+        std::filesystem::last_write_time(dst_path, error_code) >= std::filesystem::last_write_time(src_path, error_code) && !error_code) {
+        return Status::OK();
+    }
+
+    i32 src_fd = OpenFd(src_path, O_RDONLY, direct_io);
+    if (src_fd == -1) {
+        return Status::IOError(fmt::format("Failed to copy file: open {}: {}", src_path, strerror(errno)));
+    }
+    DeferFn defer_src([&]() { close(src_fd); });
+    struct stat src_stat{};
+    if (fstat(src_fd, &src_stat) == -1) {
+        return Status::IOError(fmt::format("Failed to copy file: stat {}: {}", src_path, strerror(errno)));
+    }
+    i32 dst_fd = open(dst_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, src_stat.st_mode & 0777);
+    if (dst_fd == -1) {
+        return Status::IOError(fmt::format("Failed to copy file: open {}: {}", dst_path, strerror(errno)));
+    }
+    DeferFn defer_dst([&]() { close(dst_fd); });
+    Status status = AsyncFileIO::CopyRange(src_fd, 0, dst_fd, 0, src_stat.st_size);
+    if (!status.ok()) {
+        return Status::IOError(fmt::format("Failed to copy file: {}", status.message()));
     }
     return Status::OK();
 }
@@ -52,7 +52,8 @@ export struct MmapInfo {
 
 export class VirtualStore {
 public:
-    static Tuple<UniquePtr<LocalFileHandle>, Status> Open(const String &path, FileAccessMode access_mode);
+    // With direct_io the file is opened with O_DIRECT where the file system supports it.
+    static Tuple<UniquePtr<LocalFileHandle>, Status> Open(const String &path, FileAccessMode access_mode, bool direct_io = false);
     static UniquePtr<StreamReader> OpenStreamReader(const String &path);
     static bool IsRegularFile(const String &path);
     static bool Exists(const String &path);
@@ -64,8 +65,9 @@ public:
     static void RecursiveCleanupAllEmptyDir(const String &path);
     static Status Rename(const String &old_path, const String &new_path);
     static Status Truncate(const String &file_name, SizeT new_length);
-    static Status Merge(const String &dst_file, const String &src_file);
-    static Status Copy(const String &dst_file, const String &src_file);
+    // Merge and Copy keep several chunks of the file in flight, direct_io reads the source bypassing the page cache.
+    static Status Merge(const String &dst_file, const String &src_file, bool direct_io = false);
+    static Status Copy(const String &dst_file, const String &src_file, bool direct_io = false);
     static Tuple<Vector<SharedPtr<DirEntry>>, Status> ListDirectory(const String &path);
     static SizeT GetFileSize(const String &path);
     static String GetParentPath(const String &path);
@@ -0,0 +1,403 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <unistd.h>
+
+module diskann_index_in_chunk;
+
+import stl;
+import internal_types;
+import index_base;
+import index_diskann;
+import column_def;
+import embedding_info;
+import data_type;
+import local_file_handle;
+import virtual_store;
+import infinity_exception;
+import third_party;
+import logger;
+import default_values;
+import random;
+import defer_op;
+import diskann_dist_func;
+import diskann_index_data;
+import pq_flash_index;
+import column_vector;
+import column_meta;
+import block_meta;
+import segment_meta;
+import new_catalog;
+import status;
+
+namespace infinity {
+
+namespace {
+
+// fields of the header sector
+enum DiskAnnChunkHeader : SizeT {
+    kRowCount = 0,
+    kDimension,
+    kBaseOffset,
+    kFlat,
+    kNumPqChunks,
+    kPqTableOffset,
+    kPqDataOffset,
+    kDiskIndexOffset,
+    kImageSize,
+};
+
+void AppendFile(LocalFileHandle &dst_handle, const String &src_path) {
+    auto [src_handle, status] = VirtualStore::Open(src_path, FileAccessMode::kRead);
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
+    }
+    constexpr SizeT buffer_size = 1 << 20;
+    auto buffer = MakeUniqueForOverwrite<char[]>(buffer_size);
+    while (true) {
+        auto [read_n, read_status] = src_handle->Read(buffer.get(), buffer_size);
+        if (!read_status.ok()) {
+            UnrecoverableError(read_status.message());
+        }
+        if (read_n == 0) {
+            break;
+        }
+        dst_handle.Append(buffer.get(), read_n);
+    }
+}
+
+// the duplicated descriptor stays valid when the buffer manager closes its own handle
+UniquePtr<LocalFileHandle> DupFileHandle(const LocalFileHandle &file_handle) {
+    i32 fd = dup(file_handle.FileDescriptor());
+    if (fd == -1) {
+        UnrecoverableError(fmt::format("Failed to dup the file descriptor of {}: {}", file_handle.Path(), strerror(errno)));
+    }
+    return MakeUnique<LocalFileHandle>(fd, file_handle.Path(), FileAccessMode::kRead);
+}
+
+} // namespace
+
+DiskAnnIndexInChunk::DiskAnnIndexInChunk(MetricType metric_type, u32 dimension, SizeT R, SizeT L, SizeT num_pq_chunks)
+    : metric_type_(metric_type), dimension_(dimension), R_(R), L_(L),
+      num_pq_chunks_(std::min<SizeT>({std::max<SizeT>(num_pq_chunks, 1), dimension, DISKANN_MAX_PQ_CHUNKS})) {}
+
+DiskAnnIndexInChunk::~DiskAnnIndexInChunk() {
+    pq_flash_index_.reset();
+    image_file_.reset();
+    if (!build_image_path_.empty()) {
+        VirtualStore::DeleteFile(build_image_path_);
+    }
+}
+
+DiskAnnIndexInChunk *DiskAnnIndexInChunk::GetNewDiskAnnIndexInChunk(const IndexBase *index_base, const ColumnDef *column_def) {
+    const auto *index_diskann = static_cast<const IndexDiskAnn *>(index_base);
+    const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_def->type()->type_info().get());
+    if (column_def->type()->type() != LogicalType::kEmbedding || embedding_info->Type() != EmbeddingDataType::kElemFloat) {
+        UnrecoverableError(fmt::format("Invalid column data type {} for DiskAnn index", column_def->type()->ToString()));
+    }
+    return new DiskAnnIndexInChunk(index_diskann->metric_type_,
+                                   embedding_info->Dimension(),
+                                   index_diskann->R_,
+                                   index_diskann->L_,
+                                   index_diskann->num_pq_chunks_);
+}
+
+void DiskAnnIndexInChunk::Build(SegmentMeta &segment_meta, u32 row_count, const SharedPtr<ColumnDef> &column_def, const String &tmp_dir) {
+    const ColumnID column_id = column_def->id();
+    BlockID last_block_id = std::numeric_limits<BlockID>::max();
+    ColumnVector column_vector;
+    auto read_vectors = [&](f32 *buffer, u32 begin, u32 n) {
+        for (u32 i = 0; i < n; ++i) {
+            SegmentOffset segment_offset = begin + i;
+            BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
+            if (block_id != last_block_id) {
+                last_block_id = block_id;
+                BlockMeta block_meta(block_id, segment_meta);
+                auto [block_row_cnt, status] = block_meta.GetRowCnt1();
+                if (!status.ok()) {
+                    UnrecoverableError("Get row count failed");
+                }
+                ColumnMeta column_meta(column_id, block_meta);
+                status = NewCatalog::GetColumnVector(column_meta, block_row_cnt, ColumnVectorTipe::kReadOnly, column_vector);
+                if (!status.ok()) {
+                    UnrecoverableError("Get column vector failed");
+                }
+            }
+            const auto *src = reinterpret_cast<const f32 *>(column_vector.data()) + SizeT(segment_offset % DEFAULT_BLOCK_CAPACITY) * dimension_;
+            std::copy_n(src, dimension_, buffer + SizeT(i) * dimension_);
+        }
+    };
+    BuildInner(row_count, 0, tmp_dir, read_vectors);
+}
+
+void DiskAnnIndexInChunk::Build(const f32 *data, SegmentOffset base_offset, u32 row_count, const String &tmp_dir) {
+    auto read_vectors = [&](f32 *buffer, u32 begin, u32 n) { std::copy_n(data + SizeT(begin) * dimension_, SizeT(n) * dimension_, buffer); };
+    BuildInner(row_count, base_offset, tmp_dir, read_vectors);
+}
+
+void DiskAnnIndexInChunk::BuildInner(u32 row_count,
+                                     SegmentOffset base_offset,
+                                     const String &tmp_dir,
+                                     const std::function<void(f32 *, u32, u32)> &read_vectors) {
+    if (row_count_ != 0) {
+        UnrecoverableError("DiskAnn index chunk is already built");
+    }
+    if (row_count == 0) [[unlikely]] {
+        UnrecoverableError("Empty input row count");
+    }
+    row_count_ = row_count;
+    base_offset_ = base_offset;
+
+    // PQ training needs more points than centers
+    if (row_count <= DISKANN_NUM_CENTERS) {
+        flat_data_.resize(SizeT(row_count) * dimension_);
+        read_vectors(flat_data_.data(), 0, row_count);
+        if (metric_type_ == MetricType::kMetricCosine) {
+            for (u32 i = 0; i < row_count; ++i) {
+                Normalize(flat_data_.data() + SizeT(i) * dimension_);
+            }
+        }
+        return;
+    }
+
+    String build_dir = fmt::format("{}/diskann_build_{}", tmp_dir, RandomString(16));
+    VirtualStore::MakeDirectory(build_dir);
+    DeferFn remove_build_dir([&] { VirtualStore::RemoveDirectory(build_dir); });
+    String data_path = build_dir + "/data.bin";
+    String mem_index_path = build_dir + "/mem_index.bin";
+    String index_path = build_dir + "/index.bin";
+    String pq_data_path = build_dir + "/pqCompressed_data.bin";
+    String pq_table_path = build_dir + "/pq_pivot.bin";
+
+    {
+        auto [data_handle, status] = VirtualStore::Open(data_path, FileAccessMode::kWrite);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        constexpr u32 batch_size = 8192;
+        Vector<f32> batch(SizeT(batch_size) * dimension_);
+        for (u32 begin = 0; begin < row_count; begin += batch_size) {
+            u32 n = std::min(batch_size, row_count - begin);
+            read_vectors(batch.data(), begin, n);
+            if (metric_type_ == MetricType::kMetricCosine) {
+                for (u32 i = 0; i < n; ++i) {
+                    Normalize(batch.data() + SizeT(i) * dimension_);
+                }
+            }
+            data_handle->Append(batch.data(), SizeT(n) * dimension_ * sizeof(f32));
+        }
+    }
+
+    {
+        Vector<SizeT> labels(row_count);
+        std::iota(labels.begin(), labels.end(), 0);
+        using IndexData = DiskAnnIndexData<f32, SizeT, MetricType::kMetricL2>;
+        auto index_data = IndexData::Make(dimension_, row_count, R_, L_, num_pq_chunks_, DISKANN_NUM_PARTS, DISKANN_NUM_CENTERS);
+        index_data->BuildIndex(dimension_,
+                               row_count,
+                               labels,
+                               Path(data_path),
+                               Path(mem_index_path),
+                               Path(index_path),
+                               Path(pq_data_path),
+                               Path(build_dir),
+                               Path(pq_table_path));
+    }
+
+    // put the parts into one file with the layout of the chunk file
+    build_image_path_ = fmt::format("{}/diskann_{}.idx", tmp_dir, RandomString(16));
+    {
+        auto [image_handle, status] = VirtualStore::Open(build_image_path_, FileAccessMode::kWrite);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        const u64 pq_table_size = VirtualStore::GetFileSize(pq_table_path);
+        const u64 pq_data_size = VirtualStore::GetFileSize(pq_data_path);
+        const u64 disk_index_size = VirtualStore::GetFileSize(index_path);
+
+        Vector<u64> header(DISKANN_SECTOR_LEN / sizeof(u64), 0);
+        header[kRowCount] = row_count;
+        header[kDimension] = dimension_;
+        header[kBaseOffset] = base_offset;
+        header[kFlat] = 0;
+        header[kNumPqChunks] = num_pq_chunks_;
+        header[kPqTableOffset] = DISKANN_SECTOR_LEN;
+        header[kPqDataOffset] = header[kPqTableOffset] + pq_table_size;
+        // node reads are sector aligned
+        header[kDiskIndexOffset] = RoundUp(header[kPqDataOffset] + pq_data_size, DISKANN_SECTOR_LEN);
+        header[kImageSize] = header[kDiskIndexOffset] + disk_index_size;
+
+        image_handle->Append(header.data(), DISKANN_SECTOR_LEN);
+        AppendFile(*image_handle, pq_table_path);
+        AppendFile(*image_handle, pq_data_path);
+        if (SizeT padding_size = header[kDiskIndexOffset] - header[kPqDataOffset] - pq_data_size; padding_size > 0) {
+            Vector<char> padding(padding_size, 0);
+            image_handle->Append(padding.data(), padding_size);
+        }
+        AppendFile(*image_handle, index_path);
+    }
+    auto [image_file, status] = VirtualStore::Open(build_image_path_, FileAccessMode::kRead);
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
+    }
+    LoadDiskIndex(std::move(image_file), 0);
+}
+
+void DiskAnnIndexInChunk::LoadDiskIndex(UniquePtr<LocalFileHandle> image_file, u64 image_offset) {
+    Vector<u64> header(DISKANN_SECTOR_LEN / sizeof(u64));
+    auto [read_n, status] = image_file->PRead(header.data(), DISKANN_SECTOR_LEN, image_offset);
+    if (!status.ok() || read_n != DISKANN_SECTOR_LEN) {
+        UnrecoverableError(fmt::format("Failed to read DiskAnn chunk header from {}", image_file->Path()));
+    }
+    image_offset_ = image_offset;
+    image_size_ = header[kImageSize];
+
+    pq_flash_index_ = PqFlashIndexT::Make(DiskAnnMetricType::L2, dimension_, row_count_, header[kNumPqChunks]);
+    pq_flash_index_->Load(DupFileHandle(*image_file),
+                          image_offset + header[kPqTableOffset],
+                          image_offset + header[kPqDataOffset],
+                          image_offset + header[kDiskIndexOffset],
+                          DISKANN_NUM_SEARCH_SCRATCH);
+    image_file_ = std::move(image_file);
+
+    // keep the graph around the entry point in memory, searches start there
+    if (u64 num_nodes_to_cache = std::min<u64>(DISKANN_NUM_NODES_TO_CACHE, row_count_ / 10); num_nodes_to_cache > 0) {
+        Vector<SizeT> node_list;
+        pq_flash_index_->CacheBfsLevels(num_nodes_to_cache, node_list);
+        pq_flash_index_->LoadCacheList(node_list);
+    }
+}
+
+void DiskAnnIndexInChunk::SaveIndexInner(LocalFileHandle &file_handle) const {
+    if (row_count_ == 0) {
+        UnrecoverableError("Save an empty DiskAnn index chunk");
+    }
+    if (IsFlat()) {
+        Vector<u64> header(DISKANN_SECTOR_LEN / sizeof(u64), 0);
+        header[kRowCount] = row_count_;
+        header[kDimension] = dimension_;
+        header[kBaseOffset] = base_offset_;
+        header[kFlat] = 1;
+        header[kImageSize] = DISKANN_SECTOR_LEN + flat_data_.size() * sizeof(f32);
+        file_handle.Append(header.data(), DISKANN_SECTOR_LEN);
+        file_handle.Append(flat_data_.data(), flat_data_.size() * sizeof(f32));
+        return;
+    }
+    // copy the chunk file the index is loaded from
+    constexpr SizeT buffer_size = 1 << 20;
+    auto buffer = MakeUniqueForOverwrite<char[]>(buffer_size);
+    for (u64 copied = 0; copied < image_size_;) {
+        u64 n = std::min<u64>(buffer_size, image_size_ - copied);
+        auto [read_n, status] = image_file_->PRead(buffer.get(), n, image_offset_ + copied);
+        if (!status.ok() || read_n != n) {
+            UnrecoverableError(fmt::format("Failed to read DiskAnn chunk from {}", image_file_->Path()));
+        }
+        file_handle.Append(buffer.get(), n);
+        copied += n;
+    }
+}
+
+void DiskAnnIndexInChunk::ReadIndexInner(LocalFileHandle &file_handle) {
+    if (row_count_ != 0) {
+        UnrecoverableError("DiskAnn index chunk is already loaded");
+    }
+    const i64 image_offset = lseek(file_handle.FileDescriptor(), 0, SEEK_CUR);
+    if (image_offset < 0) {
+        UnrecoverableError(fmt::format("Failed to get the offset of {}: {}", file_handle.Path(), strerror(errno)));
+    }
+    Vector<u64> header(DISKANN_SECTOR_LEN / sizeof(u64));
+    auto [read_n, status] = file_handle.Read(header.data(), DISKANN_SECTOR_LEN);
+    if (!status.ok() || read_n != DISKANN_SECTOR_LEN) {
+        UnrecoverableError(fmt::format("Failed to read DiskAnn chunk header from {}", file_handle.Path()));
+    }
+    if (header[kDimension] != dimension_) {
+        UnrecoverableError(fmt::format("DiskAnn chunk dimension {} does not match the column dimension {}", header[kDimension], dimension_));
+    }
+    row_count_ = header[kRowCount];
+    base_offset_ = header[kBaseOffset];
+    if (header[kFlat] != 0) {
+        flat_data_.resize(SizeT(row_count_) * dimension_);
+        std::tie(read_n, status) = file_handle.Read(flat_data_.data(), flat_data_.size() * sizeof(f32));
+        if (!status.ok() || read_n != flat_data_.size() * sizeof(f32)) {
+            UnrecoverableError(fmt::format("Failed to read DiskAnn chunk from {}", file_handle.Path()));
+        }
+        return;
+    }
+    LoadDiskIndex(DupFileHandle(file_handle), image_offset);
+}
+
+void DiskAnnIndexInChunk::Search(const f32 *query,
+                                 u32 topk,
+                                 u32 search_l,
+                                 u32 beam_width,
+                                 const std::function<bool(SegmentOffset)> &satisfy_filter_func,
+                                 const std::function<void(f32, SegmentOffset)> &add_result_func) const {
+    const bool cosine = metric_type_ == MetricType::kMetricCosine;
+    Vector<f32> normalized_query;
+    if (cosine) {
+        normalized_query.assign(query, query + dimension_);
+        Normalize(normalized_query.data());
+        query = normalized_query.data();
+    }
+    // squared L2 of unit vectors is 2 - 2 * cos
+    auto add_result = [&](f32 distance, SegmentOffset segment_offset) {
+        add_result_func(cosine ? 1.0f - distance / 2 : distance, segment_offset);
+    };
+
+    if (IsFlat()) {
+        for (u32 i = 0; i < row_count_; ++i) {
+            SegmentOffset segment_offset = base_offset_ + i;
+            if (!satisfy_filter_func(segment_offset)) {
+                continue;
+            }
+            add_result(L2Distance<f32>(query, flat_data_.data() + SizeT(i) * dimension_, dimension_), segment_offset);
+        }
+        return;
+    }
+    u64 l_search = std::max(search_l, topk);
+    u64 beam = std::clamp<u64>(beam_width, 1, pq_flash_index_->MaxBeamWidth());
+    pq_flash_index_->BeamSearch(query, l_search, beam, [&](f32 distance, SizeT node_id) {
+        SegmentOffset segment_offset = base_offset_ + node_id;
+        if (satisfy_filter_func(segment_offset)) {
+            add_result(distance, segment_offset);
+        }
+    });
+}
+
+SizeT DiskAnnIndexInChunk::MemoryUsed() const {
+    if (IsFlat()) {
+        return flat_data_.size() * sizeof(f32);
+    }
+    return pq_flash_index_->MemoryUsed();
+}
+
+void DiskAnnIndexInChunk::Normalize(f32 *vector) const {
+    f32 norm = 0;
+    for (u32 i = 0; i < dimension_; ++i) {
+        norm += vector[i] * vector[i];
+    }
+    if (norm > 0) {
+        norm = std::sqrt(norm);
+        for (u32 i = 0; i < dimension_; ++i) {
+            vector[i] /= norm;
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,98 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module diskann_index_in_chunk;
+
+import stl;
+import internal_types;
+import index_base;
+import local_file_handle;
+import pq_flash_index;
+
+namespace infinity {
+
+class ColumnDef;
+class SegmentMeta;
+
+// DiskAnn index of one index chunk.
+// The chunk file holds a header sector, the PQ table, the PQ codes and the sector aligned disk index built by DiskAnnIndexData.
+// Only the PQ table, the PQ codes and a BFS cache of the entry graph are loaded, the full precision vectors and neighbor lists
+// of the other nodes are fetched from the file with positional reads while searching.
+// Chunks too small to train the PQ table keep their vectors in memory and are searched exhaustively.
+// Cosine is searched as L2 over normalized vectors, Search reports the squared L2 distance or the cosine similarity.
+export class DiskAnnIndexInChunk {
+public:
+    DiskAnnIndexInChunk(MetricType metric_type, u32 dimension, SizeT R, SizeT L, SizeT num_pq_chunks);
+
+    ~DiskAnnIndexInChunk();
+
+    static DiskAnnIndexInChunk *GetNewDiskAnnIndexInChunk(const IndexBase *index_base, const ColumnDef *column_def);
+
+    // build from rows [0, row_count) of the segment
+    void Build(SegmentMeta &segment_meta, u32 row_count, const SharedPtr<ColumnDef> &column_def, const String &tmp_dir);
+
+    // build from row_count contiguous vectors, the first one at segment offset base_offset
+    void Build(const f32 *data, SegmentOffset base_offset, u32 row_count, const String &tmp_dir);
+
+    void SaveIndexInner(LocalFileHandle &file_handle) const;
+
+    // the file handle is positioned at the start of the chunk
+    void ReadIndexInner(LocalFileHandle &file_handle);
+
+    void Search(const f32 *query,
+                u32 topk,
+                u32 search_l,
+                u32 beam_width,
+                const std::function<bool(SegmentOffset)> &satisfy_filter_func,
+                const std::function<void(f32, SegmentOffset)> &add_result_func) const;
+
+    u32 GetRowCount() const { return row_count_; }
+
+    SizeT MemoryUsed() const;
+
+private:
+    using PqFlashIndexT = PqFlashIndex<f32, SizeT>;
+
+    void BuildInner(u32 row_count, SegmentOffset base_offset, const String &tmp_dir, const std::function<void(f32 *, u32, u32)> &read_vectors);
+
+    void LoadDiskIndex(UniquePtr<LocalFileHandle> image_file, u64 image_offset);
+
+    bool IsFlat() const { return pq_flash_index_.get() == nullptr; }
+
+    void Normalize(f32 *vector) const;
+
+private:
+    const MetricType metric_type_;
+    const u32 dimension_;
+    const SizeT R_;
+    const SizeT L_;
+    const SizeT num_pq_chunks_;
+
+    u32 row_count_{};
+    SegmentOffset base_offset_{};
+
+    // flat chunk
+    Vector<f32> flat_data_;
+
+    // disk chunk
+    UniquePtr<PqFlashIndexT> pq_flash_index_;
+    UniquePtr<LocalFileHandle> image_file_; // kept to copy the chunk when it is saved
+    u64 image_offset_{};
+    u64 image_size_{};
+    String build_image_path_; // file built by Build, removed with the chunk
+};
+
+} // namespace infinity
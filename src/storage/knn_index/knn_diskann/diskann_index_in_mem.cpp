@@ -0,0 +1,146 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+
+module diskann_index_in_mem;
+
+import stl;
+import internal_types;
+import index_base;
+import index_diskann;
+import column_def;
+import column_vector;
+import embedding_info;
+import data_type;
+import base_memindex;
+import memindex_tracer;
+import chunk_index_meta;
+import buffer_obj;
+import buffer_handle;
+import infinity_context;
+import infinity_exception;
+import third_party;
+import diskann_dist_func;
+import diskann_index_in_chunk;
+
+namespace infinity {
+
+DiskAnnIndexInMem::DiskAnnIndexInMem(RowID begin_row_id, MetricType metric_type, u32 dimension)
+    : begin_row_id_(begin_row_id), metric_type_(metric_type), dimension_(dimension) {}
+
+DiskAnnIndexInMem::~DiskAnnIndexInMem() {
+    std::unique_lock lock(rw_mutex_);
+    DecreaseMemoryUsageBase(MemoryUsed());
+}
+
+SharedPtr<DiskAnnIndexInMem> DiskAnnIndexInMem::NewDiskAnnIndexInMem(const ColumnDef *column_def, const IndexBase *index_base, RowID begin_row_id) {
+    const auto *index_diskann = static_cast<const IndexDiskAnn *>(index_base);
+    const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_def->type()->type_info().get());
+    if (column_def->type()->type() != LogicalType::kEmbedding || embedding_info->Type() != EmbeddingDataType::kElemFloat) {
+        UnrecoverableError(fmt::format("Invalid column data type {} for DiskAnn index", column_def->type()->ToString()));
+    }
+    return MakeShared<DiskAnnIndexInMem>(begin_row_id, index_diskann->metric_type_, embedding_info->Dimension());
+}
+
+u32 DiskAnnIndexInMem::GetRowCount() const {
+    std::shared_lock lock(rw_mutex_);
+    return row_count_;
+}
+
+void DiskAnnIndexInMem::InsertBlockData(SegmentOffset block_offset, const ColumnVector &col, BlockOffset row_offset, BlockOffset row_cnt) {
+    std::unique_lock lock(rw_mutex_);
+    if (block_offset + row_offset != begin_row_id_.segment_offset_ + row_count_) {
+        UnrecoverableError(fmt::format("DiskAnn mem index expects segment offset {}, got {}",
+                                       begin_row_id_.segment_offset_ + row_count_,
+                                       block_offset + row_offset));
+    }
+    const SizeT mem_before = MemoryUsed();
+    const auto *src = reinterpret_cast<const f32 *>(col.data()) + SizeT(row_offset) * dimension_;
+    vectors_.insert(vectors_.end(), src, src + SizeT(row_cnt) * dimension_);
+    if (metric_type_ == MetricType::kMetricCosine) {
+        for (f32 *v = vectors_.data() + SizeT(row_count_) * dimension_; v != vectors_.data() + vectors_.size(); v += dimension_) {
+            f32 norm = 0;
+            for (u32 i = 0; i < dimension_; ++i) {
+                norm += v[i] * v[i];
+            }
+            if (norm > 0) {
+                norm = std::sqrt(norm);
+                for (u32 i = 0; i < dimension_; ++i) {
+                    v[i] /= norm;
+                }
+            }
+        }
+    }
+    row_count_ += row_cnt;
+    const SizeT mem_after = MemoryUsed();
+    IncreaseMemoryUsageBase(mem_after > mem_before ? mem_after - mem_before : 0);
+}
+
+void DiskAnnIndexInMem::Dump(BufferObj *buffer_obj, SizeT *p_dump_size) {
+    std::unique_lock lock(rw_mutex_);
+    if (p_dump_size != nullptr) {
+        *p_dump_size = MemoryUsed();
+    }
+    BufferHandle handle = buffer_obj->Load();
+    auto *data_ptr = static_cast<DiskAnnIndexInChunk *>(handle.GetDataMut());
+    data_ptr->Build(vectors_.data(), begin_row_id_.segment_offset_, row_count_, InfinityContext::instance().config()->TempDir());
+}
+
+void DiskAnnIndexInMem::Search(const f32 *query,
+                               const std::function<bool(SegmentOffset)> &satisfy_filter_func,
+                               const std::function<void(f32, SegmentOffset)> &add_result_func) const {
+    const bool cosine = metric_type_ == MetricType::kMetricCosine;
+    Vector<f32> normalized_query;
+    if (cosine) {
+        normalized_query.assign(query, query + dimension_);
+        f32 norm = 0;
+        for (f32 x : normalized_query) {
+            norm += x * x;
+        }
+        if (norm > 0) {
+            norm = std::sqrt(norm);
+            for (f32 &x : normalized_query) {
+                x /= norm;
+            }
+        }
+        query = normalized_query.data();
+    }
+    std::shared_lock lock(rw_mutex_);
+    for (u32 i = 0; i < row_count_; ++i) {
+        SegmentOffset segment_offset = begin_row_id_.segment_offset_ + i;
+        if (!satisfy_filter_func(segment_offset)) {
+            continue;
+        }
+        f32 distance = L2Distance<f32>(query, vectors_.data() + SizeT(i) * dimension_, dimension_);
+        // same scale as DiskAnnIndexInChunk::Search
+        add_result_func(cosine ? 1.0f - distance / 2 : distance, segment_offset);
+    }
+}
+
+SizeT DiskAnnIndexInMem::MemoryUsed() const { return vectors_.capacity() * sizeof(f32); }
+
+MemIndexTracerInfo DiskAnnIndexInMem::GetInfo() const {
+    std::shared_lock lock(rw_mutex_);
+    return MemIndexTracerInfo(MakeShared<String>(index_name_), MakeShared<String>(table_name_), MakeShared<String>(db_name_), MemoryUsed(), row_count_);
+}
+
+const ChunkIndexMetaInfo DiskAnnIndexInMem::GetChunkIndexMetaInfo() const {
+    std::shared_lock lock(rw_mutex_);
+    return ChunkIndexMetaInfo{"", begin_row_id_, row_count_, 0};
+}
+
+} // namespace infinity
@@ -0,0 +1,71 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module diskann_index_in_mem;
+
+import stl;
+import internal_types;
+import index_base;
+import base_memindex;
+import memindex_tracer;
+import chunk_index_meta;
+
+namespace infinity {
+
+class ColumnDef;
+class ColumnVector;
+class BufferObj;
+
+// Appended rows of a DiskAnn index.
+// The vectors are kept as they are and searched exhaustively, the graph is built once when the rows are dumped to a chunk.
+export class DiskAnnIndexInMem final : public BaseMemIndex {
+public:
+    DiskAnnIndexInMem(RowID begin_row_id, MetricType metric_type, u32 dimension);
+
+    ~DiskAnnIndexInMem() override;
+
+    static SharedPtr<DiskAnnIndexInMem> NewDiskAnnIndexInMem(const ColumnDef *column_def, const IndexBase *index_base, RowID begin_row_id);
+
+    RowID GetBeginRowID() const { return begin_row_id_; }
+
+    u32 GetRowCount() const;
+
+    void InsertBlockData(SegmentOffset block_offset, const ColumnVector &col, BlockOffset row_offset, BlockOffset row_cnt);
+
+    // build the chunk index in buffer_obj, the caller saves the buffer
+    void Dump(BufferObj *buffer_obj, SizeT *p_dump_size = nullptr);
+
+    void Search(const f32 *query,
+                const std::function<bool(SegmentOffset)> &satisfy_filter_func,
+                const std::function<void(f32, SegmentOffset)> &add_result_func) const;
+
+    SizeT MemoryUsed() const;
+
+    MemIndexTracerInfo GetInfo() const override;
+
+    const ChunkIndexMetaInfo GetChunkIndexMetaInfo() const override;
+
+private:
+    const RowID begin_row_id_;
+    const MetricType metric_type_;
+    const u32 dimension_;
+
+    mutable std::shared_mutex rw_mutex_;
+    u32 row_count_{};
+    Vector<f32> vectors_;
+};
+
+} // namespace infinity
@@ -433,37 +433,43 @@ public:
     FixedChunkPQTable(u64 ndims, u64 n_chunks) : ndims_(ndims), n_chunks_(n_chunks) {}
     ~FixedChunkPQTable() = default;
     void LoadPqCentroidBin(const std::string &pq_table_file, SizeT num_chunks) {
-        // read meta data
-        UniquePtr<SizeT[]> file_offset_data = MakeUnique<SizeT[]>(4); // offset of pq_table_file
         auto [pq_table_handle, status] = VirtualStore::Open(pq_table_file, FileAccessMode::kRead);
         if (!status.ok()) {
             UnrecoverableError(status.message());
         }
+        LoadPqCentroidBin(*pq_table_handle, 0, num_chunks);
+    }
+
+    // base_offset: where the pq table starts in the file, the offsets in its meta data are relative to it
+    void LoadPqCentroidBin(LocalFileHandle &pq_table_handle, u64 base_offset, SizeT num_chunks) {
+        auto read_at = [&](void *buf, u64 size, u64 offset) {
+            auto [read_n, status] = pq_table_handle.PRead(buf, size, base_offset + offset);
+            if (!status.ok() || read_n != size) {
+                UnrecoverableError(fmt::format("Failed to read pq table from {}", pq_table_handle.Path()));
+            }
+        };
+        // read meta data
+        UniquePtr<SizeT[]> file_offset_data = MakeUnique<SizeT[]>(4); // offset of pq_table_file
         LOG_DEBUG(fmt::format("read meta data"));
-        pq_table_handle->Read(file_offset_data.get(), 4 * sizeof(SizeT));
+        read_at(file_offset_data.get(), 4 * sizeof(SizeT), 0);
 
         // read table data
         u64 num_centers = (file_offset_data[1] - file_offset_data[0]) / (ndims_ * sizeof(f32)); // rows of table
         this->num_centers_ = num_centers;
-        pq_table_handle->Seek(file_offset_data[0]);
         this->tables_ = MakeUnique<f32[]>(num_centers * ndims_);
-        pq_table_handle->Read(tables_.get(), num_centers * ndims_ * sizeof(f32));
+        read_at(tables_.get(), num_centers * ndims_ * sizeof(f32), file_offset_data[0]);
         LOG_DEBUG(fmt::format("FixedChunkPQTable read table data, num_centers: {}", num_centers));
 
         // read centroid
-        pq_table_handle->Seek(file_offset_data[1]);
         this->centroid_ = MakeUnique<f32[]>(ndims_);
-        pq_table_handle->Read(centroid_.get(), ndims_ * sizeof(f32));
+        read_at(centroid_.get(), ndims_ * sizeof(f32), file_offset_data[1]);
         LOG_DEBUG(fmt::format("read centroid, centroid_[0]: {}", centroid_[0]));
 
         // read chunk offsets
-        pq_table_handle->Seek(file_offset_data[2]);
         this->chunk_offsets_ = MakeUnique<u32[]>(num_chunks + 1);
-        pq_table_handle->Read(chunk_offsets_.get(), file_offset_data[3] - file_offset_data[2]);
+        read_at(chunk_offsets_.get(), file_offset_data[3] - file_offset_data[2], file_offset_data[2]);
         LOG_DEBUG(fmt::format("read chunk offsets, chunk_offsets_[0]: {}, chunk_offsets_[1]: {}", chunk_offsets_[0], chunk_offsets_[1]));
 
-        pq_table_handle.reset();
-
         // transpose tables
         tables_tr_ = MakeUnique<f32[]>(ndims_ * num_centers);
         for (u64 i = 0; i < num_centers; i++) {
@@ -70,12 +70,13 @@ export class AlignedFileReader {
 
 private:
     u64 file_sz_;
+    u64 base_offset_{};
     UniquePtr<LocalFileHandle> file_desc_;
 
 public:
     AlignedFileReader() : file_sz_(0), file_desc_(nullptr) {}
 
-    AlignedFileReader(This &&other) : file_sz_(other.file_sz_), file_desc_(std::move(other.file_desc_)) {}
+    AlignedFileReader(This &&other) : file_sz_(other.file_sz_), base_offset_(other.base_offset_), file_desc_(std::move(other.file_desc_)) {}
 
     ~AlignedFileReader() = default;
 
@@ -87,18 +88,28 @@ public:
             RecoverableError(status);
         }
 
+        // positional reads, so concurrent searches can share one reader
         for (SizeT reqs = 0; reqs < read_reqs.size(); reqs++) {
-            file_desc_->Seek(read_reqs[reqs].offset);
-            file_desc_->Read(read_reqs[reqs].buf, read_reqs[reqs].len);
+            auto [read_n, status] = file_desc_->PRead(read_reqs[reqs].buf, read_reqs[reqs].len, base_offset_ + read_reqs[reqs].offset);
+            if (!status.ok() || read_n != read_reqs[reqs].len) {
+                UnrecoverableError(fmt::format("AlignedFileReader: short read at offset {}", base_offset_ + read_reqs[reqs].offset));
+            }
         }
     }
 
-    void Open(const std::string &file_path) {
+    // base_offset: where the disk index starts in the file, offsets of read requests are relative to it
+    void Open(const std::string &file_path, u64 base_offset = 0) {
         auto [data_file_handle, status] = VirtualStore::Open(file_path, FileAccessMode::kRead);
         if (!status.ok()) {
             UnrecoverableError(status.message());
         }
         file_desc_ = std::move(data_file_handle);
+        base_offset_ = base_offset;
+    }
+
+    void Open(UniquePtr<LocalFileHandle> file_handle, u64 base_offset) {
+        file_desc_ = std::move(file_handle);
+        base_offset_ = base_offset;
     }
 
     void Close() { file_desc_.reset(); }
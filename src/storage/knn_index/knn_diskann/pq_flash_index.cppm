@@ -84,16 +84,55 @@ public:
         this->disk_index_file_ = disk_index_file;
 
         // 1. load pq compressed vector
-        LoadPqCompressedVec(pq_compressed_vectors);
+        {
+            auto [pq_data_handle, status] = VirtualStore::Open(pq_compressed_vectors, FileAccessMode::kRead);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            LoadPqCompressedVec(*pq_data_handle, 0);
+        }
 
         // 2. load PQ table
         pq_table_->LoadPqCentroidBin(pq_table_bin, n_chunks_);
 
         // 3. load disk index meta data
-        LoadDiskIndexMetaData(disk_index_file);
+        {
+            auto [index_file_handle, status] = VirtualStore::Open(disk_index_file, FileAccessMode::kRead);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            LoadDiskIndexMetaData(*index_file_handle, 0);
+        }
 
         // 4. open reader for the disk index file
         reader_->Open(disk_index_file);
+        return FinishLoad(num_threads);
+    }
+
+    // Load from one file holding the PQ table, the compressed vectors and the disk index at the given offsets.
+    // Only the PQ data is read into memory, the reader keeps the handle for the node reads of the searches.
+    int Load(UniquePtr<LocalFileHandle> file_handle, u64 pq_table_offset, u64 pq_data_offset, u64 disk_index_offset, u32 num_threads = 1) {
+        this->disk_index_file_ = file_handle->Path();
+        LoadPqCompressedVec(*file_handle, pq_data_offset);
+        pq_table_->LoadPqCentroidBin(*file_handle, pq_table_offset, n_chunks_);
+        LoadDiskIndexMetaData(*file_handle, disk_index_offset);
+        reader_->Open(std::move(file_handle), disk_index_offset);
+        return FinishLoad(num_threads);
+    }
+
+    // beam width is bounded by the sector scratch of one query
+    u64 MaxBeamWidth() const {
+        u64 num_sector_per_node = nnodes_per_sector_ > 0 ? 1 : DivRoundUp(max_node_len_, DISKANN_SECTOR_LEN);
+        return std::max<u64>(1, DISKANN_MAX_N_SECTOR_READS / num_sector_per_node);
+    }
+
+    SizeT MemoryUsed() const {
+        SizeT cached_num = nhood_cache_.size();
+        return num_points_ * n_chunks_ + cached_num * ((max_degree_ + 1) * sizeof(SizeT) + aligned_dim_ * sizeof(VectorDataType));
+    }
+
+private:
+    int FinishLoad(u32 num_threads) {
         this->max_nthreads_ = num_threads;
         this->SetupThreadData(num_threads);
 
@@ -106,6 +145,7 @@ public:
         return 0;
     }
 
+public:
     // Second step
     // nodes ids to cache in the bfs level order which starting from the medoids node
     void CacheBfsLevels(u64 num_nodes_to_cache, Vector<SizeT> &node_list, const bool shuffle = false) {
@@ -275,6 +315,55 @@ public:
 
         ScratchStoreManager<SsdQueryScratch<VectorDataType>> manager(this->ssd_query_data_);
         auto query_scratch = manager.ScratchSpace();
+        ExpandBeam(query_scratch, query1, l_search, beam_width, use_filter, io_limit, stats);
+        Vector<Neighbor> &full_retset = query_scratch->full_retset_;
+
+        // copy the top k results to the output buffer
+        std::sort(full_retset.begin(), full_retset.end());
+        for (u64 i = 0; i < k_search; i++) {
+            indices[i] = full_retset[i].id;
+            auto key = indices[i];
+            // filter
+            if (dummy_pts_.find(key) != dummy_pts_.end()) {
+                indices[i] = this->dummy_to_real_map_[key];
+            }
+
+            if (distances != nullptr) {
+                distances[i] = full_retset[i].distance;
+                if (metric_ == DiskAnnMetricType::IP) {
+                    // flip the sign to convert min to max
+                    distances[i] = (-distances[i]);
+                }
+            }
+        }
+
+        // delete[] data;
+    }
+
+    // Pass every node expanded by the beam search with its full precision distance to add_result.
+    // The caller filters and keeps the top k, so the result is not cut to k here.
+    void BeamSearch(const VectorDataType *query, const u64 l_search, const u64 beam_width, const std::function<void(f32, SizeT)> &add_result) {
+        if (!this->load_flag_) {
+            Status status = Status::NotSupport("DiskAnn(): index not loaded");
+            RecoverableError(status);
+        }
+
+        ScratchStoreManager<SsdQueryScratch<VectorDataType>> manager(this->ssd_query_data_);
+        auto query_scratch = manager.ScratchSpace();
+        ExpandBeam(query_scratch, query, l_search, beam_width, false, std::numeric_limits<u32>::max(), nullptr);
+        for (const Neighbor &nbr : query_scratch->full_retset_) {
+            add_result(nbr.distance, nbr.id);
+        }
+    }
+
+private:
+    void ExpandBeam(SsdQueryScratch<VectorDataType> *query_scratch,
+                    const VectorDataType *query1,
+                    const u64 l_search,
+                    const u64 beam_width,
+                    const bool use_filter,
+                    const u32 io_limit,
+                    QueryStats *stats) {
         auto pq_query_scratch = query_scratch->PqScratch();
 
         query_scratch->Reset();
@@ -507,39 +596,17 @@ public:
         } // beam search end
 
         LOG_DEBUG(fmt::format("Beam search hops {}: {} nodes expanded, {} cmps,  {} ios", hops, full_retset.size(), cmps, num_ios));
-        // copy the top k results to the output buffer
-        std::sort(full_retset.begin(), full_retset.end());
-        for (u64 i = 0; i < k_search; i++) {
-            indices[i] = full_retset[i].id;
-            auto key = indices[i];
-            // filter
-            if (dummy_pts_.find(key) != dummy_pts_.end()) {
-                indices[i] = this->dummy_to_real_map_[key];
-            }
-
-            if (distances != nullptr) {
-                distances[i] = full_retset[i].distance;
-                if (metric_ == DiskAnnMetricType::IP) {
-                    // flip the sign to convert min to max
-                    distances[i] = (-distances[i]);
-                }
-            }
-        }
-
-        // delete[] data;
     }
 
-private:
     // read pq compressed vectors from disk to this->data_
-    void LoadPqCompressedVec(std::string pq_compressed_vectors_path) {
+    void LoadPqCompressedVec(LocalFileHandle &pq_data_handle, u64 offset) {
         this->data_ = MakeUnique<u8[]>(this->num_points_ * this->n_chunks_);
-        auto read_buf = MakeUnique<u32[]>(this->num_points_ * this->n_chunks_ * sizeof(u32));
-        auto [pq_data_handle, status] = VirtualStore::Open(pq_compressed_vectors_path, FileAccessMode::kRead);
-        if (!status.ok()) {
-            UnrecoverableError(status.message());
+        auto read_buf = MakeUnique<u32[]>(this->num_points_ * this->n_chunks_);
+        u64 read_size = this->num_points_ * this->n_chunks_ * sizeof(u32);
+        auto [read_n, status] = pq_data_handle.PRead(read_buf.get(), read_size, offset);
+        if (!status.ok() || read_n != read_size) {
+            UnrecoverableError(fmt::format("DiskAnn(): failed to read pq compressed vectors from {}", pq_data_handle.Path()));
         }
-
-        pq_data_handle->Read(read_buf.get(), this->num_points_ * this->n_chunks_ * sizeof(u32));
         for (u64 i = 0; i < this->num_points_ * this->n_chunks_; i++) {
             this->data_[i] = static_cast<u8>(read_buf[i]);
         }
@@ -640,41 +707,39 @@ private:
     // locate the offset of the neighbor data from the start sector buffer(i.e. skip the vector data)
     inline u32 *OffsetToNodeNhood(char *node_buf) { return (u32 *)(node_buf + disk_bytes_per_point_); }
 
-    void LoadDiskIndexMetaData(const std::string &disk_index_file) {
-        auto [index_file_handle, status] = VirtualStore::Open(disk_index_file, FileAccessMode::kRead);
-        if (!status.ok()) {
-            UnrecoverableError(status.message());
+    void LoadDiskIndexMetaData(LocalFileHandle &index_file_handle, u64 offset) {
+        // meta data is the u64 array in the first sector of the disk index
+        Vector<u64> meta(10);
+        auto [read_n, status] = index_file_handle.PRead(meta.data(), meta.size() * sizeof(u64), offset);
+        if (!status.ok() || read_n != meta.size() * sizeof(u64)) {
+            UnrecoverableError(fmt::format("DiskAnn(): failed to read disk index meta data from {}", index_file_handle.Path()));
         }
 
-        u64 disk_nnodes, disk_ndims;
-        index_file_handle->Read(&disk_nnodes, sizeof(u64));
-        index_file_handle->Read(&disk_ndims, sizeof(u64));
+        u64 disk_nnodes = meta[0], disk_ndims = meta[1];
         disk_bytes_per_point_ = disk_ndims * sizeof(VectorDataType);
         if (disk_nnodes != num_points_ || disk_ndims != data_dim_) {
             UnrecoverableError("Index file does not match the PQ flash index");
         }
 
-        u64 medoid_id_on_file; // medoid node id
-        index_file_handle->Read(&medoid_id_on_file, sizeof(u64));
+        u64 medoid_id_on_file = meta[2]; // medoid node id
         this->num_medoids_ = 1;
         this->medoids_ = MakeUnique<SizeT[]>(1);
         this->medoids_[0] = medoid_id_on_file;
         LOG_DEBUG(fmt::format("LoadDiskIndexMetaData(): Loaded medoid node id: {}", medoid_id_on_file));
 
-        index_file_handle->Read(&max_node_len_, sizeof(u64));
-        index_file_handle->Read(&nnodes_per_sector_, sizeof(u64));
-        index_file_handle->Read(&sector_num_, sizeof(u64));
+        max_node_len_ = meta[3];
+        nnodes_per_sector_ = meta[4];
+        sector_num_ = meta[5];
         max_degree_ = (max_node_len_ - disk_bytes_per_point_) / sizeof(u64) - 1; // -1 for the neighbor count
 
-        index_file_handle->Read(&num_frozen_points_, sizeof(u64));
-        u64 file_frozen_id;
-        index_file_handle->Read(&file_frozen_id, sizeof(u64));
+        num_frozen_points_ = meta[6];
+        u64 file_frozen_id = meta[7];
         if (num_frozen_points_ == 1) {
             frozen_location_ = file_frozen_id;
         }
-        index_file_handle->Read(&reorder_data_exists_, sizeof(u64));
+        reorder_data_exists_ = meta[8];
 
-        index_file_handle->Read(&disk_index_size_, sizeof(u64));
+        disk_index_size_ = meta[9];
     }
 
     void SetupThreadData(u64 nthreads, u64 visited_reserve = 4096, bool async = false) {
@@ -96,7 +96,12 @@ template <typename DataType, bool OwnMem>
 AbstractHnsw InitAbstractIndexT(const IndexHnsw *index_hnsw) {
     switch (index_hnsw->encode_type_) {
         case HnswEncodeType::kPlain: {
-            if (index_hnsw->build_type_ == HnswBuildType::kLSG) {
+            if constexpr (IsHalfDataType<DataType>) {
+                // half precision vectors are only built plainly
+                if (index_hnsw->build_type_ != HnswBuildType::kPlain) {
+                    return nullptr;
+                }
+            } else if (index_hnsw->build_type_ == HnswBuildType::kLSG) {
                 switch (index_hnsw->metric_type_) {
                     case MetricType::kMetricL2: {
                         using HnswIndex = KnnHnsw<PlainL2VecStoreType<DataType, true>, SegmentOffset, OwnMem>;
@@ -136,7 +141,7 @@ AbstractHnsw InitAbstractIndexT(const IndexHnsw *index_hnsw) {
             }
         }
         case HnswEncodeType::kLVQ: {
-            if constexpr (std::is_same_v<DataType, u8> || std::is_same_v<DataType, i8>) {
+            if constexpr (std::is_same_v<DataType, u8> || std::is_same_v<DataType, i8> || IsHalfDataType<DataType>) {
                 return nullptr;
             } else if (index_hnsw->build_type_ == HnswBuildType::kPlain) {
                 switch (index_hnsw->metric_type_) {
@@ -179,6 +184,12 @@ AbstractHnsw InitAbstractIndexT(const IndexBase *index_base, const ColumnDef *co
         case EmbeddingDataType::kElemInt8: {
             return InitAbstractIndexT<i8, OwnMem>(index_hnsw);
         }
+        case EmbeddingDataType::kElemFloat16: {
+            return InitAbstractIndexT<Float16T, OwnMem>(index_hnsw);
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            return InitAbstractIndexT<BFloat16T, OwnMem>(index_hnsw);
+        }
         default: {
             return nullptr;
         }
@@ -92,6 +92,20 @@ export using AbstractHnsw = std::variant<KnnHnsw<PlainCosVecStoreType<float>, Se
                                          KnnHnsw<PlainCosVecStoreType<i8, true>, SegmentOffset, false> *,
                                          KnnHnsw<PlainIPVecStoreType<i8, true>, SegmentOffset, false> *,
                                          KnnHnsw<PlainL2VecStoreType<i8, true>, SegmentOffset, false> *,
+
+                                         KnnHnsw<PlainCosVecStoreType<Float16T>, SegmentOffset> *,
+                                         KnnHnsw<PlainIPVecStoreType<Float16T>, SegmentOffset> *,
+                                         KnnHnsw<PlainL2VecStoreType<Float16T>, SegmentOffset> *,
+                                         KnnHnsw<PlainCosVecStoreType<BFloat16T>, SegmentOffset> *,
+                                         KnnHnsw<PlainIPVecStoreType<BFloat16T>, SegmentOffset> *,
+                                         KnnHnsw<PlainL2VecStoreType<BFloat16T>, SegmentOffset> *,
+
+                                         KnnHnsw<PlainCosVecStoreType<Float16T>, SegmentOffset, false> *,
+                                         KnnHnsw<PlainIPVecStoreType<Float16T>, SegmentOffset, false> *,
+                                         KnnHnsw<PlainL2VecStoreType<Float16T>, SegmentOffset, false> *,
+                                         KnnHnsw<PlainCosVecStoreType<BFloat16T>, SegmentOffset, false> *,
+                                         KnnHnsw<PlainIPVecStoreType<BFloat16T>, SegmentOffset, false> *,
+                                         KnnHnsw<PlainL2VecStoreType<BFloat16T>, SegmentOffset, false> *,
                                          std::nullptr_t>;
 export struct HnswIndexInMem : public BaseMemIndex {
 public:
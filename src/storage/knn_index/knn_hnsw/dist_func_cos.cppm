@@ -23,6 +23,7 @@ import hnsw_common;
 import plain_vec_store;
 import lvq_vec_store;
 import simd_functions;
+import internal_types;
 
 export module dist_func_cos;
 
@@ -40,7 +41,7 @@ public:
     using LVQDist = LVQCosDist<DataType, i8>;
 
 private:
-    using SIMDFuncType = f32 (*)(const DataType *, const DataType *, SizeT);
+    using SIMDFuncType = f32 (*)(const SIMDDataType<DataType> *, const SIMDDataType<DataType> *, SizeT);
 
     SIMDFuncType SIMDFunc = nullptr;
 
@@ -66,6 +67,10 @@ public:
             SIMDFunc = GetSIMD_FUNCTIONS().HNSW_U8Cos_ptr_;
         } else if constexpr (std::is_same<DataType, i8>()) {
             SIMDFunc = GetSIMD_FUNCTIONS().HNSW_I8Cos_ptr_;
+        } else if constexpr (std::is_same<DataType, Float16T>()) {
+            SIMDFunc = GetSIMD_FUNCTIONS().HNSW_F16Cos_ptr_;
+        } else if constexpr (std::is_same<DataType, BFloat16T>()) {
+            SIMDFunc = GetSIMD_FUNCTIONS().HNSW_BF16Cos_ptr_;
         }
     }
 
@@ -82,7 +87,9 @@ public:
     LVQDist ToLVQDistance(SizeT dim) &&;
 
 private:
-    DistanceType Inner(const StoreType &v1, const StoreType &v2, SizeT dim) const { return -SIMDFunc(v1, v2, dim); }
+    DistanceType Inner(const StoreType &v1, const StoreType &v2, SizeT dim) const {
+        return -SIMDFunc(reinterpret_cast<const SIMDDataType<DataType> *>(v1), reinterpret_cast<const SIMDDataType<DataType> *>(v2), dim);
+    }
 };
 
 export template <typename DataType, typename CompressType>
@@ -21,6 +21,7 @@ import hnsw_common;
 import plain_vec_store;
 import lvq_vec_store;
 import simd_functions;
+import internal_types;
 
 export module dist_func_ip;
 
@@ -38,7 +39,8 @@ public:
     using LVQDist = LVQIPDist<DataType, i8>;
 
 private:
-    using SIMDFuncType = std::conditional_t<std::is_same_v<DataType, float>, f32, i32> (*)(const DataType *, const DataType *, SizeT);
+    using SIMDResultType = std::conditional_t<std::is_same_v<DataType, float> || IsHalfDataType<DataType>, f32, i32>;
+    using SIMDFuncType = SIMDResultType (*)(const SIMDDataType<DataType> *, const SIMDDataType<DataType> *, SizeT);
 
     SIMDFuncType SIMDFunc = nullptr;
 
@@ -79,6 +81,10 @@ public:
             } else {
                 SIMDFunc = GetSIMD_FUNCTIONS().HNSW_U8IP_ptr_;
             }
+        } else if constexpr (std::is_same<DataType, Float16T>()) {
+            SIMDFunc = GetSIMD_FUNCTIONS().HNSW_F16IP_ptr_;
+        } else if constexpr (std::is_same<DataType, BFloat16T>()) {
+            SIMDFunc = GetSIMD_FUNCTIONS().HNSW_BF16IP_ptr_;
         }
     }
 
@@ -95,7 +101,9 @@ public:
     LVQDist ToLVQDistance(SizeT dim) &&;
 
 private:
-    DistanceType Inner(const StoreType &v1, const StoreType &v2, SizeT dim) const { return -SIMDFunc(v1, v2, dim); }
+    DistanceType Inner(const StoreType &v1, const StoreType &v2, SizeT dim) const {
+        return -SIMDFunc(reinterpret_cast<const SIMDDataType<DataType> *>(v1), reinterpret_cast<const SIMDDataType<DataType> *>(v2), dim);
+    }
 };
 
 export template <typename DataType, typename CompressType>
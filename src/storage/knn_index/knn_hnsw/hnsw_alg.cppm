@@ -30,6 +30,7 @@ import data_store;
 import third_party;
 import serialize;
 import dist_func_lsg_wrapper;
+import hnsw_visited_table;
 
 // Fixme: some variable has implicit type conversion.
 // Fixme: some variable has confusing name.
@@ -162,8 +163,8 @@ protected:
         }
 
         SizeT cur_vec_num = data_store_.cur_vec_num();
-        Vector<bool> visited(cur_vec_num, false);
-        visited[enter_point] = true;
+        auto visited = VisitedTablePool::Acquire(cur_vec_num);
+        visited->SetVisited(enter_point);
 
         while (!candidate.empty()) {
             const auto [minus_c_dist, c_idx] = candidate.top();
@@ -181,10 +182,9 @@ protected:
             int prefetch_start = neighbor_size - 1 - prefetch_offset_;
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                if (n_idx >= (VertexType)cur_vec_num || visited[n_idx]) {
+                if (n_idx >= (VertexType)cur_vec_num || !visited->TryVisit(n_idx)) {
                     continue;
                 }
-                visited[n_idx] = true;
                 if (prefetch_start >= 0) {
                     int lower = std::max(0, prefetch_start - prefetch_step_);
                     for (int j = prefetch_start; j >= lower; --j) {
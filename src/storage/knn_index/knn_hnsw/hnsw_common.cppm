@@ -22,6 +22,7 @@ export module hnsw_common;
 import stl;
 import infinity_exception;
 import sparse_util;
+import internal_types;
 
 namespace infinity {
 
@@ -38,6 +39,13 @@ export using LayerSize = i32;
 
 export constexpr VertexType kInvalidVertex = -1;
 
+// float16 and bfloat16 vectors keep their 2-byte elements in the graph, the simd kernels take them as raw u16 bits.
+export template <typename DataType>
+constexpr bool IsHalfDataType = std::is_same_v<DataType, Float16T> || std::is_same_v<DataType, BFloat16T>;
+
+export template <typename DataType>
+using SIMDDataType = std::conditional_t<IsHalfDataType<DataType>, u16, DataType>;
+
 export template <typename Iterator, typename RtnType, typename LabelType>
 concept DataIteratorConcept = requires(Iterator iter) {
     typename std::decay_t<Iterator>::ValueType;
@@ -18,6 +18,8 @@ import third_party;
 import column_vector;
 import local_file_handle;
 import chunk_index_meta;
+import hnsw_visited_table;
+import logger;
 
 namespace infinity {
 
@@ -25,7 +27,12 @@ template <typename DataType, bool OwnMem>
 AbstractHnsw InitAbstractIndexT(const IndexHnsw *index_hnsw) {
     switch (index_hnsw->encode_type_) {
         case HnswEncodeType::kPlain: {
-            if (index_hnsw->build_type_ == HnswBuildType::kLSG) {
+            if constexpr (IsHalfDataType<DataType>) {
+                // half precision vectors are only built plainly
+                if (index_hnsw->build_type_ != HnswBuildType::kPlain) {
+                    return nullptr;
+                }
+            } else if (index_hnsw->build_type_ == HnswBuildType::kLSG) {
                 switch (index_hnsw->metric_type_) {
                     case MetricType::kMetricL2: {
                         using HnswIndex = KnnHnsw<PlainL2VecStoreType<DataType, true>, SegmentOffset, OwnMem>;
@@ -65,7 +72,7 @@ AbstractHnsw InitAbstractIndexT(const IndexHnsw *index_hnsw) {
             }
         }
         case HnswEncodeType::kLVQ: {
-            if constexpr (std::is_same_v<DataType, u8> || std::is_same_v<DataType, i8>) {
+            if constexpr (std::is_same_v<DataType, u8> || std::is_same_v<DataType, i8> || IsHalfDataType<DataType>) {
                 return nullptr;
             } else if (index_hnsw->build_type_ == HnswBuildType::kPlain) {
                 switch (index_hnsw->metric_type_) {
@@ -108,6 +115,12 @@ AbstractHnsw InitAbstractIndexT(const IndexBase *index_base, const ColumnDef *co
         case EmbeddingDataType::kElemInt8: {
             return InitAbstractIndexT<i8, OwnMem>(index_hnsw);
         }
+        case EmbeddingDataType::kElemFloat16: {
+            return InitAbstractIndexT<Float16T, OwnMem>(index_hnsw);
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            return InitAbstractIndexT<BFloat16T, OwnMem>(index_hnsw);
+        }
         default: {
             return nullptr;
         }
@@ -402,7 +415,7 @@ void HnswHandler::CompressToLVQ() {
                 using IndexT = typename std::remove_pointer_t<T>;
                 if constexpr (IndexT::kOwnMem) {
                     using HnswIndexDataType = typename std::remove_pointer_t<T>::DataType;
-                    if constexpr (IsAnyOf<HnswIndexDataType, i8, u8>) {
+                    if constexpr (IsAnyOf<HnswIndexDataType, i8, u8, Float16T, BFloat16T>) {
                         UnrecoverableError("Invalid index type.");
                     } else {
                         auto *p = std::move(*index).CompressToLVQ().release();
@@ -469,6 +482,7 @@ void HnswIndexInMem::InsertVecs(SegmentOffset block_offset,
 
 void HnswIndexInMem::Dump(BufferObj *buffer_obj, SizeT *dump_size_ptr) {
     trace_ = false;
+    LOG_TRACE(VisitedTablePool::GetStatistics().ToString());
     if (dump_size_ptr != nullptr) {
         SizeT dump_size = hnsw_handler_->MemUsage();
         *dump_size_ptr = dump_size;
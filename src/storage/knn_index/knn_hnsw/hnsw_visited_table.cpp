@@ -0,0 +1,111 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+module hnsw_visited_table;
+
+import stl;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+Atomic<u64> acquire_count{0};
+Atomic<u64> hit_count{0};
+Atomic<u64> grow_count{0};
+Atomic<u64> clear_count{0};
+Atomic<u64> memory_bytes{0};
+
+thread_local Vector<UniquePtr<VisitedTable>> thread_local_tables;
+
+} // namespace
+
+String VisitedTableStatistics::ToString() const {
+    double hit_rate = acquire_count_ == 0 ? 0.0 : static_cast<double>(hit_count_) / acquire_count_;
+    return fmt::format("Visited table pool: acquire: {}, hit: {}, hit rate: {:.4f}, grow: {}, clear: {}, memory: {} bytes",
+                       acquire_count_,
+                       hit_count_,
+                       hit_rate,
+                       grow_count_,
+                       clear_count_,
+                       memory_bytes_);
+}
+
+VisitedTable::~VisitedTable() { memory_bytes.fetch_sub(MemorySize(), std::memory_order_relaxed); }
+
+bool VisitedTable::Reset(SizeT vertex_num) {
+    if (vertex_num > capacity_) {
+        // Grow geometrically, the vertex number keeps increasing during index build.
+        SizeT new_capacity = std::max(vertex_num, capacity_ + capacity_ / 2);
+        memory_bytes.fetch_add((new_capacity - capacity_) * sizeof(TagType), std::memory_order_relaxed);
+        tags_ = MakeUnique<TagType[]>(new_capacity);
+        capacity_ = new_capacity;
+        epoch_ = 1;
+        grow_count.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    if (epoch_ == std::numeric_limits<TagType>::max()) {
+        std::memset(tags_.get(), 0, MemorySize());
+        epoch_ = 1;
+        clear_count.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    ++epoch_;
+    return false;
+}
+
+VisitedTablePool::Handle::~Handle() {
+    if (table_.get() == nullptr) {
+        return;
+    }
+    if (thread_local_tables.size() < kMaxPooledTablesPerThread) {
+        thread_local_tables.push_back(std::move(table_));
+    }
+}
+
+VisitedTablePool::Handle VisitedTablePool::Acquire(SizeT vertex_num) {
+    acquire_count.fetch_add(1, std::memory_order_relaxed);
+    UniquePtr<VisitedTable> table;
+    if (thread_local_tables.empty()) {
+        table = MakeUnique<VisitedTable>();
+    } else {
+        table = std::move(thread_local_tables.back());
+        thread_local_tables.pop_back();
+    }
+    bool pooled = table->Capacity() > 0;
+    bool grown = table->Capacity() < vertex_num;
+    table->Reset(vertex_num);
+    if (pooled && !grown) {
+        hit_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    return Handle(std::move(table));
+}
+
+VisitedTableStatistics VisitedTablePool::GetStatistics() {
+    VisitedTableStatistics statistics;
+    statistics.acquire_count_ = acquire_count.load(std::memory_order_relaxed);
+    statistics.hit_count_ = hit_count.load(std::memory_order_relaxed);
+    statistics.grow_count_ = grow_count.load(std::memory_order_relaxed);
+    statistics.clear_count_ = clear_count.load(std::memory_order_relaxed);
+    statistics.memory_bytes_ = memory_bytes.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+} // namespace infinity
@@ -0,0 +1,100 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module hnsw_visited_table;
+
+import stl;
+
+namespace infinity {
+
+export struct VisitedTableStatistics {
+    u64 acquire_count_{};
+    // acquired a pooled table that was large enough
+    u64 hit_count_{};
+    u64 grow_count_{};
+    // the epoch wrapped around and the whole table was cleared
+    u64 clear_count_{};
+    u64 memory_bytes_{};
+
+    String ToString() const;
+};
+
+// A visited set of vertices whose tags are compared with the current epoch, so that Reset is O(1) unless the table grows
+// or the epoch wraps around.
+export class VisitedTable {
+public:
+    using TagType = u16;
+
+    VisitedTable() = default;
+    VisitedTable(const VisitedTable &) = delete;
+    VisitedTable &operator=(const VisitedTable &) = delete;
+    ~VisitedTable();
+
+    // Return true if the table was cleared or reallocated.
+    bool Reset(SizeT vertex_num);
+
+    // Return false if `vertex_i` was already visited since the last Reset.
+    inline bool TryVisit(SizeT vertex_i) {
+        if (tags_[vertex_i] == epoch_) {
+            return false;
+        }
+        tags_[vertex_i] = epoch_;
+        return true;
+    }
+
+    inline bool Visited(SizeT vertex_i) const { return tags_[vertex_i] == epoch_; }
+
+    inline void SetVisited(SizeT vertex_i) { tags_[vertex_i] = epoch_; }
+
+    inline SizeT Capacity() const { return capacity_; }
+
+    inline SizeT MemorySize() const { return capacity_ * sizeof(TagType); }
+
+private:
+    UniquePtr<TagType[]> tags_{};
+    SizeT capacity_{};
+    TagType epoch_{};
+};
+
+// Thread local pool of visited tables, shared by the HNSW search and build.
+export class VisitedTablePool {
+public:
+    // Return the table to the pool of the acquiring thread when destroyed. Must be destroyed on that thread.
+    class Handle {
+    public:
+        explicit Handle(UniquePtr<VisitedTable> table) : table_(std::move(table)) {}
+        Handle(const Handle &) = delete;
+        Handle &operator=(const Handle &) = delete;
+        Handle(Handle &&other) = default;
+        ~Handle();
+
+        VisitedTable *operator->() const { return table_.get(); }
+        VisitedTable &operator*() const { return *table_; }
+
+    private:
+        UniquePtr<VisitedTable> table_{};
+    };
+
+    // Get a table that is reset for `vertex_num` vertices.
+    static Handle Acquire(SizeT vertex_num);
+
+    static VisitedTableStatistics GetStatistics();
+
+    // Tables kept by each thread, nested acquires beyond this allocate.
+    static constexpr SizeT kMaxPooledTablesPerThread = 4;
+};
+
+} // namespace infinity
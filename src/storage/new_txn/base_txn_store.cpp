@@ -235,8 +235,9 @@ SharedPtr<WalEntry> ImportTxnStore::ToWalEntry(TxnTimeStamp commit_ts) const {
 
 SizeT ImportTxnStore::RowCount() const {
     SizeT row_count = 0;
-    for (const auto &input_blocks : input_blocks_in_imports_) {
-        row_count += input_blocks.second.at(0)->row_count();
+    // the input blocks are released once imported, count the rows by the segment infos
+    for (const auto &segment_info : segment_infos_) {
+        row_count += segment_info.row_count_;
     }
     return row_count;
 }
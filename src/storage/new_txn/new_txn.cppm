@@ -446,6 +446,12 @@ private:
                                  SharedPtr<ColumnDef> column_def,
                                  ChunkID &new_chunk_id);
 
+    Status PopulateDiskAnnIndexInner(SharedPtr<IndexBase> index_base,
+                                     SegmentIndexMeta &segment_index_meta,
+                                     SegmentMeta &segment_meta,
+                                     SharedPtr<ColumnDef> column_def,
+                                     ChunkID &new_chunk_id);
+
     Status PopulateEmvbIndexInner(SharedPtr<IndexBase> index_base,
                                   SegmentIndexMeta &segment_index_meta,
                                   SegmentMeta &segment_meta,
@@ -46,6 +46,8 @@ import secondary_index_data;
 import default_values;
 import ivf_index_data_in_mem;
 import ivf_index_data;
+import diskann_index_in_mem;
+import diskann_index_in_chunk;
 import memory_indexer;
 import index_full_text;
 import column_index_reader;
@@ -473,6 +475,22 @@ Status NewTxn::OptimizeIndexInner(SegmentIndexMeta &segment_index_meta,
             data_ptr->BuildIVFIndex(segment_meta, row_cnt, column_def);
             break;
         }
+        case IndexType::kDiskAnn: {
+            SegmentMeta segment_meta(segment_id, table_meta);
+            SharedPtr<ColumnDef> column_def;
+            {
+                auto [col_def, status] = table_index_meta.GetColumnDef();
+                if (!status.ok()) {
+                    return status;
+                }
+                column_def = std::move(col_def);
+            }
+
+            BufferHandle buffer_handle = buffer_obj->Load();
+            auto *data_ptr = static_cast<DiskAnnIndexInChunk *>(buffer_handle.GetDataMut());
+            data_ptr->Build(segment_meta, row_cnt, column_def, InfinityContext::instance().config()->TempDir());
+            break;
+        }
         case IndexType::kHnsw:
         case IndexType::kBMP: {
             SegmentMeta segment_meta(segment_id, table_meta);
@@ -833,6 +851,22 @@ NewTxn::AppendMemIndex(SegmentIndexMeta &segment_index_meta, BlockID block_id, c
             memory_ivf_index->InsertBlockData(block_offset, col, offset, row_cnt);
             break;
         }
+        case IndexType::kDiskAnn: {
+            SharedPtr<DiskAnnIndexInMem> memory_diskann_index;
+            {
+                std::unique_lock<std::mutex> lock(mem_index->mtx_);
+                if (mem_index->memory_diskann_index_.get() == nullptr) {
+                    auto [column_def, status] = segment_index_meta.table_index_meta().GetColumnDef();
+                    if (!status.ok()) {
+                        return status;
+                    }
+                    mem_index->memory_diskann_index_ = DiskAnnIndexInMem::NewDiskAnnIndexInMem(column_def.get(), index_base.get(), base_row_id);
+                }
+                memory_diskann_index = mem_index->memory_diskann_index_;
+            }
+            memory_diskann_index->InsertBlockData(block_offset, col, offset, row_cnt);
+            break;
+        }
         case IndexType::kHnsw: {
             SharedPtr<HnswIndexInMem> memory_hnsw_index;
             {
@@ -935,6 +969,11 @@ Status NewTxn::PopulateIndex(const String &db_name,
         if (!status.ok()) {
             return status;
         }
+    } else if (index_base->index_type_ == IndexType::kDiskAnn) {
+        Status status = this->PopulateDiskAnnIndexInner(index_base, *segment_index_meta, segment_meta, column_def, new_chunk_id);
+        if (!status.ok()) {
+            return status;
+        }
     } else if (index_base->index_type_ == IndexType::kEMVB) {
         Status status = this->PopulateEmvbIndexInner(index_base, *segment_index_meta, segment_meta, column_def, new_chunk_id);
         if (!status.ok()) {
@@ -958,10 +997,6 @@ Status NewTxn::PopulateIndex(const String &db_name,
                 }
                 break;
             }
-            case IndexType::kDiskAnn: { // TODO
-                LOG_WARN("Not implemented yet");
-                return Status::OK();
-            }
             default: {
                 UnrecoverableError("Invalid index type");
                 return Status::OK();
@@ -1227,6 +1262,60 @@ Status NewTxn::PopulateIvfIndexInner(SharedPtr<IndexBase> index_base,
     return Status::OK();
 }
 
+Status NewTxn::PopulateDiskAnnIndexInner(SharedPtr<IndexBase> index_base,
+                                         SegmentIndexMeta &segment_index_meta,
+                                         SegmentMeta &segment_meta,
+                                         SharedPtr<ColumnDef> column_def,
+                                         ChunkID &new_chunk_id) {
+    RowID base_row_id(segment_index_meta.segment_id(), 0);
+    u32 row_count = 0;
+    {
+        auto [rc, status] = segment_meta.GetRowCnt1();
+        if (!status.ok()) {
+            return status;
+        }
+        row_count = rc;
+    }
+    ChunkID chunk_id = 0;
+    {
+        Status status = segment_index_meta.GetNextChunkID(chunk_id);
+        if (!status.ok()) {
+            return status;
+        }
+        status = segment_index_meta.SetNextChunkID(chunk_id + 1);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    new_chunk_id = chunk_id;
+    Optional<ChunkIndexMeta> chunk_index_meta;
+    BufferObj *buffer_obj = nullptr;
+    {
+        Status status = NewCatalog::AddNewChunkIndex1(segment_index_meta,
+                                                          this,
+                                                          chunk_id,
+                                                          base_row_id,
+                                                          row_count,
+                                                          "" /*base_name*/,
+                                                          0 /*index_size*/,
+                                                          chunk_index_meta);
+        if (!status.ok()) {
+            return status;
+        }
+        status = chunk_index_meta->GetIndexBuffer(buffer_obj);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    {
+        BufferHandle buffer_handle = buffer_obj->Load();
+        auto *data_ptr = static_cast<DiskAnnIndexInChunk *>(buffer_handle.GetDataMut());
+        data_ptr->Build(segment_meta, row_count, column_def, InfinityContext::instance().config()->TempDir());
+    }
+    buffer_obj->Save();
+    return Status::OK();
+}
+
 Status NewTxn::PopulateEmvbIndexInner(SharedPtr<IndexBase> index_base,
                                       SegmentIndexMeta &segment_index_meta,
                                       SegmentMeta &segment_meta,
@@ -1518,7 +1607,7 @@ Status NewTxn::OptimizeSegmentIndexByParams(SegmentIndexMeta &segment_index_meta
                             if constexpr (IndexT::kOwnMem) {
                                 using HnswIndexDataType = typename std::remove_pointer_t<T>::DataType;
                                 if (params->compress_to_lvq) {
-                                    if constexpr (IsAnyOf<HnswIndexDataType, i8, u8>) {
+                                    if constexpr (IsAnyOf<HnswIndexDataType, i8, u8, Float16T, BFloat16T>) {
                                         UnrecoverableError("Invalid index type.");
                                     } else {
                                         auto *p = std::move(*index).CompressToLVQ().release();
@@ -1602,6 +1691,7 @@ Status NewTxn::DumpSegmentMemIndex(SegmentIndexMeta &segment_index_meta, const C
     SharedPtr<HnswIndexInMem> memory_hnsw_index = nullptr;
     SharedPtr<BMPIndexInMem> memory_bmp_index = nullptr;
     SharedPtr<EMVBIndexInMem> memory_emvb_index = nullptr;
+    SharedPtr<DiskAnnIndexInMem> memory_diskann_index = nullptr;
 
     // dump mem index only happens in parallel with read, not write, so no lock is needed.
     switch (index_base->index_type_) {
@@ -1648,7 +1738,10 @@ Status NewTxn::DumpSegmentMemIndex(SegmentIndexMeta &segment_index_meta, const C
             break;
         }
         case IndexType::kDiskAnn: {
-            LOG_WARN("Not implemented yet");
+            memory_diskann_index = mem_index->GetDiskAnnIndex();
+            if (memory_diskann_index == nullptr) {
+                return Status::OK();
+            }
             break;
         }
         default: {
@@ -1711,6 +1804,11 @@ Status NewTxn::DumpSegmentMemIndex(SegmentIndexMeta &segment_index_meta, const C
             buffer_obj->Save();
             break;
         }
+        case IndexType::kDiskAnn: {
+            memory_diskann_index->Dump(buffer_obj);
+            buffer_obj->Save();
+            break;
+        }
         case IndexType::kHnsw: {
             memory_hnsw_index->Dump(buffer_obj);
             buffer_obj->Save();
@@ -14,7 +14,11 @@
 
 module;
 #include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
 #include <filesystem>
+#include <unistd.h>
 
 module persistence_manager;
 import stl;
@@ -29,11 +33,13 @@ import obj_stat_accessor;
 import kv_store;
 import kv_code;
 import infinity_context;
+import async_file_io;
+import defer_op;
+import status;
 
 namespace fs = std::filesystem;
 
 namespace infinity {
-constexpr SizeT BUFFER_SIZE = 1024 * 1024; // 1 MB
 
 nlohmann::json ObjAddr::Serialize() const {
     nlohmann::json obj;
@@ -427,39 +433,30 @@ String PersistenceManager::ObjCreate() { return UUID().to_string(); }
 int PersistenceManager::CurrentObjRoomNoLock() { return int(object_size_limit_) - int(current_object_size_); }
 
 void PersistenceManager::CurrentObjAppendNoLock(const String &tmp_file_path, SizeT file_size) {
-    fs::path src_fp = tmp_file_path;
     fs::path dst_fp = Path(workspace_) / current_object_key_;
-    std::ifstream srcFile(src_fp, std::ios::binary);
-    if (!srcFile.is_open()) {
+    i32 src_fd = open(tmp_file_path.c_str(), O_RDONLY);
+    if (src_fd == -1) {
         String error_message = fmt::format("Failed to open source file {}", tmp_file_path);
         UnrecoverableError(error_message);
     }
-    std::ofstream dstFile(dst_fp, std::ios::binary | std::ios::app);
-    if (!dstFile.is_open()) {
+    DeferFn defer_src([&]() { close(src_fd); });
+    i32 dst_fd = open(dst_fp.c_str(), O_WRONLY | O_CREAT, 0666);
+    if (dst_fd == -1) {
         String error_message = fmt::format("Failed to open destination file {} {}", strerror(errno), dst_fp.string());
         UnrecoverableError(error_message);
     }
-    {
-        dstFile.seekp(0, std::ios::end);
-        SizeT current_size = dstFile.tellp();
-        if (current_size < current_object_size_) {
-            std::vector<char> zero_padding(current_object_size_ - current_size, 0);
-            dstFile.write(zero_padding.data(), zero_padding.size());
-        }
-    }
-    char buffer[BUFFER_SIZE];
-    while (srcFile.read(buffer, BUFFER_SIZE)) {
-        dstFile.write(buffer, srcFile.gcount());
+    DeferFn defer_dst([&]() { close(dst_fd); });
+    // the gap up to the aligned part offset reads as zeros
+    Status status = AsyncFileIO::CopyRange(src_fd, 0, dst_fd, current_object_size_, file_size);
+    if (!status.ok()) {
+        UnrecoverableError(fmt::format("Failed to append {} to object {}: {}", tmp_file_path, current_object_key_, status.message()));
     }
-    dstFile.write(buffer, srcFile.gcount());
-    srcFile.close();
     current_object_size_ += file_size;
     current_object_parts_++;
     if (current_object_size_ >= object_size_limit_) {
         UnrecoverableError(
             fmt::format("CurrentObjAppendNoLock object {} size {} exceeds limit {}", current_object_key_, current_object_size_, object_size_limit_));
     }
-    dstFile.close();
 }
 
 void PersistenceManager::CleanupNoLock(const ObjAddr &object_addr,
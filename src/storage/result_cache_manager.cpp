@@ -24,6 +24,10 @@ import logical_match;
 import physical_match;
 import logical_node_type;
 import logger;
+import column_vector;
+import vector_buffer;
+import default_values;
+import third_party;
 
 namespace infinity {
 
@@ -54,82 +58,338 @@ UniquePtr<CacheContent> CacheContent::Clone() const {
     return MakeUnique<CacheContent>(std::move(data_blocks), column_names_);
 }
 
-bool CacheResultMap::AddCache(
+UniquePtr<CacheContent> CacheContent::Truncate(SizeT row_count) const {
+    Vector<UniquePtr<DataBlock>> data_blocks;
+    for (const auto &block : data_blocks_) {
+        if (row_count == 0) {
+            break;
+        }
+        SizeT block_row_count = block->row_count();
+        if (block_row_count <= row_count) {
+            data_blocks.push_back(block->Clone());
+            row_count -= block_row_count;
+            continue;
+        }
+        Vector<SharedPtr<ColumnVector>> column_vectors;
+        for (const auto &column_vector : block->column_vectors) {
+            auto truncated_column = MakeShared<ColumnVector>(column_vector->data_type());
+            truncated_column->Initialize(*column_vector, 0, row_count);
+            column_vectors.push_back(std::move(truncated_column));
+        }
+        auto truncated_block = MakeUnique<DataBlock>();
+        truncated_block->Init(column_vectors);
+        data_blocks.push_back(std::move(truncated_block));
+        row_count = 0;
+    }
+    return MakeUnique<CacheContent>(std::move(data_blocks), column_names_);
+}
+
+SizeT CacheContent::row_count() const {
+    SizeT row_count = 0;
+    for (const auto &block : data_blocks_) {
+        row_count += block->row_count();
+    }
+    return row_count;
+}
+
+SizeT CacheContent::MemorySize() const {
+    SizeT memory_size = 0;
+    for (const auto &block : data_blocks_) {
+        for (const auto &column_vector : block->column_vectors) {
+            memory_size += column_vector->capacity() * column_vector->data_type_size_;
+            if (column_vector->buffer_) {
+                memory_size += column_vector->buffer_->TotalSize(column_vector->data_type().get());
+            }
+        }
+    }
+    return memory_size;
+}
+
+CacheFrequencySketch::CacheFrequencySketch(SizeT capacity) {
+    width_ = 16;
+    while (width_ < capacity) {
+        width_ <<= 1;
+    }
+    counters_.resize(kDepth * width_);
+    doorkeeper_.resize(width_);
+    sample_size_ = 10 * width_;
+}
+
+void CacheFrequencySketch::Increment(u64 hash) {
+    SizeT door_idx = Index(hash, kDepth);
+    if (!doorkeeper_[door_idx]) {
+        doorkeeper_[door_idx] = true;
+    } else {
+        for (SizeT row = 0; row < kDepth; ++row) {
+            u8 &counter = counters_[row * width_ + Index(hash, row)];
+            if (counter < kMaxCount) {
+                ++counter;
+            }
+        }
+    }
+    if (++addition_cnt_ >= sample_size_) {
+        Age();
+    }
+}
+
+SizeT CacheFrequencySketch::Frequency(u64 hash) const {
+    if (!doorkeeper_[Index(hash, kDepth)]) {
+        return 0;
+    }
+    u8 frequency = kMaxCount;
+    for (SizeT row = 0; row < kDepth; ++row) {
+        frequency = std::min(frequency, counters_[row * width_ + Index(hash, row)]);
+    }
+    return frequency + 1;
+}
+
+SizeT CacheFrequencySketch::Index(u64 hash, SizeT row) const {
+    // a different mix of the hash for each row, the last row is the doorkeeper
+    u64 h = hash + (row + 1) * 0x9e3779b97f4a7c15ULL;
+    h = (h ^ (h >> 33)) * 0xff51afd7ed558ccdULL;
+    h = (h ^ (h >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h & (width_ - 1);
+}
+
+void CacheFrequencySketch::Age() {
+    for (u8 &counter : counters_) {
+        counter >>= 1;
+    }
+    std::fill(doorkeeper_.begin(), doorkeeper_.end(), false);
+    addition_cnt_ = 0;
+}
+
+bool CacheResultShard::AddCache(
     UniquePtr<CachedNodeBase> cached_node,
     Vector<UniquePtr<DataBlock>> data_blocks,
     const std::function<void(UniquePtr<CachedNodeBase>, CacheContent &, Vector<UniquePtr<DataBlock>>)> &update_content_func) {
     std::lock_guard<std::mutex> lock(mtx_);
     auto mp_iter = lru_map_.find(cached_node.get());
     if (mp_iter != lru_map_.end()) {
-        CacheContent &old_content = *mp_iter->second->cache_content_;
-        update_content_func(std::move(cached_node), old_content, std::move(data_blocks));
+        LRUEntry &entry = *mp_iter->second;
+        update_content_func(std::move(cached_node), *entry.cache_content_, std::move(data_blocks));
+        memory_used_ -= entry.memory_size_;
+        entry.memory_size_ = entry.cache_content_->MemorySize();
+        memory_used_ += entry.memory_size_;
         return false;
     }
-    if (lru_list_.size() >= cache_num_capacity_) {
-        LRUEntry &envict_entry = lru_list_.back();
-        SizeT remove_n = lru_map_.erase(envict_entry.cached_node_.get());
-        if (remove_n != 1) {
-            UnrecoverableError("Failed to remove cache entry from lru_map_");
-        }
-        lru_list_.pop_back();
+    auto cache_content = MakeShared<CacheContent>(std::move(data_blocks), cached_node->output_names());
+    SizeT memory_size = cache_content->MemorySize();
+    if (!Admit(cached_node->HashIgnoreTopN(), memory_size)) {
+        return false;
     }
     auto *cached_node_ptr = cached_node.get();
-    auto cache_content = MakeShared<CacheContent>(std::move(data_blocks), cached_node->output_names());
-    lru_list_.emplace_front(std::move(cached_node), cache_content);
-    lru_map_.emplace_hint(mp_iter, cached_node_ptr, lru_list_.begin());
+    lru_list_.push_front(LRUEntry{std::move(cached_node), std::move(cache_content), memory_size});
+    lru_map_.emplace(cached_node_ptr, lru_list_.begin());
+    if (cached_node_ptr->TopN() > 0) {
+        topn_map_.emplace(cached_node_ptr->HashIgnoreTopN(), lru_list_.begin());
+    }
+    memory_used_ += memory_size;
     return true;
 }
 
-SharedPtr<CacheContent> CacheResultMap::GetCache(const CachedNodeBase &cached_node) {
+bool CacheResultShard::Admit(u64 candidate_hash, SizeT memory_size) {
+    if (cache_num_capacity_ == 0 || memory_size > memory_limit_) {
+        return false;
+    }
+    // the least recently used entries to evict for the candidate
+    SizeT victim_cnt = 0;
+    SizeT victim_memory = 0;
+    SizeT max_victim_frequency = 0;
+    for (auto iter = lru_list_.rbegin(); iter != lru_list_.rend(); ++iter) {
+        if (lru_list_.size() - victim_cnt < cache_num_capacity_ && memory_used_ - victim_memory + memory_size <= memory_limit_) {
+            break;
+        }
+        ++victim_cnt;
+        victim_memory += iter->memory_size_;
+        max_victim_frequency = std::max(max_victim_frequency, sketch_.Frequency(iter->cached_node_->HashIgnoreTopN()));
+    }
+    if (victim_cnt > 0 && sketch_.Frequency(candidate_hash) < max_victim_frequency) {
+        return false;
+    }
+    for (SizeT i = 0; i < victim_cnt; ++i) {
+        Erase(std::prev(lru_list_.end()));
+    }
+    return true;
+}
+
+void CacheResultShard::Erase(LRUList::iterator iter) {
+    CachedNodeBase *cached_node = iter->cached_node_.get();
+    if (cached_node->TopN() > 0) {
+        auto [begin, end] = topn_map_.equal_range(cached_node->HashIgnoreTopN());
+        for (auto topn_iter = begin; topn_iter != end; ++topn_iter) {
+            if (topn_iter->second == iter) {
+                topn_map_.erase(topn_iter);
+                break;
+            }
+        }
+    }
+    SizeT remove_n = lru_map_.erase(cached_node);
+    if (remove_n != 1) {
+        UnrecoverableError("Failed to remove cache entry from lru_map_");
+    }
+    memory_used_ -= iter->memory_size_;
+    lru_list_.erase(iter);
+}
+
+Pair<SharedPtr<CacheContent>, SizeT> CacheResultShard::GetCache(const CachedNodeBase &cached_node) {
     std::lock_guard<std::mutex> lock(mtx_);
-    auto mp_iter = lru_map_.find(&cached_node);
-    if (mp_iter == lru_map_.end()) {
-        return nullptr;
+    u64 topn_hash = cached_node.HashIgnoreTopN();
+    sketch_.Increment(topn_hash);
+    LRUList::iterator iter = lru_list_.end();
+    if (auto mp_iter = lru_map_.find(&cached_node); mp_iter != lru_map_.end()) {
+        iter = mp_iter->second;
+    } else if (SizeT topn = cached_node.TopN(); topn > 0) {
+        // the cached result with the least top n not less than the requested one
+        auto [begin, end] = topn_map_.equal_range(topn_hash);
+        for (auto topn_iter = begin; topn_iter != end; ++topn_iter) {
+            const CachedNodeBase &candidate = *topn_iter->second->cached_node_;
+            SizeT candidate_topn = candidate.TopN();
+            if (candidate_topn < topn || !candidate.EqIgnoreTopN(cached_node)) {
+                continue;
+            }
+            if (iter == lru_list_.end() || candidate_topn < iter->cached_node_->TopN()) {
+                iter = topn_iter->second;
+            }
+        }
+    }
+    if (iter == lru_list_.end()) {
+        return {nullptr, 0};
     }
-    auto iter = mp_iter->second;
     lru_list_.splice(lru_list_.begin(), lru_list_, iter);
-    return iter->cache_content_;
+    return {iter->cache_content_, iter->cached_node_->TopN()};
 }
 
-SizeT CacheResultMap::DropIF(std::function<bool(const CachedNodeBase &)> pred) {
+SizeT CacheResultShard::DropIF(const std::function<bool(const CachedNodeBase &)> &pred) {
     std::lock_guard<std::mutex> lock(mtx_);
     SizeT removed = 0;
-    for (auto mp_iter = lru_map_.begin(); mp_iter != lru_map_.end();) {
-        const auto &[cached_node, iter] = *mp_iter;
-        if (pred(*cached_node)) {
-            lru_list_.erase(iter);
-            mp_iter = lru_map_.erase(mp_iter);
+    for (auto iter = lru_list_.begin(); iter != lru_list_.end();) {
+        auto next_iter = std::next(iter);
+        if (pred(*iter->cached_node_)) {
+            Erase(iter);
             ++removed;
-        } else {
-            ++mp_iter;
         }
+        iter = next_iter;
     }
     return removed;
 }
 
-void CacheResultMap::ResetCacheNumCapacity(SizeT cache_num_capacity) {
+void CacheResultShard::ResetCapacity(SizeT cache_num_capacity, SizeT memory_limit) {
     std::lock_guard<std::mutex> lock(mtx_);
     cache_num_capacity_ = cache_num_capacity;
-    while (lru_list_.size() > cache_num_capacity_) {
-        LRUEntry &envict_entry = lru_list_.back();
-        SizeT remove_n = lru_map_.erase(envict_entry.cached_node_.get());
-        if (remove_n != 1) {
-            UnrecoverableError("Failed to remove cache entry from lru_map_");
-        }
-        lru_list_.pop_back();
+    memory_limit_ = memory_limit;
+    while (!lru_list_.empty() && (lru_list_.size() > cache_num_capacity_ || memory_used_ > memory_limit_)) {
+        Erase(std::prev(lru_list_.end()));
     }
+    sketch_ = CacheFrequencySketch(cache_num_capacity_);
 }
 
-void CacheResultMap::ClearCache() {
+void CacheResultShard::ClearCache() {
     std::lock_guard<std::mutex> lock(mtx_);
     lru_list_.clear();
     lru_map_.clear();
+    topn_map_.clear();
+    memory_used_ = 0;
+}
+
+CacheResultMap::CacheResultMap(SizeT cache_num_capacity, SizeT memory_limit)
+    : cache_num_capacity_(cache_num_capacity), memory_limit_(memory_limit) {
+    SizeT shard_num = std::clamp<SizeT>(cache_num_capacity / CACHE_RESULT_MIN_SHARD_CAPACITY, 1, CACHE_RESULT_MAX_SHARD_NUM);
+    for (SizeT i = 0; i < shard_num; ++i) {
+        shards_.push_back(MakeUnique<CacheResultShard>(0, 0));
+    }
+    ResetShardCapacity();
+}
+
+bool CacheResultMap::AddCache(
+    UniquePtr<CachedNodeBase> cached_node,
+    Vector<UniquePtr<DataBlock>> data_blocks,
+    const std::function<void(UniquePtr<CachedNodeBase>, CacheContent &, Vector<UniquePtr<DataBlock>>)> &update_content_func) {
+    CacheResultShard &shard = GetShard(*cached_node);
+    return shard.AddCache(std::move(cached_node), std::move(data_blocks), update_content_func);
+}
+
+SharedPtr<CacheContent> CacheResultMap::GetCache(const CachedNodeBase &cached_node) {
+    auto [cache_content, cached_topn] = GetShard(cached_node).GetCache(cached_node);
+    SizeT topn = cached_node.TopN();
+    if (cache_content && cached_topn > topn && cache_content->row_count() > topn) {
+        // results are ordered best first, the first rows of a larger top n answer the query
+        return cache_content->Truncate(topn);
+    }
+    return cache_content;
+}
+
+SizeT CacheResultMap::DropIF(std::function<bool(const CachedNodeBase &)> pred) {
+    SizeT removed = 0;
+    for (auto &shard : shards_) {
+        removed += shard->DropIF(pred);
+    }
+    return removed;
+}
+
+void CacheResultMap::ResetCacheNumCapacity(SizeT cache_num_capacity) {
+    cache_num_capacity_ = cache_num_capacity;
+    ResetShardCapacity();
+}
+
+void CacheResultMap::ResetShardCapacity() {
+    SizeT cache_num_capacity = cache_num_capacity_;
+    SizeT shard_num = shards_.size();
+    for (SizeT i = 0; i < shard_num; ++i) {
+        SizeT shard_capacity = cache_num_capacity / shard_num + (i < cache_num_capacity % shard_num ? 1 : 0);
+        shards_[i]->ResetCapacity(shard_capacity, memory_limit_ / shard_num);
+    }
+}
+
+void CacheResultMap::ClearCache() {
+    for (auto &shard : shards_) {
+        shard->ClearCache();
+    }
+}
+
+SizeT CacheResultMap::cache_num_used() {
+    SizeT cache_num_used = 0;
+    for (auto &shard : shards_) {
+        cache_num_used += shard->cache_num_used();
+    }
+    return cache_num_used;
 }
 
+SizeT CacheResultMap::memory_used() {
+    SizeT memory_used = 0;
+    for (auto &shard : shards_) {
+        memory_used += shard->memory_used();
+    }
+    return memory_used;
+}
+
+namespace {
+
+const CachedScanBase *GetCachedScan(const CachedNodeBase &cached_node_base) {
+    switch (cached_node_base.type()) {
+        case LogicalNodeType::kMatch:
+        case LogicalNodeType::kKnnScan:
+        case LogicalNodeType::kMatchSparseScan:
+        case LogicalNodeType::kMatchTensorScan:
+        case LogicalNodeType::kIndexScan: {
+            return static_cast<const CachedScanBase *>(&cached_node_base);
+        }
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+} // namespace
+
 bool ResultCacheManager::AddCache(UniquePtr<CachedNodeBase> cached_node, Vector<UniquePtr<DataBlock>> data_blocks) {
     if (cached_node == nullptr) {
         return false;
     }
+    if (!UpdateTableTs(*cached_node)) {
+        return false;
+    }
     auto update_content_func = [](UniquePtr<CachedNodeBase> cached_node, CacheContent &old_content, Vector<UniquePtr<DataBlock>> data_blocks) {
         auto new_content = MakeShared<CacheContent>(std::move(data_blocks), cached_node->output_names());
         SharedPtr<Vector<String>> new_output_names = new_content->column_names_;
@@ -159,6 +419,9 @@ bool ResultCacheManager::AddCache(UniquePtr<CachedNodeBase> cached_node, Vector<
 }
 
 Optional<CacheOutput> ResultCacheManager::GetCache(const CachedNodeBase &cached_node) {
+    if (!UpdateTableTs(cached_node)) {
+        return None;
+    }
     SharedPtr<CacheContent> cache_content = cache_map_.GetCache(cached_node);
     if (!cache_content) {
         return None;
@@ -177,18 +440,56 @@ Optional<CacheOutput> ResultCacheManager::GetCache(const CachedNodeBase &cached_
 }
 
 SizeT ResultCacheManager::DropTable(const String &schema_name, const String &table_name) {
-    auto pred = [&](const CachedNodeBase &cached_node_base) {
-        switch (cached_node_base.type()) {
-            case LogicalNodeType::kMatch: {
-                const auto &cached_scan_base = static_cast<const CachedScanBase &>(cached_node_base);
-                return cached_scan_base.schema_name() == schema_name && cached_scan_base.table_name() == table_name;
-            }
-            default: {
-                return false;
-            }
+    {
+        std::lock_guard<std::mutex> lock(table_mtx_);
+        if (auto iter = table_query_ts_.find(schema_name); iter != table_query_ts_.end()) {
+            iter->second.erase(table_name);
         }
+    }
+    auto pred = [&](const CachedNodeBase &cached_node_base) {
+        const CachedScanBase *cached_scan = GetCachedScan(cached_node_base);
+        return cached_scan != nullptr && cached_scan->schema_name() == schema_name && cached_scan->table_name() == table_name;
+    };
+    return cache_map_.DropIF(pred);
+}
+
+SizeT ResultCacheManager::InvalidateTable(const String &schema_name, const String &table_name, TxnTimeStamp commit_ts) {
+    {
+        std::lock_guard<std::mutex> lock(table_mtx_);
+        TxnTimeStamp &table_ts = table_query_ts_[schema_name][table_name];
+        table_ts = std::max(table_ts, commit_ts);
+    }
+    auto pred = [&](const CachedNodeBase &cached_node_base) {
+        const CachedScanBase *cached_scan = GetCachedScan(cached_node_base);
+        return cached_scan != nullptr && cached_scan->schema_name() == schema_name && cached_scan->table_name() == table_name &&
+               cached_scan->query_ts() < commit_ts;
     };
     return cache_map_.DropIF(pred);
 }
 
+bool ResultCacheManager::UpdateTableTs(const CachedNodeBase &cached_node) {
+    const CachedScanBase *cached_scan = GetCachedScan(cached_node);
+    if (cached_scan == nullptr) {
+        return true;
+    }
+    TxnTimeStamp query_ts = cached_scan->query_ts();
+    {
+        std::lock_guard<std::mutex> lock(table_mtx_);
+        TxnTimeStamp &table_ts = table_query_ts_[cached_scan->schema_name()][cached_scan->table_name()];
+        if (query_ts < table_ts) {
+            return false;
+        }
+        if (query_ts == table_ts) {
+            return true;
+        }
+        table_ts = query_ts;
+    }
+    // the table has changed since the cached results were read
+    SizeT removed = InvalidateTable(cached_scan->schema_name(), cached_scan->table_name(), query_ts);
+    if (removed > 0) {
+        LOG_DEBUG(fmt::format("Invalidate {} cached results of table {}.{}", removed, cached_scan->schema_name(), cached_scan->table_name()));
+    }
+    return true;
+}
+
 } // namespace infinity
\ No newline at end of file
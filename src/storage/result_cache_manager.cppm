@@ -23,6 +23,7 @@ import cached_node_base;
 import data_block;
 import logical_read_cache;
 import global_resource_usage;
+import default_values;
 
 namespace infinity {
 
@@ -38,6 +39,13 @@ public:
 
     UniquePtr<CacheContent> Clone() const;
 
+    // Return the content with its first row_count rows.
+    UniquePtr<CacheContent> Truncate(SizeT row_count) const;
+
+    SizeT row_count() const;
+
+    SizeT MemorySize() const;
+
     Vector<UniquePtr<DataBlock>> data_blocks_;
     SharedPtr<Vector<String>> column_names_;
 };
@@ -47,7 +55,33 @@ export struct CacheOutput {
     Vector<SizeT> column_map_;
 };
 
-class CacheResultMap {
+// Count-min sketch of the recent lookups of the cache keys with a doorkeeper for the keys seen once, the counters are halved
+// periodically so that the frequency ages.
+export class CacheFrequencySketch {
+public:
+    explicit CacheFrequencySketch(SizeT capacity);
+
+    void Increment(u64 hash);
+
+    SizeT Frequency(u64 hash) const;
+
+private:
+    SizeT Index(u64 hash, SizeT row) const;
+
+    void Age();
+
+    static constexpr SizeT kDepth = 4;
+    static constexpr u8 kMaxCount = 15;
+
+    SizeT width_{};
+    Vector<u8> counters_{};
+    Vector<bool> doorkeeper_{};
+    SizeT sample_size_{};
+    SizeT addition_cnt_{};
+};
+
+// One LRU list of the cache. A new result is admitted only if it is looked up at least as frequently as the entries it evicts.
+class CacheResultShard {
 public:
     struct CachedLogicalMatchBaseHash {
         using is_transparent = std::true_type;
@@ -61,45 +95,100 @@ public:
         bool operator()(const CachedNodeBase *key1, const CachedNodeBase *key2) const { return key1->Eq(*key2); }
     };
 
-    CacheResultMap(SizeT cache_num_capacity) : cache_num_capacity_(cache_num_capacity) {}
+    CacheResultShard(SizeT cache_num_capacity, SizeT memory_limit)
+        : cache_num_capacity_(cache_num_capacity), memory_limit_(memory_limit), sketch_(cache_num_capacity) {}
 
     bool AddCache(UniquePtr<CachedNodeBase> cached_node,
                   Vector<UniquePtr<DataBlock>> data_blocks,
                   const std::function<void(UniquePtr<CachedNodeBase>, CacheContent &, Vector<UniquePtr<DataBlock>>)> &update_content_func);
 
-    SharedPtr<CacheContent> GetCache(const CachedNodeBase &cached_node);
+    // Return the cached content and its top n, the top n is larger than the one of cached_node if only a subsuming result is found.
+    Pair<SharedPtr<CacheContent>, SizeT> GetCache(const CachedNodeBase &cached_node);
 
-    SizeT DropIF(std::function<bool(const CachedNodeBase &)> pred);
+    SizeT DropIF(const std::function<bool(const CachedNodeBase &)> &pred);
 
-    void ResetCacheNumCapacity(SizeT cache_num_capacity);
+    void ResetCapacity(SizeT cache_num_capacity, SizeT memory_limit);
 
     void ClearCache();
 
-    SizeT cache_num_capacity() const { return cache_num_capacity_; }
-
     SizeT cache_num_used() {
         std::lock_guard<std::mutex> lock(mtx_);
         return lru_map_.size();
     }
 
+    SizeT memory_used() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return memory_used_;
+    }
+
 private:
     struct LRUEntry {
         UniquePtr<CachedNodeBase> cached_node_;
         SharedPtr<CacheContent> cache_content_;
+        SizeT memory_size_{};
     };
     using LRUList = List<LRUEntry>;
     using LRUMap = HashMap<CachedNodeBase *, LRUList::iterator, CachedLogicalMatchBaseHash, CachedLogicalMatchBaseEq>;
+    // entries of top n queries by CachedNodeBase::HashIgnoreTopN
+    using TopNMap = MultiHashMap<u64, LRUList::iterator>;
+
+    // Caller holds mtx_.
+    bool Admit(u64 candidate_hash, SizeT memory_size);
+
+    // Caller holds mtx_.
+    void Erase(LRUList::iterator iter);
 
     std::mutex mtx_;
 
     SizeT cache_num_capacity_;
+    SizeT memory_limit_;
+    SizeT memory_used_{};
     LRUList lru_list_;
     LRUMap lru_map_;
+    TopNMap topn_map_;
+    CacheFrequencySketch sketch_;
+};
+
+// The result cache split into lock shards by the query, a query with a top n and its subsuming queries fall in the same shard.
+// Small caches are not split so that the entry count capacity is exact.
+class CacheResultMap {
+public:
+    CacheResultMap(SizeT cache_num_capacity, SizeT memory_limit);
+
+    bool AddCache(UniquePtr<CachedNodeBase> cached_node,
+                  Vector<UniquePtr<DataBlock>> data_blocks,
+                  const std::function<void(UniquePtr<CachedNodeBase>, CacheContent &, Vector<UniquePtr<DataBlock>>)> &update_content_func);
+
+    SharedPtr<CacheContent> GetCache(const CachedNodeBase &cached_node);
+
+    SizeT DropIF(std::function<bool(const CachedNodeBase &)> pred);
+
+    void ResetCacheNumCapacity(SizeT cache_num_capacity);
+
+    void ClearCache();
+
+    SizeT cache_num_capacity() const { return cache_num_capacity_; }
+
+    SizeT cache_num_used();
+
+    SizeT memory_limit() const { return memory_limit_; }
+
+    SizeT memory_used();
+
+private:
+    CacheResultShard &GetShard(const CachedNodeBase &cached_node) { return *shards_[cached_node.HashIgnoreTopN() % shards_.size()]; }
+
+    void ResetShardCapacity();
+
+    Atomic<SizeT> cache_num_capacity_;
+    const SizeT memory_limit_;
+    Vector<UniquePtr<CacheResultShard>> shards_;
 };
 
 export class ResultCacheManager {
 public:
-    ResultCacheManager(SizeT cache_num_capacity) : cache_map_(cache_num_capacity) {
+    ResultCacheManager(SizeT cache_num_capacity, SizeT memory_limit = DEFAULT_CACHE_RESULT_MEMORY_LIMIT)
+        : cache_map_(cache_num_capacity, memory_limit) {
 #ifdef INFINITY_DEBUG
         GlobalResourceUsage::IncrObjectCount("ResultCacheManager");
 #endif
@@ -116,6 +205,9 @@ public:
 
     SizeT DropTable(const String &schema_name, const String &table_name);
 
+    // Drop the cached results of the table read before commit_ts, the later results of the table are admitted only.
+    SizeT InvalidateTable(const String &schema_name, const String &table_name, TxnTimeStamp commit_ts);
+
     void ResetCacheNumCapacity(SizeT cache_num_capacity) { cache_map_.ResetCacheNumCapacity(cache_num_capacity); }
 
     void ClearCache() { cache_map_.ClearCache(); }
@@ -124,8 +216,19 @@ public:
 
     SizeT cache_num_used() { return cache_map_.cache_num_used(); }
 
+    SizeT memory_limit() const { return cache_map_.memory_limit(); }
+
+    SizeT memory_used() { return cache_map_.memory_used(); }
+
 private:
+    // Invalidate the table of a scan result by its query timestamp, return false if the result is older than the table in the cache.
+    bool UpdateTableTs(const CachedNodeBase &cached_node);
+
     CacheResultMap cache_map_;
+
+    std::mutex table_mtx_;
+    // latest query timestamp by schema and table name
+    HashMap<String, HashMap<String, TxnTimeStamp>> table_query_ts_;
 };
 
 } // namespace infinity
\ No newline at end of file
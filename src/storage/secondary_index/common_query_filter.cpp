@@ -259,7 +259,9 @@ void CommonQueryFilter::TryApplyIndexFilterOptimizer(QueryContext *query_context
     index_filter_evaluator_ = std::move(index_scan_solve_result.index_filter_evaluator_);
 }
 
-bool CommonQueryFilter::PassFilter(RowID doc_id) {
+bool CommonQueryFilter::PassFilter(RowID doc_id) { return PassFilter(doc_id, current_segment_id_, doc_id_bitmask_); }
+
+bool CommonQueryFilter::PassFilter(RowID doc_id, SegmentID &current_segment_id, const Bitmask *&doc_id_bitmask) const {
     if (always_true_) [[unlikely]]
         return true;
     bool finish_build = finish_build_.test();
@@ -267,16 +269,16 @@ bool CommonQueryFilter::PassFilter(RowID doc_id) {
     if (!finish_build) {
         UnrecoverableError("CommonQueryFilter error: not finished.");
     }
-    if (doc_id.segment_id_ != current_segment_id_) [[unlikely]] {
+    if (doc_id.segment_id_ != current_segment_id) [[unlikely]] {
         const auto it = filter_result_.find(doc_id.segment_id_);
         if (it == filter_result_.end()) [[unlikely]] {
-            current_segment_id_ = INVALID_SEGMENT_ID;
+            current_segment_id = INVALID_SEGMENT_ID;
             return false;
         }
-        current_segment_id_ = doc_id.segment_id_;
-        doc_id_bitmask_ = &(it->second);
+        current_segment_id = doc_id.segment_id_;
+        doc_id_bitmask = &(it->second);
     }
-    return doc_id_bitmask_->IsTrue(doc_id.segment_offset_);
+    return doc_id_bitmask->IsTrue(doc_id.segment_offset_);
 }
 
 RowID CommonQueryFilter::EqualOrLarger(RowID doc_id) {
@@ -100,6 +100,9 @@ public:
     // Check if given doc pass filter. Requires doc_id be in ascending order.
     bool PassFilter(RowID doc_id);
 
+    // PassFilter with the segment cursor kept by the caller, so that several iterators may check the filter concurrently.
+    bool PassFilter(RowID doc_id, SegmentID &current_segment_id, const Bitmask *&doc_id_bitmask) const;
+
 private:
     RowID EqualOrLarger(RowID doc_id);
 
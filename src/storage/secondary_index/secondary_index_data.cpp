@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <cassert>
 #include <concepts>
 #include <vector>
@@ -31,9 +32,25 @@ import secondary_index_pgm;
 import logger;
 import buffer_handle;
 import buffer_obj;
+import status;
 
 namespace infinity {
 
+namespace {
+
+void ReadExact(LocalFileHandle &file_handle, void *buffer, SizeT nbytes) {
+    auto [read_n, status] = file_handle.Read(buffer, nbytes);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    if (read_n != nbytes) {
+        RecoverableError(Status::NotSupport(
+            fmt::format("Secondary index chunk {} is truncated, expect {} bytes, read {}, drop and recreate the index.", file_handle.Path(), nbytes, read_n)));
+    }
+}
+
+} // namespace
+
 template <typename RawValueType>
 struct SecondaryIndexChunkDataReader {
     using OrderedKeyType = ConvertToOrderedType<RawValueType>;
@@ -60,9 +77,35 @@ struct SecondaryIndexChunkDataReader {
     }
 };
 
+template <>
+struct SecondaryIndexChunkDataReader<VarcharT> {
+    using OrderedKeyType = String;
+    BufferHandle handle_;
+    u32 row_count_ = 0;
+    u32 next_offset_ = 0;
+    const SecondaryIndexData *index_ = nullptr;
+    const SegmentOffset *offset_ptr_ = nullptr;
+    SecondaryIndexChunkDataReader(BufferObj *buffer_obj, u32 row_count) {
+        handle_ = buffer_obj->Load();
+        row_count_ = row_count;
+        index_ = static_cast<const SecondaryIndexData *>(handle_.GetData());
+        offset_ptr_ = index_->GetKeyOffsetPointer().second;
+        assert(index_->GetChunkRowCount() == row_count_);
+    }
+    bool GetNextDataPair(OrderedKeyType &key, u32 &offset) {
+        if (next_offset_ >= row_count_) {
+            return false;
+        }
+        key = index_->GetVarcharValue(next_offset_);
+        offset = offset_ptr_[next_offset_];
+        ++next_offset_;
+        return true;
+    }
+};
+
 template <typename RawValueType>
 struct SecondaryIndexChunkMerger {
-    using OrderedKeyType = ConvertToOrderedType<RawValueType>;
+    using OrderedKeyType = typename SecondaryIndexChunkDataReader<RawValueType>::OrderedKeyType;
     Vector<SecondaryIndexChunkDataReader<RawValueType>> readers_;
     std::priority_queue<Tuple<OrderedKeyType, u32, u32>, Vector<Tuple<OrderedKeyType, u32, u32>>, std::greater<Tuple<OrderedKeyType, u32, u32>>> pq_;
     explicit SecondaryIndexChunkMerger(const Vector<Pair<u32, BufferObj *>> &buffer_objs) {
@@ -159,6 +202,126 @@ public:
     }
 };
 
+// Saved varchar chunks start with the magic and the version. The chunks saved before the suffix pool layout start with the key
+// hashes and end with a PGM, and cannot be read as the current layout.
+constexpr u64 kVarcharIndexMagic = 0x5844495241484356; // "VCHARIDX"
+constexpr u32 kVarcharIndexVersion = 1;
+
+// The keys only keep the leading bytes of the values, the rest of the longer values is kept in a suffix pool.
+// Chunks are searched by binary search on the keys, so no PGM is built.
+class SecondaryIndexDataVarchar final : public SecondaryIndexData {
+    using OrderedKeyType = ConvertToOrderedType<VarcharT>;
+    UniquePtr<OrderedKeyType[]> key_;
+    UniquePtr<SegmentOffset[]> offset_;
+    // suffix of the i-th value is suffix_pool_[suffix_offset_[i], suffix_offset_[i + 1])
+    Vector<u32> suffix_offset_;
+    String suffix_pool_;
+
+public:
+    explicit SecondaryIndexDataVarchar(const u32 chunk_row_count) : SecondaryIndexData(chunk_row_count) {
+        key_ = MakeUnique<OrderedKeyType[]>(chunk_row_count_);
+        offset_ = MakeUnique<SegmentOffset[]>(chunk_row_count_);
+        key_ptr_ = key_.get();
+        offset_ptr_ = offset_.get();
+        suffix_offset_.resize(chunk_row_count_ + 1);
+    }
+
+    void SaveIndexInner(LocalFileHandle &file_handle) const override {
+        file_handle.Append(&kVarcharIndexMagic, sizeof(kVarcharIndexMagic));
+        file_handle.Append(&kVarcharIndexVersion, sizeof(kVarcharIndexVersion));
+        file_handle.Append(key_ptr_, chunk_row_count_ * sizeof(OrderedKeyType));
+        file_handle.Append(offset_ptr_, chunk_row_count_ * sizeof(SegmentOffset));
+        file_handle.Append(suffix_offset_.data(), suffix_offset_.size() * sizeof(u32));
+        file_handle.Append(suffix_pool_.data(), suffix_pool_.size());
+    }
+
+    void ReadIndexInner(LocalFileHandle &file_handle) override {
+        const i64 file_size = file_handle.FileSize();
+        u64 magic = 0;
+        u32 version = 0;
+        const SizeT header_size = sizeof(magic) + sizeof(version);
+        if (file_size < 0 || static_cast<SizeT>(file_size) < header_size) {
+            RecoverableError(Status::NotSupport(fmt::format("Varchar secondary index chunk {} is truncated, drop and recreate the index.", file_handle.Path())));
+        }
+        ReadExact(file_handle, &magic, sizeof(magic));
+        if (magic != kVarcharIndexMagic) {
+            RecoverableError(Status::NotSupport(fmt::format(
+                "Varchar secondary index chunk {} was saved by an older version with hashed keys, drop and recreate the index.",
+                file_handle.Path())));
+        }
+        ReadExact(file_handle, &version, sizeof(version));
+        if (version != kVarcharIndexVersion) {
+            RecoverableError(Status::NotSupport(fmt::format("Varchar secondary index chunk {} has unsupported format version {}, expect {}.",
+                                                            file_handle.Path(),
+                                                            version,
+                                                            kVarcharIndexVersion)));
+        }
+        ReadExact(file_handle, key_ptr_, chunk_row_count_ * sizeof(OrderedKeyType));
+        ReadExact(file_handle, offset_ptr_, chunk_row_count_ * sizeof(SegmentOffset));
+        ReadExact(file_handle, suffix_offset_.data(), suffix_offset_.size() * sizeof(u32));
+        const SizeT pool_start = header_size + chunk_row_count_ * (sizeof(OrderedKeyType) + sizeof(SegmentOffset)) + suffix_offset_.size() * sizeof(u32);
+        if (suffix_offset_.front() != 0 || !std::is_sorted(suffix_offset_.begin(), suffix_offset_.end()) ||
+            pool_start + suffix_offset_.back() > static_cast<SizeT>(file_size)) {
+            RecoverableError(Status::NotSupport(fmt::format("Varchar secondary index chunk {} is corrupted, drop and recreate the index.", file_handle.Path())));
+        }
+        suffix_pool_.resize(suffix_offset_.back());
+        ReadExact(file_handle, suffix_pool_.data(), suffix_pool_.size());
+    }
+
+    void InsertData(const void *ptr) override {
+        auto map_ptr = static_cast<const MultiMap<String, u32> *>(ptr);
+        if (!map_ptr) {
+            UnrecoverableError("InsertData(): error: map_ptr type error.");
+        }
+        if (map_ptr->size() != chunk_row_count_) {
+            UnrecoverableError(fmt::format("InsertData(): error: map size: {} != chunk_row_count_: {}", map_ptr->size(), chunk_row_count_));
+        }
+        u32 i = 0;
+        for (const auto &[value, offset] : *map_ptr) {
+            AppendValue(i++, value, offset);
+        }
+    }
+
+    void InsertMergeData(const Vector<Pair<u32, BufferObj *>> &old_chunks) override {
+        SecondaryIndexChunkMerger<VarcharT> merger(old_chunks);
+        String value;
+        u32 offset = 0;
+        u32 i = 0;
+        while (merger.GetNextDataPair(value, offset)) {
+            if (i == chunk_row_count_) {
+                UnrecoverableError(fmt::format("InsertMergeData(): error: more than chunk_row_count_: {} rows", chunk_row_count_));
+            }
+            AppendValue(i++, value, offset);
+        }
+        if (i != chunk_row_count_) {
+            UnrecoverableError(fmt::format("InsertMergeData(): error: i: {} != chunk_row_count_: {}", i, chunk_row_count_));
+        }
+    }
+
+    String GetVarcharValue(const u32 i) const override {
+        const OrderedKeyType key = key_[i];
+        const u32 prefix_len = std::min<u32>(key & 0xFF, kVarcharKeyPrefixLen);
+        String value;
+        value.reserve(prefix_len + suffix_offset_[i + 1] - suffix_offset_[i]);
+        for (u32 j = 0; j < prefix_len; ++j) {
+            value.push_back(static_cast<char>((key >> (8 * (kVarcharKeyPrefixLen - j))) & 0xFF));
+        }
+        value.append(suffix_pool_, suffix_offset_[i], suffix_offset_[i + 1] - suffix_offset_[i]);
+        return value;
+    }
+
+private:
+    // values must be appended in order
+    void AppendValue(const u32 i, std::string_view value, const u32 offset) {
+        key_[i] = ConvertToOrderedKeyValue(value);
+        offset_[i] = offset;
+        if (value.size() > kVarcharKeyPrefixLen) {
+            suffix_pool_.append(value.substr(kVarcharKeyPrefixLen));
+        }
+        suffix_offset_[i + 1] = suffix_pool_.size();
+    }
+};
+
 SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type, const u32 chunk_row_count, const bool allocate) {
     if (!(data_type->CanBuildSecondaryIndex())) {
         UnrecoverableError(fmt::format("Cannot build secondary index on data type: {}", data_type->ToString()));
@@ -196,7 +359,7 @@ SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type,
             return new SecondaryIndexDataT<TimestampT>(chunk_row_count, allocate);
         }
         case LogicalType::kVarchar: {
-            return new SecondaryIndexDataT<VarcharT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataVarchar(chunk_row_count);
         }
         default: {
             UnrecoverableError(fmt::format("Need to add secondary index support for data type: {}", data_type->ToString()));
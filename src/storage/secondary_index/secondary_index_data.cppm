@@ -14,6 +14,8 @@
 
 module;
 
+#include <compare>
+
 export module secondary_index_data;
 
 import stl;
@@ -43,7 +45,7 @@ template <typename T>
 concept ConvertToOrderedI64 = IsAnyOf<T, DateTimeT, TimestampT>;
 
 template <typename T>
-concept ConvertToHashU64 = IsAnyOf<T, VarcharT, std::string_view>;
+concept ConvertToPrefixU64 = IsAnyOf<T, VarcharT, std::string_view>;
 
 template <typename ValueT>
 struct ConvertToOrdered;
@@ -63,13 +65,13 @@ struct ConvertToOrdered<T> {
     using type = i64;
 };
 
-template <ConvertToHashU64 T>
+template <ConvertToPrefixU64 T>
 struct ConvertToOrdered<T> {
     using type = u64;
 };
 
 export template <typename T>
-    requires KeepOrderedSelf<T> or ConvertToOrderedI32<T> or ConvertToOrderedI64<T> or ConvertToHashU64<T>
+    requires KeepOrderedSelf<T> or ConvertToOrderedI32<T> or ConvertToOrderedI64<T> or ConvertToPrefixU64<T>
 using ConvertToOrderedType = typename ConvertToOrdered<T>::type;
 
 export template <typename RawValueType>
@@ -94,12 +96,68 @@ ConvertToOrderedType<RawValueType> ConvertToOrderedKeyValue(RawValueType value)
     return value.GetEpochTime();
 }
 
+// Number of leading bytes of a varchar value stored in its key
+export constexpr u32 kVarcharKeyPrefixLen = 7;
+
 // for VarcharT
+// the leading bytes in big-endian order followed by min(length, kVarcharKeyPrefixLen + 1), so that the keys keep the order
+// of the values. Only values longer than kVarcharKeyPrefixLen with the same leading bytes share a key.
 export template <>
 ConvertToOrderedType<std::string_view> ConvertToOrderedKeyValue(std::string_view value) {
-    return std::hash<std::string_view>{}(value);
+    u64 key = 0;
+    for (u32 i = 0; i < kVarcharKeyPrefixLen; ++i) {
+        key = (key << 8) | (i < value.size() ? static_cast<u8>(value[i]) : 0);
+    }
+    return (key << 8) | std::min<u64>(value.size(), kVarcharKeyPrefixLen + 1);
 }
 
+// Inclusive bound of a varchar range query: right before a value, at a value, or above all values.
+export struct VarcharRangeBound {
+    enum class Kind : u8 {
+        kBefore,
+        kAt,
+    };
+
+    // value_ and kind_ are ignored when set
+    bool past_all_ = false;
+    String value_{};
+    Kind kind_ = Kind::kAt;
+
+    static VarcharRangeBound Lowest() { return At({}); }
+
+    static VarcharRangeBound Max() { return {true, {}, Kind::kAt}; }
+
+    static VarcharRangeBound At(String value) { return {false, std::move(value), Kind::kAt}; }
+
+    static VarcharRangeBound Before(String value) { return {false, std::move(value), Kind::kBefore}; }
+
+    // Right after all the values starting with prefix
+    static VarcharRangeBound PrefixEnd(String prefix) {
+        while (!prefix.empty() && static_cast<u8>(prefix.back()) == 0xFF) {
+            prefix.pop_back();
+        }
+        if (prefix.empty()) {
+            return Max();
+        }
+        prefix.back() = static_cast<char>(static_cast<u8>(prefix.back()) + 1);
+        return Before(std::move(prefix));
+    }
+
+    // < 0, 0 or > 0 when the value is below, at or above the bound
+    [[nodiscard]] i32 CompareValue(std::string_view value) const {
+        if (past_all_) {
+            return -1;
+        }
+        const i32 cmp = value.compare(value_);
+        if (kind_ == Kind::kBefore) {
+            return cmp < 0 ? -1 : 1;
+        }
+        return cmp;
+    }
+
+    friend auto operator<=>(const VarcharRangeBound &, const VarcharRangeBound &) = default;
+};
+
 export template <typename T>
 constexpr LogicalType GetLogicalType = LogicalType::kInvalid;
 
@@ -168,6 +226,12 @@ public:
     virtual void InsertData(const void *ptr) = 0;
 
     virtual void InsertMergeData(const Vector<Pair<u32, BufferObj *>> &old_chunks) = 0;
+
+    // Full value of the i-th key, only for varchar index
+    [[nodiscard]] virtual String GetVarcharValue(u32 i) const {
+        UnrecoverableError("GetVarcharValue(): not a varchar index.");
+        return {};
+    }
 };
 
 export SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type, u32 chunk_row_count, bool allocate);
@@ -40,9 +40,12 @@ namespace infinity {
 
 constexpr u32 map_memory_bloat_factor = 3;
 
+// varchar values are kept in full, so that range queries on them are exact
 template <typename RawValueType>
 class SecondaryIndexInMemT final : public SecondaryIndexInMem {
-    using KeyType = ConvertToOrderedType<RawValueType>;
+    static constexpr bool kIsVarchar = std::is_same_v<RawValueType, VarcharT>;
+    using KeyType = std::conditional_t<kIsVarchar, String, ConvertToOrderedType<RawValueType>>;
+    using RangeKeyType = std::conditional_t<kIsVarchar, VarcharRangeBound, KeyType>;
     const RowID begin_row_id_;
     mutable std::shared_mutex map_mutex_;
     MultiMap<KeyType, u32> in_mem_secondary_index_;
@@ -74,7 +77,7 @@ public:
         data_ptr->InsertData(&in_mem_secondary_index_);
     }
     Pair<u32, Bitmask> RangeQuery(const void *input) const override {
-        const auto &[segment_row_count, b, e] = *static_cast<const std::tuple<u32, KeyType, KeyType> *>(input);
+        const auto &[segment_row_count, b, e] = *static_cast<const std::tuple<u32, RangeKeyType, RangeKeyType> *>(input);
         return RangeQueryInner(segment_row_count, b, e);
     }
 
@@ -88,11 +91,10 @@ private:
                 break;
             }
             const auto &[v_ptr, offset] = opt.value();
-            if constexpr (std::is_same_v<RawValueType, VarcharT>) {
+            if constexpr (kIsVarchar) {
                 auto column_vector = iter.column_vector();
                 Span<const char> data = column_vector->GetVarcharInner(*v_ptr);
-                const KeyType key = ConvertToOrderedKeyValue(std::string_view{data.data(), data.size()});
-                in_mem_secondary_index_.emplace(key, offset);
+                in_mem_secondary_index_.emplace(String(data.data(), data.size()), offset);
             } else {
                 const KeyType key = ConvertToOrderedKeyValue(*v_ptr);
                 in_mem_secondary_index_.emplace(key, offset);
@@ -102,10 +104,26 @@ private:
         return inserted_count;
     }
 
-    Pair<u32, Bitmask> RangeQueryInner(const u32 segment_row_count, const KeyType b, const KeyType e) const {
+    Pair<u32, Bitmask> RangeQueryInner(const u32 segment_row_count, const RangeKeyType &b, const RangeKeyType &e) const {
         std::shared_lock lock(map_mutex_);
-        const auto begin = in_mem_secondary_index_.lower_bound(b);
-        const auto end = in_mem_secondary_index_.upper_bound(e);
+        auto begin = in_mem_secondary_index_.end();
+        auto end = in_mem_secondary_index_.end();
+        if constexpr (kIsVarchar) {
+            // begin is the first value not below b, end the first value above e
+            if (!b.past_all_) {
+                begin = in_mem_secondary_index_.lower_bound(b.value_);
+            }
+            if (!e.past_all_) {
+                end = e.kind_ == VarcharRangeBound::Kind::kAt ? in_mem_secondary_index_.upper_bound(e.value_)
+                                                              : in_mem_secondary_index_.lower_bound(e.value_);
+            }
+            if (b > e) {
+                end = begin;
+            }
+        } else {
+            begin = in_mem_secondary_index_.lower_bound(b);
+            end = in_mem_secondary_index_.upper_bound(e);
+        }
         const u32 result_size = std::distance(begin, end);
         Pair<u32, Bitmask> result_var(result_size, Bitmask(segment_row_count));
         result_var.second.SetAllFalse();
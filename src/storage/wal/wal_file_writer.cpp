@@ -0,0 +1,155 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/falloc.h>
+#endif
+
+module wal_file_writer;
+
+import stl;
+import third_party;
+import infinity_exception;
+import logger;
+
+namespace infinity {
+
+WalFileWriter::WalFileWriter(SizeT preallocate_size) : preallocate_size_(preallocate_size) {}
+
+WalFileWriter::~WalFileWriter() {
+    if (IsOpen()) {
+        Close(true);
+    }
+}
+
+void WalFileWriter::Open(const String &path) {
+    std::lock_guard lock(mutex_);
+    if (fd_ != -1) {
+        String error_message = fmt::format("Open wal file: {}, while {} is still open", path, path_);
+        UnrecoverableError(error_message);
+    }
+    i32 fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0666);
+    if (fd == -1) {
+        String error_message = fmt::format("Failed to open wal file: {}, error: {}", path, strerror(errno));
+        UnrecoverableError(error_message);
+    }
+    struct stat st {};
+    if (fstat(fd, &st) == -1) {
+        close(fd);
+        String error_message = fmt::format("Failed to stat wal file: {}, error: {}", path, strerror(errno));
+        UnrecoverableError(error_message);
+    }
+    fd_ = fd;
+    path_ = path;
+    preallocated_end_ = st.st_size;
+    written_offset_ = st.st_size;
+    synced_offset_ = st.st_size;
+    Preallocate(st.st_size);
+}
+
+void WalFileWriter::Close(bool sync) {
+    std::lock_guard lock(mutex_);
+    if (fd_ == -1) {
+        return;
+    }
+    if (sync) {
+        SyncLocked();
+    }
+    if (close(fd_) == -1) {
+        String error_message = fmt::format("Close wal file: {}, error: {}", path_, strerror(errno));
+        UnrecoverableError(error_message);
+    }
+    fd_ = -1;
+    path_.clear();
+}
+
+bool WalFileWriter::IsOpen() const {
+    std::lock_guard lock(mutex_);
+    return fd_ != -1;
+}
+
+void WalFileWriter::Write(const char *data, SizeT size) {
+    // Only the flush thread writes and reopens the file, so fd_ doesn't change here.
+    u64 offset = written_offset_.load();
+    if (offset + size > preallocated_end_) {
+        Preallocate(offset + size);
+    }
+    while (size > 0) {
+        ssize_t written = write(fd_, data, size);
+        if (written == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            String error_message = fmt::format("Write wal file: {}, error: {}", path_, strerror(errno));
+            UnrecoverableError(error_message);
+        }
+        data += written;
+        size -= written;
+        offset += written;
+        written_offset_ = offset;
+    }
+}
+
+void WalFileWriter::Sync() {
+    std::lock_guard lock(mutex_);
+    SyncLocked();
+}
+
+void WalFileWriter::SyncLocked() {
+    if (fd_ == -1) {
+        return;
+    }
+    u64 written_offset = written_offset_.load();
+    if (written_offset == synced_offset_.load()) {
+        return;
+    }
+    i32 ret = 0;
+    do {
+#if defined(__APPLE__)
+        ret = fcntl(fd_, F_FULLFSYNC);
+#else
+        ret = fdatasync(fd_);
+#endif
+    } while (ret == -1 && errno == EINTR);
+    if (ret == -1) {
+        String error_message = fmt::format("Sync wal file: {}, error: {}", path_, strerror(errno));
+        UnrecoverableError(error_message);
+    }
+    synced_offset_ = written_offset;
+    ++sync_count_;
+}
+
+void WalFileWriter::Preallocate(u64 end_offset) {
+    if (preallocate_size_ == 0) {
+        preallocated_end_ = std::max(preallocated_end_, end_offset);
+        return;
+    }
+    u64 new_end = (end_offset / preallocate_size_ + 1) * preallocate_size_;
+#if defined(__linux__)
+    // Keep the file size, so the space beyond the written data is never read as entries.
+    if (fallocate(fd_, FALLOC_FL_KEEP_SIZE, preallocated_end_, new_end - preallocated_end_) == -1) {
+        LOG_DEBUG(fmt::format("Preallocate wal file: {}, error: {}", path_, strerror(errno)));
+    }
+#endif
+    preallocated_end_ = new_end;
+}
+
+} // namespace infinity
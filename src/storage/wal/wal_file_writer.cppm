@@ -0,0 +1,69 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module wal_file_writer;
+
+import stl;
+
+namespace infinity {
+
+// Append-only writer of the current WAL file on a raw file descriptor, so a write goes to the OS at once and Sync() is a real
+// fdatasync. Disk space is reserved a segment ahead without changing the file size, the WAL is read backward from its end on replay.
+// Write is called by the flush thread only, Sync may also be called by the background sync thread.
+export class WalFileWriter {
+public:
+    explicit WalFileWriter(SizeT preallocate_size);
+
+    ~WalFileWriter();
+
+    void Open(const String &path);
+
+    // Sync the written data if sync is true.
+    void Close(bool sync);
+
+    [[nodiscard]] bool IsOpen() const;
+
+    void Write(const char *data, SizeT size);
+
+    // fdatasync the file if anything is written since the last sync. A failed sync is unrecoverable, since the kernel may have
+    // dropped the dirty pages.
+    void Sync();
+
+    [[nodiscard]] inline u64 WrittenSize() const { return written_offset_.load(); }
+
+    [[nodiscard]] inline u64 SyncedSize() const { return synced_offset_.load(); }
+
+    [[nodiscard]] inline u64 SyncCount() const { return sync_count_.load(); }
+
+private:
+    void Preallocate(u64 end_offset);
+
+    void SyncLocked();
+
+private:
+    const SizeT preallocate_size_{};
+
+    mutable std::mutex mutex_{};
+    i32 fd_{-1};
+    String path_{};
+    u64 preallocated_end_{};
+
+    Atomic<u64> written_offset_{};
+    Atomic<u64> synced_offset_{};
+    Atomic<u64> sync_count_{};
+};
+
+} // namespace infinity
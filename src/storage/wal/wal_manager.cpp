@@ -14,8 +14,8 @@
 
 module;
 
+#include <chrono>
 #include <filesystem>
-#include <fstream>
 #include <thread>
 
 import stl;
@@ -50,6 +50,9 @@ import meta_info;
 import wal_entry;
 import block_index;
 import bottom_executor;
+import config;
+import options;
+import wal_file_writer;
 
 module wal_manager;
 
@@ -91,15 +94,18 @@ void WalManager::Start() {
         VirtualStore::MakeDirectory(wal_dir_);
     }
     // TODO: recovery from wal checkpoint
-    ofs_ = std::ofstream(wal_path_, std::ios::app | std::ios::binary);
-    if (!ofs_.is_open()) {
-        String error_message = fmt::format("Failed to open wal file: {}", wal_path_);
-        UnrecoverableError(error_message);
-    }
-    LOG_INFO(fmt::format("Open wal file: {}", wal_path_));
+    wal_writer_.Open(wal_path_);
+    LOG_INFO(fmt::format("Open wal file: {}, flush option: {}", wal_path_, FlushOptionTypeToString(flush_option_)));
+
+    Config *config = storage_->config();
+    group_commit_delay_ = std::chrono::microseconds(config->WALGroupCommitDelay());
+    group_commit_max_batch_ = config->WALGroupCommitMaxBatch();
 
     wal_size_ = 0;
     new_flush_thread_ = Thread([this] { NewFlush(); });
+    if (flush_option_ == FlushOptionType::kFlushPerSecond) {
+        sync_thread_ = Thread([this] { SyncPerSecond(); });
+    }
     // checkpoint_thread_ = Thread([this] { CheckpointTimer(); });
 
     bottom_executor_ = MakeUnique<BottomExecutor>();
@@ -133,7 +139,15 @@ void WalManager::Stop() {
     LOG_TRACE("Stop the new flush thread");
     new_flush_thread_.join();
 
-    ofs_.close();
+    if (sync_thread_.joinable()) {
+        {
+            std::lock_guard lock(sync_mutex_);
+        }
+        sync_cv_.notify_all();
+        sync_thread_.join();
+    }
+
+    wal_writer_.Close(flush_option_ != FlushOptionType::kOnlyWrite);
     LOG_INFO("WAL manager is stopped.");
 }
 
@@ -274,6 +288,20 @@ void WalManager::NewFlush() {
             continue;
         }
 
+        if (flush_option_ == FlushOptionType::kFlushAtOnce && group_commit_delay_.count() > 0) {
+            // Group commit: the transactions arriving within the delay share one fdatasync.
+            auto deadline = std::chrono::steady_clock::now() + group_commit_delay_;
+            while (txn_batch.size() < group_commit_max_batch_ && txn_batch.back() != nullptr) {
+                auto now = std::chrono::steady_clock::now();
+                if (now >= deadline) {
+                    break;
+                }
+                if (!new_wait_flush_.TryDequeueBulkWait(txn_batch, std::chrono::duration_cast<std::chrono::microseconds>(deadline - now))) {
+                    break;
+                }
+            }
+        }
+
         for (const auto &txn : txn_batch) {
             if (txn == nullptr) {
                 // terminate entry
@@ -324,7 +352,7 @@ void WalManager::NewFlush() {
                                                    entry->ToString());
                 UnrecoverableError(error_message);
             }
-            ofs_.write(buf->data(), ptr - buf->data());
+            wal_writer_.Write(buf->data(), ptr - buf->data());
 
             if (InfinityContext::instance().GetServerRole() == NodeRole::kLeader) {
                 if (cluster_manager == nullptr) {
@@ -342,20 +370,8 @@ void WalManager::NewFlush() {
             break;
         }
 
-        switch (flush_option_) {
-            case FlushOptionType::kFlushAtOnce: {
-                ofs_.flush();
-                break;
-            }
-            case FlushOptionType::kOnlyWrite: {
-                ofs_.flush(); // FIXME: not flush, only write
-                break;
-            }
-            case FlushOptionType::kFlushPerSecond: {
-                ofs_.flush(); // FIXME: not flush, flush per second
-                break;
-            }
-        }
+        // The transactions are committed below only after their batch is as durable as the flush option promises.
+        SyncWal();
 
         if (InfinityContext::instance().GetServerRole() == NodeRole::kLeader) {
             cluster_manager->SyncLogs();
@@ -370,7 +386,7 @@ void WalManager::NewFlush() {
 
         // Check if the wal file is too large, swap to a new one.
         try {
-            auto file_size = VirtualStore::GetFileSize(wal_path_);
+            auto file_size = wal_writer_.WrittenSize();
             if (file_size > cfg_wal_size_threshold_) {
                 LOG_INFO(fmt::format("WAL size: {} is larger than threshold: {}", file_size, cfg_wal_size_threshold_));
                 this->SwapWalFile(max_commit_ts_, true);
@@ -432,9 +448,36 @@ void WalManager::FlushLogByReplication(const Vector<String> &synced_logs, bool o
     }
 
     for (const String &synced_log : synced_logs) {
-        ofs_.write(synced_log.c_str(), synced_log.size());
+        wal_writer_.Write(synced_log.c_str(), synced_log.size());
     }
-    ofs_.flush();
+    SyncWal();
+}
+
+void WalManager::SyncWal() {
+    switch (flush_option_) {
+        case FlushOptionType::kFlushAtOnce: {
+            wal_writer_.Sync();
+            break;
+        }
+        case FlushOptionType::kOnlyWrite: {
+            // Already in the page cache, the OS decides when to write it back.
+            break;
+        }
+        case FlushOptionType::kFlushPerSecond: {
+            // Synced by the sync thread.
+            break;
+        }
+    }
+}
+
+void WalManager::SyncPerSecond() {
+    LOG_TRACE("WalManager::SyncPerSecond begin");
+    std::unique_lock lock(sync_mutex_);
+    while (running_.load()) {
+        sync_cv_.wait_for(lock, std::chrono::seconds(1), [this] { return !running_.load(); });
+        wal_writer_.Sync();
+    }
+    LOG_TRACE("WalManager::SyncPerSecond end");
 }
 
 bool WalManager::SetCheckpointing() {
@@ -504,9 +547,7 @@ void WalManager::SwapWalFile(const TxnTimeStamp max_commit_ts, bool error_if_dup
         return;
     }
 
-    if (ofs_.is_open()) {
-        ofs_.close();
-    }
+    wal_writer_.Close(flush_option_ != FlushOptionType::kOnlyWrite);
 
     String new_file_path = fmt::format("{}/{}", wal_dir_, WalFile::WalFilename(max_commit_ts));
     LOG_INFO(fmt::format("Wal {} swap to new path: {}, error_if_duplicate: {}", wal_path_, new_file_path, error_if_duplicate));
@@ -530,11 +571,7 @@ void WalManager::SwapWalFile(const TxnTimeStamp max_commit_ts, bool error_if_dup
     }
 
     // Create a new wal file with the original name.
-    ofs_ = std::ofstream(wal_path_, std::ios::app | std::ios::binary);
-    if (!ofs_.is_open()) {
-        String error_message = fmt::format("Failed to open wal file: {}", wal_path_);
-        UnrecoverableError(error_message);
-    }
+    wal_writer_.Open(wal_path_);
 
     last_swap_wal_ts_ = max_commit_ts;
     LOG_INFO(fmt::format("Open new wal file {}", wal_path_));
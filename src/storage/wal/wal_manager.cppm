@@ -18,8 +18,10 @@ export module wal_manager;
 
 import stl;
 import options;
+import default_values;
 import blocking_queue;
 import log_file;
+import wal_file_writer;
 
 namespace infinity {
 
@@ -83,6 +85,8 @@ public:
 
     void FlushLogByReplication(const Vector<String> &synced_logs, bool on_startup);
 
+    [[nodiscard]] inline const WalFileWriter &wal_writer() const { return wal_writer_; }
+
     bool SetCheckpointing();
     bool UnsetCheckpoint();
     bool IsCheckpointing() const;
@@ -111,6 +115,12 @@ public:
 private:
     i64 GetLastCkpWalSize();
 
+    // Make the written entries durable as the flush option requires.
+    void SyncWal();
+
+    // Background sync of kFlushPerSecond
+    void SyncPerSecond();
+
 public:
     u64 cfg_wal_size_threshold_{};
 
@@ -133,11 +143,18 @@ private:
     // TxnManager and Flush thread access following members
     BlockingQueue<NewTxn *> new_wait_flush_{"WalManager"};
 
-    // Only Flush thread access following members
-    std::ofstream ofs_{};
+    // Only Flush thread writes, the sync thread of kFlushPerSecond also syncs.
+    WalFileWriter wal_writer_{WAL_PREALLOCATE_SIZE};
     FlushOptionType flush_option_{FlushOptionType::kOnlyWrite};
+    // Group commit: wait up to the delay for more transactions unless max batch transactions are waiting.
+    std::chrono::microseconds group_commit_delay_{};
+    SizeT group_commit_max_batch_{};
     UniquePtr<BottomExecutor> bottom_executor_{nullptr};
 
+    Thread sync_thread_{};
+    std::mutex sync_mutex_{};
+    std::condition_variable sync_cv_{};
+
     // Flush and Checkpoint threads access following members
     mutable std::mutex mutex2_{};
     TxnTimeStamp max_commit_ts_{};
@@ -0,0 +1,46 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import smallfloat;
+
+using namespace infinity;
+class SmallFloatTest : public BaseTest {};
+
+TEST_F(SmallFloatTest, int_to_byte4_round_trip) {
+    for (u32 b = 0; b < 256; ++b) {
+        const u32 value = SmallFloat::Byte4ToInt(static_cast<u8>(b));
+        EXPECT_EQ(SmallFloat::IntToByte4(value), b);
+        if (b > 0) {
+            EXPECT_GT(value, SmallFloat::Byte4ToInt(static_cast<u8>(b - 1)));
+        }
+    }
+}
+
+TEST_F(SmallFloatTest, int_to_byte4_rounds_up) {
+    for (u32 i = 0; i < SmallFloat::NUM_FREE_VALUES; ++i) {
+        EXPECT_EQ(SmallFloat::Byte4ToInt(SmallFloat::IntToByte4(i)), i);
+    }
+    for (u32 i = 0; i < 1000000; ++i) {
+        const u8 b = SmallFloat::IntToByte4(i);
+        EXPECT_GE(SmallFloat::Byte4ToInt(b), i);
+        if (b > 0) {
+            EXPECT_LT(SmallFloat::Byte4ToInt(b - 1), i);
+        }
+    }
+    EXPECT_EQ(SmallFloat::IntToByte4(std::numeric_limits<u32>::max()), 255);
+}
@@ -34,6 +34,8 @@ import base_expression;
 import value_expression;
 import reference_expression;
 import function_expression;
+import in_expression;
+import case_expression;
 import column_vector;
 import expression_state;
 import value;
@@ -265,3 +267,140 @@ TEST_F(ExpressionEvaluatorTest, subtract_constant_8192_bigint) {
         }
     }
 }
+
+namespace {
+
+// Evaluate `c1 IN (values)` or NOT IN over one column, returns the result of every row.
+Vector<bool> EvaluateIn(InType in_type, const SharedPtr<ColumnVector> &column, const Vector<Value> &values) {
+    SharedPtr<DataType> data_type = column->data_type();
+    SharedPtr<ReferenceExpression> col_expr = ReferenceExpression::Make(*data_type, "t1", "c1", String(), 0);
+    Vector<SharedPtr<BaseExpression>> arguments;
+    for (const auto &value : values) {
+        arguments.emplace_back(MakeShared<ValueExpression>(value));
+    }
+    auto in_expr = MakeShared<InExpression>(in_type, col_expr, arguments);
+    for (auto value : values) {
+        in_expr->TryPut(std::move(value));
+    }
+    SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(in_expr);
+
+    SharedPtr<DataBlock> input_data_block = DataBlock::Make();
+    input_data_block->Init({column});
+    SharedPtr<ColumnVector> output_column_vector = ColumnVector::Make(MakeShared<DataType>(LogicalType::kBoolean));
+    output_column_vector->Initialize();
+
+    ExpressionEvaluator expr_evaluator;
+    expr_evaluator.Init(input_data_block.get());
+    SharedPtr<BaseExpression> expr = in_expr;
+    expr_evaluator.Execute(expr, expr_state, output_column_vector);
+
+    Vector<bool> result;
+    for (SizeT row_id = 0; row_id < column->Size(); ++row_id) {
+        result.push_back(output_column_vector->buffer_->GetCompactBit(row_id));
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_F(ExpressionEvaluatorTest, in_bigint) {
+    SizeT row_count = 1000;
+    SharedPtr<ColumnVector> column = ColumnVector::Make(MakeShared<DataType>(LogicalType::kBigInt));
+    column->Initialize(ColumnVectorType::kFlat, row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        column->AppendValue(Value::MakeBigInt(static_cast<BigIntT>(i)));
+    }
+
+    // a short list is compared directly, a long one is hashed
+    for (SizeT list_size : {3, 100}) {
+        Vector<Value> values;
+        for (SizeT i = 0; i < list_size; ++i) {
+            values.push_back(Value::MakeBigInt(static_cast<BigIntT>(i * 7 + 1)));
+        }
+        Vector<bool> in_result = EvaluateIn(InType::kIn, column, values);
+        Vector<bool> not_in_result = EvaluateIn(InType::kNotIn, column, values);
+        for (SizeT i = 0; i < row_count; ++i) {
+            bool expected = i % 7 == 1 && i / 7 < list_size;
+            EXPECT_EQ(in_result[i], expected);
+            EXPECT_EQ(not_in_result[i], !expected);
+        }
+    }
+}
+
+TEST_F(ExpressionEvaluatorTest, in_varchar) {
+    SizeT row_count = 100;
+    SharedPtr<ColumnVector> column = ColumnVector::Make(MakeShared<DataType>(LogicalType::kVarchar));
+    column->Initialize(ColumnVectorType::kFlat, row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        // short strings are inlined, long ones are not
+        column->AppendValue(Value::MakeVarchar(fmt::format("tenant_{}_{}", i, String(i % 3 * 10, 'x'))));
+    }
+    Vector<Value> values;
+    for (SizeT i = 0; i < row_count; i += 5) {
+        values.push_back(Value::MakeVarchar(fmt::format("tenant_{}_{}", i, String(i % 3 * 10, 'x'))));
+    }
+    values.push_back(Value::MakeVarchar("tenant_1_"));
+    Vector<bool> in_result = EvaluateIn(InType::kIn, column, values);
+    for (SizeT i = 0; i < row_count; ++i) {
+        EXPECT_EQ(in_result[i], i % 5 == 0);
+    }
+}
+
+TEST_F(ExpressionEvaluatorTest, case_when_varchar) {
+    SizeT row_count = 1000;
+    SharedPtr<ColumnVector> id_column = ColumnVector::Make(MakeShared<DataType>(LogicalType::kBigInt));
+    id_column->Initialize(ColumnVectorType::kFlat, row_count);
+    SharedPtr<ColumnVector> name_column = ColumnVector::Make(MakeShared<DataType>(LogicalType::kVarchar));
+    name_column->Initialize(ColumnVectorType::kFlat, row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        id_column->AppendValue(Value::MakeBigInt(static_cast<BigIntT>(i)));
+        name_column->AppendValue(Value::MakeVarchar(fmt::format("name_{}_{}", i, String(i % 2 * 20, 'x'))));
+    }
+
+    // CASE WHEN c1 IN (0, 3, 6, ...) THEN c2 WHEN c1 IN (1, 6, 11, ...) THEN 'five' END
+    auto make_when = [&](SizeT step, SizeT offset) {
+        SharedPtr<ReferenceExpression> col_expr = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 0);
+        Vector<SharedPtr<BaseExpression>> arguments;
+        Vector<Value> values;
+        for (SizeT i = offset; i < row_count; i += step) {
+            values.push_back(Value::MakeBigInt(static_cast<BigIntT>(i)));
+            arguments.emplace_back(MakeShared<ValueExpression>(values.back()));
+        }
+        auto in_expr = MakeShared<InExpression>(InType::kIn, col_expr, arguments);
+        for (auto &value : values) {
+            in_expr->TryPut(std::move(value));
+        }
+        return in_expr;
+    };
+    auto case_expr = MakeShared<CaseExpression>();
+    case_expr->AddCaseCheck(make_when(3, 0), ReferenceExpression::Make(DataType(LogicalType::kVarchar), "t1", "c2", String(), 1));
+    case_expr->AddCaseCheck(make_when(5, 1), MakeShared<ValueExpression>(Value::MakeVarchar("five")));
+    case_expr->AddElseExpr(MakeShared<ValueExpression>(Value::MakeNull()));
+    case_expr->SetReturnType(DataType(LogicalType::kVarchar));
+    SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(case_expr);
+
+    SharedPtr<DataBlock> input_data_block = DataBlock::Make();
+    input_data_block->Init({id_column, name_column});
+    SharedPtr<ColumnVector> output_column_vector = expr_state->OutputColumnVector();
+    EXPECT_EQ(output_column_vector->vector_type(), ColumnVectorType::kFlat);
+
+    ExpressionEvaluator expr_evaluator;
+    expr_evaluator.Init(input_data_block.get());
+    SharedPtr<BaseExpression> expr = case_expr;
+    // the output vector is reused by the next block
+    for (SizeT round = 0; round < 2; ++round) {
+        expr_evaluator.Execute(expr, expr_state, output_column_vector);
+        EXPECT_EQ(output_column_vector->Size(), row_count);
+        for (SizeT i = 0; i < row_count; ++i) {
+            if (i % 3 == 0) {
+                EXPECT_TRUE(output_column_vector->nulls_ptr_->IsTrue(i));
+                EXPECT_EQ(output_column_vector->GetValue(i).GetVarchar(), fmt::format("name_{}_{}", i, String(i % 2 * 20, 'x')));
+            } else if (i % 5 == 1) {
+                EXPECT_TRUE(output_column_vector->nulls_ptr_->IsTrue(i));
+                EXPECT_EQ(output_column_vector->GetValue(i).GetVarchar(), "five");
+            } else {
+                EXPECT_FALSE(output_column_vector->nulls_ptr_->IsTrue(i));
+            }
+        }
+    }
+}
@@ -0,0 +1,184 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import external_sort;
+import column_vector;
+import data_block;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import select_statement;
+import default_values;
+import third_party;
+
+using namespace infinity;
+
+class ExternalSortTest : public BaseTest {};
+
+namespace {
+
+Vector<String> EncodeKeys(const SortKeyEncoder &encoder, const DataBlock &data_block) {
+    Vector<char> keys;
+    Vector<u32> key_offsets{0};
+    encoder.Encode(data_block.column_vectors, data_block.row_count(), keys, key_offsets);
+    Vector<String> result;
+    for (SizeT row = 0; row < data_block.row_count(); ++row) {
+        result.emplace_back(keys.data() + key_offsets[row], key_offsets[row + 1] - key_offsets[row]);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_F(ExternalSortTest, encode_order) {
+    Vector<SharedPtr<DataType>> types{MakeShared<DataType>(LogicalType::kBigInt),
+                                      MakeShared<DataType>(LogicalType::kDouble),
+                                      MakeShared<DataType>(LogicalType::kVarchar)};
+    auto data_block = DataBlock::MakeUniquePtr();
+    data_block->Init(types);
+    Vector<Tuple<i64, double, String>> rows{{-5, 1.5, "b"},
+                                            {-5, -0.0, "b"},
+                                            {-5, 0.0, "a"},
+                                            {3, -2.5, "ab"},
+                                            {3, -2.5, "a"},
+                                            {3, -2.5, String("a\0b", 3)},
+                                            {1000, 1e10, ""}};
+    for (const auto &[i, d, s] : rows) {
+        data_block->column_vectors[0]->AppendValue(Value::MakeBigInt(i));
+        data_block->column_vectors[1]->AppendValue(Value::MakeDouble(d));
+        data_block->column_vectors[2]->AppendValue(Value::MakeVarchar(s));
+    }
+    data_block->Finalize();
+    data_block->column_vectors[0]->nulls_ptr_->SetFalse(6);
+
+    SortKeyEncoder asc_encoder(types, {OrderType::kAsc, OrderType::kAsc, OrderType::kAsc});
+    Vector<String> keys = EncodeKeys(asc_encoder, *data_block);
+    // -0.0 equals 0.0, so the varchar decides.
+    EXPECT_LT(keys[2], keys[1]);
+    EXPECT_LT(keys[1], keys[0]);
+    EXPECT_LT(keys[0], keys[3]);
+    EXPECT_LT(keys[4], keys[5]);
+    EXPECT_LT(keys[5], keys[3]);
+    // Null sorts last in ascending order.
+    EXPECT_LT(keys[3], keys[6]);
+
+    SortKeyEncoder desc_encoder(types, {OrderType::kDesc, OrderType::kAsc, OrderType::kDesc});
+    keys = EncodeKeys(desc_encoder, *data_block);
+    EXPECT_LT(keys[6], keys[3]);
+    EXPECT_LT(keys[3], keys[5]);
+    EXPECT_LT(keys[5], keys[4]);
+    EXPECT_LT(keys[4], keys[1]);
+    EXPECT_LT(keys[1], keys[0]);
+    EXPECT_LT(keys[1], keys[2]);
+}
+
+TEST_F(ExternalSortTest, spill_and_merge) {
+    Vector<SharedPtr<DataType>> types{MakeShared<DataType>(LogicalType::kInteger), MakeShared<DataType>(LogicalType::kVarchar)};
+    // A tiny memory limit spills every run.
+    ExternalSorter sorter({types[0]}, {OrderType::kDesc}, 1, String(GetFullTmpDir()) + "/external_sort");
+
+    constexpr SizeT run_count = 5;
+    constexpr SizeT block_count = 3;
+    constexpr SizeT row_count = 5000;
+    SizeT total_rows = 0;
+    for (SizeT run = 0; run < run_count; ++run) {
+        Vector<UniquePtr<DataBlock>> blocks;
+        Vector<Vector<SharedPtr<ColumnVector>>> key_columns;
+        for (SizeT block = 0; block < block_count; ++block) {
+            auto data_block = DataBlock::MakeUniquePtr();
+            data_block->Init(types);
+            for (SizeT row = 0; row < row_count; ++row) {
+                i32 key = (run * 7919 + block * 104729 + row * 31) % 20011;
+                data_block->column_vectors[0]->AppendValue(Value::MakeInt(key));
+                data_block->column_vectors[1]->AppendValue(Value::MakeVarchar(fmt::format("value_{}", key)));
+            }
+            data_block->Finalize();
+            key_columns.push_back({data_block->column_vectors[0]});
+            blocks.push_back(std::move(data_block));
+            total_rows += row_count;
+        }
+        sorter.AddRun(std::move(blocks), key_columns);
+    }
+    EXPECT_EQ(sorter.RunCount(), run_count);
+    EXPECT_EQ(sorter.SpilledRunCount(), run_count);
+
+    Vector<UniquePtr<DataBlock>> output_blocks;
+    sorter.Merge(output_blocks);
+    EXPECT_EQ(sorter.RunCount(), 0u);
+
+    SizeT output_rows = 0;
+    i32 prev_key = std::numeric_limits<i32>::max();
+    for (const auto &output_block : output_blocks) {
+        EXPECT_LE(output_block->row_count(), DEFAULT_VECTOR_SIZE);
+        for (SizeT row = 0; row < output_block->row_count(); ++row) {
+            i32 key = output_block->GetValue(0, row).GetValue<IntegerT>();
+            EXPECT_LE(key, prev_key);
+            EXPECT_EQ(output_block->GetValue(1, row).GetVarchar(), fmt::format("value_{}", key));
+            prev_key = key;
+        }
+        output_rows += output_block->row_count();
+    }
+    EXPECT_EQ(output_rows, total_rows);
+}
+
+TEST_F(ExternalSortTest, merge_in_steps) {
+    Vector<SharedPtr<DataType>> types{MakeShared<DataType>(LogicalType::kBigInt)};
+    ExternalSorter sorter(types, {OrderType::kAsc}, 1, String(GetFullTmpDir()) + "/external_sort");
+
+    constexpr SizeT run_count = 3;
+    constexpr SizeT block_capacity = DEFAULT_BLOCK_CAPACITY;
+    constexpr SizeT row_count = 3 * block_capacity;
+    for (SizeT run = 0; run < run_count; ++run) {
+        Vector<UniquePtr<DataBlock>> blocks;
+        Vector<Vector<SharedPtr<ColumnVector>>> key_columns;
+        for (SizeT block = 0; block < row_count / block_capacity; ++block) {
+            auto data_block = DataBlock::MakeUniquePtr();
+            data_block->Init(types);
+            for (SizeT row = 0; row < block_capacity; ++row) {
+                i64 key = (block * block_capacity + row) * run_count + run;
+                data_block->column_vectors[0]->AppendValue(Value::MakeBigInt(key));
+            }
+            data_block->Finalize();
+            key_columns.push_back({data_block->column_vectors[0]});
+            blocks.push_back(std::move(data_block));
+        }
+        sorter.AddRun(std::move(blocks), key_columns);
+    }
+    EXPECT_EQ(sorter.SpilledRunCount(), run_count);
+
+    // One block per step, the merge keeps its position between the steps.
+    SizeT step_count = 0;
+    i64 expect_key = 0;
+    bool finished = false;
+    while (!finished) {
+        Vector<UniquePtr<DataBlock>> output_blocks;
+        finished = sorter.MergeNext(output_blocks, 1);
+        EXPECT_LE(output_blocks.size(), 1u);
+        for (const auto &output_block : output_blocks) {
+            for (SizeT row = 0; row < output_block->row_count(); ++row) {
+                EXPECT_EQ(output_block->GetValue(0, row).GetValue<BigIntT>(), expect_key);
+                ++expect_key;
+            }
+        }
+        ++step_count;
+    }
+    EXPECT_EQ(expect_key, i64(run_count * row_count));
+    EXPECT_GE(step_count, run_count * row_count / block_capacity);
+    EXPECT_EQ(sorter.RunCount(), 0u);
+}
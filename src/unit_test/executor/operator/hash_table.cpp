@@ -0,0 +1,171 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import hash_table;
+import column_vector;
+import data_block;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+
+using namespace infinity;
+
+class HashTableTest : public BaseTest {};
+
+TEST_F(HashTableTest, bigint_and_null_key) {
+    HashTable hash_table;
+    hash_table.Init({MakeShared<DataType>(LogicalType::kBigInt), MakeShared<DataType>(LogicalType::kInteger)});
+
+    auto data_block = DataBlock::MakeUniquePtr();
+    data_block->Init({MakeShared<DataType>(LogicalType::kBigInt), MakeShared<DataType>(LogicalType::kInteger)});
+    constexpr SizeT row_count = 1000;
+    for (SizeT row = 0; row < row_count; ++row) {
+        data_block->column_vectors[0]->AppendValue(Value::MakeBigInt(row % 100));
+        data_block->column_vectors[1]->AppendValue(Value::MakeInt(row % 2));
+    }
+    data_block->Finalize();
+    // Null keys form their own group, whatever the value bytes are.
+    data_block->column_vectors[1]->nulls_ptr_->SetFalse(0);
+    data_block->column_vectors[1]->nulls_ptr_->SetFalse(200);
+
+    Vector<u32> group_ids;
+    hash_table.Append(data_block->column_vectors, row_count, group_ids);
+    EXPECT_EQ(hash_table.GroupCount(), 101u);
+    EXPECT_EQ(group_ids[0], group_ids[200]);
+    EXPECT_NE(group_ids[0], group_ids[100]);
+    for (SizeT row = 100; row < row_count; ++row) {
+        if (row != 200) {
+            EXPECT_EQ(group_ids[row], group_ids[row % 100]);
+        }
+    }
+
+    // Appending the same block again creates no new group.
+    Vector<u32> second_group_ids;
+    hash_table.Append(data_block->column_vectors, row_count, second_group_ids);
+    EXPECT_EQ(hash_table.GroupCount(), 101u);
+    EXPECT_EQ(group_ids, second_group_ids);
+
+    // Keys are written back with their null flags.
+    auto key_block = DataBlock::MakeUniquePtr();
+    key_block->Init({MakeShared<DataType>(LogicalType::kBigInt), MakeShared<DataType>(LogicalType::kInteger)});
+    hash_table.AppendGroupKey(group_ids[0], key_block->column_vectors);
+    hash_table.AppendGroupKey(group_ids[57], key_block->column_vectors);
+    key_block->Finalize();
+    EXPECT_EQ(key_block->GetValue(0, 0).GetValue<BigIntT>(), 0);
+    EXPECT_FALSE(key_block->column_vectors[1]->nulls_ptr_->IsTrue(0));
+    EXPECT_EQ(key_block->GetValue(0, 1).GetValue<BigIntT>(), 57);
+    EXPECT_EQ(key_block->GetValue(1, 1).GetValue<IntegerT>(), 1);
+}
+
+TEST_F(HashTableTest, varchar_key) {
+    HashTable hash_table;
+    hash_table.Init({MakeShared<DataType>(LogicalType::kVarchar)});
+
+    Vector<String> keys{"abc", "a much longer key than the inline varchar", "", "abc", "abd", ""};
+    Vector<u32> group_ids;
+    {
+        // The table keeps its own copy of the keys after the input block is released.
+        auto data_block = DataBlock::MakeUniquePtr();
+        data_block->Init({MakeShared<DataType>(LogicalType::kVarchar)});
+        for (const auto &key : keys) {
+            data_block->column_vectors[0]->AppendValue(Value::MakeVarchar(key));
+        }
+        data_block->Finalize();
+        hash_table.Append(data_block->column_vectors, keys.size(), group_ids);
+    }
+    EXPECT_EQ(hash_table.GroupCount(), 4u);
+    EXPECT_EQ(group_ids[0], group_ids[3]);
+    EXPECT_EQ(group_ids[2], group_ids[5]);
+    EXPECT_NE(group_ids[3], group_ids[4]);
+
+    auto key_block = DataBlock::MakeUniquePtr();
+    key_block->Init({MakeShared<DataType>(LogicalType::kVarchar)});
+    for (u32 group_id = 0; group_id < hash_table.GroupCount(); ++group_id) {
+        hash_table.AppendGroupKey(group_id, key_block->column_vectors);
+    }
+    key_block->Finalize();
+    EXPECT_EQ(key_block->GetValue(0, group_ids[1]).GetVarchar(), keys[1]);
+    EXPECT_EQ(key_block->GetValue(0, group_ids[4]).GetVarchar(), keys[4]);
+}
+
+TEST_F(HashTableTest, partition_order) {
+    HashTable hash_table;
+    hash_table.Init({MakeShared<DataType>(LogicalType::kBigInt)});
+
+    constexpr SizeT row_count = 5000;
+    auto data_block = DataBlock::MakeUniquePtr();
+    data_block->Init({MakeShared<DataType>(LogicalType::kBigInt)});
+    for (SizeT row = 0; row < row_count; ++row) {
+        data_block->column_vectors[0]->AppendValue(Value::MakeBigInt(row * 7919));
+    }
+    data_block->Finalize();
+    Vector<u32> group_ids;
+    hash_table.Append(data_block->column_vectors, row_count, group_ids);
+    EXPECT_EQ(hash_table.GroupCount(), row_count);
+
+    Vector<u32> ordered_groups = hash_table.GroupsByPartition();
+    EXPECT_EQ(ordered_groups.size(), row_count);
+    for (SizeT idx = 1; idx < ordered_groups.size(); ++idx) {
+        SizeT prev_partition = HashTable::PartitionIndex(hash_table.GroupHash(ordered_groups[idx - 1]));
+        SizeT partition = HashTable::PartitionIndex(hash_table.GroupHash(ordered_groups[idx]));
+        EXPECT_LE(prev_partition, partition);
+        if (prev_partition == partition) {
+            EXPECT_LT(ordered_groups[idx - 1], ordered_groups[idx]);
+        }
+    }
+}
+
+TEST_F(HashTableTest, partition_keys) {
+    HashTable hash_table;
+    hash_table.Init({MakeShared<DataType>(LogicalType::kBigInt)});
+
+    constexpr SizeT row_count = 3000;
+    auto data_block = DataBlock::MakeUniquePtr();
+    data_block->Init({MakeShared<DataType>(LogicalType::kBigInt)});
+    for (SizeT row = 0; row < row_count; ++row) {
+        data_block->column_vectors[0]->AppendValue(Value::MakeBigInt(row % 1000));
+    }
+    data_block->Finalize();
+
+    Vector<u8> partitions;
+    hash_table.PartitionKeys(data_block->column_vectors, row_count, partitions);
+    EXPECT_EQ(partitions.size(), row_count);
+    EXPECT_EQ(hash_table.GroupCount(), 0u);
+
+    // The partition of a row is the partition of its group, and equal keys share a partition.
+    Vector<u32> group_ids;
+    hash_table.Append(data_block->column_vectors, row_count, group_ids);
+    for (SizeT row = 0; row < row_count; ++row) {
+        EXPECT_EQ(partitions[row], HashTable::PartitionIndex(hash_table.GroupHash(group_ids[row])));
+        EXPECT_EQ(partitions[row], partitions[row % 1000]);
+    }
+}
+
+TEST_F(HashTableTest, group_state_arena) {
+    GroupStateArena group_states;
+    group_states.Init({sizeof(i64), 1, sizeof(double)});
+
+    group_states.Resize(10);
+    char *first_state = group_states.GetState(3, 2);
+    *reinterpret_cast<double *>(first_state) = 1.5;
+    group_states.Resize(GroupStateArena::kChunkGroupCount * 3 + 1);
+    EXPECT_EQ(group_states.GetState(3, 2), first_state);
+    EXPECT_EQ(*reinterpret_cast<double *>(group_states.GetState(3, 2)), 1.5);
+    EXPECT_EQ(reinterpret_cast<u64>(group_states.GetState(GroupStateArena::kChunkGroupCount * 3, 2)) % alignof(double), 0u);
+}
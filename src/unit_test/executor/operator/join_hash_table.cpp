@@ -0,0 +1,133 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import join_hash_table;
+import column_vector;
+import data_block;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+
+using namespace infinity;
+
+class JoinHashTableTest : public BaseTest {};
+
+namespace {
+
+UniquePtr<DataBlock> MakeBigIntBlock(i64 start, SizeT row_count, i64 modulo) {
+    auto data_block = DataBlock::MakeUniquePtr();
+    data_block->Init({MakeShared<DataType>(LogicalType::kBigInt)});
+    for (SizeT row = 0; row < row_count; ++row) {
+        data_block->column_vectors[0]->AppendValue(Value::MakeBigInt((start + row) % modulo));
+    }
+    data_block->Finalize();
+    return data_block;
+}
+
+SizeT CountMatches(const JoinHashTable &hash_table, const DataBlock &probe_block) {
+    Vector<u64> hashes;
+    Vector<bool> valid;
+    JoinHashTable::HashKeys(probe_block.column_vectors, probe_block.row_count(), hashes, valid);
+    SizeT match_count = 0;
+    for (SizeT row = 0; row < probe_block.row_count(); ++row) {
+        if (!valid[row]) {
+            continue;
+        }
+        hash_table.Probe(probe_block.column_vectors, row, hashes[row], [&](const JoinRowRef &) {
+            ++match_count;
+            return true;
+        });
+    }
+    return match_count;
+}
+
+} // namespace
+
+TEST_F(JoinHashTableTest, bigint_key) {
+    JoinHashTable hash_table({MakeShared<DataType>(LogicalType::kBigInt)});
+    // Build side: 0..99 twice
+    hash_table.Build(MakeBigIntBlock(0, 200, 100), MakeBigIntBlock(0, 200, 100));
+    EXPECT_EQ(hash_table.row_count(), 200u);
+    EXPECT_EQ(hash_table.BuildBlockCount(), 1u);
+
+    // Probe side: 50..149, only 50..99 match, each twice
+    auto probe_block = MakeBigIntBlock(50, 100, 1000);
+    EXPECT_EQ(CountMatches(hash_table, *probe_block), 100u);
+
+    // Matched rows carry the right key
+    Vector<u64> hashes;
+    Vector<bool> valid;
+    JoinHashTable::HashKeys(probe_block->column_vectors, probe_block->row_count(), hashes, valid);
+    hash_table.Probe(probe_block->column_vectors, 0, hashes[0], [&](const JoinRowRef &row_ref) {
+        const DataBlock *build_block = hash_table.GetBuildBlock(row_ref.block_id_);
+        EXPECT_EQ(build_block->GetValue(0, row_ref.row_id_).GetValue<BigIntT>(), 50);
+        return true;
+    });
+}
+
+TEST_F(JoinHashTableTest, null_and_varchar_key) {
+    JoinHashTable hash_table({MakeShared<DataType>(LogicalType::kVarchar)});
+
+    auto make_block = [](const Vector<String> &keys) {
+        auto data_block = DataBlock::MakeUniquePtr();
+        data_block->Init({MakeShared<DataType>(LogicalType::kVarchar)});
+        for (const auto &key : keys) {
+            data_block->column_vectors[0]->AppendValue(Value::MakeVarchar(key));
+        }
+        data_block->Finalize();
+        return data_block;
+    };
+
+    auto build_keys = make_block({"abc", "a much longer key than the inline varchar", "abc", "xyz"});
+    build_keys->column_vectors[0]->nulls_ptr_->SetFalse(3);
+    hash_table.Build(make_block({"abc", "a much longer key than the inline varchar", "abc", "xyz"}), std::move(build_keys));
+    // Null key is never inserted
+    EXPECT_EQ(hash_table.row_count(), 3u);
+
+    auto probe_block = make_block({"abc", "xyz", "a much longer key than the inline varchar", "ab"});
+    EXPECT_EQ(CountMatches(hash_table, *probe_block), 3u);
+}
+
+TEST_F(JoinHashTableTest, concurrent_build) {
+    JoinHashTable hash_table({MakeShared<DataType>(LogicalType::kBigInt)});
+    constexpr SizeT thread_count = 4;
+    constexpr SizeT block_per_thread = 8;
+    constexpr SizeT rows_per_block = 1000;
+
+    Vector<Thread> threads;
+    for (SizeT thread_id = 0; thread_id < thread_count; ++thread_id) {
+        threads.emplace_back([&, thread_id] {
+            for (SizeT block_idx = 0; block_idx < block_per_thread; ++block_idx) {
+                i64 start = (thread_id * block_per_thread + block_idx) * rows_per_block;
+                hash_table.Build(MakeBigIntBlock(start, rows_per_block, 1 << 30), MakeBigIntBlock(start, rows_per_block, 1 << 30));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(hash_table.row_count(), thread_count * block_per_thread * rows_per_block);
+    EXPECT_EQ(hash_table.BuildBlockCount(), thread_count * block_per_thread);
+
+    // Each key is unique, so every probe row matches exactly once
+    for (SizeT start = 0; start < thread_count * block_per_thread * rows_per_block; start += rows_per_block) {
+        auto probe_block = MakeBigIntBlock(start, rows_per_block, 1 << 30);
+        EXPECT_EQ(CountMatches(hash_table, *probe_block), rows_per_block);
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import parallel_block_parser;
+import data_block;
+import value;
+import data_type;
+import logical_type;
+
+using namespace infinity;
+
+class ParallelBlockParserTest : public BaseTest {};
+
+namespace {
+
+// one row per chunk line, parsed as an integer
+SharedPtr<DataBlock> ParseIntegers(const String &chunk, SizeT row_count) {
+    auto data_block = MakeShared<DataBlock>();
+    data_block->Init(Vector<SharedPtr<DataType>>{MakeShared<DataType>(LogicalType::kBigInt)}, row_count);
+    IStringStream is(chunk);
+    for (SizeT i = 0; i < row_count; ++i) {
+        i64 v = 0;
+        is >> v;
+        data_block->AppendValue(0, Value::MakeBigInt(v));
+    }
+    data_block->Finalize();
+    return data_block;
+}
+
+} // namespace
+
+TEST_F(ParallelBlockParserTest, order) {
+    constexpr SizeT chunk_count = 200;
+    constexpr SizeT rows_per_chunk = 4;
+    Atomic<SizeT> parsed_count{0};
+    ParallelBlockParser parser(4, 1024, [&](const String &chunk, SizeT row_count) {
+        // later chunks finish first now and then
+        if (parsed_count++ % 3 == 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        return ParseIntegers(chunk, row_count);
+    });
+    EXPECT_EQ(parser.thread_count(), 4u);
+
+    Vector<SharedPtr<DataBlock>> blocks;
+    for (SizeT chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx) {
+        String chunk;
+        for (SizeT i = 0; i < rows_per_chunk; ++i) {
+            chunk += std::to_string(chunk_idx * rows_per_chunk + i) + "\n";
+        }
+        parser.Submit(std::move(chunk), rows_per_chunk, blocks);
+    }
+    parser.Finish(blocks);
+
+    ASSERT_EQ(blocks.size(), chunk_count);
+    i64 expected = 0;
+    for (const auto &block : blocks) {
+        ASSERT_EQ(block->row_count(), rows_per_chunk);
+        for (SizeT i = 0; i < rows_per_chunk; ++i) {
+            EXPECT_EQ(block->GetValue(0, i).GetValue<BigIntT>(), expected++);
+        }
+    }
+}
+
+TEST_F(ParallelBlockParserTest, memory_budget) {
+    constexpr SizeT chunk_size = 100;
+    constexpr SizeT memory_budget = 3 * chunk_size;
+    std::mutex mutex;
+    SizeT parsing = 0;
+    SizeT max_parsing = 0;
+    ParallelBlockParser parser(8, memory_budget, [&](const String &chunk, SizeT row_count) {
+        {
+            std::unique_lock lock(mutex);
+            max_parsing = std::max(max_parsing, ++parsing);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        {
+            std::unique_lock lock(mutex);
+            --parsing;
+        }
+        return ParseIntegers(chunk, row_count);
+    });
+
+    Vector<SharedPtr<DataBlock>> blocks;
+    for (SizeT chunk_idx = 0; chunk_idx < 50; ++chunk_idx) {
+        String chunk(chunk_size, ' ');
+        chunk[0] = '1';
+        parser.Submit(std::move(chunk), 1, blocks);
+    }
+    parser.Finish(blocks);
+    EXPECT_EQ(blocks.size(), 50u);
+    // no more chunks than fit in the budget are parsed at once
+    EXPECT_LE(max_parsing, memory_budget / chunk_size);
+
+    // a chunk larger than the budget is still accepted
+    parser.Submit(String(2 * memory_budget, ' ') + "7", 1, blocks);
+    parser.Finish(blocks);
+    ASSERT_EQ(blocks.size(), 51u);
+    EXPECT_EQ(blocks.back()->GetValue(0, 0).GetValue<BigIntT>(), 7);
+}
+
+TEST_F(ParallelBlockParserTest, error) {
+    ParallelBlockParser parser(2, 1024, [&](const String &chunk, SizeT row_count) -> SharedPtr<DataBlock> {
+        if (chunk == "bad") {
+            throw std::runtime_error("bad chunk");
+        }
+        return ParseIntegers(chunk, row_count);
+    });
+
+    Vector<SharedPtr<DataBlock>> blocks;
+    parser.Submit("1", 1, blocks);
+    parser.Submit("bad", 1, blocks);
+    parser.Submit("2", 1, blocks);
+    EXPECT_THROW(parser.Finish(blocks), std::runtime_error);
+}
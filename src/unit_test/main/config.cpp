@@ -76,6 +76,7 @@ TEST_F(ConfigTest, test1) {
     EXPECT_EQ(config.LRUNum(), 7);
     EXPECT_EQ(config.TempDir(), "/var/infinity/tmp");
     EXPECT_EQ(config.MemIndexMemoryQuota(), 4 * 1024l * 1024l * 1024l);
+    EXPECT_EQ(config.SortMemoryLimit(), 256 * 1024l * 1024l);
 
     EXPECT_EQ(config.ResultCache(), "off");
     EXPECT_EQ(config.CacheResultNum(), 10000);
@@ -0,0 +1,212 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import status;
+import sql_parser;
+import base_statement;
+import select_statement;
+import parsed_expr;
+import constant_expr;
+import function_expr;
+import pg_protocol_handler;
+import pg_prepared_statement;
+
+using namespace infinity;
+class PGPreparedStatementTest : public BaseTest {
+protected:
+    // Arguments of the comparisons of "WHERE x = .. AND y = ..", right hand side
+    static Pair<ConstantExpr *, ConstantExpr *> WhereConstants(const PGPreparedStatement &prepared_statement) {
+        auto *select_statement = (SelectStatement *)(prepared_statement.statement());
+        auto *and_expr = (FunctionExpr *)(select_statement->where_expr_);
+        auto *left_expr = (FunctionExpr *)((*and_expr->arguments_)[0]);
+        auto *right_expr = (FunctionExpr *)((*and_expr->arguments_)[1]);
+        return {(ConstantExpr *)((*left_expr->arguments_)[1]), (ConstantExpr *)((*right_expr->arguments_)[1])};
+    }
+
+    static PGBindMessage TextBind(Vector<Optional<String>> values) {
+        PGBindMessage bind_message;
+        bind_message.parameter_values_ = std::move(values);
+        return bind_message;
+    }
+
+    SQLParser parser_{};
+};
+
+TEST_F(PGPreparedStatementTest, rewrite_placeholders) {
+    {
+        // '$n' may appear out of order and more than once
+        PGPreparedStatement prepared_statement("SELECT a FROM t1 WHERE a = $2 AND b = $1;", {});
+        EXPECT_TRUE(prepared_statement.Parse(&parser_).ok());
+        EXPECT_EQ(prepared_statement.parameter_types().size(), 2u);
+
+        Vector<PGBoundParameter> parameters;
+        EXPECT_TRUE(prepared_statement.BindParameters(TextBind({"7", "abc"}), parameters).ok());
+        prepared_statement.ApplyParameters(parameters);
+        auto [a_value, b_value] = WhereConstants(prepared_statement);
+        EXPECT_EQ(a_value->literal_type_, LiteralType::kString);
+        EXPECT_STREQ(a_value->str_value_, "abc");
+        EXPECT_EQ(b_value->literal_type_, LiteralType::kInteger);
+        EXPECT_EQ(b_value->integer_value_, 7);
+    }
+    {
+        PGPreparedStatement prepared_statement("SELECT a FROM t1 WHERE a = $1 OR b = $1;", {});
+        EXPECT_TRUE(prepared_statement.Parse(&parser_).ok());
+        EXPECT_EQ(prepared_statement.parameter_types().size(), 1u);
+
+        Vector<PGBoundParameter> parameters;
+        EXPECT_TRUE(prepared_statement.BindParameters(TextBind({"2.5"}), parameters).ok());
+        prepared_statement.ApplyParameters(parameters);
+        auto [a_value, b_value] = WhereConstants(prepared_statement);
+        EXPECT_EQ(a_value->literal_type_, LiteralType::kDouble);
+        EXPECT_EQ(b_value->literal_type_, LiteralType::kDouble);
+        EXPECT_EQ(b_value->double_value_, 2.5);
+    }
+    {
+        // placeholders within quotes are kept as they are
+        PGPreparedStatement prepared_statement("SELECT a FROM t1 WHERE b = '$1 ?' AND a = $1;", {});
+        EXPECT_TRUE(prepared_statement.Parse(&parser_).ok());
+        EXPECT_EQ(prepared_statement.parameter_types().size(), 1u);
+
+        Vector<PGBoundParameter> parameters;
+        EXPECT_TRUE(prepared_statement.BindParameters(TextBind({"1"}), parameters).ok());
+        prepared_statement.ApplyParameters(parameters);
+        auto [b_value, a_value] = WhereConstants(prepared_statement);
+        EXPECT_EQ(b_value->literal_type_, LiteralType::kString);
+        EXPECT_STREQ(b_value->str_value_, "$1 ?");
+        EXPECT_EQ(a_value->integer_value_, 1);
+    }
+    {
+        // '?' is accepted as a positional placeholder as well
+        PGPreparedStatement prepared_statement("SELECT a FROM t1 WHERE a = ? AND b = ?;", {});
+        EXPECT_TRUE(prepared_statement.Parse(&parser_).ok());
+        EXPECT_EQ(prepared_statement.parameter_types().size(), 2u);
+    }
+    {
+        PGPreparedStatement prepared_statement("SELECT a FROM t1 WHERE a = $1 AND;", {});
+        EXPECT_FALSE(prepared_statement.Parse(&parser_).ok());
+    }
+    {
+        PGPreparedStatement prepared_statement("SELECT a FROM t1 WHERE a = $1; SELECT b FROM t1;", {});
+        EXPECT_FALSE(prepared_statement.Parse(&parser_).ok());
+    }
+}
+
+TEST_F(PGPreparedStatementTest, decode_text) {
+    // bool, int4, float8, date, varchar
+    PGPreparedStatement prepared_statement("SELECT $1, $2, $3, $4, $5;", {16, 23, 701, 1082, 1043});
+    EXPECT_TRUE(prepared_statement.Parse(&parser_).ok());
+
+    Vector<PGBoundParameter> parameters;
+    EXPECT_TRUE(prepared_statement.BindParameters(TextBind({"t", "-42", "1e3", "2024-01-31", "12"}), parameters).ok());
+    ASSERT_EQ(parameters.size(), 5u);
+    EXPECT_EQ(parameters[0].literal_type_, LiteralType::kBoolean);
+    EXPECT_TRUE(parameters[0].bool_value_);
+    EXPECT_EQ(parameters[1].literal_type_, LiteralType::kInteger);
+    EXPECT_EQ(parameters[1].integer_value_, -42);
+    EXPECT_EQ(parameters[2].literal_type_, LiteralType::kDouble);
+    EXPECT_EQ(parameters[2].double_value_, 1000.0);
+    EXPECT_EQ(parameters[3].literal_type_, LiteralType::kDate);
+    EXPECT_EQ(parameters[3].str_value_, "2024-01-31");
+    // a declared text type stays text even if it looks like a number
+    EXPECT_EQ(parameters[4].literal_type_, LiteralType::kString);
+    EXPECT_EQ(parameters[4].str_value_, "12");
+
+    // NULL parameters
+    EXPECT_TRUE(prepared_statement.BindParameters(TextBind({None, None, None, None, None}), parameters).ok());
+    for (const auto &parameter : parameters) {
+        EXPECT_EQ(parameter.literal_type_, LiteralType::kNull);
+    }
+
+    EXPECT_FALSE(prepared_statement.BindParameters(TextBind({"maybe", "1", "1", "2024-01-31", "x"}), parameters).ok());
+    EXPECT_FALSE(prepared_statement.BindParameters(TextBind({"t", "1.5", "1", "2024-01-31", "x"}), parameters).ok());
+    EXPECT_FALSE(prepared_statement.BindParameters(TextBind({"t", "1", "abc", "2024-01-31", "x"}), parameters).ok());
+    // wrong number of parameters
+    EXPECT_FALSE(prepared_statement.BindParameters(TextBind({"t", "1"}), parameters).ok());
+}
+
+TEST_F(PGPreparedStatementTest, decode_binary) {
+    // bool, int2, int4, int8, float4, float8
+    PGPreparedStatement prepared_statement("SELECT $1, $2, $3, $4, $5, $6;", {16, 21, 23, 20, 700, 701});
+    EXPECT_TRUE(prepared_statement.Parse(&parser_).ok());
+
+    PGBindMessage bind_message;
+    bind_message.parameter_formats_ = {1};
+    bind_message.parameter_values_ = {String("\x01", 1),
+                                      String("\xff\xfe", 2),
+                                      String("\x00\x01\x00\x00", 4),
+                                      String("\xff\xff\xff\xff\xff\xff\xff\xff", 8),
+                                      String("\x3f\xc0\x00\x00", 4),
+                                      String("\xc0\x04\x00\x00\x00\x00\x00\x00", 8)};
+    Vector<PGBoundParameter> parameters;
+    EXPECT_TRUE(prepared_statement.BindParameters(bind_message, parameters).ok());
+    ASSERT_EQ(parameters.size(), 6u);
+    EXPECT_EQ(parameters[0].literal_type_, LiteralType::kBoolean);
+    EXPECT_TRUE(parameters[0].bool_value_);
+    EXPECT_EQ(parameters[1].integer_value_, -2);
+    EXPECT_EQ(parameters[2].integer_value_, 65536);
+    EXPECT_EQ(parameters[3].integer_value_, -1);
+    EXPECT_EQ(parameters[4].literal_type_, LiteralType::kDouble);
+    EXPECT_EQ(parameters[4].double_value_, 1.5);
+    EXPECT_EQ(parameters[5].double_value_, -2.5);
+
+    // one format code per parameter
+    bind_message.parameter_formats_ = {0, 1, 0, 1, 0, 1};
+    bind_message.parameter_values_[0] = "false";
+    bind_message.parameter_values_[2] = "3";
+    bind_message.parameter_values_[4] = "0.25";
+    EXPECT_TRUE(prepared_statement.BindParameters(bind_message, parameters).ok());
+    EXPECT_FALSE(parameters[0].bool_value_);
+    EXPECT_EQ(parameters[1].integer_value_, -2);
+    EXPECT_EQ(parameters[2].integer_value_, 3);
+    EXPECT_EQ(parameters[4].double_value_, 0.25);
+
+    // the number of format codes has to match
+    bind_message.parameter_formats_ = {1, 1};
+    EXPECT_FALSE(prepared_statement.BindParameters(bind_message, parameters).ok());
+
+    // the size of a binary value has to match its type
+    bind_message.parameter_formats_ = {1};
+    bind_message.parameter_values_[2] = String("\x00\x01", 2);
+    EXPECT_FALSE(prepared_statement.BindParameters(bind_message, parameters).ok());
+
+    // binary format of other types isn't supported
+    PGPreparedStatement date_statement("SELECT $1;", {1082});
+    EXPECT_TRUE(date_statement.Parse(&parser_).ok());
+    PGBindMessage date_bind_message;
+    date_bind_message.parameter_formats_ = {1};
+    date_bind_message.parameter_values_ = {String("\x00\x00\x00\x01", 4)};
+    EXPECT_FALSE(date_statement.BindParameters(date_bind_message, parameters).ok());
+}
+
+TEST_F(PGPreparedStatementTest, apply_parameters_again) {
+    PGPreparedStatement prepared_statement("SELECT a FROM t1 WHERE a = $1 AND b = $2;", {0, 0});
+    EXPECT_TRUE(prepared_statement.Parse(&parser_).ok());
+
+    // the statement is parsed once and run with the values of every Bind
+    Vector<PGBoundParameter> parameters;
+    EXPECT_TRUE(prepared_statement.BindParameters(TextBind({"x", "1"}), parameters).ok());
+    prepared_statement.ApplyParameters(parameters);
+    EXPECT_TRUE(prepared_statement.BindParameters(TextBind({"5", None}), parameters).ok());
+    prepared_statement.ApplyParameters(parameters);
+
+    auto [a_value, b_value] = WhereConstants(prepared_statement);
+    EXPECT_EQ(a_value->literal_type_, LiteralType::kInteger);
+    EXPECT_EQ(a_value->integer_value_, 5);
+    EXPECT_EQ(a_value->str_value_, nullptr);
+    EXPECT_EQ(b_value->literal_type_, LiteralType::kNull);
+}
@@ -0,0 +1,98 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import work_stealing_deque;
+import task_scheduler;
+
+using namespace infinity;
+
+class WorkStealingDequeTest : public BaseTest {};
+
+TEST_F(WorkStealingDequeTest, push_pop_steal) {
+    Vector<i64> values(8);
+    WorkStealingDeque<i64 *> deque(4);
+    for (SizeT i = 0; i < 4; ++i) {
+        EXPECT_TRUE(deque.Push(&values[i]));
+    }
+    // Full
+    EXPECT_FALSE(deque.Push(&values[4]));
+    EXPECT_EQ(deque.Size(), 4u);
+
+    // Owner takes the newest, thieves take the oldest.
+    EXPECT_EQ(deque.Pop(), &values[3]);
+    EXPECT_EQ(deque.Steal(), &values[0]);
+    EXPECT_TRUE(deque.Push(&values[5]));
+    EXPECT_TRUE(deque.Push(&values[6]));
+    EXPECT_EQ(deque.Steal(), &values[1]);
+    EXPECT_EQ(deque.Steal(), &values[2]);
+    EXPECT_EQ(deque.Pop(), &values[6]);
+    EXPECT_EQ(deque.Pop(), &values[5]);
+    EXPECT_EQ(deque.Pop(), nullptr);
+    EXPECT_EQ(deque.Steal(), nullptr);
+    EXPECT_EQ(deque.Size(), 0u);
+}
+
+TEST_F(WorkStealingDequeTest, concurrent_steal) {
+    constexpr SizeT item_count = 100000;
+    constexpr SizeT thief_count = 4;
+    Vector<i64> values(item_count);
+    Vector<Atomic<u32>> taken(item_count);
+    WorkStealingDeque<i64 *> deque(1024);
+    Atomic<bool> done{false};
+
+    auto take = [&](i64 *item) { taken[item - values.data()].fetch_add(1); };
+    Vector<Thread> thieves;
+    for (SizeT i = 0; i < thief_count; ++i) {
+        thieves.emplace_back([&] {
+            while (!done.load()) {
+                if (i64 *item = deque.Steal(); item != nullptr) {
+                    take(item);
+                }
+            }
+        });
+    }
+    for (SizeT i = 0; i < item_count; ++i) {
+        while (!deque.Push(&values[i])) {
+            if (i64 *item = deque.Pop(); item != nullptr) {
+                take(item);
+            }
+        }
+        if (i % 3 == 0) {
+            if (i64 *item = deque.Pop(); item != nullptr) {
+                take(item);
+            }
+        }
+    }
+    while (i64 *item = deque.Pop()) {
+        take(item);
+    }
+    done = true;
+    for (auto &thief : thieves) {
+        thief.join();
+    }
+    // Every item is taken exactly once.
+    for (SizeT i = 0; i < item_count; ++i) {
+        EXPECT_EQ(taken[i].load(), 1u);
+    }
+}
+
+TEST_F(WorkStealingDequeTest, stealing_mode) {
+    EXPECT_EQ(TaskStealingModeFromString("off"), TaskStealingMode::kOff);
+    EXPECT_EQ(TaskStealingModeFromString("on"), TaskStealingMode::kGlobal);
+    EXPECT_EQ(TaskStealingModeFromString("numa"), TaskStealingMode::kNumaLocal);
+}
@@ -1524,4 +1524,45 @@ TEST_F(SelectStatementParsingTest, good_search_test) {
     EXPECT_EQ(select_statement->where_expr_->type_, ParsedExprType::kFunction);
 
     result->Reset();
-}
\ No newline at end of file
+}
+
+TEST_F(SelectStatementParsingTest, parameter_placeholder_test) {
+    using namespace infinity;
+    SharedPtr<SQLParser> parser = MakeShared<SQLParser>();
+    SharedPtr<ParserResult> result = MakeShared<ParserResult>();
+
+    {
+        // placeholders are a syntax error outside of prepared statements
+        String input_sql = "SELECT a FROM t1 WHERE a = ?;";
+        parser->Parse(input_sql, result.get());
+        EXPECT_FALSE(result->error_message_.empty());
+        EXPECT_TRUE(result->parameters_.empty());
+    }
+
+    result->allow_parameters_ = true;
+    {
+        String input_sql = "SELECT a FROM t1 WHERE a = ? AND b > ?;";
+        parser->Parse(input_sql, result.get());
+        EXPECT_TRUE(result->error_message_.empty());
+        ASSERT_EQ(result->parameters_.size(), 2);
+
+        auto *select_statement = (SelectStatement *)(*result->statements_ptr_)[0];
+        auto *and_expr = (FunctionExpr *)(select_statement->where_expr_);
+        auto *eq_expr = (FunctionExpr *)((*and_expr->arguments_)[0]);
+        auto *gt_expr = (FunctionExpr *)((*and_expr->arguments_)[1]);
+        // placeholders are collected in order of appearance
+        EXPECT_EQ((*eq_expr->arguments_)[1], result->parameters_[0]);
+        EXPECT_EQ((*gt_expr->arguments_)[1], result->parameters_[1]);
+        EXPECT_EQ(result->parameters_[0]->literal_type_, LiteralType::kNull);
+        result->Reset();
+        EXPECT_TRUE(result->parameters_.empty());
+    }
+
+    {
+        // a failed parse leaves no dangling placeholder
+        String input_sql = "SELECT a FROM t1 WHERE a = ? AND;";
+        parser->Parse(input_sql, result.get());
+        EXPECT_FALSE(result->error_message_.empty());
+        EXPECT_TRUE(result->parameters_.empty());
+    }
+}
@@ -0,0 +1,89 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import new_compaction_alg;
+import default_values;
+
+using namespace infinity;
+
+class CompactionAlgTest : public BaseTest {
+protected:
+    static CompactionSegmentStat MakeStat(SegmentID segment_id, SizeT row_cnt, SizeT deleted_row_cnt, TxnTimeStamp first_delete_ts) {
+        CompactionSegmentStat segment_stat;
+        segment_stat.segment_id_ = segment_id;
+        segment_stat.row_cnt_ = row_cnt;
+        segment_stat.deleted_row_cnt_ = deleted_row_cnt;
+        segment_stat.first_delete_ts_ = first_delete_ts;
+        return segment_stat;
+    }
+};
+
+TEST_F(CompactionAlgTest, delete_ratio) {
+    constexpr SizeT row_bytes = 16;
+    constexpr TxnTimeStamp current_ts = 100000;
+    auto compaction_alg = NewCompactionAlg::GetInstance(row_bytes, 0, current_ts);
+
+    const SizeT segment_row_cnt = DEFAULT_SEGMENT_CAPACITY;
+    // no deletes
+    compaction_alg->AddSegment(MakeStat(0, segment_row_cnt, 0, UNCOMMIT_TS));
+    // below the delete ratio
+    compaction_alg->AddSegment(MakeStat(1, segment_row_cnt, segment_row_cnt / 10, current_ts - 10));
+    compaction_alg->AddSegment(MakeStat(2, segment_row_cnt, segment_row_cnt / 2, current_ts - 10));
+    compaction_alg->AddSegment(MakeStat(3, segment_row_cnt, segment_row_cnt * 3 / 4, current_ts - 10));
+
+    CompactionPlan plan = compaction_alg->GetCompactionPlan(std::numeric_limits<SizeT>::max());
+    EXPECT_TRUE(plan.by_delete_ratio_);
+    // the most deleted segment first, the live rows of both fit in one segment
+    EXPECT_EQ(plan.segment_ids_, (Vector<SegmentID>{3, 2}));
+    EXPECT_EQ(plan.reclaimed_bytes_, (segment_row_cnt / 2 + segment_row_cnt * 3 / 4) * row_bytes);
+    EXPECT_EQ(plan.io_cost_, (segment_row_cnt - segment_row_cnt / 2 + segment_row_cnt - segment_row_cnt * 3 / 4) * row_bytes);
+}
+
+TEST_F(CompactionAlgTest, age_and_budget) {
+    constexpr SizeT row_bytes = 16;
+    constexpr TxnTimeStamp current_ts = 100000;
+    constexpr SizeT index_cnt = 1;
+    auto compaction_alg = NewCompactionAlg::GetInstance(row_bytes, index_cnt, current_ts);
+
+    const SizeT segment_row_cnt = 100000;
+    const SizeT deleted_row_cnt = segment_row_cnt / 2;
+    // same deletes, the older ones are reclaimed first
+    compaction_alg->AddSegment(MakeStat(0, segment_row_cnt, deleted_row_cnt, current_ts - 1));
+    compaction_alg->AddSegment(MakeStat(1, segment_row_cnt, deleted_row_cnt, current_ts - 50000));
+
+    const SizeT segment_io_cost = (segment_row_cnt - deleted_row_cnt) * row_bytes * (1 + index_cnt);
+    // one segment exceeding the budget is still planned
+    CompactionPlan plan = compaction_alg->GetCompactionPlan(segment_io_cost / 2);
+    EXPECT_EQ(plan.segment_ids_, (Vector<SegmentID>{1}));
+    EXPECT_EQ(plan.io_cost_, segment_io_cost);
+
+    plan = compaction_alg->GetCompactionPlan(segment_io_cost * 2);
+    EXPECT_EQ(plan.segment_ids_, (Vector<SegmentID>{1, 0}));
+}
+
+TEST_F(CompactionAlgTest, size_tier) {
+    auto compaction_alg = NewCompactionAlg::GetInstance(16, 0, 100);
+    // small segments without deletes are merged by their size tier
+    for (SegmentID segment_id = 0; segment_id < DBT_COMPACTION_M; ++segment_id) {
+        compaction_alg->AddSegment(MakeStat(segment_id, DBT_COMPACTION_S, 0, UNCOMMIT_TS));
+    }
+    CompactionPlan plan = compaction_alg->GetCompactionPlan(std::numeric_limits<SizeT>::max());
+    EXPECT_FALSE(plan.by_delete_ratio_);
+    EXPECT_EQ(plan.segment_ids_.size(), DBT_COMPACTION_M);
+    EXPECT_EQ(plan.reclaimed_bytes_, 0u);
+}
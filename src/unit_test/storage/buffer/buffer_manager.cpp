@@ -264,6 +264,77 @@ TEST_F(BufferManagerTest, varfile_test) {
     }
 }
 
+TEST_F(BufferManagerTest, scan_resistance_and_prefetch) {
+    const SizeT file_size = 100;
+    const SizeT file_num = 20;
+    auto MakeFileWorker = [&](SizeT i) {
+        auto file_name = MakeShared<String>(fmt::format("file_{}", i));
+        return MakeUnique<DataFileWorker>(data_dir_, temp_dir_, MakeShared<String>(""), file_name, file_size, nullptr);
+    };
+    {
+        BufferManager buffer_mgr(file_num * file_size, data_dir_, temp_dir_, nullptr);
+        for (SizeT i = 0; i < file_num; ++i) {
+            BufferObj *buffer_obj = buffer_mgr.AllocateBufferObject(MakeFileWorker(i));
+            buffer_obj->AddObjRc();
+            {
+                auto buffer_handle = buffer_obj->Load();
+                auto *data = reinterpret_cast<char *>(buffer_handle.GetDataMut());
+                for (SizeT j = 0; j < file_size; ++j) {
+                    data[j] = 'a' + (i + j) % 26;
+                }
+            }
+            buffer_obj->Save();
+        }
+    }
+    {
+        // room for 4 buffers
+        BufferManager buffer_mgr(4 * file_size, data_dir_, temp_dir_, nullptr, 1);
+        Vector<BufferObj *> buffer_objs;
+        for (SizeT i = 0; i < file_num; ++i) {
+            buffer_objs.push_back(buffer_mgr.GetBufferObject(MakeFileWorker(i)));
+        }
+        auto LoadOnce = [&](SizeT i) { auto buffer_handle = buffer_objs[i]->Load(); };
+
+        // file 0 is loaded again after it is freed, so it is hot
+        for (SizeT i = 0; i <= 4; ++i) {
+            LoadOnce(i);
+        }
+        EXPECT_EQ(buffer_objs[0]->status(), BufferStatus::kFreed);
+        LoadOnce(0);
+        // a scan over the other files does not free it
+        for (SizeT i = 5; i < file_num; ++i) {
+            LoadOnce(i);
+        }
+        EXPECT_EQ(buffer_objs[0]->status(), BufferStatus::kUnloaded);
+        EXPECT_EQ(buffer_objs[5]->status(), BufferStatus::kFreed);
+
+        // no free memory, prefetch does not free other buffers
+        buffer_mgr.Prefetch({buffer_objs[5]});
+        buffer_mgr.WaitPrefetch({buffer_objs[5]});
+        EXPECT_EQ(buffer_objs[5]->status(), BufferStatus::kFreed);
+        EXPECT_EQ(buffer_mgr.memory_usage(), 4 * file_size);
+    }
+    {
+        BufferManager buffer_mgr(file_num * file_size, data_dir_, temp_dir_, nullptr);
+        Vector<BufferObj *> buffer_objs;
+        for (SizeT i = 0; i < file_num; ++i) {
+            buffer_objs.push_back(buffer_mgr.GetBufferObject(MakeFileWorker(i)));
+        }
+        buffer_mgr.Prefetch(buffer_objs);
+        buffer_mgr.WaitPrefetch();
+        EXPECT_EQ(buffer_mgr.memory_usage(), file_num * file_size);
+        for (SizeT i = 0; i < file_num; ++i) {
+            EXPECT_EQ(buffer_objs[i]->status(), BufferStatus::kUnloaded);
+            auto buffer_handle = buffer_objs[i]->Load();
+            const auto *data = reinterpret_cast<const char *>(buffer_handle.GetData());
+            for (SizeT j = 0; j < file_size; ++j) {
+                EXPECT_EQ(data[j], char('a' + (i + j) % 26));
+            }
+        }
+        EXPECT_EQ(buffer_mgr.memory_usage(), file_num * file_size);
+    }
+}
+
 struct FileInfo {
     FileInfo(int file_id) : file_id_(file_id) {}
 
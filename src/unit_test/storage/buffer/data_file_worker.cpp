@@ -0,0 +1,140 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+import stl;
+import data_file_worker;
+import infinity_context;
+import persistence_manager;
+import storage;
+import virtual_store;
+import internal_types;
+
+using namespace infinity;
+
+class DataFileWorkerTest : public BaseTestParamStr {
+protected:
+    // Saves the buffer, then checks it reads back the same through both the file read and the mmap path.
+    // Returns the size of the saved file.
+    SizeT RoundTrip(const String &file_name, const Vector<char> &buffer, SizeT element_size) {
+        auto file_worker = MakeFileWorker(file_name, buffer.size(), element_size);
+        return SaveAndLoad(file_worker.get(), buffer);
+    }
+
+    UniquePtr<DataFileWorker> MakeFileWorker(const String &file_name, SizeT buffer_size, SizeT element_size) {
+        auto data_dir = MakeShared<String>(GetFullDataDir());
+        auto temp_dir = MakeShared<String>(GetFullTmpDir());
+        PersistenceManager *persistence_manager = InfinityContext::instance().storage()->persistence_manager();
+        return MakeUnique<DataFileWorker>(data_dir,
+                                          temp_dir,
+                                          MakeShared<String>("data_file_worker"),
+                                          MakeShared<String>(file_name),
+                                          buffer_size,
+                                          persistence_manager,
+                                          element_size);
+    }
+
+    SizeT SaveAndLoad(DataFileWorker *file_worker, const Vector<char> &buffer) {
+        file_worker->AllocateInMemory();
+        std::memcpy(file_worker->GetData(), buffer.data(), buffer.size());
+        file_worker->WriteToFile(false);
+        file_worker->FreeInMemory();
+
+        file_worker->ReadFromFile(false);
+        EXPECT_EQ(std::memcmp(file_worker->GetData(), buffer.data(), buffer.size()), 0);
+        file_worker->FreeInMemory();
+
+        file_worker->Mmap();
+        EXPECT_EQ(std::memcmp(file_worker->GetMmapData(), buffer.data(), buffer.size()), 0);
+        file_worker->Munmap();
+
+        if (file_worker->persistence_manager_ != nullptr) {
+            return file_worker->obj_addr_.part_size_;
+        }
+        return VirtualStore::GetFileSize(file_worker->GetFilePath());
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestWithDifferentParams,
+                         DataFileWorkerTest,
+                         ::testing::Values(BaseTestParamStr::NULL_CONFIG_PATH, BaseTestParamStr::VFS_OFF_CONFIG_PATH));
+
+TEST_P(DataFileWorkerTest, save_load_round_trip) {
+    constexpr SizeT row_count = 8192;
+    constexpr SizeT raw_header_size = 3 * sizeof(u64);
+    std::mt19937_64 rng(42);
+
+    {
+        // low cardinality integers are dictionary encoded
+        Vector<i64> values(row_count);
+        for (auto &value : values) {
+            value = static_cast<i64>(rng() % 5) - 2;
+        }
+        Vector<char> buffer(reinterpret_cast<char *>(values.data()), reinterpret_cast<char *>(values.data() + row_count));
+        EXPECT_LT(RoundTrip("int.col", buffer, sizeof(i64)), buffer.size() / 4);
+    }
+    {
+        // a varchar tag column, the tail of the block is empty
+        const Vector<String> tags = {"books", "music", "electronics", "garden"};
+        Vector<VarcharT> values(row_count);
+        for (SizeT i = 0; i < row_count / 2; ++i) {
+            const String &tag = tags[rng() % tags.size()];
+            values[i].length_ = tag.size();
+            std::memcpy(values[i].short_.data_, tag.data(), tag.size());
+        }
+        Vector<char> buffer(reinterpret_cast<char *>(values.data()), reinterpret_cast<char *>(values.data() + row_count));
+        EXPECT_LT(RoundTrip("varchar.col", buffer, sizeof(VarcharT)), buffer.size() / 16);
+    }
+    {
+        // random values are saved raw
+        Vector<u32> values(row_count);
+        for (auto &value : values) {
+            value = rng();
+        }
+        Vector<char> buffer(reinterpret_cast<char *>(values.data()), reinterpret_cast<char *>(values.data() + row_count));
+        EXPECT_EQ(RoundTrip("random.col", buffer, sizeof(u32)), raw_header_size + buffer.size());
+    }
+    {
+        // no element size: booleans and wide values are saved raw
+        Vector<char> buffer(row_count, 0);
+        EXPECT_EQ(RoundTrip("bool.col", buffer, 0), raw_header_size + buffer.size());
+    }
+}
+
+TEST_P(DataFileWorkerTest, save_shrinking_encoding) {
+    constexpr SizeT row_count = 8192;
+    constexpr SizeT encoded_header_size = 5 * sizeof(u64);
+    auto file_worker = MakeFileWorker("shrink.col", row_count * sizeof(i64), sizeof(i64));
+
+    // a partially filled block of a constant column: two runs
+    Vector<i64> values(row_count, 0);
+    std::fill(values.begin(), values.begin() + row_count / 2, 7);
+    Vector<char> buffer(reinterpret_cast<char *>(values.data()), reinterpret_cast<char *>(values.data() + row_count));
+    const SizeT two_runs_size = encoded_header_size + sizeof(u32) + 2 * (sizeof(i64) + sizeof(u32)) + sizeof(u64);
+    EXPECT_EQ(SaveAndLoad(file_worker.get(), buffer), two_runs_size);
+
+    // the full block is a frame of reference without offsets, the file written in place must not keep the tail of the previous save
+    std::fill(values.begin(), values.end(), 7);
+    buffer.assign(reinterpret_cast<char *>(values.data()), reinterpret_cast<char *>(values.data() + row_count));
+    EXPECT_EQ(SaveAndLoad(file_worker.get(), buffer), encoded_header_size + sizeof(i64) + sizeof(u8) + sizeof(u64));
+
+    // and back to raw data, which is larger
+    std::mt19937_64 rng(42);
+    for (auto &value : values) {
+        value = rng();
+    }
+    buffer.assign(reinterpret_cast<char *>(values.data()), reinterpret_cast<char *>(values.data() + row_count));
+    EXPECT_EQ(SaveAndLoad(file_worker.get(), buffer), 3 * sizeof(u64) + buffer.size());
+}
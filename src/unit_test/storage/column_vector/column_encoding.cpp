@@ -0,0 +1,149 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import column_encoding;
+import infinity_exception;
+import internal_types;
+
+using namespace infinity;
+
+class ColumnEncodingTest : public BaseTest {
+protected:
+    template <typename T>
+    static ColumnEncodingType RoundTrip(const Vector<T> &values) {
+        Vector<char> encoded;
+        ColumnEncodingType encoding_type = ColumnEncoder::Encode(reinterpret_cast<const char *>(values.data()), sizeof(T), values.size(), encoded);
+        if (encoding_type == ColumnEncodingType::kPlain) {
+            EXPECT_TRUE(encoded.empty());
+            return encoding_type;
+        }
+        EXPECT_LT(encoded.size(), values.size() * sizeof(T));
+        Vector<T> decoded(values.size());
+        ColumnEncoder::Decode(encoding_type, encoded.data(), encoded.size(), sizeof(T), values.size(), reinterpret_cast<char *>(decoded.data()));
+        EXPECT_EQ(decoded, values);
+        return encoding_type;
+    }
+};
+
+TEST_F(ColumnEncodingTest, pick_encoding) {
+    constexpr SizeT row_count = 8192;
+    std::mt19937_64 rng(42);
+
+    // few distinct values scattered over the rows
+    Vector<i64> category(row_count);
+    for (auto &value : category) {
+        value = static_cast<i64>(rng() % 5) * 1000000007 - 3;
+    }
+    EXPECT_EQ(RoundTrip(category), ColumnEncodingType::kDictionary);
+
+    // long runs, e.g. the zero tail of a block which isn't full
+    Vector<i32> runs(row_count, 0);
+    for (SizeT i = 0; i < 3000; ++i) {
+        runs[i] = i / 1000 - 1;
+    }
+    EXPECT_EQ(RoundTrip(runs), ColumnEncodingType::kRLE);
+
+    // many distinct values in a narrow range, including negative ones
+    Vector<i64> timestamps(row_count);
+    for (auto &value : timestamps) {
+        value = 1700000000000 + static_cast<i64>(rng() % 100000);
+    }
+    EXPECT_EQ(RoundTrip(timestamps), ColumnEncodingType::kFrameOfReference);
+    Vector<i16> small(row_count);
+    for (auto &value : small) {
+        value = static_cast<i16>(static_cast<i32>(rng() % 200) - 100);
+    }
+    EXPECT_EQ(RoundTrip(small), ColumnEncodingType::kFrameOfReference);
+
+    // encoded by their bits
+    Vector<f64> doubles(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        doubles[i] = (i % 3) * 0.5;
+    }
+    EXPECT_EQ(RoundTrip(doubles), ColumnEncodingType::kDictionary);
+
+    Vector<u64> random(row_count);
+    for (auto &value : random) {
+        value = rng();
+    }
+    EXPECT_EQ(RoundTrip(random), ColumnEncodingType::kPlain);
+}
+
+TEST_F(ColumnEncodingTest, wide_values) {
+    constexpr SizeT row_count = 8192;
+    std::mt19937_64 rng(42);
+
+    // inlined short strings: equal strings have equal bits
+    const Vector<String> tags = {"red", "green", "blue", "a tag of 13 c"};
+    Vector<VarcharT> varchars(row_count);
+    for (auto &varchar : varchars) {
+        const String &tag = tags[rng() % tags.size()];
+        varchar.length_ = tag.size();
+        std::memcpy(varchar.short_.data_, tag.data(), tag.size());
+    }
+    Vector<char> encoded;
+    const char *data = reinterpret_cast<const char *>(varchars.data());
+    ColumnEncodingType encoding_type = ColumnEncoder::Encode(data, sizeof(VarcharT), row_count, encoded);
+    EXPECT_EQ(encoding_type, ColumnEncodingType::kDictionary);
+    EXPECT_LT(encoded.size(), row_count * sizeof(VarcharT) / 8);
+    Vector<VarcharT> decoded(row_count);
+    ColumnEncoder::Decode(encoding_type, encoded.data(), encoded.size(), sizeof(VarcharT), row_count, reinterpret_cast<char *>(decoded.data()));
+    EXPECT_EQ(std::memcmp(decoded.data(), varchars.data(), row_count * sizeof(VarcharT)), 0);
+    for (SizeT i = 0; i < row_count; ++i) {
+        EXPECT_EQ(decoded[i].ToString(), varchars[i].ToString());
+    }
+
+    using Wide = Array<u8, 16>;
+    Vector<Wide> runs(row_count);
+    for (SizeT i = 0; i < 3000; ++i) {
+        runs[i].fill(i / 1000 + 1);
+    }
+    EXPECT_EQ(RoundTrip(runs), ColumnEncodingType::kRLE);
+
+    Vector<Wide> random(row_count);
+    for (auto &value : random) {
+        for (auto &byte : value) {
+            byte = rng();
+        }
+    }
+    EXPECT_EQ(RoundTrip(random), ColumnEncodingType::kPlain);
+
+    // too wide to be encoded
+    EXPECT_FALSE(ColumnEncoder::CanEncode(ColumnEncoder::MAX_ELEMENT_SIZE + 1));
+    Vector<char> zeros((ColumnEncoder::MAX_ELEMENT_SIZE + 1) * row_count, 0);
+    EXPECT_EQ(ColumnEncoder::Encode(zeros.data(), ColumnEncoder::MAX_ELEMENT_SIZE + 1, row_count, encoded), ColumnEncodingType::kPlain);
+}
+
+TEST_F(ColumnEncodingTest, truncated) {
+    Vector<i64> values(1024);
+    for (SizeT i = 0; i < values.size(); ++i) {
+        values[i] = i % 7;
+    }
+    Vector<char> encoded;
+    ColumnEncodingType encoding_type = ColumnEncoder::Encode(reinterpret_cast<const char *>(values.data()), sizeof(i64), values.size(), encoded);
+    EXPECT_NE(encoding_type, ColumnEncodingType::kPlain);
+
+    Vector<i64> decoded(values.size());
+    EXPECT_THROW(ColumnEncoder::Decode(encoding_type,
+                                       encoded.data(),
+                                       encoded.size() - 1,
+                                       sizeof(i64),
+                                       values.size(),
+                                       reinterpret_cast<char *>(decoded.data())),
+                 RecoverableException);
+}
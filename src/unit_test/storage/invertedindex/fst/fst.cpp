@@ -16,6 +16,7 @@
 import base_test;
 import stl;
 import fst;
+import term_automaton;
 
 using namespace infinity;
 
@@ -155,3 +156,59 @@ TEST_F(FstTest, Iterate) {
     }
     EXPECT_EQ(i, b2_num);
 }
+
+TEST_F(FstTest, IteratePrefix) {
+    Vector<u8> buffer;
+    BufferWriter wtr(buffer);
+    FstBuilder builder(wtr);
+    for (auto &month : months) {
+        builder.Insert((u8 *)month.first.c_str(), month.first.length(), month.second);
+    }
+    builder.Finish();
+
+    Fst f(buffer.data(), buffer.size());
+    String prefix = "Ju";
+    FstStream s(f, (u8 *)prefix.data(), prefix.length());
+    EXPECT_EQ(prefix, "Ju");
+    Vector<u8> key;
+    u64 val;
+    Vector<String> names;
+    while (s.Next(key, val)) {
+        names.emplace_back((char *)key.data(), key.size());
+    }
+    EXPECT_EQ(names, Vector<String>({"July", "June"}));
+}
+
+TEST_F(FstTest, IterateAutomaton) {
+    Vector<u8> buffer;
+    BufferWriter wtr(buffer);
+    FstBuilder builder(wtr);
+    for (auto &month : months) {
+        builder.Insert((u8 *)month.first.c_str(), month.first.length(), month.second);
+    }
+    builder.Finish();
+
+    Fst f(buffer.data(), buffer.size());
+    auto collect = [&](TermAutomaton &automaton) {
+        FstAutomatonStream<TermAutomaton> s(f, automaton);
+        Vector<u8> key;
+        u64 val;
+        Vector<Pair<String, u64>> result;
+        while (s.Next(key, val)) {
+            result.emplace_back(String((char *)key.data(), key.size()), val);
+        }
+        return result;
+    };
+
+    WildcardAutomaton wildcard("*ber");
+    Vector<Pair<String, u64>> expected{{"December", 12}, {"November", 11}, {"October", 10}, {"September", 9}};
+    EXPECT_EQ(collect(wildcard), expected);
+
+    LevenshteinAutomaton fuzzy("Jun", 1);
+    expected = {{"June", 6}};
+    EXPECT_EQ(collect(fuzzy), expected);
+
+    PrefixAutomaton prefix("Ma");
+    expected = {{"March", 3}, {"May", 5}};
+    EXPECT_EQ(collect(prefix), expected);
+}
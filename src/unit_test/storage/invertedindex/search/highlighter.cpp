@@ -23,6 +23,7 @@ import stl;
 import standard_analyzer;
 import highlighter;
 import term;
+import term_automaton;
 
 using namespace infinity;
 
@@ -58,7 +59,7 @@ once upon a time there lives an dog.this is a sentence,That is another.你好 
 真的好么？
     )##";
     String output;
-    Highlighter::instance().GetHighlightWithStemmer(query, raw_text, output, &analyzer);
+    Highlighter::instance().GetHighlightWithStemmer(query, {}, raw_text, output, &analyzer);
     std::cout << output << std::endl;
 }
 
@@ -79,6 +80,21 @@ TEST_F(HighlighterTest, test3) {
         R"##({{Redirect|Anarchist|the fictional character|Anarchist (comics)}} {{Redirect|Anarchists}} {{Anarchism sidebar}} {{Libertarianism sidebar}}  '''Anarchism''' is generally defined as the [[political philosophy]] which holds the [[state (polity)|state]] to be undesirable, unnecessary, and harmful,<ref name="definition"> {{Cite journal|last=Malatesta|first=Errico|title=Towards Anarchism|journal=MAN!|publisher=International Group of San Francisco|location=Los Angeles|oclc=3930443|url=http://www.marxists.org/archive/malatesta/1930s/xx/toanarchy.htm|authorlink=Errico Malatesta}} {{Cite journal|url=http://www.theglobeandmail.com/servlet/story/RTGAM.20070514.wxlanarchist14/BNStory/lifeWork/home/ |title=Working for The Man |journal=[[The Globe and Mail]] |accessdate=2008-04-14 |last=Agrell |first=Siri |date=2007-05-14}} {{cite web|url=http://www.britannica.com/eb/article-9117285|title=Anarchism|year=2006|work=Encyclopædia Britannica|publisher=Encyclopædia Britannica Premium Service|accessdate=2006-08-29| archiveurl=)##";
 
     String output;
-    Highlighter::instance().GetHighlightWithStemmer(query, raw_text, output, &analyzer);
+    Highlighter::instance().GetHighlightWithStemmer(query, {}, raw_text, output, &analyzer);
     std::cout << output << std::endl;
 }
+
+TEST_F(HighlighterTest, multi_term) {
+    StandardAnalyzer analyzer;
+    analyzer.InitStemmer(STEM_LANG_ENGLISH);
+    analyzer.SetCharOffset(true);
+    Vector<SharedPtr<TermAutomaton>> query_automata;
+    query_automata.push_back(MakeShared<PrefixAutomaton>("dun"));
+    query_automata.push_back(MakeShared<LevenshteinAutomaton>("spice", 1));
+    String raw_text = "Dunes hide the spica of Arrakis.";
+    String output;
+    Highlighter::instance().GetHighlightWithStemmer({}, query_automata, raw_text, output, &analyzer);
+    EXPECT_NE(output.find("<em>Dunes</em>"), String::npos);
+    EXPECT_NE(output.find("<em>spica</em>"), String::npos);
+    EXPECT_EQ(output.find("<em>Arrakis</em>"), String::npos);
+}
@@ -226,3 +226,38 @@ graphic cards
         }
     }
 }
+
+TEST_F(QueryParserAndOptimizerTest, multi_term_test) {
+    using namespace infinity;
+    Map<String, String> column2analyzer;
+    String default_field("body");
+    SearchDriver driver(column2analyzer, default_field);
+
+    auto check = [&](const String &query, QueryNodeType type, const String &pattern) {
+        std::unique_ptr<QueryNode> query_tree = driver.ParseSingle(query);
+        ASSERT_NE(query_tree, nullptr) << query;
+        EXPECT_EQ(query_tree->GetType(), type) << query;
+        if (type == QueryNodeType::PREFIX_TERM || type == QueryNodeType::WILDCARD_TERM || type == QueryNodeType::FUZZY_TERM) {
+            const auto &multi_term = static_cast<const MultiTermQueryNode &>(*query_tree);
+            EXPECT_EQ(multi_term.pattern_, pattern) << query;
+            EXPECT_EQ(multi_term.column_, "body") << query;
+        }
+    };
+    check("Dun*", QueryNodeType::PREFIX_TERM, "dun");
+    check("d?n*", QueryNodeType::WILDCARD_TERM, "d?n*");
+    check("*une", QueryNodeType::WILDCARD_TERM, "*une");
+    check(R"(du\*ne*)", QueryNodeType::PREFIX_TERM, "du*ne");
+    check("dune~1", QueryNodeType::FUZZY_TERM, "dune");
+    check("dune~", QueryNodeType::FUZZY_TERM, "dune");
+    check(R"("dune*")", QueryNodeType::TERM, "");
+
+    std::unique_ptr<QueryNode> query_tree = driver.ParseSingle("dune~5");
+    ASSERT_NE(query_tree, nullptr);
+    EXPECT_EQ(static_cast<const FuzzyTermQueryNode &>(*query_tree).max_edits_, 2u);
+
+    query_tree = driver.ParseSingle("body:dun* AND god");
+    ASSERT_NE(query_tree, nullptr);
+    query_tree = QueryNode::GetOptimizedQueryTree(std::move(query_tree));
+    ASSERT_EQ(query_tree->GetType(), QueryNodeType::AND);
+    EXPECT_EQ(static_cast<const AndQueryNode &>(*query_tree).children_[0]->GetType(), QueryNodeType::PREFIX_TERM);
+}
@@ -0,0 +1,99 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import term_automaton;
+
+using namespace infinity;
+
+class TermAutomatonTest : public BaseTest {};
+
+TEST_F(TermAutomatonTest, prefix) {
+    PrefixAutomaton automaton("dun");
+    EXPECT_TRUE(automaton.Matches("dun"));
+    EXPECT_TRUE(automaton.Matches("dune"));
+    EXPECT_FALSE(automaton.Matches("du"));
+    EXPECT_FALSE(automaton.Matches("dan"));
+    EXPECT_EQ(automaton.LiteralPrefix(), "dun");
+
+    PrefixAutomaton all("");
+    EXPECT_TRUE(all.Matches(""));
+    EXPECT_TRUE(all.Matches("anything"));
+}
+
+TEST_F(TermAutomatonTest, wildcard) {
+    WildcardAutomaton automaton("d?n*e");
+    EXPECT_TRUE(automaton.Matches("dune"));
+    EXPECT_TRUE(automaton.Matches("dinosaure"));
+    EXPECT_TRUE(automaton.Matches("dne") == false);
+    EXPECT_FALSE(automaton.Matches("dunes"));
+    EXPECT_EQ(automaton.LiteralPrefix(), "d");
+
+    // '?' is a whole UTF-8 character
+    WildcardAutomaton utf8("吉?物");
+    EXPECT_TRUE(utf8.Matches("吉祥物"));
+    EXPECT_TRUE(utf8.Matches("吉a物"));
+    EXPECT_FALSE(utf8.Matches("吉祥祥物"));
+
+    WildcardAutomaton escaped(R"(a\*b*)");
+    EXPECT_TRUE(escaped.Matches("a*b"));
+    EXPECT_TRUE(escaped.Matches("a*bc"));
+    EXPECT_FALSE(escaped.Matches("axb"));
+    EXPECT_EQ(escaped.LiteralPrefix(), "a*b");
+
+    WildcardAutomaton substring("**une*");
+    EXPECT_TRUE(substring.Matches("une"));
+    EXPECT_TRUE(substring.Matches("dunes"));
+    EXPECT_FALSE(substring.Matches("dun"));
+    EXPECT_EQ(substring.LiteralPrefix(), "");
+}
+
+TEST_F(TermAutomatonTest, levenshtein) {
+    LevenshteinAutomaton automaton("dune", 1);
+    EXPECT_TRUE(automaton.Matches("dune"));
+    EXPECT_TRUE(automaton.Matches("dun"));
+    EXPECT_TRUE(automaton.Matches("dunes"));
+    EXPECT_TRUE(automaton.Matches("dane"));
+    EXPECT_TRUE(automaton.Matches("udne") == false);
+    EXPECT_FALSE(automaton.Matches("dan"));
+    EXPECT_FALSE(automaton.Matches("gun"));
+
+    LevenshteinAutomaton two("dune", 2);
+    EXPECT_TRUE(two.Matches("udne"));
+    EXPECT_TRUE(two.Matches("gun"));
+    EXPECT_FALSE(two.Matches("g"));
+
+    // edits count characters, not bytes
+    LevenshteinAutomaton utf8("吉祥物", 1);
+    EXPECT_TRUE(utf8.Matches("吉羊物"));
+    EXPECT_TRUE(utf8.Matches("吉物"));
+    EXPECT_FALSE(utf8.Matches("物"));
+}
+
+TEST_F(TermAutomatonTest, uncached) {
+    PrefixAutomaton prefix("dun");
+    EXPECT_TRUE(prefix.MatchesUncached("dune"));
+    EXPECT_FALSE(prefix.MatchesUncached("du"));
+
+    WildcardAutomaton wildcard("d?n*");
+    EXPECT_TRUE(wildcard.MatchesUncached("dune"));
+    EXPECT_FALSE(wildcard.MatchesUncached("dne"));
+
+    LevenshteinAutomaton levenshtein("dune", 1);
+    EXPECT_TRUE(levenshtein.MatchesUncached("dane"));
+    EXPECT_FALSE(levenshtein.MatchesUncached("gun"));
+}
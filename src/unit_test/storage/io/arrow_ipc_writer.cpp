@@ -0,0 +1,132 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include <arrow/array.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/record_batch.h>
+import base_test;
+
+import stl;
+import third_party;
+import status;
+import arrow_ipc_writer;
+import data_table;
+import data_block;
+import table_def;
+import column_def;
+import data_type;
+import logical_type;
+import embedding_info;
+import internal_types;
+import value;
+
+using namespace infinity;
+
+class ArrowIPCWriterTest : public BaseTest {};
+
+TEST_F(ArrowIPCWriterTest, round_trip) {
+    constexpr SizeT block_count = 2;
+    constexpr SizeT row_count = 100;
+    constexpr SizeT dimension = 4;
+    constexpr SizeT null_row = 7;
+
+    Vector<SharedPtr<DataType>> column_types{
+        MakeShared<DataType>(LogicalType::kBigInt),
+        MakeShared<DataType>(LogicalType::kVarchar),
+        MakeShared<DataType>(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemFloat, dimension)),
+    };
+    Vector<String> column_names{"id", "name", "vec"};
+    Vector<SharedPtr<ColumnDef>> columns;
+    for (SizeT i = 0; i < column_types.size(); ++i) {
+        columns.emplace_back(MakeShared<ColumnDef>(i, column_types[i], column_names[i], std::set<ConstraintType>()));
+    }
+    SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("result"), MakeShared<String>(), columns);
+    SharedPtr<DataTable> result_table = DataTable::Make(table_def, TableType::kResult);
+
+    auto make_name = [](SizeT row) { return row % 2 == 0 ? fmt::format("r{}", row) : fmt::format("a longer name which is not inlined {}", row); };
+    for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
+        SharedPtr<DataBlock> data_block = DataBlock::Make();
+        data_block->Init(column_types);
+        for (SizeT i = 0; i < row_count; ++i) {
+            const SizeT row = block_idx * row_count + i;
+            data_block->AppendValue(0, Value::MakeBigInt(row * 3));
+            data_block->AppendValue(1, Value::MakeVarchar(make_name(row)));
+            Vector<f32> embedding(dimension);
+            for (SizeT j = 0; j < dimension; ++j) {
+                embedding[j] = row + j * 0.5f;
+            }
+            data_block->AppendValue(2, Value::MakeEmbedding(embedding));
+        }
+        data_block->Finalize();
+        if (block_idx == 0) {
+            data_block->column_vectors[1]->nulls_ptr_->SetFalse(null_row);
+        }
+        result_table->Append(data_block);
+    }
+
+    String output;
+    Status status = ArrowIPCWriter::Serialize(*result_table, output);
+    ASSERT_TRUE(status.ok());
+
+    auto reader_result = arrow::ipc::RecordBatchStreamReader::Open(std::make_shared<arrow::io::BufferReader>(arrow::Buffer::FromString(output)));
+    ASSERT_TRUE(reader_result.ok());
+    auto reader = reader_result.ValueOrDie();
+    auto schema = reader->schema();
+    ASSERT_EQ(schema->num_fields(), 3);
+    EXPECT_EQ(schema->field(0)->name(), "id");
+    EXPECT_TRUE(schema->field(0)->type()->Equals(arrow::int64()));
+    EXPECT_TRUE(schema->field(1)->type()->Equals(arrow::utf8()));
+    EXPECT_TRUE(schema->field(2)->type()->Equals(arrow::fixed_size_list(arrow::float32(), dimension)));
+
+    SizeT batch_count = 0;
+    while (true) {
+        std::shared_ptr<arrow::RecordBatch> batch;
+        ASSERT_TRUE(reader->ReadNext(&batch).ok());
+        if (batch == nullptr) {
+            break;
+        }
+        ASSERT_EQ(batch->num_rows(), static_cast<i64>(row_count));
+        auto ids = std::static_pointer_cast<arrow::Int64Array>(batch->column(0));
+        auto names = std::static_pointer_cast<arrow::StringArray>(batch->column(1));
+        auto vecs = std::static_pointer_cast<arrow::FixedSizeListArray>(batch->column(2));
+        auto vec_values = std::static_pointer_cast<arrow::FloatArray>(vecs->values());
+        EXPECT_EQ(names->null_count(), batch_count == 0 ? 1 : 0);
+        for (SizeT i = 0; i < row_count; ++i) {
+            const SizeT row = batch_count * row_count + i;
+            EXPECT_EQ(ids->Value(i), static_cast<i64>(row * 3));
+            if (batch_count == 0 && i == null_row) {
+                EXPECT_TRUE(names->IsNull(i));
+            } else {
+                EXPECT_EQ(names->GetString(i), make_name(row));
+            }
+            for (SizeT j = 0; j < dimension; ++j) {
+                EXPECT_EQ(vec_values->Value(i * dimension + j), row + j * 0.5f);
+            }
+        }
+        ++batch_count;
+    }
+    EXPECT_EQ(batch_count, block_count);
+}
+
+TEST_F(ArrowIPCWriterTest, not_supported) {
+    Vector<SharedPtr<ColumnDef>> columns{MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kHugeInt), "h", std::set<ConstraintType>())};
+    SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("result"), MakeShared<String>(), columns);
+    SharedPtr<DataTable> result_table = DataTable::Make(table_def, TableType::kResult);
+
+    String output;
+    Status status = ArrowIPCWriter::Serialize(*result_table, output);
+    EXPECT_EQ(status.code(), ErrorCode::kNotSupported);
+}
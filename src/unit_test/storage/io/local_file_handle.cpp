@@ -18,6 +18,7 @@ import base_test;
 import stl;
 import virtual_store;
 import local_file_handle;
+import async_file_io;
 
 using namespace infinity;
 
@@ -280,3 +281,75 @@ TEST_F(LocalFileTest, TestCleanDir) {
     VirtualStore::RemoveDirectory(dir);
     EXPECT_FALSE(VirtualStore::Exists(dir));
 }
+
+TEST_F(LocalFileTest, TestBatchIO) {
+    using namespace infinity;
+
+    String path = String(GetFullTmpDir()) + "/test_file_batch_io.abc";
+    String copy_path = String(GetFullTmpDir()) + "/test_file_batch_io_copy.abc";
+
+    // several chunks and an unaligned tail
+    SizeT len = 3 * 1024 * 1024 + 123;
+    UniquePtr<char[]> data_array = MakeUnique<char[]>(len);
+    for (SizeT i = 0; i < len; ++i) {
+        data_array[i] = i % 251;
+    }
+    {
+        auto [file_handle, status] = VirtualStore::Open(path, FileAccessMode::kWrite);
+        EXPECT_TRUE(status.ok());
+        // write the two halves in reverse order
+        SizeT half = len / 2;
+        EXPECT_TRUE(file_handle->PWrite(data_array.get() + half, len - half, half).ok());
+        EXPECT_TRUE(file_handle->PWrite(data_array.get(), half, 0).ok());
+    }
+    {
+        auto [file_handle, status] = VirtualStore::Open(path, FileAccessMode::kRead);
+        EXPECT_TRUE(status.ok());
+        UniquePtr<char[]> read_array = MakeUnique<char[]>(len + 10);
+        file_handle->Seek(10);
+        auto [read_n, read_status] = file_handle->BatchRead(read_array.get(), len);
+        EXPECT_TRUE(read_status.ok());
+        // stops at the end of file
+        EXPECT_EQ(read_n, len - 10);
+        EXPECT_EQ(std::memcmp(read_array.get(), data_array.get() + 10, len - 10), 0);
+
+        // the file offset follows the batch read
+        file_handle->Seek(0);
+        auto [read_n1, read_status1] = file_handle->BatchRead(read_array.get(), 100);
+        auto [read_n2, read_status2] = file_handle->Read(read_array.get() + 100, 100);
+        EXPECT_EQ(read_n1 + read_n2, 200u);
+        EXPECT_EQ(std::memcmp(read_array.get(), data_array.get(), 200), 0);
+
+        Vector<FileIORequest> requests;
+        Vector<UniquePtr<char[]>> buffers;
+        for (SizeT offset = 0; offset < len; offset += 4096 * 7) {
+            buffers.push_back(MakeUnique<char[]>(4096));
+            FileIORequest request;
+            request.buffer_ = buffers.back().get();
+            request.nbytes_ = 4096;
+            request.offset_ = offset;
+            requests.push_back(request);
+        }
+        EXPECT_TRUE(file_handle->Submit(requests).ok());
+        for (SizeT i = 0; i < requests.size(); ++i) {
+            const auto &request = requests[i];
+            EXPECT_EQ(request.done_, std::min<u64>(4096, len - request.offset_));
+            EXPECT_EQ(std::memcmp(buffers[i].get(), data_array.get() + request.offset_, request.done_), 0);
+        }
+    }
+
+    // copy with the source opened with O_DIRECT, or without it where unsupported
+    EXPECT_TRUE(VirtualStore::Copy(copy_path, path, true).ok());
+    EXPECT_EQ(VirtualStore::GetFileSize(copy_path), len);
+    {
+        auto [file_handle, status] = VirtualStore::Open(copy_path, FileAccessMode::kRead);
+        EXPECT_TRUE(status.ok());
+        UniquePtr<char[]> read_array = MakeUnique<char[]>(len);
+        auto [read_n, read_status] = file_handle->BatchRead(read_array.get(), len);
+        EXPECT_EQ(read_n, len);
+        EXPECT_EQ(std::memcmp(read_array.get(), data_array.get(), len), 0);
+    }
+
+    VirtualStore::DeleteFile(path);
+    VirtualStore::DeleteFile(copy_path);
+}
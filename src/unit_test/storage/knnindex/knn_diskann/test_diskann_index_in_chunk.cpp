@@ -0,0 +1,132 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import internal_types;
+import index_base;
+import diskann_index_in_chunk;
+import infinity_exception;
+import virtual_store;
+import local_file_handle;
+
+using namespace infinity;
+
+class DiskAnnIndexInChunkTest : public BaseTest {
+public:
+    const String save_dir_ = GetFullTmpDir();
+
+    static constexpr u32 dim_ = 16;
+
+    Vector<f32> RandomData(u32 row_count) {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<f32> distrib;
+        Vector<f32> data(SizeT(row_count) * dim_);
+        for (auto &x : data) {
+            x = distrib(rng);
+        }
+        return data;
+    }
+
+    // ratio of rows whose own vector finds them first
+    f32 SelfRecall(const DiskAnnIndexInChunk &chunk, const Vector<f32> &data, u32 row_count, SegmentOffset base_offset) {
+        u32 correct = 0;
+        for (u32 i = 0; i < row_count; ++i) {
+            f32 best_distance = std::numeric_limits<f32>::max();
+            SegmentOffset best_offset = std::numeric_limits<SegmentOffset>::max();
+            chunk.Search(
+                data.data() + SizeT(i) * dim_,
+                1,
+                50,
+                4,
+                [](SegmentOffset) { return true; },
+                [&](f32 distance, SegmentOffset segment_offset) {
+                    if (distance < best_distance) {
+                        best_distance = distance;
+                        best_offset = segment_offset;
+                    }
+                });
+            if (best_offset == base_offset + i) {
+                ++correct;
+            }
+        }
+        return f32(correct) / row_count;
+    }
+
+    void SaveAndReload(const DiskAnnIndexInChunk &chunk, const String &file_name, DiskAnnIndexInChunk &loaded_chunk) {
+        String file_path = save_dir_ + "/" + file_name;
+        // the chunk does not start at the beginning of the file, like chunks packed by the object store
+        constexpr SizeT prefix_size = 100;
+        {
+            auto [file_handle, status] = VirtualStore::Open(file_path, FileAccessMode::kWrite);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            Vector<char> prefix(prefix_size, 'x');
+            file_handle->Append(prefix.data(), prefix_size);
+            chunk.SaveIndexInner(*file_handle);
+        }
+        {
+            auto [file_handle, status] = VirtualStore::Open(file_path, FileAccessMode::kRead);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            file_handle->Seek(prefix_size);
+            loaded_chunk.ReadIndexInner(*file_handle);
+        }
+    }
+};
+
+TEST_F(DiskAnnIndexInChunkTest, test_disk) {
+    constexpr u32 row_count = 2000;
+    constexpr SegmentOffset base_offset = 8192;
+    auto data = RandomData(row_count);
+
+    DiskAnnIndexInChunk chunk(MetricType::kMetricL2, dim_, 16, 100, 4);
+    chunk.Build(data.data(), base_offset, row_count, save_dir_);
+    EXPECT_EQ(chunk.GetRowCount(), row_count);
+    EXPECT_GE(SelfRecall(chunk, data, row_count, base_offset), 0.9);
+
+    DiskAnnIndexInChunk loaded_chunk(MetricType::kMetricL2, dim_, 16, 100, 4);
+    SaveAndReload(chunk, "diskann_chunk.idx", loaded_chunk);
+    EXPECT_EQ(loaded_chunk.GetRowCount(), row_count);
+    // only the compressed vectors are resident
+    EXPECT_LT(loaded_chunk.MemoryUsed(), data.size() * sizeof(f32));
+    EXPECT_GE(SelfRecall(loaded_chunk, data, row_count, base_offset), 0.9);
+
+    // filtered rows are never reported
+    loaded_chunk.Search(
+        data.data(),
+        10,
+        50,
+        4,
+        [](SegmentOffset segment_offset) { return segment_offset % 2 == 1; },
+        [](f32, SegmentOffset segment_offset) { EXPECT_EQ(segment_offset % 2, 1u); });
+}
+
+TEST_F(DiskAnnIndexInChunkTest, test_flat) {
+    constexpr u32 row_count = 100;
+    auto data = RandomData(row_count);
+
+    DiskAnnIndexInChunk chunk(MetricType::kMetricL2, dim_, 16, 100, 4);
+    chunk.Build(data.data(), 0, row_count, save_dir_);
+    EXPECT_EQ(SelfRecall(chunk, data, row_count, 0), 1.0);
+
+    DiskAnnIndexInChunk loaded_chunk(MetricType::kMetricL2, dim_, 16, 100, 4);
+    SaveAndReload(chunk, "diskann_flat_chunk.idx", loaded_chunk);
+    EXPECT_EQ(loaded_chunk.GetRowCount(), row_count);
+    EXPECT_EQ(SelfRecall(loaded_chunk, data, row_count, 0), 1.0);
+}
@@ -0,0 +1,118 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <random>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import simd_init;
+import simd_functions;
+import half_simd_funcs;
+import internal_types;
+import hnsw_alg;
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-variable"
+import data_store;
+#pragma clang diagnostic pop
+
+import dist_func_l2;
+import vec_store_type;
+import hnsw_common;
+
+using namespace infinity;
+
+class HalfDistTest : public BaseTest {
+public:
+    template <typename HalfT>
+    void TestKernels(HalfDistanceFuncType l2_func, HalfDistanceFuncType ip_func, HalfDistanceFuncType cos_func) {
+        // Odd dimension covers the scalar tail of the kernels.
+        constexpr SizeT dim = 133;
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<float> distrib(-1.0f, 1.0f);
+        Vector<HalfT> v1(dim), v2(dim);
+        for (SizeT i = 0; i < dim; ++i) {
+            v1[i] = HalfT(distrib(rng));
+            v2[i] = HalfT(distrib(rng));
+        }
+        f64 l2 = 0, ip = 0, norm1 = 0, norm2 = 0;
+        for (SizeT i = 0; i < dim; ++i) {
+            f64 a = float(v1[i]), b = float(v2[i]);
+            l2 += (a - b) * (a - b);
+            ip += a * b;
+            norm1 += a * a;
+            norm2 += b * b;
+        }
+        const auto *p1 = reinterpret_cast<const u16 *>(v1.data());
+        const auto *p2 = reinterpret_cast<const u16 *>(v2.data());
+        EXPECT_NEAR(l2_func(p1, p2, dim), l2, 1e-3 * std::abs(l2));
+        EXPECT_NEAR(ip_func(p1, p2, dim), ip, 1e-2 * std::max(1.0, std::abs(ip)));
+        EXPECT_NEAR(cos_func(p1, p2, dim), ip / std::sqrt(norm1 * norm2), 1e-2);
+    }
+};
+
+TEST_F(HalfDistTest, convert) {
+    for (float f : {0.0f, -0.0f, 1.0f, -2.5f, 65504.0f, 6.1035156e-05f, 5.9604645e-08f}) {
+        EXPECT_EQ(F16ToF32(Float16T(f).raw), float(Float16T(f)));
+        EXPECT_EQ(BF16ToF32(BFloat16T(f).raw), float(BFloat16T(f)));
+    }
+    EXPECT_TRUE(std::isinf(F16ToF32(0x7c00)));
+    EXPECT_TRUE(std::isnan(F16ToF32(0x7e00)));
+}
+
+TEST_F(HalfDistTest, kernels) {
+    const auto &simd_functions = GetSIMD_FUNCTIONS();
+    TestKernels<Float16T>(F16L2BF, F16IPBF, F16CosBF);
+    TestKernels<Float16T>(simd_functions.HNSW_F16L2_ptr_, simd_functions.HNSW_F16IP_ptr_, simd_functions.HNSW_F16Cos_ptr_);
+    TestKernels<BFloat16T>(BF16L2BF, BF16IPBF, BF16CosBF);
+    TestKernels<BFloat16T>(simd_functions.HNSW_BF16L2_ptr_, simd_functions.HNSW_BF16IP_ptr_, simd_functions.HNSW_BF16Cos_ptr_);
+}
+
+TEST_F(HalfDistTest, hnsw_f16) {
+    using LabelT = u64;
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<Float16T>, LabelT>;
+
+    int dim = 16;
+    int M = 8;
+    int ef_construction = 200;
+    int chunk_size = 128;
+    int max_chunk_n = 10;
+    int element_size = max_chunk_n * chunk_size;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> distrib_real;
+    auto data = MakeUnique<Float16T[]>(dim * element_size);
+    for (int i = 0; i < dim * element_size; ++i) {
+        data[i] = Float16T(distrib_real(rng));
+    }
+
+    auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+    auto iter = DenseVectorIter<Float16T, LabelT>(data.get(), dim, element_size);
+    hnsw_index->InsertVecs(std::move(iter));
+    hnsw_index->Check();
+
+    KnnSearchOption search_option{.ef_ = 10};
+    int correct = 0;
+    for (int i = 0; i < element_size; ++i) {
+        const Float16T *query = data.get() + i * dim;
+        auto result = hnsw_index->KnnSearchSorted(query, 1, search_option);
+        if (result[0].second == (LabelT)i) {
+            ++correct;
+        }
+    }
+    EXPECT_GE(float(correct) / element_size, 0.95);
+}
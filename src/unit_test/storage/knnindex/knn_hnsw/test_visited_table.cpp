@@ -0,0 +1,74 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import hnsw_visited_table;
+
+using namespace infinity;
+
+class VisitedTableTest : public BaseTest {};
+
+TEST_F(VisitedTableTest, epoch_reset) {
+    VisitedTable table;
+    EXPECT_TRUE(table.Reset(100));
+    EXPECT_EQ(table.Capacity(), 100u);
+    EXPECT_TRUE(table.TryVisit(3));
+    EXPECT_FALSE(table.TryVisit(3));
+    table.SetVisited(7);
+    EXPECT_TRUE(table.Visited(7));
+
+    // A new epoch forgets the old visits without clearing.
+    EXPECT_FALSE(table.Reset(50));
+    EXPECT_FALSE(table.Visited(3));
+    EXPECT_FALSE(table.Visited(7));
+
+    // Run the epoch around, visits of the last epoch must not leak into the next one.
+    for (SizeT i = 0; i < std::numeric_limits<VisitedTable::TagType>::max(); ++i) {
+        table.SetVisited(i % 100);
+        table.Reset(100);
+        EXPECT_FALSE(table.Visited(i % 100));
+    }
+
+    // Grow keeps nothing.
+    table.SetVisited(99);
+    EXPECT_TRUE(table.Reset(101));
+    EXPECT_GE(table.Capacity(), 150u);
+    EXPECT_FALSE(table.Visited(99));
+}
+
+TEST_F(VisitedTableTest, pool) {
+    VisitedTableStatistics before = VisitedTablePool::GetStatistics();
+    {
+        auto visited = VisitedTablePool::Acquire(1000);
+        EXPECT_GE(visited->Capacity(), 1000u);
+        visited->SetVisited(10);
+        {
+            // Nested acquire gets a different table.
+            auto nested = VisitedTablePool::Acquire(1000);
+            EXPECT_NE(&*visited, &*nested);
+            EXPECT_FALSE(nested->Visited(10));
+        }
+    }
+    {
+        auto visited = VisitedTablePool::Acquire(500);
+        EXPECT_FALSE(visited->Visited(10));
+    }
+    VisitedTableStatistics after = VisitedTablePool::GetStatistics();
+    EXPECT_EQ(after.acquire_count_ - before.acquire_count_, 3u);
+    EXPECT_GE(after.hit_count_ - before.hit_count_, 1u);
+    EXPECT_GE(after.memory_bytes_, 1000 * sizeof(VisitedTable::TagType));
+}
@@ -32,6 +32,7 @@ import logical_type;
 import persistence_manager;
 import default_values;
 import local_file_handle;
+import roaring_bitmap;
 
 using namespace infinity;
 
@@ -176,3 +177,57 @@ TEST_P(BlockVersionTest, get_delete_ts_test) {
     EXPECT_EQ(res->ToString(2), "0");
     EXPECT_EQ(res->ToString(3), "40");
 }
+
+TEST_P(BlockVersionTest, delete_bitmap_test) {
+    BlockVersion block_version(8192);
+    block_version.Append(10, 8192);
+    for (i32 offset = 3; offset < 8192; offset += 100) {
+        block_version.Delete(offset, 20 + offset % 2);
+    }
+
+    // snapshots after the latest change share the cached bitmap
+    SharedPtr<const Bitmap> delete_bitmap = block_version.GetDeleteBitmap(30);
+    EXPECT_EQ(delete_bitmap.get(), block_version.GetDeleteBitmap(40).get());
+    EXPECT_EQ(delete_bitmap->CountTrue(), 82u);
+    for (i32 offset = 0; offset < 8192; ++offset) {
+        EXPECT_EQ(delete_bitmap->IsTrue(offset), block_version.CheckDelete(offset, 30));
+    }
+    EXPECT_EQ(delete_bitmap->NextTrue(4), 103u);
+    EXPECT_EQ(delete_bitmap->NextTrue(8104), 8192u);
+
+    // an older snapshot does not see the later deletes
+    SharedPtr<const Bitmap> old_bitmap = block_version.GetDeleteBitmap(20);
+    for (i32 offset = 0; offset < 8192; ++offset) {
+        EXPECT_EQ(old_bitmap->IsTrue(offset), block_version.CheckDelete(offset, 20));
+    }
+
+    // a new delete rebuilds the cached bitmap
+    block_version.Delete(0, 50);
+    EXPECT_FALSE(delete_bitmap->IsTrue(0));
+    EXPECT_TRUE(block_version.GetDeleteBitmap(50)->IsTrue(0));
+    EXPECT_FALSE(block_version.GetDeleteBitmap(49)->IsTrue(0));
+}
+
+TEST_P(BlockVersionTest, delete_bitmap_out_of_order_test) {
+    BlockVersion block_version(8192);
+    block_version.Append(10, 4096);
+    EXPECT_FALSE(block_version.GetDeleteBitmap(100)->IsTrue(1));
+
+    // deletes are applied on prepare commit, appends later on commit: a delete at ts 110 comes before an append at ts 105
+    block_version.Delete(1, 110);
+    block_version.Append(105, 8192);
+    SharedPtr<const Bitmap> delete_bitmap = block_version.GetDeleteBitmap(120);
+    EXPECT_TRUE(delete_bitmap->IsTrue(1));
+    EXPECT_TRUE(block_version.GetDeleteBitmap(110)->IsTrue(1));
+    EXPECT_FALSE(block_version.GetDeleteBitmap(109)->IsTrue(1));
+
+    // a delete below the latest one is visible in the shared bitmap as well
+    block_version.Delete(2, 107);
+    EXPECT_FALSE(delete_bitmap->IsTrue(2));
+    delete_bitmap = block_version.GetDeleteBitmap(120);
+    EXPECT_TRUE(delete_bitmap->IsTrue(1));
+    EXPECT_TRUE(delete_bitmap->IsTrue(2));
+    EXPECT_EQ(delete_bitmap->CountTrue(), 2u);
+    EXPECT_TRUE(block_version.GetDeleteBitmap(108)->IsTrue(2));
+    EXPECT_FALSE(block_version.GetDeleteBitmap(108)->IsTrue(1));
+}
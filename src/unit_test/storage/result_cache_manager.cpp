@@ -13,6 +13,7 @@ import query_context;
 import operator_state;
 import logical_type;
 import data_block;
+import value;
 
 using namespace infinity;
 
@@ -38,6 +39,51 @@ private:
     String key_;
 };
 
+// the result of a top n query on key_
+class MockTopNCachedNode : public CachedNodeBase {
+public:
+    MockTopNCachedNode(String key, SizeT topn, SharedPtr<Vector<String>> output_names)
+        : CachedNodeBase(LogicalNodeType::kMock, output_names), key_(std::move(key)), topn_(topn) {}
+
+    u64 Hash() const override { return HashIgnoreTopN() ^ std::hash<SizeT>{}(topn_); }
+
+    bool Eq(const CachedNodeBase &other_base) const override {
+        return EqIgnoreTopN(other_base) && topn_ == static_cast<const MockTopNCachedNode &>(other_base).topn_;
+    }
+
+    SizeT TopN() const override { return topn_; }
+
+    u64 HashIgnoreTopN() const override { return CachedNodeBase::Hash() ^ std::hash<String>{}(key_); }
+
+    bool EqIgnoreTopN(const CachedNodeBase &other_base) const override {
+        if (type() != other_base.type()) {
+            return false;
+        }
+        return key_ == static_cast<const MockTopNCachedNode &>(other_base).key_;
+    }
+
+private:
+    String key_;
+    SizeT topn_;
+};
+
+namespace {
+
+// one integer column holding 0..row_count-1
+Vector<UniquePtr<DataBlock>> MakeIntegerBlocks(SizeT row_count) {
+    auto block = MakeUnique<DataBlock>();
+    block->Init(Vector<SharedPtr<DataType>>{MakeShared<DataType>(LogicalType::kInteger)}, std::max<SizeT>(row_count, 1));
+    for (SizeT i = 0; i < row_count; ++i) {
+        block->AppendValue(0, Value::MakeInt(IntegerT(i)));
+    }
+    block->Finalize();
+    Vector<UniquePtr<DataBlock>> blocks;
+    blocks.push_back(std::move(block));
+    return blocks;
+}
+
+} // namespace
+
 TEST(ResultCacheManagerTest, test1) {
     ResultCacheManager cache_manager(100);
 
@@ -135,3 +181,77 @@ TEST(ResultCacheManagerTest, test2) {
     auto res2 = cache_manager.GetCache(*cached_node21);
     EXPECT_FALSE(res2.has_value());
 }
+
+TEST(ResultCacheManagerTest, test_topn) {
+    ResultCacheManager cache_manager(100);
+    auto output_names = MakeShared<Vector<String>>(Vector<String>{"col1"});
+
+    bool success = cache_manager.AddCache(MakeUnique<MockTopNCachedNode>("key1", 100, output_names), MakeIntegerBlocks(100));
+    EXPECT_TRUE(success);
+
+    // a smaller top n is answered by the first rows of the cached result
+    auto res1 = cache_manager.GetCache(MockTopNCachedNode("key1", 10, output_names));
+    ASSERT_TRUE(res1.has_value());
+    ASSERT_EQ(res1->cache_content_->row_count(), 10u);
+    for (SizeT i = 0; i < 10; ++i) {
+        EXPECT_EQ(res1->cache_content_->data_blocks_[0]->GetValue(0, i).GetValue<IntegerT>(), IntegerT(i));
+    }
+    auto res2 = cache_manager.GetCache(MockTopNCachedNode("key1", 100, output_names));
+    ASSERT_TRUE(res2.has_value());
+    EXPECT_EQ(res2->cache_content_->row_count(), 100u);
+
+    EXPECT_FALSE(cache_manager.GetCache(MockTopNCachedNode("key1", 101, output_names)).has_value());
+    EXPECT_FALSE(cache_manager.GetCache(MockTopNCachedNode("key2", 10, output_names)).has_value());
+
+    // a result with less rows than its top n answers any smaller top n
+    success = cache_manager.AddCache(MakeUnique<MockTopNCachedNode>("key2", 100, output_names), MakeIntegerBlocks(5));
+    EXPECT_TRUE(success);
+    auto res3 = cache_manager.GetCache(MockTopNCachedNode("key2", 10, output_names));
+    ASSERT_TRUE(res3.has_value());
+    EXPECT_EQ(res3->cache_content_->row_count(), 5u);
+}
+
+TEST(ResultCacheManagerTest, test_memory_limit) {
+    auto output_names = MakeShared<Vector<String>>(Vector<String>{"col1"});
+    const SizeT memory_size = CacheContent(MakeIntegerBlocks(100), output_names).MemorySize();
+    ASSERT_GT(memory_size, 0u);
+    ResultCacheManager cache_manager(100, memory_size * 2 + memory_size / 2);
+
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key1", output_names), MakeIntegerBlocks(100)));
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key2", output_names), MakeIntegerBlocks(100)));
+    EXPECT_EQ(cache_manager.memory_used(), memory_size * 2);
+
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key3", output_names), MakeIntegerBlocks(100)));
+    EXPECT_EQ(cache_manager.cache_num_used(), 2u);
+    EXPECT_EQ(cache_manager.memory_used(), memory_size * 2);
+    EXPECT_FALSE(cache_manager.GetCache(MockCachedNode("key1", output_names)).has_value());
+
+    // a result larger than the whole budget is never cached
+    EXPECT_FALSE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key4", output_names), MakeIntegerBlocks(1000)));
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key2", output_names)).has_value());
+}
+
+TEST(ResultCacheManagerTest, test_admission) {
+    ResultCacheManager cache_manager(2);
+    auto output_names = MakeShared<Vector<String>>(Vector<String>{"col1"});
+
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key1", output_names), {}));
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key2", output_names), {}));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key1", output_names)).has_value());
+        EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key2", output_names)).has_value());
+    }
+
+    // a result looked up once does not evict the frequent ones
+    EXPECT_FALSE(cache_manager.GetCache(MockCachedNode("key3", output_names)).has_value());
+    EXPECT_FALSE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key3", output_names), {}));
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key1", output_names)).has_value());
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key2", output_names)).has_value());
+
+    // it is admitted once it is looked up as frequently
+    for (int i = 0; i < 8; ++i) {
+        cache_manager.GetCache(MockCachedNode("key3", output_names));
+    }
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key3", output_names), {}));
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key3", output_names)).has_value());
+}
@@ -0,0 +1,117 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+import stl;
+import secondary_index_data;
+import data_type;
+import logical_type;
+import virtual_store;
+import local_file_handle;
+import infinity_exception;
+
+using namespace infinity;
+
+class VarcharSecondaryIndexKeyTest : public BaseTest {};
+
+TEST_F(VarcharSecondaryIndexKeyTest, key_order) {
+    Vector<String> values{"", "a", "ab", String("ab\0", 3), String("ab\0c", 4), "abc", "abcdefg", "abcdefgh", "abcdefgz", "abd", "b", "\xff"};
+    std::sort(values.begin(), values.end());
+    for (SizeT i = 0; i + 1 < values.size(); ++i) {
+        const auto key = ConvertToOrderedKeyValue(std::string_view(values[i]));
+        const auto next_key = ConvertToOrderedKeyValue(std::string_view(values[i + 1]));
+        if (values[i + 1].size() <= kVarcharKeyPrefixLen) {
+            EXPECT_LT(key, next_key) << i;
+        } else {
+            EXPECT_LE(key, next_key) << i;
+        }
+    }
+    // only long values with the same leading bytes share a key
+    EXPECT_EQ(ConvertToOrderedKeyValue(std::string_view("abcdefgh")), ConvertToOrderedKeyValue(std::string_view("abcdefgz")));
+}
+
+TEST_F(VarcharSecondaryIndexKeyTest, range_bound) {
+    const auto begin = VarcharRangeBound::At("ab");
+    const auto end = VarcharRangeBound::PrefixEnd("ab");
+    auto in_prefix_range = [&](std::string_view value) { return begin.CompareValue(value) >= 0 && end.CompareValue(value) <= 0; };
+    EXPECT_TRUE(in_prefix_range("ab"));
+    EXPECT_TRUE(in_prefix_range("abzzzzzzzz"));
+    EXPECT_TRUE(in_prefix_range("ab\xff\xff"));
+    EXPECT_FALSE(in_prefix_range("a"));
+    EXPECT_FALSE(in_prefix_range("ac"));
+    EXPECT_FALSE(in_prefix_range("b"));
+
+    EXPECT_EQ(VarcharRangeBound::PrefixEnd("a\xff"), VarcharRangeBound::Before("b"));
+    EXPECT_EQ(VarcharRangeBound::PrefixEnd("\xff"), VarcharRangeBound::Max());
+    EXPECT_EQ(VarcharRangeBound::PrefixEnd(""), VarcharRangeBound::Max());
+
+    const auto before = VarcharRangeBound::Before("ab");
+    EXPECT_LT(before.CompareValue("aa"), 0);
+    EXPECT_GT(before.CompareValue("ab"), 0);
+    EXPECT_LT(VarcharRangeBound::Lowest(), before);
+    EXPECT_LT(before, begin);
+    EXPECT_LT(begin, end);
+    EXPECT_LT(end, VarcharRangeBound::Max());
+    EXPECT_LT(VarcharRangeBound::Max().CompareValue("\xff\xff"), 0);
+}
+
+TEST_F(VarcharSecondaryIndexKeyTest, chunk_format) {
+    const String path = String(GetFullTmpDir()) + "/varchar_secondary_index_chunk";
+    if (VirtualStore::Exists(path)) {
+        VirtualStore::DeleteFile(path);
+    }
+    auto data_type = MakeShared<DataType>(LogicalType::kVarchar);
+    MultiMap<String, u32> values{{"a", 2}, {"abcdefgh", 0}, {"abcdefgz", 1}};
+    {
+        UniquePtr<SecondaryIndexData> index(GetSecondaryIndexData(data_type, values.size(), true));
+        index->InsertData(&values);
+        auto [file_handle, status] = VirtualStore::Open(path, FileAccessMode::kWrite);
+        ASSERT_TRUE(status.ok());
+        index->SaveIndexInner(*file_handle);
+    }
+    {
+        UniquePtr<SecondaryIndexData> index(GetSecondaryIndexData(data_type, values.size(), false));
+        auto [file_handle, status] = VirtualStore::Open(path, FileAccessMode::kRead);
+        ASSERT_TRUE(status.ok());
+        index->ReadIndexInner(*file_handle);
+        u32 i = 0;
+        for (const auto &[value, offset] : values) {
+            EXPECT_EQ(index->GetVarcharValue(i++), value);
+        }
+    }
+
+    // A chunk saved before the suffix pool layout: hashed keys, offsets and the PGM.
+    VirtualStore::DeleteFile(path);
+    {
+        auto [file_handle, status] = VirtualStore::Open(path, FileAccessMode::kWrite);
+        ASSERT_TRUE(status.ok());
+        for (const auto &[value, offset] : values) {
+            u64 key = std::hash<String>{}(value);
+            file_handle->Append(&key, sizeof(key));
+        }
+        for (const auto &[value, offset] : values) {
+            file_handle->Append(&offset, sizeof(offset));
+        }
+        String pgm(64, '\xff');
+        file_handle->Append(pgm.data(), pgm.size());
+    }
+    {
+        UniquePtr<SecondaryIndexData> index(GetSecondaryIndexData(data_type, values.size(), false));
+        auto [file_handle, status] = VirtualStore::Open(path, FileAccessMode::kRead);
+        ASSERT_TRUE(status.ok());
+        EXPECT_THROW(index->ReadIndexInner(*file_handle), RecoverableException);
+    }
+    VirtualStore::DeleteFile(path);
+}
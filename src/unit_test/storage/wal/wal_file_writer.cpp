@@ -0,0 +1,73 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import wal_file_writer;
+import virtual_store;
+import local_file_handle;
+import status;
+
+using namespace infinity;
+
+class WalFileWriterTest : public BaseTest {};
+
+TEST_F(WalFileWriterTest, write_sync_reopen) {
+    String path = String(GetFullTmpDir()) + "/wal_file_writer.log";
+    if (VirtualStore::Exists(path)) {
+        VirtualStore::DeleteFile(path);
+    }
+
+    // Tiny preallocation segment, so writes cross several segments.
+    WalFileWriter writer(16);
+    writer.Open(path);
+    String first = "first entry";
+    String second(100, 'x');
+    writer.Write(first.data(), first.size());
+    EXPECT_EQ(writer.WrittenSize(), first.size());
+    EXPECT_EQ(writer.SyncedSize(), 0u);
+
+    writer.Sync();
+    EXPECT_EQ(writer.SyncedSize(), first.size());
+    EXPECT_EQ(writer.SyncCount(), 1u);
+    // Nothing new to sync
+    writer.Sync();
+    EXPECT_EQ(writer.SyncCount(), 1u);
+
+    writer.Write(second.data(), second.size());
+    writer.Close(true);
+    EXPECT_FALSE(writer.IsOpen());
+    EXPECT_EQ(writer.SyncCount(), 2u);
+
+    // Preallocated space is not part of the file size.
+    EXPECT_EQ(VirtualStore::GetFileSize(path), first.size() + second.size());
+
+    // Reopen appends to the end.
+    writer.Open(path);
+    EXPECT_EQ(writer.WrittenSize(), first.size() + second.size());
+    writer.Write(first.data(), first.size());
+    writer.Close(true);
+
+    auto [file_handle, status] = VirtualStore::Open(path, FileAccessMode::kRead);
+    ASSERT_TRUE(status.ok());
+    String content(2 * first.size() + second.size(), '\0');
+    auto [read_n, read_status] = file_handle->Read(content.data(), content.size());
+    ASSERT_TRUE(read_status.ok());
+    EXPECT_EQ(read_n, content.size());
+    EXPECT_EQ(content, first + second + first);
+
+    VirtualStore::DeleteFile(path);
+}
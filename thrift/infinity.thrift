@@ -610,6 +610,7 @@ struct SelectRequest {
 11: optional ParsedExpr offset_expr,
 12: optional list<OrderByExpr> order_by_list = [],
 13: optional bool total_hits_count,
+14: optional bool arrow_result,
 }
 
 struct SelectResponse {
@@ -618,6 +619,7 @@ struct SelectResponse {
 3: list<ColumnDef> column_defs = [],
 4: list<ColumnField> column_fields = [];
 5: string extra_result;
+6: optional binary arrow_ipc;
 }
 
 struct DeleteRequest {
@@ -0,0 +1,99 @@
+import argparse
+import os
+import csv
+import random
+from collections import defaultdict
+
+
+def generate(generate_if_exists: bool, copy_dir: str):
+    data_dir = "./test/data/csv"
+    slt_dir = "./test/sql/dql/aggregate"
+
+    table_name = "test_big_groupby_many_groups"
+    data_path = data_dir + "/test_big_groupby_many_groups.csv"
+    slt_path = slt_dir + "/test_big_groupby_many_groups.slt"
+    copy_path = copy_dir + "/test_big_groupby_many_groups.csv"
+
+    os.makedirs(data_dir, exist_ok=True)
+    os.makedirs(slt_dir, exist_ok=True)
+    if (
+        os.path.exists(data_path)
+        and os.path.exists(slt_path)
+        and not generate_if_exists
+    ):
+        print(
+            "File {} and {} already existed exists. Skip Generating.".format(
+                slt_path, data_path
+            )
+        )
+        return
+
+    # More groups than one vector, so the partial results are merged in several partition ranges.
+    row_n = 40000
+    group_n = 20000
+    groupby_c1 = defaultdict(list)
+    with open(data_path, "w") as data_file:
+        writer = csv.writer(data_file)
+        for i in range(row_n):
+            c1 = random.randint(0, group_n - 1)
+            c2 = random.randint(0, 1000)
+            writer.writerow([c1, c2])
+            groupby_c1[c1].append(c2)
+
+    with open(slt_path, "w") as slt_file:
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write("CREATE TABLE {} (c1 int, c2 int);\n".format(table_name))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "COPY {} FROM '{}' WITH ( DELIMITER ',', FORMAT CSV );\n".format(
+                table_name, copy_path
+            )
+        )
+        slt_file.write("\n")
+
+        slt_file.write("query IIIII rowsort\n")
+        slt_file.write(
+            "SELECT c1, COUNT(*), SUM(c2), MIN(c2), MAX(c2) FROM {} GROUP BY c1;\n".format(
+                table_name
+            )
+        )
+        slt_file.write("----\n")
+        select_res = []
+        for c1, c2_list in groupby_c1.items():
+            select_res.append(
+                f"{c1} {len(c2_list)} {sum(c2_list)} {min(c2_list)} {max(c2_list)}\n"
+            )
+        select_res.sort()
+        for res in select_res:
+            slt_file.write(res)
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+        slt_file.write("\n")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generate groupby data for test")
+    parser.add_argument(
+        "-g",
+        "--generate",
+        type=bool,
+        default=False,
+        dest="generate_if_exists",
+    )
+    parser.add_argument(
+        "-c",
+        "--copy",
+        type=str,
+        default="/var/infinity/test_data",
+        dest="copy_dir",
+    )
+    args = parser.parse_args()
+    generate(args.generate_if_exists, args.copy_dir)
@@ -37,6 +37,7 @@ from generate_multivector_knn_scan import generate as generate28
 from generate_groupby1 import generate as generate29
 from generate_unnest import generate as generate30
 from generate_large_import import generate as generate31
+from generate_groupby2 import generate as generate32
 
 
 class SpinnerThread(threading.Thread):
@@ -189,6 +190,7 @@ if __name__ == "__main__":
     generate29(args.generate_if_exists, args.copy)
     generate30(args.generate_if_exists, args.copy)
     generate31(args.generate_if_exists, args.copy)
+    generate32(args.generate_if_exists, args.copy)
 
     print("Generate file finshed.")
 